@@ -0,0 +1,603 @@
+#!/usr/bin/env python3
+"""
+Generates uti/utiUnicodeTables.inl from the Unicode Character Database shipped with Python ( see unicodedata.unidata_version ).
+
+Every property is stored as a two-stage table: the code points are split into blocks of 2^shift code points,
+identical blocks are stored once and a first stage maps the block number to the stored block.
+The block size is chosen per table to keep the tables as small as possible.
+
+The segmentation properties are not part of the Python module, they are read from the text files of the same
+Unicode version ( GraphemeBreakProperty.txt, WordBreakProperty.txt, SentenceBreakProperty.txt and emoji-data.txt
+from https://www.unicode.org/Public/<version>/ucd/ ),
+which are expected in tools/ucd or the directory passed with --ucd.
+
+Usage: python3 tools/GenerateUnicodeTables.py [--ucd directory] [output file]
+"""
+
+import os
+import sys
+import unicodedata
+
+MAX_CODE_POINT = 0x110000
+
+# Case mapping entries: single code point mappings store the delta to the code point with this bias,
+# mappings to several code points store the flag, their length and the offset into the expansion table.
+CASE_DELTA_BIAS = 0x200000
+CASE_EXPANSION_FLAG = 0x80000000
+
+# Normalization property flags, stored above the canonical combining class in the property entries
+NORMALIZATION_FLAGS = [
+	( 'NfdNo', 0x100 ),
+	( 'NfkdNo', 0x200 ),
+	( 'NfcNo', 0x400 ),
+	( 'NfcMaybe', 0x800 ),
+	( 'NfkcNo', 0x1000 ),
+	( 'NfkcMaybe', 0x2000 ),
+]
+FLAG = dict( NORMALIZATION_FLAGS )
+
+# Hangul syllables are decomposed and composed algorithmically
+HANGUL_S_BASE = 0xAC00
+HANGUL_S_COUNT = 11172
+HANGUL_L_BASE = 0x1100
+HANGUL_V_BASE = 0x1161
+HANGUL_V_COUNT = 21
+HANGUL_T_BASE = 0x11A7
+HANGUL_T_COUNT = 28
+
+# Grapheme_Cluster_Break values in the order of unicode::GraphemeBreak
+GRAPHEME_BREAKS = [ 'Other', 'CR', 'LF', 'Control', 'Extend', 'ZWJ', 'Regional_Indicator', 'Prepend', 'SpacingMark', 'L', 'V', 'T', 'LV', 'LVT' ]
+# Flag of the Extended_Pictographic code points in the grapheme properties
+EXTENDED_PICTOGRAPHIC_FLAG = 0x80
+
+# Actions of the grapheme break rules, indexed by the property of the previous and the next code point
+BREAK = 0
+KEEP = 1
+KEEP_IF_EMOJI_ZWJ = 2
+KEEP_IF_ODD_REGIONAL = 3
+
+# Word_Break values in the order of unicode::WordBreak
+WORD_BREAKS = [ 'Other', 'CR', 'LF', 'Newline', 'Extend', 'ZWJ', 'Regional_Indicator', 'Format', 'Katakana', 'Hebrew_Letter',
+	'ALetter', 'Single_Quote', 'Double_Quote', 'MidNumLet', 'MidLetter', 'MidNum', 'Numeric', 'ExtendNumLet', 'WSegSpace' ]
+
+# Actions of the word break rules, indexed by the property of the previous and the next code point, both ignoring
+# the Extend, Format and ZWJ code points of WB4. The conditional actions look at the property of the code point
+# behind the next one ( NEXT ) or in front of the previous one ( PREVIOUS ).
+WORD_KEEP_IGNORED = 2
+WORD_KEEP_IF_NEXT_LETTER = 3
+WORD_KEEP_IF_NEXT_HEBREW = 4
+WORD_KEEP_IF_NEXT_NUMERIC = 5
+WORD_KEEP_IF_PREVIOUS_LETTER = 6
+WORD_KEEP_IF_PREVIOUS_HEBREW = 7
+WORD_KEEP_IF_PREVIOUS_NUMERIC = 8
+WORD_KEEP_IF_ODD_REGIONAL = 9
+
+# Sentence_Break values in the order of unicode::SentenceBreak
+SENTENCE_BREAKS = [ 'Other', 'CR', 'LF', 'Extend', 'Sep', 'Format', 'Sp', 'Lower', 'Upper', 'OLetter', 'Numeric',
+	'ATerm', 'SContinue', 'STerm', 'Close' ]
+
+# States of the sentence break state machine, in the order of unicode::detail::SentenceState*
+SENTENCE_STATES = [ 'Text', 'Letter', 'ATerm', 'LetterATerm', 'ATermClose', 'ATermSpace', 'STermClose', 'STermSpace', 'ParagraphSeparator', 'CR' ]
+
+# Actions of the sentence break transitions, stored above the next state. The look ahead actions keep the sentence
+# going if a Lower code point follows ( SB8 ) and otherwise fall back to break or keep.
+SENTENCE_STATE_BITS = 4
+SENTENCE_KEEP_IGNORED = 2
+SENTENCE_KEEP_IF_LOWER_ELSE_BREAK = 3
+SENTENCE_KEEP_IF_LOWER_ELSE_KEEP = 4
+
+# The normalization forms in the order of unicode::NormalizationForm
+NORMALIZATION_FORMS = [ 'NFC', 'NFD', 'NFKC', 'NFKD' ]
+
+
+def smallest_type( values ):
+	largest = max( values ) if values else 0
+	if largest < 0x100:
+		return 'unsigned char', 1
+	if largest < 0x10000:
+		return 'unsigned short', 2
+	return 'u32', 4
+
+
+class TwoStageTable:
+	"""A per code point property stored as block index and blocks of values."""
+
+	def __init__( self, values, limit = None ):
+		if limit is None:
+			limit = len( values )
+		default = values[ -1 ]
+		# Values above the limit have to be the default, so the lookup can answer them without the table
+		assert all( v == default for v in values[ limit: ] )
+		best = None
+		for shift in range( 4, 10 ):
+			size = 1 << shift
+			count = ( limit + size - 1 ) // size
+			blocks = {}
+			stage1 = []
+			stage2 = []
+			for b in range( count ):
+				block = tuple( values[ b * size + i ] if b * size + i < len( values ) else default for i in range( size ) )
+				if block not in blocks:
+					blocks[ block ] = len( blocks )
+					stage2.extend( block )
+				stage1.append( blocks[ block ] )
+			total = len( stage1 ) * smallest_type( stage1 )[ 1 ] + len( stage2 ) * smallest_type( stage2 )[ 1 ]
+			if best is None or total < best[ 0 ]:
+				best = ( total, shift, stage1, stage2 )
+		self.bytes, self.shift, self.stage1, self.stage2 = best
+		self.limit = len( self.stage1 ) << self.shift
+		self.default = default
+
+
+def format_array( out, type_name, name, values, per_line = 16 ):
+	out.append( '\t\t\ttemplate< typename Dummy >' )
+	out.append( '\t\t\tconst %s %s< Dummy >::%s[ %d ] =' % ( type_name, CURRENT_STRUCT[ 0 ], name, len( values ) ) )
+	out.append( '\t\t\t{' )
+	for i in range( 0, len( values ), per_line ):
+		out.append( '\t\t\t\t' + ', '.join( '0x%X' % v for v in values[ i:i + per_line ] ) + ',' )
+	out.append( '\t\t\t};' )
+	out.append( '' )
+
+
+CURRENT_STRUCT = [ None ]
+
+
+def emit_table_struct( out, struct, description, tables, arrays ):
+	"""Emits a struct holding the stages of the given two-stage tables and additional arrays."""
+	CURRENT_STRUCT[ 0 ] = struct
+	out.append( '\t\t\t/**' )
+	out.append( '\t\t\t\\brief %s' % description )
+	out.append( '\t\t\t*/' )
+	out.append( '\t\t\ttemplate< typename Dummy >' )
+	out.append( '\t\t\tstruct %s' % struct )
+	out.append( '\t\t\t{' )
+	for prefix, table in tables:
+		out.append( '\t\t\t\tstatic const u32 %sShift = %dU;' % ( prefix, table.shift ) )
+		out.append( '\t\t\t\tstatic const u32 %sLimit = 0x%XU;' % ( prefix, table.limit ) )
+		out.append( '\t\t\t\tstatic const %s %sStage1[ %d ];' % ( smallest_type( table.stage1 )[ 0 ], prefix, len( table.stage1 ) ) )
+		out.append( '\t\t\t\tstatic const %s %sStage2[ %d ];' % ( smallest_type( table.stage2 )[ 0 ], prefix, len( table.stage2 ) ) )
+	for type_name, name, values in arrays:
+		out.append( '\t\t\t\tstatic const %s %s[ %d ];' % ( type_name, name, len( values ) ) )
+	out.append( '\t\t\t};' )
+	out.append( '' )
+	for prefix, table in tables:
+		format_array( out, smallest_type( table.stage1 )[ 0 ], prefix + 'Stage1', table.stage1 )
+		format_array( out, smallest_type( table.stage2 )[ 0 ], prefix + 'Stage2', table.stage2 )
+	for type_name, name, values in arrays:
+		format_array( out, type_name, name, values, 8 )
+
+
+def generate_case_tables( out ):
+	expansions = []
+	expansion_offsets = {}
+
+	def entry( code_point, mapped ):
+		mapped = [ ord( c ) for c in mapped ]
+		if len( mapped ) == 1:
+			return mapped[ 0 ] - code_point + CASE_DELTA_BIAS
+		key = tuple( mapped )
+		if key not in expansion_offsets:
+			expansion_offsets[ key ] = len( expansions )
+			expansions.extend( key )
+		return CASE_EXPANSION_FLAG | ( len( key ) << 16 ) | expansion_offsets[ key ]
+
+	identity = ( CASE_DELTA_BIAS, CASE_DELTA_BIAS, CASE_DELTA_BIAS )
+	records = { identity: 0 }
+	record_list = [ identity ]
+	values = []
+	limit = 0
+	for code_point in range( MAX_CODE_POINT ):
+		if 0xD800 <= code_point < 0xE000:
+			values.append( 0 )
+			continue
+		char = chr( code_point )
+		record = ( entry( code_point, char.upper() ), entry( code_point, char.lower() ), entry( code_point, char.casefold() ) )
+		if record not in records:
+			records[ record ] = len( record_list )
+			record_list.append( record )
+		values.append( records[ record ] )
+		if record != identity:
+			limit = code_point + 1
+
+	table = TwoStageTable( values, limit )
+	flat_records = [ v for record in record_list for v in record ]
+	emit_table_struct( out, 'CaseTables',
+		'Upper, lower and fold mapping of every code point, the stages map a code point to a record of three mapping entries.',
+		[ ( 'Case', table ) ],
+		[ ( 'u32', 'Records', flat_records ), ( 'u32', 'Expansions', expansions if expansions else [ 0 ] ) ] )
+	return table.bytes + len( flat_records ) * 4 + len( expansions ) * 4
+
+
+def utf8_lead_byte( code_point ):
+	return chr( code_point ).encode( 'utf-8' )[ 0 ]
+
+
+def utf16_units( text ):
+	units = []
+	for c in text:
+		code_point = ord( c )
+		if code_point < 0x10000:
+			units.append( code_point )
+		else:
+			code_point -= 0x10000
+			units.extend( [ 0xD800 + ( code_point >> 10 ), 0xDC00 + ( code_point & 0x3FF ) ] )
+	return units
+
+
+def is_hangul_syllable( code_point ):
+	return HANGUL_S_BASE <= code_point < HANGUL_S_BASE + HANGUL_S_COUNT
+
+
+def generate_normalization_tables( out ):
+	# Primary composites: canonical pairs which are not excluded from the composition
+	compositions = {}
+	seconds = set( range( HANGUL_V_BASE, HANGUL_V_BASE + HANGUL_V_COUNT ) ) | set( range( HANGUL_T_BASE + 1, HANGUL_T_BASE + HANGUL_T_COUNT ) )
+	for code_point in range( MAX_CODE_POINT ):
+		if 0xD800 <= code_point < 0xE000:
+			continue
+		decomposition = unicodedata.decomposition( chr( code_point ) )
+		if not decomposition or decomposition.startswith( '<' ):
+			continue
+		parts = [ int( p, 16 ) for p in decomposition.split() ]
+		if len( parts ) == 2 and unicodedata.normalize( 'NFC', chr( code_point ) ) == chr( code_point ):
+			compositions.setdefault( parts[ 0 ], [] ).append( ( parts[ 1 ], code_point ) )
+			seconds.add( parts[ 1 ] )
+
+	# Properties: canonical combining class and the quick check flags
+	properties = []
+	property_limit = 0
+	# Decompositions: the full canonical and compatibility decomposition in utf-16 units, behind a header unit
+	# holding the canonical length ( 0 if there is only a compatibility decomposition ), the compatibility length
+	# and if the compatibility decomposition is stored separately
+	decomposition_data = [ 0 ]
+	decomposition_offsets = []
+	decomposition_limit = 0
+	max_length = 1
+	max_per_byte = 1
+	quick_check_limits = dict( ( form, MAX_CODE_POINT ) for form in NORMALIZATION_FORMS )
+	for code_point in range( MAX_CODE_POINT ):
+		if 0xD800 <= code_point < 0xE000:
+			properties.append( 0 )
+			decomposition_offsets.append( 0 )
+			continue
+		char = chr( code_point )
+		entry = unicodedata.combining( char )
+		nfd = unicodedata.normalize( 'NFD', char )
+		nfkd = unicodedata.normalize( 'NFKD', char )
+		if nfd != char:
+			entry |= FLAG[ 'NfdNo' ]
+		if nfkd != char:
+			entry |= FLAG[ 'NfkdNo' ]
+		if unicodedata.normalize( 'NFC', char ) != char:
+			entry |= FLAG[ 'NfcNo' ]
+		elif code_point in seconds:
+			entry |= FLAG[ 'NfcMaybe' ]
+		if unicodedata.normalize( 'NFKC', char ) != char:
+			entry |= FLAG[ 'NfkcNo' ]
+		elif code_point in seconds:
+			entry |= FLAG[ 'NfkcMaybe' ]
+		properties.append( entry )
+		if entry != 0:
+			property_limit = code_point + 1
+
+		for form, flags in ( ( 'NFC', 'NfcNo NfcMaybe' ), ( 'NFD', 'NfdNo' ), ( 'NFKC', 'NfkcNo NfkcMaybe' ), ( 'NFKD', 'NfkdNo' ) ):
+			unsafe = unicodedata.combining( char ) != 0 or any( entry & FLAG[ f ] for f in flags.split() )
+			if unsafe and quick_check_limits[ form ] == MAX_CODE_POINT:
+				quick_check_limits[ form ] = code_point
+
+		if ( nfd == char and nfkd == char ) or is_hangul_syllable( code_point ):
+			decomposition_offsets.append( 0 )
+			continue
+		canonical = utf16_units( nfd ) if nfd != char else []
+		compatibility = utf16_units( nfkd )
+		separate = nfkd != nfd
+		assert len( canonical ) < 0x20 and len( compatibility ) < 0x40
+		decomposition_offsets.append( len( decomposition_data ) )
+		decomposition_data.append( len( canonical ) | ( len( compatibility ) << 5 ) | ( 0x800 if separate else 0 ) )
+		decomposition_data.extend( canonical )
+		if separate:
+			decomposition_data.extend( compatibility )
+		max_length = max( max_length, len( nfd ), len( nfkd ) )
+		max_per_byte = max( max_per_byte, ( len( nfkd ) + len( char.encode( 'utf-8' ) ) - 1 ) // len( char.encode( 'utf-8' ) ) )
+		decomposition_limit = code_point + 1
+	assert len( decomposition_data ) < 0x10000
+
+	# Compositions: the first code point selects a range of ( second, composite ) pairs
+	composition_index = [ 0 ] * MAX_CODE_POINT
+	composition_starts = [ 0 ]
+	composition_pairs = []
+	for first in sorted( compositions ):
+		composition_index[ first ] = len( composition_starts )
+		for second, composite in sorted( compositions[ first ] ):
+			composition_pairs.extend( [ second, composite ] )
+		composition_starts.append( len( composition_pairs ) // 2 )
+	composition_limit = max( compositions ) + 1
+
+	# Only a few combinations of combining class and flags exist, so the stages store an index into the property records
+	property_records = sorted( set( properties ) )
+	property_indices = dict( ( value, index ) for index, value in enumerate( property_records ) )
+	assert property_records[ 0 ] == 0
+	property_table = TwoStageTable( [ property_indices[ value ] for value in properties ], property_limit )
+	decomposition_table = TwoStageTable( decomposition_offsets, decomposition_limit )
+	composition_table = TwoStageTable( composition_index, composition_limit )
+
+	# Bytes below these lead bytes only encode code points which are normalized in every context
+	out.append( '\t\t\t/**' )
+	out.append( '\t\t\t\\brief The utf-8 lead bytes of the first code point which needs a closer look, per normalization form.' )
+	out.append( '' )
+	out.append( '\t\t\tEvery byte below this value belongs to a code point with canonical combining class 0 which is normalized in every context,' )
+	out.append( '\t\t\tso blocks without a larger byte can be skipped by the quick check.' )
+	out.append( '\t\t\t*/' )
+	out.append( '\t\t\tstatic const unsigned char QuickCheckLeadBytes[ %d ] = { %s };' % ( len( NORMALIZATION_FORMS ),
+		', '.join( '0x%X' % utf8_lead_byte( quick_check_limits[ form ] ) for form in NORMALIZATION_FORMS ) ) )
+	out.append( '' )
+	emit_table_struct( out, 'NormalizationTables',
+		'Normalization properties, decompositions and compositions of every code point, Hangul syllables are handled algorithmically.',
+		[ ( 'Property', property_table ), ( 'Decomposition', decomposition_table ), ( 'Composition', composition_table ) ],
+		[ ( 'unsigned short', 'Properties', property_records ), ( 'unsigned short', 'Decompositions', decomposition_data ), ( 'unsigned short', 'CompositionStarts', composition_starts ),
+			( 'u32', 'CompositionPairs', composition_pairs ) ] )
+	return ( max_length, max_per_byte, property_table.bytes + decomposition_table.bytes + composition_table.bytes + len( property_records ) * 2
+		+ len( decomposition_data ) * 2 + len( composition_starts ) * 2 + len( composition_pairs ) * 4 )
+
+
+def load_ucd_property( path ):
+	"""Reads a property file of the Unicode Character Database, returns a dict of code point to value."""
+	values = {}
+	with open( path, encoding = 'utf-8' ) as f:
+		for line in f:
+			line = line.split( '#', 1 )[ 0 ].strip()
+			if not line:
+				continue
+			code_points, value = [ part.strip() for part in line.split( ';' )[ :2 ] ]
+			first, _, last = code_points.partition( '..' )
+			for code_point in range( int( first, 16 ), int( last or first, 16 ) + 1 ):
+				values[ code_point ] = value
+	return values
+
+
+def grapheme_break_rules():
+	"""Builds the action table of the rules GB3 to GB999 of UAX #29 for every pair of properties."""
+	index = dict( ( name, i ) for i, name in enumerate( GRAPHEME_BREAKS ) )
+	hangul = { 'L': [ 'L', 'V', 'LV', 'LVT' ], 'LV': [ 'V', 'T' ], 'V': [ 'V', 'T' ], 'LVT': [ 'T' ], 'T': [ 'T' ] }
+	rules = []
+	for previous in GRAPHEME_BREAKS:
+		for next in GRAPHEME_BREAKS:
+			if previous == 'CR' and next == 'LF':
+				action = KEEP  # GB3
+			elif previous in ( 'Control', 'CR', 'LF' ) or next in ( 'Control', 'CR', 'LF' ):
+				action = BREAK  # GB4, GB5
+			elif next in hangul.get( previous, [] ):
+				action = KEEP  # GB6 to GB8
+			elif next in ( 'Extend', 'ZWJ', 'SpacingMark' ) or previous == 'Prepend':
+				action = KEEP  # GB9 to GB9b
+			elif previous == 'ZWJ' and next == 'Other':
+				action = KEEP_IF_EMOJI_ZWJ  # GB11, Extended_Pictographic code points are Other
+			elif previous == 'Regional_Indicator' and next == 'Regional_Indicator':
+				action = KEEP_IF_ODD_REGIONAL  # GB12, GB13
+			else:
+				action = BREAK  # GB999
+			rules.append( action )
+	return rules
+
+
+def word_break_rules():
+	"""Builds the action table of the rules WB3 to WB999 of UAX #29 for every pair of properties.
+
+	WB3c and WB3d look at the code point in front of the next one before WB4 ignores it, they are handled by the caller.
+	"""
+	letters = ( 'ALetter', 'Hebrew_Letter' )
+	middle_letter = ( 'MidLetter', 'MidNumLet', 'Single_Quote' )
+	middle_number = ( 'MidNum', 'MidNumLet', 'Single_Quote' )
+	rules = []
+	for previous in WORD_BREAKS:
+		for next in WORD_BREAKS:
+			if previous == 'CR' and next == 'LF':
+				action = KEEP  # WB3
+			elif previous in ( 'Newline', 'CR', 'LF' ) or next in ( 'Newline', 'CR', 'LF' ):
+				action = BREAK  # WB3a, WB3b
+			elif next in ( 'Extend', 'Format', 'ZWJ' ):
+				action = WORD_KEEP_IGNORED  # WB4
+			elif previous in letters and next in letters:
+				action = KEEP  # WB5
+			elif previous == 'Hebrew_Letter' and next == 'Single_Quote':
+				action = KEEP  # WB7a, ahead of WB6 which only keeps it in front of a letter
+			elif previous in letters and next in middle_letter:
+				action = WORD_KEEP_IF_NEXT_LETTER  # WB6
+			elif previous in middle_letter and next in letters:
+				action = WORD_KEEP_IF_PREVIOUS_LETTER  # WB7
+			elif previous == 'Hebrew_Letter' and next == 'Double_Quote':
+				action = WORD_KEEP_IF_NEXT_HEBREW  # WB7b
+			elif previous == 'Double_Quote' and next == 'Hebrew_Letter':
+				action = WORD_KEEP_IF_PREVIOUS_HEBREW  # WB7c
+			elif previous in letters + ( 'Numeric', ) and next in letters + ( 'Numeric', ):
+				action = KEEP  # WB8 to WB10
+			elif previous in middle_number and next == 'Numeric':
+				action = WORD_KEEP_IF_PREVIOUS_NUMERIC  # WB11
+			elif previous == 'Numeric' and next in middle_number:
+				action = WORD_KEEP_IF_NEXT_NUMERIC  # WB12
+			elif previous == 'Katakana' and next == 'Katakana':
+				action = KEEP  # WB13
+			elif previous in letters + ( 'Numeric', 'Katakana', 'ExtendNumLet' ) and next == 'ExtendNumLet':
+				action = KEEP  # WB13a
+			elif previous == 'ExtendNumLet' and next in letters + ( 'Numeric', 'Katakana' ):
+				action = KEEP  # WB13b
+			elif previous == 'Regional_Indicator' and next == 'Regional_Indicator':
+				action = WORD_KEEP_IF_ODD_REGIONAL  # WB15, WB16
+			else:
+				action = BREAK  # WB999
+			rules.append( action )
+	return rules
+
+
+def sentence_break_transitions():
+	"""Builds the transition table of the sentence break state machine for every state and property.
+
+	The states remember the part of the rules SB6 to SB11 seen in front of the next code point:
+	a terminator ( SATerm ) followed by Close and Sp code points, and the letter in front of an ATerm for SB7.
+	"""
+	state = dict( ( name, i ) for i, name in enumerate( SENTENCE_STATES ) )
+
+	def enter( previous, next ):
+		"""Returns the state behind the code point \c next, which continues a sentence without a pending terminator."""
+		if next in ( 'Lower', 'Upper' ):
+			return state[ 'Letter' ]
+		if next == 'ATerm':
+			return state[ 'LetterATerm' if previous == 'Letter' else 'ATerm' ]
+		if next == 'STerm':
+			return state[ 'STermClose' ]
+		if next in ( 'Sep', 'LF' ):
+			return state[ 'ParagraphSeparator' ]
+		if next == 'CR':
+			return state[ 'CR' ]
+		return state[ 'Text' ]
+
+	transitions = []
+	for previous in SENTENCE_STATES:
+		a_term = previous in ( 'ATerm', 'LetterATerm', 'ATermClose', 'ATermSpace' )
+		terminated = a_term or previous in ( 'STermClose', 'STermSpace' )
+		closing = previous in ( 'ATerm', 'LetterATerm', 'ATermClose', 'STermClose' )
+		for next in SENTENCE_BREAKS:
+			target = enter( 'Text', next )
+			if previous == 'CR' and next == 'LF':
+				action = KEEP  # SB3
+			elif previous in ( 'CR', 'ParagraphSeparator' ):
+				action = BREAK  # SB4
+			elif next in ( 'Extend', 'Format' ):
+				action, target = SENTENCE_KEEP_IGNORED, state[ previous ]  # SB5
+			elif not terminated:
+				action, target = KEEP, enter( previous, next )  # SB998
+			elif previous in ( 'ATerm', 'LetterATerm' ) and next == 'Numeric':
+				action = KEEP  # SB6
+			elif previous == 'LetterATerm' and next == 'Upper':
+				action = KEEP  # SB7
+			elif a_term and next == 'Lower':
+				action = KEEP  # SB8
+			else:
+				if next in ( 'SContinue', 'ATerm', 'STerm' ):
+					action = KEEP  # SB8a
+				elif closing and next == 'Close':
+					action, target = KEEP, state[ 'ATermClose' if a_term else 'STermClose' ]  # SB9
+				elif next == 'Sp':
+					action, target = KEEP, state[ 'ATermSpace' if a_term else 'STermSpace' ]  # SB9, SB10
+				elif next in ( 'Sep', 'CR', 'LF' ):
+					action = KEEP  # SB9, SB10
+				else:
+					action = BREAK  # SB11
+				if a_term and next not in ( 'OLetter', 'Upper', 'Lower', 'Sep', 'CR', 'LF', 'ATerm', 'STerm' ):
+					# SB8 looks for a Lower behind code points which cannot start a sentence
+					action = SENTENCE_KEEP_IF_LOWER_ELSE_KEEP if action == KEEP else SENTENCE_KEEP_IF_LOWER_ELSE_BREAK
+			assert target < ( 1 << SENTENCE_STATE_BITS )
+			transitions.append( ( action << SENTENCE_STATE_BITS ) | target )
+	return transitions
+
+
+def generate_segmentation_tables( out, ucd ):
+	grapheme_breaks = load_ucd_property( os.path.join( ucd, 'GraphemeBreakProperty.txt' ) )
+	pictographic = set( code_point for code_point, value in load_ucd_property( os.path.join( ucd, 'emoji-data.txt' ) ).items()
+		if value == 'Extended_Pictographic' )
+	word_breaks = load_ucd_property( os.path.join( ucd, 'WordBreakProperty.txt' ) )
+	sentence_breaks = load_ucd_property( os.path.join( ucd, 'SentenceBreakProperty.txt' ) )
+	grapheme_index = dict( ( name, i ) for i, name in enumerate( GRAPHEME_BREAKS ) )
+	word_index = dict( ( name, i ) for i, name in enumerate( WORD_BREAKS ) )
+	sentence_index = dict( ( name, i ) for i, name in enumerate( SENTENCE_BREAKS ) )
+
+	# Record 0 holds the properties of unassigned code points
+	records = { ( 0, 0, 0 ): 0 }
+	record_list = [ ( 0, 0, 0 ) ]
+	values = []
+	limit = 0
+	for code_point in range( MAX_CODE_POINT ):
+		grapheme = grapheme_index[ grapheme_breaks.get( code_point, 'Other' ) ]
+		if code_point in pictographic:
+			# GB11 relies on the pictographs being Other
+			assert grapheme == grapheme_index[ 'Other' ]
+			grapheme |= EXTENDED_PICTOGRAPHIC_FLAG
+		record = ( grapheme, word_index[ word_breaks.get( code_point, 'Other' ) ], sentence_index[ sentence_breaks.get( code_point, 'Other' ) ] )
+		if record not in records:
+			records[ record ] = len( record_list )
+			record_list.append( record )
+		values.append( records[ record ] )
+		if records[ record ] != 0:
+			limit = code_point + 1
+
+	# Code points below this one are Other, Control, CR or LF, so every one of them but a CR in front of a LF is its own cluster
+	simple_limit = next( code_point for code_point in range( MAX_CODE_POINT )
+		if GRAPHEME_BREAKS[ record_list[ values[ code_point ] ][ 0 ] & 0x7F ] not in ( 'Other', 'Control', 'CR', 'LF' ) )
+
+	table = TwoStageTable( values, limit )
+	rules = grapheme_break_rules()
+	word_rules = word_break_rules()
+	sentence_transitions = sentence_break_transitions()
+	out.append( '\t\t\t/**' )
+	out.append( '\t\t\t\\brief The first code point which may extend or be extended by its neighbor in a grapheme cluster,' )
+	out.append( '\t\t\tand its utf-8 lead byte. Every code point below it except CR is a grapheme cluster of its own.' )
+	out.append( '\t\t\t*/' )
+	out.append( '\t\t\tstatic const u32 GraphemeSimpleLimit = 0x%XU;' % simple_limit )
+	out.append( '\t\t\tstatic const unsigned char GraphemeSimpleLeadByte = 0x%X;' % utf8_lead_byte( simple_limit ) )
+	out.append( '' )
+	emit_table_struct( out, 'SegmentationTables',
+		'Segmentation properties of every code point, the stages map a code point to an index into the property arrays.',
+		[ ( 'Segmentation', table ) ],
+		[ ( 'unsigned char', 'GraphemeProperties', [ record[ 0 ] for record in record_list ] ),
+			( 'unsigned char', 'GraphemeRules', rules ),
+			( 'unsigned char', 'WordProperties', [ record[ 1 ] for record in record_list ] ),
+			( 'unsigned char', 'WordRules', word_rules ),
+			( 'unsigned char', 'SentenceProperties', [ record[ 2 ] for record in record_list ] ),
+			( 'unsigned char', 'SentenceTransitions', sentence_transitions ) ] )
+	return table.bytes + len( record_list ) * 3 + len( rules ) + len( word_rules ) + len( sentence_transitions )
+
+
+def main():
+	arguments = sys.argv[ 1: ]
+	ucd = os.path.join( os.path.dirname( os.path.abspath( __file__ ) ), 'ucd' )
+	if len( arguments ) >= 2 and arguments[ 0 ] == '--ucd':
+		ucd = arguments[ 1 ]
+		arguments = arguments[ 2: ]
+	if not os.path.isfile( os.path.join( ucd, 'GraphemeBreakProperty.txt' ) ):
+		sys.exit( 'The Unicode Character Database %s text files are missing in %s' % ( unicodedata.unidata_version, ucd ) )
+	target = arguments[ 0 ] if arguments else os.path.join( os.path.dirname( os.path.abspath( __file__ ) ), '..', 'uti', 'utiUnicodeTables.inl' )
+	out = []
+	out.append( '// Generated by tools/GenerateUnicodeTables.py from the Unicode Character Database %s, do not edit.' % unicodedata.unidata_version )
+	out.append( '#pragma once' )
+	out.append( '#ifndef utiUnicodeTables_inl__' )
+	out.append( '#define utiUnicodeTables_inl__' )
+	out.append( '' )
+	out.append( 'namespace uti' )
+	out.append( '{' )
+	out.append( '\tnamespace unicode' )
+	out.append( '\t{' )
+	tables = []
+	sizes = []
+	sizes.append( ( 'case mapping', generate_case_tables( tables ) ) )
+	max_length, max_per_byte, normalization_size = generate_normalization_tables( tables )
+	sizes.append( ( 'normalization', normalization_size ) )
+	sizes.append( ( 'segmentation', generate_segmentation_tables( tables, ucd ) ) )
+	out.append( '\t\tstatic const u32 CaseDeltaBias = 0x%XU;' % CASE_DELTA_BIAS )
+	out.append( '\t\tstatic const u32 CaseExpansionFlag = 0x%XU;' % CASE_EXPANSION_FLAG )
+	for name, value in NORMALIZATION_FLAGS:
+		out.append( '\t\tstatic const u32 Normalization%s = 0x%XU;' % ( name, value ) )
+	out.append( '\t\tstatic const u32 GeneratedDecompositionLength = %dU;' % max_length )
+	out.append( '\t\tstatic const u32 GeneratedDecompositionPerUtf8Byte = %dU;' % max_per_byte )
+	out.append( '\t\tstatic const u32 GeneratedGraphemeBreakCount = %dU;' % len( GRAPHEME_BREAKS ) )
+	out.append( '\t\tstatic const u32 ExtendedPictographicFlag = 0x%XU;' % EXTENDED_PICTOGRAPHIC_FLAG )
+	out.append( '\t\tstatic const u32 GeneratedWordBreakCount = %dU;' % len( WORD_BREAKS ) )
+	out.append( '\t\tstatic const u32 GeneratedSentenceBreakCount = %dU;' % len( SENTENCE_BREAKS ) )
+	out.append( '\t\tstatic const u32 GeneratedSentenceStateCount = %dU;' % len( SENTENCE_STATES ) )
+	out.append( '\t\tstatic const u32 SentenceStateBits = %dU;' % SENTENCE_STATE_BITS )
+	out.append( '' )
+	out.append( '\t\tnamespace detail' )
+	out.append( '\t\t{' )
+	out.extend( tables )
+	out.append( '\t\t}' )
+	out.append( '\t}' )
+	out.append( '}' )
+	out.append( '' )
+	out.append( '#endif // utiUnicodeTables_inl__' )
+	with open( target, 'w', newline = '\r\n' ) as f:
+		f.write( '\n'.join( out ) + '\n' )
+	for name, size in sizes:
+		print( '%s: %d bytes' % ( name, size ) )
+
+
+if __name__ == '__main__':
+	main()
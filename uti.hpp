@@ -11,23 +11,59 @@
 #endif // DISABLE_CPP11
 
 #include "uti/utiCommonHeader.hpp"
+#include "uti/utiSimd.hpp"
+#include "uti/utiParallel.hpp"
+#include "uti/utiHash.hpp"
+#include "uti/utiUnicode.hpp"
 #include "uti/utiAllocator.hpp"
 #include "uti/utiRefCountPolicy.hpp"
 #include "uti/utiReferenceCounted.hpp"
 #include "uti/utiByteIterator.hpp"
 #include "uti/utiCharIterator.hpp"
 #include "uti/utiReverseIterator.hpp"
+#include "uti/utiCursor.hpp"
+#include "uti/utiSegmentation.hpp"
+#include "uti/utiSplit.hpp"
+#include "uti/utiCsvReader.hpp"
+#include "uti/utiUTF8Stream.hpp"
 #include "uti/utiUTF8String.hpp"
 #include "uti/utiUTF16String.hpp"
+#include "uti/utiMappedFile.hpp"
+#include "uti/utiTranscode.hpp"
+#include "uti/utiBatch.hpp"
+#include "uti/utiCrossEncoding.hpp"
+#include "uti/utiInternPool.hpp"
+#include "uti/utiEpoch.hpp"
+#include "uti/utiConcurrentInternPool.hpp"
+#include "uti/utiStringMap.hpp"
+#include "uti/utiSort.hpp"
 #include "uti/utiChar.h"
 
+#include "uti/utiSimd.inl"
+#include "uti/utiHash.inl"
+#include "uti/utiUnicodeTables.inl"
+#include "uti/utiUnicode.inl"
 #include "uti/utiAllocator.inl"
 #include "uti/utiReferenceCounted.inl"
 #include "uti/utiByteIterator.inl"
 #include "uti/utiCharIterator.inl"
 #include "uti/utiReverseIterator.inl"
+#include "uti/utiCursor.inl"
+#include "uti/utiSegmentation.inl"
+#include "uti/utiSplit.inl"
+#include "uti/utiCsvReader.inl"
+#include "uti/utiUTF8Stream.inl"
 #include "uti/utiUTF8String.inl"
 #include "uti/utiUTF16String.inl"
+#include "uti/utiMappedFile.inl"
+#include "uti/utiTranscode.inl"
+#include "uti/utiBatch.inl"
+#include "uti/utiCrossEncoding.inl"
+#include "uti/utiInternPool.inl"
+#include "uti/utiEpoch.inl"
+#include "uti/utiConcurrentInternPool.inl"
+#include "uti/utiStringMap.inl"
+#include "uti/utiSort.inl"
 #include "uti/utiChar.inl"
 
 
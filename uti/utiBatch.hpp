@@ -0,0 +1,188 @@
+#pragma once
+#ifndef utiBatch_h__
+#define utiBatch_h__
+
+namespace uti
+{
+	/**
+	\brief Runs kernels over arrays of many small utf-8 slices on a pool of threads, writing their outputs into a shared arena.
+
+	Starting a thread or allocating a buffer per string costs more than processing a small string, so the slices are
+	grouped into tasks of about the same number of bytes, each thread owning a queue of neighbouring tasks.
+	A thread which finished its own queue steals tasks from the end of the other queues, so a thread stuck with large
+	slices does not hold up the rest. The calling thread runs the first queue itself.
+
+	Kernels with an output calculate the output size of a whole task first, reserve it from the arena at once and write every output of the task there.
+	The outputs stay valid until Clear() is called or the batch is destroyed.
+
+	A batch can only run one kernel at a time, it must not be shared between threads calling it.
+
+	\tparam StringType The utf-8 string type whose data the slices view.
+	\tparam Allocator Is the class used to allocate the queues, tasks and the arena.
+	*/
+	template< typename StringType, typename Allocator = typename StringType::AllocatorType >
+	class Batch
+	{
+	public:
+
+		typedef typename StringType::Type DataType;
+		typedef ByteSpan< StringType > Slice;
+		typedef Batch< StringType, Allocator > ThisType;
+
+		/**
+		\brief Starts the pool with \c threadCount threads including the calling thread, 0 uses one thread per hardware thread.
+		*/
+		explicit Batch( u32 threadCount = 0U );
+
+		/**
+		\brief Stops the pool and frees the arena.
+		*/
+		~Batch();
+
+		/**
+		\brief Calls \c function( begin, end ) for consecutive ranges of the \c count slices at \c slices until every slice is processed.
+
+		The ranges are processed concurrently, the call returns when every range is done.
+		*/
+		template< typename Function >
+		void Run( const Slice* slices, u32 count, const Function& function );
+
+		/**
+		\brief Stores the valid prefix ( see UTF8String::ValidPrefix() ) of every slice in \c validSizes
+		and, if \c charCounts is not \c nullptr, the number of chars in it in \c charCounts.
+
+		\return \c true if every slice is valid.
+		*/
+		bool Validate( const Slice* slices, u32 count, u32* validSizes, u32* charCounts = nullptr );
+
+		/**
+		\brief Stores the HashBytes() of every slice in \c hashes, which is the Hash() of a string with the same content for the default seed.
+		*/
+		void Hash( const Slice* slices, u32 count, u64* hashes, u64 seed = DefaultHashSeed );
+
+		/**
+		\brief Maps the case of every slice into the arena ( see UTF8String::ToUpper() ) and stores a slice over each result in \c results.
+
+		The slices have to be valid utf-8, see Validate().
+		*/
+		void MapCase( const Slice* slices, u32 count, unicode::CaseMapping mapping, Slice* results );
+
+		/**
+		\brief Case folds every slice into the arena, see MapCase().
+		*/
+		void CaseFold( const Slice* slices, u32 count, Slice* results );
+
+		/**
+		\brief Converts every slice to utf-16 in the byte order of \c StringType16 into the arena ( see ToUTF16() )
+		and stores a span over each result in \c results.
+
+		The slices have to be valid utf-8, see Validate().
+		*/
+		template< typename StringType16 >
+		void Transcode( const Slice* slices, u32 count, ByteSpan< StringType16 >* results );
+
+		/**
+		\brief Frees the arena, every output written so far becomes invalid.
+		*/
+		void Clear( void );
+
+		/**
+		\brief Returns the number of threads processing a batch, including the calling thread.
+		*/
+		u32 ThreadCount( void ) const;
+
+		/**
+		\brief Returns the number of bytes reserved in the arena since the last Clear().
+		*/
+		u64 ArenaSize( void ) const;
+
+		/**
+		\brief The maximum number of bytes grouped into one task, smaller batches are split into at least four tasks per thread.
+		*/
+		static const u32 TaskSize = 1U << 16U;
+
+		/**
+		\brief The bytes each slice counts with on top of its size when grouping tasks, which accounts for the work per slice.
+		*/
+		static const u32 SliceCost = 32U;
+
+		/**
+		\brief The size of the blocks the arena allocates, larger reservations get a block of their own.
+		*/
+		static const u32 ArenaBlockSize = 1U << 20U;
+
+	protected:
+	private:
+
+		struct Task
+		{
+			u32 Begin;
+			u32 End;
+		};
+
+		/**
+		\brief The tasks from Head up to but not including Tail, the owner takes them from the head, other threads steal from the tail.
+		*/
+		struct Queue
+		{
+			std::mutex Mutex;
+			u32 Head;
+			u32 Tail;
+		};
+
+		struct Block
+		{
+			Block* pNext;
+			u32 Size;
+			u32 Used;
+		};
+
+		typedef void ( *JobFunction )( const void* function, u32 begin, u32 end );
+
+		Batch( const ThisType& );
+		ThisType& operator =( const ThisType& );
+
+		template< typename Function >
+		static void CallJob( const void* function, u32 begin, u32 end );
+
+		/**
+		\brief Waits for the batches and runs their tasks on the worker thread with the given queue index.
+		*/
+		void WorkerLoop( u32 index );
+
+		/**
+		\brief Runs tasks until no queue holds any task anymore, starting with the queue with the given index.
+		*/
+		void RunTasks( u32 index );
+
+		bool NextTask( u32 index, Task& task );
+
+		/**
+		\brief Reserves \c size bytes aligned to 8 bytes in the arena.
+		*/
+		void* Reserve( u32 size );
+
+		Allocator m_Alloc;
+		std::thread* m_pThreads;
+		Queue* m_pQueues;
+		u32 m_uiThreadCount;
+
+		Task* m_pTasks;
+		u32 m_uiTaskCapacity;
+		JobFunction m_pJob;
+		const void* m_pJobFunction;
+
+		std::mutex m_Mutex;
+		std::condition_variable m_Wake;
+		std::condition_variable m_Done;
+		u32 m_uiGeneration;
+		u32 m_uiBusy;
+		bool m_bStop;
+
+		std::mutex m_ArenaMutex;
+		Block* m_pBlocks;
+		u64 m_uiArenaSize;
+	};
+}
+
+#endif // utiBatch_h__
@@ -0,0 +1,385 @@
+#pragma once
+#ifndef utiBatch_inl__
+#define utiBatch_inl__
+
+namespace uti
+{
+	//////////////////////////////////////////////////////////////////////////
+	// Batch implementation
+	//////////////////////////////////////////////////////////////////////////
+
+	template< typename StringType, typename Allocator >
+	Batch< StringType, Allocator >::Batch( u32 threadCount /*= 0U */ ) :
+		m_pThreads( nullptr ),
+		m_pTasks( nullptr ),
+		m_uiTaskCapacity( 0U ),
+		m_pJob( nullptr ),
+		m_pJobFunction( nullptr ),
+		m_uiGeneration( 0U ),
+		m_uiBusy( 0U ),
+		m_bStop( false ),
+		m_pBlocks( nullptr ),
+		m_uiArenaSize( 0U )
+	{
+		if( threadCount == 0U )
+		{
+			threadCount = std::thread::hardware_concurrency();
+		}
+		m_uiThreadCount = threadCount > 0U ? threadCount : 1U;
+
+		m_pQueues = static_cast< Queue* >( m_Alloc.AllocateBytes( m_uiThreadCount * sizeof( Queue ) ) );
+		for( u32 i = 0U; i < m_uiThreadCount; ++i )
+		{
+			Queue* queue = new( m_pQueues + i ) Queue();
+			queue->Head = 0U;
+			queue->Tail = 0U;
+		}
+
+		// The calling thread works on the first queue, every other queue gets a thread of its own
+		if( m_uiThreadCount > 1U )
+		{
+			m_pThreads = static_cast< std::thread* >( m_Alloc.AllocateBytes( ( m_uiThreadCount - 1U ) * sizeof( std::thread ) ) );
+			for( u32 i = 1U; i < m_uiThreadCount; ++i )
+			{
+				new( m_pThreads + i - 1U ) std::thread( &ThisType::WorkerLoop, this, i );
+			}
+		}
+	}
+
+	template< typename StringType, typename Allocator >
+	Batch< StringType, Allocator >::~Batch()
+	{
+		{
+			std::lock_guard< std::mutex > lock( m_Mutex );
+			m_bStop = true;
+		}
+		m_Wake.notify_all();
+		for( u32 i = 1U; i < m_uiThreadCount; ++i )
+		{
+			m_pThreads[ i - 1U ].join();
+			m_pThreads[ i - 1U ].~thread();
+		}
+		if( m_pThreads != nullptr )
+		{
+			m_Alloc.FreeBytes( m_pThreads );
+			m_pThreads = nullptr;
+		}
+
+		for( u32 i = 0U; i < m_uiThreadCount; ++i )
+		{
+			m_pQueues[ i ].~Queue();
+		}
+		m_Alloc.FreeBytes( m_pQueues );
+		m_pQueues = nullptr;
+		if( m_pTasks != nullptr )
+		{
+			m_Alloc.FreeBytes( m_pTasks );
+			m_pTasks = nullptr;
+		}
+		Clear();
+	}
+
+	template< typename StringType, typename Allocator >
+	template< typename Function >
+	void Batch< StringType, Allocator >::Run( const Slice* slices, u32 count, const Function& function )
+	{
+		if( count == 0U )
+		{
+			return;
+		}
+
+		// Small batches are still split into a few tasks per thread, so there is something left to steal
+		u64 totalCost = 0U;
+		for( u32 i = 0U; i < count; ++i )
+		{
+			totalCost += slices[ i ].Size() + SliceCost;
+		}
+		u64 taskCost = totalCost / ( m_uiThreadCount * 4U );
+		taskCost = taskCost < TaskSize ? taskCost : TaskSize;
+		taskCost = taskCost > SliceCost ? taskCost : SliceCost;
+
+		if( m_uiTaskCapacity < count )
+		{
+			if( m_pTasks != nullptr )
+			{
+				m_Alloc.FreeBytes( m_pTasks );
+			}
+			m_pTasks = static_cast< Task* >( m_Alloc.AllocateBytes( count * sizeof( Task ) ) );
+			m_uiTaskCapacity = count;
+		}
+		u32 taskCount = 0U;
+		u64 cost = 0U;
+		u32 begin = 0U;
+		for( u32 i = 0U; i < count; ++i )
+		{
+			cost += slices[ i ].Size() + SliceCost;
+			if( cost >= taskCost || i + 1U == count )
+			{
+				m_pTasks[ taskCount ].Begin = begin;
+				m_pTasks[ taskCount ].End = i + 1U;
+				++taskCount;
+				begin = i + 1U;
+				cost = 0U;
+			}
+		}
+
+		// Every queue starts with a consecutive range of tasks, so each thread walks through neighbouring slices
+		for( u32 i = 0U; i < m_uiThreadCount; ++i )
+		{
+			m_pQueues[ i ].Head = static_cast< u32 >( static_cast< u64 >( taskCount ) * i / m_uiThreadCount );
+			m_pQueues[ i ].Tail = static_cast< u32 >( static_cast< u64 >( taskCount ) * ( i + 1U ) / m_uiThreadCount );
+		}
+		m_pJob = &ThisType::template CallJob< Function >;
+		m_pJobFunction = &function;
+
+		if( m_uiThreadCount == 1U || taskCount == 1U )
+		{
+			// Not worth waking the pool
+			for( u32 i = 0U; i < m_uiThreadCount; ++i )
+			{
+				m_pQueues[ i ].Head = 0U;
+				m_pQueues[ i ].Tail = i == 0U ? taskCount : 0U;
+			}
+			RunTasks( 0U );
+			return;
+		}
+
+		{
+			std::lock_guard< std::mutex > lock( m_Mutex );
+			m_uiBusy = m_uiThreadCount - 1U;
+			++m_uiGeneration;
+		}
+		m_Wake.notify_all();
+		RunTasks( 0U );
+		std::unique_lock< std::mutex > lock( m_Mutex );
+		while( m_uiBusy != 0U )
+		{
+			m_Done.wait( lock );
+		}
+	}
+
+	template< typename StringType, typename Allocator >
+	bool Batch< StringType, Allocator >::Validate( const Slice* slices, u32 count, u32* validSizes, u32* charCounts /*= nullptr */ )
+	{
+		std::atomic< u32 > invalid( 0U );
+		Run( slices, count, [ & ]( u32 begin, u32 end )
+		{
+			u32 invalidSlices = 0U;
+			for( u32 i = begin; i < end; ++i )
+			{
+				const DataType* data = slices[ i ].begin();
+				u32 valid = StringType::ValidPrefix( data, slices[ i ].Size() );
+				validSizes[ i ] = valid;
+				if( charCounts != nullptr )
+				{
+					charCounts[ i ] = StringType::CountChars( data, valid );
+				}
+				invalidSlices += valid != slices[ i ].Size() ? 1U : 0U;
+			}
+			if( invalidSlices != 0U )
+			{
+				invalid += invalidSlices;
+			}
+		} );
+		return invalid.load() == 0U;
+	}
+
+	template< typename StringType, typename Allocator >
+	void Batch< StringType, Allocator >::Hash( const Slice* slices, u32 count, u64* hashes, u64 seed /*= DefaultHashSeed */ )
+	{
+		Run( slices, count, [ & ]( u32 begin, u32 end )
+		{
+			for( u32 i = begin; i < end; ++i )
+			{
+				hashes[ i ] = HashBytes( slices[ i ].begin(), slices[ i ].Size() * sizeof( DataType ), seed );
+			}
+		} );
+	}
+
+	template< typename StringType, typename Allocator >
+	void Batch< StringType, Allocator >::MapCase( const Slice* slices, u32 count, unicode::CaseMapping mapping, Slice* results )
+	{
+		Run( slices, count, [ & ]( u32 begin, u32 end )
+		{
+			u32 resultSize = 0U;
+			u32 resultChars = 0U;
+			bool resultAscii = true;
+			bool behindSource = true;
+			u32 taskSize = 0U;
+			for( u32 i = begin; i < end; ++i )
+			{
+				StringType::MapCaseInto( slices[ i ].begin(), slices[ i ].Size(), mapping, nullptr, resultSize, resultChars, resultAscii, behindSource );
+				taskSize += resultSize;
+			}
+
+			DataType* dst = static_cast< DataType* >( Reserve( taskSize * sizeof( DataType ) ) );
+			for( u32 i = begin; i < end; ++i )
+			{
+				StringType::MapCaseInto( slices[ i ].begin(), slices[ i ].Size(), mapping, dst, resultSize, resultChars, resultAscii, behindSource );
+				results[ i ] = Slice( dst, dst + resultSize, resultAscii );
+				dst += resultSize;
+			}
+		} );
+	}
+
+	template< typename StringType, typename Allocator >
+	void Batch< StringType, Allocator >::CaseFold( const Slice* slices, u32 count, Slice* results )
+	{
+		MapCase( slices, count, unicode::CaseMapping::Fold, results );
+	}
+
+	template< typename StringType, typename Allocator >
+	template< typename StringType16 >
+	void Batch< StringType, Allocator >::Transcode( const Slice* slices, u32 count, ByteSpan< StringType16 >* results )
+	{
+		typedef typename StringType16::Type ch16;
+		Run( slices, count, [ & ]( u32 begin, u32 end )
+		{
+			u32 taskSize = 0U;
+			for( u32 i = begin; i < end; ++i )
+			{
+				taskSize += slices[ i ].IsAscii() ? slices[ i ].Size() : transcode::UTF16Size( slices[ i ].begin(), slices[ i ].Size() );
+			}
+
+			ch16* dst = static_cast< ch16* >( Reserve( taskSize * sizeof( ch16 ) ) );
+			for( u32 i = begin; i < end; ++i )
+			{
+				u32 written = transcode::WriteUTF16< StringType16::Order >( slices[ i ].begin(), slices[ i ].Size(), dst );
+				results[ i ] = ByteSpan< StringType16 >( dst, dst + written, slices[ i ].IsAscii() );
+				dst += written;
+			}
+		} );
+	}
+
+	template< typename StringType, typename Allocator >
+	void Batch< StringType, Allocator >::Clear( void )
+	{
+		std::lock_guard< std::mutex > lock( m_ArenaMutex );
+		while( m_pBlocks != nullptr )
+		{
+			Block* next = m_pBlocks->pNext;
+			m_Alloc.FreeBytes( m_pBlocks );
+			m_pBlocks = next;
+		}
+		m_uiArenaSize = 0U;
+	}
+
+	template< typename StringType, typename Allocator >
+	u32 Batch< StringType, Allocator >::ThreadCount( void ) const
+	{
+		return m_uiThreadCount;
+	}
+
+	template< typename StringType, typename Allocator >
+	u64 Batch< StringType, Allocator >::ArenaSize( void ) const
+	{
+		return m_uiArenaSize;
+	}
+
+	template< typename StringType, typename Allocator >
+	template< typename Function >
+	void Batch< StringType, Allocator >::CallJob( const void* function, u32 begin, u32 end )
+	{
+		( *static_cast< const Function* >( function ) )( begin, end );
+	}
+
+	template< typename StringType, typename Allocator >
+	void Batch< StringType, Allocator >::WorkerLoop( u32 index )
+	{
+		u32 generation = 0U;
+		for( ;; )
+		{
+			{
+				std::unique_lock< std::mutex > lock( m_Mutex );
+				while( !m_bStop && m_uiGeneration == generation )
+				{
+					m_Wake.wait( lock );
+				}
+				if( m_bStop )
+				{
+					return;
+				}
+				generation = m_uiGeneration;
+			}
+
+			RunTasks( index );
+
+			std::lock_guard< std::mutex > lock( m_Mutex );
+			if( --m_uiBusy == 0U )
+			{
+				m_Done.notify_one();
+			}
+		}
+	}
+
+	template< typename StringType, typename Allocator >
+	void Batch< StringType, Allocator >::RunTasks( u32 index )
+	{
+		Task task;
+		while( NextTask( index, task ) )
+		{
+			m_pJob( m_pJobFunction, task.Begin, task.End );
+		}
+	}
+
+	template< typename StringType, typename Allocator >
+	bool Batch< StringType, Allocator >::NextTask( u32 index, Task& task )
+	{
+		{
+			Queue& own = m_pQueues[ index ];
+			std::lock_guard< std::mutex > lock( own.Mutex );
+			if( own.Head < own.Tail )
+			{
+				task = m_pTasks[ own.Head++ ];
+				return true;
+			}
+		}
+
+		// Steal from the end of the other queues, which is the work their owners would reach last
+		for( u32 i = 1U; i < m_uiThreadCount; ++i )
+		{
+			Queue& victim = m_pQueues[ ( index + i ) % m_uiThreadCount ];
+			std::lock_guard< std::mutex > lock( victim.Mutex );
+			if( victim.Head < victim.Tail )
+			{
+				task = m_pTasks[ --victim.Tail ];
+				return true;
+			}
+		}
+		return false;
+	}
+
+	template< typename StringType, typename Allocator >
+	void* Batch< StringType, Allocator >::Reserve( u32 size )
+	{
+		size = ( size + 7U ) & ~7U;
+		std::lock_guard< std::mutex > lock( m_ArenaMutex );
+		m_uiArenaSize += size;
+		Block* block = m_pBlocks;
+		if( block == nullptr || block->Size - block->Used < size )
+		{
+			// The header is padded to 16 bytes, so every reservation is aligned
+			const u32 headerSize = ( sizeof( Block ) + 15U ) & ~15U;
+			const u32 blockSize = size > ArenaBlockSize ? size : ArenaBlockSize;
+			block = static_cast< Block* >( m_Alloc.AllocateBytes( headerSize + blockSize ) );
+			block->Size = headerSize + blockSize;
+			block->Used = headerSize;
+			if( m_pBlocks != nullptr && size > ArenaBlockSize )
+			{
+				// A block of its own is full right away, the current block keeps its free space
+				block->pNext = m_pBlocks->pNext;
+				m_pBlocks->pNext = block;
+			}
+			else
+			{
+				block->pNext = m_pBlocks;
+				m_pBlocks = block;
+			}
+		}
+		void* result = reinterpret_cast< char* >( block ) + block->Used;
+		block->Used += size;
+		return result;
+	}
+}
+
+#endif // utiBatch_inl__
@@ -8,6 +8,8 @@ namespace uti
 	\brief Generic Iterator which iterates over a generic String defined in this header file.
 	Each iteration step increases in the atomic size of the underlying String ( e.g. 1 Byte in UTF-8 and 2 bytes in UTF-16 )
 
+	The iterator is a random access iterator over contiguous memory, so it can be used with the algorithms of the standard library.
+
 	\tparam StringType The underlying String class type, over which the iterator is going to iterate.
 
 	*/
@@ -16,11 +18,26 @@ namespace uti
 	{
 	public:
 
-		typedef typename StringType String;
+		typedef StringType String;
 
 		typedef typename StringType::Type DataType;
 		typedef typename StringType::AllocatorType Allocator;
 
+		typedef std::random_access_iterator_tag iterator_category;
+#ifdef __cpp_lib_concepts
+		typedef std::contiguous_iterator_tag iterator_concept;
+		typedef DataType element_type;
+#endif // __cpp_lib_concepts
+		typedef DataType value_type;
+		typedef std::ptrdiff_t difference_type;
+		typedef DataType* pointer;
+		typedef DataType& reference;
+
+		/**
+		\brief Creates an iterator which is not placed on any string and must not be used before an iterator is assigned to it.
+		*/
+		UTFByteIterator( void );
+
 		/**
 		\brief Creates a new iterator for the UTF-String
 
@@ -33,7 +50,9 @@ namespace uti
 
 		UTFByteIterator& operator =( const UTFByteIterator< String >& it );
 
-		DataType& operator *( void );
+		reference operator *( void ) const;
+		pointer operator ->( void ) const;
+		reference operator []( difference_type offset ) const;
 
 		bool Valid( void ) const;
 
@@ -51,15 +70,29 @@ namespace uti
 		UTFByteIterator< String >& operator --( void );
 		UTFByteIterator< String > operator --( int );
 
+		UTFByteIterator< String >& operator +=( difference_type offset );
+		UTFByteIterator< String >& operator -=( difference_type offset );
+
+		UTFByteIterator< String > operator +( difference_type offset ) const;
+		UTFByteIterator< String > operator -( difference_type offset ) const;
+
+		/**
+		\brief Returns the distance (in units) between this and the given iterator of the same string.
+		*/
+		difference_type operator -( const UTFByteIterator< String >& rhs ) const;
+
 		~UTFByteIterator();
 
 
 	protected:
 	private:
 
-		String& m_String;
+		String* m_pString;
 		u32 m_uiPos;
 	};
+
+	template< typename StringType >
+	UTFByteIterator< StringType > operator +( typename UTFByteIterator< StringType >::difference_type offset, const UTFByteIterator< StringType >& it );
 }
 
 #endif // utiByteIterator_h__
@@ -56,15 +56,16 @@ namespace uti
 	template< typename String >
 	UTFByteIterator< String >& UTFByteIterator< String >::operator=( const UTFByteIterator< String >& it )
 	{
-		m_String = it.m_String;
+		m_pString = it.m_pString;
 		m_uiPos = it.m_uiPos;
+		return *this;
 	}
 
 	template< typename String >
 	UTFByteIterator< String > UTFByteIterator< String >::operator++( int )
 	{
 #if _ITERATOR_DEBUG_LEVEL == 2
-		if( m_uiPos < m_String.m_uiSize )
+		if( m_uiPos < m_pString->m_uiSize )
 		{
 			UTFByteIterator it( *this );
 			++*this;
@@ -87,7 +88,7 @@ namespace uti
 	UTFByteIterator< String >& UTFByteIterator< String >::operator++( void )
 	{
 #if _ITERATOR_DEBUG_LEVEL == 2
-		if( m_uiPos < m_String.m_uiSize )
+		if( m_uiPos < m_pString->m_uiSize )
 		{
 			++m_uiPos;
 			return *this;
@@ -109,7 +110,7 @@ namespace uti
 	{
 
 #if _ITERATOR_DEBUG_LEVEL == 2
-		if( m_String.m_pData != rhs.m_String.m_pData )
+		if( m_pString->m_pData != rhs.m_pString->m_pData )
 		{
 			UTI_FATAL( "UTFIterator mismatch on > comparison" );
 			return false;
@@ -128,7 +129,7 @@ namespace uti
 	bool UTFByteIterator< String >::operator>=( const UTFByteIterator< String >& rhs ) const
 	{
 #if _ITERATOR_DEBUG_LEVEL == 2
-		if( m_String.m_pData != rhs.m_String.m_pData )
+		if( m_pString->m_pData != rhs.m_pString->m_pData )
 		{
 			UTI_FATAL( "UTFIterator mismatch on >= comparison" );
 			return false;
@@ -146,7 +147,7 @@ namespace uti
 	bool UTFByteIterator< String >::operator<( const UTFByteIterator< String >& rhs ) const
 	{
 #if _ITERATOR_DEBUG_LEVEL == 2
-		if( m_String.m_pData != rhs.m_String.m_pData )
+		if( m_pString->m_pData != rhs.m_pString->m_pData )
 		{
 			UTI_FATAL( "UTFIterator mismatch on < comparison" );
 			return false;
@@ -164,7 +165,7 @@ namespace uti
 	bool UTFByteIterator< String >::operator<=( const UTFByteIterator< String >& rhs ) const
 	{
 #if _ITERATOR_DEBUG_LEVEL == 2
-		if( m_String.m_pData != rhs.m_String.m_pData )
+		if( m_pString->m_pData != rhs.m_pString->m_pData )
 		{
 			UTI_FATAL( "UTFIterator mismatch on <= comparison" );
 			return false;
@@ -182,7 +183,7 @@ namespace uti
 	bool UTFByteIterator< String >::operator!=( const UTFByteIterator< String >& rhs ) const
 	{
 #if _ITERATOR_DEBUG_LEVEL == 2
-		if( m_String.m_pData != rhs.m_String.m_pData )
+		if( m_pString->m_pData != rhs.m_pString->m_pData )
 		{
 			UTI_FATAL( "UTFIterator mismatch on != comparison" );
 			return false;
@@ -200,7 +201,7 @@ namespace uti
 	bool UTFByteIterator< String >::operator==( const UTFByteIterator< String >& rhs ) const
 	{
 #if _ITERATOR_DEBUG_LEVEL == 2
-		if( m_String.m_pData != rhs.m_String.m_pData )
+		if( m_pString->m_pData != rhs.m_pString->m_pData )
 		{
 			UTI_FATAL( "UTFIterator mismatch on == comparison" );
 			return false;
@@ -215,20 +216,81 @@ namespace uti
 	}
 
 	template< typename String >
-	typename UTFByteIterator< String >::DataType& UTFByteIterator< String >::operator*( )
+	UTFByteIterator< String >& UTFByteIterator< String >::operator+=( difference_type offset )
+	{
+		UTI_ASSERT( static_cast< difference_type >( m_uiPos ) + offset >= 0 &&
+			static_cast< difference_type >( m_uiPos ) + offset <= static_cast< difference_type >( m_pString->m_uiSize ) );
+		m_uiPos = static_cast< u32 >( static_cast< difference_type >( m_uiPos ) + offset );
+		return *this;
+	}
+
+	template< typename String >
+	UTFByteIterator< String >& UTFByteIterator< String >::operator-=( difference_type offset )
+	{
+		return ( *this ) += -offset;
+	}
+
+	template< typename String >
+	UTFByteIterator< String > UTFByteIterator< String >::operator+( difference_type offset ) const
+	{
+		UTFByteIterator< String > it( *this );
+		it += offset;
+		return it;
+	}
+
+	template< typename String >
+	UTFByteIterator< String > UTFByteIterator< String >::operator-( difference_type offset ) const
+	{
+		UTFByteIterator< String > it( *this );
+		it -= offset;
+		return it;
+	}
+
+	template< typename String >
+	typename UTFByteIterator< String >::difference_type UTFByteIterator< String >::operator-( const UTFByteIterator< String >& rhs ) const
+	{
+#if _ITERATOR_DEBUG_LEVEL == 2
+		if( m_pString->m_pData != rhs.m_pString->m_pData )
+		{
+			UTI_FATAL( "UTFIterator mismatch on - operation" );
+		}
+#endif // _ITERATOR_DEBUG_LEVEL == 2
+		return static_cast< difference_type >( m_uiPos ) - static_cast< difference_type >( rhs.m_uiPos );
+	}
+
+	template< typename StringType >
+	UTFByteIterator< StringType > operator+( typename UTFByteIterator< StringType >::difference_type offset, const UTFByteIterator< StringType >& it )
+	{
+		return it + offset;
+	}
+
+	template< typename String >
+	typename UTFByteIterator< String >::reference UTFByteIterator< String >::operator[]( difference_type offset ) const
+	{
+		return *( m_pString->m_pData.Ptr() + m_uiPos + offset );
+	}
+
+	template< typename String >
+	typename UTFByteIterator< String >::pointer UTFByteIterator< String >::operator->( ) const
+	{
+		return m_pString->m_pData.Ptr() + m_uiPos;
+	}
+
+	template< typename String >
+	typename UTFByteIterator< String >::reference UTFByteIterator< String >::operator*( ) const
 	{
 #if _ITERATOR_DEBUG_LEVEL == 2
 		if( Valid() )
 		{
-			return *( m_String.m_pData.Ptr() + m_uiPos );
+			return *( m_pString->m_pData.Ptr() + m_uiPos );
 		}
 		else
 		{
 			UTI_FATAL( "Iterator not dereferenceable" );
-			return *( m_String.m_pData.Ptr() + m_uiPos );
+			return *( m_pString->m_pData.Ptr() + m_uiPos );
 		}
 #else
-		return *( m_String.m_pData.Ptr() + m_uiPos );
+		return *( m_pString->m_pData.Ptr() + m_uiPos );
 #endif
 
 	}
@@ -236,7 +298,7 @@ namespace uti
 	template< typename String >
 	bool UTFByteIterator< String >::Valid( void ) const
 	{
-		return m_uiPos < m_String.m_uiSize;
+		return m_uiPos < m_pString->m_uiSize;
 	}
 
 	template< typename String >
@@ -245,16 +307,23 @@ namespace uti
 		m_uiPos = 0U;
 	}
 
+	template< typename String >
+	UTFByteIterator< String >::UTFByteIterator( void ) :
+		m_pString( nullptr ),
+		m_uiPos( 0U )
+	{
+	}
+
 	template< typename String >
 	UTFByteIterator< String >::UTFByteIterator( typename UTFByteIterator< String >::String& data, u32 uiPos ) :
-		m_String( data ),
+		m_pString( &data ),
 		m_uiPos( uiPos )
 	{
 	}
 
 	template< typename String >
 	UTFByteIterator< String >::UTFByteIterator( const UTFByteIterator< String >& it ) :
-		m_String( it.m_String ),
+		m_pString( it.m_pString ),
 		m_uiPos( it.m_uiPos )
 	{
 
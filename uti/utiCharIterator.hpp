@@ -8,6 +8,9 @@ namespace uti
 	\brief Generic Iterator which iterates over a generic String defined in this header file.
 	Each iteration step increases in the atomic size of the underlying String ( e.g. 1 Byte in UTF-8 and 2 bytes in UTF-16 )
 
+	The iterator is a bidirectional iterator which dereferences to the address of the current char,
+	so it can be used with the algorithms of the standard library.
+
 	\tparam StringType The underlying String class type, over which the iterator is going to iterate.
 
 	*/
@@ -16,11 +19,22 @@ namespace uti
 	{
 	public:
 
-		typedef typename StringType String;
+		typedef StringType String;
 
 		typedef typename StringType::Type DataType;
 		typedef typename StringType::AllocatorType Allocator;
 
+		typedef std::bidirectional_iterator_tag iterator_category;
+		typedef DataType* value_type;
+		typedef std::ptrdiff_t difference_type;
+		typedef DataType** pointer;
+		typedef DataType* reference;
+
+		/**
+		\brief Creates an iterator which is not placed on any string and must not be used before an iterator is assigned to it.
+		*/
+		UTFCharIterator( void );
+
 		/**
 		\brief Creates a new iterator for the UTF-String
 
@@ -72,6 +86,16 @@ namespace uti
 		*/
 		UTFCharIterator& operator -=( s32 offset );
 
+		UTFCharIterator< String > operator +( s32 offset ) const;
+		UTFCharIterator< String > operator -( s32 offset ) const;
+
+		/**
+		@brief Returns the distance (in chars) between this and the given iterator of the same string.
+
+		The chars in between are counted in blocks, unless the string is pure ASCII.
+		*/
+		difference_type operator -( const UTFCharIterator< String >& rhs ) const;
+
 
 		UTFCharIterator< String >& operator --( void );
 		UTFCharIterator< String > operator --( int );
@@ -83,7 +107,7 @@ namespace uti
 	protected:
 	private:
 
-		String& m_String;
+		String* m_pString;
 		u32 m_uiPos;
 	};
 }
@@ -36,12 +36,13 @@ namespace uti
 #if _ITERATOR_DEBUG_LEVEL == 2
 		if( m_uiPos > 0 )
 		{
-			u32 size = 0;
-			while( m_uiPos > 0 && size == 0 )
+			if( m_pString->m_bAscii )
 			{
-				size = String::CharSize( m_String.m_pData.Ptr() + m_uiPos );
 				--m_uiPos;
+				return *this;
 			}
+
+			m_uiPos = String::RetreatChars( m_pString->m_pData.Ptr(), m_uiPos, 1U );
 			return *this;
 		}
 		else
@@ -50,12 +51,14 @@ namespace uti
 		}
 #else
 
-		u32 size = 0;
-		while( m_uiPos > 0 && size == 0 )
+		// Every char of an ASCII string is a single unit
+		if( m_pString->m_bAscii )
 		{
-			size = String::CharSize( m_String.m_pData.Ptr() + m_uiPos );
 			--m_uiPos;
+			return *this;
 		}
+
+		m_uiPos = String::RetreatChars( m_pString->m_pData.Ptr(), m_uiPos, 1U );
 		return *this;
 #endif // _ITERATOR_DEBUG_LEVEL == 2
 
@@ -64,15 +67,16 @@ namespace uti
 	template< typename String >
 	UTFCharIterator< String >& UTFCharIterator< String >::operator=( const UTFCharIterator< String >& it )
 	{
-		m_String = it.m_String;
+		m_pString = it.m_pString;
 		m_uiPos = it.m_uiPos;
+		return *this;
 	}
 
 	template< typename String >
 	UTFCharIterator< String > UTFCharIterator< String >::operator++( int )
 	{
 #if _ITERATOR_DEBUG_LEVEL == 2
-		if( m_uiPos < m_String.m_uiSize )
+		if( m_uiPos < m_pString->m_uiSize )
 		{
 			UTFCharIterator it( *this );
 			++*this;
@@ -94,19 +98,25 @@ namespace uti
 	UTFCharIterator< String >& UTFCharIterator< String >::operator++( void )
 	{
 #if _ITERATOR_DEBUG_LEVEL == 2
-		if( m_uiPos < m_String.m_uiSize )
+		if( m_uiPos < m_pString->m_uiSize )
 		{
-			u32 size = String::CharSize( m_String.m_pData.Ptr() + m_uiPos );
+			if( m_pString->m_bAscii )
+			{
+				++m_uiPos;
+				return *this;
+			}
+
+			u32 size = String::CharSize( m_pString->m_pData.Ptr() + m_uiPos );
 			if( size != 0 )
 			{
 				m_uiPos += size;
 			}
 			else
 			{
-				while( size == 0 && m_uiPos < m_String.m_uiSize )
+				while( size == 0 && m_uiPos < m_pString->m_uiSize )
 				{
 					++m_uiPos;
-					size = String::CharSize( m_String.m_pData.Ptr() + m_uiPos );
+					size = String::CharSize( m_pString->m_pData.Ptr() + m_uiPos );
 				}
 			}
 
@@ -119,7 +129,14 @@ namespace uti
 		}
 #else
 
-		u32 size = String::CharSize( m_String.m_pData.Ptr() + m_uiPos );
+		// Every char of an ASCII string is a single unit
+		if( m_pString->m_bAscii )
+		{
+			++m_uiPos;
+			return *this;
+		}
+
+		u32 size = String::CharSize( m_pString->m_pData.Ptr() + m_uiPos );
 		if( size != 0 )
 		{
 			m_uiPos += size;
@@ -129,8 +146,8 @@ namespace uti
 			do
 			{
 				++m_uiPos;
-				size = String::CharSize( m_String.m_pData.Ptr() + m_uiPos );
-			} while( size == 0 && m_uiPos < m_String.m_uiSize );
+				size = String::CharSize( m_pString->m_pData.Ptr() + m_uiPos );
+			} while( size == 0 && m_uiPos < m_pString->m_uiSize );
 		}
 
 		return *this;
@@ -141,21 +158,33 @@ namespace uti
 	inline
 	UTFCharIterator<StringType>& UTFCharIterator<StringType>::operator+=( s32 offset )
 	{
-		if (offset < 0)
+		if( offset < 0 )
 		{
-			offset = -offset;
-			while( offset > 0 )
+			u32 count = static_cast< u32 >( -offset );
+			if( m_pString->m_bAscii )
 			{
-				--this;
+				UTI_ASSERT( count <= m_uiPos );
+				m_uiPos = count <= m_uiPos ? m_uiPos - count : 0U;
+			}
+			else
+			{
+				m_uiPos = StringType::RetreatChars( m_pString->m_pData.Ptr(), m_uiPos, count );
 			}
 		}
 		else
 		{
-			while( offset > 0 )
+			u32 count = static_cast< u32 >( offset );
+			if( m_pString->m_bAscii )
+			{
+				UTI_ASSERT( m_uiPos + count <= m_pString->m_uiSize );
+				m_uiPos = m_uiPos + count <= m_pString->m_uiSize ? m_uiPos + count : m_pString->m_uiSize;
+			}
+			else
 			{
-				++this;
+				m_uiPos = StringType::AdvanceChars( m_pString->m_pData.Ptr(), m_uiPos, m_pString->m_uiSize, count );
 			}
 		}
+		return *this;
 	}
 
 	template< typename StringType >
@@ -165,6 +194,42 @@ namespace uti
 		return (( *this ) += -offset);
 	}
 
+	template< typename StringType >
+	UTFCharIterator< StringType > UTFCharIterator< StringType >::operator+( s32 offset ) const
+	{
+		UTFCharIterator< StringType > it( *this );
+		it += offset;
+		return it;
+	}
+
+	template< typename StringType >
+	UTFCharIterator< StringType > UTFCharIterator< StringType >::operator-( s32 offset ) const
+	{
+		UTFCharIterator< StringType > it( *this );
+		it -= offset;
+		return it;
+	}
+
+	template< typename StringType >
+	typename UTFCharIterator< StringType >::difference_type UTFCharIterator< StringType >::operator-( const UTFCharIterator< StringType >& rhs ) const
+	{
+#if _ITERATOR_DEBUG_LEVEL == 2
+		if( m_pString->m_pData != rhs.m_pString->m_pData )
+		{
+			UTI_FATAL( "UTFIterator mismatch on - operation" );
+		}
+#endif // _ITERATOR_DEBUG_LEVEL == 2
+		if( m_pString->m_bAscii )
+		{
+			return static_cast< difference_type >( m_uiPos ) - static_cast< difference_type >( rhs.m_uiPos );
+		}
+		if( rhs.m_uiPos <= m_uiPos )
+		{
+			return static_cast< difference_type >( StringType::CountChars( m_pString->m_pData.Ptr() + rhs.m_uiPos, m_uiPos - rhs.m_uiPos ) );
+		}
+		return -static_cast< difference_type >( StringType::CountChars( m_pString->m_pData.Ptr() + m_uiPos, rhs.m_uiPos - m_uiPos ) );
+	}
+
 
 
 	template< typename String >
@@ -172,7 +237,7 @@ namespace uti
 	{
 
 #if _ITERATOR_DEBUG_LEVEL == 2
-		if( m_String.m_pData != rhs.m_String.m_pData )
+		if( m_pString->m_pData != rhs.m_pString->m_pData )
 		{
 			UTI_FATAL( "UTFIterator mismatch on > comparison" );
 		}
@@ -190,7 +255,7 @@ namespace uti
 	bool UTFCharIterator< String >::operator>=( const UTFCharIterator< String >& rhs ) const
 	{
 #if _ITERATOR_DEBUG_LEVEL == 2
-		if( m_String.m_pData != rhs.m_String.m_pData )
+		if( m_pString->m_pData != rhs.m_pString->m_pData )
 		{
 			UTI_FATAL( "UTFIterator mismatch on >= comparison" );
 		}
@@ -207,7 +272,7 @@ namespace uti
 	bool UTFCharIterator< String >::operator<( const UTFCharIterator< String >& rhs ) const
 	{
 #if _ITERATOR_DEBUG_LEVEL == 2
-		if( m_String.m_pData != rhs.m_String.m_pData )
+		if( m_pString->m_pData != rhs.m_pString->m_pData )
 		{
 			UTI_FATAL( "UTFIterator mismatch on < comparison" );
 			return false;
@@ -225,7 +290,7 @@ namespace uti
 	bool UTFCharIterator< String >::operator<=( const UTFCharIterator< String >& rhs ) const
 	{
 #if _ITERATOR_DEBUG_LEVEL == 2
-		if( m_String.m_pData != rhs.m_String.m_pData )
+		if( m_pString->m_pData != rhs.m_pString->m_pData )
 		{
 			UTI_FATAL( "UTFIterator mismatch on <= comparison" );
 			return false;
@@ -243,7 +308,7 @@ namespace uti
 	bool UTFCharIterator< String >::operator!=( const UTFCharIterator< String >& rhs ) const
 	{
 #if _ITERATOR_DEBUG_LEVEL == 2
-		if( m_String.m_pData != rhs.m_String.m_pData )
+		if( m_pString->m_pData != rhs.m_pString->m_pData )
 		{
 			UTI_FATAL( "UTFIterator mismatch on != comparison" );
 			return false;
@@ -261,7 +326,7 @@ namespace uti
 	bool UTFCharIterator< String >::operator==( const UTFCharIterator< String >& rhs ) const
 	{
 #if _ITERATOR_DEBUG_LEVEL == 2
-		if( m_String.m_pData != rhs.m_String.m_pData )
+		if( m_pString->m_pData != rhs.m_pString->m_pData )
 		{
 			UTI_FATAL( "UTFIterator mismatch on == comparison" );
 			return false;
@@ -281,7 +346,7 @@ namespace uti
 #if _ITERATOR_DEBUG_LEVEL == 2
 		if( Valid() )
 		{
-			return ( m_String.m_pData.Ptr() + m_uiPos );
+			return ( m_pString->m_pData.Ptr() + m_uiPos );
 		}
 		else
 		{
@@ -289,7 +354,7 @@ namespace uti
 			return nullptr;
 		}
 #else
-		return ( m_String.m_pData.Ptr() + m_uiPos );
+		return ( m_pString->m_pData.Ptr() + m_uiPos );
 #endif
 
 	}
@@ -297,7 +362,7 @@ namespace uti
 	template< typename String >
 	bool UTFCharIterator< String >::Valid( void ) const
 	{
-		return m_uiPos < m_String.m_uiSize;
+		return m_uiPos < m_pString->m_uiSize;
 	}
 
 	template< typename String >
@@ -306,16 +371,23 @@ namespace uti
 		m_uiPos = 0U;
 	}
 
+	template< typename String >
+	UTFCharIterator< String >::UTFCharIterator( void ) :
+		m_pString( nullptr ),
+		m_uiPos( 0U )
+	{
+	}
+
 	template< typename String >
 	UTFCharIterator< String >::UTFCharIterator( typename UTFCharIterator< String >::String& data, u32 uiPos ) :
-		m_String( data ),
+		m_pString( &data ),
 		m_uiPos( uiPos )
 	{
 	}
 
 	template< typename String >
 	UTFCharIterator< String >::UTFCharIterator( const UTFCharIterator< String >& it ) :
-		m_String( it.m_String ),
+		m_pString( it.m_pString ),
 		m_uiPos( it.m_uiPos )
 	{
 
@@ -1,20 +1,88 @@
 #pragma once
 #ifndef utiCommonHeader_h__
 #define utiCommonHeader_h__
+#if defined( _MSC_VER )
 #include <intrin.h>
+#elif defined( __x86_64__ ) || defined( __i386__ )
+#include <x86intrin.h>
+#endif // _MSC_VER
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <type_traits>
 
 #define UTI_WINDOWS 1
+#define UTI_POSIX 2
+#if defined( _WIN32 )
 #define UTI_PLATFORM UTI_WINDOWS
+#else
+#define UTI_PLATFORM UTI_POSIX
+#endif // _WIN32
 
-#ifdef UTI_WINDOWS
+#if UTI_PLATFORM == UTI_WINDOWS
 #include <windows.h>
-#endif // UTI_WINDOWS
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif // UTI_PLATFORM
 
+// SSE2 is available on every x64 target and on x86 when compiling with /arch:SSE2 or higher
+#if defined( _M_X64 ) || defined( _M_AMD64 ) || ( defined( _M_IX86_FP ) && _M_IX86_FP >= 2 ) || defined( __SSE2__ )
+#define UTI_SSE2 1
+#endif // SSE2
+
+// POPCNT comes with every AVX capable cpu
+#if defined( __AVX__ ) || defined( __POPCNT__ )
+#define UTI_POPCNT 1
+#endif // POPCNT
+
+// BMI2 (pdep/pext) comes with every AVX2 capable cpu
+#if defined( __AVX2__ ) || defined( __BMI2__ )
+#define UTI_BMI2 1
+#endif // BMI2
+
+// Carry-less multiplication (pclmulqdq) comes with every AVX capable cpu, other compilers than msvc need it enabled on its own
+#if defined( __PCLMUL__ ) || ( defined( _MSC_VER ) && defined( __AVX__ ) )
+#define UTI_PCLMUL 1
+#endif // PCLMUL
+
+// Pragmas only msvc understands, e.g. to disable its warnings
+#if defined( _MSC_VER )
+#define UTI_MSVC_PRAGMA( ... ) __pragma( __VA_ARGS__ )
+#else
+#define UTI_MSVC_PRAGMA( ... )
+#endif // _MSC_VER
+
+// Ref qualified member functions, msvc supports them from Visual Studio 2015 on
+#if !defined( _MSC_VER ) || _MSC_VER >= 1900
+#define UTI_REF_QUALIFIERS
+#define UTI_LVALUE_THIS &
+#else
+#define UTI_LVALUE_THIS
+#endif // _MSC_VER
+
+// Thread local storage for plain pointers and integers
+#if defined( _MSC_VER )
+#define UTI_THREAD_LOCAL __declspec( thread )
+#else
+#define UTI_THREAD_LOCAL __thread
+#endif // _MSC_VER
 
 namespace uti
 {
 	typedef unsigned int u32;
 	typedef signed int s32;
+	typedef unsigned long long u64;
 
 	enum class EForceInit
 	{
@@ -29,16 +97,16 @@ namespace uti
 	template< typename TrueType, typename FalseType >
 	struct if_ < true, TrueType, FalseType >
 	{
-		typedef typename TrueType type;
+		typedef TrueType type;
 	};
 
 	template< typename TrueType, typename FalseType >
 	struct if_ < false, TrueType, FalseType >
 	{
-		typedef typename FalseType type;
+		typedef FalseType type;
 	};
 
-	template < typename ch, typename Allocator >
+	template < typename ch, typename Allocator, typename RefCountPolicy >
 	class UTF8String;
 
 	/**
@@ -85,10 +153,10 @@ namespace uti
 			printf("Assertion failed: " #__VA_ARGS__ "\n" );\
 			::uti::DebugBreak();\
 		}\
-		__pragma(warning(push))\
-		__pragma(warning( disable: 4127)) /* Disable condition is constant warning, because it is is the desired behavior */ \
+		UTI_MSVC_PRAGMA(warning(push))\
+		UTI_MSVC_PRAGMA(warning( disable: 4127)) /* Disable condition is constant warning, because it is is the desired behavior */ \
 	} while( 0 )\
-	__pragma(warning(pop))\
+	UTI_MSVC_PRAGMA(warning(pop))\
 
 
 #endif // assert
@@ -111,6 +179,18 @@ namespace uti
 		LittleEndian = 0x1,
 		BigEndian = 0x2
 	};
+
+	/**
+	\brief Swaps the two bytes of \c value.
+	*/
+	inline unsigned short ByteSwap16( unsigned short value )
+	{
+#if defined( _MSC_VER )
+		return _byteswap_ushort( value );
+#else
+		return __builtin_bswap16( value );
+#endif // _MSC_VER
+	}
 }
 
 #endif // utiCommonHeader_h__
@@ -0,0 +1,148 @@
+#pragma once
+#ifndef utiConcurrentInternPool_h__
+#define utiConcurrentInternPool_h__
+
+namespace uti
+{
+	/**
+	\brief Thread safe variant of the InternPool, which many threads can intern strings in concurrently.
+
+	The pool is a fixed array of buckets, each holding a lock-free singly linked list of entries.
+	Lookups never lock or write shared memory besides the reference counter of the found string.
+	Inserts push a new entry to the front of its bucket with a single compare and swap
+	and only have to check the entries pushed in the meantime if it fails.
+
+	Purge() removes the entries which are only referenced by the pool. Purging is serialized, but runs concurrently to lookups and inserts.
+	An entry is revived if a lookup acquires its string while it is being removed, so interned strings stay unique.
+	Removed entries are reclaimed through the Epoch once no lookup can reach them anymore.
+
+	The strings are shared between threads, so they have to use the AtomicRefCountPolicy, e.g. UTF8String< char, DefaultAllocator, AtomicRefCountPolicy >,
+	or another policy for which IsConcurrentRefCountPolicy holds.
+
+	\tparam StringType The interned string type.
+	\tparam Allocator Is the class used to allocate the buckets and entries of the pool.
+	*/
+	template< typename StringType, typename Allocator = typename StringType::AllocatorType >
+	class ConcurrentInternPool
+	{
+		static_assert( IsConcurrentRefCountPolicy< typename StringType::RefCountPolicyType >::value,
+			"The strings of a ConcurrentInternPool are shared between threads and have to count their references atomically, e.g. with the AtomicRefCountPolicy" );
+
+	public:
+
+		typedef typename StringType::Type DataType;
+		typedef ConcurrentInternPool< StringType, Allocator > ThisType;
+
+		/**
+		\brief Creates an empty pool with \c bucketCount buckets ( rounded up to a power of two ).
+
+		The buckets are never resized, so the count should be in the order of the expected number of strings.
+		*/
+		explicit ConcurrentInternPool( u32 bucketCount = 4096U );
+
+		/**
+		\brief Destroys the pool, no other thread may use the pool anymore.
+		*/
+		~ConcurrentInternPool();
+
+		/**
+		\brief Returns the canonical string for the content of \c string.
+
+		If the content was not interned yet, \c string itself becomes the canonical string, so no data is copied.
+		*/
+		StringType Intern( const StringType& string );
+
+		/**
+		\brief Returns the canonical string for the zero terminated \c text, a string is only created if the content was not interned yet.
+		*/
+		StringType Intern( const DataType* text );
+
+		/**
+		\brief Looks up the canonical string for the \c size units starting at \c data.
+
+		\return \c true if the content was interned and \c result was set to the canonical string.
+		*/
+		bool Find( const DataType* data, u32 size, StringType& result ) const;
+
+		/**
+		\brief Returns the number of interned strings, which might be outdated once it returns.
+		*/
+		u32 Size( void ) const;
+
+		/**
+		\brief Removes every string which is only referenced by the pool.
+
+		\return The number of removed strings.
+		*/
+		u32 Purge( void );
+
+	protected:
+	private:
+
+		enum EntryState
+		{
+			Live = 0,
+			Dying = 1,
+			Dead = 2
+		};
+
+		struct Entry : public EpochRetired
+		{
+			Entry( u64 hash, const StringType& string, const Allocator& alloc );
+
+			u64 Hash;
+			u32 Size;
+			std::atomic< u32 > State;
+			std::atomic< Entry* > pNext;
+			StringType String;
+			Allocator Alloc;
+		};
+
+		typedef std::atomic< Entry* > Bucket;
+
+		ConcurrentInternPool( const ThisType& );
+		ThisType& operator =( const ThisType& );
+
+		Bucket& BucketFor( u64 hash ) const;
+
+		/**
+		\brief Searches the entries from \c first up to but not including \c last for the given content
+		and acquires the string of the first live match.
+		*/
+		static bool Lookup( Entry* first, Entry* last, u64 hash, const DataType* data, u32 size, StringType& result );
+
+		/**
+		\brief Returns the first entry from \c first up to but not including \c last holding the given content.
+		*/
+		static Entry* Match( Entry* first, Entry* last, u64 hash, const DataType* data, u32 size );
+
+		/**
+		\brief Returns if \c entry is alive, waits until a running purge decided about it.
+
+		A reference to the string of the entry has to be taken before.
+		*/
+		static bool IsLive( Entry* entry );
+
+		/**
+		\brief Marks \c entry as dead if its string is only referenced by the pool.
+		*/
+		static bool TryKill( Entry* entry );
+
+		static void Unlink( Bucket& bucket, Entry* previous, Entry* entry, Entry* next );
+
+		Entry* CreateEntry( u64 hash, const StringType& string );
+
+		static void DestroyEntry( Entry* entry );
+		static void ReclaimEntry( EpochRetired* object );
+
+		static u32 Length( const DataType* text );
+
+		Bucket* m_pBuckets;
+		u32 m_uiBucketMask;
+		std::atomic< u32 > m_Size;
+		std::mutex m_PurgeMutex;
+		Allocator m_Alloc;
+	};
+}
+
+#endif // utiConcurrentInternPool_h__
@@ -0,0 +1,291 @@
+#pragma once
+#ifndef utiConcurrentInternPool_inl__
+#define utiConcurrentInternPool_inl__
+
+namespace uti
+{
+	//////////////////////////////////////////////////////////////////////////
+	// Concurrent Intern Pool implementation
+	//////////////////////////////////////////////////////////////////////////
+
+	template< typename StringType, typename Allocator >
+	ConcurrentInternPool< StringType, Allocator >::Entry::Entry( u64 hash, const StringType& string, const Allocator& alloc ) :
+		Hash( hash ),
+		Size( string.Bytes().Size() ),
+		String( string ),
+		Alloc( alloc )
+	{
+		Reclaim = &ConcurrentInternPool< StringType, Allocator >::ReclaimEntry;
+		pNextRetired = nullptr;
+		RetireEpoch = 0U;
+		State.store( Live, std::memory_order_relaxed );
+		pNext.store( nullptr, std::memory_order_relaxed );
+	}
+
+	template< typename StringType, typename Allocator >
+	ConcurrentInternPool< StringType, Allocator >::ConcurrentInternPool( u32 bucketCount /*= 4096U */ )
+	{
+		u32 capacity = 1U;
+		while( capacity < bucketCount )
+		{
+			capacity <<= 1U;
+		}
+
+		m_pBuckets = static_cast< Bucket* >( m_Alloc.AllocateBytes( capacity * sizeof( Bucket ) ) );
+		for( u32 i = 0U; i < capacity; ++i )
+		{
+			new( m_pBuckets + i ) Bucket( nullptr );
+		}
+		m_uiBucketMask = capacity - 1U;
+		m_Size.store( 0U, std::memory_order_relaxed );
+	}
+
+	template< typename StringType, typename Allocator >
+	ConcurrentInternPool< StringType, Allocator >::~ConcurrentInternPool()
+	{
+		for( u32 i = 0U; i <= m_uiBucketMask; ++i )
+		{
+			Entry* entry = m_pBuckets[ i ].load( std::memory_order_acquire );
+			while( entry != nullptr )
+			{
+				Entry* next = entry->pNext.load( std::memory_order_relaxed );
+				DestroyEntry( entry );
+				entry = next;
+			}
+			m_pBuckets[ i ].~Bucket();
+		}
+		m_Alloc.FreeBytes( m_pBuckets );
+		m_pBuckets = nullptr;
+
+		// Entries removed by earlier purges might still wait for their reclamation
+		Epoch::Reclaim();
+	}
+
+	template< typename StringType, typename Allocator >
+	StringType ConcurrentInternPool< StringType, Allocator >::Intern( const StringType& string )
+	{
+		typename StringType::Span units = string.Bytes();
+		u64 hash = string.Hash();
+		Bucket& bucket = BucketFor( hash );
+
+		EpochGuard guard;
+		StringType result( string );
+		Entry* head = bucket.load( std::memory_order_acquire );
+		if( Lookup( head, nullptr, hash, units.begin(), units.Size(), result ) )
+		{
+			return result;
+		}
+
+		Entry* entry = CreateEntry( hash, string );
+		for( ;; )
+		{
+			entry->pNext.store( head, std::memory_order_relaxed );
+			if( bucket.compare_exchange_weak( head, entry, std::memory_order_acq_rel, std::memory_order_acquire ) )
+			{
+				m_Size.fetch_add( 1U, std::memory_order_relaxed );
+				return string;
+			}
+
+			// Another thread changed the bucket, only the entries pushed since the last look can hold the content
+			if( Lookup( head, entry->pNext.load( std::memory_order_relaxed ), hash, units.begin(), units.Size(), result ) )
+			{
+				DestroyEntry( entry );
+				return result;
+			}
+		}
+	}
+
+	template< typename StringType, typename Allocator >
+	StringType ConcurrentInternPool< StringType, Allocator >::Intern( const DataType* text )
+	{
+		u32 size = Length( text );
+		u64 hash = HashBytes( text, size * sizeof( DataType ) );
+		{
+			EpochGuard guard;
+			Entry* entry = Match( BucketFor( hash ).load( std::memory_order_acquire ), nullptr, hash, text, size );
+			while( entry != nullptr )
+			{
+				StringType result( entry->String );
+				if( IsLive( entry ) )
+				{
+					return result;
+				}
+				entry = Match( entry->pNext.load( std::memory_order_acquire ), nullptr, hash, text, size );
+			}
+		}
+		// The stored data might differ from the text ( e.g. replaced invalid chars ), so intern the created string by its own content
+		return Intern( StringType( text ) );
+	}
+
+	template< typename StringType, typename Allocator >
+	bool ConcurrentInternPool< StringType, Allocator >::Find( const DataType* data, u32 size, StringType& result ) const
+	{
+		u64 hash = HashBytes( data, size * sizeof( DataType ) );
+		EpochGuard guard;
+		return Lookup( BucketFor( hash ).load( std::memory_order_acquire ), nullptr, hash, data, size, result );
+	}
+
+	template< typename StringType, typename Allocator >
+	u32 ConcurrentInternPool< StringType, Allocator >::Size( void ) const
+	{
+		return m_Size.load( std::memory_order_relaxed );
+	}
+
+	template< typename StringType, typename Allocator >
+	u32 ConcurrentInternPool< StringType, Allocator >::Purge( void )
+	{
+		u32 removed = 0U;
+		{
+			std::lock_guard< std::mutex > lock( m_PurgeMutex );
+			for( u32 i = 0U; i <= m_uiBucketMask; ++i )
+			{
+				Bucket& bucket = m_pBuckets[ i ];
+				Entry* previous = nullptr;
+				Entry* entry = bucket.load( std::memory_order_acquire );
+				while( entry != nullptr )
+				{
+					Entry* next = entry->pNext.load( std::memory_order_acquire );
+					if( entry->String.ReferenceCount() == 1U && TryKill( entry ) )
+					{
+						Unlink( bucket, previous, entry, next );
+						Epoch::Retire( entry );
+						++removed;
+					}
+					else
+					{
+						previous = entry;
+					}
+					entry = next;
+				}
+			}
+			m_Size.fetch_sub( removed, std::memory_order_relaxed );
+		}
+
+		Epoch::Reclaim();
+		return removed;
+	}
+
+	template< typename StringType, typename Allocator >
+	typename ConcurrentInternPool< StringType, Allocator >::Bucket& ConcurrentInternPool< StringType, Allocator >::BucketFor( u64 hash ) const
+	{
+		return m_pBuckets[ static_cast< u32 >( hash ^ ( hash >> 32U ) ) & m_uiBucketMask ];
+	}
+
+	template< typename StringType, typename Allocator >
+	bool ConcurrentInternPool< StringType, Allocator >::Lookup( Entry* first, Entry* last, u64 hash, const DataType* data, u32 size, StringType& result )
+	{
+		for( Entry* entry = Match( first, last, hash, data, size ); entry != nullptr; entry = Match( entry->pNext.load( std::memory_order_acquire ), last, hash, data, size ) )
+		{
+			// Take a reference first and check the state afterwards, a purge seeing the reference revives the entry
+			result = entry->String;
+			if( IsLive( entry ) )
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	template< typename StringType, typename Allocator >
+	typename ConcurrentInternPool< StringType, Allocator >::Entry* ConcurrentInternPool< StringType, Allocator >::Match( Entry* first, Entry* last, u64 hash, const DataType* data, u32 size )
+	{
+		for( Entry* entry = first; entry != last && entry != nullptr; entry = entry->pNext.load( std::memory_order_acquire ) )
+		{
+			if( entry->Hash == hash && entry->Size == size && simd::Equal( entry->String.Bytes().begin(), data, size * sizeof( DataType ) ) )
+			{
+				return entry;
+			}
+		}
+		return nullptr;
+	}
+
+	template< typename StringType, typename Allocator >
+	bool ConcurrentInternPool< StringType, Allocator >::IsLive( Entry* entry )
+	{
+		u32 state = entry->State.load( std::memory_order_seq_cst );
+		while( state == Dying )
+		{
+			std::this_thread::yield();
+			state = entry->State.load( std::memory_order_seq_cst );
+		}
+		return state == Live;
+	}
+
+	template< typename StringType, typename Allocator >
+	bool ConcurrentInternPool< StringType, Allocator >::TryKill( Entry* entry )
+	{
+		u32 expected = Live;
+		if( !entry->State.compare_exchange_strong( expected, Dying, std::memory_order_seq_cst ) )
+		{
+			return false;
+		}
+
+		// A lookup acquiring the string now either is seen here or sees the dying state and waits for the decision
+		std::atomic_thread_fence( std::memory_order_seq_cst );
+		if( entry->String.ReferenceCount() == 1U )
+		{
+			entry->State.store( Dead, std::memory_order_seq_cst );
+			return true;
+		}
+
+		entry->State.store( Live, std::memory_order_seq_cst );
+		return false;
+	}
+
+	template< typename StringType, typename Allocator >
+	void ConcurrentInternPool< StringType, Allocator >::Unlink( Bucket& bucket, Entry* previous, Entry* entry, Entry* next )
+	{
+		if( previous == nullptr )
+		{
+			Entry* expected = entry;
+			if( bucket.compare_exchange_strong( expected, next, std::memory_order_acq_rel ) )
+			{
+				return;
+			}
+			// Entries were pushed in front of it, only the purge changes links behind the head, so the predecessor stays put
+			previous = expected;
+			while( previous->pNext.load( std::memory_order_acquire ) != entry )
+			{
+				previous = previous->pNext.load( std::memory_order_acquire );
+			}
+		}
+		previous->pNext.store( next, std::memory_order_release );
+	}
+
+	template< typename StringType, typename Allocator >
+	typename ConcurrentInternPool< StringType, Allocator >::Entry* ConcurrentInternPool< StringType, Allocator >::CreateEntry( u64 hash, const StringType& string )
+	{
+		void* memory = m_Alloc.AllocateBytes( sizeof( Entry ) );
+		return new( memory ) Entry( hash, string, m_Alloc );
+	}
+
+	template< typename StringType, typename Allocator >
+	void ConcurrentInternPool< StringType, Allocator >::DestroyEntry( Entry* entry )
+	{
+		Allocator alloc( entry->Alloc );
+		entry->~Entry();
+		alloc.FreeBytes( entry );
+	}
+
+	template< typename StringType, typename Allocator >
+	void ConcurrentInternPool< StringType, Allocator >::ReclaimEntry( EpochRetired* object )
+	{
+		DestroyEntry( static_cast< Entry* >( object ) );
+	}
+
+	template< typename StringType, typename Allocator >
+	u32 ConcurrentInternPool< StringType, Allocator >::Length( const DataType* text )
+	{
+		u32 length = 0U;
+		if( text != nullptr )
+		{
+			while( text[ length ] != 0 )
+			{
+				++length;
+			}
+		}
+		return length;
+	}
+}
+
+#endif // utiConcurrentInternPool_inl__
@@ -0,0 +1,42 @@
+#pragma once
+#ifndef utiCrossEncoding_h__
+#define utiCrossEncoding_h__
+
+namespace uti
+{
+	/**
+	\brief Returns if \c utf8 and \c utf16 contain the same chars.
+
+	Both strings are decoded side by side, nothing is transcoded or allocated.
+	Runs of ASCII chars are compared 16 chars at a time ( see simd::AsciiMatchMask16() ),
+	only the chars outside of them are decoded to code points.
+	Strings with a different char count are rejected without reading them.
+	*/
+	template< typename ch8, typename Allocator8, typename RefCountPolicy8, typename ch16, BinaryOrder order, typename Allocator16 >
+	bool Equals( const UTF8String< ch8, Allocator8, RefCountPolicy8 >& utf8, const UTF16String< ch16, order, Allocator16 >& utf16 );
+
+	template< typename ch8, typename Allocator8, typename RefCountPolicy8, typename ch16, BinaryOrder order, typename Allocator16 >
+	bool Equals( const UTF16String< ch16, order, Allocator16 >& utf16, const UTF8String< ch8, Allocator8, RefCountPolicy8 >& utf8 );
+
+	/**
+	\brief Compares \c lhs with \c rhs in code point order, which is the order of Compare() of both string classes.
+
+	\return A value less than, equal to or greater than zero if \c lhs is ordered before, equal to or after \c rhs.
+	*/
+	template< typename ch8, typename Allocator8, typename RefCountPolicy8, typename ch16, BinaryOrder order, typename Allocator16 >
+	s32 Compare( const UTF8String< ch8, Allocator8, RefCountPolicy8 >& lhs, const UTF16String< ch16, order, Allocator16 >& rhs );
+
+	template< typename ch8, typename Allocator8, typename RefCountPolicy8, typename ch16, BinaryOrder order, typename Allocator16 >
+	s32 Compare( const UTF16String< ch16, order, Allocator16 >& lhs, const UTF8String< ch8, Allocator8, RefCountPolicy8 >& rhs );
+
+	/**
+	\brief Returns if \c text starts with the chars of \c prefix.
+	*/
+	template< typename ch8, typename Allocator8, typename RefCountPolicy8, typename ch16, BinaryOrder order, typename Allocator16 >
+	bool StartsWith( const UTF8String< ch8, Allocator8, RefCountPolicy8 >& text, const UTF16String< ch16, order, Allocator16 >& prefix );
+
+	template< typename ch8, typename Allocator8, typename RefCountPolicy8, typename ch16, BinaryOrder order, typename Allocator16 >
+	bool StartsWith( const UTF16String< ch16, order, Allocator16 >& text, const UTF8String< ch8, Allocator8, RefCountPolicy8 >& prefix );
+}
+
+#endif // utiCrossEncoding_h__
@@ -0,0 +1,131 @@
+#pragma once
+#ifndef utiCrossEncoding_inl__
+#define utiCrossEncoding_inl__
+
+namespace uti
+{
+	namespace detail
+	{
+		/**
+		\brief Walks the utf-8 and utf-16 data side by side, until a char differs or one of them ends.
+
+		\param utf8Pos Is set to the position ( in bytes ) of the first differing char or the end of the walk.
+		\param utf16Pos Is set to the position ( in units ) of the first differing char or the end of the walk.
+
+		\return The order of the first differing chars, or 0 if one of the data ended before a difference was found.
+		*/
+		template< typename String8, typename String16 >
+		s32 CrossCompareUnits( const typename String8::Type* utf8, u32 utf8Size, u32& utf8Pos,
+			const typename String16::Type* utf16, u32 utf16Size, u32& utf16Pos, bool bigEndian )
+		{
+			const unsigned char* bytes = reinterpret_cast< const unsigned char* >( utf8 );
+			utf8Pos = 0U;
+			utf16Pos = 0U;
+			while( utf8Pos < utf8Size && utf16Pos < utf16Size )
+			{
+				// Skip equal ASCII runs block by block, the block is only tried if the next char is ASCII at all
+				if( sizeof( typename String16::Type ) == 2U )
+				{
+					while( bytes[ utf8Pos ] < 0x80U && utf8Pos + 16U <= utf8Size && utf16Pos + 16U <= utf16Size )
+					{
+						u32 match = simd::AsciiMatchMask16( bytes + utf8Pos, reinterpret_cast< const unsigned short* >( utf16 + utf16Pos ), bigEndian );
+						u32 run = match == 0xFFFFU ? 16U : simd::LowestBit( ~match );
+						utf8Pos += run;
+						utf16Pos += run;
+						if( run < 16U )
+						{
+							break;
+						}
+					}
+					if( utf8Pos == utf8Size || utf16Pos == utf16Size )
+					{
+						break;
+					}
+				}
+
+				u32 codePoint8 = String8::ExtractCodePoint( utf8 + utf8Pos );
+				u32 codePoint16 = String16::ExtractCodePoint( utf16 + utf16Pos );
+				if( codePoint8 != codePoint16 )
+				{
+					return codePoint8 < codePoint16 ? -1 : 1;
+				}
+				utf8Pos += String8::CharSize( utf8 + utf8Pos );
+				utf16Pos += String16::CharSize( utf16 + utf16Pos );
+			}
+			return 0;
+		}
+	}
+
+	template< typename ch8, typename Allocator8, typename RefCountPolicy8, typename ch16, BinaryOrder order, typename Allocator16 >
+	bool Equals( const UTF8String< ch8, Allocator8, RefCountPolicy8 >& utf8, const UTF16String< ch16, order, Allocator16 >& utf16 )
+	{
+		if( utf8.CharCount() != utf16.CharCount() )
+		{
+			return false;
+		}
+		u32 utf8Pos;
+		u32 utf16Pos;
+		s32 result = detail::CrossCompareUnits< UTF8String< ch8, Allocator8, RefCountPolicy8 >, UTF16String< ch16, order, Allocator16 > >(
+			utf8.Data(), utf8.Size(), utf8Pos, utf16.Data(), utf16.Bytes().Size(), utf16Pos, order == BinaryOrder::BigEndian );
+		return result == 0 && utf8Pos == utf8.Size() && utf16Pos == utf16.Bytes().Size();
+	}
+
+	template< typename ch8, typename Allocator8, typename RefCountPolicy8, typename ch16, BinaryOrder order, typename Allocator16 >
+	bool Equals( const UTF16String< ch16, order, Allocator16 >& utf16, const UTF8String< ch8, Allocator8, RefCountPolicy8 >& utf8 )
+	{
+		return Equals( utf8, utf16 );
+	}
+
+	template< typename ch8, typename Allocator8, typename RefCountPolicy8, typename ch16, BinaryOrder order, typename Allocator16 >
+	s32 Compare( const UTF8String< ch8, Allocator8, RefCountPolicy8 >& lhs, const UTF16String< ch16, order, Allocator16 >& rhs )
+	{
+		u32 lhsPos;
+		u32 rhsPos;
+		s32 result = detail::CrossCompareUnits< UTF8String< ch8, Allocator8, RefCountPolicy8 >, UTF16String< ch16, order, Allocator16 > >(
+			lhs.Data(), lhs.Size(), lhsPos, rhs.Data(), rhs.Bytes().Size(), rhsPos, order == BinaryOrder::BigEndian );
+		if( result != 0 )
+		{
+			return result;
+		}
+		// No char differs, so the string which ended first is a prefix of the other one
+		bool lhsEnded = lhsPos == lhs.Size();
+		bool rhsEnded = rhsPos == rhs.Bytes().Size();
+		return lhsEnded == rhsEnded ? 0 : ( lhsEnded ? -1 : 1 );
+	}
+
+	template< typename ch8, typename Allocator8, typename RefCountPolicy8, typename ch16, BinaryOrder order, typename Allocator16 >
+	s32 Compare( const UTF16String< ch16, order, Allocator16 >& lhs, const UTF8String< ch8, Allocator8, RefCountPolicy8 >& rhs )
+	{
+		return -Compare( rhs, lhs );
+	}
+
+	template< typename ch8, typename Allocator8, typename RefCountPolicy8, typename ch16, BinaryOrder order, typename Allocator16 >
+	bool StartsWith( const UTF8String< ch8, Allocator8, RefCountPolicy8 >& text, const UTF16String< ch16, order, Allocator16 >& prefix )
+	{
+		if( prefix.CharCount() > text.CharCount() )
+		{
+			return false;
+		}
+		u32 textPos;
+		u32 prefixPos;
+		s32 result = detail::CrossCompareUnits< UTF8String< ch8, Allocator8, RefCountPolicy8 >, UTF16String< ch16, order, Allocator16 > >(
+			text.Data(), text.Size(), textPos, prefix.Data(), prefix.Bytes().Size(), prefixPos, order == BinaryOrder::BigEndian );
+		return result == 0 && prefixPos == prefix.Bytes().Size();
+	}
+
+	template< typename ch8, typename Allocator8, typename RefCountPolicy8, typename ch16, BinaryOrder order, typename Allocator16 >
+	bool StartsWith( const UTF16String< ch16, order, Allocator16 >& text, const UTF8String< ch8, Allocator8, RefCountPolicy8 >& prefix )
+	{
+		if( prefix.CharCount() > text.CharCount() )
+		{
+			return false;
+		}
+		u32 prefixPos;
+		u32 textPos;
+		s32 result = detail::CrossCompareUnits< UTF8String< ch8, Allocator8, RefCountPolicy8 >, UTF16String< ch16, order, Allocator16 > >(
+			prefix.Data(), prefix.Size(), prefixPos, text.Data(), text.Bytes().Size(), textPos, order == BinaryOrder::BigEndian );
+		return result == 0 && prefixPos == prefix.Size();
+	}
+}
+
+#endif // utiCrossEncoding_inl__
@@ -0,0 +1,181 @@
+#pragma once
+#ifndef utiCsvReader_h__
+#define utiCsvReader_h__
+
+namespace uti
+{
+	/**
+	\brief Reasons why a CsvReader stops reading.
+	*/
+	enum class CsvError
+	{
+		None,
+		// The text is no well formed utf-8
+		InvalidUtf8,
+		// A quote inside of an unquoted field or text behind the closing quote of a field
+		UnexpectedQuote,
+		// A quoted field is not closed before the end of the text
+		UnterminatedQuote
+	};
+
+	/**
+	\brief Reader which splits a utf-8 text into the records and fields of RFC 4180 CSV ( or TSV ) data.
+
+	The text is classified 64 bytes at a time: the quotes, delimiters and line feeds of a block are turned into bit masks,
+	the quoted regions are resolved with a prefix xor of the quote mask ( see simd::PrefixXor() ) and only the delimiters
+	and line feeds outside of quotes are visited one by one. The text is checked to be well formed utf-8 a few blocks ahead of the classification.
+
+	The fields are views into the text, which the reader holds a reference to. Only fields containing escaped quotes ( "" )
+	are unescaped into an arena owned by the reader, which is reused for every record. So every field is only valid
+	until the next call to NextRecord().
+
+	Line breaks may be "\n" or "\r\n", line breaks inside of quoted fields are part of the field.
+	Once an error is found the records in front of it are still returned, then NextRecord() fails and Error() tells why.
+
+	\code
+	CsvReader< UTF8String<> > reader( text );
+	while( reader.NextRecord() )
+	{
+		auto name = reader.Field( 0 );
+	}
+	\endcode
+
+	\tparam StringType The utf-8 string type holding the text, e.g. UTF8String<>.
+	\tparam Allocator Is the class used to allocate the field table and the arena.
+	*/
+	template< typename StringType, typename Allocator = typename StringType::AllocatorType >
+	class CsvReader
+	{
+	public:
+
+		typedef typename StringType::Type DataType;
+		typedef const DataType* ConstPointer;
+		typedef ByteSpan< StringType > Span;
+		typedef CsvReader< StringType, Allocator > ThisType;
+
+		/**
+		\brief Creates a reader in front of the first record of \c text.
+
+		\param delimiter The ASCII char separating the fields, e.g. '\\t' for TSV data.
+		\param quote The ASCII char enclosing fields which contain delimiters, quotes or line breaks.
+		*/
+		explicit CsvReader( const StringType& text, DataType delimiter = ',', DataType quote = '"' );
+
+		~CsvReader();
+
+		/**
+		\brief Reads the next record.
+
+		\return \c false if there are no more records or an error was found.
+		*/
+		bool NextRecord( void );
+
+		/**
+		\brief Returns the number of fields of the current record.
+		*/
+		u32 FieldCount( void ) const;
+
+		/**
+		\brief Returns a view of the field with the given index of the current record, without enclosing quotes.
+
+		\param index The index of the field, might range from 0<=index<FieldCount().
+		*/
+		Span Field( u32 index ) const;
+
+		/**
+		\brief Returns the byte offset of the current record in the text.
+		*/
+		u32 RecordOffset( void ) const;
+
+		/**
+		\brief Returns why the reader stopped or CsvError::None if it did not find an error.
+		*/
+		CsvError Error( void ) const;
+
+		/**
+		\brief Returns the byte offset in the text of the first byte which caused Error().
+		*/
+		u32 ErrorOffset( void ) const;
+
+	protected:
+	private:
+
+		struct FieldEntry
+		{
+			// Offset in the text or in the arena
+			u32 Offset;
+			u32 Size;
+			bool Unescaped;
+		};
+
+		// Number of bytes behind the current block, which are validated along with it
+		static const u32 ValidateAhead = 4096U;
+
+		CsvReader( const ThisType& );
+		ThisType& operator =( const ThisType& );
+
+		/**
+		\brief Returns the offset of the next delimiter or line feed outside of quotes, or the size of the text if there is none.
+		*/
+		u32 NextStructural( void );
+
+		/**
+		\brief Builds the masks of the block starting at \c offset and validates its bytes.
+		*/
+		void ClassifyBlock( u32 offset );
+
+		/**
+		\brief Adds the field from \c begin up to \c end to the current record, unquoting and unescaping it if needed.
+
+		\return \c false if the field is malformed.
+		*/
+		bool AddField( u32 begin, u32 end );
+
+		/**
+		\brief Remembers an error at \c offset, which is reported once a record reaches it.
+		*/
+		void SetPendingError( CsvError error, u32 offset );
+
+		void Fail( CsvError error, u32 offset );
+
+		StringType m_Text;
+		ConstPointer m_pData;
+		u32 m_uiSize;
+		unsigned char m_Delimiter;
+		unsigned char m_Quote;
+
+		// Delimiters and line feeds outside of quotes of the current block, which were not visited yet
+		u64 m_uiStructural;
+		u32 m_uiBlockOffset;
+		u32 m_uiNextBlock;
+		// All bits set if the previous block ended inside of quotes
+		u64 m_uiInsideQuotes;
+		// Set if the last byte of the previous block allows an opening quote behind it
+		u64 m_uiQuoteAllowed;
+		// Set if the last byte of the previous block is a closing quote, an opening quote behind it is escaped
+		u64 m_uiClosingQuote;
+		// Offset of the quote which opened the last quoted field
+		u32 m_uiOpeningQuote;
+		// Every byte in front of this offset is well formed utf-8
+		u32 m_uiValidEnd;
+
+		// Start of the next record, behind the end of the text if there are no more records
+		u32 m_uiPos;
+		u32 m_uiRecordOffset;
+
+		FieldEntry* m_pFields;
+		u32 m_uiFieldCount;
+		u32 m_uiFieldCapacity;
+		DataType* m_pArena;
+		u32 m_uiArenaSize;
+		u32 m_uiArenaCapacity;
+
+		CsvError m_ePendingError;
+		u32 m_uiPendingOffset;
+		CsvError m_eError;
+		u32 m_uiErrorOffset;
+		Allocator m_Alloc;
+	};
+}
+
+#endif // utiCsvReader_h__
@@ -0,0 +1,311 @@
+#pragma once
+#ifndef utiCsvReader_inl__
+#define utiCsvReader_inl__
+
+namespace uti
+{
+	//////////////////////////////////////////////////////////////////////////
+	// CSV Reader implementation
+	//////////////////////////////////////////////////////////////////////////
+
+	template< typename StringType, typename Allocator >
+	CsvReader< StringType, Allocator >::CsvReader( const StringType& text, DataType delimiter /*= ',' */, DataType quote /*= '"' */ ) :
+		m_Text( text ),
+		m_pData( text.Bytes().begin() ),
+		m_uiSize( text.Bytes().Size() ),
+		m_Delimiter( static_cast< unsigned char >( delimiter ) ),
+		m_Quote( static_cast< unsigned char >( quote ) ),
+		m_uiStructural( 0U ),
+		m_uiBlockOffset( 0U ),
+		m_uiNextBlock( 0U ),
+		m_uiInsideQuotes( 0U ),
+		m_uiQuoteAllowed( 1U ),
+		m_uiClosingQuote( 0U ),
+		m_uiOpeningQuote( 0U ),
+		m_uiValidEnd( 0U ),
+		m_uiPos( 0U ),
+		m_uiRecordOffset( 0U ),
+		m_pFields( nullptr ),
+		m_uiFieldCount( 0U ),
+		m_uiFieldCapacity( 0U ),
+		m_pArena( nullptr ),
+		m_uiArenaSize( 0U ),
+		m_uiArenaCapacity( 0U ),
+		m_ePendingError( CsvError::None ),
+		m_uiPendingOffset( 0xFFFFFFFFU ),
+		m_eError( CsvError::None ),
+		m_uiErrorOffset( 0U )
+	{
+		static_assert( sizeof( DataType ) == 1U, "CSV data is read from utf-8 bytes" );
+		// Padding bytes of the last block are zero, so neither char may be zero
+		UTI_ASSERT( m_Delimiter != 0U && m_Delimiter < 0x80U && m_Delimiter != '\n' && m_Delimiter != '\r' );
+		UTI_ASSERT( m_Quote != 0U && m_Quote < 0x80U && m_Quote != '\n' && m_Quote != '\r' && m_Quote != m_Delimiter );
+	}
+
+	template< typename StringType, typename Allocator >
+	CsvReader< StringType, Allocator >::~CsvReader()
+	{
+		if( m_pFields != nullptr )
+		{
+			m_Alloc.FreeBytes( m_pFields );
+			m_pFields = nullptr;
+		}
+		if( m_pArena != nullptr )
+		{
+			m_Alloc.FreeBytes( m_pArena );
+			m_pArena = nullptr;
+		}
+	}
+
+	template< typename StringType, typename Allocator >
+	bool CsvReader< StringType, Allocator >::NextRecord( void )
+	{
+		m_uiFieldCount = 0U;
+		m_uiArenaSize = 0U;
+		if( m_eError != CsvError::None || m_uiPos >= m_uiSize )
+		{
+			return false;
+		}
+
+		m_uiRecordOffset = m_uiPos;
+		u32 begin = m_uiPos;
+		u32 end;
+		do
+		{
+			end = NextStructural();
+			AddField( begin, end );
+			begin = end + 1U;
+		} while( end < m_uiSize && m_pData[ end ] != '\n' );
+		m_uiPos = begin;
+
+		// A char which is still not validated in front of the line feed can not be completed by the next block
+		if( m_uiValidEnd < end )
+		{
+			SetPendingError( CsvError::InvalidUtf8, m_uiValidEnd );
+		}
+		// Errors are reported by the first record reaching them, the records in front of them are fine
+		if( m_uiPendingOffset < begin )
+		{
+			Fail( m_ePendingError, m_uiPendingOffset );
+			return false;
+		}
+		return true;
+	}
+
+	template< typename StringType, typename Allocator >
+	u32 CsvReader< StringType, Allocator >::FieldCount( void ) const
+	{
+		return m_uiFieldCount;
+	}
+
+	template< typename StringType, typename Allocator >
+	typename CsvReader< StringType, Allocator >::Span CsvReader< StringType, Allocator >::Field( u32 index ) const
+	{
+		UTI_ASSERT( index < m_uiFieldCount );
+		const FieldEntry& field = m_pFields[ index ];
+		ConstPointer base = field.Unescaped ? m_pArena : m_pData;
+		return Span( base + field.Offset, base + field.Offset + field.Size, m_Text.IsAscii() );
+	}
+
+	template< typename StringType, typename Allocator >
+	u32 CsvReader< StringType, Allocator >::RecordOffset( void ) const
+	{
+		return m_uiRecordOffset;
+	}
+
+	template< typename StringType, typename Allocator >
+	CsvError CsvReader< StringType, Allocator >::Error( void ) const
+	{
+		return m_eError;
+	}
+
+	template< typename StringType, typename Allocator >
+	u32 CsvReader< StringType, Allocator >::ErrorOffset( void ) const
+	{
+		return m_uiErrorOffset;
+	}
+
+	template< typename StringType, typename Allocator >
+	u32 CsvReader< StringType, Allocator >::NextStructural( void )
+	{
+		while( m_uiStructural == 0U )
+		{
+			if( m_uiNextBlock >= m_uiSize )
+			{
+				return m_uiSize;
+			}
+			ClassifyBlock( m_uiNextBlock );
+		}
+		u32 offset = m_uiBlockOffset + simd::LowestBit64( m_uiStructural );
+		m_uiStructural &= m_uiStructural - 1U;
+		return offset;
+	}
+
+	template< typename StringType, typename Allocator >
+	void CsvReader< StringType, Allocator >::ClassifyBlock( u32 offset )
+	{
+		const u32 size = m_uiSize - offset < 64U ? m_uiSize - offset : 64U;
+		const unsigned char* bytes = reinterpret_cast< const unsigned char* >( m_pData ) + offset;
+		unsigned char padded[ 64 ];
+		if( size < 64U )
+		{
+			std::memset( padded, 0, sizeof( padded ) );
+			std::memcpy( padded, bytes, size );
+			bytes = padded;
+		}
+
+		const u64 quotes = simd::ByteEqualMask64( bytes, m_Quote );
+		const u64 inside = simd::PrefixXor( quotes ) ^ m_uiInsideQuotes;
+		const u64 structural = ( simd::ByteEqualMask64( bytes, m_Delimiter ) | simd::ByteEqualMask64( bytes, '\n' ) ) & ~inside;
+
+		// Opening quotes are part of the quoted region, closing quotes are not. A quote may only open a field
+		// or follow a closing quote ( "" escapes a quote ), every other quote is in the middle of a field
+		const u64 opening = quotes & inside;
+		const u64 closing = quotes & ~inside;
+		const u64 unexpected = opening & ~( ( ( structural | closing ) << 1U ) | m_uiQuoteAllowed );
+		if( unexpected != 0U )
+		{
+			SetPendingError( CsvError::UnexpectedQuote, offset + simd::LowestBit64( unexpected ) );
+		}
+		// The second quote of an escaped "" reopens the quoted region, but does not start a field
+		const u64 fieldOpening = opening & ~( ( closing << 1U ) | m_uiClosingQuote );
+		if( fieldOpening != 0U )
+		{
+			u32 high = static_cast< u32 >( fieldOpening >> 32U );
+			m_uiOpeningQuote = offset + ( high != 0U ? 32U + simd::HighestBit( high ) : simd::HighestBit( static_cast< u32 >( fieldOpening ) ) );
+		}
+		m_uiInsideQuotes = static_cast< u64 >( 0U ) - ( inside >> 63U );
+		m_uiQuoteAllowed = ( structural | closing ) >> 63U;
+		m_uiClosingQuote = closing >> 63U;
+		m_uiStructural = structural;
+		m_uiBlockOffset = offset;
+		m_uiNextBlock = offset + size;
+
+		// The bytes are validated a few blocks ahead, the validation loop is only efficient on longer runs
+		const u32 blockEnd = offset + size;
+		if( m_uiValidEnd < blockEnd )
+		{
+			const u32 validateEnd = m_uiSize - blockEnd < ValidateAhead ? m_uiSize : blockEnd + ValidateAhead;
+			m_uiValidEnd += StringType::ValidPrefix( m_pData + m_uiValidEnd, validateEnd - m_uiValidEnd );
+			// A char cut by the end of the validated bytes is validated again with the next bytes
+			if( m_uiValidEnd < validateEnd && ( validateEnd == m_uiSize || validateEnd - m_uiValidEnd >= 4U ) )
+			{
+				SetPendingError( CsvError::InvalidUtf8, m_uiValidEnd );
+				m_uiValidEnd = m_uiSize;
+			}
+		}
+		if( blockEnd == m_uiSize && m_uiInsideQuotes != 0U )
+		{
+			SetPendingError( CsvError::UnterminatedQuote, m_uiOpeningQuote );
+		}
+	}
+
+	template< typename StringType, typename Allocator >
+	bool CsvReader< StringType, Allocator >::AddField( u32 begin, u32 end )
+	{
+		if( end < m_uiSize && m_pData[ end ] == '\n' && end > begin && m_pData[ end - 1U ] == '\r' )
+		{
+			--end;
+		}
+
+		FieldEntry field;
+		field.Offset = begin;
+		field.Size = end - begin;
+		field.Unescaped = false;
+		bool valid = true;
+		// A quote in an unquoted field was already reported by ClassifyBlock(), so only quoted fields are unescaped
+		bool quoted = end > begin && static_cast< unsigned char >( m_pData[ begin ] ) == m_Quote;
+		if( quoted )
+		{
+			u32 last = end - 1U;
+			if( last == begin || static_cast< unsigned char >( m_pData[ last ] ) != m_Quote )
+			{
+				// Text behind the closing quote
+				while( last > begin && static_cast< unsigned char >( m_pData[ last ] ) != m_Quote )
+				{
+					--last;
+				}
+				SetPendingError( CsvError::UnexpectedQuote, last + 1U );
+				valid = false;
+			}
+			else
+			{
+				field.Offset = begin + 1U;
+				field.Size = end - begin - 2U;
+			}
+		}
+		if( quoted && valid && field.Size != 0U && std::memchr( m_pData + field.Offset, m_Quote, field.Size ) != nullptr )
+		{
+			// Escaped quotes are unescaped into the arena, the unescaped field is never longer
+			if( m_uiArenaSize + field.Size > m_uiArenaCapacity )
+			{
+				u32 capacity = m_uiArenaCapacity * 2U > m_uiArenaSize + field.Size ? m_uiArenaCapacity * 2U : m_uiArenaSize + field.Size + 256U;
+				DataType* arena = static_cast< DataType* >( m_Alloc.AllocateBytes( capacity * sizeof( DataType ) ) );
+				if( m_pArena != nullptr )
+				{
+					std::memcpy( arena, m_pArena, m_uiArenaSize * sizeof( DataType ) );
+					m_Alloc.FreeBytes( m_pArena );
+				}
+				m_pArena = arena;
+				m_uiArenaCapacity = capacity;
+			}
+			ConstPointer src = m_pData + field.Offset;
+			ConstPointer srcEnd = src + field.Size;
+			DataType* dst = m_pArena + m_uiArenaSize;
+			while( src < srcEnd )
+			{
+				// Copy up to and including the next quote and skip the quote escaping it
+				const void* quote = std::memchr( src, m_Quote, static_cast< size_t >( srcEnd - src ) );
+				ConstPointer runEnd = quote != nullptr ? static_cast< ConstPointer >( quote ) + 1 : srcEnd;
+				std::memcpy( dst, src, static_cast< size_t >( runEnd - src ) * sizeof( DataType ) );
+				dst += runEnd - src;
+				src = runEnd;
+				if( quote != nullptr && src < srcEnd && static_cast< unsigned char >( *src ) == m_Quote )
+				{
+					++src;
+				}
+			}
+			field.Offset = m_uiArenaSize;
+			field.Size = static_cast< u32 >( dst - ( m_pArena + m_uiArenaSize ) );
+			field.Unescaped = true;
+			m_uiArenaSize += field.Size;
+		}
+
+		if( m_uiFieldCount == m_uiFieldCapacity )
+		{
+			u32 capacity = m_uiFieldCapacity != 0U ? m_uiFieldCapacity * 2U : 16U;
+			FieldEntry* fields = static_cast< FieldEntry* >( m_Alloc.AllocateBytes( capacity * sizeof( FieldEntry ) ) );
+			if( m_pFields != nullptr )
+			{
+				std::memcpy( fields, m_pFields, m_uiFieldCount * sizeof( FieldEntry ) );
+				m_Alloc.FreeBytes( m_pFields );
+			}
+			m_pFields = fields;
+			m_uiFieldCapacity = capacity;
+		}
+		m_pFields[ m_uiFieldCount++ ] = field;
+		return valid;
+	}
+
+	template< typename StringType, typename Allocator >
+	void CsvReader< StringType, Allocator >::SetPendingError( CsvError error, u32 offset )
+	{
+		if( offset < m_uiPendingOffset )
+		{
+			m_ePendingError = error;
+			m_uiPendingOffset = offset;
+		}
+	}
+
+	template< typename StringType, typename Allocator >
+	void CsvReader< StringType, Allocator >::Fail( CsvError error, u32 offset )
+	{
+		m_eError = error;
+		m_uiErrorOffset = offset;
+		m_uiFieldCount = 0U;
+		m_uiArenaSize = 0U;
+		m_uiPos = m_uiSize;
+	}
+}
+
+#endif // utiCsvReader_inl__
@@ -0,0 +1,167 @@
+#pragma once
+#ifndef utiCursor_h__
+#define utiCursor_h__
+
+namespace uti
+{
+	template< typename StringType >
+	class ConstCharCursor;
+
+	/**
+	\brief Lightweight view on a range of units of a generic String, represented by a begin and an end pointer.
+
+	Unlike the iterators the span does not reference the string object, so the pointers can be kept in registers
+	and loops over the span can be vectorized. The span does not hold a reference to the data,
+	so it is only valid as long as the string it was created from is alive.
+
+	The span can be used directly in range based for loops, iterating over every unit ( e.g. 1 Byte in UTF-8 and 2 bytes in UTF-16 ).
+
+	\tparam StringType The underlying String class type, whose data is viewed.
+	*/
+	template< typename StringType >
+	class ByteSpan
+	{
+	public:
+
+		typedef typename StringType::Type DataType;
+		typedef const DataType* ConstPointer;
+
+		/**
+		\brief Creates an empty span.
+		*/
+		ByteSpan( void );
+
+		/**
+		\brief Creates a span over the units from \c begin up to but not including \c end.
+
+		\param isAscii \c true if every unit in the range is known to be an ASCII char.
+		*/
+		ByteSpan( ConstPointer begin, ConstPointer end, bool isAscii = false );
+
+		ConstPointer begin( void ) const;
+		ConstPointer end( void ) const;
+
+		/**
+		\brief Returns the number of units in the span.
+		*/
+		u32 Size( void ) const;
+
+		bool Empty( void ) const;
+
+		/**
+		\brief Returns if the span is known to only contain ASCII chars.
+		A \c false result does not mean there is any non ASCII char in the span.
+		*/
+		bool IsAscii( void ) const;
+
+		/**
+		\brief Returns a span over \c count units starting \c offset units after the start of this span.
+
+		The ASCII flag is passed on to the sub span.
+		*/
+		ByteSpan< StringType > SubSpan( u32 offset, u32 count ) const;
+
+		/**
+		\brief Returns a cursor over every char of the span.
+		*/
+		ConstCharCursor< StringType > Chars( void ) const;
+
+		/**
+		\brief Returns if this span and \c rhs view the same bytes, ignoring the case of ASCII letters.
+
+		Only available for utf-8 strings, bytes of non ASCII chars have to match exactly.
+		*/
+		bool EqualsIgnoreAsciiCase( const ByteSpan< StringType >& rhs ) const;
+
+		/**
+		\brief Compares the bytes of this span and \c rhs with ASCII letters folded to lower case, in code point order otherwise.
+
+		\return A value less than, equal to or greater than zero if this span is ordered before, equal to or after \c rhs.
+		*/
+		s32 CompareIgnoreAsciiCase( const ByteSpan< StringType >& rhs ) const;
+
+		/**
+		\brief Returns the hash of the viewed bytes ignoring the case of ASCII letters ( see HashBytesIgnoreAsciiCase() ).
+		*/
+		u64 HashIgnoreAsciiCase( void ) const;
+
+	protected:
+	private:
+
+		ConstPointer m_pBegin;
+		ConstPointer m_pEnd;
+		bool m_bAscii;
+	};
+
+	/**
+	\brief Cursor which iterates over every char (code point) of a generic String, represented by a position and an end pointer.
+
+	Dereferencing the cursor decodes the code point in place. A cursor created by a string holds a reference to its data,
+	so it stays valid after the string is destroyed. The cursor is its own range,
+	so it can be used directly in range based for loops:
+
+	\code
+	for( u32 codePoint : string.Chars() )
+	\endcode
+
+	\tparam StringType The underlying String class type, whose chars are visited.
+	*/
+	template< typename StringType >
+	class ConstCharCursor
+	{
+	public:
+
+		typedef typename StringType::Type DataType;
+		typedef const DataType* ConstPointer;
+		typedef typename StringType::DataType BufferType;
+
+		/**
+		\brief Creates a cursor on the char starting at \c pos, which iterates until \c end.
+
+		\param isAscii \c true if every unit up to \c end is known to be an ASCII char.
+		*/
+		ConstCharCursor( ConstPointer pos, ConstPointer end, bool isAscii = false );
+
+		/**
+		\brief Creates a cursor like above, which holds a reference to \c buffer, the data \c pos and \c end point into.
+		*/
+		ConstCharCursor( const BufferType& buffer, ConstPointer pos, ConstPointer end, bool isAscii = false );
+
+		/**
+		\brief Returns the code point of the current char.
+		*/
+		u32 operator *( void ) const;
+
+		/**
+		\brief Returns the address of the current char.
+		*/
+		ConstPointer Pointer( void ) const;
+
+		/**
+		\brief Returns the size (in units) of the current char.
+		*/
+		u32 CharSize( void ) const;
+
+		bool Valid( void ) const;
+
+		bool operator ==( const ConstCharCursor< StringType >& rhs ) const;
+		bool operator !=( const ConstCharCursor< StringType >& rhs ) const;
+
+		ConstCharCursor< StringType >& operator ++( void );
+		ConstCharCursor< StringType > operator ++( int );
+
+		ConstCharCursor< StringType > begin( void ) const;
+		ConstCharCursor< StringType > end( void ) const;
+
+	protected:
+	private:
+
+		ConstPointer m_pPos;
+		ConstPointer m_pEnd;
+		bool m_bAscii;
+		// Keeps the data alive, empty if the cursor was not created by a string
+		BufferType m_Buffer;
+	};
+}
+
+#endif // utiCursor_h__
@@ -0,0 +1,197 @@
+#pragma once
+#ifndef utiCursor_inl__
+#define utiCursor_inl__
+
+namespace uti
+{
+	//////////////////////////////////////////////////////////////////////////
+	// Byte Span implementation
+	//////////////////////////////////////////////////////////////////////////
+
+	template< typename StringType >
+	ByteSpan< StringType >::ByteSpan( void ) :
+		m_pBegin( nullptr ),
+		m_pEnd( nullptr ),
+		m_bAscii( true )
+	{
+	}
+
+	template< typename StringType >
+	ByteSpan< StringType >::ByteSpan( ConstPointer begin, ConstPointer end, bool isAscii /*= false */ ) :
+		m_pBegin( begin ),
+		m_pEnd( end ),
+		m_bAscii( isAscii )
+	{
+		UTI_ASSERT( begin <= end );
+	}
+
+	template< typename StringType >
+	typename ByteSpan< StringType >::ConstPointer ByteSpan< StringType >::begin( void ) const
+	{
+		return m_pBegin;
+	}
+
+	template< typename StringType >
+	typename ByteSpan< StringType >::ConstPointer ByteSpan< StringType >::end( void ) const
+	{
+		return m_pEnd;
+	}
+
+	template< typename StringType >
+	u32 ByteSpan< StringType >::Size( void ) const
+	{
+		return static_cast< u32 >( m_pEnd - m_pBegin );
+	}
+
+	template< typename StringType >
+	bool ByteSpan< StringType >::Empty( void ) const
+	{
+		return m_pBegin == m_pEnd;
+	}
+
+	template< typename StringType >
+	bool ByteSpan< StringType >::IsAscii( void ) const
+	{
+		return m_bAscii;
+	}
+
+	template< typename StringType >
+	ByteSpan< StringType > ByteSpan< StringType >::SubSpan( u32 offset, u32 count ) const
+	{
+		UTI_ASSERT( offset + count <= Size() );
+		return ByteSpan< StringType >( m_pBegin + offset, m_pBegin + offset + count, m_bAscii );
+	}
+
+	template< typename StringType >
+	ConstCharCursor< StringType > ByteSpan< StringType >::Chars( void ) const
+	{
+		return ConstCharCursor< StringType >( m_pBegin, m_pEnd, m_bAscii );
+	}
+
+	template< typename StringType >
+	bool ByteSpan< StringType >::EqualsIgnoreAsciiCase( const ByteSpan< StringType >& rhs ) const
+	{
+		static_assert( sizeof( DataType ) == 1U, "ASCII case folding is only defined for utf-8 bytes" );
+		u32 size = Size();
+		return size == rhs.Size() && simd::MismatchIgnoreAsciiCase( m_pBegin, rhs.m_pBegin, size ) == size;
+	}
+
+	template< typename StringType >
+	s32 ByteSpan< StringType >::CompareIgnoreAsciiCase( const ByteSpan< StringType >& rhs ) const
+	{
+		static_assert( sizeof( DataType ) == 1U, "ASCII case folding is only defined for utf-8 bytes" );
+		u32 lhsSize = Size();
+		u32 rhsSize = rhs.Size();
+		u32 common = lhsSize < rhsSize ? lhsSize : rhsSize;
+		u32 mismatch = simd::MismatchIgnoreAsciiCase( m_pBegin, rhs.m_pBegin, common );
+		if( mismatch < common )
+		{
+			return static_cast< s32 >( simd::FoldAsciiCase( static_cast< unsigned char >( m_pBegin[ mismatch ] ) ) ) -
+				static_cast< s32 >( simd::FoldAsciiCase( static_cast< unsigned char >( rhs.m_pBegin[ mismatch ] ) ) );
+		}
+		return lhsSize < rhsSize ? -1 : ( lhsSize > rhsSize ? 1 : 0 );
+	}
+
+	template< typename StringType >
+	u64 ByteSpan< StringType >::HashIgnoreAsciiCase( void ) const
+	{
+		static_assert( sizeof( DataType ) == 1U, "ASCII case folding is only defined for utf-8 bytes" );
+		return HashBytesIgnoreAsciiCase( m_pBegin, Size() );
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Const Char Cursor implementation
+	//////////////////////////////////////////////////////////////////////////
+
+	template< typename StringType >
+	ConstCharCursor< StringType >::ConstCharCursor( ConstPointer pos, ConstPointer end, bool isAscii /*= false */ ) :
+		m_pPos( pos ),
+		m_pEnd( end ),
+		m_bAscii( isAscii )
+	{
+		UTI_ASSERT( pos <= end );
+	}
+
+	template< typename StringType >
+	ConstCharCursor< StringType >::ConstCharCursor( const BufferType& buffer, ConstPointer pos, ConstPointer end, bool isAscii /*= false */ ) :
+		m_pPos( pos ),
+		m_pEnd( end ),
+		m_bAscii( isAscii ),
+		m_Buffer( buffer )
+	{
+		UTI_ASSERT( pos <= end );
+	}
+
+	template< typename StringType >
+	u32 ConstCharCursor< StringType >::operator*( void ) const
+	{
+		UTI_ASSERT( Valid() );
+		return StringType::ExtractCodePoint( m_pPos );
+	}
+
+	template< typename StringType >
+	typename ConstCharCursor< StringType >::ConstPointer ConstCharCursor< StringType >::Pointer( void ) const
+	{
+		return m_pPos;
+	}
+
+	template< typename StringType >
+	u32 ConstCharCursor< StringType >::CharSize( void ) const
+	{
+		if( m_bAscii )
+		{
+			return 1U;
+		}
+		u32 size = StringType::CharSize( m_pPos );
+		// Never get stuck on an invalid unit
+		return size != 0U ? size : 1U;
+	}
+
+	template< typename StringType >
+	bool ConstCharCursor< StringType >::Valid( void ) const
+	{
+		return m_pPos < m_pEnd;
+	}
+
+	template< typename StringType >
+	bool ConstCharCursor< StringType >::operator==( const ConstCharCursor< StringType >& rhs ) const
+	{
+		return m_pPos == rhs.m_pPos;
+	}
+
+	template< typename StringType >
+	bool ConstCharCursor< StringType >::operator!=( const ConstCharCursor< StringType >& rhs ) const
+	{
+		return m_pPos != rhs.m_pPos;
+	}
+
+	template< typename StringType >
+	ConstCharCursor< StringType >& ConstCharCursor< StringType >::operator++( void )
+	{
+		UTI_ASSERT( Valid() );
+		m_pPos += CharSize();
+		return *this;
+	}
+
+	template< typename StringType >
+	ConstCharCursor< StringType > ConstCharCursor< StringType >::operator++( int )
+	{
+		ConstCharCursor< StringType > copy( *this );
+		++*this;
+		return copy;
+	}
+
+	template< typename StringType >
+	ConstCharCursor< StringType > ConstCharCursor< StringType >::begin( void ) const
+	{
+		return *this;
+	}
+
+	template< typename StringType >
+	ConstCharCursor< StringType > ConstCharCursor< StringType >::end( void ) const
+	{
+		return ConstCharCursor< StringType >( m_pEnd, m_pEnd, m_bAscii );
+	}
+}
+
+#endif // utiCursor_inl__
@@ -0,0 +1,104 @@
+#pragma once
+#ifndef utiEpoch_h__
+#define utiEpoch_h__
+
+namespace uti
+{
+	/**
+	\brief Base of every object which is reclaimed through Epoch::Retire().
+
+	The links are stored in the object itself, so retiring never allocates.
+	*/
+	struct EpochRetired
+	{
+		/**
+		\brief Called once no reader can reach the object anymore, has to destroy and free the object.
+		*/
+		void( *Reclaim )( EpochRetired* object );
+
+		EpochRetired* pNextRetired;
+		u64 RetireEpoch;
+	};
+
+	/**
+	\brief Epoch based reclamation for lock-free data structures.
+
+	Readers enter the epoch ( see EpochGuard ) while they hold raw pointers into a shared structure.
+	Writers unlink objects from the structure and Retire() them instead of freeing them directly.
+	Reclaim() frees every retired object, which was retired before the oldest epoch a reader is still in,
+	so no reader can still hold a pointer to it.
+
+	Entering and leaving an epoch only touches a record owned by the calling thread, so readers never contend.
+	Every thread which ever entered an epoch keeps its record for the lifetime of the program.
+	*/
+	class Epoch
+	{
+	public:
+
+		/**
+		\brief Marks the calling thread as reader, calls may be nested.
+		*/
+		static inline void Enter( void );
+
+		/**
+		\brief Leaves the epoch entered by the matching Enter() call.
+		*/
+		static inline void Exit( void );
+
+		/**
+		\brief Hands an object, which is no longer reachable from the shared structure, over to the reclamation.
+		*/
+		static inline void Retire( EpochRetired* object );
+
+		/**
+		\brief Advances the epoch and reclaims every retired object no reader can reach anymore.
+
+		\return The number of reclaimed objects.
+		*/
+		static inline u32 Reclaim( void );
+
+	protected:
+	private:
+
+		struct Record
+		{
+			std::atomic< u64 > LocalEpoch;
+			u32 Depth;
+			Record* pNext;
+		};
+
+		/**
+		\brief Holds the shared state, the template makes it possible to define the static members in the header.
+		*/
+		template< typename Dummy = void >
+		struct State
+		{
+			static std::atomic< u64 > s_GlobalEpoch;
+			static std::atomic< Record* > s_pRecords;
+			static std::mutex s_RetireMutex;
+			static EpochRetired* s_pRetired;
+			static UTI_THREAD_LOCAL Record* s_pThreadRecord;
+		};
+
+		static inline Record* ThreadRecord( void );
+	};
+
+	/**
+	\brief Enters the epoch for the lifetime of the guard.
+	*/
+	class EpochGuard
+	{
+	public:
+
+		EpochGuard( void );
+		~EpochGuard();
+
+	protected:
+	private:
+
+		EpochGuard( const EpochGuard& );
+		EpochGuard& operator =( const EpochGuard& );
+	};
+}
+
+#endif // utiEpoch_h__
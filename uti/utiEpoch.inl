@@ -0,0 +1,127 @@
+#pragma once
+#ifndef utiEpoch_inl__
+#define utiEpoch_inl__
+
+namespace uti
+{
+	//////////////////////////////////////////////////////////////////////////
+	// Epoch implementation
+	//////////////////////////////////////////////////////////////////////////
+
+	// The epoch starts at one, a local epoch of zero marks a thread which is not reading
+	template< typename Dummy >
+	std::atomic< u64 > Epoch::State< Dummy >::s_GlobalEpoch( 1U );
+
+	template< typename Dummy >
+	std::atomic< Epoch::Record* > Epoch::State< Dummy >::s_pRecords( nullptr );
+
+	template< typename Dummy >
+	std::mutex Epoch::State< Dummy >::s_RetireMutex;
+
+	template< typename Dummy >
+	EpochRetired* Epoch::State< Dummy >::s_pRetired = nullptr;
+
+	template< typename Dummy >
+	UTI_THREAD_LOCAL Epoch::Record* Epoch::State< Dummy >::s_pThreadRecord = nullptr;
+
+	void Epoch::Enter( void )
+	{
+		Record* record = ThreadRecord();
+		if( record->Depth++ == 0U )
+		{
+			// Sequentially consistent, so every following read of the structure is ordered after the announcement
+			record->LocalEpoch.store( State<>::s_GlobalEpoch.load( std::memory_order_seq_cst ), std::memory_order_seq_cst );
+		}
+	}
+
+	void Epoch::Exit( void )
+	{
+		Record* record = ThreadRecord();
+		UTI_ASSERT( record->Depth > 0U );
+		if( --record->Depth == 0U )
+		{
+			record->LocalEpoch.store( 0U, std::memory_order_release );
+		}
+	}
+
+	void Epoch::Retire( EpochRetired* object )
+	{
+		UTI_ASSERT( object != nullptr && object->Reclaim != nullptr );
+		object->RetireEpoch = State<>::s_GlobalEpoch.load( std::memory_order_seq_cst );
+
+		std::lock_guard< std::mutex > lock( State<>::s_RetireMutex );
+		object->pNextRetired = State<>::s_pRetired;
+		State<>::s_pRetired = object;
+	}
+
+	u32 Epoch::Reclaim( void )
+	{
+		std::lock_guard< std::mutex > lock( State<>::s_RetireMutex );
+		State<>::s_GlobalEpoch.fetch_add( 1U, std::memory_order_seq_cst );
+
+		// Readers which entered in an epoch after an object was retired can not have seen it
+		u64 oldestEpoch = ~0ULL;
+		for( Record* record = State<>::s_pRecords.load( std::memory_order_acquire ); record != nullptr; record = record->pNext )
+		{
+			u64 localEpoch = record->LocalEpoch.load( std::memory_order_seq_cst );
+			if( localEpoch != 0U && localEpoch < oldestEpoch )
+			{
+				oldestEpoch = localEpoch;
+			}
+		}
+
+		u32 reclaimed = 0U;
+		EpochRetired** link = &State<>::s_pRetired;
+		while( *link != nullptr )
+		{
+			EpochRetired* object = *link;
+			if( object->RetireEpoch < oldestEpoch )
+			{
+				*link = object->pNextRetired;
+				object->Reclaim( object );
+				++reclaimed;
+			}
+			else
+			{
+				link = &object->pNextRetired;
+			}
+		}
+		return reclaimed;
+	}
+
+	Epoch::Record* Epoch::ThreadRecord( void )
+	{
+		Record* record = State<>::s_pThreadRecord;
+		if( record == nullptr )
+		{
+			record = new Record();
+			record->LocalEpoch.store( 0U, std::memory_order_relaxed );
+			record->Depth = 0U;
+
+			Record* head = State<>::s_pRecords.load( std::memory_order_relaxed );
+			do
+			{
+				record->pNext = head;
+			} while( !State<>::s_pRecords.compare_exchange_weak( head, record, std::memory_order_release, std::memory_order_relaxed ) );
+
+			State<>::s_pThreadRecord = record;
+		}
+		return record;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Epoch Guard implementation
+	//////////////////////////////////////////////////////////////////////////
+
+	inline EpochGuard::EpochGuard( void )
+	{
+		Epoch::Enter();
+	}
+
+	inline EpochGuard::~EpochGuard()
+	{
+		Epoch::Exit();
+	}
+}
+
+#endif // utiEpoch_inl__
@@ -0,0 +1,44 @@
+#pragma once
+#ifndef utiHash_h__
+#define utiHash_h__
+
+namespace uti
+{
+	/**
+	\brief Seed used by the Hash() functions of the strings, whose results are cached.
+	*/
+	static const u64 DefaultHashSeed = 0x9E3779B97F4A7C15ULL;
+
+	/**
+	\brief Calculates a seeded 64 bit hash of the \c size bytes starting at \c data.
+
+	The hash follows the construction of wyhash: the data is consumed in 48 byte steps by three independent
+	64x64 -> 128 bit multiply lanes, so the multiplies of one step run in parallel and no byte is touched twice.
+	Inputs up to 16 bytes are read with a few overlapping loads and need no loop at all.
+
+	The result only depends on the bytes, the size and the seed, so it is stable between runs and platforms:
+	words are read in little endian order, big endian targets swap them after loading.
+	*/
+	inline u64 HashBytes( const void* data, u32 size, u64 seed = DefaultHashSeed );
+
+	/**
+	\brief Calculates the hash of the \c size bytes starting at \c data, ignoring the case of ASCII letters.
+
+	Every 8 byte word is folded to lower case while it is read ( see simd::FoldAsciiCase8() ), no folded copy is made.
+	The result is the HashBytes() of the folded bytes, so it is equal for every input which only differs in the case of ASCII letters.
+	*/
+	inline u64 HashBytesIgnoreAsciiCase( const void* data, u32 size, u64 seed = DefaultHashSeed );
+
+	/**
+	\brief Slots of the values cached in the shared header of a ReferenceCounted buffer.
+	*/
+	enum class HashCacheSlot
+	{
+		Hash = 0,
+		CodePointHash = 1,
+		HashIgnoreAsciiCase = 2,
+		Count = 3
+	};
+}
+
+#endif // utiHash_h__
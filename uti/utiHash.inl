@@ -0,0 +1,199 @@
+#pragma once
+#ifndef utiHash_inl__
+#define utiHash_inl__
+
+namespace uti
+{
+	namespace detail
+	{
+		static const u64 HashSecret[ 4 ] =
+		{
+			0x2D358DCCAA6C78A5ULL, 0x8BB84B93962EACC9ULL, 0x4B33A62ED433D4A3ULL, 0x4D5A2DA51DE1AA47ULL
+		};
+
+		/**
+		\brief Multiplies \c lhs and \c rhs to a 128 bit result and stores the low half in \c lhs and the high half in \c rhs.
+		*/
+		inline void HashMultiply( u64& lhs, u64& rhs )
+		{
+#if defined( _MSC_VER ) && defined( _M_X64 )
+			u64 high;
+			lhs = _umul128( lhs, rhs, &high );
+			rhs = high;
+#elif defined( __SIZEOF_INT128__ )
+			unsigned __int128 result = static_cast< unsigned __int128 >( lhs ) * rhs;
+			lhs = static_cast< u64 >( result );
+			rhs = static_cast< u64 >( result >> 64U );
+#else
+			u64 lhsHigh = lhs >> 32U;
+			u64 lhsLow = lhs & 0xFFFFFFFFULL;
+			u64 rhsHigh = rhs >> 32U;
+			u64 rhsLow = rhs & 0xFFFFFFFFULL;
+			u64 highHigh = lhsHigh * rhsHigh;
+			u64 highLow = lhsHigh * rhsLow;
+			u64 lowHigh = lhsLow * rhsHigh;
+			u64 lowLow = lhsLow * rhsLow;
+			u64 cross = ( lowLow >> 32U ) + ( highLow & 0xFFFFFFFFULL ) + lowHigh;
+			lhs = ( cross << 32U ) | ( lowLow & 0xFFFFFFFFULL );
+			rhs = highHigh + ( highLow >> 32U ) + ( cross >> 32U );
+#endif // _MSC_VER
+		}
+
+		inline u64 HashMix( u64 lhs, u64 rhs )
+		{
+			HashMultiply( lhs, rhs );
+			return lhs ^ rhs;
+		}
+
+		/**
+		\brief Reads 8 bytes as a little endian word, so the hash does not depend on the byte order of the platform.
+		*/
+		inline u64 HashRead8( const unsigned char* bytes )
+		{
+			u64 value;
+			std::memcpy( &value, bytes, sizeof( value ) );
+#if defined( __BYTE_ORDER__ ) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+			value = __builtin_bswap64( value );
+#endif // __BYTE_ORDER__
+			return value;
+		}
+
+		inline u64 HashRead4( const unsigned char* bytes )
+		{
+			u32 value;
+			std::memcpy( &value, bytes, sizeof( value ) );
+#if defined( __BYTE_ORDER__ ) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+			value = __builtin_bswap32( value );
+#endif // __BYTE_ORDER__
+			return value;
+		}
+
+		inline u64 HashRead3( const unsigned char* bytes, u32 size )
+		{
+			return ( static_cast< u64 >( bytes[ 0 ] ) << 16U ) | ( static_cast< u64 >( bytes[ size >> 1U ] ) << 8U ) | bytes[ size - 1U ];
+		}
+
+		/**
+		\brief Reads the hashed bytes as they are.
+		*/
+		struct HashReader
+		{
+			static u64 Read8( const unsigned char* bytes )
+			{
+				return HashRead8( bytes );
+			}
+
+			static u64 Read4( const unsigned char* bytes )
+			{
+				return HashRead4( bytes );
+			}
+
+			static u64 Read3( const unsigned char* bytes, u32 size )
+			{
+				return HashRead3( bytes, size );
+			}
+		};
+
+		/**
+		\brief Reads the hashed bytes with ASCII letters folded to lower case.
+		*/
+		struct FoldingHashReader
+		{
+			static u64 Read8( const unsigned char* bytes )
+			{
+				return simd::FoldAsciiCase8( HashRead8( bytes ) );
+			}
+
+			static u64 Read4( const unsigned char* bytes )
+			{
+				// The upper 4 bytes are zero and stay zero
+				return simd::FoldAsciiCase8( HashRead4( bytes ) );
+			}
+
+			static u64 Read3( const unsigned char* bytes, u32 size )
+			{
+				return ( static_cast< u64 >( simd::FoldAsciiCase( bytes[ 0 ] ) ) << 16U ) |
+					( static_cast< u64 >( simd::FoldAsciiCase( bytes[ size >> 1U ] ) ) << 8U ) | simd::FoldAsciiCase( bytes[ size - 1U ] );
+			}
+		};
+
+		/**
+		\brief Implementation of HashBytes(), every byte is read through \c Reader.
+		*/
+		template< typename Reader >
+		u64 HashBytesWith( const void* data, u32 size, u64 seed );
+	}
+
+	u64 HashBytes( const void* data, u32 size, u64 seed /*= DefaultHashSeed */ )
+	{
+		return detail::HashBytesWith< detail::HashReader >( data, size, seed );
+	}
+
+	u64 HashBytesIgnoreAsciiCase( const void* data, u32 size, u64 seed /*= DefaultHashSeed */ )
+	{
+		return detail::HashBytesWith< detail::FoldingHashReader >( data, size, seed );
+	}
+
+	template< typename Reader >
+	u64 detail::HashBytesWith( const void* data, u32 size, u64 seed )
+	{
+		const unsigned char* bytes = static_cast< const unsigned char* >( data );
+		seed ^= HashMix( seed ^ HashSecret[ 0 ], HashSecret[ 1 ] );
+		u64 a;
+		u64 b;
+		if( size <= 16U )
+		{
+			if( size >= 4U )
+			{
+				// Two overlapping pairs of 4 byte loads cover every size from 4 to 16 bytes
+				u32 offset = ( size >> 3U ) << 2U;
+				a = ( Reader::Read4( bytes ) << 32U ) | Reader::Read4( bytes + offset );
+				b = ( Reader::Read4( bytes + size - 4U ) << 32U ) | Reader::Read4( bytes + size - 4U - offset );
+			}
+			else if( size > 0U )
+			{
+				a = Reader::Read3( bytes, size );
+				b = 0U;
+			}
+			else
+			{
+				a = 0U;
+				b = 0U;
+			}
+		}
+		else
+		{
+			u32 remaining = size;
+			if( remaining > 48U )
+			{
+				u64 lane1 = seed;
+				u64 lane2 = seed;
+				do
+				{
+					seed = HashMix( Reader::Read8( bytes ) ^ HashSecret[ 1 ], Reader::Read8( bytes + 8U ) ^ seed );
+					lane1 = HashMix( Reader::Read8( bytes + 16U ) ^ HashSecret[ 2 ], Reader::Read8( bytes + 24U ) ^ lane1 );
+					lane2 = HashMix( Reader::Read8( bytes + 32U ) ^ HashSecret[ 3 ], Reader::Read8( bytes + 40U ) ^ lane2 );
+					bytes += 48U;
+					remaining -= 48U;
+				} while( remaining > 48U );
+				seed ^= lane1 ^ lane2;
+			}
+			while( remaining > 16U )
+			{
+				seed = HashMix( Reader::Read8( bytes ) ^ HashSecret[ 1 ], Reader::Read8( bytes + 8U ) ^ seed );
+				bytes += 16U;
+				remaining -= 16U;
+			}
+			// The last 16 bytes are always read in full, overlapping the already consumed data if needed
+			a = Reader::Read8( bytes + remaining - 16U );
+			b = Reader::Read8( bytes + remaining - 8U );
+		}
+
+		a ^= HashSecret[ 1 ];
+		b ^= seed;
+		HashMultiply( a, b );
+		return HashMix( a ^ HashSecret[ 0 ] ^ size, b ^ HashSecret[ 1 ] );
+	}
+}
+
+#endif // utiHash_inl__
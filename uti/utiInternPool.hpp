@@ -0,0 +1,170 @@
+#pragma once
+#ifndef utiInternPool_h__
+#define utiInternPool_h__
+
+namespace uti
+{
+	/**
+	\brief Pool mapping string contents to a single canonical string, which shares its data with every string interned for the same content.
+
+	Interning collapses duplicate values ( field names, country codes, ... ) to one buffer and one reference counter.
+	Two strings interned in the same pool are equal exactly if they share their data, which can be checked in O(1) with SharesData().
+
+	The pool is an open addressing table with linear probing, which stores the cached hash and the size of every string
+	next to it, so probing only touches the string data of entries whose hash and size match.
+	The pool holds a reference to every interned string, Purge() releases the strings which are not referenced anywhere else.
+
+	The pool is not thread safe.
+
+	\tparam StringType The interned string type, e.g. UTF8String<> or UTF16String<>.
+	\tparam Allocator Is the class used to allocate the table of the pool.
+	*/
+	template< typename StringType, typename Allocator = typename StringType::AllocatorType >
+	class InternPool
+	{
+	public:
+
+		typedef typename StringType::Type DataType;
+		typedef InternPool< StringType, Allocator > ThisType;
+
+		/**
+		\brief Creates an empty pool, the table is allocated with the first interned string.
+		*/
+		InternPool( void );
+
+		~InternPool();
+
+		/**
+		\brief Returns the canonical string for the content of \c string.
+
+		If the content was not interned yet, \c string itself becomes the canonical string, so no data is copied.
+		*/
+		StringType Intern( const StringType& string );
+
+		/**
+		\brief Returns the canonical string for the zero terminated \c text.
+
+		A string is only created if the content was not interned yet.
+		*/
+		StringType Intern( const DataType* text );
+
+		/**
+		\brief Returns the canonical string for the \c size units starting at \c data or \c nullptr if it was not interned yet.
+		*/
+		const StringType* Find( const DataType* data, u32 size ) const;
+
+		/**
+		\brief Returns the number of interned strings.
+		*/
+		u32 Size( void ) const;
+
+		/**
+		\brief Removes every string which is only referenced by the pool.
+
+		\return The number of removed strings.
+		*/
+		u32 Purge( void );
+
+		/**
+		\brief Removes every string from the pool, strings still referenced elsewhere stay valid.
+		*/
+		void Clear( void );
+
+		/**
+		\brief Returns the pool shared by the whole program.
+
+		The pool itself is not thread safe, threads using it concurrently have to hold GlobalMutex() while they do, as Intern() does.
+		*/
+		static ThisType& Global( void );
+
+		/**
+		\brief Returns the mutex serializing the use of the Global() pool.
+		*/
+		static std::mutex& GlobalMutex( void );
+
+		/**
+		\brief Returns the pool of the innermost ScopedInternPool alive on the calling thread or the Global() pool if there is none.
+		*/
+		static ThisType& Current( void );
+
+	protected:
+	private:
+
+		template< typename PoolType >
+		friend class ScopedInternPool;
+
+		struct Entry
+		{
+			u64 Hash;
+			u32 Size;
+			u32 Occupied;
+			typename std::aligned_storage< sizeof( StringType ), std::alignment_of< StringType >::value >::type Storage;
+
+			StringType& String( void )
+			{
+				return *reinterpret_cast< StringType* >( &Storage );
+			}
+		};
+
+		InternPool( const ThisType& );
+		ThisType& operator =( const ThisType& );
+
+		/**
+		\brief Returns the entry holding the given content or the empty entry where it has to be inserted.
+		*/
+		Entry* Probe( u64 hash, const DataType* data, u32 size ) const;
+
+		Entry* Insert( Entry* entry, u64 hash, const StringType& string );
+
+		void Rehash( u32 capacity );
+
+		static u32 Length( const DataType* text );
+
+		Entry* m_pEntries;
+		u32 m_uiCapacity;
+		u32 m_uiSize;
+		Allocator m_Alloc;
+
+		static UTI_THREAD_LOCAL ThisType* s_pCurrent;
+		static std::mutex s_GlobalMutex;
+	};
+
+	/**
+	\brief Owns an InternPool, which is used as InternPool::Current() on the creating thread while the scope is alive.
+
+	Scoped pools release all of their strings when the scope ends, which makes them useful for interning
+	the values of a single request or document.
+
+	\tparam PoolType The InternPool type, e.g. InternPool< UTF8String<> >.
+	*/
+	template< typename PoolType >
+	class ScopedInternPool
+	{
+	public:
+
+		ScopedInternPool( void );
+		~ScopedInternPool();
+
+		PoolType& Pool( void );
+
+	protected:
+	private:
+
+		ScopedInternPool( const ScopedInternPool< PoolType >& );
+		ScopedInternPool< PoolType >& operator =( const ScopedInternPool< PoolType >& );
+
+		PoolType m_Pool;
+		PoolType* m_pPrevious;
+	};
+
+	/**
+	\brief Interns \c string in the current pool of its type ( see InternPool::Current() ).
+
+	Scoped pools belong to their thread, interning in the Global() pool holds its GlobalMutex(), so any thread can call it.
+	The canonical strings of the global pool are handed to every thread, so they need the AtomicRefCountPolicy if several threads use it.
+	*/
+	template< typename StringType >
+	inline StringType Intern( const StringType& string );
+}
+
+#endif // utiInternPool_h__
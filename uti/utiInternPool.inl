@@ -0,0 +1,283 @@
+#pragma once
+#ifndef utiInternPool_inl__
+#define utiInternPool_inl__
+
+namespace uti
+{
+	//////////////////////////////////////////////////////////////////////////
+	// Intern Pool implementation
+	//////////////////////////////////////////////////////////////////////////
+
+	template< typename StringType, typename Allocator >
+	UTI_THREAD_LOCAL InternPool< StringType, Allocator >* InternPool< StringType, Allocator >::s_pCurrent = nullptr;
+
+	template< typename StringType, typename Allocator >
+	std::mutex InternPool< StringType, Allocator >::s_GlobalMutex;
+
+	template< typename StringType, typename Allocator >
+	InternPool< StringType, Allocator >::InternPool( void ) :
+		m_pEntries( nullptr ),
+		m_uiCapacity( 0U ),
+		m_uiSize( 0U )
+	{
+	}
+
+	template< typename StringType, typename Allocator >
+	InternPool< StringType, Allocator >::~InternPool()
+	{
+		Clear();
+		if( m_pEntries != nullptr )
+		{
+			m_Alloc.FreeBytes( m_pEntries );
+			m_pEntries = nullptr;
+		}
+	}
+
+	template< typename StringType, typename Allocator >
+	StringType InternPool< StringType, Allocator >::Intern( const StringType& string )
+	{
+		typename StringType::Span units = string.Bytes();
+		u64 hash = string.Hash();
+		Entry* entry = Probe( hash, units.begin(), units.Size() );
+		if( entry == nullptr || entry->Occupied == 0U )
+		{
+			entry = Insert( entry, hash, string );
+		}
+		return entry->String();
+	}
+
+	template< typename StringType, typename Allocator >
+	StringType InternPool< StringType, Allocator >::Intern( const DataType* text )
+	{
+		const StringType* found = Find( text, Length( text ) );
+		if( found != nullptr )
+		{
+			return *found;
+		}
+		// The stored data might differ from the text ( e.g. replaced invalid chars ), so intern the created string by its own content
+		return Intern( StringType( text ) );
+	}
+
+	template< typename StringType, typename Allocator >
+	const StringType* InternPool< StringType, Allocator >::Find( const DataType* data, u32 size ) const
+	{
+		Entry* entry = Probe( HashBytes( data, size * sizeof( DataType ) ), data, size );
+		if( entry == nullptr || entry->Occupied == 0U )
+		{
+			return nullptr;
+		}
+		return &entry->String();
+	}
+
+	template< typename StringType, typename Allocator >
+	u32 InternPool< StringType, Allocator >::Size( void ) const
+	{
+		return m_uiSize;
+	}
+
+	template< typename StringType, typename Allocator >
+	u32 InternPool< StringType, Allocator >::Purge( void )
+	{
+		u32 removed = 0U;
+		for( u32 i = 0U; i < m_uiCapacity; ++i )
+		{
+			Entry& entry = m_pEntries[ i ];
+			if( entry.Occupied != 0U && entry.String().ReferenceCount() == 1U )
+			{
+				entry.String().~StringType();
+				entry.Occupied = 0U;
+				++removed;
+			}
+		}
+
+		if( removed != 0U )
+		{
+			// Linear probing can not simply leave holes in the probe sequences, so the survivors are placed again
+			m_uiSize -= removed;
+			Rehash( m_uiCapacity );
+		}
+		return removed;
+	}
+
+	template< typename StringType, typename Allocator >
+	void InternPool< StringType, Allocator >::Clear( void )
+	{
+		for( u32 i = 0U; i < m_uiCapacity; ++i )
+		{
+			Entry& entry = m_pEntries[ i ];
+			if( entry.Occupied != 0U )
+			{
+				entry.String().~StringType();
+				entry.Occupied = 0U;
+			}
+		}
+		m_uiSize = 0U;
+	}
+
+	template< typename StringType, typename Allocator >
+	InternPool< StringType, Allocator >& InternPool< StringType, Allocator >::Global( void )
+	{
+		static ThisType pool;
+		return pool;
+	}
+
+	template< typename StringType, typename Allocator >
+	std::mutex& InternPool< StringType, Allocator >::GlobalMutex( void )
+	{
+		return s_GlobalMutex;
+	}
+
+	template< typename StringType, typename Allocator >
+	InternPool< StringType, Allocator >& InternPool< StringType, Allocator >::Current( void )
+	{
+		return s_pCurrent != nullptr ? *s_pCurrent : Global();
+	}
+
+	template< typename StringType, typename Allocator >
+	typename InternPool< StringType, Allocator >::Entry* InternPool< StringType, Allocator >::Probe( u64 hash, const DataType* data, u32 size ) const
+	{
+		if( m_uiCapacity == 0U )
+		{
+			return nullptr;
+		}
+
+		const u32 mask = m_uiCapacity - 1U;
+		// The low bits select the start of the probe sequence, mixing in the high bits keeps weak hashes from clustering
+		u32 index = static_cast< u32 >( hash ^ ( hash >> 32U ) ) & mask;
+		for( ;; )
+		{
+			Entry* entry = m_pEntries + index;
+			if( entry->Occupied == 0U )
+			{
+				return entry;
+			}
+			if( entry->Hash == hash && entry->Size == size && simd::Equal( entry->String().Bytes().begin(), data, size * sizeof( DataType ) ) )
+			{
+				return entry;
+			}
+			index = ( index + 1U ) & mask;
+		}
+	}
+
+	template< typename StringType, typename Allocator >
+	typename InternPool< StringType, Allocator >::Entry* InternPool< StringType, Allocator >::Insert( Entry* entry, u64 hash, const StringType& string )
+	{
+		// Keep the load factor below 3/4, so probe sequences stay short
+		if( ( m_uiSize + 1U ) * 4U > m_uiCapacity * 3U )
+		{
+			Rehash( m_uiCapacity == 0U ? 16U : m_uiCapacity * 2U );
+			typename StringType::Span units = string.Bytes();
+			entry = Probe( hash, units.begin(), units.Size() );
+		}
+
+		UTI_ASSERT( entry != nullptr && entry->Occupied == 0U );
+		new( &entry->Storage ) StringType( string );
+		entry->Hash = hash;
+		entry->Size = string.Bytes().Size();
+		entry->Occupied = 1U;
+		++m_uiSize;
+		return entry;
+	}
+
+	template< typename StringType, typename Allocator >
+	void InternPool< StringType, Allocator >::Rehash( u32 capacity )
+	{
+		UTI_ASSERT( ( capacity & ( capacity - 1U ) ) == 0U );
+
+		Entry* oldEntries = m_pEntries;
+		u32 oldCapacity = m_uiCapacity;
+
+		m_pEntries = static_cast< Entry* >( m_Alloc.AllocateBytes( capacity * sizeof( Entry ) ) );
+		m_uiCapacity = capacity;
+		for( u32 i = 0U; i < capacity; ++i )
+		{
+			m_pEntries[ i ].Occupied = 0U;
+		}
+
+		const u32 mask = capacity - 1U;
+		for( u32 i = 0U; i < oldCapacity; ++i )
+		{
+			Entry& oldEntry = oldEntries[ i ];
+			if( oldEntry.Occupied == 0U )
+			{
+				continue;
+			}
+
+			// The contents are unique, so the first free entry of the probe sequence is the right one
+			u32 index = static_cast< u32 >( oldEntry.Hash ^ ( oldEntry.Hash >> 32U ) ) & mask;
+			while( m_pEntries[ index ].Occupied != 0U )
+			{
+				index = ( index + 1U ) & mask;
+			}
+
+			Entry& newEntry = m_pEntries[ index ];
+			new( &newEntry.Storage ) StringType( oldEntry.String() );
+			oldEntry.String().~StringType();
+			newEntry.Hash = oldEntry.Hash;
+			newEntry.Size = oldEntry.Size;
+			newEntry.Occupied = 1U;
+		}
+
+		if( oldEntries != nullptr )
+		{
+			m_Alloc.FreeBytes( oldEntries );
+		}
+	}
+
+	template< typename StringType, typename Allocator >
+	u32 InternPool< StringType, Allocator >::Length( const DataType* text )
+	{
+		u32 length = 0U;
+		if( text != nullptr )
+		{
+			while( text[ length ] != 0 )
+			{
+				++length;
+			}
+		}
+		return length;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Scoped Intern Pool implementation
+	//////////////////////////////////////////////////////////////////////////
+
+	template< typename PoolType >
+	ScopedInternPool< PoolType >::ScopedInternPool( void ) :
+		m_pPrevious( PoolType::s_pCurrent )
+	{
+		PoolType::s_pCurrent = &m_Pool;
+	}
+
+	template< typename PoolType >
+	ScopedInternPool< PoolType >::~ScopedInternPool()
+	{
+		UTI_ASSERT( PoolType::s_pCurrent == &m_Pool );
+		PoolType::s_pCurrent = m_pPrevious;
+	}
+
+	template< typename PoolType >
+	PoolType& ScopedInternPool< PoolType >::Pool( void )
+	{
+		return m_Pool;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Free functions
+	//////////////////////////////////////////////////////////////////////////
+
+	template< typename StringType >
+	StringType Intern( const StringType& string )
+	{
+		typedef InternPool< StringType > PoolType;
+		PoolType& pool = PoolType::Current();
+		if( &pool != &PoolType::Global() )
+		{
+			return pool.Intern( string );
+		}
+		std::lock_guard< std::mutex > lock( PoolType::GlobalMutex() );
+		return pool.Intern( string );
+	}
+}
+
+#endif // utiInternPool_inl__
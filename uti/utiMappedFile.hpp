@@ -0,0 +1,122 @@
+#pragma once
+#ifndef utiMappedFile_h__
+#define utiMappedFile_h__
+
+namespace uti
+{
+	/**
+	\brief Maps whole files into memory, so strings can use the file content without copying it ( see UTF8String::FromFile() ).
+
+	The files are mapped copy on write: the pages are read once up front and only the pages a string writes to are copied.
+	Every mapping is followed by at least one zero byte, which terminates the string.
+	The size of a mapping is recorded in the header of its buffer ( see ReferenceCountedHeader::MappedSize ),
+	so the MappedRefCountPolicy can unmap it without looking it up.
+	*/
+	class MappedFile
+	{
+	public:
+
+		/**
+		\brief Maps the file at \c path and stores its size in \c size and the size of the mapping in \c mappedSize.
+
+		\return The mapped content or \c nullptr if the file can not be mapped, is empty or larger than 4 GB.
+		*/
+		static inline char* Map( const char* path, u32& size, size_t& mappedSize );
+
+		/**
+		\brief Unmaps the mapping of \c mappedSize bytes returned by Map() at \c data.
+		*/
+		static inline void Unmap( void* data, size_t mappedSize );
+
+		/**
+		\brief Reads the file at \c path into a buffer allocated from \c alloc, followed by a zero byte.
+
+		\return The buffer or \c nullptr if the file can not be read or is larger than 4 GB.
+		*/
+		template< typename Allocator >
+		static inline char* Read( const char* path, u32& size, Allocator& alloc );
+
+	};
+
+	/**
+	\brief RefCountPolicy of strings which may hold a file mapped by MappedFile.
+
+	The references are counted by \c CountPolicy. When the last reference is released, a mapped buffer is unmapped,
+	every other buffer ( e.g. a substring or the result of an operator+ ) is destroyed by \c CountPolicy.
+	Whether a buffer is mapped is read from its header, so releasing a string takes no lock.
+
+	\tparam CountPolicy The policy counting the references, e.g. AtomicRefCountPolicy for strings shared between threads.
+	*/
+	template< typename CountPolicy = DefaultRefCountPolicy >
+	struct MappedRefCountPolicy
+	{
+		inline static u32 DecRef( u32& count )
+		{
+			return detail::DecRef< CountPolicy >( count );
+		}
+
+		inline static void IncRef( u32& count )
+		{
+			CountPolicy::IncRef( count );
+		}
+
+		inline static void Destroy( IAllocator* pAllocator, void* pCounted, u32* pCount )
+		{
+			// The counter is the first member of the header
+			const ReferenceCountedHeader* header = reinterpret_cast< const ReferenceCountedHeader* >( pCount );
+			if( header->MappedSize != 0U )
+			{
+				MappedFile::Unmap( pCounted, header->MappedSize );
+				pAllocator->FreeBytes( pCount );
+			}
+			else
+			{
+				CountPolicy::Destroy( pAllocator, pCounted, pCount );
+			}
+		}
+	};
+
+	template< typename CountPolicy >
+	struct IsConcurrentRefCountPolicy< MappedRefCountPolicy< CountPolicy > > : public IsConcurrentRefCountPolicy< CountPolicy >
+	{
+	};
+
+	/**
+	\brief Utf-8 string type whose FromFile() maps the file instead of reading it.
+	*/
+	typedef UTF8String< char, DefaultAllocator, MappedRefCountPolicy< > > MappedUTF8String;
+
+	namespace detail
+	{
+		/**
+		\brief Loads the content of a file for UTF8String::FromFile(), strings with any other policy than the MappedRefCountPolicy read it.
+		*/
+		template< typename RefCountPolicy >
+		struct FileLoader
+		{
+			/**
+			\brief Stores the size of the content in \c size and the size of its mapping in \c mappedSize, which is 0 if it was read.
+			*/
+			template< typename Allocator >
+			static char* Load( const char* path, u32& size, size_t& mappedSize, Allocator& alloc )
+			{
+				mappedSize = 0U;
+				return MappedFile::Read( path, size, alloc );
+			}
+		};
+
+		template< typename CountPolicy >
+		struct FileLoader< MappedRefCountPolicy< CountPolicy > >
+		{
+			template< typename Allocator >
+			static char* Load( const char* path, u32& size, size_t& mappedSize, Allocator& alloc )
+			{
+				// Empty files and files without room for the terminating zero in their last page are read instead
+				char* data = MappedFile::Map( path, size, mappedSize );
+				return data != nullptr ? data : MappedFile::Read( path, size, alloc );
+			}
+		};
+	}
+}
+
+#endif // utiMappedFile_h__
@@ -0,0 +1,171 @@
+#pragma once
+#ifndef utiMappedFile_inl__
+#define utiMappedFile_inl__
+
+namespace uti
+{
+	//////////////////////////////////////////////////////////////////////////
+	// Mapped File implementation
+	//////////////////////////////////////////////////////////////////////////
+
+	char* MappedFile::Map( const char* path, u32& size, size_t& mappedSize )
+	{
+		size = 0U;
+		mappedSize = 0U;
+		void* base = nullptr;
+#if UTI_PLATFORM == UTI_WINDOWS
+		HANDLE file = ::CreateFileA( path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr );
+		if( file == INVALID_HANDLE_VALUE )
+		{
+			return nullptr;
+		}
+		LARGE_INTEGER fileSize;
+		SYSTEM_INFO info;
+		::GetSystemInfo( &info );
+		// A view ends at the end of the file, only the rest of a partial last page is zero and can terminate the string
+		if( !::GetFileSizeEx( file, &fileSize ) || fileSize.QuadPart <= 0 || fileSize.QuadPart >= 0xFFFFFFFFLL ||
+			fileSize.QuadPart % info.dwPageSize == 0 )
+		{
+			::CloseHandle( file );
+			return nullptr;
+		}
+		HANDLE mapping = ::CreateFileMappingA( file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr );
+		base = mapping != nullptr ? ::MapViewOfFile( mapping, FILE_MAP_COPY, 0, 0, 0 ) : nullptr;
+		if( mapping != nullptr )
+		{
+			::CloseHandle( mapping );
+		}
+		::CloseHandle( file );
+		if( base == nullptr )
+		{
+			return nullptr;
+		}
+		mappedSize = static_cast< size_t >( fileSize.QuadPart );
+#if defined( _WIN32_WINNT_WIN8 ) && _WIN32_WINNT >= _WIN32_WINNT_WIN8
+		// Read the whole file up front in large requests instead of faulting it in page by page
+		WIN32_MEMORY_RANGE_ENTRY range = { base, mappedSize };
+		::PrefetchVirtualMemory( ::GetCurrentProcess(), 1, &range, 0 );
+#endif // _WIN32_WINNT_WIN8
+		size = static_cast< u32 >( fileSize.QuadPart );
+#else
+		int file = ::open( path, O_RDONLY | O_CLOEXEC );
+		if( file < 0 )
+		{
+			return nullptr;
+		}
+		struct stat info;
+		if( ::fstat( file, &info ) != 0 || info.st_size <= 0 || static_cast< u64 >( info.st_size ) >= 0xFFFFFFFFU )
+		{
+			::close( file );
+			return nullptr;
+		}
+		const size_t fileSize = static_cast< size_t >( info.st_size );
+		const size_t pageSize = static_cast< size_t >( ::sysconf( _SC_PAGESIZE ) );
+		const size_t length = ( fileSize / pageSize + 1U ) * pageSize;
+
+		// The file is mapped over the start of an anonymous mapping, whose pages behind the file are zero
+		int flags = MAP_PRIVATE | MAP_FIXED;
+#if defined( MAP_POPULATE )
+		flags |= MAP_POPULATE;
+#endif // MAP_POPULATE
+		base = ::mmap( nullptr, length, PROT_READ, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0 );
+		void* content = base != MAP_FAILED ? ::mmap( base, fileSize, PROT_READ, flags, file, 0 ) : MAP_FAILED;
+		::close( file );
+		if( content == MAP_FAILED )
+		{
+			if( base != MAP_FAILED )
+			{
+				::munmap( base, length );
+			}
+			return nullptr;
+		}
+#if !defined( MAP_POPULATE )
+		// Populating already reads every page, where it is missing the pages are read ahead while they are faulted in
+		::madvise( base, fileSize, MADV_SEQUENTIAL );
+#endif // MAP_POPULATE
+		// Only writable after populating it, populating a writable private mapping would copy every page
+		if( ::mprotect( base, length, PROT_READ | PROT_WRITE ) != 0 )
+		{
+			::munmap( base, length );
+			return nullptr;
+		}
+		mappedSize = length;
+		size = static_cast< u32 >( fileSize );
+#endif // UTI_PLATFORM
+		return static_cast< char* >( base );
+	}
+
+	void MappedFile::Unmap( void* data, size_t mappedSize )
+	{
+#if UTI_PLATFORM == UTI_WINDOWS
+		( void )mappedSize;
+		::UnmapViewOfFile( data );
+#else
+		::munmap( data, mappedSize );
+#endif // UTI_PLATFORM
+	}
+
+	template< typename Allocator >
+	char* MappedFile::Read( const char* path, u32& size, Allocator& alloc )
+	{
+		size = 0U;
+		char* data = nullptr;
+		bool complete = false;
+#if UTI_PLATFORM == UTI_WINDOWS
+		HANDLE file = ::CreateFileA( path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr );
+		if( file == INVALID_HANDLE_VALUE )
+		{
+			return nullptr;
+		}
+		LARGE_INTEGER fileSize;
+		if( ::GetFileSizeEx( file, &fileSize ) && fileSize.QuadPart >= 0 && fileSize.QuadPart < 0xFFFFFFFFLL )
+		{
+			size = static_cast< u32 >( fileSize.QuadPart );
+			data = static_cast< char* >( alloc.AllocateBytes( size + 1U ) );
+			u32 done = 0U;
+			DWORD read = 1U;
+			while( done < size && read != 0U && ::ReadFile( file, data + done, size - done, &read, nullptr ) )
+			{
+				done += read;
+			}
+			complete = done == size;
+		}
+		::CloseHandle( file );
+#else
+		int file = ::open( path, O_RDONLY | O_CLOEXEC );
+		if( file < 0 )
+		{
+			return nullptr;
+		}
+		struct stat info;
+		if( ::fstat( file, &info ) == 0 && info.st_size >= 0 && static_cast< u64 >( info.st_size ) < 0xFFFFFFFFU )
+		{
+			size = static_cast< u32 >( info.st_size );
+			data = static_cast< char* >( alloc.AllocateBytes( size + 1U ) );
+			u32 done = 0U;
+			ssize_t read = 1;
+			while( done < size && read > 0 )
+			{
+				read = ::read( file, data + done, size - done );
+				done += read > 0 ? static_cast< u32 >( read ) : 0U;
+			}
+			complete = done == size;
+		}
+		::close( file );
+#endif // UTI_PLATFORM
+
+		if( !complete )
+		{
+			if( data != nullptr )
+			{
+				alloc.FreeBytes( data );
+			}
+			size = 0U;
+			return nullptr;
+		}
+		data[ size ] = 0;
+		return data;
+	}
+}
+
+#endif // utiMappedFile_inl__
@@ -0,0 +1,56 @@
+#pragma once
+#ifndef utiParallel_h__
+#define utiParallel_h__
+
+namespace uti
+{
+	namespace detail
+	{
+		/**
+		\brief The maximum number of chunks data is split into by ChunkCount().
+		*/
+		static const u32 MaxChunkCount = 64U;
+
+		/**
+		\brief Returns the number of chunks \c size elements are split into, so every chunk holds at least \c chunkSize elements.
+
+		\param threadCount The maximum number of chunks, 0 uses one chunk per hardware thread.
+		\return A value between 1 and MaxChunkCount.
+		*/
+		inline u32 ChunkCount( u32 size, u32 chunkSize, u32 threadCount )
+		{
+			if( threadCount == 0U )
+			{
+				threadCount = std::thread::hardware_concurrency();
+			}
+			u32 chunkCount = size / chunkSize;
+			chunkCount = chunkCount < threadCount ? chunkCount : threadCount;
+			chunkCount = chunkCount < MaxChunkCount ? chunkCount : MaxChunkCount;
+			return chunkCount > 0U ? chunkCount : 1U;
+		}
+
+		/**
+		\brief Calls \c function with every chunk index below \c chunkCount, each chunk on a thread of its own.
+
+		The calling thread runs the first chunk, so a single chunk never starts a thread.
+		Returns when every chunk is done.
+		*/
+		template< typename Function >
+		void RunChunks( u32 chunkCount, const Function& function )
+		{
+			UTI_ASSERT( chunkCount <= MaxChunkCount );
+			std::thread threads[ MaxChunkCount - 1U ];
+			for( u32 i = 1U; i < chunkCount; ++i )
+			{
+				threads[ i - 1U ] = std::thread( function, i );
+			}
+			function( 0U );
+			for( u32 i = 1U; i < chunkCount; ++i )
+			{
+				threads[ i - 1U ].join();
+			}
+		}
+	}
+}
+
+#endif // utiParallel_h__
@@ -8,10 +8,18 @@ namespace uti
 
 
 
+	/**
+	\brief A RefCountPolicy implements the counting for ReferenceCounted.
+
+	DecRef returns the count after decrementing, ReferenceCounted destroys the data when it returns zero.
+	Returning the count instead of reading it again afterwards is what makes the decision safe for concurrent policies.
+	Policies whose DecRef returns \c void are still supported, the count is read again after decrementing for them ( see detail::DecRef() ).
+	*/
 	struct NoRefCountPolicy
 	{
-		inline static void DecRef( u32&  )
+		inline static u32 DecRef( u32& count )
 		{
+			return count;
 		}
 
 		inline static void IncRef( u32&  )
@@ -25,9 +33,9 @@ namespace uti
 
 	struct DefaultRefCountPolicy
 	{
-		inline static void DecRef( u32& count )
+		inline static u32 DecRef( u32& count )
 		{
-			--count;
+			return --count;
 		}
 
 		inline static void IncRef( u32& count )
@@ -42,6 +50,83 @@ namespace uti
 		}
 	};
 
+	/**
+	\brief Counts the references with atomic operations, so copies of a string can be created and released on different threads.
+	*/
+	struct AtomicRefCountPolicy
+	{
+		inline static u32 DecRef( u32& count )
+		{
+#if defined( _MSC_VER )
+			return static_cast< u32 >( _InterlockedDecrement( reinterpret_cast< volatile long* >( &count ) ) );
+#else
+			return __atomic_sub_fetch( &count, 1U, __ATOMIC_ACQ_REL );
+#endif // _MSC_VER
+		}
+
+		inline static void IncRef( u32& count )
+		{
+#if defined( _MSC_VER )
+			_InterlockedIncrement( reinterpret_cast< volatile long* >( &count ) );
+#else
+			__atomic_add_fetch( &count, 1U, __ATOMIC_SEQ_CST );
+#endif // _MSC_VER
+		}
+
+		inline static void Destroy( IAllocator* pAllocator, void* pCounted, u32* pCount )
+		{
+			DefaultRefCountPolicy::Destroy( pAllocator, pCounted, pCount );
+		}
+	};
+
+	/**
+	\brief Tells if \c RefCountPolicy counts atomically, so copies of a string using it can be created and released on different threads.
+
+	Custom policies which count atomically can specialize it.
+	*/
+	template< typename RefCountPolicy >
+	struct IsConcurrentRefCountPolicy : public std::false_type
+	{
+	};
+
+	template<>
+	struct IsConcurrentRefCountPolicy< AtomicRefCountPolicy > : public std::true_type
+	{
+	};
+
+	namespace detail
+	{
+		template< typename RefCountPolicy, bool returnsCount = !std::is_void< decltype( RefCountPolicy::DecRef( std::declval< u32& >() ) ) >::value >
+		struct DecRefCall
+		{
+			static u32 DecRef( u32& count )
+			{
+				return RefCountPolicy::DecRef( count );
+			}
+		};
+
+		template< typename RefCountPolicy >
+		struct DecRefCall< RefCountPolicy, false >
+		{
+			static u32 DecRef( u32& count )
+			{
+				RefCountPolicy::DecRef( count );
+				return count;
+			}
+		};
+
+		/**
+		\brief Calls RefCountPolicy::DecRef() and returns the count after decrementing.
+
+		Policies whose DecRef returns \c void count without synchronization, so the count can be read again for them.
+		*/
+		template< typename RefCountPolicy >
+		inline u32 DecRef( u32& count )
+		{
+			return DecRefCall< RefCountPolicy >::DecRef( count );
+		}
+	}
+
 }
 #endif // utiAllocatorPolicy_h__
 
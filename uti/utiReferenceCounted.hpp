@@ -4,6 +4,34 @@
 
 namespace uti
 {
+	/**
+	\brief Header allocated once for every buffer shared by ReferenceCounted instances.
+
+	Besides the counter it holds values which are calculated from the buffer contents,
+	so every copy sharing the buffer can reuse them.
+	The counter is the first member, so the address of the header is the address handed to the RefCountPolicy.
+	The cached values are read and written by every thread sharing the buffer, so they are atomic:
+	a value is only read after its flag was seen set, which publishes the value stored before it.
+	*/
+	struct ReferenceCountedHeader
+	{
+		u32 Count;
+		std::atomic< u32 > CachedFlags;
+		std::atomic< u64 > CachedValues[ static_cast< u32 >( HashCacheSlot::Count ) ];
+
+		/**
+		\brief The number of buffers still alive in the slab holding this header, see ReferenceCounted::AllocateSlab(),
+		or \c nullptr for a buffer allocated on its own.
+		*/
+		u32* pSlab;
+
+		/**
+		\brief The size of the file mapping starting at the buffer, which is unmapped instead of freed ( see MappedRefCountPolicy ),
+		or 0 for an allocated buffer.
+		*/
+		size_t MappedSize;
+	};
+
 	/**
 	\brief Reference Counter class for copy on write functionality of the UTFString.
 
@@ -12,8 +40,17 @@ namespace uti
 	class ReferenceCounted
 	{
 	public:
+
+		/**
+		\brief Creates an empty reference, which neither allocates a header nor is counted.
+		*/
 		ReferenceCounted( void );
 		explicit ReferenceCounted( T* pointer );
+
+		/**
+		\brief Takes over the reference \c header holds on \c pointer, e.g. a buffer and header of a slab ( see AllocateSlab() ).
+		*/
+		ReferenceCounted( T* pointer, ReferenceCountedHeader* header );
 		ReferenceCounted( const ReferenceCounted< T, Allocator, RefCountPolicy > & refCount );
 		ReferenceCounted( ReferenceCounted< T, Allocator, RefCountPolicy >&& refCount );
 		~ReferenceCounted();
@@ -43,15 +80,58 @@ namespace uti
 
 		u32 Count( void ) const;
 
+		/**
+		\brief Reads the value cached for the shared buffer in the given \c slot.
+
+		\return \c true if a value was cached and written to \c value.
+		*/
+		bool GetCached( HashCacheSlot slot, u64& value ) const;
+
+		/**
+		\brief Caches \c value for the shared buffer, so every ReferenceCounted sharing it can read it.
+
+		The cached values describe the buffer contents, so they must be cleared with ClearCached() when the buffer is modified.
+		*/
+		void SetCached( HashCacheSlot slot, u64 value ) const;
+
+		void ClearCached( void );
+
+		/**
+		\brief Records that the buffer is a file mapping of \c mappedSize bytes starting at the buffer, see ReferenceCountedHeader::MappedSize.
+		*/
+		void SetMappedSize( size_t mappedSize );
+
+		/**
+		\brief Allocates one slab holding \c count headers followed by \c size elements of T, instead of a header and a buffer for each of \c count buffers.
+
+		Every header holds one reference, which is taken over by ReferenceCounted( T*, ReferenceCountedHeader* ) for a buffer within the slab.
+		The slab is freed with the last buffer released, the RefCountPolicy only counts the references of each buffer and is not asked to destroy them.
+		The buffers of the slab are counted atomically regardless of the RefCountPolicy, as they are released by unrelated instances, possibly on different threads.
+		The slab is freed by the Allocator of the ReferenceCounted releasing the last buffer, so it has to free memory of any other instance of \c alloc's type,
+		e.g. by forwarding to a global allocator ( see IAllocator ).
+		A slab which is not handed to any ReferenceCounted has to be freed with FreeSlab().
+
+		\param headers Receives the \c count headers.
+		\return The \c size elements, or \c nullptr if the slab would be larger than 4 GB.
+		*/
+		static T* AllocateSlab( Allocator& alloc, u32 count, u32 size, ReferenceCountedHeader*& headers );
+
+		/**
+		\brief Frees a slab allocated by AllocateSlab(), none of its buffers may be referenced anymore.
+		*/
+		static void FreeSlab( Allocator& alloc, ReferenceCountedHeader* headers );
+
 	private:
 
+		void CreateHeader( void );
+
 		void IncRef( void );
 
 		void DecRef( void );
 
 		T* m_CountedPointer;
 
-		u32* m_Count;
+		ReferenceCountedHeader* m_pHeader;
 
 		Allocator m_Alloc;
 
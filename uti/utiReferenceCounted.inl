@@ -35,9 +35,14 @@ namespace uti
 	template< typename T, typename Allocator, typename RefCountPolicy>
 	u32 ReferenceCounted<T, Allocator, RefCountPolicy>::Count( void ) const
 	{
-		if( m_Count != nullptr )
+		if( m_pHeader != nullptr )
 		{
-			return *m_Count;
+			// Read atomically, so the count can be checked while other threads copy or release the data
+#if defined( _MSC_VER )
+			return *static_cast< volatile u32* >( &m_pHeader->Count );
+#else
+			return __atomic_load_n( &m_pHeader->Count, __ATOMIC_SEQ_CST );
+#endif // _MSC_VER
 		}
 		else
 		{
@@ -56,7 +61,7 @@ namespace uti
 	{
 		DecRef();
 		m_CountedPointer = nullptr;
-		m_Count = nullptr;
+		m_pHeader = nullptr;
 	}
 
 	template< typename T, typename Allocator, typename RefCountPolicy>
@@ -73,20 +78,18 @@ namespace uti
 
 	template< typename T, typename Allocator, typename RefCountPolicy>
 	ReferenceCounted<T, Allocator, RefCountPolicy>::ReferenceCounted( void ) :
-		m_CountedPointer( nullptr )
+		m_CountedPointer( nullptr ),
+		m_pHeader( nullptr )
 	{
-		m_Count = static_cast< u32* >( m_Alloc.AllocateBytes( sizeof( u32 ) ) );
-		*m_Count = 0U;
-		RefCountPolicy::IncRef( *m_Count );
 	}
 
 	template< typename T, typename Allocator, typename RefCountPolicy>
 	ReferenceCounted<T, Allocator, RefCountPolicy>::ReferenceCounted( ReferenceCounted<T, Allocator, RefCountPolicy>&& refCount ) :
 		m_CountedPointer( refCount.m_CountedPointer ),
-		m_Count( refCount.m_Count )
+		m_pHeader( refCount.m_pHeader )
 	{
 		refCount.m_CountedPointer = nullptr;
-		m_Count = nullptr;
+		refCount.m_pHeader = nullptr;
 	}
 
 	template< typename T, typename Allocator, typename RefCountPolicy>
@@ -99,7 +102,7 @@ namespace uti
 	ReferenceCounted<T, Allocator, RefCountPolicy>::ReferenceCounted( const ReferenceCounted<T, Allocator, RefCountPolicy>& refCount )
 	{
 
-		m_Count = refCount.m_Count;
+		m_pHeader = refCount.m_pHeader;
 		m_CountedPointer = refCount.m_CountedPointer;
 
 		IncRef();
@@ -109,9 +112,14 @@ namespace uti
 	ReferenceCounted<T, Allocator, RefCountPolicy>::ReferenceCounted( T* pointer ) :
 		m_CountedPointer( pointer )
 	{
-		m_Count = static_cast< u32* >( m_Alloc.AllocateBytes( sizeof( u32 ) ) );
-		*m_Count = 0U;
-		RefCountPolicy::IncRef( *m_Count );
+		CreateHeader();
+	}
+
+	template< typename T, typename Allocator, typename RefCountPolicy>
+	ReferenceCounted<T, Allocator, RefCountPolicy>::ReferenceCounted( T* pointer, ReferenceCountedHeader* header ) :
+		m_CountedPointer( pointer ),
+		m_pHeader( header )
+	{
 	}
 
 	template< typename T, typename Allocator, typename RefCountPolicy>
@@ -131,11 +139,12 @@ namespace uti
 	{
 		if( this != &refCount )
 		{
+			DecRef();
 			m_CountedPointer = refCount.m_CountedPointer;
-			m_Count = refCount.m_Count;
+			m_pHeader = refCount.m_pHeader;
 
 			refCount.m_CountedPointer = nullptr;
-			refCount.m_Count = nullptr;
+			refCount.m_pHeader = nullptr;
 		}
 
 		return *this;
@@ -150,7 +159,7 @@ namespace uti
 			DecRef();
 			m_CountedPointer = refCount.m_CountedPointer;
 
-			m_Count = refCount.m_Count;
+			m_pHeader = refCount.m_pHeader;
 
 			IncRef();
 		}
@@ -167,9 +176,7 @@ namespace uti
 			DecRef();
 
 			m_CountedPointer = ptr;
-			m_Count = static_cast< u32* >( m_Alloc.AllocateBytes( sizeof( u32 ) ) );
-			*m_Count = 0U;
-			RefCountPolicy::IncRef( *m_Count );
+			CreateHeader();
 		}
 
 		return *this;
@@ -180,14 +187,25 @@ namespace uti
 	template< typename T, typename Allocator, typename RefCountPolicy>
 	void ReferenceCounted<T, Allocator, RefCountPolicy>::DecRef( void )
 	{
-		if( m_Count )
+		if( m_pHeader )
 		{
-			RefCountPolicy::DecRef( *m_Count );
-			if( *m_Count == 0 )
+			if( detail::DecRef< RefCountPolicy >( m_pHeader->Count ) == 0U )
 			{
-				RefCountPolicy::Destroy( &m_Alloc, reinterpret_cast< void* >( m_CountedPointer ), m_Count );
+				if( m_pHeader->pSlab != nullptr )
+				{
+					// The buffer and its header live in a slab shared with other buffers, which is freed with the last of them.
+					// Buffers of one slab are released by unrelated strings, possibly on different threads, so this counter is always atomic
+					if( AtomicRefCountPolicy::DecRef( *m_pHeader->pSlab ) == 0U )
+					{
+						m_Alloc.FreeBytes( m_pHeader->pSlab );
+					}
+				}
+				else
+				{
+					RefCountPolicy::Destroy( &m_Alloc, reinterpret_cast< void* >( m_CountedPointer ), &m_pHeader->Count );
+				}
 				m_CountedPointer = nullptr;
-				m_Count = nullptr;
+				m_pHeader = nullptr;
 			}
 		}
 	}
@@ -195,9 +213,102 @@ namespace uti
 	template< typename T, typename Allocator, typename RefCountPolicy>
 	void ReferenceCounted<T, Allocator, RefCountPolicy>::IncRef( void )
 	{
-		if( m_Count )
+		if( m_pHeader )
+		{
+			RefCountPolicy::IncRef( m_pHeader->Count );
+		}
+	}
+
+	template< typename T, typename Allocator, typename RefCountPolicy>
+	void ReferenceCounted<T, Allocator, RefCountPolicy>::CreateHeader( void )
+	{
+		m_pHeader = new( m_Alloc.AllocateBytes( sizeof( ReferenceCountedHeader ) ) ) ReferenceCountedHeader;
+		m_pHeader->Count = 0U;
+		m_pHeader->CachedFlags.store( 0U, std::memory_order_relaxed );
+		m_pHeader->pSlab = nullptr;
+		m_pHeader->MappedSize = 0U;
+		RefCountPolicy::IncRef( m_pHeader->Count );
+	}
+
+	template< typename T, typename Allocator, typename RefCountPolicy>
+	T* ReferenceCounted<T, Allocator, RefCountPolicy>::AllocateSlab( Allocator& alloc, u32 count, u32 size, ReferenceCountedHeader*& headers )
+	{
+		UTI_ASSERT( count > 0U );
+		// The slab counter is padded to the alignment of the headers, the elements follow the last header
+		const u64 headerOffset = sizeof( u64 );
+		const u64 elementOffset = headerOffset + static_cast< u64 >( count ) * sizeof( ReferenceCountedHeader );
+		const u64 slabSize = elementOffset + static_cast< u64 >( size ) * sizeof( T );
+		if( slabSize > 0xFFFFFFFFULL )
+		{
+			headers = nullptr;
+			return nullptr;
+		}
+
+		char* slab = static_cast< char* >( alloc.AllocateBytes( static_cast< u32 >( slabSize ) ) );
+		u32* slabCount = reinterpret_cast< u32* >( slab );
+		// Set directly instead of by the RefCountPolicy, so a policy which does not count never frees the slab
+		*slabCount = count;
+		headers = reinterpret_cast< ReferenceCountedHeader* >( slab + headerOffset );
+		for( u32 i = 0U; i < count; ++i )
+		{
+			new( headers + i ) ReferenceCountedHeader;
+			headers[ i ].Count = 0U;
+			headers[ i ].CachedFlags.store( 0U, std::memory_order_relaxed );
+			headers[ i ].pSlab = slabCount;
+			headers[ i ].MappedSize = 0U;
+			RefCountPolicy::IncRef( headers[ i ].Count );
+		}
+		return reinterpret_cast< T* >( slab + elementOffset );
+	}
+
+	template< typename T, typename Allocator, typename RefCountPolicy>
+	void ReferenceCounted<T, Allocator, RefCountPolicy>::FreeSlab( Allocator& alloc, ReferenceCountedHeader* headers )
+	{
+		if( headers != nullptr )
+		{
+			alloc.FreeBytes( headers->pSlab );
+		}
+	}
+
+	template< typename T, typename Allocator, typename RefCountPolicy>
+	bool ReferenceCounted<T, Allocator, RefCountPolicy>::GetCached( HashCacheSlot slot, u64& value ) const
+	{
+		u32 flag = 1U << static_cast< u32 >( slot );
+		if( m_pHeader != nullptr && ( m_pHeader->CachedFlags.load( std::memory_order_acquire ) & flag ) != 0U )
+		{
+			value = m_pHeader->CachedValues[ static_cast< u32 >( slot ) ].load( std::memory_order_relaxed );
+			return true;
+		}
+		return false;
+	}
+
+	template< typename T, typename Allocator, typename RefCountPolicy>
+	void ReferenceCounted<T, Allocator, RefCountPolicy>::SetCached( HashCacheSlot slot, u64 value ) const
+	{
+		if( m_pHeader != nullptr )
+		{
+			// The flag is set with release order after the value is stored, so a reader seeing the flag also sees the value.
+			// Threads racing to cache a slot store the same value, as it only depends on the buffer contents.
+			m_pHeader->CachedValues[ static_cast< u32 >( slot ) ].store( value, std::memory_order_relaxed );
+			m_pHeader->CachedFlags.fetch_or( 1U << static_cast< u32 >( slot ), std::memory_order_release );
+		}
+	}
+
+	template< typename T, typename Allocator, typename RefCountPolicy>
+	void ReferenceCounted<T, Allocator, RefCountPolicy>::ClearCached( void )
+	{
+		if( m_pHeader != nullptr )
+		{
+			m_pHeader->CachedFlags.store( 0U, std::memory_order_release );
+		}
+	}
+
+	template< typename T, typename Allocator, typename RefCountPolicy>
+	void ReferenceCounted<T, Allocator, RefCountPolicy>::SetMappedSize( size_t mappedSize )
+	{
+		if( m_pHeader != nullptr )
 		{
-			RefCountPolicy::IncRef( *m_Count );
+			m_pHeader->MappedSize = mappedSize;
 		}
 	}
 }
@@ -4,11 +4,27 @@
 
 namespace uti
 {
+	/**
+	\brief Adapter which iterates the given Iterator type in reverse order.
+
+	The iterator category is taken over from the adapted iterator (contiguous iterators become random access iterators),
+	the random access operations are only available if the adapted iterator supports them.
+
+	\tparam Iterator The adapted iterator type.
+	*/
 	template< typename Iterator >
 	class ReverseIterator_tpl
 	{
 	public:
 
+		typedef typename std::iterator_traits< Iterator >::iterator_category iterator_category;
+		typedef typename std::iterator_traits< Iterator >::value_type value_type;
+		typedef typename std::iterator_traits< Iterator >::difference_type difference_type;
+		typedef typename std::iterator_traits< Iterator >::pointer pointer;
+		typedef typename std::iterator_traits< Iterator >::reference reference;
+
+		ReverseIterator_tpl( void );
+
 		ReverseIterator_tpl( const Iterator& it );
 
 		ReverseIterator_tpl( const ReverseIterator_tpl< Iterator >& it );
@@ -16,7 +32,8 @@ namespace uti
 		ReverseIterator_tpl< Iterator >& operator =( const ReverseIterator_tpl< Iterator >& it );
 		ReverseIterator_tpl< Iterator >& operator =( const Iterator& it );
 
-		typename Iterator::DataType& operator *( );
+		reference operator *( ) const;
+		reference operator []( difference_type offset ) const;
 
 		bool Valid( void ) const;
 
@@ -34,6 +51,14 @@ namespace uti
 		ReverseIterator_tpl< Iterator >& operator --( void );
 		ReverseIterator_tpl< Iterator > operator --( int );
 
+		ReverseIterator_tpl< Iterator >& operator +=( difference_type offset );
+		ReverseIterator_tpl< Iterator >& operator -=( difference_type offset );
+
+		ReverseIterator_tpl< Iterator > operator +( difference_type offset ) const;
+		ReverseIterator_tpl< Iterator > operator -( difference_type offset ) const;
+
+		difference_type operator -( const ReverseIterator_tpl< Iterator >& rhs ) const;
+
 	protected:
 	private:
 
@@ -61,7 +61,7 @@ namespace uti
 	template< typename Iterator >
 	bool ReverseIterator_tpl<Iterator>::operator<=( const ReverseIterator_tpl< Iterator >& rhs ) const
 	{
-		return m_It >= ths.m_It;
+		return m_It >= rhs.m_It;
 	}
 
 	template< typename Iterator >
@@ -83,12 +83,54 @@ namespace uti
 	}
 
 	template< typename Iterator >
-	typename Iterator::DataType& ReverseIterator_tpl<Iterator>::operator*( )
+	typename ReverseIterator_tpl<Iterator>::reference ReverseIterator_tpl<Iterator>::operator*( ) const
 	{
 		Iterator copy( m_It );
 		return *( --copy );
 	}
 
+	template< typename Iterator >
+	typename ReverseIterator_tpl<Iterator>::reference ReverseIterator_tpl<Iterator>::operator[]( difference_type offset ) const
+	{
+		return *( *this + offset );
+	}
+
+	template< typename Iterator >
+	ReverseIterator_tpl< Iterator >& ReverseIterator_tpl<Iterator>::operator+=( difference_type offset )
+	{
+		m_It -= offset;
+		return *this;
+	}
+
+	template< typename Iterator >
+	ReverseIterator_tpl< Iterator >& ReverseIterator_tpl<Iterator>::operator-=( difference_type offset )
+	{
+		m_It += offset;
+		return *this;
+	}
+
+	template< typename Iterator >
+	ReverseIterator_tpl< Iterator > ReverseIterator_tpl<Iterator>::operator+( difference_type offset ) const
+	{
+		ReverseIterator_tpl< Iterator > copy( *this );
+		copy += offset;
+		return copy;
+	}
+
+	template< typename Iterator >
+	ReverseIterator_tpl< Iterator > ReverseIterator_tpl<Iterator>::operator-( difference_type offset ) const
+	{
+		ReverseIterator_tpl< Iterator > copy( *this );
+		copy -= offset;
+		return copy;
+	}
+
+	template< typename Iterator >
+	typename ReverseIterator_tpl<Iterator>::difference_type ReverseIterator_tpl<Iterator>::operator-( const ReverseIterator_tpl< Iterator >& rhs ) const
+	{
+		return rhs.m_It - m_It;
+	}
+
 	template< typename Iterator >
 	ReverseIterator_tpl< Iterator >& ReverseIterator_tpl<Iterator>::operator=( const Iterator& it )
 	{
@@ -110,6 +152,13 @@ namespace uti
 
 	}
 
+	template< typename Iterator >
+	ReverseIterator_tpl<Iterator>::ReverseIterator_tpl( void ) :
+		m_It()
+	{
+
+	}
+
 	template< typename Iterator >
 	ReverseIterator_tpl<Iterator>::ReverseIterator_tpl( const Iterator& it ) :
 		m_It( it )
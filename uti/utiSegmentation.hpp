@@ -0,0 +1,308 @@
+#pragma once
+#ifndef utiSegmentation_h__
+#define utiSegmentation_h__
+
+namespace uti
+{
+	/**
+	\brief Cursor which iterates over the extended grapheme clusters ( user perceived chars, UAX #29 ) of a generic String.
+
+	Dereferencing the iterator returns a span over the units of the current cluster, no data is copied.
+	An iterator created by a string holds a reference to its data, so it stays valid after the string is destroyed.
+	The boundaries are found with the table driven state machine of unicode::IsGraphemeBreak(),
+	runs of code points which are clusters of their own ( e.g. ASCII and Latin-1 text ) are found a block at a time
+	( see UTF8String::SimpleGraphemeRun() ) and stepped through without looking up any property.
+
+	The iterator is its own range, so it can be used directly in range based for loops:
+
+	\code
+	for( auto cluster : string.Graphemes() )
+	\endcode
+
+	\tparam StringType The underlying String class type, whose clusters are visited.
+	*/
+	template< typename StringType >
+	class GraphemeIterator
+	{
+	public:
+
+		typedef typename StringType::Type DataType;
+		typedef const DataType* ConstPointer;
+		typedef ByteSpan< StringType > Span;
+		typedef typename StringType::DataType BufferType;
+
+		/**
+		\brief Creates an iterator on the cluster starting at \c pos, which iterates until \c end.
+
+		\c pos has to be the start of a grapheme cluster, e.g. the start of the string.
+		*/
+		GraphemeIterator( ConstPointer pos, ConstPointer end );
+
+		/**
+		\brief Creates an iterator like above, which holds a reference to \c buffer, the data \c pos and \c end point into.
+		*/
+		GraphemeIterator( const BufferType& buffer, ConstPointer pos, ConstPointer end );
+
+		/**
+		\brief Returns a span over the units of the current cluster.
+		*/
+		Span operator *( void ) const;
+
+		/**
+		\brief Returns the address of the current cluster.
+		*/
+		ConstPointer Pointer( void ) const;
+
+		/**
+		\brief Returns the size (in units) of the current cluster.
+		*/
+		u32 ClusterSize( void ) const;
+
+		bool Valid( void ) const;
+
+		bool operator ==( const GraphemeIterator< StringType >& rhs ) const;
+		bool operator !=( const GraphemeIterator< StringType >& rhs ) const;
+
+		GraphemeIterator< StringType >& operator ++( void );
+		GraphemeIterator< StringType > operator ++( int );
+
+		GraphemeIterator< StringType > begin( void ) const;
+		GraphemeIterator< StringType > end( void ) const;
+
+		/**
+		\brief Counts the grapheme clusters from \c pos up to \c end.
+
+		Runs of simple clusters are counted by counting their chars, a block at a time.
+		*/
+		static u32 Count( ConstPointer pos, ConstPointer end );
+
+	protected:
+	private:
+
+		/**
+		\brief Returns the end of the cluster starting at \c pos, which is no simple cluster.
+		*/
+		static ConstPointer FindClusterEnd( ConstPointer pos, ConstPointer end );
+
+		/**
+		\brief Returns the size of the char at \c pos, never 0 so invalid units are skipped one by one.
+		*/
+		static u32 CharSize( ConstPointer pos );
+
+		/**
+		\brief Moves the cluster end behind the cluster starting at m_pPos.
+		*/
+		void FindNext( void );
+
+		ConstPointer m_pPos;
+		ConstPointer m_pClusterEnd;
+		// Every char in front of this address is known to be a cluster of its own
+		ConstPointer m_pSimpleEnd;
+		ConstPointer m_pEnd;
+		// Keeps the data alive, empty if the iterator was not created by a string
+		BufferType m_Buffer;
+	};
+
+	/**
+	\brief Cursor which iterates over the word boundary segments ( UAX #29 ) of a generic String.
+
+	Every part of the string between two word boundaries is a segment: words, numbers, runs of spaces and single punctuation chars.
+	Dereferencing the iterator returns a span over the units of the current segment, no data is copied.
+	An iterator created by a string holds a reference to its data, so it stays valid after the string is destroyed.
+	IsWord() tells the words and numbers apart from the rest, which is what a tokenizer is interested in.
+
+	The rules WB5 to WB16 are looked up in a table indexed by the properties of two code points ( see unicode::detail::WordRule() ),
+	the few rules which see further ( e.g. WB6 and WB7 keep "can't" together ) test the neighbors of the pair.
+	Runs of ASCII letters and digits are skipped a block at a time ( see UTF8String::AsciiWordRun() ),
+	since there is never a boundary between them.
+
+	\code
+	for( auto word : string.Words() )
+	\endcode
+
+	\tparam StringType The underlying String class type, whose segments are visited.
+	*/
+	template< typename StringType >
+	class WordIterator
+	{
+	public:
+
+		typedef typename StringType::Type DataType;
+		typedef const DataType* ConstPointer;
+		typedef ByteSpan< StringType > Span;
+		typedef typename StringType::DataType BufferType;
+
+		/**
+		\brief Creates an iterator on the segment starting at \c pos, which iterates until \c end.
+
+		\c pos has to be on a word boundary, e.g. the start of the string.
+		*/
+		WordIterator( ConstPointer pos, ConstPointer end );
+
+		/**
+		\brief Creates an iterator like above, which holds a reference to \c buffer, the data \c pos and \c end point into.
+		*/
+		WordIterator( const BufferType& buffer, ConstPointer pos, ConstPointer end );
+
+		/**
+		\brief Returns a span over the units of the current segment.
+		*/
+		Span operator *( void ) const;
+
+		/**
+		\brief Returns the address of the current segment.
+		*/
+		ConstPointer Pointer( void ) const;
+
+		/**
+		\brief Returns the size (in units) of the current segment.
+		*/
+		u32 SegmentSize( void ) const;
+
+		/**
+		\brief Returns if the current segment is a word: it starts with a letter, digit or connector punctuation of the word rules,
+		or with any other letter ( e.g. an ideograph, kana or Thai, which form segments of their own ).
+		*/
+		bool IsWord( void ) const;
+
+		bool Valid( void ) const;
+
+		bool operator ==( const WordIterator< StringType >& rhs ) const;
+		bool operator !=( const WordIterator< StringType >& rhs ) const;
+
+		WordIterator< StringType >& operator ++( void );
+		WordIterator< StringType > operator ++( int );
+
+		WordIterator< StringType > begin( void ) const;
+		WordIterator< StringType > end( void ) const;
+
+	protected:
+	private:
+
+		/**
+		\brief Returns the end of the segment starting at \c pos.
+
+		\param record The segmentation record of the code point at \c pos, which is replaced by the one of the code point
+		at the end of the segment ( the start of the next one ).
+		*/
+		static ConstPointer FindSegmentEnd( ConstPointer pos, ConstPointer end, u32& record );
+
+		/**
+		\brief Returns the Word_Break value of the first code point from \c pos on which is not ignored by WB4,
+		or Other if there is none in front of \c end.
+		*/
+		static u32 NextWordProperty( ConstPointer pos, ConstPointer end );
+
+		/**
+		\brief Returns the size of the char at \c pos, never 0 so invalid units are skipped one by one.
+		*/
+		static u32 CharSize( ConstPointer pos );
+
+		/**
+		\brief Moves the segment end behind the segment starting at m_pPos.
+		*/
+		void FindNext( void );
+
+		ConstPointer m_pPos;
+		ConstPointer m_pSegmentEnd;
+		ConstPointer m_pEnd;
+		// The segmentation record of the code point at m_pPos
+		u32 m_uiRecord;
+		bool m_bWord;
+		// Keeps the data alive, empty if the iterator was not created by a string
+		BufferType m_Buffer;
+	};
+
+	/**
+	\brief Cursor which iterates over the sentences ( UAX #29 ) of a generic String.
+
+	Every sentence includes the spaces and the paragraph separator behind its terminator.
+	Dereferencing the iterator returns a span over the units of the current sentence, no data is copied.
+	An iterator created by a string holds a reference to its data, so it stays valid after the string is destroyed.
+
+	The rules are run by a state machine whose transitions are looked up in a table ( see unicode::detail::SentenceTransition() ),
+	only SB8 ( a lower case letter behind "etc. " continues the sentence ) looks ahead.
+	Runs of ASCII text without any terminator are skipped a block at a time ( see UTF8String::AsciiSentenceRun() ).
+
+	\code
+	for( auto sentence : string.Sentences() )
+	\endcode
+
+	\tparam StringType The underlying String class type, whose sentences are visited.
+	*/
+	template< typename StringType >
+	class SentenceIterator
+	{
+	public:
+
+		typedef typename StringType::Type DataType;
+		typedef const DataType* ConstPointer;
+		typedef ByteSpan< StringType > Span;
+		typedef typename StringType::DataType BufferType;
+
+		/**
+		\brief Creates an iterator on the sentence starting at \c pos, which iterates until \c end.
+
+		\c pos has to be on a sentence boundary, e.g. the start of the string.
+		*/
+		SentenceIterator( ConstPointer pos, ConstPointer end );
+
+		/**
+		\brief Creates an iterator like above, which holds a reference to \c buffer, the data \c pos and \c end point into.
+		*/
+		SentenceIterator( const BufferType& buffer, ConstPointer pos, ConstPointer end );
+
+		/**
+		\brief Returns a span over the units of the current sentence.
+		*/
+		Span operator *( void ) const;
+
+		/**
+		\brief Returns the address of the current sentence.
+		*/
+		ConstPointer Pointer( void ) const;
+
+		/**
+		\brief Returns the size (in units) of the current sentence.
+		*/
+		u32 SentenceSize( void ) const;
+
+		bool Valid( void ) const;
+
+		bool operator ==( const SentenceIterator< StringType >& rhs ) const;
+		bool operator !=( const SentenceIterator< StringType >& rhs ) const;
+
+		SentenceIterator< StringType >& operator ++( void );
+		SentenceIterator< StringType > operator ++( int );
+
+		SentenceIterator< StringType > begin( void ) const;
+		SentenceIterator< StringType > end( void ) const;
+
+	protected:
+	private:
+
+		/**
+		\brief Returns the end of the sentence starting at \c pos.
+		*/
+		static ConstPointer FindSentenceEnd( ConstPointer pos, ConstPointer end );
+
+		/**
+		\brief Returns the first code point from \c pos on which may start a sentence ( OLetter, Upper, Lower, a separator or a terminator ),
+		\c end if there is none. \c lower is set if it is a Lower code point ( SB8 ).
+		*/
+		static ConstPointer FindSentenceStart( ConstPointer pos, ConstPointer end, bool& lower );
+
+		/**
+		\brief Returns the size of the char at \c pos, never 0 so invalid units are skipped one by one.
+		*/
+		static u32 CharSize( ConstPointer pos );
+
+		ConstPointer m_pPos;
+		ConstPointer m_pSentenceEnd;
+		ConstPointer m_pEnd;
+		// Keeps the data alive, empty if the iterator was not created by a string
+		BufferType m_Buffer;
+	};
+}
+
+#endif // utiSegmentation_h__
@@ -0,0 +1,561 @@
+#pragma once
+#ifndef utiSegmentation_inl__
+#define utiSegmentation_inl__
+
+namespace uti
+{
+	//////////////////////////////////////////////////////////////////////////
+	// Grapheme Iterator implementation
+	//////////////////////////////////////////////////////////////////////////
+
+	template< typename StringType >
+	GraphemeIterator< StringType >::GraphemeIterator( ConstPointer pos, ConstPointer end ) :
+		m_pPos( pos ),
+		m_pClusterEnd( pos ),
+		m_pSimpleEnd( pos ),
+		m_pEnd( end )
+	{
+		UTI_ASSERT( pos <= end );
+		FindNext();
+	}
+
+	template< typename StringType >
+	GraphemeIterator< StringType >::GraphemeIterator( const BufferType& buffer, ConstPointer pos, ConstPointer end ) :
+		m_pPos( pos ),
+		m_pClusterEnd( pos ),
+		m_pSimpleEnd( pos ),
+		m_pEnd( end ),
+		m_Buffer( buffer )
+	{
+		UTI_ASSERT( pos <= end );
+		FindNext();
+	}
+
+	template< typename StringType >
+	typename GraphemeIterator< StringType >::Span GraphemeIterator< StringType >::operator*( void ) const
+	{
+		UTI_ASSERT( Valid() );
+		return Span( m_pPos, m_pClusterEnd );
+	}
+
+	template< typename StringType >
+	typename GraphemeIterator< StringType >::ConstPointer GraphemeIterator< StringType >::Pointer( void ) const
+	{
+		return m_pPos;
+	}
+
+	template< typename StringType >
+	u32 GraphemeIterator< StringType >::ClusterSize( void ) const
+	{
+		return static_cast< u32 >( m_pClusterEnd - m_pPos );
+	}
+
+	template< typename StringType >
+	bool GraphemeIterator< StringType >::Valid( void ) const
+	{
+		return m_pPos < m_pEnd;
+	}
+
+	template< typename StringType >
+	bool GraphemeIterator< StringType >::operator==( const GraphemeIterator< StringType >& rhs ) const
+	{
+		return m_pPos == rhs.m_pPos;
+	}
+
+	template< typename StringType >
+	bool GraphemeIterator< StringType >::operator!=( const GraphemeIterator< StringType >& rhs ) const
+	{
+		return m_pPos != rhs.m_pPos;
+	}
+
+	template< typename StringType >
+	GraphemeIterator< StringType >& GraphemeIterator< StringType >::operator++( void )
+	{
+		UTI_ASSERT( Valid() );
+		m_pPos = m_pClusterEnd;
+		FindNext();
+		return *this;
+	}
+
+	template< typename StringType >
+	GraphemeIterator< StringType > GraphemeIterator< StringType >::operator++( int )
+	{
+		GraphemeIterator< StringType > result( *this );
+		++( *this );
+		return result;
+	}
+
+	template< typename StringType >
+	GraphemeIterator< StringType > GraphemeIterator< StringType >::begin( void ) const
+	{
+		return *this;
+	}
+
+	template< typename StringType >
+	GraphemeIterator< StringType > GraphemeIterator< StringType >::end( void ) const
+	{
+		return GraphemeIterator< StringType >( m_pEnd, m_pEnd );
+	}
+
+	template< typename StringType >
+	u32 GraphemeIterator< StringType >::Count( ConstPointer pos, ConstPointer end )
+	{
+		u32 count = 0U;
+		while( pos < end )
+		{
+			u32 run = StringType::SimpleGraphemeRun( pos, static_cast< u32 >( end - pos ) );
+			if( run != 0U )
+			{
+				count += StringType::CountChars( pos, run );
+				pos += run;
+				continue;
+			}
+			pos = FindClusterEnd( pos, end );
+			++count;
+		}
+		return count;
+	}
+
+	template< typename StringType >
+	typename GraphemeIterator< StringType >::ConstPointer GraphemeIterator< StringType >::FindClusterEnd( ConstPointer pos, ConstPointer end )
+	{
+		unicode::GraphemeBreakState state;
+		unicode::BeginGraphemeCluster( state, StringType::ExtractCodePoint( pos ) );
+		pos += CharSize( pos );
+		while( pos < end && !unicode::IsGraphemeBreak( state, StringType::ExtractCodePoint( pos ) ) )
+		{
+			pos += CharSize( pos );
+		}
+		return pos < end ? pos : end;
+	}
+
+	template< typename StringType >
+	u32 GraphemeIterator< StringType >::CharSize( ConstPointer pos )
+	{
+		u32 size = StringType::CharSize( pos );
+		return size != 0U ? size : 1U;
+	}
+
+	template< typename StringType >
+	void GraphemeIterator< StringType >::FindNext( void )
+	{
+		if( m_pPos >= m_pEnd )
+		{
+			m_pClusterEnd = m_pEnd;
+			return;
+		}
+		if( m_pPos >= m_pSimpleEnd )
+		{
+			m_pSimpleEnd = m_pPos + StringType::SimpleGraphemeRun( m_pPos, static_cast< u32 >( m_pEnd - m_pPos ) );
+		}
+		if( m_pPos < m_pSimpleEnd )
+		{
+			m_pClusterEnd = m_pPos + CharSize( m_pPos );
+			return;
+		}
+		m_pClusterEnd = FindClusterEnd( m_pPos, m_pEnd );
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Word Iterator implementation
+	//////////////////////////////////////////////////////////////////////////
+
+	template< typename StringType >
+	WordIterator< StringType >::WordIterator( ConstPointer pos, ConstPointer end ) :
+		m_pPos( pos ),
+		m_pSegmentEnd( pos ),
+		m_pEnd( end ),
+		m_uiRecord( pos < end ? unicode::detail::SegmentationRecord( StringType::ExtractCodePoint( pos ) ) : 0U ),
+		m_bWord( false )
+	{
+		UTI_ASSERT( pos <= end );
+		FindNext();
+	}
+
+	template< typename StringType >
+	WordIterator< StringType >::WordIterator( const BufferType& buffer, ConstPointer pos, ConstPointer end ) :
+		m_pPos( pos ),
+		m_pSegmentEnd( pos ),
+		m_pEnd( end ),
+		m_uiRecord( pos < end ? unicode::detail::SegmentationRecord( StringType::ExtractCodePoint( pos ) ) : 0U ),
+		m_bWord( false ),
+		m_Buffer( buffer )
+	{
+		UTI_ASSERT( pos <= end );
+		FindNext();
+	}
+
+	template< typename StringType >
+	typename WordIterator< StringType >::Span WordIterator< StringType >::operator*( void ) const
+	{
+		UTI_ASSERT( Valid() );
+		return Span( m_pPos, m_pSegmentEnd );
+	}
+
+	template< typename StringType >
+	typename WordIterator< StringType >::ConstPointer WordIterator< StringType >::Pointer( void ) const
+	{
+		return m_pPos;
+	}
+
+	template< typename StringType >
+	u32 WordIterator< StringType >::SegmentSize( void ) const
+	{
+		return static_cast< u32 >( m_pSegmentEnd - m_pPos );
+	}
+
+	template< typename StringType >
+	bool WordIterator< StringType >::IsWord( void ) const
+	{
+		return m_bWord;
+	}
+
+	template< typename StringType >
+	bool WordIterator< StringType >::Valid( void ) const
+	{
+		return m_pPos < m_pEnd;
+	}
+
+	template< typename StringType >
+	bool WordIterator< StringType >::operator==( const WordIterator< StringType >& rhs ) const
+	{
+		return m_pPos == rhs.m_pPos;
+	}
+
+	template< typename StringType >
+	bool WordIterator< StringType >::operator!=( const WordIterator< StringType >& rhs ) const
+	{
+		return m_pPos != rhs.m_pPos;
+	}
+
+	template< typename StringType >
+	WordIterator< StringType >& WordIterator< StringType >::operator++( void )
+	{
+		UTI_ASSERT( Valid() );
+		m_pPos = m_pSegmentEnd;
+		FindNext();
+		return *this;
+	}
+
+	template< typename StringType >
+	WordIterator< StringType > WordIterator< StringType >::operator++( int )
+	{
+		WordIterator< StringType > result( *this );
+		++( *this );
+		return result;
+	}
+
+	template< typename StringType >
+	WordIterator< StringType > WordIterator< StringType >::begin( void ) const
+	{
+		return *this;
+	}
+
+	template< typename StringType >
+	WordIterator< StringType > WordIterator< StringType >::end( void ) const
+	{
+		return WordIterator< StringType >( m_pEnd, m_pEnd );
+	}
+
+	template< typename StringType >
+	typename WordIterator< StringType >::ConstPointer WordIterator< StringType >::FindSegmentEnd( ConstPointer pos, ConstPointer end, u32& record )
+	{
+		const u32 regional = static_cast< u32 >( unicode::WordBreak::RegionalIndicator );
+		// The properties of the last two code points which are not ignored by WB4, and of the code point in front of the next one
+		u32 previous = unicode::detail::WordProperty( record );
+		// Only needed to tell ASCII letters and digits apart from the others
+		u32 codePoint = previous != static_cast< u32 >( unicode::WordBreak::Other ) ? StringType::ExtractCodePoint( pos ) : 0x80U;
+		u32 beforePrevious = static_cast< u32 >( unicode::WordBreak::Other );
+		u32 last = previous;
+		u32 regionalCount = previous == regional ? 1U : 0U;
+		pos += CharSize( pos );
+		while( pos < end )
+		{
+			// Letters and digits are never split, so a run of them behind another one belongs to the segment.
+			// The rules behind the run only look further back than its last code point behind a MidLetter, MidNum or quote.
+			if( codePoint < 0x80U && ( unicode::detail::IsLetterWordProperty( previous ) || previous == static_cast< u32 >( unicode::WordBreak::Numeric ) ||
+				previous == static_cast< u32 >( unicode::WordBreak::ExtendNumLet ) ) )
+			{
+				u32 run = StringType::AsciiWordRun( pos, static_cast< u32 >( end - pos ) );
+				if( run != 0U )
+				{
+					pos += run;
+					previous = last = unicode::detail::WordProperty( unicode::detail::SegmentationRecord( StringType::ExtractCodePoint( pos - 1U ) ) );
+					regionalCount = 0U;
+					if( pos >= end )
+					{
+						break;
+					}
+				}
+			}
+			u32 size = CharSize( pos );
+			codePoint = StringType::ExtractCodePoint( pos );
+			record = unicode::detail::SegmentationRecord( codePoint );
+			u32 next = unicode::detail::WordProperty( record );
+			u32 rule = unicode::detail::WordRule( previous, next );
+			// WB3c and WB3d see the code point in front of the next one, even if WB4 ignores it
+			if( ( last == static_cast< u32 >( unicode::WordBreak::ZWJ ) && ( unicode::detail::SegmentationTables< void >::GraphemeProperties[ record ] & unicode::ExtendedPictographicFlag ) != 0U ) ||
+				( last == static_cast< u32 >( unicode::WordBreak::WSegSpace ) && next == last ) )
+			{
+				rule = unicode::detail::WordRuleKeep;
+			}
+			bool isBreak = rule == unicode::detail::WordRuleBreak;
+			if( rule == unicode::detail::WordRuleKeepIgnored )
+			{
+				last = next;
+				pos += size;
+				continue;
+			}
+			else if( rule == unicode::detail::WordRuleKeepIfNextLetter )
+			{
+				isBreak = !unicode::detail::IsLetterWordProperty( NextWordProperty( pos + size, end ) );
+			}
+			else if( rule == unicode::detail::WordRuleKeepIfNextHebrew )
+			{
+				isBreak = NextWordProperty( pos + size, end ) != static_cast< u32 >( unicode::WordBreak::HebrewLetter );
+			}
+			else if( rule == unicode::detail::WordRuleKeepIfNextNumeric )
+			{
+				isBreak = NextWordProperty( pos + size, end ) != static_cast< u32 >( unicode::WordBreak::Numeric );
+			}
+			else if( rule == unicode::detail::WordRuleKeepIfPreviousLetter )
+			{
+				isBreak = !unicode::detail::IsLetterWordProperty( beforePrevious );
+			}
+			else if( rule == unicode::detail::WordRuleKeepIfPreviousHebrew )
+			{
+				isBreak = beforePrevious != static_cast< u32 >( unicode::WordBreak::HebrewLetter );
+			}
+			else if( rule == unicode::detail::WordRuleKeepIfPreviousNumeric )
+			{
+				isBreak = beforePrevious != static_cast< u32 >( unicode::WordBreak::Numeric );
+			}
+			else if( rule == unicode::detail::WordRuleKeepIfOddRegional )
+			{
+				isBreak = ( regionalCount & 1U ) == 0U;
+			}
+			if( isBreak )
+			{
+				return pos;
+			}
+			beforePrevious = previous;
+			previous = last = next;
+			regionalCount = next == regional ? regionalCount + 1U : 0U;
+			pos += size;
+		}
+		record = 0U;
+		return end;
+	}
+
+	template< typename StringType >
+	u32 WordIterator< StringType >::NextWordProperty( ConstPointer pos, ConstPointer end )
+	{
+		while( pos < end )
+		{
+			u32 word = unicode::detail::WordProperty( unicode::detail::SegmentationRecord( StringType::ExtractCodePoint( pos ) ) );
+			if( !unicode::detail::IsIgnoredWordProperty( word ) )
+			{
+				return word;
+			}
+			pos += CharSize( pos );
+		}
+		return static_cast< u32 >( unicode::WordBreak::Other );
+	}
+
+	template< typename StringType >
+	u32 WordIterator< StringType >::CharSize( ConstPointer pos )
+	{
+		u32 size = StringType::CharSize( pos );
+		return size != 0U ? size : 1U;
+	}
+
+	template< typename StringType >
+	void WordIterator< StringType >::FindNext( void )
+	{
+		if( m_pPos >= m_pEnd )
+		{
+			m_pSegmentEnd = m_pEnd;
+			m_bWord = false;
+			return;
+		}
+		m_bWord = unicode::detail::IsWordRecord( m_uiRecord );
+		m_pSegmentEnd = FindSegmentEnd( m_pPos, m_pEnd, m_uiRecord );
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Sentence Iterator implementation
+	//////////////////////////////////////////////////////////////////////////
+
+	template< typename StringType >
+	SentenceIterator< StringType >::SentenceIterator( ConstPointer pos, ConstPointer end ) :
+		m_pPos( pos ),
+		m_pSentenceEnd( pos < end ? FindSentenceEnd( pos, end ) : end ),
+		m_pEnd( end )
+	{
+		UTI_ASSERT( pos <= end );
+	}
+
+	template< typename StringType >
+	SentenceIterator< StringType >::SentenceIterator( const BufferType& buffer, ConstPointer pos, ConstPointer end ) :
+		m_pPos( pos ),
+		m_pSentenceEnd( pos < end ? FindSentenceEnd( pos, end ) : end ),
+		m_pEnd( end ),
+		m_Buffer( buffer )
+	{
+		UTI_ASSERT( pos <= end );
+	}
+
+	template< typename StringType >
+	typename SentenceIterator< StringType >::Span SentenceIterator< StringType >::operator*( void ) const
+	{
+		UTI_ASSERT( Valid() );
+		return Span( m_pPos, m_pSentenceEnd );
+	}
+
+	template< typename StringType >
+	typename SentenceIterator< StringType >::ConstPointer SentenceIterator< StringType >::Pointer( void ) const
+	{
+		return m_pPos;
+	}
+
+	template< typename StringType >
+	u32 SentenceIterator< StringType >::SentenceSize( void ) const
+	{
+		return static_cast< u32 >( m_pSentenceEnd - m_pPos );
+	}
+
+	template< typename StringType >
+	bool SentenceIterator< StringType >::Valid( void ) const
+	{
+		return m_pPos < m_pEnd;
+	}
+
+	template< typename StringType >
+	bool SentenceIterator< StringType >::operator==( const SentenceIterator< StringType >& rhs ) const
+	{
+		return m_pPos == rhs.m_pPos;
+	}
+
+	template< typename StringType >
+	bool SentenceIterator< StringType >::operator!=( const SentenceIterator< StringType >& rhs ) const
+	{
+		return m_pPos != rhs.m_pPos;
+	}
+
+	template< typename StringType >
+	SentenceIterator< StringType >& SentenceIterator< StringType >::operator++( void )
+	{
+		UTI_ASSERT( Valid() );
+		m_pPos = m_pSentenceEnd;
+		m_pSentenceEnd = m_pPos < m_pEnd ? FindSentenceEnd( m_pPos, m_pEnd ) : m_pEnd;
+		return *this;
+	}
+
+	template< typename StringType >
+	SentenceIterator< StringType > SentenceIterator< StringType >::operator++( int )
+	{
+		SentenceIterator< StringType > result( *this );
+		++( *this );
+		return result;
+	}
+
+	template< typename StringType >
+	SentenceIterator< StringType > SentenceIterator< StringType >::begin( void ) const
+	{
+		return *this;
+	}
+
+	template< typename StringType >
+	SentenceIterator< StringType > SentenceIterator< StringType >::end( void ) const
+	{
+		return SentenceIterator< StringType >( m_pEnd, m_pEnd );
+	}
+
+	template< typename StringType >
+	typename SentenceIterator< StringType >::ConstPointer SentenceIterator< StringType >::FindSentenceEnd( ConstPointer pos, ConstPointer end )
+	{
+		const u32 stateMask = ( 1U << unicode::SentenceStateBits ) - 1U;
+		u32 codePoint = StringType::ExtractCodePoint( pos );
+		u32 state = unicode::detail::SentenceTransition( unicode::detail::SentenceStateText,
+			unicode::detail::SentenceProperty( unicode::detail::SegmentationRecord( codePoint ) ) ) & stateMask;
+		// The look ahead of SB8 is valid for every code point in front of the sentence start it found
+		ConstPointer lookAhead = pos;
+		bool lower = false;
+		pos += CharSize( pos );
+		while( pos < end )
+		{
+			// Without a pending terminator only a terminator or a separator changes the state, so ASCII text without them is skipped
+			if( codePoint < 0x80U && state <= unicode::detail::SentenceStateLetter )
+			{
+				u32 run = StringType::AsciiSentenceRun( pos, static_cast< u32 >( end - pos ) );
+				if( run != 0U )
+				{
+					pos += run;
+					u32 letter = ( StringType::ExtractCodePoint( pos - 1U ) | 0x20U ) - 'a';
+					state = letter < 26U ? unicode::detail::SentenceStateLetter : unicode::detail::SentenceStateText;
+					if( pos >= end )
+					{
+						break;
+					}
+				}
+			}
+			u32 size = CharSize( pos );
+			codePoint = StringType::ExtractCodePoint( pos );
+			u32 transition = unicode::detail::SentenceTransition( state,
+				unicode::detail::SentenceProperty( unicode::detail::SegmentationRecord( codePoint ) ) );
+			u32 rule = transition >> unicode::SentenceStateBits;
+			if( rule == unicode::detail::SentenceRuleKeepIfLowerElseBreak || rule == unicode::detail::SentenceRuleKeepIfLowerElseKeep )
+			{
+				if( lookAhead <= pos )
+				{
+					lookAhead = FindSentenceStart( pos + size, end, lower );
+				}
+				rule = lower || rule == unicode::detail::SentenceRuleKeepIfLowerElseKeep ? unicode::detail::SentenceRuleKeep : unicode::detail::SentenceRuleBreak;
+			}
+			if( rule == unicode::detail::SentenceRuleBreak )
+			{
+				return pos;
+			}
+			state = transition & stateMask;
+			pos += size;
+		}
+		return end;
+	}
+
+	template< typename StringType >
+	typename SentenceIterator< StringType >::ConstPointer SentenceIterator< StringType >::FindSentenceStart( ConstPointer pos, ConstPointer end, bool& lower )
+	{
+		while( pos < end )
+		{
+			unicode::SentenceBreak sentence = static_cast< unicode::SentenceBreak >(
+				unicode::detail::SentenceProperty( unicode::detail::SegmentationRecord( StringType::ExtractCodePoint( pos ) ) ) );
+			switch( sentence )
+			{
+			case unicode::SentenceBreak::OLetter:
+			case unicode::SentenceBreak::Upper:
+			case unicode::SentenceBreak::Lower:
+			case unicode::SentenceBreak::Sep:
+			case unicode::SentenceBreak::CR:
+			case unicode::SentenceBreak::LF:
+			case unicode::SentenceBreak::ATerm:
+			case unicode::SentenceBreak::STerm:
+				lower = sentence == unicode::SentenceBreak::Lower;
+				return pos;
+			default:
+				break;
+			}
+			pos += CharSize( pos );
+		}
+		lower = false;
+		return end;
+	}
+
+	template< typename StringType >
+	u32 SentenceIterator< StringType >::CharSize( ConstPointer pos )
+	{
+		u32 size = StringType::CharSize( pos );
+		return size != 0U ? size : 1U;
+	}
+}
+
+#endif // utiSegmentation_inl__
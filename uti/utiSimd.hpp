@@ -0,0 +1,242 @@
+#pragma once
+#ifndef utiSimd_h__
+#define utiSimd_h__
+
+namespace uti
+{
+	/**
+	\brief Low level bit and block helpers used by the string kernels.
+
+	Every block function works on BlockSize bytes and returns a bit mask with one bit per unit,
+	the lowest bit belonging to the first unit. If SSE2 is not available the masks are built unit by unit.
+	*/
+	namespace simd
+	{
+		/**
+		\brief Number of bytes processed by a single block function call.
+		*/
+		static const u32 BlockSize = 32U;
+
+		/**
+		\brief Maximum number of values the FindAny functions compare each unit with.
+		*/
+		static const u32 MaxSetSize = 16U;
+
+		/**
+		\brief Returns the number of set bits in \c mask.
+		*/
+		inline u32 PopCount( u32 mask );
+
+		/**
+		\brief Returns the index of the lowest set bit of \c mask, \c mask must not be zero.
+		*/
+		inline u32 LowestBit( u32 mask );
+
+		/**
+		\brief Returns the index of the highest set bit of \c mask, \c mask must not be zero.
+		*/
+		inline u32 HighestBit( u32 mask );
+
+		/**
+		\brief Returns the index of the \c n-th (zero based, counted from the lowest bit) set bit of \c mask.
+
+		\c mask must have at least \c n + 1 bits set.
+		*/
+		inline u32 SelectBit( u32 mask, u32 n );
+
+		/**
+		\brief Returns the index of the lowest set bit of \c mask, \c mask must not be zero.
+		*/
+		inline u32 LowestBit64( u64 mask );
+
+		/**
+		\brief Returns a mask with every bit set, which has an odd number of set bits of \c mask at or below it.
+
+		Applied to a mask of quote chars, this sets the bits from every opening quote up to but not including its closing quote.
+		*/
+		inline u64 PrefixXor( u64 mask );
+
+		/**
+		\brief Returns a mask of the 32 bytes starting at \c bytes, with a bit set for every byte starting a UTF-8 char
+		(every byte which is not a continuation byte 10xxxxxx).
+		*/
+		inline u32 Utf8LeadMask( const unsigned char* bytes );
+
+		/**
+		\brief Returns a mask of the 16 units starting at \c units, with a bit set for every unit starting a UTF-16 char
+		(every unit which is not a low surrogate).
+
+		\param bigEndian \c true if the units are stored byte swapped.
+		*/
+		inline u32 Utf16LeadMask( const unsigned short* units, bool bigEndian );
+
+		/**
+		\brief Returns a mask of the 16 bytes starting at \c bytes, with a bit set for every byte equal to \c value.
+		*/
+		inline u32 ByteEqualMask16( const unsigned char* bytes, unsigned char value );
+
+		/**
+		\brief Returns a mask of the 64 bytes starting at \c bytes, with a bit set for every byte equal to \c value.
+		*/
+		inline u64 ByteEqualMask64( const unsigned char* bytes, unsigned char value );
+
+		/**
+		\brief Returns a mask of the 16 bytes starting at \c bytes, with a bit set for every byte whose highest bit is set.
+		*/
+		inline u32 HighBitMask16( const unsigned char* bytes );
+
+		/**
+		\brief Returns a mask of the 16 bytes starting at \c bytes, with a bit set for every byte which is not smaller than \c threshold.
+		*/
+		inline u32 ByteAtLeastMask16( const unsigned char* bytes, unsigned char threshold );
+
+		/**
+		\brief Returns a mask of the 8 utf-16 units starting at \c units, with a bit set for every unit which is not smaller than \c threshold.
+
+		\param bigEndian \c true if the units are stored byte swapped.
+		*/
+		inline u32 UnitAtLeastMask8( const unsigned short* units, unsigned short threshold, bool bigEndian );
+
+		/**
+		\brief Returns a mask of the 8 utf-16 units starting at \c units, with a bit set for every unit equal to \c value.
+
+		\param bigEndian \c true if the units are stored byte swapped.
+		*/
+		inline u32 UnitEqualMask8( const unsigned short* units, unsigned short value, bool bigEndian );
+
+		/**
+		\brief Returns a mask of the 16 bytes starting at \c bytes, with a bit set for every ASCII letter, digit or underscore.
+		*/
+		inline u32 AsciiWordMask16( const unsigned char* bytes );
+
+		/**
+		\brief Returns a mask of the 8 utf-16 units starting at \c units, with a bit set for every ASCII letter, digit or underscore.
+
+		\param bigEndian \c true if the units are stored byte swapped.
+		*/
+		inline u32 UnitAsciiWordMask8( const unsigned short* units, bool bigEndian );
+
+		/**
+		\brief Returns a mask of the 16 utf-8 bytes starting at \c bytes and the 16 utf-16 units starting at \c units,
+		with a bit set for every position where both hold the same ASCII char.
+
+		\param bigEndian \c true if the units are stored byte swapped.
+		*/
+		inline u32 AsciiMatchMask16( const unsigned char* bytes, const unsigned short* units, bool bigEndian );
+
+		//////////////////////////////////////////////////////////////////////////
+		// Range helpers
+		//////////////////////////////////////////////////////////////////////////
+
+		/**
+		\brief Returns if the \c size bytes starting at \c lhs and \c rhs are equal.
+
+		Compares a whole block per step and stops at the first block containing a difference.
+		*/
+		inline bool Equal( const void* lhs, const void* rhs, u32 size );
+
+		/**
+		\brief Returns the offset of the first byte which differs between the \c size bytes starting at \c lhs and \c rhs,
+		after both were folded with FoldAsciiCase(), or \c size if they are equal.
+
+		The bytes are folded with a range compare and an or per block, bytes outside of 'A' to 'Z' are left untouched.
+		*/
+		inline u32 MismatchIgnoreAsciiCase( const void* lhs, const void* rhs, u32 size );
+
+		/**
+		\brief Returns the offset of the first occurrence of the \c needleSize bytes starting at \c needle
+		in the \c size bytes starting at \c data, or \c size if there is none.
+
+		Every position of a block is compared with the first and the last byte of the needle at once,
+		only positions matching both are compared in full.
+		*/
+		inline u32 Find( const void* data, u32 size, const void* needle, u32 needleSize );
+
+		/**
+		\brief Returns the offset of the last occurrence of the \c needleSize bytes starting at \c needle
+		in the \c size bytes starting at \c data, or \c size if there is none.
+
+		Works like Find(), the blocks are visited from the end.
+		*/
+		inline u32 FindLast( const void* data, u32 size, const void* needle, u32 needleSize );
+
+		/**
+		\brief Returns the offset of the first of the \c size bytes starting at \c data which is equal to one
+		of the \c setSize bytes starting at \c set, or \c size if there is none.
+
+		\c setSize must not be greater than MaxSetSize.
+		*/
+		inline u32 FindAnyByte( const unsigned char* data, u32 size, const unsigned char* set, u32 setSize );
+
+		/**
+		\brief Returns the offset of the last of the \c size bytes starting at \c data which is equal to one
+		of the \c setSize bytes starting at \c set, or \c size if there is none.
+		*/
+		inline u32 FindLastAnyByte( const unsigned char* data, u32 size, const unsigned char* set, u32 setSize );
+
+		/**
+		\brief Returns the index of the first of the \c size units starting at \c data which is equal to one
+		of the \c setSize units starting at \c set, or \c size if there is none.
+
+		The units are compared as they are stored, so the set has to be stored in the same byte order as the data.
+		\c setSize must not be greater than MaxSetSize.
+		*/
+		inline u32 FindAnyUnit( const unsigned short* data, u32 size, const unsigned short* set, u32 setSize );
+
+		/**
+		\brief Returns the index of the last of the \c size units starting at \c data which is equal to one
+		of the \c setSize units starting at \c set, or \c size if there is none.
+		*/
+		inline u32 FindLastAnyUnit( const unsigned short* data, u32 size, const unsigned short* set, u32 setSize );
+
+		//////////////////////////////////////////////////////////////////////////
+		// ASCII case folding
+		//////////////////////////////////////////////////////////////////////////
+
+		/**
+		\brief Returns \c byte converted to lower case if it is an ASCII upper case letter, every other byte is returned unchanged.
+		*/
+		inline unsigned char FoldAsciiCase( unsigned char byte );
+
+		/**
+		\brief Applies FoldAsciiCase() to each of the 8 bytes packed into \c word at once.
+		*/
+		inline u64 FoldAsciiCase8( u64 word );
+
+		/**
+		\brief Returns a mask of the 16 bytes starting at \c bytes, with a bit set for every ASCII letter which changes
+		when it is converted to upper case ( \c upper is \c true ) or to lower case.
+		*/
+		inline u32 AsciiCaseMask16( const unsigned char* bytes, bool upper );
+
+		/**
+		\brief Converts the ASCII letters of the 16 bytes starting at \c src to upper case ( \c upper is \c true ) or to lower case
+		and writes all 16 bytes to \c dst, which may be \c src itself.
+		*/
+		inline void ConvertAsciiCase16( const unsigned char* src, unsigned char* dst, bool upper );
+
+		/**
+		\brief Writes the low bytes of the 8 utf-16 units starting at \c units to \c bytes, every unit has to be an ASCII char.
+
+		\param bigEndian \c true if the units are stored byte swapped.
+		*/
+		inline void NarrowUnits8( const unsigned short* units, unsigned char* bytes, bool bigEndian );
+
+		/**
+		\brief Widens the 16 bytes starting at \c bytes to 16 utf-16 units at \c units.
+
+		\param bigEndian \c true if the units are stored byte swapped.
+		*/
+		inline void WidenBytes16( const unsigned char* bytes, unsigned short* units, bool bigEndian );
+
+		/**
+		\brief Returns the offset of the first byte which differs between the \c size bytes starting at \c lhs and \c rhs,
+		or \c size if they are equal.
+
+		Compares a whole block per step, only the block containing the difference is searched bit by bit.
+		*/
+		inline u32 Mismatch( const void* lhs, const void* rhs, u32 size );
+	}
+}
+
+#endif // utiSimd_h__
@@ -0,0 +1,858 @@
+#pragma once
+#ifndef utiSimd_inl__
+#define utiSimd_inl__
+
+namespace uti
+{
+	namespace simd
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Bit helpers
+		//////////////////////////////////////////////////////////////////////////
+
+		u32 PopCount( u32 mask )
+		{
+#if defined( UTI_POPCNT ) && defined( _MSC_VER )
+			return __popcnt( mask );
+#elif defined( __GNUC__ )
+			return static_cast< u32 >( __builtin_popcount( mask ) );
+#else
+			mask = mask - ( ( mask >> 1U ) & 0x55555555U );
+			mask = ( mask & 0x33333333U ) + ( ( mask >> 2U ) & 0x33333333U );
+			return ( ( ( mask + ( mask >> 4U ) ) & 0x0F0F0F0FU ) * 0x01010101U ) >> 24U;
+#endif // UTI_POPCNT
+		}
+
+		u32 LowestBit( u32 mask )
+		{
+			UTI_ASSERT( mask != 0U );
+#if defined( _MSC_VER )
+			unsigned long index;
+			_BitScanForward( &index, mask );
+			return static_cast< u32 >( index );
+#else
+			return static_cast< u32 >( __builtin_ctz( mask ) );
+#endif // _MSC_VER
+		}
+
+		u32 HighestBit( u32 mask )
+		{
+			UTI_ASSERT( mask != 0U );
+#if defined( _MSC_VER )
+			unsigned long index;
+			_BitScanReverse( &index, mask );
+			return static_cast< u32 >( index );
+#else
+			return 31U - static_cast< u32 >( __builtin_clz( mask ) );
+#endif // _MSC_VER
+		}
+
+		u32 SelectBit( u32 mask, u32 n )
+		{
+			UTI_ASSERT( PopCount( mask ) > n );
+#if defined( UTI_BMI2 )
+			// Deposit a single bit onto the n-th set bit of the mask
+			return LowestBit( _pdep_u32( 1U << n, mask ) );
+#else
+			for( u32 i = 0U; i < n; ++i )
+			{
+				mask &= mask - 1U;
+			}
+			return LowestBit( mask );
+#endif // UTI_BMI2
+		}
+
+		u32 LowestBit64( u64 mask )
+		{
+			UTI_ASSERT( mask != 0U );
+			// Two 32 bit scans, so 32 bit targets need no 64 bit intrinsic
+			u32 low = static_cast< u32 >( mask );
+			return low != 0U ? LowestBit( low ) : 32U + LowestBit( static_cast< u32 >( mask >> 32U ) );
+		}
+
+		u64 PrefixXor( u64 mask )
+		{
+#if defined( UTI_PCLMUL )
+			// Multiplying with all ones without carries xors every bit into all bits above it
+			__m128i value = _mm_loadl_epi64( reinterpret_cast< const __m128i* >( &mask ) );
+			__m128i product = _mm_clmulepi64_si128( value, _mm_set1_epi8( -1 ), 0 );
+			u64 result;
+			_mm_storel_epi64( reinterpret_cast< __m128i* >( &result ), product );
+			return result;
+#else
+			mask ^= mask << 1U;
+			mask ^= mask << 2U;
+			mask ^= mask << 4U;
+			mask ^= mask << 8U;
+			mask ^= mask << 16U;
+			mask ^= mask << 32U;
+			return mask;
+#endif // UTI_PCLMUL
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Block helpers
+		//////////////////////////////////////////////////////////////////////////
+
+		u32 Utf8LeadMask( const unsigned char* bytes )
+		{
+#if defined( UTI_SSE2 )
+			const __m128i continuationMask = _mm_set1_epi8( static_cast< char >( 0xC0U ) );
+			const __m128i continuationBits = _mm_set1_epi8( static_cast< char >( 0x80U ) );
+			__m128i low = _mm_loadu_si128( reinterpret_cast< const __m128i* >( bytes ) );
+			__m128i high = _mm_loadu_si128( reinterpret_cast< const __m128i* >( bytes + 16U ) );
+			u32 lowMask = static_cast< u32 >( _mm_movemask_epi8( _mm_cmpeq_epi8( _mm_and_si128( low, continuationMask ), continuationBits ) ) );
+			u32 highMask = static_cast< u32 >( _mm_movemask_epi8( _mm_cmpeq_epi8( _mm_and_si128( high, continuationMask ), continuationBits ) ) );
+			return ~( lowMask | ( highMask << 16U ) );
+#else
+			u32 mask = 0U;
+			for( u32 i = 0U; i < BlockSize; ++i )
+			{
+				if( ( bytes[ i ] & 0xC0U ) != 0x80U )
+				{
+					mask |= 1U << i;
+				}
+			}
+			return mask;
+#endif // UTI_SSE2
+		}
+
+		u32 Utf16LeadMask( const unsigned short* units, bool bigEndian )
+		{
+			// Low surrogates are 110111xx xxxxxxxx, the swapped masks check the same bits of byte swapped units
+			const unsigned short surrogateMask = bigEndian ? 0x00FCU : 0xFC00U;
+			const unsigned short lowSurrogate = bigEndian ? 0x00DCU : 0xDC00U;
+#if defined( UTI_SSE2 )
+			const __m128i mask = _mm_set1_epi16( static_cast< short >( surrogateMask ) );
+			const __m128i value = _mm_set1_epi16( static_cast< short >( lowSurrogate ) );
+			__m128i block0 = _mm_loadu_si128( reinterpret_cast< const __m128i* >( units ) );
+			__m128i block1 = _mm_loadu_si128( reinterpret_cast< const __m128i* >( units + 8U ) );
+			__m128i trail0 = _mm_cmpeq_epi16( _mm_and_si128( block0, mask ), value );
+			__m128i trail1 = _mm_cmpeq_epi16( _mm_and_si128( block1, mask ), value );
+			// Narrow the 16 bit lanes to bytes, so the byte mask has one bit per unit
+			u32 trailMask = static_cast< u32 >( _mm_movemask_epi8( _mm_packs_epi16( trail0, trail1 ) ) );
+			return ~trailMask & 0xFFFFU;
+#else
+			u32 result = 0U;
+			for( u32 i = 0U; i < BlockSize / 2U; ++i )
+			{
+				if( ( units[ i ] & surrogateMask ) != lowSurrogate )
+				{
+					result |= 1U << i;
+				}
+			}
+			return result;
+#endif // UTI_SSE2
+		}
+
+		u32 ByteEqualMask16( const unsigned char* bytes, unsigned char value )
+		{
+#if defined( UTI_SSE2 )
+			__m128i block = _mm_loadu_si128( reinterpret_cast< const __m128i* >( bytes ) );
+			return static_cast< u32 >( _mm_movemask_epi8( _mm_cmpeq_epi8( block, _mm_set1_epi8( static_cast< char >( value ) ) ) ) );
+#else
+			u32 mask = 0U;
+			for( u32 i = 0U; i < 16U; ++i )
+			{
+				if( bytes[ i ] == value )
+				{
+					mask |= 1U << i;
+				}
+			}
+			return mask;
+#endif // UTI_SSE2
+		}
+
+		u64 ByteEqualMask64( const unsigned char* bytes, unsigned char value )
+		{
+			return static_cast< u64 >( ByteEqualMask16( bytes, value ) ) |
+				( static_cast< u64 >( ByteEqualMask16( bytes + 16U, value ) ) << 16U ) |
+				( static_cast< u64 >( ByteEqualMask16( bytes + 32U, value ) ) << 32U ) |
+				( static_cast< u64 >( ByteEqualMask16( bytes + 48U, value ) ) << 48U );
+		}
+
+		u32 HighBitMask16( const unsigned char* bytes )
+		{
+#if defined( UTI_SSE2 )
+			return static_cast< u32 >( _mm_movemask_epi8( _mm_loadu_si128( reinterpret_cast< const __m128i* >( bytes ) ) ) );
+#else
+			u32 mask = 0U;
+			for( u32 i = 0U; i < 16U; ++i )
+			{
+				mask |= static_cast< u32 >( bytes[ i ] >> 7U ) << i;
+			}
+			return mask;
+#endif // UTI_SSE2
+		}
+
+		u32 ByteAtLeastMask16( const unsigned char* bytes, unsigned char threshold )
+		{
+#if defined( UTI_SSE2 )
+			// max( byte, threshold ) == byte exactly for the bytes at or above the threshold
+			__m128i block = _mm_loadu_si128( reinterpret_cast< const __m128i* >( bytes ) );
+			__m128i atLeast = _mm_cmpeq_epi8( _mm_max_epu8( block, _mm_set1_epi8( static_cast< char >( threshold ) ) ), block );
+			return static_cast< u32 >( _mm_movemask_epi8( atLeast ) );
+#else
+			u32 mask = 0U;
+			for( u32 i = 0U; i < 16U; ++i )
+			{
+				if( bytes[ i ] >= threshold )
+				{
+					mask |= 1U << i;
+				}
+			}
+			return mask;
+#endif // UTI_SSE2
+		}
+
+		u32 UnitAtLeastMask8( const unsigned short* units, unsigned short threshold, bool bigEndian )
+		{
+#if defined( UTI_SSE2 )
+			__m128i block = _mm_loadu_si128( reinterpret_cast< const __m128i* >( units ) );
+			if( bigEndian )
+			{
+				block = _mm_or_si128( _mm_slli_epi16( block, 8 ), _mm_srli_epi16( block, 8 ) );
+			}
+			// The saturated difference to threshold - 1 is zero exactly for the units below the threshold
+			__m128i above = _mm_subs_epu16( block, _mm_set1_epi16( static_cast< short >( threshold - 1U ) ) );
+			__m128i below = _mm_cmpeq_epi16( above, _mm_setzero_si128() );
+			// One bit per unit from the high byte of each 16 bit lane
+			u32 byteMask = static_cast< u32 >( _mm_movemask_epi8( _mm_packs_epi16( below, _mm_setzero_si128() ) ) );
+			return ~byteMask & 0xFFU;
+#else
+			u32 mask = 0U;
+			for( u32 i = 0U; i < 8U; ++i )
+			{
+				u32 unit = units[ i ];
+				if( bigEndian )
+				{
+					unit = ( ( unit & 0xFFU ) << 8U ) | ( unit >> 8U );
+				}
+				if( unit >= threshold )
+				{
+					mask |= 1U << i;
+				}
+			}
+			return mask;
+#endif // UTI_SSE2
+		}
+
+		u32 UnitEqualMask8( const unsigned short* units, unsigned short value, bool bigEndian )
+		{
+			if( bigEndian )
+			{
+				value = static_cast< unsigned short >( ( ( value & 0xFFU ) << 8U ) | ( value >> 8U ) );
+			}
+#if defined( UTI_SSE2 )
+			__m128i block = _mm_loadu_si128( reinterpret_cast< const __m128i* >( units ) );
+			__m128i equal = _mm_cmpeq_epi16( block, _mm_set1_epi16( static_cast< short >( value ) ) );
+			return static_cast< u32 >( _mm_movemask_epi8( _mm_packs_epi16( equal, _mm_setzero_si128() ) ) );
+#else
+			u32 mask = 0U;
+			for( u32 i = 0U; i < 8U; ++i )
+			{
+				if( units[ i ] == value )
+				{
+					mask |= 1U << i;
+				}
+			}
+			return mask;
+#endif // UTI_SSE2
+		}
+
+		u32 AsciiWordMask16( const unsigned char* bytes )
+		{
+#if defined( UTI_SSE2 )
+			// The signed compares leave out every byte above 0x7F, setting the case bit folds the upper case letters onto the lower case ones
+			__m128i block = _mm_loadu_si128( reinterpret_cast< const __m128i* >( bytes ) );
+			__m128i folded = _mm_or_si128( block, _mm_set1_epi8( 0x20 ) );
+			__m128i letters = _mm_and_si128( _mm_cmpgt_epi8( folded, _mm_set1_epi8( 'a' - 1 ) ), _mm_cmplt_epi8( folded, _mm_set1_epi8( 'z' + 1 ) ) );
+			__m128i digits = _mm_and_si128( _mm_cmpgt_epi8( block, _mm_set1_epi8( '0' - 1 ) ), _mm_cmplt_epi8( block, _mm_set1_epi8( '9' + 1 ) ) );
+			__m128i word = _mm_or_si128( _mm_or_si128( letters, digits ), _mm_cmpeq_epi8( block, _mm_set1_epi8( '_' ) ) );
+			return static_cast< u32 >( _mm_movemask_epi8( word ) );
+#else
+			u32 mask = 0U;
+			for( u32 i = 0U; i < 16U; ++i )
+			{
+				unsigned char byte = bytes[ i ];
+				if( static_cast< unsigned char >( ( byte | 0x20U ) - 'a' ) < 26U || static_cast< unsigned char >( byte - '0' ) < 10U || byte == '_' )
+				{
+					mask |= 1U << i;
+				}
+			}
+			return mask;
+#endif // UTI_SSE2
+		}
+
+		u32 UnitAsciiWordMask8( const unsigned short* units, bool bigEndian )
+		{
+#if defined( UTI_SSE2 )
+			__m128i block = _mm_loadu_si128( reinterpret_cast< const __m128i* >( units ) );
+			if( bigEndian )
+			{
+				block = _mm_or_si128( _mm_slli_epi16( block, 8 ), _mm_srli_epi16( block, 8 ) );
+			}
+			// Saturating to bytes turns every unit above 0xFF into 0 or 0xFF, which are no word bytes
+			unsigned char bytes[ 16 ];
+			_mm_storeu_si128( reinterpret_cast< __m128i* >( bytes ), _mm_packus_epi16( block, block ) );
+			return AsciiWordMask16( bytes ) & 0xFFU;
+#else
+			u32 mask = 0U;
+			for( u32 i = 0U; i < 8U; ++i )
+			{
+				u32 unit = units[ i ];
+				if( bigEndian )
+				{
+					unit = ( ( unit & 0xFFU ) << 8U ) | ( unit >> 8U );
+				}
+				if( ( ( unit | 0x20U ) - 'a' ) < 26U || ( unit - '0' ) < 10U || unit == '_' )
+				{
+					mask |= 1U << i;
+				}
+			}
+			return mask;
+#endif // UTI_SSE2
+		}
+
+		u32 AsciiMatchMask16( const unsigned char* bytes, const unsigned short* units, bool bigEndian )
+		{
+#if defined( UTI_SSE2 )
+			__m128i block = _mm_loadu_si128( reinterpret_cast< const __m128i* >( bytes ) );
+			__m128i units0 = _mm_loadu_si128( reinterpret_cast< const __m128i* >( units ) );
+			__m128i units1 = _mm_loadu_si128( reinterpret_cast< const __m128i* >( units + 8U ) );
+			if( bigEndian )
+			{
+				units0 = _mm_or_si128( _mm_slli_epi16( units0, 8 ), _mm_srli_epi16( units0, 8 ) );
+				units1 = _mm_or_si128( _mm_slli_epi16( units1, 8 ), _mm_srli_epi16( units1, 8 ) );
+			}
+			// Units below 0x80 narrow to bytes exactly, every other unit is rejected by the ascii mask
+			const __m128i nonAscii = _mm_set1_epi16( static_cast< short >( 0xFF80U ) );
+			__m128i ascii = _mm_packs_epi16( _mm_cmpeq_epi16( _mm_and_si128( units0, nonAscii ), _mm_setzero_si128() ),
+				_mm_cmpeq_epi16( _mm_and_si128( units1, nonAscii ), _mm_setzero_si128() ) );
+			__m128i equal = _mm_cmpeq_epi8( _mm_packus_epi16( units0, units1 ), block );
+			return static_cast< u32 >( _mm_movemask_epi8( _mm_and_si128( ascii, equal ) ) );
+#else
+			u32 mask = 0U;
+			for( u32 i = 0U; i < 16U; ++i )
+			{
+				u32 unit = units[ i ];
+				if( bigEndian )
+				{
+					unit = ( ( unit & 0xFFU ) << 8U ) | ( unit >> 8U );
+				}
+				if( unit < 0x80U && unit == bytes[ i ] )
+				{
+					mask |= 1U << i;
+				}
+			}
+			return mask;
+#endif // UTI_SSE2
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Range helpers
+		//////////////////////////////////////////////////////////////////////////
+
+		bool Equal( const void* lhs, const void* rhs, u32 size )
+		{
+			const unsigned char* left = static_cast< const unsigned char* >( lhs );
+			const unsigned char* right = static_cast< const unsigned char* >( rhs );
+#if defined( UTI_SSE2 )
+			while( size >= BlockSize )
+			{
+				__m128i low = _mm_cmpeq_epi8( _mm_loadu_si128( reinterpret_cast< const __m128i* >( left ) ),
+					_mm_loadu_si128( reinterpret_cast< const __m128i* >( right ) ) );
+				__m128i high = _mm_cmpeq_epi8( _mm_loadu_si128( reinterpret_cast< const __m128i* >( left + 16U ) ),
+					_mm_loadu_si128( reinterpret_cast< const __m128i* >( right + 16U ) ) );
+				if( _mm_movemask_epi8( _mm_and_si128( low, high ) ) != 0xFFFF )
+				{
+					return false;
+				}
+				left += BlockSize;
+				right += BlockSize;
+				size -= BlockSize;
+			}
+			if( size >= 16U )
+			{
+				__m128i block = _mm_cmpeq_epi8( _mm_loadu_si128( reinterpret_cast< const __m128i* >( left ) ),
+					_mm_loadu_si128( reinterpret_cast< const __m128i* >( right ) ) );
+				if( _mm_movemask_epi8( block ) != 0xFFFF )
+				{
+					return false;
+				}
+				left += 16U;
+				right += 16U;
+				size -= 16U;
+			}
+#endif // UTI_SSE2
+			// Remaining tail (or everything without SSE2)
+			return size == 0U || std::memcmp( left, right, size ) == 0;
+		}
+
+		u32 Mismatch( const void* lhs, const void* rhs, u32 size )
+		{
+			const unsigned char* left = static_cast< const unsigned char* >( lhs );
+			const unsigned char* right = static_cast< const unsigned char* >( rhs );
+			u32 offset = 0U;
+#if defined( UTI_SSE2 )
+			while( offset + BlockSize <= size )
+			{
+				u32 low = static_cast< u32 >( _mm_movemask_epi8( _mm_cmpeq_epi8( _mm_loadu_si128( reinterpret_cast< const __m128i* >( left + offset ) ),
+					_mm_loadu_si128( reinterpret_cast< const __m128i* >( right + offset ) ) ) ) );
+				u32 high = static_cast< u32 >( _mm_movemask_epi8( _mm_cmpeq_epi8( _mm_loadu_si128( reinterpret_cast< const __m128i* >( left + offset + 16U ) ),
+					_mm_loadu_si128( reinterpret_cast< const __m128i* >( right + offset + 16U ) ) ) ) );
+				u32 different = ~( low | ( high << 16U ) );
+				if( different != 0U )
+				{
+					return offset + LowestBit( different );
+				}
+				offset += BlockSize;
+			}
+			if( offset + 16U <= size )
+			{
+				u32 equal = static_cast< u32 >( _mm_movemask_epi8( _mm_cmpeq_epi8( _mm_loadu_si128( reinterpret_cast< const __m128i* >( left + offset ) ),
+					_mm_loadu_si128( reinterpret_cast< const __m128i* >( right + offset ) ) ) ) );
+				if( equal != 0xFFFFU )
+				{
+					return offset + LowestBit( ~equal & 0xFFFFU );
+				}
+				offset += 16U;
+			}
+#else
+			// Without SSE2 compare 8 bytes at once and only search the word containing the difference
+			while( offset + 8U <= size )
+			{
+				u64 leftWord;
+				u64 rightWord;
+				std::memcpy( &leftWord, left + offset, 8U );
+				std::memcpy( &rightWord, right + offset, 8U );
+				if( leftWord != rightWord )
+				{
+					break;
+				}
+				offset += 8U;
+			}
+#endif // UTI_SSE2
+			while( offset < size && left[ offset ] == right[ offset ] )
+			{
+				++offset;
+			}
+			return offset;
+		}
+
+		u32 MismatchIgnoreAsciiCase( const void* lhs, const void* rhs, u32 size )
+		{
+			const unsigned char* left = static_cast< const unsigned char* >( lhs );
+			const unsigned char* right = static_cast< const unsigned char* >( rhs );
+			u32 offset = 0U;
+#if defined( UTI_SSE2 )
+			// Signed compares, so bytes above 0x7F are never in the range and keep their value
+			const __m128i aboveA = _mm_set1_epi8( 'A' - 1 );
+			const __m128i belowZ = _mm_set1_epi8( 'Z' + 1 );
+			const __m128i caseBit = _mm_set1_epi8( 0x20 );
+			while( offset + BlockSize <= size )
+			{
+				u32 equal = 0U;
+				for( u32 half = 0U; half < BlockSize; half += 16U )
+				{
+					__m128i leftBlock = _mm_loadu_si128( reinterpret_cast< const __m128i* >( left + offset + half ) );
+					__m128i rightBlock = _mm_loadu_si128( reinterpret_cast< const __m128i* >( right + offset + half ) );
+					__m128i leftUpper = _mm_and_si128( _mm_cmpgt_epi8( leftBlock, aboveA ), _mm_cmplt_epi8( leftBlock, belowZ ) );
+					__m128i rightUpper = _mm_and_si128( _mm_cmpgt_epi8( rightBlock, aboveA ), _mm_cmplt_epi8( rightBlock, belowZ ) );
+					leftBlock = _mm_or_si128( leftBlock, _mm_and_si128( leftUpper, caseBit ) );
+					rightBlock = _mm_or_si128( rightBlock, _mm_and_si128( rightUpper, caseBit ) );
+					equal |= static_cast< u32 >( _mm_movemask_epi8( _mm_cmpeq_epi8( leftBlock, rightBlock ) ) ) << half;
+				}
+				if( equal != 0xFFFFFFFFU )
+				{
+					return offset + LowestBit( ~equal );
+				}
+				offset += BlockSize;
+			}
+#endif // UTI_SSE2
+			// Short inputs and the tail are folded 8 bytes at a time in general purpose registers
+			while( offset + 8U <= size )
+			{
+				u64 leftWord;
+				u64 rightWord;
+				std::memcpy( &leftWord, left + offset, 8U );
+				std::memcpy( &rightWord, right + offset, 8U );
+				if( FoldAsciiCase8( leftWord ) != FoldAsciiCase8( rightWord ) )
+				{
+					break;
+				}
+				offset += 8U;
+			}
+			while( offset < size && FoldAsciiCase( left[ offset ] ) == FoldAsciiCase( right[ offset ] ) )
+			{
+				++offset;
+			}
+			return offset;
+		}
+
+		u32 Find( const void* data, u32 size, const void* needle, u32 needleSize )
+		{
+			const unsigned char* bytes = static_cast< const unsigned char* >( data );
+			const unsigned char* pattern = static_cast< const unsigned char* >( needle );
+			if( needleSize == 0U )
+			{
+				return 0U;
+			}
+			if( needleSize > size )
+			{
+				return size;
+			}
+			// Number of offsets the needle can start at, the first and the last byte are compared by the filter
+			const u32 positions = size - needleSize + 1U;
+			const u32 last = needleSize - 1U;
+			const u32 inner = needleSize > 2U ? needleSize - 2U : 0U;
+			u32 offset = 0U;
+#if defined( UTI_SSE2 )
+			const __m128i firstByte = _mm_set1_epi8( static_cast< char >( pattern[ 0 ] ) );
+			const __m128i lastByte = _mm_set1_epi8( static_cast< char >( pattern[ last ] ) );
+			while( offset + 16U <= positions )
+			{
+				__m128i head = _mm_cmpeq_epi8( _mm_loadu_si128( reinterpret_cast< const __m128i* >( bytes + offset ) ), firstByte );
+				__m128i tail = _mm_cmpeq_epi8( _mm_loadu_si128( reinterpret_cast< const __m128i* >( bytes + offset + last ) ), lastByte );
+				u32 candidates = static_cast< u32 >( _mm_movemask_epi8( _mm_and_si128( head, tail ) ) );
+				while( candidates != 0U )
+				{
+					u32 position = offset + LowestBit( candidates );
+					if( std::memcmp( bytes + position + 1U, pattern + 1U, inner ) == 0 )
+					{
+						return position;
+					}
+					candidates &= candidates - 1U;
+				}
+				offset += 16U;
+			}
+#endif // UTI_SSE2
+			while( offset < positions )
+			{
+				const void* hit = std::memchr( bytes + offset, pattern[ 0 ], positions - offset );
+				if( hit == nullptr )
+				{
+					break;
+				}
+				offset = static_cast< u32 >( static_cast< const unsigned char* >( hit ) - bytes );
+				if( bytes[ offset + last ] == pattern[ last ] && std::memcmp( bytes + offset + 1U, pattern + 1U, inner ) == 0 )
+				{
+					return offset;
+				}
+				++offset;
+			}
+			return size;
+		}
+
+		u32 FindLast( const void* data, u32 size, const void* needle, u32 needleSize )
+		{
+			const unsigned char* bytes = static_cast< const unsigned char* >( data );
+			const unsigned char* pattern = static_cast< const unsigned char* >( needle );
+			if( needleSize == 0U )
+			{
+				return size;
+			}
+			if( needleSize > size )
+			{
+				return size;
+			}
+			const u32 last = needleSize - 1U;
+			const u32 inner = needleSize > 2U ? needleSize - 2U : 0U;
+			// Every offset in front of this one is still a candidate
+			u32 positions = size - needleSize + 1U;
+#if defined( UTI_SSE2 )
+			const __m128i firstByte = _mm_set1_epi8( static_cast< char >( pattern[ 0 ] ) );
+			const __m128i lastByte = _mm_set1_epi8( static_cast< char >( pattern[ last ] ) );
+			while( positions >= 16U )
+			{
+				const u32 offset = positions - 16U;
+				__m128i head = _mm_cmpeq_epi8( _mm_loadu_si128( reinterpret_cast< const __m128i* >( bytes + offset ) ), firstByte );
+				__m128i tail = _mm_cmpeq_epi8( _mm_loadu_si128( reinterpret_cast< const __m128i* >( bytes + offset + last ) ), lastByte );
+				u32 candidates = static_cast< u32 >( _mm_movemask_epi8( _mm_and_si128( head, tail ) ) );
+				while( candidates != 0U )
+				{
+					u32 bit = HighestBit( candidates );
+					if( std::memcmp( bytes + offset + bit + 1U, pattern + 1U, inner ) == 0 )
+					{
+						return offset + bit;
+					}
+					candidates &= ~( 1U << bit );
+				}
+				positions = offset;
+			}
+#endif // UTI_SSE2
+			while( positions > 0U )
+			{
+				--positions;
+				if( bytes[ positions ] == pattern[ 0 ] && bytes[ positions + last ] == pattern[ last ] &&
+					std::memcmp( bytes + positions + 1U, pattern + 1U, inner ) == 0 )
+				{
+					return positions;
+				}
+			}
+			return size;
+		}
+
+		u32 FindAnyByte( const unsigned char* data, u32 size, const unsigned char* set, u32 setSize )
+		{
+			UTI_ASSERT( setSize <= MaxSetSize );
+			if( setSize == 1U )
+			{
+				// The C library searches a single byte with the widest vectors the cpu has
+				const void* hit = std::memchr( data, set[ 0 ], size );
+				return hit != nullptr ? static_cast< u32 >( static_cast< const unsigned char* >( hit ) - data ) : size;
+			}
+			u32 offset = 0U;
+#if defined( UTI_SSE2 )
+			__m128i values[ MaxSetSize ];
+			for( u32 i = 0U; i < setSize; ++i )
+			{
+				values[ i ] = _mm_set1_epi8( static_cast< char >( set[ i ] ) );
+			}
+			while( offset + 16U <= size )
+			{
+				__m128i block = _mm_loadu_si128( reinterpret_cast< const __m128i* >( data + offset ) );
+				__m128i equal = _mm_setzero_si128();
+				for( u32 i = 0U; i < setSize; ++i )
+				{
+					equal = _mm_or_si128( equal, _mm_cmpeq_epi8( block, values[ i ] ) );
+				}
+				u32 mask = static_cast< u32 >( _mm_movemask_epi8( equal ) );
+				if( mask != 0U )
+				{
+					return offset + LowestBit( mask );
+				}
+				offset += 16U;
+			}
+#endif // UTI_SSE2
+			for( ; offset < size; ++offset )
+			{
+				for( u32 i = 0U; i < setSize; ++i )
+				{
+					if( data[ offset ] == set[ i ] )
+					{
+						return offset;
+					}
+				}
+			}
+			return size;
+		}
+
+		u32 FindLastAnyByte( const unsigned char* data, u32 size, const unsigned char* set, u32 setSize )
+		{
+			UTI_ASSERT( setSize <= MaxSetSize );
+			u32 offset = size;
+#if defined( UTI_SSE2 )
+			__m128i values[ MaxSetSize ];
+			for( u32 i = 0U; i < setSize; ++i )
+			{
+				values[ i ] = _mm_set1_epi8( static_cast< char >( set[ i ] ) );
+			}
+			while( offset >= 16U )
+			{
+				__m128i block = _mm_loadu_si128( reinterpret_cast< const __m128i* >( data + offset - 16U ) );
+				__m128i equal = _mm_setzero_si128();
+				for( u32 i = 0U; i < setSize; ++i )
+				{
+					equal = _mm_or_si128( equal, _mm_cmpeq_epi8( block, values[ i ] ) );
+				}
+				u32 mask = static_cast< u32 >( _mm_movemask_epi8( equal ) );
+				if( mask != 0U )
+				{
+					return offset - 16U + HighestBit( mask );
+				}
+				offset -= 16U;
+			}
+#endif // UTI_SSE2
+			while( offset > 0U )
+			{
+				--offset;
+				for( u32 i = 0U; i < setSize; ++i )
+				{
+					if( data[ offset ] == set[ i ] )
+					{
+						return offset;
+					}
+				}
+			}
+			return size;
+		}
+
+		u32 FindAnyUnit( const unsigned short* data, u32 size, const unsigned short* set, u32 setSize )
+		{
+			UTI_ASSERT( setSize <= MaxSetSize );
+			u32 offset = 0U;
+#if defined( UTI_SSE2 )
+			__m128i values[ MaxSetSize ];
+			for( u32 i = 0U; i < setSize; ++i )
+			{
+				values[ i ] = _mm_set1_epi16( static_cast< short >( set[ i ] ) );
+			}
+			while( offset + 8U <= size )
+			{
+				__m128i block = _mm_loadu_si128( reinterpret_cast< const __m128i* >( data + offset ) );
+				__m128i equal = _mm_setzero_si128();
+				for( u32 i = 0U; i < setSize; ++i )
+				{
+					equal = _mm_or_si128( equal, _mm_cmpeq_epi16( block, values[ i ] ) );
+				}
+				u32 mask = static_cast< u32 >( _mm_movemask_epi8( _mm_packs_epi16( equal, _mm_setzero_si128() ) ) );
+				if( mask != 0U )
+				{
+					return offset + LowestBit( mask );
+				}
+				offset += 8U;
+			}
+#endif // UTI_SSE2
+			for( ; offset < size; ++offset )
+			{
+				for( u32 i = 0U; i < setSize; ++i )
+				{
+					if( data[ offset ] == set[ i ] )
+					{
+						return offset;
+					}
+				}
+			}
+			return size;
+		}
+
+		u32 FindLastAnyUnit( const unsigned short* data, u32 size, const unsigned short* set, u32 setSize )
+		{
+			UTI_ASSERT( setSize <= MaxSetSize );
+			u32 offset = size;
+#if defined( UTI_SSE2 )
+			__m128i values[ MaxSetSize ];
+			for( u32 i = 0U; i < setSize; ++i )
+			{
+				values[ i ] = _mm_set1_epi16( static_cast< short >( set[ i ] ) );
+			}
+			while( offset >= 8U )
+			{
+				__m128i block = _mm_loadu_si128( reinterpret_cast< const __m128i* >( data + offset - 8U ) );
+				__m128i equal = _mm_setzero_si128();
+				for( u32 i = 0U; i < setSize; ++i )
+				{
+					equal = _mm_or_si128( equal, _mm_cmpeq_epi16( block, values[ i ] ) );
+				}
+				u32 mask = static_cast< u32 >( _mm_movemask_epi8( _mm_packs_epi16( equal, _mm_setzero_si128() ) ) );
+				if( mask != 0U )
+				{
+					return offset - 8U + HighestBit( mask );
+				}
+				offset -= 8U;
+			}
+#endif // UTI_SSE2
+			while( offset > 0U )
+			{
+				--offset;
+				for( u32 i = 0U; i < setSize; ++i )
+				{
+					if( data[ offset ] == set[ i ] )
+					{
+						return offset;
+					}
+				}
+			}
+			return size;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// ASCII case folding
+		//////////////////////////////////////////////////////////////////////////
+
+		unsigned char FoldAsciiCase( unsigned char byte )
+		{
+			return static_cast< unsigned char >( byte - 'A' ) < 26U ? static_cast< unsigned char >( byte | 0x20U ) : byte;
+		}
+
+		u64 FoldAsciiCase8( u64 word )
+		{
+			// The high bit of every byte of the sums tells if its low 7 bits are at least 'A' or greater than 'Z',
+			// the low 7 bits never carry into the next byte
+			const u64 lowBits = 0x7F7F7F7F7F7F7F7FULL;
+			const u64 highBits = 0x8080808080808080ULL;
+			u64 heptets = word & lowBits;
+			u64 atLeastA = heptets + 0x3F3F3F3F3F3F3F3FULL;
+			u64 aboveZ = heptets + 0x2525252525252525ULL;
+			u64 upper = atLeastA & ~aboveZ & ~word & highBits;
+			return word | ( upper >> 2U );
+		}
+
+		u32 AsciiCaseMask16( const unsigned char* bytes, bool upper )
+		{
+			const char first = upper ? 'a' : 'A';
+#if defined( UTI_SSE2 )
+			__m128i block = _mm_loadu_si128( reinterpret_cast< const __m128i* >( bytes ) );
+			__m128i letters = _mm_and_si128( _mm_cmpgt_epi8( block, _mm_set1_epi8( static_cast< char >( first - 1 ) ) ),
+				_mm_cmplt_epi8( block, _mm_set1_epi8( static_cast< char >( first + 26 ) ) ) );
+			return static_cast< u32 >( _mm_movemask_epi8( letters ) );
+#else
+			u32 mask = 0U;
+			for( u32 i = 0U; i < 16U; ++i )
+			{
+				if( static_cast< unsigned char >( bytes[ i ] - first ) < 26U )
+				{
+					mask |= 1U << i;
+				}
+			}
+			return mask;
+#endif // UTI_SSE2
+		}
+
+		void ConvertAsciiCase16( const unsigned char* src, unsigned char* dst, bool upper )
+		{
+			const char first = upper ? 'a' : 'A';
+#if defined( UTI_SSE2 )
+			__m128i block = _mm_loadu_si128( reinterpret_cast< const __m128i* >( src ) );
+			__m128i letters = _mm_and_si128( _mm_cmpgt_epi8( block, _mm_set1_epi8( static_cast< char >( first - 1 ) ) ),
+				_mm_cmplt_epi8( block, _mm_set1_epi8( static_cast< char >( first + 26 ) ) ) );
+			// Upper and lower case ASCII letters only differ in the case bit
+			block = _mm_xor_si128( block, _mm_and_si128( letters, _mm_set1_epi8( 0x20 ) ) );
+			_mm_storeu_si128( reinterpret_cast< __m128i* >( dst ), block );
+#else
+			for( u32 i = 0U; i < 16U; ++i )
+			{
+				dst[ i ] = static_cast< unsigned char >( src[ i ] - first ) < 26U ? static_cast< unsigned char >( src[ i ] ^ 0x20U ) : src[ i ];
+			}
+#endif // UTI_SSE2
+		}
+
+		void NarrowUnits8( const unsigned short* units, unsigned char* bytes, bool bigEndian )
+		{
+#if defined( UTI_SSE2 )
+			__m128i block = _mm_loadu_si128( reinterpret_cast< const __m128i* >( units ) );
+			if( bigEndian )
+			{
+				block = _mm_srli_epi16( block, 8 );
+			}
+			_mm_storel_epi64( reinterpret_cast< __m128i* >( bytes ), _mm_packus_epi16( block, block ) );
+#else
+			for( u32 i = 0U; i < 8U; ++i )
+			{
+				bytes[ i ] = static_cast< unsigned char >( bigEndian ? units[ i ] >> 8U : units[ i ] );
+			}
+#endif // UTI_SSE2
+		}
+
+		void WidenBytes16( const unsigned char* bytes, unsigned short* units, bool bigEndian )
+		{
+#if defined( UTI_SSE2 )
+			__m128i block = _mm_loadu_si128( reinterpret_cast< const __m128i* >( bytes ) );
+			__m128i zero = _mm_setzero_si128();
+			// Interleaving with zeros in front puts the byte into the high half of each unit
+			__m128i low = bigEndian ? _mm_unpacklo_epi8( zero, block ) : _mm_unpacklo_epi8( block, zero );
+			__m128i high = bigEndian ? _mm_unpackhi_epi8( zero, block ) : _mm_unpackhi_epi8( block, zero );
+			_mm_storeu_si128( reinterpret_cast< __m128i* >( units ), low );
+			_mm_storeu_si128( reinterpret_cast< __m128i* >( units + 8 ), high );
+#else
+			for( u32 i = 0U; i < 16U; ++i )
+			{
+				units[ i ] = static_cast< unsigned short >( bigEndian ? bytes[ i ] << 8U : bytes[ i ] );
+			}
+#endif // UTI_SSE2
+		}
+	}
+}
+
+#endif // utiSimd_inl__
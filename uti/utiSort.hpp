@@ -0,0 +1,25 @@
+#pragma once
+#ifndef utiSort_h__
+#define utiSort_h__
+
+namespace uti
+{
+	/**
+	\brief Sorts the strings in [ \c begin, \c end ) in code point order, which is the order of UTF8String::Compare().
+
+	The strings are sorted with a multikey quicksort: the next 8 bytes of every string are cached as one big endian
+	integer in a flat entry array, the entries are partitioned by that integer and only the entries with an equal
+	prefix move on to the next 8 bytes. So the string data is read once per 8 bytes of shared prefix instead of once per comparison,
+	and the partitioning runs on the cached keys without following any string pointer.
+	The byte order of utf-8 is the code point order, so the bytes are sorted directly.
+
+	Large partitions are sorted in parallel on up to \c threadCount threads, the calling thread is one of them.
+	The strings are only reordered once the entries are sorted, every string is copied once.
+
+	\param threadCount The maximum number of threads to use, 0 uses one thread per hardware thread.
+	*/
+	template< typename ch, typename Allocator, typename RefCountPolicy >
+	void SortStrings( UTF8String< ch, Allocator, RefCountPolicy >* begin, UTF8String< ch, Allocator, RefCountPolicy >* end, u32 threadCount = 0U );
+}
+
+#endif // utiSort_h__
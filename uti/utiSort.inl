@@ -0,0 +1,293 @@
+#pragma once
+#ifndef utiSort_inl__
+#define utiSort_inl__
+
+namespace uti
+{
+	namespace detail
+	{
+		/**
+		\brief A string to sort, with the 8 bytes following the current sort depth cached in \c Key.
+		*/
+		struct SortEntry
+		{
+			u64 Key;
+			const unsigned char* Data;
+			u32 Size;
+			u32 Index;
+		};
+
+		/**
+		\brief Partitions smaller than this are sorted by insertion.
+		*/
+		static const u32 SortInsertionThreshold = 16U;
+
+		/**
+		\brief Partitions smaller than this are never handed to another thread.
+		*/
+		static const u32 SortParallelThreshold = 1U << 14U;
+
+		/**
+		\brief A range of entries which have equal bytes before \c Depth and their keys loaded for it.
+		*/
+		struct SortPartition
+		{
+			SortEntry* Entries;
+			u32 Count;
+			u32 Depth;
+		};
+
+		struct SortContext
+		{
+			std::atomic< u32 > FreeThreads;
+		};
+
+		/**
+		\brief Returns the 8 bytes starting at \c depth as big endian integer, missing bytes are zero.
+		*/
+		inline u64 LoadSortKey( const unsigned char* data, u32 size, u32 depth )
+		{
+			if( depth >= size )
+			{
+				return 0U;
+			}
+			u32 remaining = size - depth;
+			if( remaining >= 8U )
+			{
+				u64 key;
+				std::memcpy( &key, data + depth, 8U );
+#if defined( _MSC_VER )
+				return _byteswap_uint64( key );
+#else
+				return __builtin_bswap64( key );
+#endif // _MSC_VER
+			}
+			u64 key = 0U;
+			for( u32 i = 0U; i < remaining; ++i )
+			{
+				key |= static_cast< u64 >( data[ depth + i ] ) << ( 56U - 8U * i );
+			}
+			return key;
+		}
+
+		/**
+		\brief Orders two entries with equal bytes before \c depth, whose keys are loaded for \c depth.
+		*/
+		inline bool SortEntryLess( const SortEntry& lhs, const SortEntry& rhs, u32 depth )
+		{
+			if( lhs.Key != rhs.Key )
+			{
+				return lhs.Key < rhs.Key;
+			}
+			u32 next = depth + 8U;
+			u32 lhsRest = lhs.Size > next ? lhs.Size - next : 0U;
+			u32 rhsRest = rhs.Size > next ? rhs.Size - next : 0U;
+			u32 common = lhsRest < rhsRest ? lhsRest : rhsRest;
+			if( common > 0U )
+			{
+				u32 mismatch = simd::Mismatch( lhs.Data + next, rhs.Data + next, common );
+				if( mismatch < common )
+				{
+					return lhs.Data[ next + mismatch ] < rhs.Data[ next + mismatch ];
+				}
+			}
+			// One is a prefix of the other ( the zero padding of the key hides embedded zeros, the size still orders them )
+			return lhs.Size < rhs.Size;
+		}
+
+		inline void SortEntriesByInsertion( SortEntry* entries, u32 count, u32 depth )
+		{
+			for( u32 i = 1U; i < count; ++i )
+			{
+				SortEntry entry = entries[ i ];
+				u32 j = i;
+				for( ; j > 0U && SortEntryLess( entry, entries[ j - 1U ], depth ); --j )
+				{
+					entries[ j ] = entries[ j - 1U ];
+				}
+				entries[ j ] = entry;
+			}
+		}
+
+		inline u64 MedianOfThree( u64 a, u64 b, u64 c )
+		{
+			if( a < b )
+			{
+				return b < c ? b : ( a < c ? c : a );
+			}
+			return a < c ? a : ( b < c ? c : b );
+		}
+
+		inline void SortEntries( SortEntry* entries, u32 count, u32 depth, SortContext& context );
+
+		/**
+		\brief Sorts a partition, on a new thread if it is large and a thread is free.
+
+		\return \c true if a thread was started, which has to be joined.
+		*/
+		inline bool SortEntriesAsync( SortEntry* entries, u32 count, u32 depth, SortContext& context, std::thread& thread )
+		{
+			if( count >= SortParallelThreshold )
+			{
+				u32 freeThreads = context.FreeThreads.load();
+				while( freeThreads > 0U )
+				{
+					if( context.FreeThreads.compare_exchange_weak( freeThreads, freeThreads - 1U ) )
+					{
+						thread = std::thread( [ entries, count, depth, &context ]()
+						{
+							SortEntries( entries, count, depth, context );
+							++context.FreeThreads;
+						} );
+						return true;
+					}
+				}
+			}
+			SortEntries( entries, count, depth, context );
+			return false;
+		}
+
+		void SortEntries( SortEntry* entries, u32 count, u32 depth, SortContext& context )
+		{
+			// A partition sorted on another thread, which runs while the loop continues with the largest partition
+			std::thread pending;
+			while( count > SortInsertionThreshold )
+			{
+				const u64 pivot = MedianOfThree( entries[ 0U ].Key, entries[ count / 2U ].Key, entries[ count - 1U ].Key );
+
+				// Three way partition on the cached keys: [ 0, less ) < pivot, [ less, greater ) == pivot, [ greater, count ) > pivot
+				u32 less = 0U;
+				u32 cur = 0U;
+				u32 greater = count;
+				while( cur < greater )
+				{
+					u64 key = entries[ cur ].Key;
+					if( key < pivot )
+					{
+						std::swap( entries[ less++ ], entries[ cur++ ] );
+					}
+					else if( key > pivot )
+					{
+						std::swap( entries[ cur ], entries[ --greater ] );
+					}
+					else
+					{
+						++cur;
+					}
+				}
+
+				// Entries ending within the key are a prefix of every other entry in the equal partition, so they go first
+				SortEntry* equal = entries + less;
+				u32 equalCount = greater - less;
+				u32 next = depth + 8U;
+				u32 ended = 0U;
+				for( u32 i = 0U; i < equalCount; ++i )
+				{
+					if( equal[ i ].Size <= next )
+					{
+						std::swap( equal[ ended++ ], equal[ i ] );
+					}
+				}
+				if( ended < SortInsertionThreshold )
+				{
+					SortEntriesByInsertion( equal, ended, depth );
+				}
+				else
+				{
+					// Only embedded zeros can tell them apart, so order them by size
+					std::sort( equal, equal + ended, []( const SortEntry& lhs, const SortEntry& rhs )
+					{
+						return lhs.Size < rhs.Size;
+					} );
+				}
+				for( u32 i = ended; i < equalCount; ++i )
+				{
+					equal[ i ].Key = LoadSortKey( equal[ i ].Data, equal[ i ].Size, next );
+				}
+
+				// The smaller and greater partitions keep their depth and keys, the rest of the equal partition continues at the next depth.
+				// Only the two smaller partitions are sorted recursively and the loop continues with the largest,
+				// so each recursion at least halves the entries and the stack depth stays logarithmic.
+				SortPartition partitions[ 3 ] =
+				{
+					{ entries, less, depth },
+					{ equal + ended, equalCount - ended, next },
+					{ entries + greater, count - greater, depth }
+				};
+				u32 largest = 0U;
+				for( u32 i = 1U; i < 3U; ++i )
+				{
+					largest = partitions[ i ].Count > partitions[ largest ].Count ? i : largest;
+				}
+				const SortPartition& first = partitions[ ( largest + 1U ) % 3U ];
+				const SortPartition& second = partitions[ ( largest + 2U ) % 3U ];
+
+				if( pending.joinable() )
+				{
+					pending.join();
+				}
+				SortEntriesAsync( first.Entries, first.Count, first.Depth, context, pending );
+				SortEntries( second.Entries, second.Count, second.Depth, context );
+
+				entries = partitions[ largest ].Entries;
+				count = partitions[ largest ].Count;
+				depth = partitions[ largest ].Depth;
+			}
+			SortEntriesByInsertion( entries, count, depth );
+			if( pending.joinable() )
+			{
+				pending.join();
+			}
+		}
+	}
+
+	template< typename ch, typename Allocator, typename RefCountPolicy >
+	void SortStrings( UTF8String< ch, Allocator, RefCountPolicy >* begin, UTF8String< ch, Allocator, RefCountPolicy >* end, u32 threadCount /*= 0U*/ )
+	{
+		UTI_ASSERT( begin <= end );
+		u32 count = static_cast< u32 >( end - begin );
+		if( count < 2U )
+		{
+			return;
+		}
+
+		Allocator alloc;
+		detail::SortEntry* entries = static_cast< detail::SortEntry* >( alloc.AllocateBytes( count * sizeof( detail::SortEntry ) ) );
+		for( u32 i = 0U; i < count; ++i )
+		{
+			detail::SortEntry& entry = entries[ i ];
+			entry.Data = reinterpret_cast< const unsigned char* >( begin[ i ].Data() );
+			entry.Size = begin[ i ].Size();
+			entry.Index = i;
+			entry.Key = detail::LoadSortKey( entry.Data, entry.Size, 0U );
+		}
+
+		if( threadCount == 0U )
+		{
+			threadCount = std::thread::hardware_concurrency();
+		}
+		detail::SortContext context;
+		context.FreeThreads = threadCount > 1U ? threadCount - 1U : 0U;
+		detail::SortEntries( entries, count, 0U, context );
+
+		// Apply the permutation cycle by cycle, moving every string once, so no reference counter is touched.
+		// A move assignment exchanges the strings, the string of the cycle start travels along the cycle and
+		// ends up at its last position without a temporary. A finished position is marked by pointing its entry to itself.
+		for( u32 i = 0U; i < count; ++i )
+		{
+			u32 cur = i;
+			while( entries[ cur ].Index != i )
+			{
+				u32 source = entries[ cur ].Index;
+				begin[ cur ] = std::move( begin[ source ] );
+				entries[ cur ].Index = cur;
+				cur = source;
+			}
+			entries[ cur ].Index = cur;
+		}
+
+		alloc.FreeBytes( entries );
+	}
+}
+
+#endif // utiSort_inl__
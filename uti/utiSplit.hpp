@@ -0,0 +1,169 @@
+#pragma once
+#ifndef utiSplit_h__
+#define utiSplit_h__
+
+namespace uti
+{
+	/**
+	\brief Options of the split iterators, combine them with the | operator.
+	*/
+	enum class SplitOptions : u32
+	{
+		None = 0x0,
+		// Empty fields ( between two adjacent delimiters or at the ends of the string ) are not returned
+		SkipEmpty = 0x1,
+		// The fields are returned from the end of the string to its start, the splits are counted from the end as well
+		Reverse = 0x2
+	};
+
+	inline SplitOptions operator |( SplitOptions lhs, SplitOptions rhs );
+
+	/**
+	\brief Returns if \c option is set in \c options.
+	*/
+	inline bool HasSplitOption( SplitOptions options, SplitOptions option );
+
+	/**
+	\brief Max split count which does not limit the number of splits.
+	*/
+	static const u32 SplitUnlimited = 0xFFFFFFFFU;
+
+	/**
+	\brief Iterator which splits a generic String at a delimiter string or at every char of a char set.
+
+	Dereferencing the iterator returns a span over the units of the current field, no data is copied
+	and the fields are only searched for on demand. The delimiters are found a block at a time ( see simd::Find() ),
+	a char set is searched for the first units of its chars at once ( see simd::FindAnyByte() ).
+	Delimiters of a single unit are searched like a char set of one char, without comparing the matches again.
+
+	Once the max split count is reached, the rest of the string is returned as the last field.
+	The iterator holds a reference to the delimiter, so a temporary delimiter may be passed.
+	An iterator created by a string ( see UTF8String::Split() ) also holds a reference to the data of the split string,
+	so it stays valid after the string is destroyed, e.g. when a temporary string is split in a range based for loop.
+
+	The iterator is its own range, so it can be used directly in range based for loops:
+
+	\code
+	for( auto field : line.Split( "," ) )
+	\endcode
+
+	\tparam StringType The underlying String class type, which is split.
+	*/
+	template< typename StringType >
+	class SplitIterator
+	{
+	public:
+
+		typedef typename StringType::Type DataType;
+		typedef const DataType* ConstPointer;
+		typedef ByteSpan< StringType > Span;
+		typedef typename StringType::DataType BufferType;
+
+		/**
+		\brief Creates an iterator on the first field of the units from \c begin up to \c end.
+
+		\param pattern The delimiter, or the chars which are delimiters if \c anyChar is \c true.
+		An empty pattern never matches, so the whole range is a single field.
+		\param maxSplits The maximum number of delimiters which split the range.
+		\param isAscii \c true if every unit in the range is known to be an ASCII char.
+		*/
+		SplitIterator( ConstPointer begin, ConstPointer end, const StringType& pattern, bool anyChar,
+			SplitOptions options = SplitOptions::None, u32 maxSplits = SplitUnlimited, bool isAscii = false );
+
+		/**
+		\brief Creates an iterator like above, which holds a reference to \c buffer, the data \c begin and \c end point into.
+		*/
+		SplitIterator( const BufferType& buffer, ConstPointer begin, ConstPointer end, const StringType& pattern, bool anyChar,
+			SplitOptions options = SplitOptions::None, u32 maxSplits = SplitUnlimited, bool isAscii = false );
+
+		/**
+		\brief Returns a span over the units of the current field.
+		*/
+		Span operator *( void ) const;
+
+		/**
+		\brief Returns the address of the current field.
+		*/
+		ConstPointer Pointer( void ) const;
+
+		/**
+		\brief Returns the size (in units) of the current field.
+		*/
+		u32 FieldSize( void ) const;
+
+		bool Valid( void ) const;
+
+		bool operator ==( const SplitIterator< StringType >& rhs ) const;
+		bool operator !=( const SplitIterator< StringType >& rhs ) const;
+
+		SplitIterator< StringType >& operator ++( void );
+		SplitIterator< StringType > operator ++( int );
+
+		SplitIterator< StringType > begin( void ) const;
+		SplitIterator< StringType > end( void ) const;
+
+	protected:
+	private:
+
+		/**
+		\brief Returns the first delimiter in the range from \c pos up to \c end and stores its size in \c matchSize,
+		returns \c end if there is none.
+		*/
+		ConstPointer FindFirstMatch( ConstPointer pos, ConstPointer end, u32& matchSize ) const;
+
+		/**
+		\brief Returns the last delimiter in the range from \c pos up to \c end and stores its size in \c matchSize,
+		returns \c end if there is none.
+		*/
+		ConstPointer FindLastMatch( ConstPointer pos, ConstPointer end, u32& matchSize ) const;
+
+		/**
+		\brief Returns the size of the delimiter starting at \c pos and ending before \c end, or 0 if there is none.
+		*/
+		u32 MatchAt( ConstPointer pos, ConstPointer end ) const;
+
+		/**
+		\brief Returns the size of the delimiter ending at \c end and starting behind \c begin, or 0 if there is none.
+		*/
+		u32 MatchBefore( ConstPointer begin, ConstPointer end ) const;
+
+		/**
+		\brief Returns the first unit from \c pos up to \c end, which starts a char of the char set, or \c end if there is none.
+		*/
+		ConstPointer FindFirstUnit( ConstPointer pos, ConstPointer end ) const;
+
+		/**
+		\brief Returns the last unit from \c pos up to \c end, which starts a char of the char set, or \c end if there is none.
+		*/
+		ConstPointer FindLastUnit( ConstPointer pos, ConstPointer end ) const;
+
+		/**
+		\brief Cuts the next field off the unsearched rest.
+		*/
+		void FindNext( void );
+
+		StringType m_Pattern;
+		// Distinct first units of the chars of the char set, if there are more than simd::MaxSetSize every unit is tested
+		DataType m_FirstUnits[ simd::MaxSetSize ];
+		u32 m_uiFirstUnitCount;
+		// Every delimiter is a single unit, so every unit found by FindFirstUnit() is a match
+		bool m_bSingleUnits;
+
+		ConstPointer m_pFieldBegin;
+		ConstPointer m_pFieldEnd;
+		ConstPointer m_pRestBegin;
+		ConstPointer m_pRestEnd;
+		u32 m_uiSplitsLeft;
+		bool m_bAnyChar;
+		bool m_bSkipEmpty;
+		bool m_bReverse;
+		bool m_bAscii;
+		// The rest was cut off as a field, there are no more fields after the current one
+		bool m_bLastField;
+		bool m_bValid;
+		// Keeps the data alive, empty if the iterator was not created by a string
+		BufferType m_Buffer;
+	};
+}
+
+#endif // utiSplit_h__
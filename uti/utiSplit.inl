@@ -0,0 +1,437 @@
+#pragma once
+#ifndef utiSplit_inl__
+#define utiSplit_inl__
+
+namespace uti
+{
+	//////////////////////////////////////////////////////////////////////////
+	// Split options implementation
+	//////////////////////////////////////////////////////////////////////////
+
+	SplitOptions operator|( SplitOptions lhs, SplitOptions rhs )
+	{
+		return static_cast< SplitOptions >( static_cast< u32 >( lhs ) | static_cast< u32 >( rhs ) );
+	}
+
+	bool HasSplitOption( SplitOptions options, SplitOptions option )
+	{
+		return ( static_cast< u32 >( options ) & static_cast< u32 >( option ) ) != 0U;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Split Iterator implementation
+	//////////////////////////////////////////////////////////////////////////
+
+	template< typename StringType >
+	SplitIterator< StringType >::SplitIterator( ConstPointer begin, ConstPointer end, const StringType& pattern, bool anyChar,
+		SplitOptions options /*= SplitOptions::None */, u32 maxSplits /*= SplitUnlimited */, bool isAscii /*= false */ ) :
+		m_Pattern( pattern ),
+		m_uiFirstUnitCount( 0U ),
+		m_bSingleUnits( false ),
+		m_pFieldBegin( begin ),
+		m_pFieldEnd( begin ),
+		m_pRestBegin( begin ),
+		m_pRestEnd( end ),
+		m_uiSplitsLeft( maxSplits ),
+		m_bAnyChar( anyChar ),
+		m_bSkipEmpty( HasSplitOption( options, SplitOptions::SkipEmpty ) ),
+		m_bReverse( HasSplitOption( options, SplitOptions::Reverse ) ),
+		m_bAscii( isAscii ),
+		m_bLastField( false ),
+		m_bValid( false )
+	{
+		UTI_ASSERT( begin <= end );
+		Span chars = m_Pattern.Bytes();
+		if( !m_bAnyChar && chars.Size() == 1U )
+		{
+			m_FirstUnits[ 0 ] = *chars.begin();
+			m_uiFirstUnitCount = 1U;
+			m_bSingleUnits = true;
+		}
+		else if( m_bAnyChar )
+		{
+			// Collect the first unit of every char, only the positions of these units have to be compared with the chars
+			m_bSingleUnits = true;
+			for( ConstPointer pos = chars.begin(); pos < chars.end() && m_uiFirstUnitCount <= simd::MaxSetSize; )
+			{
+				u32 unit = 0U;
+				while( unit < m_uiFirstUnitCount && m_FirstUnits[ unit ] != *pos )
+				{
+					++unit;
+				}
+				if( unit == m_uiFirstUnitCount )
+				{
+					if( m_uiFirstUnitCount < simd::MaxSetSize )
+					{
+						m_FirstUnits[ m_uiFirstUnitCount ] = *pos;
+					}
+					++m_uiFirstUnitCount;
+				}
+				u32 size = StringType::CharSize( pos );
+				m_bSingleUnits = m_bSingleUnits && size <= 1U;
+				pos += size != 0U ? size : 1U;
+			}
+			m_bSingleUnits = m_bSingleUnits && m_uiFirstUnitCount <= simd::MaxSetSize;
+		}
+		FindNext();
+	}
+
+	template< typename StringType >
+	SplitIterator< StringType >::SplitIterator( const BufferType& buffer, ConstPointer begin, ConstPointer end, const StringType& pattern, bool anyChar,
+		SplitOptions options /*= SplitOptions::None */, u32 maxSplits /*= SplitUnlimited */, bool isAscii /*= false */ ) :
+		SplitIterator( begin, end, pattern, anyChar, options, maxSplits, isAscii )
+	{
+		m_Buffer = buffer;
+	}
+
+	template< typename StringType >
+	typename SplitIterator< StringType >::Span SplitIterator< StringType >::operator*( void ) const
+	{
+		UTI_ASSERT( Valid() );
+		return Span( m_pFieldBegin, m_pFieldEnd, m_bAscii );
+	}
+
+	template< typename StringType >
+	typename SplitIterator< StringType >::ConstPointer SplitIterator< StringType >::Pointer( void ) const
+	{
+		return m_pFieldBegin;
+	}
+
+	template< typename StringType >
+	u32 SplitIterator< StringType >::FieldSize( void ) const
+	{
+		return static_cast< u32 >( m_pFieldEnd - m_pFieldBegin );
+	}
+
+	template< typename StringType >
+	bool SplitIterator< StringType >::Valid( void ) const
+	{
+		return m_bValid;
+	}
+
+	template< typename StringType >
+	bool SplitIterator< StringType >::operator==( const SplitIterator< StringType >& rhs ) const
+	{
+		// Fields never start at the same address, but an empty field of an empty string may start at null
+		return m_bValid == rhs.m_bValid && ( !m_bValid || m_pFieldBegin == rhs.m_pFieldBegin );
+	}
+
+	template< typename StringType >
+	bool SplitIterator< StringType >::operator!=( const SplitIterator< StringType >& rhs ) const
+	{
+		return !( *this == rhs );
+	}
+
+	template< typename StringType >
+	SplitIterator< StringType >& SplitIterator< StringType >::operator++( void )
+	{
+		UTI_ASSERT( Valid() );
+		FindNext();
+		return *this;
+	}
+
+	template< typename StringType >
+	SplitIterator< StringType > SplitIterator< StringType >::operator++( int )
+	{
+		SplitIterator< StringType > result( *this );
+		++( *this );
+		return result;
+	}
+
+	template< typename StringType >
+	SplitIterator< StringType > SplitIterator< StringType >::begin( void ) const
+	{
+		return *this;
+	}
+
+	template< typename StringType >
+	SplitIterator< StringType > SplitIterator< StringType >::end( void ) const
+	{
+		SplitIterator< StringType > result( *this );
+		result.m_bLastField = true;
+		result.m_bValid = false;
+		return result;
+	}
+
+	template< typename StringType >
+	typename SplitIterator< StringType >::ConstPointer SplitIterator< StringType >::FindFirstMatch( ConstPointer pos, ConstPointer end, u32& matchSize ) const
+	{
+		if( m_bSingleUnits )
+		{
+			matchSize = 1U;
+			return FindFirstUnit( pos, end );
+		}
+		if( m_bAnyChar )
+		{
+			while( pos < end )
+			{
+				pos = FindFirstUnit( pos, end );
+				if( pos == end )
+				{
+					break;
+				}
+				matchSize = MatchAt( pos, end );
+				if( matchSize != 0U )
+				{
+					return pos;
+				}
+				++pos;
+			}
+			return end;
+		}
+
+		// Search the raw bytes, matches which do not start on a unit are skipped
+		Span delimiter = m_Pattern.Bytes();
+		const unsigned char* bytes = reinterpret_cast< const unsigned char* >( pos );
+		const u32 size = static_cast< u32 >( end - pos ) * sizeof( DataType );
+		u32 offset = 0U;
+		while( !delimiter.Empty() && offset < size )
+		{
+			u32 found = simd::Find( bytes + offset, size - offset, delimiter.begin(), delimiter.Size() * sizeof( DataType ) );
+			if( found == size - offset )
+			{
+				break;
+			}
+			offset += found;
+			if( offset % sizeof( DataType ) == 0U )
+			{
+				matchSize = delimiter.Size();
+				return pos + offset / sizeof( DataType );
+			}
+			++offset;
+		}
+		return end;
+	}
+
+	template< typename StringType >
+	typename SplitIterator< StringType >::ConstPointer SplitIterator< StringType >::FindLastMatch( ConstPointer pos, ConstPointer end, u32& matchSize ) const
+	{
+		if( m_bSingleUnits )
+		{
+			matchSize = 1U;
+			return FindLastUnit( pos, end );
+		}
+		if( m_bAnyChar )
+		{
+			ConstPointer limit = end;
+			while( pos < limit )
+			{
+				ConstPointer unit = FindLastUnit( pos, limit );
+				if( unit == limit )
+				{
+					break;
+				}
+				matchSize = MatchAt( unit, end );
+				if( matchSize != 0U )
+				{
+					return unit;
+				}
+				limit = unit;
+			}
+			return end;
+		}
+
+		Span delimiter = m_Pattern.Bytes();
+		const unsigned char* bytes = reinterpret_cast< const unsigned char* >( pos );
+		const u32 delimiterBytes = delimiter.Size() * sizeof( DataType );
+		u32 size = static_cast< u32 >( end - pos ) * sizeof( DataType );
+		while( !delimiter.Empty() && size >= delimiterBytes )
+		{
+			u32 found = simd::FindLast( bytes, size, delimiter.begin(), delimiterBytes );
+			if( found == size )
+			{
+				break;
+			}
+			if( found % sizeof( DataType ) == 0U )
+			{
+				matchSize = delimiter.Size();
+				return pos + found / sizeof( DataType );
+			}
+			// Only search in front of the misaligned match
+			size = found + delimiterBytes - 1U;
+		}
+		return end;
+	}
+
+	template< typename StringType >
+	u32 SplitIterator< StringType >::MatchAt( ConstPointer pos, ConstPointer end ) const
+	{
+		Span pattern = m_Pattern.Bytes();
+		const u32 available = static_cast< u32 >( end - pos );
+		if( !m_bAnyChar )
+		{
+			u32 size = pattern.Size();
+			return size != 0U && size <= available && simd::Equal( pos, pattern.begin(), size * sizeof( DataType ) ) ? size : 0U;
+		}
+		for( ConstPointer member = pattern.begin(); member < pattern.end(); )
+		{
+			u32 size = StringType::CharSize( member );
+			size = size != 0U ? size : 1U;
+			if( size <= available && std::memcmp( pos, member, size * sizeof( DataType ) ) == 0 )
+			{
+				return size;
+			}
+			member += size;
+		}
+		return 0U;
+	}
+
+	template< typename StringType >
+	u32 SplitIterator< StringType >::MatchBefore( ConstPointer begin, ConstPointer end ) const
+	{
+		Span pattern = m_Pattern.Bytes();
+		const u32 available = static_cast< u32 >( end - begin );
+		if( !m_bAnyChar )
+		{
+			u32 size = pattern.Size();
+			return size != 0U && size <= available && simd::Equal( end - size, pattern.begin(), size * sizeof( DataType ) ) ? size : 0U;
+		}
+		// A char of the set never matches the tail of another char, its first unit can not be a continuation unit
+		for( ConstPointer member = pattern.begin(); member < pattern.end(); )
+		{
+			u32 size = StringType::CharSize( member );
+			size = size != 0U ? size : 1U;
+			if( size <= available && std::memcmp( end - size, member, size * sizeof( DataType ) ) == 0 )
+			{
+				return size;
+			}
+			member += size;
+		}
+		return 0U;
+	}
+
+	template< typename StringType >
+	typename SplitIterator< StringType >::ConstPointer SplitIterator< StringType >::FindFirstUnit( ConstPointer pos, ConstPointer end ) const
+	{
+		if( m_uiFirstUnitCount > simd::MaxSetSize )
+		{
+			// Too many different first units to compare at once, every unit is a candidate
+			return pos;
+		}
+		const u32 size = static_cast< u32 >( end - pos );
+		if( sizeof( DataType ) == 1U )
+		{
+			return pos + simd::FindAnyByte( reinterpret_cast< const unsigned char* >( pos ), size,
+				reinterpret_cast< const unsigned char* >( m_FirstUnits ), m_uiFirstUnitCount );
+		}
+		if( sizeof( DataType ) == 2U )
+		{
+			return pos + simd::FindAnyUnit( reinterpret_cast< const unsigned short* >( pos ), size,
+				reinterpret_cast< const unsigned short* >( m_FirstUnits ), m_uiFirstUnitCount );
+		}
+		for( ; pos < end; ++pos )
+		{
+			for( u32 unit = 0U; unit < m_uiFirstUnitCount; ++unit )
+			{
+				if( *pos == m_FirstUnits[ unit ] )
+				{
+					return pos;
+				}
+			}
+		}
+		return end;
+	}
+
+	template< typename StringType >
+	typename SplitIterator< StringType >::ConstPointer SplitIterator< StringType >::FindLastUnit( ConstPointer pos, ConstPointer end ) const
+	{
+		if( m_uiFirstUnitCount > simd::MaxSetSize )
+		{
+			return end - 1;
+		}
+		const u32 size = static_cast< u32 >( end - pos );
+		u32 offset = size;
+		if( sizeof( DataType ) == 1U )
+		{
+			offset = simd::FindLastAnyByte( reinterpret_cast< const unsigned char* >( pos ), size,
+				reinterpret_cast< const unsigned char* >( m_FirstUnits ), m_uiFirstUnitCount );
+		}
+		else if( sizeof( DataType ) == 2U )
+		{
+			offset = simd::FindLastAnyUnit( reinterpret_cast< const unsigned short* >( pos ), size,
+				reinterpret_cast< const unsigned short* >( m_FirstUnits ), m_uiFirstUnitCount );
+		}
+		else
+		{
+			while( offset > 0U )
+			{
+				--offset;
+				u32 unit = 0U;
+				while( unit < m_uiFirstUnitCount && pos[ offset ] != m_FirstUnits[ unit ] )
+				{
+					++unit;
+				}
+				if( unit < m_uiFirstUnitCount )
+				{
+					return pos + offset;
+				}
+			}
+			return end;
+		}
+		return pos + offset;
+	}
+
+	template< typename StringType >
+	void SplitIterator< StringType >::FindNext( void )
+	{
+		for( ;; )
+		{
+			if( m_bLastField )
+			{
+				m_bValid = false;
+				return;
+			}
+			u32 matchSize = 0U;
+			ConstPointer match = m_pRestEnd;
+			if( m_uiSplitsLeft != 0U )
+			{
+				match = m_bReverse ? FindLastMatch( m_pRestBegin, m_pRestEnd, matchSize ) : FindFirstMatch( m_pRestBegin, m_pRestEnd, matchSize );
+			}
+			if( match == m_pRestEnd )
+			{
+				// The rest is the last field, when empty fields are skipped it does not start with empty fields either
+				if( m_bSkipEmpty && !m_bReverse )
+				{
+					for( u32 size = MatchAt( m_pRestBegin, m_pRestEnd ); size != 0U; size = MatchAt( m_pRestBegin, m_pRestEnd ) )
+					{
+						m_pRestBegin += size;
+					}
+				}
+				else if( m_bSkipEmpty )
+				{
+					for( u32 size = MatchBefore( m_pRestBegin, m_pRestEnd ); size != 0U; size = MatchBefore( m_pRestBegin, m_pRestEnd ) )
+					{
+						m_pRestEnd -= size;
+					}
+				}
+				m_pFieldBegin = m_pRestBegin;
+				m_pFieldEnd = m_pRestEnd;
+				m_bLastField = true;
+			}
+			else if( m_bReverse )
+			{
+				m_pFieldBegin = match + matchSize;
+				m_pFieldEnd = m_pRestEnd;
+				m_pRestEnd = match;
+			}
+			else
+			{
+				m_pFieldBegin = m_pRestBegin;
+				m_pFieldEnd = match;
+				m_pRestBegin = match + matchSize;
+			}
+			if( m_bSkipEmpty && m_pFieldBegin == m_pFieldEnd )
+			{
+				continue;
+			}
+			if( !m_bLastField )
+			{
+				--m_uiSplitsLeft;
+			}
+			m_bValid = true;
+			return;
+		}
+	}
+}
+
+#endif // utiSplit_inl__
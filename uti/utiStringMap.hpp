@@ -0,0 +1,192 @@
+#pragma once
+#ifndef utiStringMap_h__
+#define utiStringMap_h__
+
+namespace uti
+{
+	/**
+	\brief Open addressing hash map from strings to values of type \c V.
+
+	The map follows the layout of a swiss table: a control array holds one byte per slot, which is either empty, deleted
+	or the top 7 bits of the hash of the key in the slot. A lookup compares a whole group of 16 control bytes against the
+	hash bits with one SIMD compare and only visits the slots which match.
+
+	Every slot stores the full hash, the size and the first units of its key inline, so most mismatches are rejected
+	without leaving the slot array. Keys of up to InlineKeyUnits units are stored inline completely and need no string at all,
+	longer keys are kept as a StringType sharing the data of the inserted string.
+
+	Keys can be looked up by string, by span ( see UTF8String::Bytes() ) or by raw units without creating a string.
+	Raw keys have to be valid, they are compared unit by unit with the stored keys.
+
+	\tparam V The type of the mapped values.
+	\tparam StringType The string type of the keys.
+	\tparam Allocator Is the class used to allocate the control and slot arrays.
+	*/
+	template< typename V, typename StringType = UTF8String< >, typename Allocator = typename StringType::AllocatorType >
+	class StringMap
+	{
+	public:
+
+		typedef typename StringType::Type DataType;
+		typedef typename StringType::Span Span;
+		typedef StringMap< V, StringType, Allocator > ThisType;
+
+		/**
+		\brief Keys up to this number of units are stored inline in the slot.
+		*/
+		static const u32 InlineKeyUnits = 24U / sizeof( DataType );
+
+		/**
+		\brief Creates an empty map, the arrays are allocated with the first insert.
+		*/
+		StringMap( void );
+
+		~StringMap();
+
+		/**
+		\brief Returns the value mapped to \c key, a default constructed value is inserted if there is none.
+		*/
+		V& operator []( const StringType& key );
+
+		/**
+		\brief Maps \c key to \c value, overwriting the value already mapped to it.
+
+		\return \c true if the key was not in the map before.
+		*/
+		bool Set( const StringType& key, const V& value );
+
+		/**
+		\brief Maps the zero terminated \c key to \c value, a string is only created if the key is not in the map and too long to be stored inline.
+
+		\return \c true if the key was not in the map before.
+		*/
+		bool Set( const DataType* key, const V& value );
+
+		/**
+		\brief Returns a pointer to the value mapped to \c key or \c nullptr if there is none.
+		*/
+		V* Find( const StringType& key );
+		const V* Find( const StringType& key ) const;
+
+		/**
+		\brief Returns a pointer to the value mapped to the key viewed by \c key or \c nullptr if there is none.
+		*/
+		V* Find( const Span& key );
+		const V* Find( const Span& key ) const;
+
+		/**
+		\brief Returns a pointer to the value mapped to the zero terminated \c key or \c nullptr if there is none.
+		*/
+		V* Find( const DataType* key );
+		const V* Find( const DataType* key ) const;
+
+		/**
+		\brief Removes \c key from the map.
+
+		\return \c true if the key was in the map.
+		*/
+		bool Remove( const StringType& key );
+		bool Remove( const Span& key );
+
+		/**
+		\brief Returns the number of keys in the map.
+		*/
+		u32 Size( void ) const;
+
+		bool Empty( void ) const;
+
+		/**
+		\brief Removes every key from the map, the arrays are kept for further inserts.
+		*/
+		void Clear( void );
+
+		/**
+		\brief Calls \c function( key, value ) for every key in the map, \c key is a Span viewing the units of the key.
+		*/
+		template< typename Function >
+		void ForEach( Function function ) const;
+
+	protected:
+	private:
+
+		static const u32 GroupSize = 16U;
+		static const unsigned char EmptyControl = 0x80U;
+		static const unsigned char DeletedControl = 0xFEU;
+
+		struct Slot
+		{
+			u64 Hash;
+			u32 Size;
+			DataType Prefix[ InlineKeyUnits ];
+			typename std::aligned_storage< sizeof( StringType ), std::alignment_of< StringType >::value >::type Key;
+			typename std::aligned_storage< sizeof( V ), std::alignment_of< V >::value >::type Value;
+
+			bool IsInline( void ) const
+			{
+				return Size <= InlineKeyUnits;
+			}
+
+			StringType& LongKey( void )
+			{
+				return *reinterpret_cast< StringType* >( &Key );
+			}
+
+			const StringType& LongKey( void ) const
+			{
+				return *reinterpret_cast< const StringType* >( &Key );
+			}
+
+			V& MappedValue( void )
+			{
+				return *reinterpret_cast< V* >( &Value );
+			}
+
+			const V& MappedValue( void ) const
+			{
+				return *reinterpret_cast< const V* >( &Value );
+			}
+
+			const DataType* KeyData( void ) const
+			{
+				return IsInline() ? Prefix : LongKey().Bytes().begin();
+			}
+		};
+
+		StringMap( const ThisType& );
+		ThisType& operator =( const ThisType& );
+
+		/**
+		\brief Returns the index of the slot holding the given key or \c Capacity if it is not in the map.
+		*/
+		u32 FindIndex( u64 hash, const DataType* data, u32 size ) const;
+
+		/**
+		\brief Returns the index of the slot holding the given key, or reserves a free slot for it.
+
+		\param inserted Is set to \c true if a slot was reserved, its hash, size and prefix are set, but the key and value are not constructed.
+		*/
+		u32 FindOrReserve( u64 hash, const DataType* data, u32 size, bool& inserted );
+
+		bool RemoveIndex( u32 index );
+
+		void DestroySlot( Slot& slot );
+
+		void Grow( void );
+
+		void Rehash( u32 capacity );
+
+		static unsigned char ControlBits( u64 hash );
+		static u32 GroupIndex( u64 hash );
+		static u64 HashUnits( const DataType* data, u32 size );
+		static u32 Length( const DataType* text );
+
+		unsigned char* m_pControl;
+		Slot* m_pSlots;
+		u32 m_uiCapacity;
+		u32 m_uiSize;
+		u32 m_uiDeleted;
+		Allocator m_Alloc;
+	};
+}
+
+#endif // utiStringMap_h__
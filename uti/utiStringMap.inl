@@ -0,0 +1,414 @@
+#pragma once
+#ifndef utiStringMap_inl__
+#define utiStringMap_inl__
+
+namespace uti
+{
+	//////////////////////////////////////////////////////////////////////////
+	// String Map implementation
+	//////////////////////////////////////////////////////////////////////////
+
+	template< typename V, typename StringType, typename Allocator >
+	StringMap< V, StringType, Allocator >::StringMap( void ) :
+		m_pControl( nullptr ),
+		m_pSlots( nullptr ),
+		m_uiCapacity( 0U ),
+		m_uiSize( 0U ),
+		m_uiDeleted( 0U )
+	{
+	}
+
+	template< typename V, typename StringType, typename Allocator >
+	StringMap< V, StringType, Allocator >::~StringMap()
+	{
+		Clear();
+		if( m_pControl != nullptr )
+		{
+			m_Alloc.FreeBytes( m_pControl );
+			m_Alloc.FreeBytes( m_pSlots );
+			m_pControl = nullptr;
+			m_pSlots = nullptr;
+		}
+	}
+
+	template< typename V, typename StringType, typename Allocator >
+	V& StringMap< V, StringType, Allocator >::operator[]( const StringType& key )
+	{
+		Span units = key.Bytes();
+		bool inserted;
+		u32 index = FindOrReserve( key.Hash(), units.begin(), units.Size(), inserted );
+		Slot& slot = m_pSlots[ index ];
+		if( inserted )
+		{
+			if( !slot.IsInline() )
+			{
+				new( &slot.Key ) StringType( key );
+			}
+			new( &slot.Value ) V();
+		}
+		return slot.MappedValue();
+	}
+
+	template< typename V, typename StringType, typename Allocator >
+	bool StringMap< V, StringType, Allocator >::Set( const StringType& key, const V& value )
+	{
+		Span units = key.Bytes();
+		bool inserted;
+		u32 index = FindOrReserve( key.Hash(), units.begin(), units.Size(), inserted );
+		Slot& slot = m_pSlots[ index ];
+		if( inserted )
+		{
+			if( !slot.IsInline() )
+			{
+				new( &slot.Key ) StringType( key );
+			}
+			new( &slot.Value ) V( value );
+		}
+		else
+		{
+			slot.MappedValue() = value;
+		}
+		return inserted;
+	}
+
+	template< typename V, typename StringType, typename Allocator >
+	bool StringMap< V, StringType, Allocator >::Set( const DataType* key, const V& value )
+	{
+		u32 size = Length( key );
+		bool inserted;
+		u32 index = FindOrReserve( HashUnits( key, size ), key, size, inserted );
+		Slot& slot = m_pSlots[ index ];
+		if( inserted )
+		{
+			if( !slot.IsInline() )
+			{
+				new( &slot.Key ) StringType( key );
+				UTI_ASSERT( slot.LongKey().Bytes().Size() == size );
+			}
+			new( &slot.Value ) V( value );
+		}
+		else
+		{
+			slot.MappedValue() = value;
+		}
+		return inserted;
+	}
+
+	template< typename V, typename StringType, typename Allocator >
+	V* StringMap< V, StringType, Allocator >::Find( const StringType& key )
+	{
+		return const_cast< V* >( static_cast< const ThisType* >( this )->Find( key ) );
+	}
+
+	template< typename V, typename StringType, typename Allocator >
+	const V* StringMap< V, StringType, Allocator >::Find( const StringType& key ) const
+	{
+		Span units = key.Bytes();
+		u32 index = FindIndex( key.Hash(), units.begin(), units.Size() );
+		return index != m_uiCapacity ? &m_pSlots[ index ].MappedValue() : nullptr;
+	}
+
+	template< typename V, typename StringType, typename Allocator >
+	V* StringMap< V, StringType, Allocator >::Find( const Span& key )
+	{
+		return const_cast< V* >( static_cast< const ThisType* >( this )->Find( key ) );
+	}
+
+	template< typename V, typename StringType, typename Allocator >
+	const V* StringMap< V, StringType, Allocator >::Find( const Span& key ) const
+	{
+		u32 index = FindIndex( HashUnits( key.begin(), key.Size() ), key.begin(), key.Size() );
+		return index != m_uiCapacity ? &m_pSlots[ index ].MappedValue() : nullptr;
+	}
+
+	template< typename V, typename StringType, typename Allocator >
+	V* StringMap< V, StringType, Allocator >::Find( const DataType* key )
+	{
+		return const_cast< V* >( static_cast< const ThisType* >( this )->Find( key ) );
+	}
+
+	template< typename V, typename StringType, typename Allocator >
+	const V* StringMap< V, StringType, Allocator >::Find( const DataType* key ) const
+	{
+		u32 size = Length( key );
+		u32 index = FindIndex( HashUnits( key, size ), key, size );
+		return index != m_uiCapacity ? &m_pSlots[ index ].MappedValue() : nullptr;
+	}
+
+	template< typename V, typename StringType, typename Allocator >
+	bool StringMap< V, StringType, Allocator >::Remove( const StringType& key )
+	{
+		Span units = key.Bytes();
+		return RemoveIndex( FindIndex( key.Hash(), units.begin(), units.Size() ) );
+	}
+
+	template< typename V, typename StringType, typename Allocator >
+	bool StringMap< V, StringType, Allocator >::Remove( const Span& key )
+	{
+		return RemoveIndex( FindIndex( HashUnits( key.begin(), key.Size() ), key.begin(), key.Size() ) );
+	}
+
+	template< typename V, typename StringType, typename Allocator >
+	u32 StringMap< V, StringType, Allocator >::Size( void ) const
+	{
+		return m_uiSize;
+	}
+
+	template< typename V, typename StringType, typename Allocator >
+	bool StringMap< V, StringType, Allocator >::Empty( void ) const
+	{
+		return m_uiSize == 0U;
+	}
+
+	template< typename V, typename StringType, typename Allocator >
+	void StringMap< V, StringType, Allocator >::Clear( void )
+	{
+		for( u32 i = 0U; i < m_uiCapacity; ++i )
+		{
+			if( ( m_pControl[ i ] & 0x80U ) == 0U )
+			{
+				DestroySlot( m_pSlots[ i ] );
+			}
+			m_pControl[ i ] = EmptyControl;
+		}
+		m_uiSize = 0U;
+		m_uiDeleted = 0U;
+	}
+
+	template< typename V, typename StringType, typename Allocator >
+	template< typename Function >
+	void StringMap< V, StringType, Allocator >::ForEach( Function function ) const
+	{
+		for( u32 i = 0U; i < m_uiCapacity; ++i )
+		{
+			if( ( m_pControl[ i ] & 0x80U ) == 0U )
+			{
+				Slot& slot = m_pSlots[ i ];
+				const DataType* key = slot.KeyData();
+				function( Span( key, key + slot.Size ), static_cast< const V& >( slot.MappedValue() ) );
+			}
+		}
+	}
+
+	template< typename V, typename StringType, typename Allocator >
+	u32 StringMap< V, StringType, Allocator >::FindIndex( u64 hash, const DataType* data, u32 size ) const
+	{
+		if( m_uiSize == 0U )
+		{
+			return m_uiCapacity;
+		}
+
+		const u32 groupMask = m_uiCapacity / GroupSize - 1U;
+		const unsigned char control = ControlBits( hash );
+		const u32 prefixSize = size < InlineKeyUnits ? size : InlineKeyUnits;
+		u32 group = GroupIndex( hash ) & groupMask;
+		for( u32 step = 1U;; ++step )
+		{
+			const unsigned char* groupControl = m_pControl + group * GroupSize;
+			for( u32 matches = simd::ByteEqualMask16( groupControl, control ); matches != 0U; matches &= matches - 1U )
+			{
+				u32 index = group * GroupSize + simd::LowestBit( matches );
+				const Slot& slot = m_pSlots[ index ];
+				// The inline prefix rejects most candidates before the key data of long keys is touched
+				if( slot.Hash == hash && slot.Size == size && simd::Equal( slot.Prefix, data, prefixSize * sizeof( DataType ) ) &&
+					( slot.IsInline() || simd::Equal( slot.LongKey().Bytes().begin() + InlineKeyUnits, data + InlineKeyUnits, ( size - InlineKeyUnits ) * sizeof( DataType ) ) ) )
+				{
+					return index;
+				}
+			}
+
+			// A key is never placed behind a group which still has an empty slot
+			if( simd::ByteEqualMask16( groupControl, EmptyControl ) != 0U )
+			{
+				return m_uiCapacity;
+			}
+			group = ( group + step ) & groupMask;
+		}
+	}
+
+	template< typename V, typename StringType, typename Allocator >
+	u32 StringMap< V, StringType, Allocator >::FindOrReserve( u64 hash, const DataType* data, u32 size, bool& inserted )
+	{
+		u32 index = FindIndex( hash, data, size );
+		if( index != m_uiCapacity )
+		{
+			inserted = false;
+			return index;
+		}
+
+		// Keep at least 1/8 of the slots empty, so every probe sequence ends
+		if( ( m_uiSize + m_uiDeleted + 1U ) * 8U > m_uiCapacity * 7U )
+		{
+			Grow();
+		}
+
+		const u32 groupMask = m_uiCapacity / GroupSize - 1U;
+		u32 group = GroupIndex( hash ) & groupMask;
+		for( u32 step = 1U;; ++step )
+		{
+			u32 free = simd::HighBitMask16( m_pControl + group * GroupSize );
+			if( free != 0U )
+			{
+				index = group * GroupSize + simd::LowestBit( free );
+				break;
+			}
+			group = ( group + step ) & groupMask;
+		}
+
+		if( m_pControl[ index ] == DeletedControl )
+		{
+			--m_uiDeleted;
+		}
+		m_pControl[ index ] = ControlBits( hash );
+		++m_uiSize;
+
+		Slot& slot = m_pSlots[ index ];
+		slot.Hash = hash;
+		slot.Size = size;
+		std::memcpy( slot.Prefix, data, ( size < InlineKeyUnits ? size : InlineKeyUnits ) * sizeof( DataType ) );
+		inserted = true;
+		return index;
+	}
+
+	template< typename V, typename StringType, typename Allocator >
+	bool StringMap< V, StringType, Allocator >::RemoveIndex( u32 index )
+	{
+		if( index == m_uiCapacity )
+		{
+			return false;
+		}
+
+		DestroySlot( m_pSlots[ index ] );
+		--m_uiSize;
+
+		// Probes stop at a group with an empty slot, so such a group never had a key placed behind it
+		const unsigned char* groupControl = m_pControl + ( index & ~( GroupSize - 1U ) );
+		if( simd::ByteEqualMask16( groupControl, EmptyControl ) != 0U )
+		{
+			m_pControl[ index ] = EmptyControl;
+		}
+		else
+		{
+			m_pControl[ index ] = DeletedControl;
+			++m_uiDeleted;
+		}
+		return true;
+	}
+
+	template< typename V, typename StringType, typename Allocator >
+	void StringMap< V, StringType, Allocator >::DestroySlot( Slot& slot )
+	{
+		if( !slot.IsInline() )
+		{
+			slot.LongKey().~StringType();
+		}
+		slot.MappedValue().~V();
+	}
+
+	template< typename V, typename StringType, typename Allocator >
+	void StringMap< V, StringType, Allocator >::Grow( void )
+	{
+		if( m_uiCapacity == 0U )
+		{
+			Rehash( GroupSize );
+		}
+		else if( m_uiDeleted * 2U >= m_uiSize )
+		{
+			// Mostly deleted slots, placing the keys again frees them without growing
+			Rehash( m_uiCapacity );
+		}
+		else
+		{
+			Rehash( m_uiCapacity * 2U );
+		}
+	}
+
+	template< typename V, typename StringType, typename Allocator >
+	void StringMap< V, StringType, Allocator >::Rehash( u32 capacity )
+	{
+		UTI_ASSERT( capacity >= GroupSize && ( capacity & ( capacity - 1U ) ) == 0U );
+
+		unsigned char* oldControl = m_pControl;
+		Slot* oldSlots = m_pSlots;
+		u32 oldCapacity = m_uiCapacity;
+
+		m_pControl = static_cast< unsigned char* >( m_Alloc.AllocateBytes( capacity ) );
+		m_pSlots = static_cast< Slot* >( m_Alloc.AllocateBytes( capacity * sizeof( Slot ) ) );
+		m_uiCapacity = capacity;
+		m_uiDeleted = 0U;
+		std::memset( m_pControl, EmptyControl, capacity );
+
+		const u32 groupMask = capacity / GroupSize - 1U;
+		for( u32 i = 0U; i < oldCapacity; ++i )
+		{
+			if( ( oldControl[ i ] & 0x80U ) != 0U )
+			{
+				continue;
+			}
+
+			Slot& oldSlot = oldSlots[ i ];
+			u32 group = GroupIndex( oldSlot.Hash ) & groupMask;
+			u32 free = simd::ByteEqualMask16( m_pControl + group * GroupSize, EmptyControl );
+			for( u32 step = 1U; free == 0U; ++step )
+			{
+				group = ( group + step ) & groupMask;
+				free = simd::ByteEqualMask16( m_pControl + group * GroupSize, EmptyControl );
+			}
+
+			u32 index = group * GroupSize + simd::LowestBit( free );
+			Slot& slot = m_pSlots[ index ];
+			m_pControl[ index ] = oldControl[ i ];
+			slot.Hash = oldSlot.Hash;
+			slot.Size = oldSlot.Size;
+			std::memcpy( slot.Prefix, oldSlot.Prefix, sizeof( slot.Prefix ) );
+			if( !oldSlot.IsInline() )
+			{
+				new( &slot.Key ) StringType( oldSlot.LongKey() );
+			}
+			new( &slot.Value ) V( std::move( oldSlot.MappedValue() ) );
+			DestroySlot( oldSlot );
+		}
+
+		if( oldControl != nullptr )
+		{
+			m_Alloc.FreeBytes( oldControl );
+			m_Alloc.FreeBytes( oldSlots );
+		}
+	}
+
+	template< typename V, typename StringType, typename Allocator >
+	unsigned char StringMap< V, StringType, Allocator >::ControlBits( u64 hash )
+	{
+		// The top 7 bits, so they are independent of the group index taken from the low bits
+		return static_cast< unsigned char >( hash >> 57U );
+	}
+
+	template< typename V, typename StringType, typename Allocator >
+	u32 StringMap< V, StringType, Allocator >::GroupIndex( u64 hash )
+	{
+		return static_cast< u32 >( hash );
+	}
+
+	template< typename V, typename StringType, typename Allocator >
+	u64 StringMap< V, StringType, Allocator >::HashUnits( const DataType* data, u32 size )
+	{
+		// Has to match StringType::Hash(), so keys given as string and as units find each other
+		return HashBytes( data, size * sizeof( DataType ) );
+	}
+
+	template< typename V, typename StringType, typename Allocator >
+	u32 StringMap< V, StringType, Allocator >::Length( const DataType* text )
+	{
+		u32 length = 0U;
+		if( text != nullptr )
+		{
+			while( text[ length ] != 0 )
+			{
+				++length;
+			}
+		}
+		return length;
+	}
+}
+
+#endif // utiStringMap_inl__
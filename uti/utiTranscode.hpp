@@ -0,0 +1,75 @@
+#pragma once
+#ifndef utiTranscode_h__
+#define utiTranscode_h__
+
+namespace uti
+{
+	/**
+	\brief Converts the chars of \c text to utf-8, the result has exactly the size it needs.
+
+	Large strings are converted in parallel chunks in two passes: every chunk first calculates its utf-8 size,
+	the sizes are summed up into the offset of each chunk in the result and then every chunk writes its chars at its offset.
+	Chunk starts are moved behind low surrogates, so no surrogate pair is split.
+	Runs of ASCII units are converted 8 units at a time ( see simd::NarrowUnits8() ).
+
+	\tparam StringType8 The utf-8 string type of the result, e.g. UTF8String<>.
+	\param threadCount The maximum number of threads to use, 0 uses one thread per hardware thread.
+	Each thread gets at least transcode::ParallelChunkSize units, so smaller strings are converted on fewer threads.
+	*/
+	template< typename StringType8, typename ch16, BinaryOrder order, typename Allocator16 >
+	StringType8 ToUTF8( const UTF16String< ch16, order, Allocator16 >& text, u32 threadCount = 0U );
+
+	/**
+	\brief Converts the chars of \c text to utf-16 in the byte order of \c StringType16, see ToUTF8().
+
+	Chunk starts are moved behind continuation bytes, so no char is split.
+	Runs of ASCII bytes are converted 16 bytes at a time ( see simd::WidenBytes16() ).
+
+	\tparam StringType16 The utf-16 string type of the result, e.g. UTF16String< wchar_t, BinaryOrder::BigEndian >.
+	*/
+	template< typename StringType16, typename ch8, typename Allocator8, typename RefCountPolicy8 >
+	StringType16 ToUTF16( const UTF8String< ch8, Allocator8, RefCountPolicy8 >& text, u32 threadCount = 0U );
+
+	namespace transcode
+	{
+		/**
+		\brief The minimum number of units ( utf-16 units or utf-8 bytes ) ToUTF8() and ToUTF16() hand to each thread.
+		*/
+		static const u32 ParallelChunkSize = 1U << 18U;
+
+		/**
+		\brief Returns the number of bytes the \c size utf-16 units at \c units take in utf-8.
+
+		\param units Valid utf-16 data in the byte order \c order, starting on a char.
+		*/
+		template< BinaryOrder order, typename ch16 >
+		inline u32 UTF8Size( const ch16* units, u32 size );
+
+		/**
+		\brief Writes the \c size utf-16 units at \c units as utf-8 to \c dst, which has to hold UTF8Size() bytes.
+
+		\return The number of bytes written.
+		*/
+		template< BinaryOrder order, typename ch16, typename ch8 >
+		inline u32 WriteUTF8( const ch16* units, u32 size, ch8* dst );
+
+		/**
+		\brief Returns the number of units the \c size utf-8 bytes at \c bytes take in utf-16.
+
+		\param bytes Valid utf-8 data, starting on a char.
+		*/
+		template< typename ch8 >
+		inline u32 UTF16Size( const ch8* bytes, u32 size );
+
+		/**
+		\brief Writes the \c size utf-8 bytes at \c bytes as utf-16 in the byte order \c order to \c dst,
+		which has to hold UTF16Size() units.
+
+		\return The number of units written.
+		*/
+		template< BinaryOrder order, typename ch8, typename ch16 >
+		inline u32 WriteUTF16( const ch8* bytes, u32 size, ch16* dst );
+	}
+}
+
+#endif // utiTranscode_h__
@@ -0,0 +1,341 @@
+#pragma once
+#ifndef utiTranscode_inl__
+#define utiTranscode_inl__
+
+namespace uti
+{
+	namespace detail
+	{
+		/**
+		\brief Returns the value of a utf-16 unit stored in the byte order \c order.
+		*/
+		template< BinaryOrder order, typename ch16 >
+		inline u32 LoadUnit( ch16 unit )
+		{
+			u32 value = static_cast< u32 >( unit ) & 0xFFFFU;
+			return order == BinaryOrder::BigEndian ? ( ( value & 0xFFU ) << 8U ) | ( value >> 8U ) : value;
+		}
+
+		/**
+		\brief Returns the utf-16 unit with the value \c value stored in the byte order \c order.
+		*/
+		template< BinaryOrder order, typename ch16 >
+		inline ch16 StoreUnit( u32 value )
+		{
+			return static_cast< ch16 >( order == BinaryOrder::BigEndian ? ( ( value & 0xFFU ) << 8U ) | ( value >> 8U ) : value );
+		}
+
+		/**
+		\brief Returns a mask of the 8 units starting at \c units, with a bit set for every surrogate.
+		*/
+		inline u32 SurrogateMask8( const unsigned short* units, bool bigEndian )
+		{
+			return simd::UnitAtLeastMask8( units, 0xD800U, bigEndian ) & ~simd::UnitAtLeastMask8( units, 0xE000U, bigEndian );
+		}
+
+		/**
+		\brief Converts \c size source units in parallel chunks into one buffer of exactly the converted size.
+		The functions read the source units themselves, they get the position and count of the units to look at.
+
+		\param sameSize \c true if every unit is converted to exactly one target unit, which skips the size pass.
+		\param isContinuation Returns if the unit at the given position continues a char, chunks never start on them.
+		\param sizeOf Returns the converted size of the given count of units from the given position.
+		\param write Converts the given count of units from the given position to the given target and returns the converted size.
+		\param resultSize Receives the converted size.
+
+		\return The converted units followed by a zero unit, allocated from \c alloc.
+		*/
+		template< typename Target, typename Allocator, typename ContinuationFunction, typename SizeFunction, typename WriteFunction >
+		Target* TranscodeChunks( u32 size, u32 threadCount, bool sameSize, Allocator& alloc, u32& resultSize,
+			const ContinuationFunction& isContinuation, const SizeFunction& sizeOf, const WriteFunction& write )
+		{
+			const u32 chunkCount = ChunkCount( size, transcode::ParallelChunkSize, threadCount );
+			u32 starts[ MaxChunkCount + 1U ];
+			u32 offsets[ MaxChunkCount + 1U ];
+			for( u32 i = 0U; i < chunkCount; ++i )
+			{
+				u32 start = static_cast< u32 >( static_cast< u64 >( size ) * i / chunkCount );
+				for( u32 skipped = 0U; skipped < 3U && start < size && start != 0U && isContinuation( start ); ++skipped )
+				{
+					++start;
+				}
+				starts[ i ] = start;
+			}
+			starts[ chunkCount ] = size;
+
+			// The sizes are stored one behind their chunk, so the exclusive prefix sum turns them into the offsets in place
+			offsets[ 0 ] = 0U;
+			if( sameSize )
+			{
+				std::memcpy( offsets + 1U, starts + 1U, chunkCount * sizeof( u32 ) );
+			}
+			else
+			{
+				RunChunks( chunkCount, [ & ]( u32 i )
+				{
+					offsets[ i + 1U ] = sizeOf( starts[ i ], starts[ i + 1U ] - starts[ i ] );
+				} );
+				for( u32 i = 1U; i <= chunkCount; ++i )
+				{
+					offsets[ i ] += offsets[ i - 1U ];
+				}
+			}
+
+			resultSize = offsets[ chunkCount ];
+			Target* result = static_cast< Target* >( alloc.AllocateBytes( ( resultSize + 1U ) * sizeof( Target ) ) );
+			RunChunks( chunkCount, [ & ]( u32 i )
+			{
+				u32 written = write( starts[ i ], starts[ i + 1U ] - starts[ i ], result + offsets[ i ] );
+				UTI_ASSERT( written == offsets[ i + 1U ] - offsets[ i ] );
+				( void )written;
+			} );
+			result[ resultSize ] = 0;
+			return result;
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Transcoding implementation
+	//////////////////////////////////////////////////////////////////////////
+
+	template< typename StringType8, typename ch16, BinaryOrder order, typename Allocator16 >
+	StringType8 ToUTF8( const UTF16String< ch16, order, Allocator16 >& text, u32 threadCount /*= 0U */ )
+	{
+		typedef typename StringType8::Type ch8;
+		const ch16* units = text.c_str();
+		typename StringType8::AllocatorType alloc;
+		u32 size = 0U;
+		ch8* data = detail::TranscodeChunks< ch8 >( text.Size() / sizeof( ch16 ), threadCount, text.IsAscii(), alloc, size,
+			[ units ]( u32 pos )
+			{
+				return ( detail::LoadUnit< order >( units[ pos ] ) & 0xFC00U ) == 0xDC00U;
+			},
+			[ units ]( u32 pos, u32 count )
+			{
+				return transcode::UTF8Size< order >( units + pos, count );
+			},
+			[ units ]( u32 pos, u32 count, ch8* dst )
+			{
+				return transcode::WriteUTF8< order >( units + pos, count, dst );
+			} );
+		return StringType8( typename StringType8::DataType( data ), size, text.CharCount(), text.IsAscii() );
+	}
+
+	template< typename StringType16, typename ch8, typename Allocator8, typename RefCountPolicy8 >
+	StringType16 ToUTF16( const UTF8String< ch8, Allocator8, RefCountPolicy8 >& text, u32 threadCount /*= 0U */ )
+	{
+		typedef typename StringType16::Type ch16;
+		const unsigned char* bytes = reinterpret_cast< const unsigned char* >( text.c_str() );
+		typename StringType16::AllocatorType alloc;
+		u32 size = 0U;
+		ch16* data = detail::TranscodeChunks< ch16 >( text.Size(), threadCount, text.IsAscii(), alloc, size,
+			[ bytes ]( u32 pos )
+			{
+				return ( bytes[ pos ] & 0xC0U ) == 0x80U;
+			},
+			[ bytes ]( u32 pos, u32 count )
+			{
+				return transcode::UTF16Size( bytes + pos, count );
+			},
+			[ bytes ]( u32 pos, u32 count, ch16* dst )
+			{
+				return transcode::WriteUTF16< StringType16::Order >( bytes + pos, count, dst );
+			} );
+		return StringType16( typename StringType16::DataType( data ), size, text.CharCount(), text.IsAscii() );
+	}
+
+	namespace transcode
+	{
+		template< BinaryOrder order, typename ch16 >
+		u32 UTF8Size( const ch16* units, u32 size )
+		{
+			const bool bigEndian = order == BinaryOrder::BigEndian;
+			u32 result = 0U;
+			u32 pos = 0U;
+			while( pos < size )
+			{
+				u32 blockEnd = size;
+				if( sizeof( ch16 ) == 2U && pos + 8U <= size )
+				{
+					// Every unit takes one byte, one more from U+0080 on and one more from U+0800 on
+					const unsigned short* block = reinterpret_cast< const unsigned short* >( units + pos );
+					if( detail::SurrogateMask8( block, bigEndian ) == 0U )
+					{
+						u32 above = simd::UnitAtLeastMask8( block, 0x80U, bigEndian );
+						result += above == 0U ? 8U : 8U + simd::PopCount( above ) + simd::PopCount( simd::UnitAtLeastMask8( block, 0x800U, bigEndian ) );
+						pos += 8U;
+						continue;
+					}
+					// Surrogates have to be paired, which is done unit by unit
+					blockEnd = pos + 8U;
+				}
+				while( pos < blockEnd )
+				{
+					u32 unit = detail::LoadUnit< order >( units[ pos ] );
+					++pos;
+					if( unit < 0x80U )
+					{
+						result += 1U;
+					}
+					else if( unit < 0x800U )
+					{
+						result += 2U;
+					}
+					else if( ( unit & 0xFC00U ) == 0xD800U && pos < size && ( detail::LoadUnit< order >( units[ pos ] ) & 0xFC00U ) == 0xDC00U )
+					{
+						result += 4U;
+						++pos;
+					}
+					else
+					{
+						result += 3U;
+					}
+				}
+			}
+			return result;
+		}
+
+		template< BinaryOrder order, typename ch16, typename ch8 >
+		u32 WriteUTF8( const ch16* units, u32 size, ch8* dst )
+		{
+			const bool bigEndian = order == BinaryOrder::BigEndian;
+			unsigned char* out = reinterpret_cast< unsigned char* >( dst );
+			u32 written = 0U;
+			u32 pos = 0U;
+			while( pos < size )
+			{
+				u32 blockEnd = size;
+				if( sizeof( ch16 ) == 2U && pos + 8U <= size )
+				{
+					const unsigned short* block = reinterpret_cast< const unsigned short* >( units + pos );
+					if( simd::UnitAtLeastMask8( block, 0x80U, bigEndian ) == 0U )
+					{
+						simd::NarrowUnits8( block, out + written, bigEndian );
+						pos += 8U;
+						written += 8U;
+						continue;
+					}
+					blockEnd = pos + 8U;
+				}
+				while( pos < blockEnd )
+				{
+					u32 codePoint = detail::LoadUnit< order >( units[ pos ] );
+					++pos;
+					if( codePoint < 0x80U )
+					{
+						out[ written++ ] = static_cast< unsigned char >( codePoint );
+					}
+					else if( codePoint < 0x800U )
+					{
+						out[ written++ ] = static_cast< unsigned char >( 0xC0U | ( codePoint >> 6U ) );
+						out[ written++ ] = static_cast< unsigned char >( 0x80U | ( codePoint & 0x3FU ) );
+					}
+					else if( ( codePoint & 0xFC00U ) == 0xD800U && pos < size && ( detail::LoadUnit< order >( units[ pos ] ) & 0xFC00U ) == 0xDC00U )
+					{
+						codePoint = 0x10000U + ( ( codePoint & 0x3FFU ) << 10U ) + ( detail::LoadUnit< order >( units[ pos ] ) & 0x3FFU );
+						++pos;
+						out[ written++ ] = static_cast< unsigned char >( 0xF0U | ( codePoint >> 18U ) );
+						out[ written++ ] = static_cast< unsigned char >( 0x80U | ( ( codePoint >> 12U ) & 0x3FU ) );
+						out[ written++ ] = static_cast< unsigned char >( 0x80U | ( ( codePoint >> 6U ) & 0x3FU ) );
+						out[ written++ ] = static_cast< unsigned char >( 0x80U | ( codePoint & 0x3FU ) );
+					}
+					else
+					{
+						out[ written++ ] = static_cast< unsigned char >( 0xE0U | ( codePoint >> 12U ) );
+						out[ written++ ] = static_cast< unsigned char >( 0x80U | ( ( codePoint >> 6U ) & 0x3FU ) );
+						out[ written++ ] = static_cast< unsigned char >( 0x80U | ( codePoint & 0x3FU ) );
+					}
+				}
+			}
+			return written;
+		}
+
+		template< typename ch8 >
+		u32 UTF16Size( const ch8* data, u32 size )
+		{
+			// Every lead byte starts one unit, the leads of 4 byte chars start a surrogate pair
+			const unsigned char* bytes = reinterpret_cast< const unsigned char* >( data );
+			u32 result = 0U;
+			u32 pos = 0U;
+			for( ; pos + simd::BlockSize <= size; pos += simd::BlockSize )
+			{
+				result += simd::PopCount( simd::Utf8LeadMask( bytes + pos ) );
+				result += simd::PopCount( simd::ByteAtLeastMask16( bytes + pos, 0xF0U ) );
+				result += simd::PopCount( simd::ByteAtLeastMask16( bytes + pos + 16U, 0xF0U ) );
+			}
+			for( ; pos < size; ++pos )
+			{
+				result += ( bytes[ pos ] & 0xC0U ) != 0x80U ? 1U : 0U;
+				result += bytes[ pos ] >= 0xF0U ? 1U : 0U;
+			}
+			return result;
+		}
+
+		template< BinaryOrder order, typename ch8, typename ch16 >
+		u32 WriteUTF16( const ch8* data, u32 size, ch16* dst )
+		{
+			const bool bigEndian = order == BinaryOrder::BigEndian;
+			const unsigned char* bytes = reinterpret_cast< const unsigned char* >( data );
+			u32 written = 0U;
+			u32 pos = 0U;
+			while( pos < size )
+			{
+				u32 blockEnd = size;
+				if( pos + 16U <= size )
+				{
+					if( simd::HighBitMask16( bytes + pos ) == 0U )
+					{
+						if( sizeof( ch16 ) == 2U )
+						{
+							simd::WidenBytes16( bytes + pos, reinterpret_cast< unsigned short* >( dst + written ), bigEndian );
+						}
+						else
+						{
+							for( u32 i = 0U; i < 16U; ++i )
+							{
+								dst[ written + i ] = detail::StoreUnit< order, ch16 >( bytes[ pos + i ] );
+							}
+						}
+						pos += 16U;
+						written += 16U;
+						continue;
+					}
+					blockEnd = pos + 16U;
+				}
+				while( pos < blockEnd )
+				{
+					// Every lead byte writes the units UTF16Size() counts for it, stray continuation bytes write nothing
+					u32 lead = bytes[ pos++ ];
+					if( lead < 0x80U )
+					{
+						dst[ written++ ] = detail::StoreUnit< order, ch16 >( lead );
+						continue;
+					}
+					if( lead < 0xC0U )
+					{
+						continue;
+					}
+					u32 length = lead < 0xE0U ? 2U : ( lead < 0xF0U ? 3U : 4U );
+					u32 codePoint = lead & ( 0x7FU >> length );
+					for( u32 i = 1U; i < length && pos < size && ( bytes[ pos ] & 0xC0U ) == 0x80U; ++i )
+					{
+						codePoint = ( codePoint << 6U ) | ( bytes[ pos++ ] & 0x3FU );
+					}
+					if( length < 4U )
+					{
+						dst[ written++ ] = detail::StoreUnit< order, ch16 >( codePoint );
+					}
+					else
+					{
+						codePoint -= 0x10000U;
+						dst[ written++ ] = detail::StoreUnit< order, ch16 >( 0xD800U | ( ( codePoint >> 10U ) & 0x3FFU ) );
+						dst[ written++ ] = detail::StoreUnit< order, ch16 >( 0xDC00U | ( codePoint & 0x3FFU ) );
+					}
+				}
+			}
+			return written;
+		}
+	}
+}
+
+#endif // utiTranscode_inl__
@@ -20,22 +20,45 @@ namespace uti
 
 		typedef const ch ConstType;
 		typedef ch Type;
+		typedef ch* TypePtr;
+		typedef const ch* ConstTypePtr;
 		typedef Allocator AllocatorType;
-		typedef typename UTF16String< ch, order, Allocator> ThisType;
+		typedef ::uti::DefaultRefCountPolicy RefCountPolicyType;
+		typedef UTF16String< ch, order, Allocator> ThisType;
 
 		typedef typename ::uti::UTFByteIterator< ThisType > Iterator;
-		typedef typename ::uti::ReverseIterator_tpl< typename Iterator > ReverseIterator;
+		typedef typename ::uti::ReverseIterator_tpl< Iterator > ReverseIterator;
 
 		typedef typename ::uti::UTFCharIterator< ThisType > CharIterator;
-		typedef typename ::uti::ReverseIterator_tpl< typename CharIterator > CharReverseIterator;
+		typedef typename ::uti::ReverseIterator_tpl< CharIterator > CharReverseIterator;
 		typedef typename ::uti::ReferenceCounted< ch, Allocator > DataType;
 
+		/**
+		\brief The byte order of the units of the string.
+		*/
+		static const ::uti::BinaryOrder Order = order;
+
+		typedef ::uti::ByteSpan< ThisType > Span;
+		typedef ::uti::ConstCharCursor< ThisType > CharCursor;
+		typedef ::uti::GraphemeIterator< ThisType > GraphemeCursor;
+		typedef ::uti::WordIterator< ThisType > WordCursor;
+		typedef ::uti::SentenceIterator< ThisType > SentenceCursor;
+		typedef ::uti::SplitIterator< ThisType > SplitCursor;
+
 		UTF16String( void );
 
 		UTF16String( const ch* text );
 
 		UTF16String( const UTF16String< ch, order, Allocator >& rhs );
 
+		/**
+		\brief Takes over \c data, which has to hold \c size valid units in the byte order of the string followed by a zero unit.
+
+		\param size The number of units without the zero at the end.
+		\param charSize The number of chars in \c data.
+		*/
+		UTF16String( const DataType& data, u32 size, u32 charSize, bool isAscii = false );
+
 		~UTF16String();
 
 		UTF16String< ch, order, Allocator >& operator =( const UTF16String< ch, order, Allocator >& rhs );
@@ -53,6 +76,22 @@ namespace uti
 		*/
 		u32 Concat( const UTF16String< ch, order, Allocator >& rhs );
 
+		/**
+		\brief Returns a char iterator placed on the char with the given index.
+
+		If the string is pure ASCII this is a simple offset, otherwise the string is walked from its start.
+
+		\param charIndex The index of the char, might range from 0<=charIndex<=CharCount().
+		*/
+		inline CharIterator CharIteratorAt( u32 charIndex ) const;
+
+		/**
+		\brief Returns the code point of the char with the given index.
+
+		\param charIndex The index of the char, might range from 0<=charIndex<CharCount().
+		*/
+		inline u32 CodePointAt( u32 charIndex ) const;
+
 
 		/**
 		\brief Returns a pointer to the data of the String.
@@ -91,9 +130,100 @@ namespace uti
 		*/
 		bool Empty( void ) const;
 
+		/**
+		\brief Returns if the string only contains ASCII chars, which means every char is exactly one unit long.
+
+		The flag is recorded while the string is created, so this does not touch the string data.
+		*/
+		bool IsAscii( void ) const;
+
 		bool operator ==( const UTF16String& rhs ) const;
 		bool operator !=( const UTF16String& rhs ) const;
 
+		/**
+		\brief Compares this string with \c rhs in code point order.
+
+		Surrogate pairs are ordered above the units U+E000 to U+FFFF, as their code points are. The units are compared
+		block by block with SIMD, the surrogate fix-up is only applied to the first differing unit.
+
+		\return A value less than, equal to or greater than zero if this string is ordered before, equal to or after \c rhs.
+		*/
+		s32 Compare( const UTF16String& rhs ) const;
+
+		bool operator <( const UTF16String& rhs ) const;
+		bool operator <=( const UTF16String& rhs ) const;
+		bool operator >( const UTF16String& rhs ) const;
+		bool operator >=( const UTF16String& rhs ) const;
+
+		/**
+		\brief Returns if this string and \c rhs share their data, which implies they are equal.
+
+		For strings interned in the same InternPool this is equivalent to operator==, but never touches the data.
+		*/
+		bool SharesData( const UTF16String& rhs ) const;
+
+		/**
+		\brief Returns the number of strings sharing the data of this string.
+		*/
+		u32 ReferenceCount( void ) const;
+
+		/**
+		\brief Returns a seeded 64 bit hash of the string data ( see HashBytes() ).
+
+		The hash is calculated on the first call and cached in the shared header of the string data,
+		so every copy of the string reuses it.
+		*/
+		u64 Hash( void ) const;
+
+		/**
+		\brief Returns the hash of the string data for the given \c seed, which is not cached.
+		*/
+		u64 Hash( u64 seed ) const;
+
+		/**
+		\brief Returns a hash which is equal for all strings containing the same chars, regardless of their encoding.
+
+		It is defined as the Hash() of the utf-8 encoded chars, so it matches the CodePointHash() of a UTF8String with the same text.
+		The chars are transcoded once and the result is cached like Hash().
+		*/
+		u64 CodePointHash( void ) const;
+
+		/**
+		\brief Returns the string with every char mapped to upper case with the full Unicode case mapping ( see unicode::MapCase() ).
+
+		The mapping may change the size and the char count ( e.g. U+00DF is mapped to "SS" ).
+		If no char changes the returned string shares the data of this string.
+		*/
+		UTF16String< ch, order, Allocator > ToUpper( void ) const;
+
+		/**
+		\brief Returns the string with every char mapped to lower case, see ToUpper().
+		*/
+		UTF16String< ch, order, Allocator > ToLower( void ) const;
+
+		/**
+		\brief Returns the case folded string, strings which only differ in case have equal case folded strings, see ToUpper().
+		*/
+		UTF16String< ch, order, Allocator > CaseFold( void ) const;
+
+		/**
+		\brief Maps every char of this string to upper case, see ToUpper().
+
+		The size of the result is calculated first, so at most one buffer is allocated.
+		If this string is the only owner of its data and the size does not change, the data is converted in place.
+		*/
+		void MakeUpper( void );
+
+		/**
+		\brief Maps every char of this string to lower case, see MakeUpper().
+		*/
+		void MakeLower( void );
+
+		/**
+		\brief Case folds every char of this string, see MakeUpper().
+		*/
+		void MakeCaseFolded( void );
+
 		/**
 		\brief Returns an iterator to the start of the string,
 		which iterates until the end of the string.
@@ -105,6 +235,16 @@ namespace uti
 		*/
 		Iterator End( void ) const;
 
+		/**
+		\brief Standard library compatible version of Begin(), which also enables range based for loops over the units of the string.
+		*/
+		Iterator begin( void ) const;
+
+		/**
+		\brief Standard library compatible version of End().
+		*/
+		Iterator end( void ) const;
+
 		/**
 		\brief Returns an iterator which iterates over every char (utf-8 code point) of the String from its start
 
@@ -144,6 +284,75 @@ namespace uti
 		*/
 		ReverseIterator rEnd( void ) const;
 
+		/**
+		\brief Returns a span over every unit of the string ( without the '0' at the end ).
+
+		The span is a pair of raw pointers, which makes it the fastest way to visit the data of the string in tight loops.
+		It does not reference the data and is only valid as long as this string is alive,
+		so it cannot be taken from a temporary string where the compiler supports ref qualifiers.
+		*/
+		Span Bytes( void ) const UTI_LVALUE_THIS;
+#if defined( UTI_REF_QUALIFIERS )
+		Span Bytes( void ) const && = delete;
+#endif // UTI_REF_QUALIFIERS
+
+		/**
+		\brief Returns a cursor over every char of the string, which decodes the code points in place.
+
+		The cursor is a pair of raw pointers, which makes it the fastest way to visit the chars of the string in tight loops.
+		It holds a reference to the data, so it stays valid after this string is destroyed.
+		*/
+		CharCursor Chars( void ) const;
+
+		/**
+		\brief Returns an iterator over the extended grapheme clusters ( user perceived chars ) of the string,
+		which yields a span over the units of each cluster.
+
+		It holds a reference to the data, so it stays valid after this string is destroyed.
+		*/
+		GraphemeCursor Graphemes( void ) const;
+
+		/**
+		\brief Returns the number of extended grapheme clusters in the string, see Graphemes().
+		*/
+		u32 GraphemeCount( void ) const;
+
+		/**
+		\brief Returns an iterator over the word boundary segments ( UAX #29 ) of the string, which yields a span over the units of each segment.
+
+		Words, runs of white space and single punctuation chars are segments of their own, use WordCursor::IsWord() to skip the segments
+		which are no words. It holds a reference to the data, so it stays valid after this string is destroyed.
+		*/
+		WordCursor Words( void ) const;
+
+		/**
+		\brief Returns an iterator over the sentences ( UAX #29 ) of the string, which yields a span over the units of each sentence,
+		including its trailing white space and paragraph separator.
+
+		It holds a reference to the data, so it stays valid after this string is destroyed.
+		*/
+		SentenceCursor Sentences( void ) const;
+
+		/**
+		\brief Returns an iterator over the fields of the string between the occurrences of \c delimiter,
+		which yields a span over the units of each field.
+
+		No field is copied, the delimiters are only searched for while iterating.
+		The iterator holds a reference to the data, so it stays valid after this string is destroyed.
+
+		\param options Skips the empty fields and/or splits from the end of the string.
+		\param maxSplits The maximum number of delimiters the string is split at, the rest of the string is the last field.
+		*/
+		SplitCursor Split( const ThisType& delimiter, SplitOptions options = SplitOptions::None, u32 maxSplits = SplitUnlimited ) const;
+
+		/**
+		\brief Returns an iterator over the fields of the string between the chars which are part of \c charset,
+		which yields a span over the units of each field.
+
+		Works like Split(), but every char of \c charset is a delimiter on its own ( e.g. " \t\n" splits at white space ).
+		*/
+		SplitCursor SplitAny( const ThisType& charset, SplitOptions options = SplitOptions::None, u32 maxSplits = SplitUnlimited ) const;
+
 		/**
 		\brief Checks if the utf-8 char starting at ufchar is a valid char.
 
@@ -168,6 +377,87 @@ namespace uti
 		*/
 		static inline u32 ExtractCodePoint( const ch* utfchar );
 
+		/**
+		\brief Returns the position of the char \c count chars after the char starting at \c pos.
+
+		The chars are counted in blocks using SIMD masks of the units starting a char,
+		so the data is not decoded char by char.
+
+		\param data The data of a valid utf-16 string
+		\param pos The position (in units) of the char to start from
+		\param size The size (in units) of the data, the result is clamped to it
+		\param count The number of chars to skip
+
+		\return The position of the target char or \c size if the data ends before
+		*/
+		static inline u32 AdvanceChars( const ch* data, u32 pos, u32 size, u32 count );
+
+		/**
+		\brief Returns the position of the char \c count chars before the char starting at \c pos.
+
+		\param data The data of a valid utf-16 string
+		\param pos The position (in units) of the char to start from
+		\param count The number of chars to go back
+
+		\return The position of the target char or 0 if the data starts after it
+		*/
+		static inline u32 RetreatChars( const ch* data, u32 pos, u32 count );
+
+		/**
+		\brief Counts the chars in the first \c size units of \c data, using the same block counting as AdvanceChars.
+
+		\param data The data of a valid utf-16 string, starting on a char
+		\param size The number of units to count the chars in
+		*/
+		static inline u32 CountChars( const ch* data, u32 size );
+
+		/**
+		\brief Returns the size (in units) of the run at the start of \c data in which every char is a grapheme cluster of its own,
+		or 0 if there is no such run.
+
+		Whole blocks of 8 units below unicode::detail::GraphemeSimpleLimit without a CR are taken at once.
+		The last char of the blocks is left out of the run, because the char behind it may extend its cluster.
+
+		\param data The data of a valid string, starting on a grapheme cluster
+		\param size The number of units behind \c data
+		*/
+		static inline u32 SimpleGraphemeRun( const ch* data, u32 size );
+
+		/**
+		\brief Returns the number of ASCII letters, digits and underscores at the start of \c data, whole blocks of 8 units are tested at once.
+		There is no word boundary between any of them.
+
+		\param data The data of a valid string
+		\param size The number of units behind \c data
+		*/
+		static inline u32 AsciiWordRun( const ch* data, u32 size );
+
+		/**
+		\brief Returns the number of ASCII chars at the start of \c data which cannot terminate a sentence ( every ASCII char but
+		'.', '!', '?', CR and LF ), whole blocks of 8 units are tested at once.
+
+		\param data The data of a valid string
+		\param size The number of units behind \c data
+		*/
+		static inline u32 AsciiSentenceRun( const ch* data, u32 size );
+
+		/**
+		\brief Compares the \c lhsSize units at \c lhs with the \c rhsSize units at \c rhs in code point order ( see Compare() ).
+		*/
+		static inline s32 CompareUnits( const ch* lhs, u32 lhsSize, const ch* rhs, u32 rhsSize );
+
+		/**
+		\brief Encodes \c codePoint as utf-16 in the byte order of the string.
+
+		\param dst The target array, which has to hold GetCodePointSize( codePoint ) units.
+		*/
+		static inline void FromCodePoint( u32 codePoint, ch* dst );
+
+		/**
+		\brief Returns the number of units needed to encode \c codePoint or 0 if it is an invalid code point.
+		*/
+		static inline u32 GetCodePointSize( u32 codePoint );
+
 		friend class UTFByteIterator< ThisType >;
 		friend class UTFCharIterator< ThisType >;
 
@@ -203,10 +493,30 @@ namespace uti
 
 		void CreateEmptyString();
 
+		void MapCase( unicode::CaseMapping mapping );
+
+		static inline u32 UnitValue( ch unit );
+
 		DataType m_pData;
 		Allocator m_Alloc;
 		u32 m_uiSize;
 		u32 m_uiCharCount;
+		bool m_bAscii;
+	};
+}
+
+namespace std
+{
+	/**
+	\brief Hashes UTF16Strings with their cached Hash().
+	*/
+	template< typename ch, ::uti::BinaryOrder order, typename Allocator >
+	struct hash< ::uti::UTF16String< ch, order, Allocator > >
+	{
+		size_t operator()( const ::uti::UTF16String< ch, order, Allocator >& string ) const
+		{
+			return static_cast< size_t >( string.Hash() );
+		}
 	};
 }
 #endif // utiUTF16String_h__
@@ -18,11 +18,21 @@ namespace uti
 		m_pData( rhs.m_pData ),
 		m_uiSize( rhs.m_uiSize ),
 		m_Alloc( rhs.m_Alloc ),
-		m_uiCharCount( rhs.m_uiCharCount )
+		m_uiCharCount( rhs.m_uiCharCount ),
+		m_bAscii( rhs.m_bAscii )
 	{
 
 	}
 
+	template < typename ch /*= short*/, ::uti::BinaryOrder order /*= ::uti::BinaryOrder::LittleEndian */, typename Allocator /*= DefaultAllocator */>
+	UTF16String< ch, order, Allocator >::UTF16String( const DataType& data, u32 size, u32 charSize, bool isAscii /*= false */ ) :
+		m_pData( data ),
+		m_uiSize( size ),
+		m_uiCharCount( charSize ),
+		m_bAscii( isAscii )
+	{
+	}
+
 	template < typename ch /*= short*/, ::uti::BinaryOrder order /*= ::uti::BinaryOrder::LittleEndian */, typename Allocator /*= DefaultAllocator */>
 	UTF16String< ch, order, Allocator >::UTF16String( const ch* text )
 	{
@@ -51,6 +61,7 @@ namespace uti
 		m_pData[ 0 ] = 0U;
 		m_uiSize = 0U;
 		m_uiCharCount = 0U;
+		m_bAscii = true;
 	}
 
 	template < typename ch /*= short*/, ::uti::BinaryOrder order /*= ::uti::BinaryOrder::LittleEndian */, typename Allocator /*= DefaultAllocator */>
@@ -68,7 +79,7 @@ namespace uti
 	template < typename ch /*= short*/, ::uti::BinaryOrder order /*= ::uti::BinaryOrder::LittleEndian */, typename Allocator /*= DefaultAllocator */>
 	u32 uti::UTF16String< ch, order, Allocator >::ExtractCodePoint( const ch* utfchar )
 	{
-		return _ExtractCodePoint_impl( utfchar, if_<order == BinaryOrder::LittleEndian, is_le, is_be>::type() );
+		return _ExtractCodePoint_impl( utfchar, typename if_<order == BinaryOrder::LittleEndian, is_le, is_be>::type() );
 	}
 
 	template < typename ch /*= short*/, ::uti::BinaryOrder order /*= ::uti::BinaryOrder::LittleEndian*/, typename Allocator /*= ::uti::DefaultAllocator */>
@@ -84,20 +95,21 @@ namespace uti
 		{
 			//Extract code point by filtering out the continuation and byte count marks and shifting the code points value together.
 
+			// Work on unsigned 32 bit values, so signed unit types are not sign extended and the shifted lead surrogate is not truncated
 			u32 result = 0U;
-			ch byte1;
-			ch byte2;
+			u32 byte1;
+			u32 byte2;
 			switch( length )
 			{
 				// Easiest case, Value is equal to its code point so simply return the value.
 			case 1U:
-				byte1 = _byteswap_ushort( *utfchar );
+				byte1 = ::uti::ByteSwap16( static_cast< unsigned short >( *utfchar ) );
 				result = byte1;
 				break;
 				// Second case using lead and trail surrogates
 			case 2U:
-				byte1 = _byteswap_ushort( *utfchar );
-				byte2 = _byteswap_ushort( *( utfchar + 1 ) );
+				byte1 = ::uti::ByteSwap16( static_cast< unsigned short >( *utfchar ) );
+				byte2 = ::uti::ByteSwap16( static_cast< unsigned short >( *( utfchar + 1 ) ) );
 				byte1 -= 0xD800U;
 				byte2 -= 0xDC00U;
 				byte1 = byte1 << 10;
@@ -123,19 +135,20 @@ namespace uti
 		{
 			//Extract code point by filtering out the continuation and byte count marks and shifting the code points value together.
 
+			// Work on unsigned 32 bit values, so signed unit types are not sign extended and the shifted lead surrogate is not truncated
 			u32 result = 0U;
-			ch byte1;
-			ch byte2;
+			u32 byte1;
+			u32 byte2;
 			switch( length )
 			{
 				// Easiest case, Value is equal to its code point so simply return the value.
 			case 1U:
-				result = *utfchar;
+				result = static_cast< u32 >( *utfchar ) & 0xFFFFU;
 				break;
 				// Second case using lead and trail surrogates
 			case 2U:
-				byte1 = *utfchar;
-				byte2 = *( utfchar + 1 );
+				byte1 = static_cast< u32 >( *utfchar ) & 0xFFFFU;
+				byte2 = static_cast< u32 >( *( utfchar + 1 ) ) & 0xFFFFU;
 				byte1 -= 0xD800U;
 				byte2 -= 0xDC00U;
 				byte1 = byte1 << 10;
@@ -151,6 +164,222 @@ namespace uti
 
 
 
+	template < typename ch /*= short*/, ::uti::BinaryOrder order /*= ::uti::BinaryOrder::LittleEndian */, typename Allocator /*= DefaultAllocator */>
+	u32 uti::UTF16String< ch, order, Allocator >::AdvanceChars( const ch* data, u32 pos, u32 size, u32 count )
+	{
+		if( count == 0U || pos >= size )
+		{
+			return pos < size ? pos : size;
+		}
+
+		const bool bigEndian = order == BinaryOrder::BigEndian;
+		const unsigned short surrogateMask = bigEndian ? 0x00FCU : 0xFC00U;
+		const unsigned short lowSurrogate = bigEndian ? 0x00DCU : 0xDC00U;
+		const u32 blockUnits = simd::BlockSize / 2U;
+		u32 cur = pos + 1U;
+
+		// Every unit which is not a low surrogate starts a new char, so count them a block at a time
+		// (the block kernel expects 16 bit units, wider types fall through to the unit loop)
+		if( sizeof( ch ) == 2U )
+		{
+			const unsigned short* units = reinterpret_cast< const unsigned short* >( data );
+			while( cur + blockUnits <= size )
+			{
+				u32 leadMask = simd::Utf16LeadMask( units + cur, bigEndian );
+				u32 leadCount = simd::PopCount( leadMask );
+				if( leadCount >= count )
+				{
+					return cur + simd::SelectBit( leadMask, count - 1U );
+				}
+				count -= leadCount;
+				cur += blockUnits;
+			}
+		}
+
+		for( ; cur < size; ++cur )
+		{
+			if( ( static_cast< unsigned short >( data[ cur ] ) & surrogateMask ) != lowSurrogate && --count == 0U )
+			{
+				return cur;
+			}
+		}
+		return size;
+	}
+
+	template < typename ch /*= short*/, ::uti::BinaryOrder order /*= ::uti::BinaryOrder::LittleEndian */, typename Allocator /*= DefaultAllocator */>
+	u32 uti::UTF16String< ch, order, Allocator >::RetreatChars( const ch* data, u32 pos, u32 count )
+	{
+		if( count == 0U )
+		{
+			return pos;
+		}
+
+		const bool bigEndian = order == BinaryOrder::BigEndian;
+		const unsigned short surrogateMask = bigEndian ? 0x00FCU : 0xFC00U;
+		const unsigned short lowSurrogate = bigEndian ? 0x00DCU : 0xDC00U;
+		const u32 blockUnits = simd::BlockSize / 2U;
+		u32 cur = pos;
+
+		if( sizeof( ch ) == 2U )
+		{
+			const unsigned short* units = reinterpret_cast< const unsigned short* >( data );
+			while( cur >= blockUnits )
+			{
+				u32 leadMask = simd::Utf16LeadMask( units + cur - blockUnits, bigEndian );
+				u32 leadCount = simd::PopCount( leadMask );
+				if( leadCount >= count )
+				{
+					return cur - blockUnits + simd::SelectBit( leadMask, leadCount - count );
+				}
+				count -= leadCount;
+				cur -= blockUnits;
+			}
+		}
+
+		while( cur > 0U )
+		{
+			--cur;
+			if( ( static_cast< unsigned short >( data[ cur ] ) & surrogateMask ) != lowSurrogate && --count == 0U )
+			{
+				return cur;
+			}
+		}
+		return 0U;
+	}
+
+	template < typename ch /*= short*/, ::uti::BinaryOrder order /*= ::uti::BinaryOrder::LittleEndian */, typename Allocator /*= DefaultAllocator */>
+	u32 uti::UTF16String< ch, order, Allocator >::CountChars( const ch* data, u32 size )
+	{
+		const bool bigEndian = order == BinaryOrder::BigEndian;
+		const unsigned short surrogateMask = bigEndian ? 0x00FCU : 0xFC00U;
+		const unsigned short lowSurrogate = bigEndian ? 0x00DCU : 0xDC00U;
+		const u32 blockUnits = simd::BlockSize / 2U;
+		u32 count = 0U;
+		u32 cur = 0U;
+		if( sizeof( ch ) == 2U )
+		{
+			const unsigned short* units = reinterpret_cast< const unsigned short* >( data );
+			for( ; cur + blockUnits <= size; cur += blockUnits )
+			{
+				count += simd::PopCount( simd::Utf16LeadMask( units + cur, bigEndian ) );
+			}
+		}
+		for( ; cur < size; ++cur )
+		{
+			if( ( static_cast< unsigned short >( data[ cur ] ) & surrogateMask ) != lowSurrogate )
+			{
+				++count;
+			}
+		}
+		return count;
+	}
+
+	template < typename ch /*= short*/, ::uti::BinaryOrder order /*= ::uti::BinaryOrder::LittleEndian */, typename Allocator /*= DefaultAllocator */>
+	u32 uti::UTF16String< ch, order, Allocator >::SimpleGraphemeRun( const ch* data, u32 size )
+	{
+		// The block kernels expect 16 bit units, wider types always take the state machine
+		if( sizeof( ch ) != 2U )
+		{
+			return 0U;
+		}
+		const bool bigEndian = order == BinaryOrder::BigEndian;
+		const unsigned short* units = reinterpret_cast< const unsigned short* >( data );
+		const unsigned short limit = static_cast< unsigned short >( unicode::detail::GraphemeSimpleLimit );
+		u32 pos = 0U;
+		while( pos + 8U <= size && ( simd::UnitAtLeastMask8( units + pos, limit, bigEndian ) | simd::UnitEqualMask8( units + pos, '\r', bigEndian ) ) == 0U )
+		{
+			pos += 8U;
+		}
+		// Every unit is a char of its own, leave out the last one
+		return pos != 0U ? pos - 1U : 0U;
+	}
+
+	template < typename ch /*= short*/, ::uti::BinaryOrder order /*= ::uti::BinaryOrder::LittleEndian */, typename Allocator /*= DefaultAllocator */>
+	u32 uti::UTF16String< ch, order, Allocator >::AsciiWordRun( const ch* data, u32 size )
+	{
+		u32 pos = 0U;
+		// The block kernels expect 16 bit units, wider types are tested unit by unit
+		if( sizeof( ch ) == 2U )
+		{
+			const unsigned short* units = reinterpret_cast< const unsigned short* >( data );
+			for( ; pos + 8U <= size; pos += 8U )
+			{
+				u32 other = simd::UnitAsciiWordMask8( units + pos, order == BinaryOrder::BigEndian ) ^ 0xFFU;
+				if( other != 0U )
+				{
+					return pos + simd::LowestBit( other );
+				}
+			}
+		}
+		for( ; pos < size; ++pos )
+		{
+			u32 unit = UnitValue( data[ pos ] );
+			if( ( ( unit | 0x20U ) - 'a' ) >= 26U && ( unit - '0' ) >= 10U && unit != '_' )
+			{
+				break;
+			}
+		}
+		return pos;
+	}
+
+	template < typename ch /*= short*/, ::uti::BinaryOrder order /*= ::uti::BinaryOrder::LittleEndian */, typename Allocator /*= DefaultAllocator */>
+	u32 uti::UTF16String< ch, order, Allocator >::AsciiSentenceRun( const ch* data, u32 size )
+	{
+		u32 pos = 0U;
+		if( sizeof( ch ) == 2U )
+		{
+			const bool bigEndian = order == BinaryOrder::BigEndian;
+			const unsigned short* units = reinterpret_cast< const unsigned short* >( data );
+			for( ; pos + 8U <= size; pos += 8U )
+			{
+				const unsigned short* block = units + pos;
+				u32 stop = simd::UnitAtLeastMask8( block, 0x80U, bigEndian ) | simd::UnitEqualMask8( block, '.', bigEndian ) |
+					simd::UnitEqualMask8( block, '!', bigEndian ) | simd::UnitEqualMask8( block, '?', bigEndian ) |
+					simd::UnitEqualMask8( block, '\r', bigEndian ) | simd::UnitEqualMask8( block, '\n', bigEndian );
+				if( stop != 0U )
+				{
+					return pos + simd::LowestBit( stop );
+				}
+			}
+		}
+		for( ; pos < size; ++pos )
+		{
+			u32 unit = UnitValue( data[ pos ] );
+			if( unit >= 0x80U || unit == '.' || unit == '!' || unit == '?' || unit == '\r' || unit == '\n' )
+			{
+				break;
+			}
+		}
+		return pos;
+	}
+
+	template < typename ch /*= short*/, ::uti::BinaryOrder order /*= ::uti::BinaryOrder::LittleEndian */, typename Allocator /*= DefaultAllocator */>
+	s32 uti::UTF16String< ch, order, Allocator >::CompareUnits( const ch* lhs, u32 lhsSize, const ch* rhs, u32 rhsSize )
+	{
+		u32 common = lhsSize < rhsSize ? lhsSize : rhsSize;
+		u32 mismatch = simd::Mismatch( lhs, rhs, common * sizeof( ch ) ) / sizeof( ch );
+		if( mismatch < common )
+		{
+			u32 left = static_cast< u32 >( lhs[ mismatch ] ) & 0xFFFFU;
+			u32 right = static_cast< u32 >( rhs[ mismatch ] ) & 0xFFFFU;
+			if( order == BinaryOrder::BigEndian )
+			{
+				left = ( ( left & 0xFFU ) << 8U ) | ( left >> 8U );
+				right = ( ( right & 0xFFU ) << 8U ) | ( right >> 8U );
+			}
+
+			// Surrogates encode code points above U+FFFF, so move them behind U+E000 to U+FFFF.
+			// Only needed if both units are at least U+D800, any other unit order already is the code point order.
+			if( left >= 0xD800U && right >= 0xD800U )
+			{
+				left = left >= 0xE000U ? left - 0x800U : left + 0x2000U;
+				right = right >= 0xE000U ? right - 0x800U : right + 0x2000U;
+			}
+			return static_cast< s32 >( left ) - static_cast< s32 >( right );
+		}
+		return lhsSize < rhsSize ? -1 : ( lhsSize > rhsSize ? 1 : 0 );
+	}
+
 	template < typename ch /*= short*/, ::uti::BinaryOrder order /*= ::uti::BinaryOrder::LittleEndian */, typename Allocator /*= DefaultAllocator */>
 	u32 uti::UTF16String< ch, order, Allocator >::Concat( const UTF16String< ch, order, Allocator >& rhs )
 	{
@@ -163,9 +392,36 @@ namespace uti
 		m_pData = newRawStringData;
 		m_uiSize = newSize;
 		m_uiCharCount += rhs.m_uiCharCount;
+		m_bAscii = m_bAscii && rhs.m_bAscii;
 		return newSize;
 	}
 
+	template < typename ch /*= short*/, ::uti::BinaryOrder order /*= ::uti::BinaryOrder::LittleEndian */, typename Allocator /*= DefaultAllocator */>
+	typename UTF16String< ch, order, Allocator >::CharIterator uti::UTF16String< ch, order, Allocator >::CharIteratorAt( u32 charIndex ) const
+	{
+		UTI_ASSERT( charIndex <= CharCount() );
+		if( m_bAscii )
+		{
+			return CharIterator( ( UTF16String& ) *this, charIndex );
+		}
+
+		CharIterator it = CharBegin();
+		it += static_cast< s32 >( charIndex );
+		return it;
+	}
+
+	template < typename ch /*= short*/, ::uti::BinaryOrder order /*= ::uti::BinaryOrder::LittleEndian */, typename Allocator /*= DefaultAllocator */>
+	u32 uti::UTF16String< ch, order, Allocator >::CodePointAt( u32 charIndex ) const
+	{
+		UTI_ASSERT( charIndex < CharCount() );
+		if( m_bAscii )
+		{
+			u32 unit = static_cast< u32 >( static_cast< unsigned short >( m_pData[ charIndex ] ) );
+			return order == ::uti::BinaryOrder::LittleEndian ? unit : unit >> 8U;
+		}
+		return ExtractCodePoint( *CharIteratorAt( charIndex ) );
+	}
+
 	template < typename ch /*= short*/, ::uti::BinaryOrder order /*= ::uti::BinaryOrder::LittleEndian */, typename Allocator /*= DefaultAllocator */>
 	UTF16String< ch, order, Allocator > uti::UTF16String< ch, order, Allocator >::operator+( const UTF16String< ch, order, Allocator >& rhs ) const
 	{
@@ -184,7 +440,7 @@ namespace uti
 	template < typename ch /*= short*/, ::uti::BinaryOrder order /*= ::uti::BinaryOrder::LittleEndian */, typename Allocator /*= DefaultAllocator */>
 	u32 UTF16String<ch, order, Allocator >::ValidChar( const ch* utfchar )
 	{
-		return _ValidChar_impl( utfchar, if_<order == BinaryOrder::LittleEndian, is_le, is_be>::type() );
+		return _ValidChar_impl( utfchar, typename if_<order == BinaryOrder::LittleEndian, is_le, is_be>::type() );
 	}
 
 
@@ -193,11 +449,11 @@ namespace uti
 	{
 		bool result = true;
 		u32 numBytes = CharSize( utfchar );
-		ch byte1 = _byteswap_ushort( *utfchar );
-		ch byte2 = _byteswap_ushort( *( utfchar + 1 ) );
+		u32 byte1 = ::uti::ByteSwap16( static_cast< unsigned short >( *utfchar ) );
+		u32 byte2 = ::uti::ByteSwap16( static_cast< unsigned short >( *( utfchar + 1 ) ) );
 		if( numBytes == 2U )
 		{
-			result = result && ( byte1 >= 0xD800U || byte1 < 0xDC00 ) && ( byte2 >= 0xDC00U || byte2 < 0xE000U );
+			result = result && ( byte1 >= 0xD800U && byte1 < 0xDC00 ) && ( byte2 >= 0xDC00U && byte2 < 0xE000U );
 		}
 
 		if( !result )
@@ -215,8 +471,8 @@ namespace uti
 	{
 		bool result = true;
 		u32 numBytes = CharSize( utfchar );
-		ch byte1 = ( *utfchar );
-		ch byte2 = ( *( utfchar + 1 ) );
+		u32 byte1 = static_cast< u32 >( *utfchar ) & 0xFFFFU;
+		u32 byte2 = static_cast< u32 >( *( utfchar + 1 ) ) & 0xFFFFU;
 		if( numBytes == 2U )
 		{
 			result = result && ( byte1 >= 0xD800U && byte1 < 0xDC00 ) && ( byte2 >= 0xDC00U && byte2 < 0xE000U );
@@ -235,14 +491,13 @@ namespace uti
 	template < typename ch /*= short*/, ::uti::BinaryOrder order /*= ::uti::BinaryOrder::LittleEndian */, typename Allocator /*= DefaultAllocator */>
 	u32 uti::UTF16String< ch, order, Allocator >::CharSize( const ch* utfchar )
 	{
-		return _CharSize_impl( utfchar, if_<order == BinaryOrder::LittleEndian, is_le, is_be>::type() );
+		return _CharSize_impl( utfchar, typename if_<order == BinaryOrder::LittleEndian, is_le, is_be>::type() );
 	}
 
 	template < typename ch /*= short*/, ::uti::BinaryOrder order /*= ::uti::BinaryOrder::LittleEndian*/, typename Allocator /*= ::uti::DefaultAllocator */>
 	u32 uti::UTF16String<ch, order, Allocator>::_CharSize_impl( const ch* utfchar, is_be /*= is_be() */ )
 	{
-		ch myByte = *utfchar;
-		myByte = _byteswap_ushort( myByte );
+		u32 myByte = ::uti::ByteSwap16( static_cast< unsigned short >( *utfchar ) );
 
 		if( myByte < 0xD800U || myByte >= 0xE000U )
 		{
@@ -257,7 +512,8 @@ namespace uti
 	template < typename ch /*= short*/, ::uti::BinaryOrder order /*= ::uti::BinaryOrder::LittleEndian*/, typename Allocator /*= ::uti::DefaultAllocator */>
 	u32 uti::UTF16String<ch, order, Allocator>::_CharSize_impl( const ch* utfchar, is_le /*= is_le() */ )
 	{
-		if( *utfchar < 0xD800U || *utfchar >= 0xE000U )
+		u32 myByte = static_cast< u32 >( *utfchar ) & 0xFFFFU;
+		if( myByte < 0xD800U || myByte >= 0xE000U )
 		{
 			return 1;
 		}
@@ -285,6 +541,7 @@ namespace uti
 		m_uiSize = rhs.m_uiSize;
 		m_Alloc = rhs.m_Alloc;
 		m_uiCharCount = rhs.m_uiCharCount;
+		m_bAscii = rhs.m_bAscii;
 		return *this;
 	}
 
@@ -294,6 +551,54 @@ namespace uti
 		return ReverseIterator( Begin() );
 	}
 
+	template < typename ch /*= short*/, ::uti::BinaryOrder order /*= ::uti::BinaryOrder::LittleEndian */, typename Allocator /*= DefaultAllocator */>
+	typename UTF16String< ch, order, Allocator >::Span UTF16String< ch, order, Allocator >::Bytes( void ) const UTI_LVALUE_THIS
+	{
+		return Span( m_pData.Ptr(), m_pData.Ptr() + m_uiSize, m_bAscii );
+	}
+
+	template < typename ch /*= short*/, ::uti::BinaryOrder order /*= ::uti::BinaryOrder::LittleEndian */, typename Allocator /*= DefaultAllocator */>
+	typename UTF16String< ch, order, Allocator >::CharCursor UTF16String< ch, order, Allocator >::Chars( void ) const
+	{
+		return CharCursor( m_pData, m_pData.Ptr(), m_pData.Ptr() + m_uiSize, m_bAscii );
+	}
+
+	template < typename ch /*= short*/, ::uti::BinaryOrder order /*= ::uti::BinaryOrder::LittleEndian */, typename Allocator /*= DefaultAllocator */>
+	typename UTF16String< ch, order, Allocator >::GraphemeCursor UTF16String< ch, order, Allocator >::Graphemes( void ) const
+	{
+		return GraphemeCursor( m_pData, m_pData.Ptr(), m_pData.Ptr() + m_uiSize );
+	}
+
+	template < typename ch /*= short*/, ::uti::BinaryOrder order /*= ::uti::BinaryOrder::LittleEndian */, typename Allocator /*= DefaultAllocator */>
+	u32 UTF16String< ch, order, Allocator >::GraphemeCount( void ) const
+	{
+		return GraphemeCursor::Count( m_pData.Ptr(), m_pData.Ptr() + m_uiSize );
+	}
+
+	template < typename ch /*= short*/, ::uti::BinaryOrder order /*= ::uti::BinaryOrder::LittleEndian */, typename Allocator /*= DefaultAllocator */>
+	typename UTF16String< ch, order, Allocator >::WordCursor UTF16String< ch, order, Allocator >::Words( void ) const
+	{
+		return WordCursor( m_pData, m_pData.Ptr(), m_pData.Ptr() + m_uiSize );
+	}
+
+	template < typename ch /*= short*/, ::uti::BinaryOrder order /*= ::uti::BinaryOrder::LittleEndian */, typename Allocator /*= DefaultAllocator */>
+	typename UTF16String< ch, order, Allocator >::SentenceCursor UTF16String< ch, order, Allocator >::Sentences( void ) const
+	{
+		return SentenceCursor( m_pData, m_pData.Ptr(), m_pData.Ptr() + m_uiSize );
+	}
+
+	template < typename ch /*= short*/, ::uti::BinaryOrder order /*= ::uti::BinaryOrder::LittleEndian */, typename Allocator /*= DefaultAllocator */>
+	typename UTF16String< ch, order, Allocator >::SplitCursor UTF16String< ch, order, Allocator >::Split( const ThisType& delimiter, SplitOptions options /*= SplitOptions::None */, u32 maxSplits /*= SplitUnlimited */ ) const
+	{
+		return SplitCursor( m_pData, m_pData.Ptr(), m_pData.Ptr() + m_uiSize, delimiter, false, options, maxSplits, m_bAscii );
+	}
+
+	template < typename ch /*= short*/, ::uti::BinaryOrder order /*= ::uti::BinaryOrder::LittleEndian */, typename Allocator /*= DefaultAllocator */>
+	typename UTF16String< ch, order, Allocator >::SplitCursor UTF16String< ch, order, Allocator >::SplitAny( const ThisType& charset, SplitOptions options /*= SplitOptions::None */, u32 maxSplits /*= SplitUnlimited */ ) const
+	{
+		return SplitCursor( m_pData, m_pData.Ptr(), m_pData.Ptr() + m_uiSize, charset, true, options, maxSplits, m_bAscii );
+	}
+
 	template < typename ch /*= short*/, ::uti::BinaryOrder order /*= ::uti::BinaryOrder::LittleEndian */, typename Allocator /*= DefaultAllocator */>
 	typename UTF16String< ch, order, Allocator >::ReverseIterator UTF16String< ch, order, Allocator >::rBegin( void ) const
 	{
@@ -312,6 +617,18 @@ namespace uti
 		return UTF16String< ch, order, Allocator >::Iterator( ( UTF16String& ) *this, 0U );
 	}
 
+	template < typename ch /*= short*/, ::uti::BinaryOrder order /*= ::uti::BinaryOrder::LittleEndian */, typename Allocator /*= DefaultAllocator */>
+	typename UTF16String< ch, order, Allocator >::Iterator UTF16String< ch, order, Allocator >::end( void ) const
+	{
+		return End();
+	}
+
+	template < typename ch /*= short*/, ::uti::BinaryOrder order /*= ::uti::BinaryOrder::LittleEndian */, typename Allocator /*= DefaultAllocator */>
+	typename UTF16String< ch, order, Allocator >::Iterator UTF16String< ch, order, Allocator >::begin( void ) const
+	{
+		return Begin();
+	}
+
 	template < typename ch /*= short*/, ::uti::BinaryOrder order /*= ::uti::BinaryOrder::LittleEndian */, typename Allocator /*= DefaultAllocator */>
 	typename UTF16String< ch, order, Allocator >::CharReverseIterator uti::UTF16String< ch, order, Allocator >::rCharEnd( void ) const
 	{
@@ -337,52 +654,319 @@ namespace uti
 	}
 
 	template < typename ch /*= short*/, ::uti::BinaryOrder order /*= ::uti::BinaryOrder::LittleEndian */, typename Allocator /*= DefaultAllocator */>
-	bool UTF16String< ch, order, Allocator >::operator!=( const UTF16String& rhs ) const
+	UTF16String< ch, order, Allocator > UTF16String< ch, order, Allocator >::ToUpper( void ) const
+	{
+		UTF16String< ch, order, Allocator > result( *this );
+		result.MapCase( unicode::CaseMapping::Upper );
+		return result;
+	}
+
+	template < typename ch /*= short*/, ::uti::BinaryOrder order /*= ::uti::BinaryOrder::LittleEndian */, typename Allocator /*= DefaultAllocator */>
+	UTF16String< ch, order, Allocator > UTF16String< ch, order, Allocator >::ToLower( void ) const
+	{
+		UTF16String< ch, order, Allocator > result( *this );
+		result.MapCase( unicode::CaseMapping::Lower );
+		return result;
+	}
+
+	template < typename ch /*= short*/, ::uti::BinaryOrder order /*= ::uti::BinaryOrder::LittleEndian */, typename Allocator /*= DefaultAllocator */>
+	UTF16String< ch, order, Allocator > UTF16String< ch, order, Allocator >::CaseFold( void ) const
+	{
+		UTF16String< ch, order, Allocator > result( *this );
+		result.MapCase( unicode::CaseMapping::Fold );
+		return result;
+	}
+
+	template < typename ch /*= short*/, ::uti::BinaryOrder order /*= ::uti::BinaryOrder::LittleEndian */, typename Allocator /*= DefaultAllocator */>
+	void UTF16String< ch, order, Allocator >::MakeUpper( void )
+	{
+		MapCase( unicode::CaseMapping::Upper );
+	}
+
+	template < typename ch /*= short*/, ::uti::BinaryOrder order /*= ::uti::BinaryOrder::LittleEndian */, typename Allocator /*= DefaultAllocator */>
+	void UTF16String< ch, order, Allocator >::MakeLower( void )
 	{
+		MapCase( unicode::CaseMapping::Lower );
+	}
+
+	template < typename ch /*= short*/, ::uti::BinaryOrder order /*= ::uti::BinaryOrder::LittleEndian */, typename Allocator /*= DefaultAllocator */>
+	void UTF16String< ch, order, Allocator >::MakeCaseFolded( void )
+	{
+		MapCase( unicode::CaseMapping::Fold );
+	}
 
-		if( m_uiSize != rhs.m_uiSize )
+	template < typename ch /*= short*/, ::uti::BinaryOrder order /*= ::uti::BinaryOrder::LittleEndian */, typename Allocator /*= DefaultAllocator */>
+	u32 UTF16String< ch, order, Allocator >::UnitValue( ch unit )
+	{
+		u32 value = static_cast< u32 >( unit ) & 0xFFFFU;
+		return order == BinaryOrder::BigEndian ? ( ( value & 0xFFU ) << 8U ) | ( value >> 8U ) : value;
+	}
+
+	template < typename ch /*= short*/, ::uti::BinaryOrder order /*= ::uti::BinaryOrder::LittleEndian */, typename Allocator /*= DefaultAllocator */>
+	u32 UTF16String< ch, order, Allocator >::GetCodePointSize( u32 codePoint )
+	{
+		if( codePoint < 0x10000U )
 		{
-			return true;
+			return 1U;
+		}
+		return codePoint < 0x110000U ? 2U : 0U;
+	}
+
+	template < typename ch /*= short*/, ::uti::BinaryOrder order /*= ::uti::BinaryOrder::LittleEndian */, typename Allocator /*= DefaultAllocator */>
+	void UTF16String< ch, order, Allocator >::FromCodePoint( u32 codePoint, ch* dst )
+	{
+		// UnitValue() swaps the bytes back and forth, so it also converts a native unit to the string byte order
+		if( codePoint < 0x10000U )
+		{
+			dst[ 0 ] = static_cast< ch >( UnitValue( static_cast< ch >( codePoint ) ) );
+		}
+		else
+		{
+			codePoint -= 0x10000U;
+			dst[ 0 ] = static_cast< ch >( UnitValue( static_cast< ch >( 0xD800U | ( codePoint >> 10U ) ) ) );
+			dst[ 1 ] = static_cast< ch >( UnitValue( static_cast< ch >( 0xDC00U | ( codePoint & 0x3FFU ) ) ) );
+		}
+	}
+
+	template < typename ch /*= short*/, ::uti::BinaryOrder order /*= ::uti::BinaryOrder::LittleEndian */, typename Allocator /*= DefaultAllocator */>
+	void UTF16String< ch, order, Allocator >::MapCase( unicode::CaseMapping mapping )
+	{
+		// Folding ASCII letters is lowering them
+		const bool upper = mapping == unicode::CaseMapping::Upper;
+		const u32 firstChanged = upper ? 'a' : 'A';
+		const ch* src = m_pData.Ptr();
+		u32 mapped[ unicode::MaxCaseMappingLength ];
+
+		// Size pass: the size and char count of the result, and if the result can be written over the source.
+		// Writing in place is possible as long as the result never gets ahead of the source.
+		u32 resultSize = 0U;
+		u32 resultChars = 0U;
+		bool resultAscii = true;
+		bool changed = false;
+		bool behindSource = true;
+		u32 pos = 0U;
+		while( pos < m_uiSize )
+		{
+			u32 unit = UnitValue( src[ pos ] );
+			if( unit < 0x80U )
+			{
+				changed = changed || unit - firstChanged < 26U;
+				++pos;
+				++resultSize;
+				++resultChars;
+				continue;
+			}
+
+			u32 codePoint = ExtractCodePoint( src + pos );
+			u32 count = unicode::MapCase( codePoint, mapping, mapped );
+			changed = changed || count != 1U || mapped[ 0 ] != codePoint;
+			for( u32 i = 0U; i < count; ++i )
+			{
+				resultSize += GetCodePointSize( mapped[ i ] );
+				resultAscii = resultAscii && mapped[ i ] < 0x80U;
+			}
+			resultChars += count;
+			pos += CharSize( src + pos );
+			behindSource = behindSource && resultSize <= pos;
 		}
 
-		Iterator lStart = Begin();
-		Iterator rStart = rhs.Begin();
-		Iterator lEnd = End();
-		Iterator rEnd = rhs.End();
+		if( !changed )
+		{
+			return;
+		}
+
+		bool inPlace = behindSource && resultSize == m_uiSize && m_pData.Count() == 1U;
+		ch* result = inPlace ? m_pData.Ptr() : static_cast< ch* >( m_Alloc.AllocateBytes( ( resultSize + 1U ) * sizeof( ch ) ) );
 
-		while( lStart != lEnd && rStart != rEnd )
+		// Write pass, repeating the decisions of the size pass
+		u32 written = 0U;
+		pos = 0U;
+		while( pos < m_uiSize )
 		{
-			if( *( lStart++ ) != *( rStart++ ) )
+			u32 unit = UnitValue( src[ pos ] );
+			if( unit < 0x80U )
+			{
+				result[ written ] = unit - firstChanged < 26U ? static_cast< ch >( UnitValue( static_cast< ch >( unit ^ 0x20U ) ) ) : src[ pos ];
+				++pos;
+				++written;
+				continue;
+			}
+
+			u32 codePoint = ExtractCodePoint( src + pos );
+			pos += CharSize( src + pos );
+			u32 count = unicode::MapCase( codePoint, mapping, mapped );
+			for( u32 i = 0U; i < count; ++i )
 			{
-				return true;
+				FromCodePoint( mapped[ i ], result + written );
+				written += GetCodePointSize( mapped[ i ] );
 			}
 		}
+		UTI_ASSERT( written == resultSize );
+		result[ resultSize ] = 0;
 
-		return false;
+		if( inPlace )
+		{
+			// The cached hashes describe the old contents
+			m_pData.ClearCached();
+		}
+		else
+		{
+			m_pData = result;
+		}
+		m_uiSize = resultSize;
+		m_uiCharCount = resultChars;
+		m_bAscii = resultAscii;
+	}
+
+	template < typename ch /*= short*/, ::uti::BinaryOrder order /*= ::uti::BinaryOrder::LittleEndian */, typename Allocator /*= DefaultAllocator */>
+	bool UTF16String< ch, order, Allocator >::operator!=( const UTF16String& rhs ) const
+	{
+		return !( *this == rhs );
 	}
 
 	template < typename ch /*= short*/, ::uti::BinaryOrder order /*= ::uti::BinaryOrder::LittleEndian */, typename Allocator /*= DefaultAllocator */>
 	bool UTF16String< ch, order, Allocator >::operator==( const UTF16String& rhs ) const
 	{
-		if( m_uiSize != rhs.m_uiSize )
+		// Both strings own the same buffer, so they cannot differ
+		if( m_pData == rhs.m_pData )
+		{
+			UTI_ASSERT( m_uiSize == rhs.m_uiSize );
+			return true;
+		}
+
+		if( m_uiSize != rhs.m_uiSize || m_uiCharCount != rhs.m_uiCharCount )
+		{
+			return false;
+		}
+
+		// Strings whose hashes are already known can be told apart without reading them
+		u64 lhsHash;
+		u64 rhsHash;
+		if( m_pData.GetCached( HashCacheSlot::Hash, lhsHash ) && rhs.m_pData.GetCached( HashCacheSlot::Hash, rhsHash ) && lhsHash != rhsHash )
 		{
 			return false;
 		}
 
-		Iterator lStart = Begin();
-		Iterator rStart = rhs.Begin();
-		Iterator lEnd = End();
-		Iterator rEnd = rhs.End();
+		return simd::Equal( m_pData.Ptr(), rhs.m_pData.Ptr(), m_uiSize * sizeof( ch ) );
+	}
+
+	template < typename ch /*= short*/, ::uti::BinaryOrder order /*= ::uti::BinaryOrder::LittleEndian */, typename Allocator /*= DefaultAllocator */>
+	s32 UTF16String< ch, order, Allocator >::Compare( const UTF16String& rhs ) const
+	{
+		if( m_pData == rhs.m_pData )
+		{
+			return 0;
+		}
+		return CompareUnits( m_pData.Ptr(), m_uiSize, rhs.m_pData.Ptr(), rhs.m_uiSize );
+	}
+
+	template < typename ch /*= short*/, ::uti::BinaryOrder order /*= ::uti::BinaryOrder::LittleEndian */, typename Allocator /*= DefaultAllocator */>
+	bool UTF16String< ch, order, Allocator >::operator<( const UTF16String& rhs ) const
+	{
+		return Compare( rhs ) < 0;
+	}
+
+	template < typename ch /*= short*/, ::uti::BinaryOrder order /*= ::uti::BinaryOrder::LittleEndian */, typename Allocator /*= DefaultAllocator */>
+	bool UTF16String< ch, order, Allocator >::operator<=( const UTF16String& rhs ) const
+	{
+		return Compare( rhs ) <= 0;
+	}
+
+	template < typename ch /*= short*/, ::uti::BinaryOrder order /*= ::uti::BinaryOrder::LittleEndian */, typename Allocator /*= DefaultAllocator */>
+	bool UTF16String< ch, order, Allocator >::operator>( const UTF16String& rhs ) const
+	{
+		return Compare( rhs ) > 0;
+	}
+
+	template < typename ch /*= short*/, ::uti::BinaryOrder order /*= ::uti::BinaryOrder::LittleEndian */, typename Allocator /*= DefaultAllocator */>
+	bool UTF16String< ch, order, Allocator >::operator>=( const UTF16String& rhs ) const
+	{
+		return Compare( rhs ) >= 0;
+	}
 
-		while( lStart != lEnd && rStart != rEnd )
+	template < typename ch /*= short*/, ::uti::BinaryOrder order /*= ::uti::BinaryOrder::LittleEndian */, typename Allocator /*= DefaultAllocator */>
+	bool UTF16String< ch, order, Allocator >::SharesData( const UTF16String& rhs ) const
+	{
+		return m_pData == rhs.m_pData;
+	}
+
+	template < typename ch /*= short*/, ::uti::BinaryOrder order /*= ::uti::BinaryOrder::LittleEndian */, typename Allocator /*= DefaultAllocator */>
+	u32 UTF16String< ch, order, Allocator >::ReferenceCount( void ) const
+	{
+		return m_pData.Count();
+	}
+
+	template < typename ch /*= short*/, ::uti::BinaryOrder order /*= ::uti::BinaryOrder::LittleEndian */, typename Allocator /*= DefaultAllocator */>
+	u64 UTF16String< ch, order, Allocator >::Hash( void ) const
+	{
+		u64 hash;
+		if( !m_pData.GetCached( HashCacheSlot::Hash, hash ) )
 		{
-			if( *( lStart++ ) != *( rStart++ ) )
+			hash = HashBytes( m_pData.Ptr(), m_uiSize * sizeof( ch ) );
+			m_pData.SetCached( HashCacheSlot::Hash, hash );
+		}
+		return hash;
+	}
+
+	template < typename ch /*= short*/, ::uti::BinaryOrder order /*= ::uti::BinaryOrder::LittleEndian */, typename Allocator /*= DefaultAllocator */>
+	u64 UTF16String< ch, order, Allocator >::Hash( u64 seed ) const
+	{
+		return HashBytes( m_pData.Ptr(), m_uiSize * sizeof( ch ), seed );
+	}
+
+	template < typename ch /*= short*/, ::uti::BinaryOrder order /*= ::uti::BinaryOrder::LittleEndian */, typename Allocator /*= DefaultAllocator */>
+	u64 UTF16String< ch, order, Allocator >::CodePointHash( void ) const
+	{
+		u64 hash;
+		if( m_pData.GetCached( HashCacheSlot::CodePointHash, hash ) )
+		{
+			return hash;
+		}
+
+		typedef UTF8String< char, Allocator > UTF8Type;
+
+		u32 utf8Size = 0U;
+		if( m_bAscii )
+		{
+			utf8Size = m_uiSize;
+		}
+		else
+		{
+			for( u32 codePoint : Chars() )
 			{
-				return false;
+				utf8Size += UTF8Type::GetCodePointSize( codePoint );
 			}
 		}
 
-		return true;
+		// Short strings are transcoded on the stack, only long ones need a temporary buffer
+		char localBuffer[ 256 ];
+		char* buffer = utf8Size <= sizeof( localBuffer ) ? localBuffer : static_cast< char* >( m_Alloc.AllocateBytes( utf8Size ) );
+		if( m_bAscii )
+		{
+			for( u32 i = 0U; i < m_uiSize; ++i )
+			{
+				u32 unit = static_cast< u32 >( m_pData[ i ] ) & 0xFFFFU;
+				buffer[ i ] = static_cast< char >( order == BinaryOrder::BigEndian ? unit >> 8U : unit );
+			}
+		}
+		else
+		{
+			char* dst = buffer;
+			for( u32 codePoint : Chars() )
+			{
+				UTF8Type::FromCodePoint( codePoint, dst );
+				dst += UTF8Type::GetCodePointSize( codePoint );
+			}
+		}
+
+		hash = HashBytes( buffer, utf8Size );
+		if( buffer != localBuffer )
+		{
+			m_Alloc.FreeBytes( buffer );
+		}
+
+		m_pData.SetCached( HashCacheSlot::CodePointHash, hash );
+		return hash;
 	}
 
 	template < typename ch /*= short*/, ::uti::BinaryOrder order /*= ::uti::BinaryOrder::LittleEndian */, typename Allocator /*= DefaultAllocator */>
@@ -391,6 +975,12 @@ namespace uti
 		return m_pData.Null() || m_pData[ 0 ] == 0U;
 	}
 
+	template < typename ch /*= short*/, ::uti::BinaryOrder order /*= ::uti::BinaryOrder::LittleEndian */, typename Allocator /*= DefaultAllocator */>
+	bool UTF16String< ch, order, Allocator >::IsAscii( void ) const
+	{
+		return m_bAscii;
+	}
+
 	template < typename ch /*= short*/, ::uti::BinaryOrder order /*= ::uti::BinaryOrder::LittleEndian */, typename Allocator /*= DefaultAllocator */>
 	const ch* UTF16String< ch, order, Allocator >::c_str() const
 	{
@@ -412,13 +1002,26 @@ namespace uti
 	{
 		u32 size = 0U;
 		u32 validSize = 0U;
+		u32 unitBits = 0U;
 		while( text[ size ] != 0U )
 		{
+			unitBits |= static_cast< u32 >( static_cast< unsigned short >( text[ size ] ) );
 			++validSize;
 			++size;
 		}
 		m_pData = DataType( static_cast< ch* >( m_Alloc.AllocateBytes( ( size + 1U ) * sizeof( ch ) ) ) );
 
+		// ASCII units have no bits set above the lowest 7 of the value, which is the high byte for big endian
+		m_bAscii = ( unitBits & ( order == BinaryOrder::LittleEndian ? 0xFF80U : 0x80FFU ) ) == 0U;
+		if( m_bAscii )
+		{
+			std::memcpy( m_pData.Ptr(), text, size * sizeof( ch ) );
+			m_uiSize = size;
+			m_uiCharCount = size;
+			m_pData[ m_uiSize ] = 0U;
+			return;
+		}
+
 		u32 bytesToNextChar = ValidChar( text );
 		u32 arrayPos = 0U;
 		m_uiCharCount = ( bytesToNextChar > 0U && ( *text != 0U ) ) ? 1U : 0U;
@@ -0,0 +1,180 @@
+#pragma once
+#ifndef utiUTF8Stream_h__
+#define utiUTF8Stream_h__
+
+namespace uti
+{
+	/**
+	\brief Validates utf-8 text which arrives in chunks of arbitrary size, e.g. from a socket.
+
+	A chunk may end in the middle of a char. The bytes of that char ( at most three ) are kept
+	and completed with the first bytes of the next chunk, so no chunk is ever scanned twice.
+	The chunks are checked with the strict StringType::ValidPrefix(), which skips runs of ASCII bytes a block at a time,
+	and the chars are counted with the SIMD block counting of StringType::CountChars().
+
+	Offsets are counted over the whole stream, so ErrorOffset() is the offset of the first byte of the first invalid char,
+	even if that char started in an earlier chunk.
+
+	\code
+	UTF8StreamValidator< UTF8String<> > validator;
+	while( socket.Receive( buffer, size ) )
+	{
+		if( !validator.Feed( buffer, size ) )
+		{
+			break;
+		}
+	}
+	bool valid = validator.Finish();
+	\endcode
+
+	\tparam StringType The utf-8 string type whose validation and counting is used, e.g. UTF8String<>.
+	*/
+	template< typename StringType >
+	class UTF8StreamValidator
+	{
+	public:
+
+		typedef typename StringType::Type DataType;
+
+		UTF8StreamValidator( void );
+
+		/**
+		\brief Validates the next chunk of the stream.
+
+		\return \c false if this or an earlier chunk holds an invalid char.
+		*/
+		bool Feed( const DataType* data, u32 size );
+
+		/**
+		\brief Ends the stream, a char which is still incomplete is invalid.
+
+		\return \c false if the stream holds an invalid char.
+		*/
+		bool Finish( void );
+
+		/**
+		\brief Starts a new stream.
+		*/
+		void Reset( void );
+
+		bool Valid( void ) const;
+
+		/**
+		\brief Returns the offset in the stream of the first byte of the first invalid char.
+		Only meaningful if Valid() returns \c false.
+		*/
+		u64 ErrorOffset( void ) const;
+
+		/**
+		\brief Returns the number of bytes fed so far.
+		*/
+		u64 ByteCount( void ) const;
+
+		/**
+		\brief Returns the number of complete and valid chars in front of the first error.
+		*/
+		u64 CharCount( void ) const;
+
+		/**
+		\brief Returns the number of bytes at the start of the stream, which form complete and valid chars.
+		*/
+		u64 CompleteSize( void ) const;
+
+	protected:
+	private:
+
+		/**
+		\brief Returns the size of the char the \c size bytes at \c bytes are the start of,
+		or 0 if they are no valid start of a longer char.
+		*/
+		static u32 IncompleteCharSize( const unsigned char* bytes, u32 size );
+
+		void Fail( u64 offset );
+
+		// Bytes of the char cut by the end of the last chunk
+		unsigned char m_Pending[ 4 ];
+		u32 m_uiPendingSize;
+		u32 m_uiPendingCharSize;
+
+		u64 m_uiByteCount;
+		u64 m_uiCharCount;
+		u64 m_uiErrorOffset;
+		bool m_bValid;
+	};
+
+	/**
+	\brief Builds a utf-8 string from chunks of arbitrary size, validating them with a UTF8StreamValidator on the way.
+
+	The bytes are appended to a buffer, which grows geometrically and is handed over to the string by Finish() without copying it.
+	If a chunk holds an invalid char, the bytes from that char on are dropped and every following chunk is ignored.
+
+	\tparam StringType The utf-8 string type which is built, e.g. UTF8String<>.
+	\tparam Allocator Is the class used to allocate the buffer, it is freed by the string.
+	*/
+	template< typename StringType, typename Allocator = typename StringType::AllocatorType >
+	class UTF8StreamDecoder
+	{
+	public:
+
+		typedef typename StringType::Type DataType;
+		typedef UTF8StreamDecoder< StringType, Allocator > ThisType;
+
+		/**
+		\param capacity The number of bytes to allocate the buffer for up front, e.g. a content length which is known in advance.
+		*/
+		explicit UTF8StreamDecoder( u32 capacity = 0U );
+
+		~UTF8StreamDecoder();
+
+		/**
+		\brief Validates the next chunk and appends its bytes to the string.
+
+		\return \c false if this or an earlier chunk holds an invalid char.
+		*/
+		bool Append( const DataType* data, u32 size );
+
+		/**
+		\brief Ends the stream and moves the complete and valid chars in front of the first error to \c result.
+		The decoder starts a new stream with the next call to Append() or Finish(), until then Validator() reports the ended stream.
+
+		\return \c false if the stream holds an invalid or incomplete char.
+		*/
+		bool Finish( StringType& result );
+
+		/**
+		\brief Drops the appended bytes and starts a new stream, the buffer is kept.
+		*/
+		void Reset( void );
+
+		/**
+		\brief Returns the validator of the current stream or of the stream ended by Finish(), e.g. for ErrorOffset().
+		*/
+		const UTF8StreamValidator< StringType >& Validator( void ) const;
+
+		/**
+		\brief Returns the number of bytes appended to the buffer.
+		*/
+		u32 Size( void ) const;
+
+	protected:
+	private:
+
+		UTF8StreamDecoder( const ThisType& );
+		ThisType& operator =( const ThisType& );
+
+		/**
+		\brief Grows the buffer to hold at least \c size bytes and a terminating zero.
+		*/
+		void Reserve( u32 size );
+
+		UTF8StreamValidator< StringType > m_Validator;
+		DataType* m_pBuffer;
+		u32 m_uiSize;
+		u32 m_uiCapacity;
+		Allocator m_Alloc;
+		// Set by Finish(), the validator keeps the state of the ended stream until the next one starts
+		bool m_bFinished;
+	};
+}
+
+#endif // utiUTF8Stream_h__
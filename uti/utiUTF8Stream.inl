@@ -0,0 +1,295 @@
+#pragma once
+#ifndef utiUTF8Stream_inl__
+#define utiUTF8Stream_inl__
+
+namespace uti
+{
+	//////////////////////////////////////////////////////////////////////////
+	// UTF-8 Stream Validator implementation
+	//////////////////////////////////////////////////////////////////////////
+
+	template< typename StringType >
+	UTF8StreamValidator< StringType >::UTF8StreamValidator( void )
+	{
+		static_assert( sizeof( DataType ) == 1U, "The stream is validated as utf-8 bytes" );
+		Reset();
+	}
+
+	template< typename StringType >
+	bool UTF8StreamValidator< StringType >::Feed( const DataType* data, u32 size )
+	{
+		const u64 chunkOffset = m_uiByteCount;
+		m_uiByteCount += size;
+		if( !m_bValid )
+		{
+			return false;
+		}
+
+		const unsigned char* bytes = reinterpret_cast< const unsigned char* >( data );
+		u32 pos = 0U;
+		if( m_uiPendingSize != 0U )
+		{
+			// Complete the char cut by the end of the last chunk first
+			const u64 charOffset = chunkOffset - m_uiPendingSize;
+			const u32 missing = m_uiPendingCharSize - m_uiPendingSize;
+			pos = size < missing ? size : missing;
+			std::memcpy( m_Pending + m_uiPendingSize, bytes, pos );
+			m_uiPendingSize += pos;
+			if( m_uiPendingSize < m_uiPendingCharSize )
+			{
+				if( IncompleteCharSize( m_Pending, m_uiPendingSize ) == 0U )
+				{
+					Fail( charOffset );
+					return false;
+				}
+				return true;
+			}
+			if( StringType::ValidPrefix( reinterpret_cast< const DataType* >( m_Pending ), m_uiPendingSize ) != m_uiPendingSize )
+			{
+				Fail( charOffset );
+				return false;
+			}
+			++m_uiCharCount;
+			m_uiPendingSize = 0U;
+		}
+
+		const u32 valid = pos + StringType::ValidPrefix( data + pos, size - pos );
+		m_uiCharCount += StringType::CountChars( data + pos, valid - pos );
+		if( valid < size )
+		{
+			// Only the last char may be incomplete, it is kept until the next chunk
+			const u32 charSize = size - valid < 4U ? IncompleteCharSize( bytes + valid, size - valid ) : 0U;
+			if( charSize == 0U )
+			{
+				Fail( chunkOffset + valid );
+				return false;
+			}
+			std::memcpy( m_Pending, bytes + valid, size - valid );
+			m_uiPendingSize = size - valid;
+			m_uiPendingCharSize = charSize;
+		}
+		return true;
+	}
+
+	template< typename StringType >
+	bool UTF8StreamValidator< StringType >::Finish( void )
+	{
+		if( m_bValid && m_uiPendingSize != 0U )
+		{
+			Fail( m_uiByteCount - m_uiPendingSize );
+		}
+		return m_bValid;
+	}
+
+	template< typename StringType >
+	void UTF8StreamValidator< StringType >::Reset( void )
+	{
+		m_uiPendingSize = 0U;
+		m_uiPendingCharSize = 0U;
+		m_uiByteCount = 0U;
+		m_uiCharCount = 0U;
+		m_uiErrorOffset = 0U;
+		m_bValid = true;
+	}
+
+	template< typename StringType >
+	bool UTF8StreamValidator< StringType >::Valid( void ) const
+	{
+		return m_bValid;
+	}
+
+	template< typename StringType >
+	u64 UTF8StreamValidator< StringType >::ErrorOffset( void ) const
+	{
+		return m_uiErrorOffset;
+	}
+
+	template< typename StringType >
+	u64 UTF8StreamValidator< StringType >::ByteCount( void ) const
+	{
+		return m_uiByteCount;
+	}
+
+	template< typename StringType >
+	u64 UTF8StreamValidator< StringType >::CharCount( void ) const
+	{
+		return m_uiCharCount;
+	}
+
+	template< typename StringType >
+	u64 UTF8StreamValidator< StringType >::CompleteSize( void ) const
+	{
+		return m_bValid ? m_uiByteCount - m_uiPendingSize : m_uiErrorOffset;
+	}
+
+	template< typename StringType >
+	u32 UTF8StreamValidator< StringType >::IncompleteCharSize( const unsigned char* bytes, u32 size )
+	{
+		// Same ranges as the strict check of ValidPrefix(), the second byte is narrower behind some leads
+		const unsigned char lead = bytes[ 0 ];
+		u32 charSize;
+		unsigned char low = 0x80U;
+		unsigned char high = 0xBFU;
+		if( lead < 0xC2U )
+		{
+			return 0U;
+		}
+		else if( lead < 0xE0U )
+		{
+			charSize = 2U;
+		}
+		else if( lead < 0xF0U )
+		{
+			charSize = 3U;
+			low = lead == 0xE0U ? 0xA0U : low;
+			high = lead == 0xEDU ? 0x9FU : high;
+		}
+		else if( lead < 0xF5U )
+		{
+			charSize = 4U;
+			low = lead == 0xF0U ? 0x90U : low;
+			high = lead == 0xF4U ? 0x8FU : high;
+		}
+		else
+		{
+			return 0U;
+		}
+		if( size >= charSize || ( size > 1U && ( bytes[ 1 ] < low || bytes[ 1 ] > high ) ) || ( size > 2U && ( bytes[ 2 ] & 0xC0U ) != 0x80U ) )
+		{
+			return 0U;
+		}
+		return charSize;
+	}
+
+	template< typename StringType >
+	void UTF8StreamValidator< StringType >::Fail( u64 offset )
+	{
+		m_bValid = false;
+		m_uiErrorOffset = offset;
+		m_uiPendingSize = 0U;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// UTF-8 Stream Decoder implementation
+	//////////////////////////////////////////////////////////////////////////
+
+	template< typename StringType, typename Allocator >
+	UTF8StreamDecoder< StringType, Allocator >::UTF8StreamDecoder( u32 capacity /*= 0U */ ) :
+		m_pBuffer( nullptr ),
+		m_uiSize( 0U ),
+		m_uiCapacity( 0U ),
+		m_bFinished( false )
+	{
+		if( capacity != 0U )
+		{
+			Reserve( capacity );
+		}
+	}
+
+	template< typename StringType, typename Allocator >
+	UTF8StreamDecoder< StringType, Allocator >::~UTF8StreamDecoder()
+	{
+		if( m_pBuffer != nullptr )
+		{
+			m_Alloc.FreeBytes( m_pBuffer );
+			m_pBuffer = nullptr;
+		}
+	}
+
+	template< typename StringType, typename Allocator >
+	bool UTF8StreamDecoder< StringType, Allocator >::Append( const DataType* data, u32 size )
+	{
+		if( m_bFinished )
+		{
+			Reset();
+		}
+		if( !m_Validator.Valid() )
+		{
+			m_Validator.Feed( data, size );
+			return false;
+		}
+
+		// The buffer holds every byte of the stream up to the first error, so stream offsets are buffer offsets
+		UTI_ASSERT( m_Validator.ByteCount() == m_uiSize && static_cast< u64 >( m_uiSize ) + size < 0xFFFFFFFFU );
+		const bool valid = m_Validator.Feed( data, size );
+		if( !valid && m_Validator.ErrorOffset() < m_uiSize )
+		{
+			// The invalid char started in an earlier chunk
+			m_uiSize = static_cast< u32 >( m_Validator.ErrorOffset() );
+			return false;
+		}
+
+		const u32 keep = valid ? size : static_cast< u32 >( m_Validator.ErrorOffset() - m_uiSize );
+		Reserve( m_uiSize + keep );
+		std::memcpy( m_pBuffer + m_uiSize, data, keep * sizeof( DataType ) );
+		m_uiSize += keep;
+		return valid;
+	}
+
+	template< typename StringType, typename Allocator >
+	bool UTF8StreamDecoder< StringType, Allocator >::Finish( StringType& result )
+	{
+		if( m_bFinished )
+		{
+			Reset();
+		}
+		const bool valid = m_Validator.Finish();
+		const u32 size = static_cast< u32 >( m_Validator.CompleteSize() );
+		const u32 charCount = static_cast< u32 >( m_Validator.CharCount() );
+		if( size == 0U )
+		{
+			// The buffer is kept for the next stream
+			result = StringType();
+		}
+		else
+		{
+			m_pBuffer[ size ] = 0;
+			result = StringType( typename StringType::DataType( m_pBuffer ), size, charCount, charCount == size );
+			m_pBuffer = nullptr;
+			m_uiCapacity = 0U;
+		}
+		m_uiSize = 0U;
+		m_bFinished = true;
+		return valid;
+	}
+
+	template< typename StringType, typename Allocator >
+	void UTF8StreamDecoder< StringType, Allocator >::Reset( void )
+	{
+		m_Validator.Reset();
+		m_uiSize = 0U;
+		m_bFinished = false;
+	}
+
+	template< typename StringType, typename Allocator >
+	const UTF8StreamValidator< StringType >& UTF8StreamDecoder< StringType, Allocator >::Validator( void ) const
+	{
+		return m_Validator;
+	}
+
+	template< typename StringType, typename Allocator >
+	u32 UTF8StreamDecoder< StringType, Allocator >::Size( void ) const
+	{
+		return m_uiSize;
+	}
+
+	template< typename StringType, typename Allocator >
+	void UTF8StreamDecoder< StringType, Allocator >::Reserve( u32 size )
+	{
+		if( size < m_uiCapacity )
+		{
+			return;
+		}
+		u32 capacity = m_uiCapacity * 2U > size ? m_uiCapacity * 2U : size + 256U;
+		DataType* buffer = static_cast< DataType* >( m_Alloc.AllocateBytes( capacity * sizeof( DataType ) ) );
+		if( m_pBuffer != nullptr )
+		{
+			std::memcpy( buffer, m_pBuffer, m_uiSize * sizeof( DataType ) );
+			m_Alloc.FreeBytes( m_pBuffer );
+		}
+		m_pBuffer = buffer;
+		m_uiCapacity = capacity;
+	}
+}
+
+#endif // utiUTF8Stream_inl__
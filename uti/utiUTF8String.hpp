@@ -13,8 +13,11 @@ namespace uti
 
 	\tparam Allocator Is the class used to allocate the memory for the string (and memory for the Reference Counting)
 
+	\tparam RefCountPolicy Is the policy used to count the references to the string data.
+	Strings which are shared between threads need the AtomicRefCountPolicy.
+
 	*/
-	template < typename ch = char, typename Allocator = ::uti::DefaultAllocator >
+	template < typename ch = char, typename Allocator = ::uti::DefaultAllocator, typename RefCountPolicy = ::uti::DefaultRefCountPolicy >
 	class UTF8String
 	{
 	public:
@@ -24,27 +27,45 @@ namespace uti
 		typedef const ch ConstType;
 		typedef const ch* ConstTypePtr;
 		typedef Allocator AllocatorType;
-		typedef typename UTF8String< ch, Allocator> ThisType;
+		typedef RefCountPolicy RefCountPolicyType;
+		typedef UTF8String< ch, Allocator, RefCountPolicy > ThisType;
 
 		typedef typename ::uti::UTFByteIterator< ThisType > Iterator;
-		typedef typename ::uti::ReverseIterator_tpl< typename Iterator > ReverseIterator;
+		typedef typename ::uti::ReverseIterator_tpl< Iterator > ReverseIterator;
 
 		typedef typename ::uti::UTFCharIterator< ThisType > CharIterator;
-		typedef typename ::uti::ReverseIterator_tpl< typename CharIterator > CharReverseIterator;
-		typedef typename ::uti::ReferenceCounted< ch, Allocator > DataType;
+		typedef typename ::uti::ReverseIterator_tpl< CharIterator > CharReverseIterator;
+		typedef typename ::uti::ReferenceCounted< ch, Allocator, RefCountPolicy > DataType;
+
+		typedef ::uti::ByteSpan< ThisType > Span;
+		typedef ::uti::ConstCharCursor< ThisType > CharCursor;
+		typedef ::uti::GraphemeIterator< ThisType > GraphemeCursor;
+		typedef ::uti::WordIterator< ThisType > WordCursor;
+		typedef ::uti::SentenceIterator< ThisType > SentenceCursor;
+		typedef ::uti::SplitIterator< ThisType > SplitCursor;
 
 		UTF8String( void );
 		UTF8String( const ch* text );
-		UTF8String( const UTF8String< ch, Allocator >& rhs );
-		UTF8String( const ReferenceCounted< ch, Allocator >& data, u32 size, u32 charSize );
+		UTF8String( const UTF8String< ch, Allocator, RefCountPolicy >& rhs );
+
+		/**
+		\brief Takes over the buffer of \c rhs without touching its reference counter, \c rhs is left as an empty string.
+		*/
+		UTF8String( UTF8String< ch, Allocator, RefCountPolicy >&& rhs );
+		UTF8String( const DataType& data, u32 size, u32 charSize, bool isAscii = false );
 
 		~UTF8String();
 
-		UTF8String< ch, Allocator>& operator =( const UTF8String< ch, Allocator>& rhs );
-		UTF8String< ch, Allocator>& operator =( const ch* rhs );
+		UTF8String< ch, Allocator, RefCountPolicy >& operator =( const UTF8String< ch, Allocator, RefCountPolicy >& rhs );
+
+		/**
+		\brief Swaps the contents with \c rhs, so no reference counter is touched and \c rhs releases the previous contents.
+		*/
+		UTF8String< ch, Allocator, RefCountPolicy >& operator =( UTF8String< ch, Allocator, RefCountPolicy >&& rhs );
+		UTF8String< ch, Allocator, RefCountPolicy >& operator =( const ch* rhs );
 
-		UTF8String< ch, Allocator>& operator +=( const UTF8String<ch, Allocator>& rhs );
-		UTF8String< ch, Allocator> operator +( const UTF8String<ch, Allocator>& rhs ) const;
+		UTF8String< ch, Allocator, RefCountPolicy >& operator +=( const UTF8String< ch, Allocator, RefCountPolicy >& rhs );
+		UTF8String< ch, Allocator, RefCountPolicy > operator +( const UTF8String< ch, Allocator, RefCountPolicy >& rhs ) const;
 
 		/**
 		\brief Appends the given string \c rhs to this string at the End.
@@ -53,7 +74,7 @@ namespace uti
 
 		\return The new Size of the string.
 		*/
-		u32 Concat( const UTF8String<ch, Allocator>& rhs );
+		u32 Concat( const UTF8String< ch, Allocator, RefCountPolicy >& rhs );
 
 		/**
 		\brief Returns a substring from the beginning of this String until the given \c end parameter.
@@ -62,7 +83,7 @@ namespace uti
 
 		\return A new String containing the given part of this string.
 		*/
-		inline UTF8String< ch, Allocator > Substr( const CharIterator& end ) const;
+		inline UTF8String< ch, Allocator, RefCountPolicy > Substr( const CharIterator& end ) const;
 
 		/**
 		\brief Returns a substring from the given \c start of this String until the given \c end parameter.
@@ -75,7 +96,7 @@ namespace uti
 
 		\return A new String containing the given part of this string.
 		*/
-		inline UTF8String< ch, Allocator > Substr( const CharIterator& start ,const CharIterator& end ) const;
+		inline UTF8String< ch, Allocator, RefCountPolicy > Substr( const CharIterator& start ,const CharIterator& end ) const;
 
 		/**
 		\brief Returns a substring from the given \c start of this String until the given \c end parameter.
@@ -89,14 +110,30 @@ namespace uti
 		\return A new String containing the given part of this string.
 
 		*/
-		inline UTF8String< ch, Allocator > Substr( u32 start, u32 end ) const;
+		inline UTF8String< ch, Allocator, RefCountPolicy > Substr( u32 start, u32 end ) const;
+
+		/**
+		\brief Returns a char iterator placed on the char with the given index.
+
+		If the string is pure ASCII this is a simple offset, otherwise the string is walked from its start.
+
+		\param charIndex The index of the char, might range from 0<=charIndex<=CharCount().
+		*/
+		inline CharIterator CharIteratorAt( u32 charIndex ) const;
+
+		/**
+		\brief Returns the code point of the char with the given index.
+
+		\param charIndex The index of the char, might range from 0<=charIndex<CharCount().
+		*/
+		inline u32 CodePointAt( u32 charIndex ) const;
 
 		/**
 		@brief Searches for the first occurrence of the given needle (using this string as haystack)
 		and returns the starting char index if any occurrence is found or -1 if no match has been found.
 		
 		*/
-		inline s32 FindFirst( const UTF8String< ch, Allocator > needle ) const;
+		inline s32 FindFirst( const UTF8String< ch, Allocator, RefCountPolicy > needle ) const;
 
 
 		/**
@@ -136,9 +173,150 @@ namespace uti
 		*/
 		bool Empty( void ) const;
 
+		/**
+		\brief Returns if the string only contains ASCII chars, which means every char is exactly one byte long.
+
+		The flag is recorded while the string is created, so this does not touch the string data.
+		*/
+		bool IsAscii( void ) const;
+
 		bool operator ==( const UTF8String& rhs ) const;
 		bool operator !=( const UTF8String& rhs ) const;
 
+		/**
+		\brief Compares this string with \c rhs in code point order.
+
+		The byte order of utf-8 is the code point order, so the bytes are compared block by block with SIMD.
+		A string which is a prefix of the other is ordered first.
+
+		\return A value less than, equal to or greater than zero if this string is ordered before, equal to or after \c rhs.
+		*/
+		s32 Compare( const UTF8String& rhs ) const;
+
+		/**
+		\brief Returns if this string and \c rhs are equal, ignoring the case of ASCII letters ( see Span::EqualsIgnoreAsciiCase() ).
+
+		Non ASCII chars have to match exactly. Strings of a different size or with different cached HashIgnoreAsciiCase() values are rejected without reading them.
+		*/
+		bool EqualsIgnoreAsciiCase( const UTF8String& rhs ) const;
+
+		/**
+		\brief Compares this string with \c rhs in code point order, with ASCII letters folded to lower case.
+		*/
+		s32 CompareIgnoreAsciiCase( const UTF8String& rhs ) const;
+
+		/**
+		\brief Returns the hash of the string ignoring the case of ASCII letters ( see HashBytesIgnoreAsciiCase() ).
+
+		The hash is cached in the shared header of the string data like Hash().
+		*/
+		u64 HashIgnoreAsciiCase( void ) const;
+
+		bool operator <( const UTF8String& rhs ) const;
+		bool operator <=( const UTF8String& rhs ) const;
+		bool operator >( const UTF8String& rhs ) const;
+		bool operator >=( const UTF8String& rhs ) const;
+
+		/**
+		\brief Returns if this string and \c rhs share their data, which implies they are equal.
+
+		For strings interned in the same InternPool this is equivalent to operator==, but never touches the data.
+		*/
+		bool SharesData( const UTF8String& rhs ) const;
+
+		/**
+		\brief Returns the number of strings sharing the data of this string.
+		*/
+		u32 ReferenceCount( void ) const;
+
+		/**
+		\brief Returns a seeded 64 bit hash of the string data ( see HashBytes() ).
+
+		The hash is calculated on the first call and cached in the shared header of the string data,
+		so every copy of the string reuses it.
+		*/
+		u64 Hash( void ) const;
+
+		/**
+		\brief Returns the hash of the string data for the given \c seed, which is not cached.
+		*/
+		u64 Hash( u64 seed ) const;
+
+		/**
+		\brief Returns a hash which is equal for all strings containing the same chars, regardless of their encoding.
+
+		It is defined as the Hash() of the utf-8 encoded chars, so for a UTF8String it is Hash() itself.
+		*/
+		u64 CodePointHash( void ) const;
+
+		/**
+		\brief Returns the string with every char mapped to upper case with the full Unicode case mapping ( see unicode::MapCase() ).
+
+		The mapping may change the size and the char count ( e.g. U+00DF is mapped to "SS" ).
+		If no char changes the returned string shares the data of this string.
+		*/
+		UTF8String< ch, Allocator, RefCountPolicy > ToUpper( void ) const;
+
+		/**
+		\brief Returns the string with every char mapped to lower case, see ToUpper().
+		*/
+		UTF8String< ch, Allocator, RefCountPolicy > ToLower( void ) const;
+
+		/**
+		\brief Returns the case folded string, strings which only differ in case have equal case folded strings, see ToUpper().
+		*/
+		UTF8String< ch, Allocator, RefCountPolicy > CaseFold( void ) const;
+
+		/**
+		\brief Maps every char of this string to upper case, see ToUpper().
+
+		The size of the result is calculated first, so at most one buffer is allocated.
+		If this string is the only owner of its data and the size does not change, the data is converted in place.
+		*/
+		void MakeUpper( void );
+
+		/**
+		\brief Maps every char of this string to lower case, see MakeUpper().
+		*/
+		void MakeLower( void );
+
+		/**
+		\brief Case folds every char of this string, see MakeUpper().
+		*/
+		void MakeCaseFolded( void );
+
+		/**
+		\brief Maps the case of the \c size bytes at \c data into \c dst, or only calculates the result if \c dst is \c nullptr ( see ToUpper() ).
+
+		No zero is written behind the result. \c dst may be \c data, if the size pass returned \c behindSource.
+
+		\param behindSource Receives if the result never gets ahead of the source, so it can be written over the source.
+		\return \c true if the result differs from the source, only calculated if \c dst is \c nullptr.
+		*/
+		static inline bool MapCaseInto( const ch* data, u32 size, unicode::CaseMapping mapping, ch* dst,
+			u32& resultSize, u32& resultChars, bool& resultAscii, bool& behindSource );
+
+		/**
+		\brief Returns the string normalized to \c form.
+
+		The string is quick checked first, skipping blocks which only hold code points that are normalized in every context.
+		Already normalized strings are returned unchanged and share the data of this string,
+		otherwise only the spans around the code points which failed the quick check are normalized, the rest is copied.
+		*/
+		UTF8String< ch, Allocator, RefCountPolicy > Normalize( unicode::NormalizationForm form ) const;
+
+		/**
+		\brief Normalizes this string to \c form, see Normalize().
+
+		The size of the result is calculated first, so at most one buffer is allocated.
+		*/
+		void MakeNormalized( unicode::NormalizationForm form );
+
+		/**
+		\brief Returns if this string is normalized to \c form, see Normalize().
+		*/
+		bool IsNormalized( unicode::NormalizationForm form ) const;
+
 		/**
 		\brief Returns an iterator to the start of the string,
 		which iterates until the end of the string.
@@ -150,6 +328,16 @@ namespace uti
 		*/
 		Iterator End( void ) const;
 
+		/**
+		\brief Standard library compatible version of Begin(), which also enables range based for loops over the units of the string.
+		*/
+		Iterator begin( void ) const;
+
+		/**
+		\brief Standard library compatible version of End().
+		*/
+		Iterator end( void ) const;
+
 		/**
 		\brief Returns an iterator which iterates over every char (utf-8 code point) of the String from its start
 
@@ -189,6 +377,75 @@ namespace uti
 		*/
 		ReverseIterator rEnd( void ) const;
 
+		/**
+		\brief Returns a span over every unit of the string ( without the '0' at the end ).
+
+		The span is a pair of raw pointers, which makes it the fastest way to visit the data of the string in tight loops.
+		It does not reference the data and is only valid as long as this string is alive,
+		so it cannot be taken from a temporary string where the compiler supports ref qualifiers.
+		*/
+		Span Bytes( void ) const UTI_LVALUE_THIS;
+#if defined( UTI_REF_QUALIFIERS )
+		Span Bytes( void ) const && = delete;
+#endif // UTI_REF_QUALIFIERS
+
+		/**
+		\brief Returns a cursor over every char of the string, which decodes the code points in place.
+
+		The cursor is a pair of raw pointers, which makes it the fastest way to visit the chars of the string in tight loops.
+		It holds a reference to the data, so it stays valid after this string is destroyed.
+		*/
+		CharCursor Chars( void ) const;
+
+		/**
+		\brief Returns an iterator over the extended grapheme clusters ( user perceived chars ) of the string,
+		which yields a span over the units of each cluster.
+
+		It holds a reference to the data, so it stays valid after this string is destroyed.
+		*/
+		GraphemeCursor Graphemes( void ) const;
+
+		/**
+		\brief Returns the number of extended grapheme clusters in the string, see Graphemes().
+		*/
+		u32 GraphemeCount( void ) const;
+
+		/**
+		\brief Returns an iterator over the word boundary segments ( UAX #29 ) of the string, which yields a span over the units of each segment.
+
+		Words, runs of white space and single punctuation chars are segments of their own, use WordCursor::IsWord() to skip the segments
+		which are no words. It holds a reference to the data, so it stays valid after this string is destroyed.
+		*/
+		WordCursor Words( void ) const;
+
+		/**
+		\brief Returns an iterator over the sentences ( UAX #29 ) of the string, which yields a span over the units of each sentence,
+		including its trailing white space and paragraph separator.
+
+		It holds a reference to the data, so it stays valid after this string is destroyed.
+		*/
+		SentenceCursor Sentences( void ) const;
+
+		/**
+		\brief Returns an iterator over the fields of the string between the occurrences of \c delimiter,
+		which yields a span over the units of each field.
+
+		No field is copied, the delimiters are only searched for while iterating.
+		The iterator holds a reference to the data, so it stays valid after this string is destroyed.
+
+		\param options Skips the empty fields and/or splits from the end of the string.
+		\param maxSplits The maximum number of delimiters the string is split at, the rest of the string is the last field.
+		*/
+		SplitCursor Split( const ThisType& delimiter, SplitOptions options = SplitOptions::None, u32 maxSplits = SplitUnlimited ) const;
+
+		/**
+		\brief Returns an iterator over the fields of the string between the chars which are part of \c charset,
+		which yields a span over the units of each field.
+
+		Works like Split(), but every char of \c charset is a delimiter on its own ( e.g. " \t\n" splits at white space ).
+		*/
+		SplitCursor SplitAny( const ThisType& charset, SplitOptions options = SplitOptions::None, u32 maxSplits = SplitUnlimited ) const;
+
 
 		/**
 		\brief Checks if the given Byte is in range of a valid UTF-8 Byte.
@@ -224,6 +481,117 @@ namespace uti
 		*/
 		static inline u32 ExtractCodePoint( const ch* utfchar );
 
+		/**
+		\brief Returns the position of the char \c count chars after the char starting at \c pos.
+
+		The chars are counted in blocks using SIMD masks of the bytes starting a char,
+		so the data is not decoded char by char.
+
+		\param data The data of a valid utf-8 string
+		\param pos The position (in bytes) of the char to start from
+		\param size The size (in bytes) of the data, the result is clamped to it
+		\param count The number of chars to skip
+
+		\return The position of the target char or \c size if the data ends before
+		*/
+		static inline u32 AdvanceChars( const ch* data, u32 pos, u32 size, u32 count );
+
+		/**
+		\brief Returns the position of the char \c count chars before the char starting at \c pos.
+
+		\param data The data of a valid utf-8 string
+		\param pos The position (in bytes) of the char to start from
+		\param count The number of chars to go back
+
+		\return The position of the target char or 0 if the data starts after it
+		*/
+		static inline u32 RetreatChars( const ch* data, u32 pos, u32 count );
+
+		/**
+		\brief Counts the chars in the first \c size bytes of \c data, using the same block counting as AdvanceChars.
+
+		\param data The data of a valid utf-8 string, starting on a char
+		\param size The number of bytes to count the chars in
+		*/
+		static inline u32 CountChars( const ch* data, u32 size );
+
+		/**
+		\brief Returns the number of bytes at the start of \c data, which form complete and well formed utf-8 chars.
+
+		Unlike ValidChar() the check is strict ( Unicode table 3-7 ): overlong forms, surrogates and code points
+		above U+10FFFF are rejected. Runs of ASCII bytes are skipped a block at a time.
+
+		\return The offset of the first byte of the first invalid or truncated char, \c size if every char is valid.
+		*/
+		static inline u32 ValidPrefix( const ch* data, u32 size );
+
+		/**
+		\brief Runs ValidPrefix() and CountChars() on chunks of \c data concurrently, the calling thread checks the first chunk.
+
+		Every chunk starts at the first byte behind its nominal start which is no continuation byte, so no valid char is cut.
+		Each thread gets at least ParallelChunkSize bytes, so smaller data is checked on fewer threads.
+
+		\param charCount Receives the number of chars in front of the returned offset.
+		\param threadCount The maximum number of threads to use, 0 uses one thread per hardware thread.
+
+		\return The same offset as ValidPrefix().
+		*/
+		static inline u32 ValidPrefixParallel( const ch* data, u32 size, u32& charCount, u32 threadCount = 0U );
+
+		/**
+		\brief The minimum number of bytes ValidPrefixParallel() hands to each thread.
+		*/
+		static const u32 ParallelChunkSize = 1U << 20U;
+
+		/**
+		\brief Strings constructed from at least this many bytes are validated, counted and copied in parallel chunks ( see ValidPrefixParallel() ).
+
+		Input which turns out to be invalid is copied again by the single threaded path, which replaces the invalid chars.
+		Setting it to 0xFFFFFFFF constructs every string on the calling thread.
+		It may be changed while other threads construct strings, they pick up the new value with their next string.
+		*/
+		static std::atomic< u32 > ParallelThreshold;
+
+		/**
+		\brief The maximum number of threads used to construct strings above the ParallelThreshold, 0 uses one thread per hardware thread.
+		*/
+		static std::atomic< u32 > ParallelThreadCount;
+
+		/**
+		\brief Returns the size (in bytes) of the run at the start of \c data in which every char is a grapheme cluster of its own,
+		or 0 if there is no such run.
+
+		Whole 16 byte blocks whose bytes are below the lead byte of unicode::detail::GraphemeSimpleLimit and hold no CR are taken at once.
+		The last char of the blocks is left out of the run, because the char behind it may extend its cluster.
+
+		\param data The data of a valid string, starting on a grapheme cluster
+		\param size The number of bytes behind \c data
+		*/
+		static inline u32 SimpleGraphemeRun( const ch* data, u32 size );
+
+		/**
+		\brief Returns the number of ASCII letters, digits and underscores at the start of \c data, whole 16 byte blocks are tested at once.
+		There is no word boundary between any of them.
+
+		\param data The data of a valid string
+		\param size The number of bytes behind \c data
+		*/
+		static inline u32 AsciiWordRun( const ch* data, u32 size );
+
+		/**
+		\brief Returns the number of ASCII chars at the start of \c data which cannot terminate a sentence ( every ASCII char but
+		'.', '!', '?', CR and LF ), whole 16 byte blocks are tested at once.
+
+		\param data The data of a valid string
+		\param size The number of bytes behind \c data
+		*/
+		static inline u32 AsciiSentenceRun( const ch* data, u32 size );
+
+		/**
+		\brief Compares the \c lhsSize bytes at \c lhs with the \c rhsSize bytes at \c rhs in code point order ( see Compare() ).
+		*/
+		static inline s32 CompareUnits( const ch* lhs, u32 lhsSize, const ch* rhs, u32 rhsSize );
+
 		/**
 		\brief Takes a codepoint and converts it to utf-8.
 
@@ -244,13 +612,15 @@ namespace uti
 		/**
 		\brief Takes an UTF-16 LE or BE string and converts it to UTF-8
 
+		The result is allocated once with its exact size, large strings are converted in parallel chunks ( see ToUTF8() ).
+
 		\param text The UTF-16 text which will be converted in to an UTF-8 string
 		\tparam order The byte order in which the text will be parsed
 
 		\return The converted UTF-8 string
 		*/
 		template< ::uti::BinaryOrder order >
-		static inline UTF8String<ch, Allocator> FromWideString( const wchar_t* text );
+		static inline UTF8String< ch, Allocator, RefCountPolicy > FromWideString( const wchar_t* text );
 
 		/**
 		\brief Takes an UTF-16LE string and converts it to UTF-8.
@@ -259,7 +629,7 @@ namespace uti
 
 		\return The string converted into UTF-8
 		*/
-		static inline UTF8String<ch, Allocator> FromUTF16LE( const wchar_t* text );
+		static inline UTF8String< ch, Allocator, RefCountPolicy > FromUTF16LE( const wchar_t* text );
 
 		/**
 		\brief Takes an UTF-16BE string and converts it to UTF-8.
@@ -268,7 +638,30 @@ namespace uti
 
 		\return The string converted into UTF-8
 		*/
-		static inline UTF8String<ch, Allocator> FromUTF16BE( const wchar_t* text );
+		static inline UTF8String< ch, Allocator, RefCountPolicy > FromUTF16BE( const wchar_t* text );
+
+		/**
+		\brief Loads the utf-8 file at \c path into \c result, its content is validated in parallel chunks ( see ValidPrefixParallel() ).
+
+		Strings with a MappedRefCountPolicy ( e.g. MappedUTF8String ) use the mapped file as their buffer, so it is never copied.
+		Other strings read it into a buffer of their allocator.
+
+		\return \c false if the file can not be read, is larger than 4 GB or is no well formed utf-8, \c result is empty then.
+		*/
+		static inline bool FromFile( const char* path, ThisType& result );
+
+		/**
+		\brief Constructs a string from each of the \c count slices at \c slices into \c out, e.g. for the fields of a parsed record.
+
+		Instead of a buffer and a reference counter for each string, all payloads are copied behind each other into one slab
+		with the reference counters in front of them, so the whole batch takes a single allocation ( see ReferenceCounted::AllocateSlab() ).
+		Each string references its own range of the slab and the slab is freed with the last of them, which may be released on any thread.
+		The slab is allocated by a default constructed Allocator and freed by the Allocator of that last string, so allocators with state can not be used.
+		The payloads are validated in one sweep over the slab, the terminator behind each payload ends any char cut off at the end of its slice.
+
+		\return \c false if any slice is no well formed utf-8 or the payloads are larger than 4 GB, \c out is left unchanged then.
+		*/
+		static inline bool MakeMany( const Span* slices, u32 count, ThisType* out );
 
 		friend class UTFByteIterator< ThisType >;
 		friend class UTFCharIterator< ThisType >;
@@ -285,15 +678,57 @@ namespace uti
 	private:
 		void CopyConstChar( const ch* text );
 
+		/**
+		\brief Copies \c size bytes of \c text, validating and counting them in parallel chunks.
+
+		\return \c false if \c text holds an invalid char, the string has to be copied by CopyConstChar() then.
+		*/
+		bool CopyConstCharParallel( const ch* text, u32 size );
+
+		/**
+		\brief Implements ValidPrefixParallel(), copying the chunks to \c copy on the way if it is not \c nullptr.
+		*/
+		static inline u32 ValidateChunks( const ch* data, u32 size, u32& charCount, u32 threadCount, ch* copy );
+
 		void CreateEmptyString();
 
+		void MapCase( unicode::CaseMapping mapping );
+
+		/**
+		\brief Returns the offset of the first char at or behind \c pos which fails the quick check for \c form, or the size if there is none.
+		*/
+		u32 FindUnnormalized( u32 pos, unicode::NormalizationForm form ) const;
+
+		/**
+		\brief Normalizes the string to \c form into \c dst, or only calculates the result if \c dst is \c nullptr.
+
+		\return \c true if the result differs from this string.
+		*/
+		bool NormalizeInto( unicode::NormalizationForm form, ch* dst, u32& resultSize, u32& resultChars, bool& resultAscii ) const;
+
 		DataType m_pData;
 		Allocator m_Alloc;
 		u32 m_uiSize;
 		u32 m_uiCharCount;
+		bool m_bAscii;
 	};
 
 
 
+}
+
+namespace std
+{
+	/**
+	\brief Hashes UTF8Strings with their cached Hash().
+	*/
+	template< typename ch, typename Allocator, typename RefCountPolicy >
+	struct hash< ::uti::UTF8String< ch, Allocator, RefCountPolicy > >
+	{
+		size_t operator()( const ::uti::UTF8String< ch, Allocator, RefCountPolicy >& string ) const
+		{
+			return static_cast< size_t >( string.Hash() );
+		}
+	};
 }
 #endif // utiUTF8String_h__
@@ -7,33 +7,47 @@ namespace uti
 	//////////////////////////////////////////////////////////////////////////
 	// UTF-8 String Implementation
 	//////////////////////////////////////////////////////////////////////////
-	template < typename ch /*= char*/, typename Allocator /*= DefaultAllocator */>
-	UTF8String<ch, Allocator>::UTF8String( void )
+	template < typename ch /*= char*/, typename Allocator /*= DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
+	UTF8String< ch, Allocator, RefCountPolicy >::UTF8String( void )
 	{
 		CreateEmptyString();
 	}
 
-	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */>
-	UTF8String<ch, Allocator>::UTF8String( const UTF8String< ch, Allocator >& rhs ) :
+	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
+	UTF8String< ch, Allocator, RefCountPolicy >::UTF8String( const UTF8String< ch, Allocator, RefCountPolicy >& rhs ) :
 		m_pData( rhs.m_pData ),
 		m_uiSize( rhs.m_uiSize ),
 		m_Alloc( rhs.m_Alloc ),
-		m_uiCharCount( rhs.m_uiCharCount )
+		m_uiCharCount( rhs.m_uiCharCount ),
+		m_bAscii( rhs.m_bAscii )
 	{
 
 	}
 
+	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
+	UTF8String< ch, Allocator, RefCountPolicy >::UTF8String( UTF8String< ch, Allocator, RefCountPolicy >&& rhs ) :
+		m_pData( std::move( rhs.m_pData ) ),
+		m_Alloc( rhs.m_Alloc ),
+		m_uiSize( rhs.m_uiSize ),
+		m_uiCharCount( rhs.m_uiCharCount ),
+		m_bAscii( rhs.m_bAscii )
+	{
+		// The moved from string stays usable, as an empty string
+		rhs.CreateEmptyString();
+	}
 
-	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */>
-	uti::UTF8String<ch, Allocator>::UTF8String( const ReferenceCounted< ch, Allocator >& data, u32 size, u32 charSize ) :
+
+	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
+	uti::UTF8String< ch, Allocator, RefCountPolicy >::UTF8String( const DataType& data, u32 size, u32 charSize, bool isAscii /*= false */ ) :
 		m_pData( data ),
 		m_uiSize( size ),
-		m_uiCharCount( charSize )
+		m_uiCharCount( charSize ),
+		m_bAscii( isAscii )
 	{
 	}
 
-	template < typename ch /*= char*/, typename Allocator /*= DefaultAllocator */>
-	UTF8String<ch, Allocator>::UTF8String( const ch* text )
+	template < typename ch /*= char*/, typename Allocator /*= DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
+	UTF8String< ch, Allocator, RefCountPolicy >::UTF8String( const ch* text )
 	{
 		if( text != nullptr )
 		{
@@ -45,77 +59,435 @@ namespace uti
 		}
 	}
 
-	template < typename ch /*= char*/, typename Allocator /*= DefaultAllocator */>
-	UTF8String<ch, Allocator>::~UTF8String()
+	template < typename ch /*= char*/, typename Allocator /*= DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
+	UTF8String< ch, Allocator, RefCountPolicy >::~UTF8String()
 	{
 		m_pData.SetNull();
 		m_uiSize = 0U;
 		m_uiCharCount = 0U;
 	}
 
-	template < typename ch /*= char*/, typename Allocator /*= DefaultAllocator */>
+	template < typename ch /*= char*/, typename Allocator /*= DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
 	template< ::uti::BinaryOrder order >
-	static inline UTF8String<ch, Allocator>
-		UTF8String<ch, Allocator>::FromWideString( const wchar_t* text )
-	{
-		UTF8String<ch, Allocator> tmpString;
-		UTF16String< wchar_t, order, Allocator > utf16String = UTF16String< wchar_t, order, Allocator >( text );
-		u32 curIndex = 0U;
-		u32 curSize = utf16String.CharCount() + sizeof( ch );
-		u32 curActualSize = 0U;
+	inline UTF8String< ch, Allocator, RefCountPolicy >
+		UTF8String< ch, Allocator, RefCountPolicy >::FromWideString( const wchar_t* text )
+	{
+		// The chars are validated while constructing the utf-16 string, the result is allocated once with its exact size
+		UTF16String< wchar_t, order, Allocator > utf16String( text );
+		return ToUTF8< ThisType >( utf16String, ParallelThreadCount.load( std::memory_order_relaxed ) );
+	}
+
+
+	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
+	UTF8String< ch, Allocator, RefCountPolicy > UTF8String< ch, Allocator, RefCountPolicy >::FromUTF16BE( const wchar_t* text )
+	{
+		return FromWideString< ::uti::BinaryOrder::BigEndian >( text );
+	}
+
+	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
+	UTF8String< ch, Allocator, RefCountPolicy > UTF8String< ch, Allocator, RefCountPolicy >::FromUTF16LE( const wchar_t* text )
+	{
+		return FromWideString< ::uti::BinaryOrder::LittleEndian >( text );
+	}
+
+	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
+	bool UTF8String< ch, Allocator, RefCountPolicy >::FromFile( const char* path, ThisType& result )
+	{
+		static_assert( sizeof( ch ) == 1U, "Files are loaded as utf-8 bytes" );
+		result = ThisType();
 		u32 size = 0U;
-		u32 codePoint = 0U;
-		tmpString.m_pData = static_cast< ch* >( tmpString.m_Alloc.AllocateBytes( curSize ) );
+		size_t mappedSize = 0U;
+		ch* content = reinterpret_cast< ch* >( detail::FileLoader< RefCountPolicy >::Load( path, size, mappedSize, result.m_Alloc ) );
+		if( content == nullptr )
+		{
+			return false;
+		}
 
-		for( UTF16String< wchar_t, order, Allocator >::CharIterator iter = utf16String.CharBegin();
-			iter != utf16String.CharEnd();
-			++iter )
+		// Owned by the reference counter from here on, so an invalid file is released by the RefCountPolicy as well
+		DataType data( content );
+		data.SetMappedSize( mappedSize );
+		u32 charCount = 0U;
+		if( ValidPrefixParallel( content, size, charCount ) != size )
 		{
-			codePoint = UTF16String< wchar_t, order, Allocator >::ExtractCodePoint( *iter );
-			size = GetCodePointSize( codePoint );
-			if( curIndex + size > curSize )
-			{
-				DataType tmpData = DataType( static_cast< ch* >( tmpString.m_Alloc.AllocateBytes( curSize * 2U ) ) );
-				curSize *= 2;
-				memcpy( tmpData.Ptr(), tmpString.m_pData.Ptr(), curIndex );
-				tmpString.m_pData = tmpData;
-			}
-			FromCodePoint( codePoint, tmpString.m_pData.Ptr() + curIndex );
-			curActualSize += size;
-			curIndex += size;
+			return false;
+		}
+		result = ThisType( data, size, charCount, charCount == size );
+		return true;
+	}
 
+	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
+	bool UTF8String< ch, Allocator, RefCountPolicy >::MakeMany( const Span* slices, u32 count, ThisType* out )
+	{
+		if( count == 0U )
+		{
+			return true;
+		}
+
+		u64 slabSize = 0U;
+		for( u32 i = 0U; i < count; ++i )
+		{
+			slabSize += static_cast< u64 >( slices[ i ].Size() ) + 1U;
+		}
+		if( slabSize > 0xFFFFFFFFULL )
+		{
+			return false;
+		}
+
+		Allocator alloc;
+		ReferenceCountedHeader* headers = nullptr;
+		ch* slab = DataType::AllocateSlab( alloc, count, static_cast< u32 >( slabSize ), headers );
+		if( slab == nullptr )
+		{
+			return false;
 		}
 
-		if( curIndex >= curSize )
+		ch* dst = slab;
+		for( u32 i = 0U; i < count; ++i )
 		{
-			DataType tmpData = DataType( static_cast< ch* >( tmpString.m_Alloc.AllocateBytes( curSize + sizeof( ch ) ) ) );
-			curSize += sizeof( ch );
-			memcpy( tmpData.Ptr(), tmpString.m_pData.Ptr(), curActualSize );
-			tmpString.m_pData = tmpData;
+			const u32 size = slices[ i ].Size();
+			std::memcpy( dst, slices[ i ].begin(), size * sizeof( ch ) );
+			dst[ size ] = 0U;
+			dst += size + 1U;
+		}
+		if( ValidPrefix( slab, static_cast< u32 >( slabSize ) ) != slabSize )
+		{
+			DataType::FreeSlab( alloc, headers );
+			return false;
+		}
 
+		dst = slab;
+		for( u32 i = 0U; i < count; ++i )
+		{
+			const u32 size = slices[ i ].Size();
+			const u32 charCount = CountChars( dst, size );
+			out[ i ] = ThisType( DataType( dst, headers + i ), size, charCount, charCount == size );
+			dst += size + 1U;
 		}
-		tmpString.m_pData[ curIndex ] = 0U;
-		tmpString.m_uiSize = curActualSize;
-		tmpString.m_uiCharCount = utf16String.CharCount();
-		return tmpString;
+		return true;
 	}
 
 
-	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */>
-	UTF8String<ch, Allocator> UTF8String<ch, Allocator>::FromUTF16BE( const wchar_t* text )
+	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
+	UTF8String< ch, Allocator, RefCountPolicy > UTF8String< ch, Allocator, RefCountPolicy >::ToUpper( void ) const
 	{
-		return FromWideString< ::uti::BinaryOrder::BigEndian >( text );
+		UTF8String< ch, Allocator, RefCountPolicy > result( *this );
+		result.MapCase( unicode::CaseMapping::Upper );
+		return result;
 	}
 
-	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */>
-	UTF8String<ch, Allocator> UTF8String<ch, Allocator>::FromUTF16LE( const wchar_t* text )
+	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
+	UTF8String< ch, Allocator, RefCountPolicy > UTF8String< ch, Allocator, RefCountPolicy >::ToLower( void ) const
 	{
-		return FromWideString< ::uti::BinaryOrder::LittleEndian >( text );
+		UTF8String< ch, Allocator, RefCountPolicy > result( *this );
+		result.MapCase( unicode::CaseMapping::Lower );
+		return result;
+	}
+
+	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
+	UTF8String< ch, Allocator, RefCountPolicy > UTF8String< ch, Allocator, RefCountPolicy >::CaseFold( void ) const
+	{
+		UTF8String< ch, Allocator, RefCountPolicy > result( *this );
+		result.MapCase( unicode::CaseMapping::Fold );
+		return result;
+	}
+
+	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
+	void UTF8String< ch, Allocator, RefCountPolicy >::MakeUpper( void )
+	{
+		MapCase( unicode::CaseMapping::Upper );
+	}
+
+	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
+	void UTF8String< ch, Allocator, RefCountPolicy >::MakeLower( void )
+	{
+		MapCase( unicode::CaseMapping::Lower );
+	}
+
+	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
+	void UTF8String< ch, Allocator, RefCountPolicy >::MakeCaseFolded( void )
+	{
+		MapCase( unicode::CaseMapping::Fold );
 	}
 
+	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
+	void UTF8String< ch, Allocator, RefCountPolicy >::MapCase( unicode::CaseMapping mapping )
+	{
+		u32 resultSize = 0U;
+		u32 resultChars = 0U;
+		bool resultAscii = true;
+		bool behindSource = true;
+		if( !MapCaseInto( m_pData.Ptr(), m_uiSize, mapping, nullptr, resultSize, resultChars, resultAscii, behindSource ) )
+		{
+			return;
+		}
+
+		bool inPlace = behindSource && resultSize == m_uiSize && m_pData.Count() == 1U;
+		ch* result = inPlace ? m_pData.Ptr() : static_cast< ch* >( m_Alloc.AllocateBytes( resultSize + sizeof( ch ) ) );
+		MapCaseInto( m_pData.Ptr(), m_uiSize, mapping, result, resultSize, resultChars, resultAscii, behindSource );
+		result[ resultSize ] = 0;
+
+		if( inPlace )
+		{
+			// The cached hashes describe the old contents
+			m_pData.ClearCached();
+		}
+		else
+		{
+			m_pData = result;
+		}
+		m_uiSize = resultSize;
+		m_uiCharCount = resultChars;
+		m_bAscii = resultAscii;
+	}
+
+	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
+	bool UTF8String< ch, Allocator, RefCountPolicy >::MapCaseInto( const ch* data, u32 size, unicode::CaseMapping mapping, ch* dst,
+		u32& resultSize, u32& resultChars, bool& resultAscii, bool& behindSource )
+	{
+		// Folding ASCII letters is lowering them
+		const bool upper = mapping == unicode::CaseMapping::Upper;
+		const char firstChanged = upper ? 'a' : 'A';
+		const unsigned char* src = reinterpret_cast< const unsigned char* >( data );
+		unsigned char* out = reinterpret_cast< unsigned char* >( dst );
+		u32 mapped[ unicode::MaxCaseMappingLength ];
+
+		// The source is always read in front of the result, so the result can be written over the source while it stays behind it
+		resultSize = 0U;
+		resultChars = 0U;
+		resultAscii = true;
+		behindSource = true;
+		bool changed = false;
+		u32 pos = 0U;
+		while( pos < size )
+		{
+			while( pos + 16U <= size && simd::HighBitMask16( src + pos ) == 0U )
+			{
+				if( out != nullptr )
+				{
+					simd::ConvertAsciiCase16( src + pos, out + resultSize, upper );
+				}
+				else
+				{
+					changed = changed || simd::AsciiCaseMask16( src + pos, upper ) != 0U;
+				}
+				pos += 16U;
+				resultSize += 16U;
+				resultChars += 16U;
+			}
+			if( pos == size )
+			{
+				break;
+			}
+
+			if( src[ pos ] < 0x80U )
+			{
+				unsigned char byte = src[ pos ];
+				bool letter = static_cast< unsigned char >( byte - firstChanged ) < 26U;
+				changed = changed || letter;
+				if( out != nullptr )
+				{
+					out[ resultSize ] = letter ? static_cast< unsigned char >( byte ^ 0x20U ) : byte;
+				}
+				++pos;
+				++resultSize;
+				++resultChars;
+				continue;
+			}
+
+			u32 codePoint = ExtractCodePoint( data + pos );
+			pos += CharSize( data + pos );
+			u32 count = unicode::MapCase( codePoint, mapping, mapped );
+			changed = changed || count != 1U || mapped[ 0 ] != codePoint;
+			for( u32 i = 0U; i < count; ++i )
+			{
+				if( out != nullptr )
+				{
+					FromCodePoint( mapped[ i ], dst + resultSize );
+				}
+				resultSize += GetCodePointSize( mapped[ i ] );
+				resultAscii = resultAscii && mapped[ i ] < 0x80U;
+			}
+			resultChars += count;
+			behindSource = behindSource && resultSize <= pos;
+		}
+		return changed;
+	}
+
+	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
+	UTF8String< ch, Allocator, RefCountPolicy > UTF8String< ch, Allocator, RefCountPolicy >::Normalize( unicode::NormalizationForm form ) const
+	{
+		UTF8String< ch, Allocator, RefCountPolicy > result( *this );
+		result.MakeNormalized( form );
+		return result;
+	}
+
+	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
+	void UTF8String< ch, Allocator, RefCountPolicy >::MakeNormalized( unicode::NormalizationForm form )
+	{
+		u32 resultSize = 0U;
+		u32 resultChars = 0U;
+		bool resultAscii = false;
+		if( !NormalizeInto( form, nullptr, resultSize, resultChars, resultAscii ) )
+		{
+			return;
+		}
+
+		ch* result = static_cast< ch* >( m_Alloc.AllocateBytes( resultSize + sizeof( ch ) ) );
+		NormalizeInto( form, result, resultSize, resultChars, resultAscii );
+		result[ resultSize ] = 0;
+
+		m_pData = result;
+		m_uiSize = resultSize;
+		m_uiCharCount = resultChars;
+		m_bAscii = resultAscii;
+	}
 
-	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */>
-	u32 UTF8String<ch, Allocator>::GetCodePointSize( u32 codePoint )
+	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
+	bool UTF8String< ch, Allocator, RefCountPolicy >::IsNormalized( unicode::NormalizationForm form ) const
+	{
+		if( FindUnnormalized( 0U, form ) == m_uiSize )
+		{
+			return true;
+		}
+		u32 resultSize = 0U;
+		u32 resultChars = 0U;
+		bool resultAscii = false;
+		return !NormalizeInto( form, nullptr, resultSize, resultChars, resultAscii );
+	}
+
+	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
+	u32 UTF8String< ch, Allocator, RefCountPolicy >::FindUnnormalized( u32 pos, unicode::NormalizationForm form ) const
+	{
+		const unsigned char* src = reinterpret_cast< const unsigned char* >( m_pData.Ptr() );
+		const unsigned char threshold = unicode::detail::QuickCheckLeadBytes[ static_cast< u32 >( form ) ];
+		u32 lastClass = 0U;
+		while( pos < m_uiSize )
+		{
+			// Bytes below the threshold only belong to starters which are normalized in every context
+			if( pos + 16U <= m_uiSize && simd::ByteAtLeastMask16( src + pos, threshold ) == 0U )
+			{
+				pos += 16U;
+				// The block may end inside a char, whose lead byte was below the threshold as well
+				while( pos < m_uiSize && ( src[ pos ] & 0xC0U ) == 0x80U )
+				{
+					++pos;
+				}
+				lastClass = 0U;
+				continue;
+			}
+
+			if( src[ pos ] < threshold )
+			{
+				pos += src[ pos ] < 0x80U ? 1U : CharSize( m_pData.Ptr() + pos );
+				lastClass = 0U;
+				continue;
+			}
+
+			u32 codePoint = ExtractCodePoint( m_pData.Ptr() + pos );
+			u32 combiningClass = unicode::CanonicalCombiningClass( codePoint );
+			if( ( combiningClass != 0U && lastClass > combiningClass ) || unicode::QuickCheck( codePoint, form ) != unicode::QuickCheckResult::Yes )
+			{
+				return pos;
+			}
+			lastClass = combiningClass;
+			pos += CharSize( m_pData.Ptr() + pos );
+		}
+		return m_uiSize;
+	}
+
+	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
+	bool UTF8String< ch, Allocator, RefCountPolicy >::NormalizeInto( unicode::NormalizationForm form, ch* dst, u32& resultSize, u32& resultChars, bool& resultAscii ) const
+	{
+		const ch* src = m_pData.Ptr();
+		const bool compatibility = form == unicode::NormalizationForm::NFKC || form == unicode::NormalizationForm::NFKD;
+		u32 localBuffer[ 64 ];
+		bool changed = false;
+		u32 written = 0U;
+		u32 chars = m_uiCharCount;
+		u32 copied = 0U;
+		u32 pos = FindUnnormalized( 0U, form );
+		while( pos < m_uiSize )
+		{
+			// The span starts at the last boundary in front of the failing char, the chars before it are copied unchanged
+			u32 begin = pos;
+			while( begin > copied )
+			{
+				do
+				{
+					--begin;
+				} while( ( static_cast< unsigned char >( src[ begin ] ) & 0xC0U ) == 0x80U );
+				if( unicode::IsNormalizationBoundary( ExtractCodePoint( src + begin ), form ) )
+				{
+					break;
+				}
+			}
+			// and ends in front of the next boundary
+			u32 end = pos + CharSize( src + pos );
+			while( end < m_uiSize && !unicode::IsNormalizationBoundary( ExtractCodePoint( src + end ), form ) )
+			{
+				end += CharSize( src + end );
+			}
+
+			if( dst != nullptr )
+			{
+				std::memcpy( dst + written, src + copied, begin - copied );
+			}
+			written += begin - copied;
+
+			// Decompose the span, then reorder and compose it
+			u32 capacity = ( end - begin ) * unicode::MaxDecompositionPerUtf8Byte;
+			u32* codePoints = capacity <= 64U ? localBuffer : static_cast< u32* >( m_Alloc.AllocateBytes( capacity * sizeof( u32 ) ) );
+			u32 count = 0U;
+			u32 spanChars = 0U;
+			for( u32 charPos = begin; charPos < end; charPos += CharSize( src + charPos ) )
+			{
+				count += unicode::Decompose( ExtractCodePoint( src + charPos ), compatibility, codePoints + count );
+				++spanChars;
+			}
+			UTI_ASSERT( count <= capacity );
+			count = unicode::NormalizeDecomposed( codePoints, count, form );
+
+			bool spanChanged = count != spanChars;
+			u32 charPos = begin;
+			for( u32 i = 0U; i < count; ++i )
+			{
+				if( !spanChanged )
+				{
+					spanChanged = ExtractCodePoint( src + charPos ) != codePoints[ i ];
+					charPos += CharSize( src + charPos );
+				}
+				if( dst != nullptr )
+				{
+					FromCodePoint( codePoints[ i ], dst + written );
+				}
+				written += GetCodePointSize( codePoints[ i ] );
+			}
+			changed = changed || spanChanged;
+			chars = chars - spanChars + count;
+
+			if( codePoints != localBuffer )
+			{
+				m_Alloc.FreeBytes( codePoints );
+			}
+			copied = end;
+			pos = FindUnnormalized( end, form );
+		}
+
+		if( dst != nullptr )
+		{
+			std::memcpy( dst + written, src + copied, m_uiSize - copied );
+		}
+		written += m_uiSize - copied;
+
+		resultSize = written;
+		resultChars = chars;
+		// Every char is a single byte exactly if the string is ASCII
+		resultAscii = chars == written;
+		return changed;
+	}
+
+	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
+	u32 UTF8String< ch, Allocator, RefCountPolicy >::GetCodePointSize( u32 codePoint )
 	{
 		if( codePoint < 0x0080U )
 		{
@@ -139,8 +511,8 @@ namespace uti
 		}
 	}
 
-	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */>
-	void UTF8String<ch, Allocator>::FromCodePoint( u32 codePoint, ch* dst )
+	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
+	void UTF8String< ch, Allocator, RefCountPolicy >::FromCodePoint( u32 codePoint, ch* dst )
 	{
 		u32 size = GetCodePointSize( codePoint );
 		static const u32 mask7bit = 0x7FU;
@@ -177,18 +549,19 @@ namespace uti
 		}
 	}
 
-	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */>
-	void UTF8String<ch, Allocator>::CreateEmptyString()
+	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
+	void UTF8String< ch, Allocator, RefCountPolicy >::CreateEmptyString()
 	{
 		m_pData = static_cast< ch* >( m_Alloc.AllocateBytes( sizeof( ch ) ) );
 		m_pData[ 0 ] = 0U;
 		m_uiSize = 0U;
 		m_uiCharCount = 0U;
+		m_bAscii = true;
 	}
 
-	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */>
+	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
 	inline
-	s32 uti::UTF8String<ch, Allocator>::FindFirst( const UTF8String< ch, Allocator > needle ) const
+	s32 uti::UTF8String< ch, Allocator, RefCountPolicy >::FindFirst( const UTF8String< ch, Allocator, RefCountPolicy > needle ) const
 	{
 		auto begin = CharBegin();
 		auto end = CharEnd();
@@ -211,21 +584,27 @@ namespace uti
 	}
 
 
-	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */>
-	u32 UTF8String<ch, Allocator>::Size( void ) const
+	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
+	u32 UTF8String< ch, Allocator, RefCountPolicy >::Size( void ) const
 	{
 		return m_uiSize;
 	}
 
-	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */>
-	u32 UTF8String<ch, Allocator>::CharCount( void ) const
+	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
+	u32 UTF8String< ch, Allocator, RefCountPolicy >::CharCount( void ) const
 	{
 		return m_uiCharCount;
 	}
 
-	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */>
-	u32 UTF8String<ch, Allocator>::ExtractCodePoint( const ch* utfchar )
+	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
+	u32 UTF8String< ch, Allocator, RefCountPolicy >::ExtractCodePoint( const ch* utfchar )
 	{
+		// ASCII chars are their own code point
+		if( ( static_cast< unsigned char >( *utfchar ) & 0x80U ) == 0U )
+		{
+			return static_cast< u32 >( static_cast< unsigned char >( *utfchar ) );
+		}
+
 		u32 length = ValidChar( utfchar );
 		if( length == 0U )
 		{
@@ -241,6 +620,7 @@ namespace uti
 				// Easiest case BXXXXXXX; we want the Xes, but B is always 0 so simply return the value.
 			case 1U:
 				result = *utfchar;
+				break;
 				// Second case is BBBXXXXX BBXXXXXX, so we filter the second byte by 0x3FU.
 				// Then filter the first by 0x1FU and shift it 6 bits to the left, to attach it to the second value
 			case 2U:
@@ -274,8 +654,309 @@ namespace uti
 
 
 
-	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */>
-	u32 UTF8String<ch, Allocator>::Concat( const UTF8String<ch, Allocator>& rhs )
+	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
+	u32 UTF8String< ch, Allocator, RefCountPolicy >::AdvanceChars( const ch* data, u32 pos, u32 size, u32 count )
+	{
+		if( count == 0U || pos >= size )
+		{
+			return pos < size ? pos : size;
+		}
+
+		const unsigned char* bytes = reinterpret_cast< const unsigned char* >( data );
+		u32 cur = pos + 1U;
+
+		// Every byte which is not a continuation byte starts a new char, so count them a block at a time
+		// and only pick the exact position inside the block which contains the target char
+		while( cur + simd::BlockSize <= size )
+		{
+			u32 leadMask = simd::Utf8LeadMask( bytes + cur );
+			u32 leadCount = simd::PopCount( leadMask );
+			if( leadCount >= count )
+			{
+				return cur + simd::SelectBit( leadMask, count - 1U );
+			}
+			count -= leadCount;
+			cur += simd::BlockSize;
+		}
+
+		for( ; cur < size; ++cur )
+		{
+			if( ( bytes[ cur ] & 0xC0U ) != 0x80U && --count == 0U )
+			{
+				return cur;
+			}
+		}
+		return size;
+	}
+
+	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
+	u32 UTF8String< ch, Allocator, RefCountPolicy >::RetreatChars( const ch* data, u32 pos, u32 count )
+	{
+		if( count == 0U )
+		{
+			return pos;
+		}
+
+		const unsigned char* bytes = reinterpret_cast< const unsigned char* >( data );
+		u32 cur = pos;
+
+		// Same as AdvanceChars, but the blocks end at cur and the target is counted from the highest bit
+		while( cur >= simd::BlockSize )
+		{
+			u32 leadMask = simd::Utf8LeadMask( bytes + cur - simd::BlockSize );
+			u32 leadCount = simd::PopCount( leadMask );
+			if( leadCount >= count )
+			{
+				return cur - simd::BlockSize + simd::SelectBit( leadMask, leadCount - count );
+			}
+			count -= leadCount;
+			cur -= simd::BlockSize;
+		}
+
+		while( cur > 0U )
+		{
+			--cur;
+			if( ( bytes[ cur ] & 0xC0U ) != 0x80U && --count == 0U )
+			{
+				return cur;
+			}
+		}
+		return 0U;
+	}
+
+	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
+	u32 UTF8String< ch, Allocator, RefCountPolicy >::CountChars( const ch* data, u32 size )
+	{
+		const unsigned char* bytes = reinterpret_cast< const unsigned char* >( data );
+		u32 count = 0U;
+		u32 cur = 0U;
+		for( ; cur + simd::BlockSize <= size; cur += simd::BlockSize )
+		{
+			count += simd::PopCount( simd::Utf8LeadMask( bytes + cur ) );
+		}
+		for( ; cur < size; ++cur )
+		{
+			if( ( bytes[ cur ] & 0xC0U ) != 0x80U )
+			{
+				++count;
+			}
+		}
+		return count;
+	}
+
+	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
+	u32 UTF8String< ch, Allocator, RefCountPolicy >::ValidPrefix( const ch* data, u32 size )
+	{
+		const unsigned char* bytes = reinterpret_cast< const unsigned char* >( data );
+		u32 pos = 0U;
+		while( pos < size )
+		{
+			while( pos + 16U <= size )
+			{
+				u32 high = simd::HighBitMask16( bytes + pos );
+				if( high != 0U )
+				{
+					pos += simd::LowestBit( high );
+					break;
+				}
+				pos += 16U;
+			}
+			if( pos == size )
+			{
+				break;
+			}
+			const unsigned char lead = bytes[ pos ];
+			if( lead < 0x80U )
+			{
+				++pos;
+				continue;
+			}
+			// The second byte has a narrower range after the leads which would allow overlong forms, surrogates or too large code points
+			u32 length;
+			unsigned char low = 0x80U;
+			unsigned char high = 0xBFU;
+			if( lead < 0xC2U )
+			{
+				return pos;
+			}
+			else if( lead < 0xE0U )
+			{
+				length = 2U;
+			}
+			else if( lead < 0xF0U )
+			{
+				length = 3U;
+				low = lead == 0xE0U ? 0xA0U : low;
+				high = lead == 0xEDU ? 0x9FU : high;
+			}
+			else if( lead < 0xF5U )
+			{
+				length = 4U;
+				low = lead == 0xF0U ? 0x90U : low;
+				high = lead == 0xF4U ? 0x8FU : high;
+			}
+			else
+			{
+				return pos;
+			}
+			if( length > size - pos || bytes[ pos + 1U ] < low || bytes[ pos + 1U ] > high )
+			{
+				return pos;
+			}
+			for( u32 i = 2U; i < length; ++i )
+			{
+				if( ( bytes[ pos + i ] & 0xC0U ) != 0x80U )
+				{
+					return pos;
+				}
+			}
+			pos += length;
+		}
+		return pos;
+	}
+
+	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
+	u32 UTF8String< ch, Allocator, RefCountPolicy >::ValidPrefixParallel( const ch* data, u32 size, u32& charCount, u32 threadCount /*= 0U */ )
+	{
+		return ValidateChunks( data, size, charCount, threadCount, nullptr );
+	}
+
+	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
+	u32 UTF8String< ch, Allocator, RefCountPolicy >::ValidateChunks( const ch* data, u32 size, u32& charCount, u32 threadCount, ch* copy )
+	{
+		const u32 chunkCount = detail::ChunkCount( size, ParallelChunkSize, threadCount );
+		if( chunkCount < 2U )
+		{
+			if( copy != nullptr )
+			{
+				std::memcpy( copy, data, size * sizeof( ch ) );
+			}
+			u32 valid = ValidPrefix( data, size );
+			charCount = CountChars( data, valid );
+			return valid;
+		}
+
+		// Move the chunk starts behind the continuation bytes, more than three in a row are invalid in any case
+		const unsigned char* bytes = reinterpret_cast< const unsigned char* >( data );
+		u32 starts[ detail::MaxChunkCount + 1U ];
+		u32 valid[ detail::MaxChunkCount ];
+		u32 counts[ detail::MaxChunkCount ];
+		for( u32 i = 0U; i < chunkCount; ++i )
+		{
+			u32 start = static_cast< u32 >( static_cast< u64 >( size ) * i / chunkCount );
+			for( u32 skipped = 0U; skipped < 3U && start < size && start != 0U && ( bytes[ start ] & 0xC0U ) == 0x80U; ++skipped )
+			{
+				++start;
+			}
+			starts[ i ] = start;
+		}
+		starts[ chunkCount ] = size;
+
+		detail::RunChunks( chunkCount, [ & ]( u32 i )
+		{
+			u32 chunkSize = starts[ i + 1U ] - starts[ i ];
+			if( copy != nullptr )
+			{
+				std::memcpy( copy + starts[ i ], data + starts[ i ], chunkSize * sizeof( ch ) );
+			}
+			valid[ i ] = starts[ i ] + ValidPrefix( data + starts[ i ], chunkSize );
+			counts[ i ] = CountChars( data + starts[ i ], valid[ i ] - starts[ i ] );
+		} );
+
+		// The first chunk with an invalid char holds the first invalid char of the data
+		charCount = 0U;
+		for( u32 i = 0U; i < chunkCount; ++i )
+		{
+			charCount += counts[ i ];
+			if( valid[ i ] != starts[ i + 1U ] )
+			{
+				return valid[ i ];
+			}
+		}
+		return size;
+	}
+
+	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
+	u32 UTF8String< ch, Allocator, RefCountPolicy >::SimpleGraphemeRun( const ch* data, u32 size )
+	{
+		const unsigned char* bytes = reinterpret_cast< const unsigned char* >( data );
+		u32 pos = 0U;
+		while( pos + 16U <= size && simd::ByteAtLeastMask16( bytes + pos, unicode::detail::GraphemeSimpleLeadByte ) == 0U &&
+			simd::ByteEqualMask16( bytes + pos, '\r' ) == 0U )
+		{
+			pos += 16U;
+		}
+		if( pos == 0U )
+		{
+			return 0U;
+		}
+		// Step back onto the start of the last char, which may straddle the end of the last block
+		do
+		{
+			--pos;
+		} while( pos > 0U && ( bytes[ pos ] & 0xC0U ) == 0x80U );
+		return pos;
+	}
+
+	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
+	u32 UTF8String< ch, Allocator, RefCountPolicy >::AsciiWordRun( const ch* data, u32 size )
+	{
+		const unsigned char* bytes = reinterpret_cast< const unsigned char* >( data );
+		u32 pos = 0U;
+		for( ; pos + 16U <= size; pos += 16U )
+		{
+			u32 other = simd::AsciiWordMask16( bytes + pos ) ^ 0xFFFFU;
+			if( other != 0U )
+			{
+				return pos + simd::LowestBit( other );
+			}
+		}
+		while( pos < size && ( static_cast< unsigned char >( ( bytes[ pos ] | 0x20U ) - 'a' ) < 26U ||
+			static_cast< unsigned char >( bytes[ pos ] - '0' ) < 10U || bytes[ pos ] == '_' ) )
+		{
+			++pos;
+		}
+		return pos;
+	}
+
+	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
+	u32 UTF8String< ch, Allocator, RefCountPolicy >::AsciiSentenceRun( const ch* data, u32 size )
+	{
+		const unsigned char* bytes = reinterpret_cast< const unsigned char* >( data );
+		u32 pos = 0U;
+		for( ; pos + 16U <= size; pos += 16U )
+		{
+			const unsigned char* block = bytes + pos;
+			u32 stop = simd::HighBitMask16( block ) | simd::ByteEqualMask16( block, '.' ) | simd::ByteEqualMask16( block, '!' ) |
+				simd::ByteEqualMask16( block, '?' ) | simd::ByteEqualMask16( block, '\r' ) | simd::ByteEqualMask16( block, '\n' );
+			if( stop != 0U )
+			{
+				return pos + simd::LowestBit( stop );
+			}
+		}
+		while( pos < size && bytes[ pos ] < 0x80U && bytes[ pos ] != '.' && bytes[ pos ] != '!' && bytes[ pos ] != '?' &&
+			bytes[ pos ] != '\r' && bytes[ pos ] != '\n' )
+		{
+			++pos;
+		}
+		return pos;
+	}
+
+	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
+	s32 UTF8String< ch, Allocator, RefCountPolicy >::CompareUnits( const ch* lhs, u32 lhsSize, const ch* rhs, u32 rhsSize )
+	{
+		u32 common = lhsSize < rhsSize ? lhsSize : rhsSize;
+		u32 mismatch = simd::Mismatch( lhs, rhs, common );
+		if( mismatch < common )
+		{
+			// Lead bytes grow with the code point and continuation bytes only follow equal lead bytes
+			return static_cast< s32 >( static_cast< unsigned char >( lhs[ mismatch ] ) ) - static_cast< s32 >( static_cast< unsigned char >( rhs[ mismatch ] ) );
+		}
+		return lhsSize < rhsSize ? -1 : ( lhsSize > rhsSize ? 1 : 0 );
+	}
+
+	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
+	u32 UTF8String< ch, Allocator, RefCountPolicy >::Concat( const UTF8String< ch, Allocator, RefCountPolicy >& rhs )
 	{
 		u32 newSize = m_uiSize + rhs.m_uiSize;
 		ch* newRawStringData = static_cast< ch* >( m_Alloc.AllocateBytes( newSize + sizeof( ch ) ) );
@@ -286,12 +967,13 @@ namespace uti
 		m_pData = newRawStringData;
 		m_uiSize = newSize;
 		m_uiCharCount += rhs.m_uiCharCount;
+		m_bAscii = m_bAscii && rhs.m_bAscii;
 		return newSize;
 	}
 
 
-	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */>
-	UTF8String< ch, Allocator > uti::UTF8String<ch, Allocator>::Substr( const typename UTF8String< typename ch, typename Allocator>::CharIterator& endIt ) const
+	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
+	UTF8String< ch, Allocator, RefCountPolicy > uti::UTF8String< ch, Allocator, RefCountPolicy >::Substr( const typename UTF8String< ch, Allocator, RefCountPolicy >::CharIterator& endIt ) const
 	{
 		auto begin = CharBegin();
 		UTI_ASSERT( begin <= endIt && endIt <= CharEnd() );
@@ -299,20 +981,45 @@ namespace uti
 	}
 
 
-	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */>
-	UTF8String< ch, Allocator > uti::UTF8String<ch, Allocator>::Substr( u32 start, u32 end ) const
+	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
+	UTF8String< ch, Allocator, RefCountPolicy > uti::UTF8String< ch, Allocator, RefCountPolicy >::Substr( u32 start, u32 end ) const
+	{
+		UTI_ASSERT( start <= end && end <= CharCount() );
+		return Substr( CharIteratorAt( start ), CharIteratorAt( end ) );
+	}
+
+	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
+	typename UTF8String< ch, Allocator, RefCountPolicy >::CharIterator UTF8String< ch, Allocator, RefCountPolicy >::CharIteratorAt( u32 charIndex ) const
 	{
-		UTI_ASSERT( start < CharCount() && end < CharCount() );
-		return Substr( UTF8String<ch, Allocator>::CharIterator( ( UTF8String& ) *this, start ), UTF8String<ch, Allocator>::CharIterator( ( UTF8String& ) *this, end ) );
+		UTI_ASSERT( charIndex <= CharCount() );
+		if( m_bAscii )
+		{
+			return CharIterator( ( UTF8String& ) *this, charIndex );
+		}
+
+		CharIterator it = CharBegin();
+		it += static_cast< s32 >( charIndex );
+		return it;
 	}
 
-	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */>
-	UTF8String< ch, Allocator > uti::UTF8String<ch, Allocator>::Substr( const CharIterator& start, const CharIterator& endIt /*= CharEnd() */ ) const
+	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
+	u32 UTF8String< ch, Allocator, RefCountPolicy >::CodePointAt( u32 charIndex ) const
+	{
+		UTI_ASSERT( charIndex < CharCount() );
+		if( m_bAscii )
+		{
+			return static_cast< u32 >( static_cast< unsigned char >( m_pData[ charIndex ] ) );
+		}
+		return ExtractCodePoint( *CharIteratorAt( charIndex ) );
+	}
+
+	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
+	UTF8String< ch, Allocator, RefCountPolicy > uti::UTF8String< ch, Allocator, RefCountPolicy >::Substr( const CharIterator& start, const CharIterator& endIt /*= CharEnd() */ ) const
 	{
 		// Early out on any input error
-		if( &endIt.m_String != this || &start.m_String != this || endIt <= start )
+		if( endIt.m_pString != this || start.m_pString != this || endIt <= start )
 		{
-			return UTF8String < ch, Allocator >();
+			return UTF8String< ch, Allocator, RefCountPolicy >();
 		}
 
 		ch* end = *endIt;
@@ -321,38 +1028,39 @@ namespace uti
 
 		Allocator alloc( m_Alloc );
 
-		ReferenceCounted< ch, Allocator > newStringData = DataType( static_cast< ch* >( alloc.AllocateBytes( ( length + 1U ) * sizeof( ch ) ) ) );
+		DataType newStringData = DataType( static_cast< ch* >( alloc.AllocateBytes( ( length + 1U ) * sizeof( ch ) ) ) );
 		std::memcpy( newStringData.Ptr(), begin, length * sizeof( ch ) );
 		newStringData[ length ] = 0U;
-		u32 charSize = 0U;
-		auto it = start;
-		auto endIterator = CharEnd();
-		while( it < endIt && it < endIterator )
+
+		// A substring of an ASCII string is ASCII as well and has one char per byte
+		if( m_bAscii )
 		{
-			++charSize;
-			++it;
+			return UTF8String< ch, Allocator, RefCountPolicy >( newStringData, length, length, true );
 		}
 
-		return UTF8String< ch, Allocator >( newStringData, length, charSize );
+		u32 charSize = CountChars( begin, length );
+
+		// Every char being a single byte means there is no multi byte sequence in the substring
+		return UTF8String< ch, Allocator, RefCountPolicy >( newStringData, length, charSize, charSize == length );
 	}
 
-	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */>
-	UTF8String< ch, Allocator> UTF8String<ch, Allocator>::operator+( const UTF8String<ch, Allocator>& rhs ) const
+	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
+	UTF8String< ch, Allocator, RefCountPolicy > UTF8String< ch, Allocator, RefCountPolicy >::operator+( const UTF8String< ch, Allocator, RefCountPolicy >& rhs ) const
 	{
-		UTF8String< ch, Allocator> newString( *this );
+		UTF8String< ch, Allocator, RefCountPolicy > newString( *this );
 		newString.Concat( rhs );
 		return newString;
 	}
 
-	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */>
-	UTF8String< ch, Allocator>& UTF8String<ch, Allocator>::operator+=( const UTF8String<ch, Allocator>& rhs )
+	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
+	UTF8String< ch, Allocator, RefCountPolicy >& UTF8String< ch, Allocator, RefCountPolicy >::operator+=( const UTF8String< ch, Allocator, RefCountPolicy >& rhs )
 	{
 		Concat( rhs );
 		return *this;
 	}
 
-	template< typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */ >
-	u32 UTF8String<ch, Allocator >::ValidChar( const ch* utfchar )
+	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
+	u32 UTF8String< ch, Allocator, RefCountPolicy >::ValidChar( const ch* utfchar )
 	{
 
 		bool result = true;
@@ -378,8 +1086,8 @@ namespace uti
 	}
 
 
-	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */>
-	u32 UTF8String<ch, Allocator>::CharSize( const ch* utfchar )
+	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
+	u32 UTF8String< ch, Allocator, RefCountPolicy >::CharSize( const ch* utfchar )
 	{
 		u32 numBytes;
 
@@ -407,131 +1115,317 @@ namespace uti
 	}
 
 
-	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */>
-	ch* UTF8String<ch, Allocator>::ReplacementChar = nullptr;
+	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
+	ch* UTF8String< ch, Allocator, RefCountPolicy >::ReplacementChar = nullptr;
+
+	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
+	std::atomic< u32 > UTF8String< ch, Allocator, RefCountPolicy >::ParallelThreshold( 4U * ParallelChunkSize );
 
-	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */>
-	UTF8String< ch, Allocator>& UTF8String<ch, Allocator>::operator=( const ch* rhs )
+	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
+	std::atomic< u32 > UTF8String< ch, Allocator, RefCountPolicy >::ParallelThreadCount( 0U );
+
+	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
+	UTF8String< ch, Allocator, RefCountPolicy >& UTF8String< ch, Allocator, RefCountPolicy >::operator=( const ch* rhs )
 	{
 		CopyConstChar( rhs );
 		return *this;
 	}
 
-	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */>
-	UTF8String< ch, Allocator>& UTF8String<ch, Allocator>::operator=( const UTF8String< ch, Allocator>& rhs )
+	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
+	UTF8String< ch, Allocator, RefCountPolicy >& UTF8String< ch, Allocator, RefCountPolicy >::operator=( const UTF8String< ch, Allocator, RefCountPolicy >& rhs )
 	{
 		m_pData = rhs.m_pData;
 		m_uiSize = rhs.m_uiSize;
 		m_Alloc = rhs.m_Alloc;
 		m_uiCharCount = rhs.m_uiCharCount;
+		m_bAscii = rhs.m_bAscii;
 		return *this;
 	}
 
-	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */>
-	typename UTF8String<ch, Allocator>::ReverseIterator UTF8String<ch, Allocator>::rEnd( void ) const
+	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
+	UTF8String< ch, Allocator, RefCountPolicy >& UTF8String< ch, Allocator, RefCountPolicy >::operator=( UTF8String< ch, Allocator, RefCountPolicy >&& rhs )
+	{
+		if( this != &rhs )
+		{
+			DataType data( std::move( m_pData ) );
+			m_pData = std::move( rhs.m_pData );
+			rhs.m_pData = std::move( data );
+			std::swap( m_uiSize, rhs.m_uiSize );
+			std::swap( m_uiCharCount, rhs.m_uiCharCount );
+			std::swap( m_bAscii, rhs.m_bAscii );
+		}
+		return *this;
+	}
+
+	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
+	typename UTF8String< ch, Allocator, RefCountPolicy >::ReverseIterator UTF8String< ch, Allocator, RefCountPolicy >::rEnd( void ) const
 	{
 		return ReverseIterator( Begin() );
 	}
 
-	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */>
-	typename UTF8String<ch, Allocator>::ReverseIterator UTF8String<ch, Allocator>::rBegin( void ) const
+	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
+	typename UTF8String< ch, Allocator, RefCountPolicy >::Span UTF8String< ch, Allocator, RefCountPolicy >::Bytes( void ) const UTI_LVALUE_THIS
+	{
+		return Span( m_pData.Ptr(), m_pData.Ptr() + m_uiSize, m_bAscii );
+	}
+
+	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
+	typename UTF8String< ch, Allocator, RefCountPolicy >::CharCursor UTF8String< ch, Allocator, RefCountPolicy >::Chars( void ) const
+	{
+		return CharCursor( m_pData, m_pData.Ptr(), m_pData.Ptr() + m_uiSize, m_bAscii );
+	}
+
+	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
+	typename UTF8String< ch, Allocator, RefCountPolicy >::GraphemeCursor UTF8String< ch, Allocator, RefCountPolicy >::Graphemes( void ) const
+	{
+		return GraphemeCursor( m_pData, m_pData.Ptr(), m_pData.Ptr() + m_uiSize );
+	}
+
+	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
+	u32 UTF8String< ch, Allocator, RefCountPolicy >::GraphemeCount( void ) const
+	{
+		return GraphemeCursor::Count( m_pData.Ptr(), m_pData.Ptr() + m_uiSize );
+	}
+
+	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
+	typename UTF8String< ch, Allocator, RefCountPolicy >::WordCursor UTF8String< ch, Allocator, RefCountPolicy >::Words( void ) const
+	{
+		return WordCursor( m_pData, m_pData.Ptr(), m_pData.Ptr() + m_uiSize );
+	}
+
+	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
+	typename UTF8String< ch, Allocator, RefCountPolicy >::SentenceCursor UTF8String< ch, Allocator, RefCountPolicy >::Sentences( void ) const
+	{
+		return SentenceCursor( m_pData, m_pData.Ptr(), m_pData.Ptr() + m_uiSize );
+	}
+
+	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
+	typename UTF8String< ch, Allocator, RefCountPolicy >::SplitCursor UTF8String< ch, Allocator, RefCountPolicy >::Split( const ThisType& delimiter, SplitOptions options /*= SplitOptions::None */, u32 maxSplits /*= SplitUnlimited */ ) const
+	{
+		return SplitCursor( m_pData, m_pData.Ptr(), m_pData.Ptr() + m_uiSize, delimiter, false, options, maxSplits, m_bAscii );
+	}
+
+	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
+	typename UTF8String< ch, Allocator, RefCountPolicy >::SplitCursor UTF8String< ch, Allocator, RefCountPolicy >::SplitAny( const ThisType& charset, SplitOptions options /*= SplitOptions::None */, u32 maxSplits /*= SplitUnlimited */ ) const
+	{
+		return SplitCursor( m_pData, m_pData.Ptr(), m_pData.Ptr() + m_uiSize, charset, true, options, maxSplits, m_bAscii );
+	}
+
+	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
+	typename UTF8String< ch, Allocator, RefCountPolicy >::ReverseIterator UTF8String< ch, Allocator, RefCountPolicy >::rBegin( void ) const
 	{
 		return ReverseIterator( End() );
 	}
 
-	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */>
-	typename UTF8String<ch, Allocator>::Iterator UTF8String<ch, Allocator>::End( void ) const
+	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
+	typename UTF8String< ch, Allocator, RefCountPolicy >::Iterator UTF8String< ch, Allocator, RefCountPolicy >::End( void ) const
 	{
-		return UTF8String<ch, Allocator>::Iterator( ( UTF8String& ) *this, m_uiSize );
+		return UTF8String< ch, Allocator, RefCountPolicy >::Iterator( ( UTF8String& ) *this, m_uiSize );
 	}
 
-	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */>
-	typename UTF8String<ch, Allocator>::Iterator UTF8String<ch, Allocator>::Begin( void ) const
+	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
+	typename UTF8String< ch, Allocator, RefCountPolicy >::Iterator UTF8String< ch, Allocator, RefCountPolicy >::Begin( void ) const
 	{
-		return UTF8String<ch, Allocator>::Iterator( ( UTF8String& ) *this, 0U );
+		return UTF8String< ch, Allocator, RefCountPolicy >::Iterator( ( UTF8String& ) *this, 0U );
 	}
 
-	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */>
-	typename UTF8String<ch, Allocator>::CharReverseIterator UTF8String<ch, Allocator>::rCharEnd( void ) const
+	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
+	typename UTF8String< ch, Allocator, RefCountPolicy >::Iterator UTF8String< ch, Allocator, RefCountPolicy >::end( void ) const
+	{
+		return End();
+	}
+
+	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
+	typename UTF8String< ch, Allocator, RefCountPolicy >::Iterator UTF8String< ch, Allocator, RefCountPolicy >::begin( void ) const
+	{
+		return Begin();
+	}
+
+	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
+	typename UTF8String< ch, Allocator, RefCountPolicy >::CharReverseIterator UTF8String< ch, Allocator, RefCountPolicy >::rCharEnd( void ) const
 	{
 		return CharReverseIterator( CharBegin() );
 	}
 
-	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */>
-	typename UTF8String<ch, Allocator>::CharReverseIterator UTF8String<ch, Allocator>::rCharBegin( void ) const
+	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
+	typename UTF8String< ch, Allocator, RefCountPolicy >::CharReverseIterator UTF8String< ch, Allocator, RefCountPolicy >::rCharBegin( void ) const
 	{
 		return CharReverseIterator( CharEnd() );
 	}
 
-	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */>
-	typename UTF8String<ch, Allocator>::CharIterator UTF8String<ch, Allocator>::CharEnd( void ) const
+	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
+	typename UTF8String< ch, Allocator, RefCountPolicy >::CharIterator UTF8String< ch, Allocator, RefCountPolicy >::CharEnd( void ) const
 	{
-		return UTF8String<ch, Allocator>::CharIterator( ( UTF8String& ) *this, m_uiSize );
+		return UTF8String< ch, Allocator, RefCountPolicy >::CharIterator( ( UTF8String& ) *this, m_uiSize );
 	}
 
-	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */>
-	typename UTF8String<ch, Allocator>::CharIterator UTF8String<ch, Allocator>::CharBegin( void ) const
+	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
+	typename UTF8String< ch, Allocator, RefCountPolicy >::CharIterator UTF8String< ch, Allocator, RefCountPolicy >::CharBegin( void ) const
 	{
-		return UTF8String<ch, Allocator>::CharIterator( ( UTF8String& ) *this, 0 );
+		return UTF8String< ch, Allocator, RefCountPolicy >::CharIterator( ( UTF8String& ) *this, 0 );
 	}
 
-	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */>
-	bool UTF8String<ch, Allocator>::operator!=( const UTF8String& rhs ) const
+	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
+	bool UTF8String< ch, Allocator, RefCountPolicy >::operator!=( const UTF8String& rhs ) const
 	{
+		return !( *this == rhs );
+	}
 
-		if( m_uiSize != rhs.m_uiSize )
+	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
+	bool UTF8String< ch, Allocator, RefCountPolicy >::operator==( const UTF8String& rhs ) const
+	{
+		// Both strings own the same buffer, so they cannot differ
+		if( m_pData == rhs.m_pData )
 		{
+			UTI_ASSERT( m_uiSize == rhs.m_uiSize );
 			return true;
 		}
 
-		Iterator lStart = Begin();
-		Iterator rStart = rhs.Begin();
-		Iterator lEnd = End();
-		Iterator rEnd = rhs.End();
+		if( m_uiSize != rhs.m_uiSize || m_uiCharCount != rhs.m_uiCharCount )
+		{
+			return false;
+		}
 
-		while( lStart != lEnd && rStart != rEnd )
+		// Strings whose hashes are already known can be told apart without reading them
+		u64 lhsHash;
+		u64 rhsHash;
+		if( m_pData.GetCached( HashCacheSlot::Hash, lhsHash ) && rhs.m_pData.GetCached( HashCacheSlot::Hash, rhsHash ) && lhsHash != rhsHash )
 		{
-			if( *( lStart++ ) != *( rStart++ ) )
-			{
-				return true;
-			}
+			return false;
 		}
 
-		return false;
+		return simd::Equal( m_pData.Ptr(), rhs.m_pData.Ptr(), m_uiSize );
+	}
+
+	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
+	s32 UTF8String< ch, Allocator, RefCountPolicy >::Compare( const UTF8String& rhs ) const
+	{
+		if( m_pData == rhs.m_pData )
+		{
+			return 0;
+		}
+		return CompareUnits( m_pData.Ptr(), m_uiSize, rhs.m_pData.Ptr(), rhs.m_uiSize );
 	}
 
-	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */>
-	bool UTF8String<ch, Allocator>::operator==( const UTF8String& rhs ) const
+	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
+	bool UTF8String< ch, Allocator, RefCountPolicy >::EqualsIgnoreAsciiCase( const UTF8String& rhs ) const
 	{
+		if( m_pData == rhs.m_pData )
+		{
+			return true;
+		}
+		// Folding keeps the size, only the char count can differ for equal strings
 		if( m_uiSize != rhs.m_uiSize )
 		{
 			return false;
 		}
 
-		Iterator lStart = Begin();
-		Iterator rStart = rhs.Begin();
-		Iterator lEnd = End();
-		Iterator rEnd = rhs.End();
+		u64 lhsHash;
+		u64 rhsHash;
+		if( m_pData.GetCached( HashCacheSlot::HashIgnoreAsciiCase, lhsHash ) && rhs.m_pData.GetCached( HashCacheSlot::HashIgnoreAsciiCase, rhsHash ) && lhsHash != rhsHash )
+		{
+			return false;
+		}
 
-		while( lStart != lEnd && rStart != rEnd )
+		return Bytes().EqualsIgnoreAsciiCase( rhs.Bytes() );
+	}
+
+	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
+	s32 UTF8String< ch, Allocator, RefCountPolicy >::CompareIgnoreAsciiCase( const UTF8String& rhs ) const
+	{
+		if( m_pData == rhs.m_pData )
 		{
-			if( *( lStart++ ) != *( rStart++ ) )
-			{
-				return false;
-			}
+			return 0;
 		}
+		return Bytes().CompareIgnoreAsciiCase( rhs.Bytes() );
+	}
 
-		return true;
+	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
+	u64 UTF8String< ch, Allocator, RefCountPolicy >::HashIgnoreAsciiCase( void ) const
+	{
+		u64 hash;
+		if( !m_pData.GetCached( HashCacheSlot::HashIgnoreAsciiCase, hash ) )
+		{
+			hash = HashBytesIgnoreAsciiCase( m_pData.Ptr(), m_uiSize );
+			m_pData.SetCached( HashCacheSlot::HashIgnoreAsciiCase, hash );
+		}
+		return hash;
+	}
+
+	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
+	bool UTF8String< ch, Allocator, RefCountPolicy >::operator<( const UTF8String& rhs ) const
+	{
+		return Compare( rhs ) < 0;
+	}
+
+	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
+	bool UTF8String< ch, Allocator, RefCountPolicy >::operator<=( const UTF8String& rhs ) const
+	{
+		return Compare( rhs ) <= 0;
+	}
+
+	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
+	bool UTF8String< ch, Allocator, RefCountPolicy >::operator>( const UTF8String& rhs ) const
+	{
+		return Compare( rhs ) > 0;
+	}
+
+	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
+	bool UTF8String< ch, Allocator, RefCountPolicy >::operator>=( const UTF8String& rhs ) const
+	{
+		return Compare( rhs ) >= 0;
+	}
+
+	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
+	bool UTF8String< ch, Allocator, RefCountPolicy >::SharesData( const UTF8String& rhs ) const
+	{
+		return m_pData == rhs.m_pData;
+	}
+
+	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
+	u32 UTF8String< ch, Allocator, RefCountPolicy >::ReferenceCount( void ) const
+	{
+		return m_pData.Count();
+	}
+
+	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
+	u64 UTF8String< ch, Allocator, RefCountPolicy >::Hash( void ) const
+	{
+		u64 hash;
+		if( !m_pData.GetCached( HashCacheSlot::Hash, hash ) )
+		{
+			hash = HashBytes( m_pData.Ptr(), m_uiSize );
+			m_pData.SetCached( HashCacheSlot::Hash, hash );
+		}
+		return hash;
 	}
 
-	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */>
-	bool UTF8String<ch, Allocator>::Empty( void ) const
+	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
+	u64 UTF8String< ch, Allocator, RefCountPolicy >::Hash( u64 seed ) const
+	{
+		return HashBytes( m_pData.Ptr(), m_uiSize, seed );
+	}
+
+	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
+	u64 UTF8String< ch, Allocator, RefCountPolicy >::CodePointHash( void ) const
+	{
+		return Hash();
+	}
+
+	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
+	bool UTF8String< ch, Allocator, RefCountPolicy >::Empty( void ) const
 	{
 		return m_pData.Null() || m_pData[ 0 ] == 0U;
 	}
 
-	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */>
-	const ch* UTF8String<ch, Allocator>::c_str() const
+	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
+	bool UTF8String< ch, Allocator, RefCountPolicy >::IsAscii( void ) const
+	{
+		return m_bAscii;
+	}
+
+	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
+	const ch* UTF8String< ch, Allocator, RefCountPolicy >::c_str() const
 	{
 		if( m_pData.Valid() )
 		{
@@ -540,14 +1434,14 @@ namespace uti
 		return nullptr;
 	}
 
-	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */>
-	ch* UTF8String<ch, Allocator>::Data() const
+	template < typename ch /*= char*/, typename Allocator /*= ::uti::DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
+	ch* UTF8String< ch, Allocator, RefCountPolicy >::Data() const
 	{
 		return m_pData.Ptr();
 	}
 
-	template < typename ch /*= char*/, typename Allocator /*= DefaultAllocator */>
-	bool UTF8String<ch, Allocator>::ValidByte( const ch* utfchar )
+	template < typename ch /*= char*/, typename Allocator /*= DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
+	bool UTF8String< ch, Allocator, RefCountPolicy >::ValidByte( const ch* utfchar )
 	{
 		if( utfchar == nullptr )
 		{
@@ -559,13 +1453,27 @@ namespace uti
 		}
 	}
 
-	template < typename ch /*= char*/, typename Allocator /*= DefaultAllocator */>
-	void UTF8String< ch, Allocator >::CopyConstChar( const ch* text )
+	template < typename ch /*= char*/, typename Allocator /*= DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
+	void UTF8String< ch, Allocator, RefCountPolicy >::CopyConstChar( const ch* text )
 	{
+		const u32 threshold = ParallelThreshold.load( std::memory_order_relaxed );
 		u32 size = 0U;
 		u32 validSize = 0U;
+		u32 highBits = 0U;
 		while( text[ size ] != 0U )
 		{
+			// Input reaching the threshold is validated, counted and copied on several threads,
+			// only its remaining length is measured, shorter input is scanned once
+			if( size == threshold && threshold != 0xFFFFFFFFU )
+			{
+				const size_t length = threshold + std::strlen( reinterpret_cast< const char* >( text + threshold ) );
+				if( length < 0xFFFFFFFFU && CopyConstCharParallel( text, static_cast< u32 >( length ) ) )
+				{
+					return;
+				}
+				// Invalid input continues below, where the invalid chars are replaced
+			}
+			highBits |= static_cast< u32 >( static_cast< unsigned char >( text[ size ] ) );
 			if( ValidByte( text + size++ ) )
 			{
 				++validSize;
@@ -577,6 +1485,17 @@ namespace uti
 		}
 		m_pData = DataType( static_cast< ch* >( m_Alloc.AllocateBytes( ( size + sizeof( ch ) ) * sizeof( ch ) ) ) );
 
+		// Without any byte having the high bit set, every byte is a valid single byte char
+		m_bAscii = ( highBits & 0x80U ) == 0U;
+		if( m_bAscii )
+		{
+			std::memcpy( m_pData.Ptr(), text, size * sizeof( ch ) );
+			m_uiSize = size;
+			m_uiCharCount = size;
+			m_pData[ m_uiSize ] = 0U;
+			return;
+		}
+
 		u32 bytesToNextChar = ValidChar( text );
 		u32 arrayPos = 0U;
 		m_uiCharCount = bytesToNextChar > 0U ? 1U : 0U;
@@ -650,5 +1569,21 @@ namespace uti
 		m_pData[ m_uiSize ] = 0U;
 
 	}
+
+	template < typename ch /*= char*/, typename Allocator /*= DefaultAllocator */, typename RefCountPolicy /*= ::uti::DefaultRefCountPolicy */>
+	bool UTF8String< ch, Allocator, RefCountPolicy >::CopyConstCharParallel( const ch* text, u32 size )
+	{
+		m_pData = DataType( static_cast< ch* >( m_Alloc.AllocateBytes( ( size + sizeof( ch ) ) * sizeof( ch ) ) ) );
+		u32 charCount = 0U;
+		if( ValidateChunks( text, size, charCount, ParallelThreadCount.load( std::memory_order_relaxed ), m_pData.Ptr() ) != size )
+		{
+			return false;
+		}
+		m_pData[ size ] = 0U;
+		m_uiSize = size;
+		m_uiCharCount = charCount;
+		m_bAscii = charCount == size;
+		return true;
+	}
 }
 #endif // utiUTF8String_inl__
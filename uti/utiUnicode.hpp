@@ -0,0 +1,242 @@
+#pragma once
+#ifndef utiUnicode_h__
+#define utiUnicode_h__
+
+namespace uti
+{
+	/**
+	\brief Lookups into the generated Unicode Character Database tables ( see tools/GenerateUnicodeTables.py ).
+
+	Every property is stored in a compact two-stage table: the high bits of the code point select a block,
+	identical blocks are stored once, so the tables of all properties stay small enough for the L1/L2 cache.
+	*/
+	namespace unicode
+	{
+		/**
+		\brief The case mappings defined by the Unicode standard.
+		*/
+		enum class CaseMapping
+		{
+			Upper = 0,
+			Lower = 1,
+			Fold = 2
+		};
+
+		/**
+		\brief The maximum number of code points a single code point is mapped to by MapCase().
+		*/
+		static const u32 MaxCaseMappingLength = 3U;
+
+		/**
+		\brief Maps \c codePoint with the full ( unconditional ) case mapping, which may map it to several code points ( e.g. U+00DF to "SS" ).
+
+		Mappings which depend on the context or the language ( e.g. the final sigma ) are not applied.
+
+		\param mapped Receives the mapped code points, has to hold MaxCaseMappingLength code points.
+
+		\return The number of code points written to \c mapped.
+		*/
+		inline u32 MapCase( u32 codePoint, CaseMapping mapping, u32* mapped );
+
+		/**
+		\brief Returns if MapCase() maps \c codePoint to anything else than itself.
+		*/
+		inline bool IsCaseMapped( u32 codePoint, CaseMapping mapping );
+
+		/**
+		\brief The normalization forms defined by UAX #15.
+		*/
+		enum class NormalizationForm
+		{
+			NFC = 0,
+			NFD = 1,
+			NFKC = 2,
+			NFKD = 3
+		};
+
+		/**
+		\brief Result of the normalization quick check of a single code point.
+		*/
+		enum class QuickCheckResult
+		{
+			Yes = 0,
+			Maybe = 1,
+			No = 2
+		};
+
+		/**
+		\brief The maximum number of code points a single code point is decomposed to by Decompose().
+		*/
+		static const u32 MaxDecompositionLength = 18U;
+
+		/**
+		\brief The maximum number of code points Decompose() produces per utf-8 byte of the decomposed code point.
+		*/
+		static const u32 MaxDecompositionPerUtf8Byte = 6U;
+
+		/**
+		\brief Returns the canonical combining class of \c codePoint, 0 for starters.
+		*/
+		inline u32 CanonicalCombiningClass( u32 codePoint );
+
+		/**
+		\brief Returns the quick check property of \c codePoint for \c form.
+
+		\c Maybe is only returned for the composed forms, by code points which may combine with a preceding code point.
+		*/
+		inline QuickCheckResult QuickCheck( u32 codePoint, NormalizationForm form );
+
+		/**
+		\brief Returns if the text can be split in front of \c codePoint without changing the result of the normalization to \c form,
+		which is the case for starters whose quick check is \c Yes.
+		*/
+		inline bool IsNormalizationBoundary( u32 codePoint, NormalizationForm form );
+
+		/**
+		\brief Writes the full canonical ( or compatibility ) decomposition of \c codePoint to \c decomposed,
+		code points without a decomposition are written unchanged. The result is not reordered.
+
+		\param decomposed Receives the code points, has to hold MaxDecompositionLength code points.
+
+		\return The number of code points written to \c decomposed.
+		*/
+		inline u32 Decompose( u32 codePoint, bool compatibility, u32* decomposed );
+
+		/**
+		\brief Returns the primary composite of \c first and \c second, or 0 if they do not compose.
+		*/
+		inline u32 Compose( u32 first, u32 second );
+
+		/**
+		\brief Normalizes the \c count decomposed code points starting at \c codePoints in place:
+		the code points are put into canonical order and composed again for the composed forms.
+
+		\return The number of code points after the composition.
+		*/
+		inline u32 NormalizeDecomposed( u32* codePoints, u32 count, NormalizationForm form );
+
+		/**
+		\brief The Grapheme_Cluster_Break property values of UAX #29.
+		*/
+		enum class GraphemeBreak
+		{
+			Other = 0,
+			CR,
+			LF,
+			Control,
+			Extend,
+			ZWJ,
+			RegionalIndicator,
+			Prepend,
+			SpacingMark,
+			L,
+			V,
+			T,
+			LV,
+			LVT,
+			Count
+		};
+
+		/**
+		\brief Returns the Grapheme_Cluster_Break property of \c codePoint.
+		*/
+		inline GraphemeBreak GetGraphemeBreak( u32 codePoint );
+
+		/**
+		\brief Returns if \c codePoint has the Extended_Pictographic property.
+		*/
+		inline bool IsExtendedPictographic( u32 codePoint );
+
+		/**
+		\brief State of the grapheme cluster boundary detection, which sees the code points one after another.
+
+		Start it with BeginGraphemeCluster() on the first code point of a cluster and pass every following code point
+		to IsGraphemeBreak() until it reports a boundary.
+		*/
+		struct GraphemeBreakState
+		{
+			// The properties of the previous code point
+			u32 Previous;
+			// 1 behind an Extended_Pictographic code point followed by Extend code points, 2 if a ZWJ followed
+			u32 Emoji;
+			// The number of Regional_Indicator code points in front of the next code point
+			u32 RegionalCount;
+		};
+
+		/**
+		\brief Resets \c state to the start of a grapheme cluster beginning with \c codePoint.
+		*/
+		inline void BeginGraphemeCluster( GraphemeBreakState& state, u32 codePoint );
+
+		/**
+		\brief Returns if there is a grapheme cluster boundary in front of \c codePoint, following the code points seen by \c state,
+		and adds \c codePoint to \c state.
+
+		The rules of UAX #29 are looked up in a table indexed by the properties of both code points,
+		only the emoji ZWJ sequences ( GB11 ) and the Regional_Indicator pairs ( GB12, GB13 ) need the state.
+		*/
+		inline bool IsGraphemeBreak( GraphemeBreakState& state, u32 codePoint );
+
+		/**
+		\brief The Word_Break property values of UAX #29.
+		*/
+		enum class WordBreak
+		{
+			Other = 0,
+			CR,
+			LF,
+			Newline,
+			Extend,
+			ZWJ,
+			RegionalIndicator,
+			Format,
+			Katakana,
+			HebrewLetter,
+			ALetter,
+			SingleQuote,
+			DoubleQuote,
+			MidNumLet,
+			MidLetter,
+			MidNum,
+			Numeric,
+			ExtendNumLet,
+			WSegSpace,
+			Count
+		};
+
+		/**
+		\brief Returns the Word_Break property of \c codePoint.
+		*/
+		inline WordBreak GetWordBreak( u32 codePoint );
+
+		/**
+		\brief The Sentence_Break property values of UAX #29.
+		*/
+		enum class SentenceBreak
+		{
+			Other = 0,
+			CR,
+			LF,
+			Extend,
+			Sep,
+			Format,
+			Sp,
+			Lower,
+			Upper,
+			OLetter,
+			Numeric,
+			ATerm,
+			SContinue,
+			STerm,
+			Close,
+			Count
+		};
+
+		/**
+		\brief Returns the Sentence_Break property of \c codePoint.
+		*/
+		inline SentenceBreak GetSentenceBreak( u32 codePoint );
+	}
+}
+
+#endif // utiUnicode_h__
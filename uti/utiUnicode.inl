@@ -0,0 +1,481 @@
+#pragma once
+#ifndef utiUnicode_inl__
+#define utiUnicode_inl__
+
+namespace uti
+{
+	namespace unicode
+	{
+		namespace detail
+		{
+			/**
+			\brief Returns the entry of \c mapping for \c codePoint, code points outside of the table are not mapped.
+			*/
+			inline u32 CaseEntry( u32 codePoint, CaseMapping mapping )
+			{
+				typedef CaseTables< void > Tables;
+				if( codePoint >= Tables::CaseLimit )
+				{
+					return CaseDeltaBias;
+				}
+				u32 block = Tables::CaseStage1[ codePoint >> Tables::CaseShift ];
+				u32 record = Tables::CaseStage2[ ( block << Tables::CaseShift ) | ( codePoint & ( ( 1U << Tables::CaseShift ) - 1U ) ) ];
+				return Tables::Records[ record * 3U + static_cast< u32 >( mapping ) ];
+			}
+
+			static_assert( GeneratedDecompositionLength <= MaxDecompositionLength, "The generated tables hold longer decompositions" );
+			static_assert( GeneratedDecompositionPerUtf8Byte <= MaxDecompositionPerUtf8Byte, "The generated tables hold longer decompositions" );
+
+			static const u32 HangulSBase = 0xAC00U;
+			static const u32 HangulLBase = 0x1100U;
+			static const u32 HangulVBase = 0x1161U;
+			static const u32 HangulTBase = 0x11A7U;
+			static const u32 HangulLCount = 19U;
+			static const u32 HangulVCount = 21U;
+			static const u32 HangulTCount = 28U;
+			static const u32 HangulNCount = HangulVCount * HangulTCount;
+			static const u32 HangulSCount = HangulLCount * HangulNCount;
+
+			// Quick check flags of the normalization forms, indexed by NormalizationForm
+			static const u32 QuickCheckNoFlags[ 4 ] = { NormalizationNfcNo, NormalizationNfdNo, NormalizationNfkcNo, NormalizationNfkdNo };
+			static const u32 QuickCheckMaybeFlags[ 4 ] = { NormalizationNfcMaybe, 0U, NormalizationNfkcMaybe, 0U };
+
+			/**
+			\brief Returns the property entry of \c codePoint, the canonical combining class in the low byte and the normalization flags above.
+			*/
+			inline u32 NormalizationProperty( u32 codePoint )
+			{
+				typedef NormalizationTables< void > Tables;
+				if( codePoint >= Tables::PropertyLimit )
+				{
+					return 0U;
+				}
+				u32 block = Tables::PropertyStage1[ codePoint >> Tables::PropertyShift ];
+				u32 record = Tables::PropertyStage2[ ( block << Tables::PropertyShift ) | ( codePoint & ( ( 1U << Tables::PropertyShift ) - 1U ) ) ];
+				return Tables::Properties[ record ];
+			}
+
+			/**
+			\brief Returns the offset of the decomposition header of \c codePoint in NormalizationTables::Decompositions, 0 if there is none.
+			*/
+			inline u32 DecompositionOffset( u32 codePoint )
+			{
+				typedef NormalizationTables< void > Tables;
+				if( codePoint >= Tables::DecompositionLimit )
+				{
+					return 0U;
+				}
+				u32 block = Tables::DecompositionStage1[ codePoint >> Tables::DecompositionShift ];
+				return Tables::DecompositionStage2[ ( block << Tables::DecompositionShift ) | ( codePoint & ( ( 1U << Tables::DecompositionShift ) - 1U ) ) ];
+			}
+
+			/**
+			\brief Returns the index of the composition pairs starting with \c codePoint in NormalizationTables::CompositionStarts, 0 if there are none.
+			*/
+			inline u32 CompositionIndex( u32 codePoint )
+			{
+				typedef NormalizationTables< void > Tables;
+				if( codePoint >= Tables::CompositionLimit )
+				{
+					return 0U;
+				}
+				u32 block = Tables::CompositionStage1[ codePoint >> Tables::CompositionShift ];
+				return Tables::CompositionStage2[ ( block << Tables::CompositionShift ) | ( codePoint & ( ( 1U << Tables::CompositionShift ) - 1U ) ) ];
+			}
+
+			/**
+			\brief Puts the \c count code points starting at \c codePoints into canonical order:
+			every run of non-starters is stably sorted by the canonical combining class.
+			*/
+			inline void CanonicalOrder( u32* codePoints, u32 count )
+			{
+				for( u32 i = 1U; i < count; ++i )
+				{
+					u32 codePoint = codePoints[ i ];
+					u32 combiningClass = CanonicalCombiningClass( codePoint );
+					if( combiningClass == 0U )
+					{
+						continue;
+					}
+					// Runs of combining marks are short, an insertion sort is all it takes
+					u32 j = i;
+					while( j > 0U && CanonicalCombiningClass( codePoints[ j - 1U ] ) > combiningClass )
+					{
+						codePoints[ j ] = codePoints[ j - 1U ];
+						--j;
+					}
+					codePoints[ j ] = codePoint;
+				}
+			}
+
+			/**
+			\brief Applies the canonical composition algorithm to the \c count code points in canonical order starting at \c codePoints.
+
+			\return The number of code points after the composition.
+			*/
+			inline u32 ComposeCanonical( u32* codePoints, u32 count )
+			{
+				if( count == 0U )
+				{
+					return 0U;
+				}
+
+				u32 starter = 0U;
+				u32 lastClass = CanonicalCombiningClass( codePoints[ 0 ] );
+				// A leading non-starter has no starter to compose with
+				bool hasStarter = lastClass == 0U;
+				if( !hasStarter )
+				{
+					lastClass = 256U;
+				}
+				u32 written = 1U;
+				for( u32 i = 1U; i < count; ++i )
+				{
+					u32 codePoint = codePoints[ i ];
+					u32 property = NormalizationProperty( codePoint );
+					u32 combiningClass = property & 0xFFU;
+					// Only code points which may combine with a preceding one ( quick check Maybe ) are looked up
+					u32 composite = 0U;
+					if( hasStarter && ( property & NormalizationNfcMaybe ) != 0U && ( lastClass < combiningClass || lastClass == 0U ) )
+					{
+						composite = Compose( codePoints[ starter ], codePoint );
+					}
+					if( composite != 0U )
+					{
+						codePoints[ starter ] = composite;
+						continue;
+					}
+					if( combiningClass == 0U )
+					{
+						starter = written;
+						hasStarter = true;
+					}
+					lastClass = combiningClass;
+					codePoints[ written++ ] = codePoint;
+				}
+				return written;
+			}
+
+			static_assert( GeneratedGraphemeBreakCount == static_cast< u32 >( GraphemeBreak::Count ), "The generated tables do not match GraphemeBreak" );
+
+			// Actions of SegmentationTables::GraphemeRules
+			static const u32 GraphemeRuleBreak = 0U;
+			static const u32 GraphemeRuleKeep = 1U;
+			static const u32 GraphemeRuleKeepIfEmojiZwj = 2U;
+			static const u32 GraphemeRuleKeepIfOddRegional = 3U;
+
+			/**
+			\brief Returns the index of the segmentation properties of \c codePoint in the property arrays of SegmentationTables.
+			*/
+			inline u32 SegmentationRecord( u32 codePoint )
+			{
+				typedef SegmentationTables< void > Tables;
+				if( codePoint >= Tables::SegmentationLimit )
+				{
+					return 0U;
+				}
+				u32 block = Tables::SegmentationStage1[ codePoint >> Tables::SegmentationShift ];
+				return Tables::SegmentationStage2[ ( block << Tables::SegmentationShift ) | ( codePoint & ( ( 1U << Tables::SegmentationShift ) - 1U ) ) ];
+			}
+
+			/**
+			\brief Returns the grapheme property of \c codePoint, the GraphemeBreak value combined with the ExtendedPictographicFlag.
+			*/
+			inline u32 GraphemeProperty( u32 codePoint )
+			{
+				return SegmentationTables< void >::GraphemeProperties[ SegmentationRecord( codePoint ) ];
+			}
+
+			/**
+			\brief Updates the ZWJ sequence and Regional_Indicator state of \c state for a code point with the grapheme \c property.
+			*/
+			inline void AdvanceGraphemeState( GraphemeBreakState& state, u32 property )
+			{
+				u32 value = property & ~ExtendedPictographicFlag;
+				if( ( property & ExtendedPictographicFlag ) != 0U )
+				{
+					state.Emoji = 1U;
+				}
+				else if( state.Emoji == 1U && value == static_cast< u32 >( GraphemeBreak::ZWJ ) )
+				{
+					state.Emoji = 2U;
+				}
+				else if( state.Emoji != 1U || value != static_cast< u32 >( GraphemeBreak::Extend ) )
+				{
+					state.Emoji = 0U;
+				}
+				state.RegionalCount = value == static_cast< u32 >( GraphemeBreak::RegionalIndicator ) ? state.RegionalCount + 1U : 0U;
+				state.Previous = value;
+			}
+
+			static_assert( GeneratedWordBreakCount == static_cast< u32 >( WordBreak::Count ), "The generated tables do not match WordBreak" );
+			static_assert( GeneratedSentenceBreakCount == static_cast< u32 >( SentenceBreak::Count ), "The generated tables do not match SentenceBreak" );
+
+			// Actions of SegmentationTables::WordRules, the properties of the previous and the next code point skip the
+			// Extend, Format and ZWJ code points ( WB4 ). The conditional actions test the property behind the next code point
+			// or in front of the previous one.
+			static const u32 WordRuleBreak = 0U;
+			static const u32 WordRuleKeep = 1U;
+			static const u32 WordRuleKeepIgnored = 2U;
+			static const u32 WordRuleKeepIfNextLetter = 3U;
+			static const u32 WordRuleKeepIfNextHebrew = 4U;
+			static const u32 WordRuleKeepIfNextNumeric = 5U;
+			static const u32 WordRuleKeepIfPreviousLetter = 6U;
+			static const u32 WordRuleKeepIfPreviousHebrew = 7U;
+			static const u32 WordRuleKeepIfPreviousNumeric = 8U;
+			static const u32 WordRuleKeepIfOddRegional = 9U;
+
+			// States of the sentence break state machine, SentenceTransitions holds the next state in the low SentenceStateBits
+			// and the action above them
+			static const u32 SentenceStateText = 0U;
+			static const u32 SentenceStateLetter = 1U;
+			static const u32 SentenceStateCount = GeneratedSentenceStateCount;
+			static const u32 SentenceRuleBreak = 0U;
+			static const u32 SentenceRuleKeep = 1U;
+			static const u32 SentenceRuleKeepIgnored = 2U;
+			static const u32 SentenceRuleKeepIfLowerElseBreak = 3U;
+			static const u32 SentenceRuleKeepIfLowerElseKeep = 4U;
+
+			/**
+			\brief Returns the Word_Break value of the segmentation \c record.
+			*/
+			inline u32 WordProperty( u32 record )
+			{
+				return SegmentationTables< void >::WordProperties[ record ];
+			}
+
+			/**
+			\brief Returns the Sentence_Break value of the segmentation \c record.
+			*/
+			inline u32 SentenceProperty( u32 record )
+			{
+				return SegmentationTables< void >::SentenceProperties[ record ];
+			}
+
+			/**
+			\brief Returns if the segmentation \c record belongs to a code point which makes a word segment a word:
+			a letter, digit or connector punctuation of the word rules, or any other letter ( e.g. ideographs, kana or Thai ).
+			*/
+			inline bool IsWordRecord( u32 record )
+			{
+				u32 word = WordProperty( record );
+				return ( word >= static_cast< u32 >( WordBreak::Katakana ) && word <= static_cast< u32 >( WordBreak::ALetter ) ) ||
+					word == static_cast< u32 >( WordBreak::Numeric ) || word == static_cast< u32 >( WordBreak::ExtendNumLet ) ||
+					SentenceProperty( record ) == static_cast< u32 >( SentenceBreak::OLetter );
+			}
+
+			/**
+			\brief Returns if the Word_Break value \c word is ignored by WB4 ( Extend, Format or ZWJ ).
+			*/
+			inline bool IsIgnoredWordProperty( u32 word )
+			{
+				return word == static_cast< u32 >( WordBreak::Extend ) || word == static_cast< u32 >( WordBreak::Format ) ||
+					word == static_cast< u32 >( WordBreak::ZWJ );
+			}
+
+			/**
+			\brief Returns if the Word_Break value \c word is ALetter or Hebrew_Letter ( AHLetter of UAX #29 ).
+			*/
+			inline bool IsLetterWordProperty( u32 word )
+			{
+				return word == static_cast< u32 >( WordBreak::ALetter ) || word == static_cast< u32 >( WordBreak::HebrewLetter );
+			}
+
+			/**
+			\brief Returns the action of the word break rules between the Word_Break values \c previous and \c next.
+			*/
+			inline u32 WordRule( u32 previous, u32 next )
+			{
+				return SegmentationTables< void >::WordRules[ previous * static_cast< u32 >( WordBreak::Count ) + next ];
+			}
+
+			/**
+			\brief Returns the transition of the sentence break state machine from \c state for a code point with the Sentence_Break value \c next.
+			*/
+			inline u32 SentenceTransition( u32 state, u32 next )
+			{
+				return SegmentationTables< void >::SentenceTransitions[ state * static_cast< u32 >( SentenceBreak::Count ) + next ];
+			}
+		}
+
+		u32 MapCase( u32 codePoint, CaseMapping mapping, u32* mapped )
+		{
+			u32 entry = detail::CaseEntry( codePoint, mapping );
+			if( ( entry & CaseExpansionFlag ) == 0U )
+			{
+				mapped[ 0 ] = codePoint + entry - CaseDeltaBias;
+				return 1U;
+			}
+
+			u32 length = ( entry >> 16U ) & 0xFFU;
+			const u32* expansion = detail::CaseTables< void >::Expansions + ( entry & 0xFFFFU );
+			UTI_ASSERT( length <= MaxCaseMappingLength );
+			for( u32 i = 0U; i < length; ++i )
+			{
+				mapped[ i ] = expansion[ i ];
+			}
+			return length;
+		}
+
+		bool IsCaseMapped( u32 codePoint, CaseMapping mapping )
+		{
+			return detail::CaseEntry( codePoint, mapping ) != CaseDeltaBias;
+		}
+
+		u32 CanonicalCombiningClass( u32 codePoint )
+		{
+			return detail::NormalizationProperty( codePoint ) & 0xFFU;
+		}
+
+		QuickCheckResult QuickCheck( u32 codePoint, NormalizationForm form )
+		{
+			u32 property = detail::NormalizationProperty( codePoint );
+			if( ( property & detail::QuickCheckNoFlags[ static_cast< u32 >( form ) ] ) != 0U )
+			{
+				return QuickCheckResult::No;
+			}
+			if( ( property & detail::QuickCheckMaybeFlags[ static_cast< u32 >( form ) ] ) != 0U )
+			{
+				return QuickCheckResult::Maybe;
+			}
+			return QuickCheckResult::Yes;
+		}
+
+		bool IsNormalizationBoundary( u32 codePoint, NormalizationForm form )
+		{
+			u32 unsafe = 0xFFU | detail::QuickCheckNoFlags[ static_cast< u32 >( form ) ] | detail::QuickCheckMaybeFlags[ static_cast< u32 >( form ) ];
+			return ( detail::NormalizationProperty( codePoint ) & unsafe ) == 0U;
+		}
+
+		u32 Decompose( u32 codePoint, bool compatibility, u32* decomposed )
+		{
+			u32 syllable = codePoint - detail::HangulSBase;
+			if( syllable < detail::HangulSCount )
+			{
+				decomposed[ 0 ] = detail::HangulLBase + syllable / detail::HangulNCount;
+				decomposed[ 1 ] = detail::HangulVBase + ( syllable % detail::HangulNCount ) / detail::HangulTCount;
+				if( syllable % detail::HangulTCount == 0U )
+				{
+					return 2U;
+				}
+				decomposed[ 2 ] = detail::HangulTBase + syllable % detail::HangulTCount;
+				return 3U;
+			}
+
+			u32 offset = detail::DecompositionOffset( codePoint );
+			const unsigned short* data = detail::NormalizationTables< void >::Decompositions;
+			u32 header = offset != 0U ? data[ offset ] : 0U;
+			u32 canonicalLength = header & 0x1FU;
+			u32 length = compatibility ? ( header >> 5U ) & 0x3FU : canonicalLength;
+			if( length == 0U )
+			{
+				decomposed[ 0 ] = codePoint;
+				return 1U;
+			}
+
+			// The decompositions are stored as utf-16, the compatibility one behind the canonical one if they differ
+			const unsigned short* units = data + offset + 1U;
+			if( compatibility && ( header & 0x800U ) != 0U )
+			{
+				units += canonicalLength;
+			}
+			u32 count = 0U;
+			for( u32 i = 0U; i < length; ++i )
+			{
+				u32 unit = units[ i ];
+				if( unit - 0xD800U < 0x400U )
+				{
+					unit = 0x10000U + ( ( unit - 0xD800U ) << 10U ) + ( units[ ++i ] - 0xDC00U );
+				}
+				decomposed[ count++ ] = unit;
+			}
+			return count;
+		}
+
+		u32 Compose( u32 first, u32 second )
+		{
+			// Hangul LV and LVT syllables
+			if( first - detail::HangulLBase < detail::HangulLCount && second - detail::HangulVBase < detail::HangulVCount )
+			{
+				return detail::HangulSBase + ( ( first - detail::HangulLBase ) * detail::HangulVCount + second - detail::HangulVBase ) * detail::HangulTCount;
+			}
+			u32 syllable = first - detail::HangulSBase;
+			if( syllable < detail::HangulSCount && syllable % detail::HangulTCount == 0U && second - detail::HangulTBase - 1U < detail::HangulTCount - 1U )
+			{
+				return first + second - detail::HangulTBase;
+			}
+
+			typedef detail::NormalizationTables< void > Tables;
+			u32 index = detail::CompositionIndex( first );
+			if( index == 0U )
+			{
+				return 0U;
+			}
+			for( u32 pair = Tables::CompositionStarts[ index - 1U ]; pair < Tables::CompositionStarts[ index ]; ++pair )
+			{
+				if( Tables::CompositionPairs[ pair * 2U ] == second )
+				{
+					return Tables::CompositionPairs[ pair * 2U + 1U ];
+				}
+			}
+			return 0U;
+		}
+
+		GraphemeBreak GetGraphemeBreak( u32 codePoint )
+		{
+			return static_cast< GraphemeBreak >( detail::GraphemeProperty( codePoint ) & ~ExtendedPictographicFlag );
+		}
+
+		bool IsExtendedPictographic( u32 codePoint )
+		{
+			return ( detail::GraphemeProperty( codePoint ) & ExtendedPictographicFlag ) != 0U;
+		}
+
+		void BeginGraphemeCluster( GraphemeBreakState& state, u32 codePoint )
+		{
+			state.Emoji = 0U;
+			state.RegionalCount = 0U;
+			detail::AdvanceGraphemeState( state, detail::GraphemeProperty( codePoint ) );
+		}
+
+		bool IsGraphemeBreak( GraphemeBreakState& state, u32 codePoint )
+		{
+			u32 property = detail::GraphemeProperty( codePoint );
+			u32 next = property & ~ExtendedPictographicFlag;
+			u32 rule = detail::SegmentationTables< void >::GraphemeRules[ state.Previous * static_cast< u32 >( GraphemeBreak::Count ) + next ];
+			bool isBreak = rule == detail::GraphemeRuleBreak;
+			if( rule == detail::GraphemeRuleKeepIfEmojiZwj )
+			{
+				isBreak = state.Emoji != 2U || ( property & ExtendedPictographicFlag ) == 0U;
+			}
+			else if( rule == detail::GraphemeRuleKeepIfOddRegional )
+			{
+				isBreak = ( state.RegionalCount & 1U ) == 0U;
+			}
+			detail::AdvanceGraphemeState( state, property );
+			return isBreak;
+		}
+
+		WordBreak GetWordBreak( u32 codePoint )
+		{
+			return static_cast< WordBreak >( detail::WordProperty( detail::SegmentationRecord( codePoint ) ) );
+		}
+
+		SentenceBreak GetSentenceBreak( u32 codePoint )
+		{
+			return static_cast< SentenceBreak >( detail::SentenceProperty( detail::SegmentationRecord( codePoint ) ) );
+		}
+
+		u32 NormalizeDecomposed( u32* codePoints, u32 count, NormalizationForm form )
+		{
+			detail::CanonicalOrder( codePoints, count );
+			if( form == NormalizationForm::NFC || form == NormalizationForm::NFKC )
+			{
+				count = detail::ComposeCanonical( codePoints, count );
+			}
+			return count;
+		}
+	}
+}
+
+#endif // utiUnicode_inl__
@@ -0,0 +1,7711 @@
+// Generated by tools/GenerateUnicodeTables.py from the Unicode Character Database 14.0.0, do not edit.
+#pragma once
+#ifndef utiUnicodeTables_inl__
+#define utiUnicodeTables_inl__
+
+namespace uti
+{
+	namespace unicode
+	{
+		static const u32 CaseDeltaBias = 0x200000U;
+		static const u32 CaseExpansionFlag = 0x80000000U;
+		static const u32 NormalizationNfdNo = 0x100U;
+		static const u32 NormalizationNfkdNo = 0x200U;
+		static const u32 NormalizationNfcNo = 0x400U;
+		static const u32 NormalizationNfcMaybe = 0x800U;
+		static const u32 NormalizationNfkcNo = 0x1000U;
+		static const u32 NormalizationNfkcMaybe = 0x2000U;
+		static const u32 GeneratedDecompositionLength = 18U;
+		static const u32 GeneratedDecompositionPerUtf8Byte = 6U;
+		static const u32 GeneratedGraphemeBreakCount = 14U;
+		static const u32 ExtendedPictographicFlag = 0x80U;
+		static const u32 GeneratedWordBreakCount = 19U;
+		static const u32 GeneratedSentenceBreakCount = 15U;
+		static const u32 GeneratedSentenceStateCount = 10U;
+		static const u32 SentenceStateBits = 4U;
+
+		namespace detail
+		{
+			/**
+			\brief Upper, lower and fold mapping of every code point, the stages map a code point to a record of three mapping entries.
+			*/
+			template< typename Dummy >
+			struct CaseTables
+			{
+				static const u32 CaseShift = 5U;
+				static const u32 CaseLimit = 0x1E960U;
+				static const unsigned char CaseStage1[ 3915 ];
+				static const unsigned short CaseStage2[ 3040 ];
+				static const u32 Records[ 837 ];
+				static const u32 Expansions[ 318 ];
+			};
+
+			template< typename Dummy >
+			const unsigned char CaseTables< Dummy >::CaseStage1[ 3915 ] =
+			{
+				0x0, 0x0, 0x1, 0x2, 0x0, 0x3, 0x4, 0x5, 0x6, 0x7, 0x8, 0x9, 0xA, 0xB, 0xC, 0xD,
+				0x6, 0xE, 0xF, 0x10, 0x11, 0x0, 0x0, 0x0, 0x0, 0x0, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+				0x18, 0x19, 0x1A, 0x6, 0x1B, 0x6, 0x1C, 0x6, 0x6, 0x1D, 0x1E, 0x1F, 0x20, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x21, 0x22, 0x23, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x24, 0x25,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x26, 0x27, 0x0, 0x0, 0x0, 0x0, 0x0, 0x28, 0x29, 0x0, 0x0, 0x0,
+				0x6, 0x6, 0x6, 0x6, 0x2A, 0x6, 0x6, 0x6, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F, 0x30, 0x31, 0x32,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x33, 0x34, 0x35, 0x36, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x37, 0x38, 0x39, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x3A, 0x3B, 0x3C, 0x3D, 0x6, 0x6, 0x6, 0x3E, 0x3F, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x6, 0x41, 0x42, 0x0, 0x0, 0x0, 0x0, 0x43, 0x6, 0x44, 0x45, 0x46, 0x47, 0x48,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x4A, 0x4B, 0x4B, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4C, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x2, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x4D, 0x4E, 0x4F, 0x0, 0x0, 0x50, 0x51, 0x52, 0x0, 0x0, 0x0, 0x53, 0x54, 0x55, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x56, 0x57, 0x58, 0x59, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x5A, 0x5B, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x5A, 0x5B, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5C, 0x5D, 0x5E,
+			};
+
+			template< typename Dummy >
+			const unsigned short CaseTables< Dummy >::CaseStage2[ 3040 ] =
+			{
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+				0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2,
+				0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+				0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x0, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x4,
+				0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2,
+				0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x0, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x5,
+				0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7,
+				0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7,
+				0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7,
+				0x8, 0x9, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x0, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6,
+				0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0xA, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7,
+				0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7,
+				0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7,
+				0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0xB, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0xC,
+				0xD, 0xE, 0x6, 0x7, 0x6, 0x7, 0xF, 0x6, 0x7, 0x10, 0x10, 0x6, 0x7, 0x0, 0x11, 0x12,
+				0x13, 0x6, 0x7, 0x10, 0x14, 0x15, 0x16, 0x17, 0x6, 0x7, 0x18, 0x0, 0x16, 0x19, 0x1A, 0x1B,
+				0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x1C, 0x6, 0x7, 0x1C, 0x0, 0x0, 0x6, 0x7, 0x1C, 0x6,
+				0x7, 0x1D, 0x1D, 0x6, 0x7, 0x6, 0x7, 0x1E, 0x6, 0x7, 0x0, 0x0, 0x6, 0x7, 0x0, 0x1F,
+				0x0, 0x0, 0x0, 0x0, 0x20, 0x21, 0x22, 0x20, 0x21, 0x22, 0x20, 0x21, 0x22, 0x6, 0x7, 0x6,
+				0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x23, 0x6, 0x7,
+				0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7,
+				0x24, 0x20, 0x21, 0x22, 0x6, 0x7, 0x25, 0x26, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7,
+				0x27, 0x0, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7,
+				0x6, 0x7, 0x6, 0x7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x28, 0x6, 0x7, 0x29, 0x2A, 0x2B,
+				0x2B, 0x6, 0x7, 0x2C, 0x2D, 0x2E, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7,
+				0x2F, 0x30, 0x31, 0x32, 0x33, 0x0, 0x34, 0x34, 0x0, 0x35, 0x0, 0x36, 0x37, 0x0, 0x0, 0x0,
+				0x34, 0x38, 0x0, 0x39, 0x0, 0x3A, 0x3B, 0x0, 0x3C, 0x3D, 0x3B, 0x3E, 0x3F, 0x0, 0x0, 0x3D,
+				0x0, 0x40, 0x41, 0x0, 0x0, 0x42, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x43, 0x0, 0x0,
+				0x44, 0x0, 0x45, 0x44, 0x0, 0x0, 0x0, 0x46, 0x44, 0x47, 0x48, 0x48, 0x49, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x4A, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4B, 0x4C, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x4D, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x6, 0x7, 0x6, 0x7, 0x0, 0x0, 0x6, 0x7, 0x0, 0x0, 0x0, 0x1A, 0x1A, 0x1A, 0x0, 0x4E,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4F, 0x0, 0x50, 0x50, 0x50, 0x0, 0x51, 0x0, 0x52, 0x52,
+				0x53, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+				0x1, 0x1, 0x0, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x54, 0x55, 0x55, 0x55,
+				0x56, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2,
+				0x2, 0x2, 0x57, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x58, 0x59, 0x59, 0x5A,
+				0x5B, 0x5C, 0x0, 0x0, 0x0, 0x5D, 0x5E, 0x5F, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7,
+				0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7,
+				0x60, 0x61, 0x62, 0x63, 0x64, 0x65, 0x0, 0x6, 0x7, 0x66, 0x6, 0x7, 0x0, 0x27, 0x27, 0x27,
+				0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+				0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+				0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+				0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2,
+				0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2,
+				0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
+				0x6, 0x7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7,
+				0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7,
+				0x69, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6A,
+				0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7,
+				0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7,
+				0x0, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B,
+				0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B,
+				0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C,
+				0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C,
+				0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6D, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E,
+				0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E,
+				0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x0, 0x6E, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6E, 0x0, 0x0,
+				0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F,
+				0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F,
+				0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x0, 0x0, 0x6F, 0x6F, 0x6F,
+				0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
+				0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
+				0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
+				0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x0, 0x0, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x0, 0x0,
+				0x73, 0x74, 0x75, 0x76, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B,
+				0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B,
+				0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x0, 0x0, 0x7B, 0x7B, 0x7B,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7C, 0x0, 0x0, 0x0, 0x7D, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7E, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7,
+				0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x7F, 0x80, 0x81, 0x82, 0x83, 0x84, 0x0, 0x0, 0x85, 0x0,
+				0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87,
+				0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x0, 0x0, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x0, 0x0,
+				0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87,
+				0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87,
+				0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x0, 0x0, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x0, 0x0,
+				0x88, 0x86, 0x89, 0x86, 0x8A, 0x86, 0x8B, 0x86, 0x0, 0x87, 0x0, 0x87, 0x0, 0x87, 0x0, 0x87,
+				0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87,
+				0x8C, 0x8C, 0x8D, 0x8D, 0x8D, 0x8D, 0x8E, 0x8E, 0x8F, 0x8F, 0x90, 0x90, 0x91, 0x91, 0x0, 0x0,
+				0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9A, 0x9B, 0x9C, 0x9D, 0x9E, 0x9F, 0xA0, 0xA1,
+				0xA2, 0xA3, 0xA4, 0xA5, 0xA6, 0xA7, 0xA8, 0xA9, 0xAA, 0xAB, 0xAC, 0xAD, 0xAE, 0xAF, 0xB0, 0xB1,
+				0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xC0, 0xC1,
+				0x86, 0x86, 0xC2, 0xC3, 0xC4, 0x0, 0xC5, 0xC6, 0x87, 0x87, 0xC7, 0xC7, 0xC8, 0x0, 0xC9, 0x0,
+				0x0, 0x0, 0xCA, 0xCB, 0xCC, 0x0, 0xCD, 0xCE, 0xCF, 0xCF, 0xCF, 0xCF, 0xD0, 0x0, 0x0, 0x0,
+				0x86, 0x86, 0xD1, 0x53, 0x0, 0x0, 0xD2, 0xD3, 0x87, 0x87, 0xD4, 0xD4, 0x0, 0x0, 0x0, 0x0,
+				0x86, 0x86, 0xD5, 0x56, 0xD6, 0x62, 0xD7, 0xD8, 0x87, 0x87, 0xD9, 0xD9, 0x66, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0xDA, 0xDB, 0xDC, 0x0, 0xDD, 0xDE, 0xDF, 0xDF, 0xE0, 0xE0, 0xE1, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xE2, 0x0, 0x0, 0x0, 0xE3, 0xE4, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0xE5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xE6, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7,
+				0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8,
+				0x0, 0x0, 0x0, 0x6, 0x7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9,
+				0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9,
+				0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA,
+				0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B,
+				0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B,
+				0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B,
+				0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C,
+				0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C,
+				0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C,
+				0x6, 0x7, 0xEB, 0xEC, 0xED, 0xEE, 0xEF, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0xF0, 0xF1, 0xF2,
+				0xF3, 0x0, 0x6, 0x7, 0x0, 0x6, 0x7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xF4, 0xF4,
+				0x6, 0x7, 0x6, 0x7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0x7, 0x6, 0x7, 0x0,
+				0x0, 0x0, 0x6, 0x7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5,
+				0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5,
+				0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0x0, 0xF5, 0x0, 0x0, 0x0, 0x0, 0x0, 0xF5, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7,
+				0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7,
+				0x0, 0x0, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7,
+				0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0x7, 0x6, 0x7, 0xF6, 0x6, 0x7,
+				0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x0, 0x0, 0x0, 0x6, 0x7, 0xF7, 0x0, 0x0,
+				0x6, 0x7, 0x6, 0x7, 0xF8, 0x0, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7,
+				0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0xF9, 0xFA, 0xFB, 0xFC, 0xF9, 0x0,
+				0xFD, 0xFE, 0xFF, 0x100, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7,
+				0x6, 0x7, 0x6, 0x7, 0x101, 0x102, 0x103, 0x6, 0x7, 0x6, 0x7, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x6, 0x7, 0x0, 0x0, 0x0, 0x0, 0x6, 0x7, 0x6, 0x7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0x7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x104, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x105, 0x105, 0x105, 0x105, 0x105, 0x105, 0x105, 0x105, 0x105, 0x105, 0x105, 0x105, 0x105, 0x105, 0x105, 0x105,
+				0x105, 0x105, 0x105, 0x105, 0x105, 0x105, 0x105, 0x105, 0x105, 0x105, 0x105, 0x105, 0x105, 0x105, 0x105, 0x105,
+				0x105, 0x105, 0x105, 0x105, 0x105, 0x105, 0x105, 0x105, 0x105, 0x105, 0x105, 0x105, 0x105, 0x105, 0x105, 0x105,
+				0x106, 0x107, 0x108, 0x109, 0x10A, 0x10B, 0x10B, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x10C, 0x10D, 0x10E, 0x10F, 0x110, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x111, 0x111, 0x111, 0x111, 0x111, 0x111, 0x111, 0x111, 0x111, 0x111, 0x111, 0x111, 0x111, 0x111, 0x111, 0x111,
+				0x111, 0x111, 0x111, 0x111, 0x111, 0x111, 0x111, 0x111, 0x111, 0x111, 0x111, 0x111, 0x111, 0x111, 0x111, 0x111,
+				0x111, 0x111, 0x111, 0x111, 0x111, 0x111, 0x111, 0x111, 0x112, 0x112, 0x112, 0x112, 0x112, 0x112, 0x112, 0x112,
+				0x112, 0x112, 0x112, 0x112, 0x112, 0x112, 0x112, 0x112, 0x112, 0x112, 0x112, 0x112, 0x112, 0x112, 0x112, 0x112,
+				0x112, 0x112, 0x112, 0x112, 0x112, 0x112, 0x112, 0x112, 0x112, 0x112, 0x112, 0x112, 0x112, 0x112, 0x112, 0x112,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x111, 0x111, 0x111, 0x111, 0x111, 0x111, 0x111, 0x111, 0x111, 0x111, 0x111, 0x111, 0x111, 0x111, 0x111, 0x111,
+				0x111, 0x111, 0x111, 0x111, 0x111, 0x111, 0x111, 0x111, 0x111, 0x111, 0x111, 0x111, 0x111, 0x111, 0x111, 0x111,
+				0x111, 0x111, 0x111, 0x111, 0x0, 0x0, 0x0, 0x0, 0x112, 0x112, 0x112, 0x112, 0x112, 0x112, 0x112, 0x112,
+				0x112, 0x112, 0x112, 0x112, 0x112, 0x112, 0x112, 0x112, 0x112, 0x112, 0x112, 0x112, 0x112, 0x112, 0x112, 0x112,
+				0x112, 0x112, 0x112, 0x112, 0x112, 0x112, 0x112, 0x112, 0x112, 0x112, 0x112, 0x112, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x113, 0x113, 0x113, 0x113, 0x113, 0x113, 0x113, 0x113, 0x113, 0x113, 0x113, 0x0, 0x113, 0x113, 0x113, 0x113,
+				0x113, 0x113, 0x113, 0x113, 0x113, 0x113, 0x113, 0x113, 0x113, 0x113, 0x113, 0x0, 0x113, 0x113, 0x113, 0x113,
+				0x113, 0x113, 0x113, 0x0, 0x113, 0x113, 0x0, 0x114, 0x114, 0x114, 0x114, 0x114, 0x114, 0x114, 0x114, 0x114,
+				0x114, 0x114, 0x0, 0x114, 0x114, 0x114, 0x114, 0x114, 0x114, 0x114, 0x114, 0x114, 0x114, 0x114, 0x114, 0x114,
+				0x114, 0x114, 0x0, 0x114, 0x114, 0x114, 0x114, 0x114, 0x114, 0x114, 0x0, 0x114, 0x114, 0x0, 0x0, 0x0,
+				0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
+				0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
+				0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
+				0x51, 0x51, 0x51, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58,
+				0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58,
+				0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58,
+				0x58, 0x58, 0x58, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+				0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+				0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2,
+				0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2,
+				0x115, 0x115, 0x115, 0x115, 0x115, 0x115, 0x115, 0x115, 0x115, 0x115, 0x115, 0x115, 0x115, 0x115, 0x115, 0x115,
+				0x115, 0x115, 0x115, 0x115, 0x115, 0x115, 0x115, 0x115, 0x115, 0x115, 0x115, 0x115, 0x115, 0x115, 0x115, 0x115,
+				0x115, 0x115, 0x116, 0x116, 0x116, 0x116, 0x116, 0x116, 0x116, 0x116, 0x116, 0x116, 0x116, 0x116, 0x116, 0x116,
+				0x116, 0x116, 0x116, 0x116, 0x116, 0x116, 0x116, 0x116, 0x116, 0x116, 0x116, 0x116, 0x116, 0x116, 0x116, 0x116,
+				0x116, 0x116, 0x116, 0x116, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			};
+
+			template< typename Dummy >
+			const u32 CaseTables< Dummy >::Records[ 837 ] =
+			{
+				0x200000, 0x200000, 0x200000, 0x200000, 0x200020, 0x200020, 0x1FFFE0, 0x200000,
+				0x200000, 0x2002E7, 0x200000, 0x200307, 0x80020000, 0x200000, 0x80020002, 0x200079,
+				0x200000, 0x200000, 0x200000, 0x200001, 0x200001, 0x1FFFFF, 0x200000, 0x200000,
+				0x200000, 0x80020004, 0x80020004, 0x1FFF18, 0x200000, 0x200000, 0x80020006, 0x200000,
+				0x80020008, 0x200000, 0x1FFF87, 0x1FFF87, 0x1FFED4, 0x200000, 0x1FFEF4, 0x2000C3,
+				0x200000, 0x200000, 0x200000, 0x2000D2, 0x2000D2, 0x200000, 0x2000CE, 0x2000CE,
+				0x200000, 0x2000CD, 0x2000CD, 0x200000, 0x20004F, 0x20004F, 0x200000, 0x2000CA,
+				0x2000CA, 0x200000, 0x2000CB, 0x2000CB, 0x200000, 0x2000CF, 0x2000CF, 0x200061,
+				0x200000, 0x200000, 0x200000, 0x2000D3, 0x2000D3, 0x200000, 0x2000D1, 0x2000D1,
+				0x2000A3, 0x200000, 0x200000, 0x200000, 0x2000D5, 0x2000D5, 0x200082, 0x200000,
+				0x200000, 0x200000, 0x2000D6, 0x2000D6, 0x200000, 0x2000DA, 0x2000DA, 0x200000,
+				0x2000D9, 0x2000D9, 0x200000, 0x2000DB, 0x2000DB, 0x200038, 0x200000, 0x200000,
+				0x200000, 0x200002, 0x200002, 0x1FFFFF, 0x200001, 0x200001, 0x1FFFFE, 0x200000,
+				0x200000, 0x1FFFB1, 0x200000, 0x200000, 0x8002000A, 0x200000, 0x8002000C, 0x200000,
+				0x1FFF9F, 0x1FFF9F, 0x200000, 0x1FFFC8, 0x1FFFC8, 0x200000, 0x1FFF7E, 0x1FFF7E,
+				0x200000, 0x202A2B, 0x202A2B, 0x200000, 0x1FFF5D, 0x1FFF5D, 0x200000, 0x202A28,
+				0x202A28, 0x202A3F, 0x200000, 0x200000, 0x200000, 0x1FFF3D, 0x1FFF3D, 0x200000,
+				0x200045, 0x200045, 0x200000, 0x200047, 0x200047, 0x202A1F, 0x200000, 0x200000,
+				0x202A1C, 0x200000, 0x200000, 0x202A1E, 0x200000, 0x200000, 0x1FFF2E, 0x200000,
+				0x200000, 0x1FFF32, 0x200000, 0x200000, 0x1FFF33, 0x200000, 0x200000, 0x1FFF36,
+				0x200000, 0x200000, 0x1FFF35, 0x200000, 0x200000, 0x20A54F, 0x200000, 0x200000,
+				0x20A54B, 0x200000, 0x200000, 0x1FFF31, 0x200000, 0x200000, 0x20A528, 0x200000,
+				0x200000, 0x20A544, 0x200000, 0x200000, 0x1FFF2F, 0x200000, 0x200000, 0x1FFF2D,
+				0x200000, 0x200000, 0x2029F7, 0x200000, 0x200000, 0x20A541, 0x200000, 0x200000,
+				0x2029FD, 0x200000, 0x200000, 0x1FFF2B, 0x200000, 0x200000, 0x1FFF2A, 0x200000,
+				0x200000, 0x2029E7, 0x200000, 0x200000, 0x1FFF26, 0x200000, 0x200000, 0x20A543,
+				0x200000, 0x200000, 0x20A52A, 0x200000, 0x200000, 0x1FFFBB, 0x200000, 0x200000,
+				0x1FFF27, 0x200000, 0x200000, 0x1FFFB9, 0x200000, 0x200000, 0x1FFF25, 0x200000,
+				0x200000, 0x20A515, 0x200000, 0x200000, 0x20A512, 0x200000, 0x200000, 0x200054,
+				0x200000, 0x200074, 0x200000, 0x200074, 0x200074, 0x200000, 0x200026, 0x200026,
+				0x200000, 0x200025, 0x200025, 0x200000, 0x200040, 0x200040, 0x200000, 0x20003F,
+				0x20003F, 0x8003000E, 0x200000, 0x80030011, 0x1FFFDA, 0x200000, 0x200000, 0x1FFFDB,
+				0x200000, 0x200000, 0x80030014, 0x200000, 0x80030017, 0x1FFFE1, 0x200000, 0x200001,
+				0x1FFFC0, 0x200000, 0x200000, 0x1FFFC1, 0x200000, 0x200000, 0x200000, 0x200008,
+				0x200008, 0x1FFFC2, 0x200000, 0x1FFFE2, 0x1FFFC7, 0x200000, 0x1FFFE7, 0x1FFFD1,
+				0x200000, 0x1FFFF1, 0x1FFFCA, 0x200000, 0x1FFFEA, 0x1FFFF8, 0x200000, 0x200000,
+				0x1FFFAA, 0x200000, 0x1FFFCA, 0x1FFFB0, 0x200000, 0x1FFFD0, 0x200007, 0x200000,
+				0x200000, 0x1FFF8C, 0x200000, 0x200000, 0x200000, 0x1FFFC4, 0x1FFFC4, 0x1FFFA0,
+				0x200000, 0x1FFFC0, 0x200000, 0x1FFFF9, 0x1FFFF9, 0x200000, 0x200050, 0x200050,
+				0x1FFFB0, 0x200000, 0x200000, 0x200000, 0x20000F, 0x20000F, 0x1FFFF1, 0x200000,
+				0x200000, 0x200000, 0x200030, 0x200030, 0x1FFFD0, 0x200000, 0x200000, 0x8002001A,
+				0x200000, 0x8002001C, 0x200000, 0x201C60, 0x201C60, 0x200BC0, 0x200000, 0x200000,
+				0x200000, 0x2097D0, 0x200000, 0x200000, 0x200008, 0x200000, 0x1FFFF8, 0x200000,
+				0x1FFFF8, 0x1FE792, 0x200000, 0x1FE7B2, 0x1FE793, 0x200000, 0x1FE7B3, 0x1FE79C,
+				0x200000, 0x1FE7BC, 0x1FE79E, 0x200000, 0x1FE7BE, 0x1FE79D, 0x200000, 0x1FE7BD,
+				0x1FE7A4, 0x200000, 0x1FE7C4, 0x1FE7DB, 0x200000, 0x1FE7DC, 0x2089C2, 0x200000,
+				0x2089C3, 0x200000, 0x1FF440, 0x1FF440, 0x208A04, 0x200000, 0x200000, 0x200EE6,
+				0x200000, 0x200000, 0x208A38, 0x200000, 0x200000, 0x8002001E, 0x200000, 0x80020020,
+				0x80020022, 0x200000, 0x80020024, 0x80020026, 0x200000, 0x80020028, 0x8002002A, 0x200000,
+				0x8002002C, 0x8002002E, 0x200000, 0x80020030, 0x1FFFC5, 0x200000, 0x1FFFC6, 0x200000,
+				0x1FE241, 0x80020002, 0x200008, 0x200000, 0x200000, 0x200000, 0x1FFFF8, 0x1FFFF8,
+				0x80020032, 0x200000, 0x80020034, 0x80030036, 0x200000, 0x80030039, 0x8003003C, 0x200000,
+				0x8003003F, 0x80030042, 0x200000, 0x80030045, 0x20004A, 0x200000, 0x200000, 0x200056,
+				0x200000, 0x200000, 0x200064, 0x200000, 0x200000, 0x200080, 0x200000, 0x200000,
+				0x200070, 0x200000, 0x200000, 0x20007E, 0x200000, 0x200000, 0x80020048, 0x200000,
+				0x8002004A, 0x8002004C, 0x200000, 0x8002004E, 0x80020050, 0x200000, 0x80020052, 0x80020054,
+				0x200000, 0x80020056, 0x80020058, 0x200000, 0x8002005A, 0x8002005C, 0x200000, 0x8002005E,
+				0x80020060, 0x200000, 0x80020062, 0x80020064, 0x200000, 0x80020066, 0x80020048, 0x1FFFF8,
+				0x8002004A, 0x8002004C, 0x1FFFF8, 0x8002004E, 0x80020050, 0x1FFFF8, 0x80020052, 0x80020054,
+				0x1FFFF8, 0x80020056, 0x80020058, 0x1FFFF8, 0x8002005A, 0x8002005C, 0x1FFFF8, 0x8002005E,
+				0x80020060, 0x1FFFF8, 0x80020062, 0x80020064, 0x1FFFF8, 0x80020066, 0x80020068, 0x200000,
+				0x8002006A, 0x8002006C, 0x200000, 0x8002006E, 0x80020070, 0x200000, 0x80020072, 0x80020074,
+				0x200000, 0x80020076, 0x80020078, 0x200000, 0x8002007A, 0x8002007C, 0x200000, 0x8002007E,
+				0x80020080, 0x200000, 0x80020082, 0x80020084, 0x200000, 0x80020086, 0x80020068, 0x1FFFF8,
+				0x8002006A, 0x8002006C, 0x1FFFF8, 0x8002006E, 0x80020070, 0x1FFFF8, 0x80020072, 0x80020074,
+				0x1FFFF8, 0x80020076, 0x80020078, 0x1FFFF8, 0x8002007A, 0x8002007C, 0x1FFFF8, 0x8002007E,
+				0x80020080, 0x1FFFF8, 0x80020082, 0x80020084, 0x1FFFF8, 0x80020086, 0x80020088, 0x200000,
+				0x8002008A, 0x8002008C, 0x200000, 0x8002008E, 0x80020090, 0x200000, 0x80020092, 0x80020094,
+				0x200000, 0x80020096, 0x80020098, 0x200000, 0x8002009A, 0x8002009C, 0x200000, 0x8002009E,
+				0x800200A0, 0x200000, 0x800200A2, 0x800200A4, 0x200000, 0x800200A6, 0x80020088, 0x1FFFF8,
+				0x8002008A, 0x8002008C, 0x1FFFF8, 0x8002008E, 0x80020090, 0x1FFFF8, 0x80020092, 0x80020094,
+				0x1FFFF8, 0x80020096, 0x80020098, 0x1FFFF8, 0x8002009A, 0x8002009C, 0x1FFFF8, 0x8002009E,
+				0x800200A0, 0x1FFFF8, 0x800200A2, 0x800200A4, 0x1FFFF8, 0x800200A6, 0x800200A8, 0x200000,
+				0x800200AA, 0x800200AC, 0x200000, 0x800200AE, 0x800200B0, 0x200000, 0x800200B2, 0x800200B4,
+				0x200000, 0x800200B6, 0x800300B8, 0x200000, 0x800300BB, 0x200000, 0x1FFFB6, 0x1FFFB6,
+				0x800200AC, 0x1FFFF7, 0x800200AE, 0x1FE3DB, 0x200000, 0x1FE3FB, 0x800200BE, 0x200000,
+				0x800200C0, 0x800200C2, 0x200000, 0x800200C4, 0x800200C6, 0x200000, 0x800200C8, 0x800200CA,
+				0x200000, 0x800200CC, 0x800300CE, 0x200000, 0x800300D1, 0x200000, 0x1FFFAA, 0x1FFFAA,
+				0x800200C2, 0x1FFFF7, 0x800200C4, 0x800300D4, 0x200000, 0x800300D7, 0x800200DA, 0x200000,
+				0x800200DC, 0x800300DE, 0x200000, 0x800300E1, 0x200000, 0x1FFF9C, 0x1FFF9C, 0x800300E4,
+				0x200000, 0x800300E7, 0x800200EA, 0x200000, 0x800200EC, 0x800200EE, 0x200000, 0x800200F0,
+				0x800300F2, 0x200000, 0x800300F5, 0x200000, 0x1FFF90, 0x1FFF90, 0x800200F8, 0x200000,
+				0x800200FA, 0x800200FC, 0x200000, 0x800200FE, 0x80020100, 0x200000, 0x80020102, 0x80020104,
+				0x200000, 0x80020106, 0x80030108, 0x200000, 0x8003010B, 0x200000, 0x1FFF80, 0x1FFF80,
+				0x200000, 0x1FFF82, 0x1FFF82, 0x800200FC, 0x1FFFF7, 0x800200FE, 0x200000, 0x1FE2A3,
+				0x1FE2A3, 0x200000, 0x1FDF41, 0x1FDF41, 0x200000, 0x1FDFBA, 0x1FDFBA, 0x200000,
+				0x20001C, 0x20001C, 0x1FFFE4, 0x200000, 0x200000, 0x200000, 0x200010, 0x200010,
+				0x1FFFF0, 0x200000, 0x200000, 0x200000, 0x20001A, 0x20001A, 0x1FFFE6, 0x200000,
+				0x200000, 0x200000, 0x1FD609, 0x1FD609, 0x200000, 0x1FF11A, 0x1FF11A, 0x200000,
+				0x1FD619, 0x1FD619, 0x1FD5D5, 0x200000, 0x200000, 0x1FD5D8, 0x200000, 0x200000,
+				0x200000, 0x1FD5E4, 0x1FD5E4, 0x200000, 0x1FD603, 0x1FD603, 0x200000, 0x1FD5E1,
+				0x1FD5E1, 0x200000, 0x1FD5E2, 0x1FD5E2, 0x200000, 0x1FD5C1, 0x1FD5C1, 0x1FE3A0,
+				0x200000, 0x200000, 0x200000, 0x1F75FC, 0x1F75FC, 0x200000, 0x1F5AD8, 0x1F5AD8,
+				0x200030, 0x200000, 0x200000, 0x200000, 0x1F5ABC, 0x1F5ABC, 0x200000, 0x1F5AB1,
+				0x1F5AB1, 0x200000, 0x1F5AB5, 0x1F5AB5, 0x200000, 0x1F5ABF, 0x1F5ABF, 0x200000,
+				0x1F5AEE, 0x1F5AEE, 0x200000, 0x1F5AD6, 0x1F5AD6, 0x200000, 0x1F5AEB, 0x1F5AEB,
+				0x200000, 0x2003A0, 0x2003A0, 0x200000, 0x1FFFD0, 0x1FFFD0, 0x200000, 0x1F5ABD,
+				0x1F5ABD, 0x200000, 0x1F75C8, 0x1F75C8, 0x1FFC60, 0x200000, 0x200000, 0x1F6830,
+				0x200000, 0x1F6830, 0x8002010E, 0x200000, 0x80020110, 0x80020112, 0x200000, 0x80020114,
+				0x80020116, 0x200000, 0x80020118, 0x8003011A, 0x200000, 0x8003011D, 0x80030120, 0x200000,
+				0x80030123, 0x80020126, 0x200000, 0x80020128, 0x8002012A, 0x200000, 0x8002012C, 0x8002012E,
+				0x200000, 0x80020130, 0x80020132, 0x200000, 0x80020134, 0x80020136, 0x200000, 0x80020138,
+				0x8002013A, 0x200000, 0x8002013C, 0x200000, 0x200028, 0x200028, 0x1FFFD8, 0x200000,
+				0x200000, 0x200000, 0x200027, 0x200027, 0x1FFFD9, 0x200000, 0x200000, 0x200000,
+				0x200022, 0x200022, 0x1FFFDE, 0x200000, 0x200000,
+			};
+
+			template< typename Dummy >
+			const u32 CaseTables< Dummy >::Expansions[ 318 ] =
+			{
+				0x53, 0x53, 0x73, 0x73, 0x69, 0x307, 0x2BC, 0x4E,
+				0x2BC, 0x6E, 0x4A, 0x30C, 0x6A, 0x30C, 0x399, 0x308,
+				0x301, 0x3B9, 0x308, 0x301, 0x3A5, 0x308, 0x301, 0x3C5,
+				0x308, 0x301, 0x535, 0x552, 0x565, 0x582, 0x48, 0x331,
+				0x68, 0x331, 0x54, 0x308, 0x74, 0x308, 0x57, 0x30A,
+				0x77, 0x30A, 0x59, 0x30A, 0x79, 0x30A, 0x41, 0x2BE,
+				0x61, 0x2BE, 0x3A5, 0x313, 0x3C5, 0x313, 0x3A5, 0x313,
+				0x300, 0x3C5, 0x313, 0x300, 0x3A5, 0x313, 0x301, 0x3C5,
+				0x313, 0x301, 0x3A5, 0x313, 0x342, 0x3C5, 0x313, 0x342,
+				0x1F08, 0x399, 0x1F00, 0x3B9, 0x1F09, 0x399, 0x1F01, 0x3B9,
+				0x1F0A, 0x399, 0x1F02, 0x3B9, 0x1F0B, 0x399, 0x1F03, 0x3B9,
+				0x1F0C, 0x399, 0x1F04, 0x3B9, 0x1F0D, 0x399, 0x1F05, 0x3B9,
+				0x1F0E, 0x399, 0x1F06, 0x3B9, 0x1F0F, 0x399, 0x1F07, 0x3B9,
+				0x1F28, 0x399, 0x1F20, 0x3B9, 0x1F29, 0x399, 0x1F21, 0x3B9,
+				0x1F2A, 0x399, 0x1F22, 0x3B9, 0x1F2B, 0x399, 0x1F23, 0x3B9,
+				0x1F2C, 0x399, 0x1F24, 0x3B9, 0x1F2D, 0x399, 0x1F25, 0x3B9,
+				0x1F2E, 0x399, 0x1F26, 0x3B9, 0x1F2F, 0x399, 0x1F27, 0x3B9,
+				0x1F68, 0x399, 0x1F60, 0x3B9, 0x1F69, 0x399, 0x1F61, 0x3B9,
+				0x1F6A, 0x399, 0x1F62, 0x3B9, 0x1F6B, 0x399, 0x1F63, 0x3B9,
+				0x1F6C, 0x399, 0x1F64, 0x3B9, 0x1F6D, 0x399, 0x1F65, 0x3B9,
+				0x1F6E, 0x399, 0x1F66, 0x3B9, 0x1F6F, 0x399, 0x1F67, 0x3B9,
+				0x1FBA, 0x399, 0x1F70, 0x3B9, 0x391, 0x399, 0x3B1, 0x3B9,
+				0x386, 0x399, 0x3AC, 0x3B9, 0x391, 0x342, 0x3B1, 0x342,
+				0x391, 0x342, 0x399, 0x3B1, 0x342, 0x3B9, 0x1FCA, 0x399,
+				0x1F74, 0x3B9, 0x397, 0x399, 0x3B7, 0x3B9, 0x389, 0x399,
+				0x3AE, 0x3B9, 0x397, 0x342, 0x3B7, 0x342, 0x397, 0x342,
+				0x399, 0x3B7, 0x342, 0x3B9, 0x399, 0x308, 0x300, 0x3B9,
+				0x308, 0x300, 0x399, 0x342, 0x3B9, 0x342, 0x399, 0x308,
+				0x342, 0x3B9, 0x308, 0x342, 0x3A5, 0x308, 0x300, 0x3C5,
+				0x308, 0x300, 0x3A1, 0x313, 0x3C1, 0x313, 0x3A5, 0x342,
+				0x3C5, 0x342, 0x3A5, 0x308, 0x342, 0x3C5, 0x308, 0x342,
+				0x1FFA, 0x399, 0x1F7C, 0x3B9, 0x3A9, 0x399, 0x3C9, 0x3B9,
+				0x38F, 0x399, 0x3CE, 0x3B9, 0x3A9, 0x342, 0x3C9, 0x342,
+				0x3A9, 0x342, 0x399, 0x3C9, 0x342, 0x3B9, 0x46, 0x46,
+				0x66, 0x66, 0x46, 0x49, 0x66, 0x69, 0x46, 0x4C,
+				0x66, 0x6C, 0x46, 0x46, 0x49, 0x66, 0x66, 0x69,
+				0x46, 0x46, 0x4C, 0x66, 0x66, 0x6C, 0x53, 0x54,
+				0x73, 0x74, 0x544, 0x546, 0x574, 0x576, 0x544, 0x535,
+				0x574, 0x565, 0x544, 0x53B, 0x574, 0x56B, 0x54E, 0x546,
+				0x57E, 0x576, 0x544, 0x53D, 0x574, 0x56D,
+			};
+
+			/**
+			\brief The utf-8 lead bytes of the first code point which needs a closer look, per normalization form.
+
+			Every byte below this value belongs to a code point with canonical combining class 0 which is normalized in every context,
+			so blocks without a larger byte can be skipped by the quick check.
+			*/
+			static const unsigned char QuickCheckLeadBytes[ 4 ] = { 0xCC, 0xC3, 0xC2, 0xC2 };
+
+			/**
+			\brief Normalization properties, decompositions and compositions of every code point, Hangul syllables are handled algorithmically.
+			*/
+			template< typename Dummy >
+			struct NormalizationTables
+			{
+				static const u32 PropertyShift = 6U;
+				static const u32 PropertyLimit = 0x2FA40U;
+				static const unsigned char PropertyStage1[ 3049 ];
+				static const unsigned char PropertyStage2[ 13952 ];
+				static const u32 DecompositionShift = 6U;
+				static const u32 DecompositionLimit = 0x2FA40U;
+				static const unsigned char DecompositionStage1[ 3049 ];
+				static const unsigned short DecompositionStage2[ 10880 ];
+				static const u32 CompositionShift = 5U;
+				static const u32 CompositionLimit = 0x11940U;
+				static const unsigned char CompositionStage1[ 2250 ];
+				static const unsigned short CompositionStage2[ 2336 ];
+				static const unsigned short Properties[ 69 ];
+				static const unsigned short Decompositions[ 15054 ];
+				static const unsigned short CompositionStarts[ 378 ];
+				static const u32 CompositionPairs[ 1882 ];
+			};
+
+			template< typename Dummy >
+			const unsigned char NormalizationTables< Dummy >::PropertyStage1[ 3049 ] =
+			{
+				0x0, 0x0, 0x1, 0x2, 0x3, 0x4, 0x5, 0x6, 0x7, 0x0, 0x8, 0x9, 0xA, 0xB, 0xC, 0xD,
+				0xE, 0xF, 0x10, 0x11, 0x0, 0x0, 0x12, 0x13, 0x14, 0x15, 0x0, 0x16, 0x17, 0x18, 0x0, 0x19,
+				0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x20, 0x26, 0x27, 0x28,
+				0x24, 0x29, 0x24, 0x2A, 0x2B, 0x28, 0x0, 0x2C, 0x2D, 0x2E, 0x2F, 0x30, 0x31, 0x32, 0x33, 0x34,
+				0x35, 0x0, 0x36, 0x37, 0x0, 0x38, 0x39, 0x3A, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3B, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3C, 0x0, 0x0, 0x3D,
+				0x0, 0x0, 0x3E, 0x0, 0x3F, 0x0, 0x0, 0x0, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47,
+				0x48, 0x0, 0x0, 0x49, 0x4A, 0x4B, 0x4C, 0x4D, 0x4E, 0x4E, 0x4F, 0x50, 0x51, 0x52, 0x53, 0x54,
+				0x55, 0x56, 0x57, 0x58, 0x59, 0x5A, 0x5B, 0x5C, 0x5D, 0x5E, 0x5F, 0x60, 0x61, 0x0, 0x0, 0x0,
+				0x0, 0x62, 0x63, 0x64, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x65, 0x66, 0x0, 0x67, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x68, 0x0, 0x69, 0x0, 0x6A, 0x0, 0x6B, 0x0, 0x0, 0x6C, 0x6D, 0x63, 0x63, 0x63, 0x6E,
+				0x6F, 0x70, 0x71, 0x72, 0x73, 0x63, 0x74, 0x0, 0x75, 0x76, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x77, 0x78, 0x79, 0x0, 0x7A, 0x0, 0x7B,
+				0x7C, 0x0, 0x0, 0x7D, 0x7E, 0x7F, 0x80, 0x81, 0x0, 0x0, 0x82, 0x83, 0x0, 0x84, 0x0, 0x85,
+				0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E,
+				0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E,
+				0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E,
+				0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E,
+				0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E,
+				0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E,
+				0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E,
+				0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E,
+				0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E,
+				0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E,
+				0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x86, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x87, 0x87, 0x87, 0x87, 0x88, 0x89, 0x87, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E,
+				0x63, 0x63, 0x63, 0x63, 0x8F, 0x90, 0x91, 0x92, 0x93, 0x94, 0x63, 0x95, 0x96, 0x63, 0x97, 0x98,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x99, 0x0, 0x0, 0x0, 0x9A, 0x0, 0x9B, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9C, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9D, 0x0, 0x0, 0x9E, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x9F, 0x0, 0x0, 0x0, 0x0, 0x0, 0xA0, 0x0, 0x0, 0xA1, 0xA2, 0x0,
+				0x0, 0xA3, 0xA4, 0x0, 0xA5, 0x80, 0x0, 0xA6, 0xA7, 0x0, 0x0, 0xA8, 0xA9, 0xAA, 0x0, 0x0,
+				0x0, 0xAB, 0xAC, 0xAD, 0x0, 0x0, 0xAE, 0xAF, 0xB0, 0x0, 0xB1, 0x0, 0xB2, 0x0, 0x0, 0x0,
+				0xB3, 0x0, 0x0, 0x0, 0xB4, 0xB5, 0x0, 0xB6, 0xB7, 0xB8, 0xB9, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0xB0, 0x0, 0x0, 0x0, 0x0, 0xBA, 0xBB, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xBC, 0xBD, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xBE,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0xBF, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0xC0, 0xC1, 0xC2, 0x0, 0xC3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x63, 0xC4, 0xC5, 0xC6, 0xC7, 0xC8, 0x63, 0x63, 0x63, 0x63, 0xC9, 0x63, 0x63, 0x63, 0x63, 0xCA,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0xCB, 0x0, 0x0, 0x0, 0xBD, 0x0, 0x0, 0x0, 0x0, 0x0, 0xCC, 0xCD, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0xCE, 0x0, 0xCF, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xD0, 0xD1, 0xD2, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0xD3, 0xD4, 0xD5, 0x0, 0xD6, 0xD7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xD8,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0xD9,
+			};
+
+			template< typename Dummy >
+			const unsigned char NormalizationTables< Dummy >::PropertyStage2[ 13952 ] =
+			{
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x36, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x36, 0x0, 0x36, 0x0, 0x0, 0x0, 0x0, 0x36,
+				0x0, 0x0, 0x36, 0x36, 0x36, 0x36, 0x0, 0x0, 0x36, 0x36, 0x36, 0x0, 0x36, 0x36, 0x36, 0x0,
+				0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x0, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+				0x0, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x0, 0x0, 0x35, 0x35, 0x35, 0x35, 0x35, 0x0, 0x0,
+				0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x0, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+				0x0, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x0, 0x0, 0x35, 0x35, 0x35, 0x35, 0x35, 0x0, 0x35,
+				0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+				0x0, 0x0, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+				0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x0, 0x0, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+				0x35, 0x0, 0x36, 0x36, 0x35, 0x35, 0x35, 0x35, 0x0, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x36,
+				0x36, 0x0, 0x0, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x36, 0x0, 0x0, 0x35, 0x35, 0x35, 0x35,
+				0x35, 0x35, 0x0, 0x0, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+				0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x0, 0x0, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+				0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x36,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x35, 0x35, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x35,
+				0x35, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x35, 0x35, 0x35,
+				0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x0, 0x35, 0x35,
+				0x35, 0x35, 0x35, 0x35, 0x0, 0x0, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+				0x35, 0x36, 0x36, 0x36, 0x35, 0x35, 0x0, 0x0, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+				0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+				0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x0, 0x0, 0x35, 0x35,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+				0x35, 0x35, 0x35, 0x35, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x0, 0x0,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x43, 0x43, 0x43, 0x43, 0x43, 0x31, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x31, 0x31, 0x43,
+				0x31, 0x43, 0x31, 0x43, 0x43, 0x32, 0x2C, 0x2C, 0x2C, 0x2C, 0x32, 0x41, 0x2C, 0x2C, 0x2C, 0x2C,
+				0x2C, 0x28, 0x28, 0x42, 0x42, 0x42, 0x42, 0x40, 0x40, 0x2C, 0x2C, 0x2C, 0x2C, 0x42, 0x42, 0x2C,
+				0x42, 0x42, 0x2C, 0x2C, 0x1, 0x1, 0x1, 0x1, 0x3B, 0x2C, 0x2C, 0x2C, 0x2C, 0x31, 0x31, 0x31,
+				0x39, 0x39, 0x43, 0x39, 0x39, 0x44, 0x31, 0x2C, 0x2C, 0x2C, 0x31, 0x31, 0x31, 0x2C, 0x2C, 0x0,
+				0x31, 0x31, 0x31, 0x2C, 0x2C, 0x2C, 0x2C, 0x31, 0x32, 0x2C, 0x2C, 0x31, 0x33, 0x34, 0x34, 0x33,
+				0x34, 0x34, 0x33, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
+				0x0, 0x0, 0x0, 0x0, 0x38, 0x0, 0x0, 0x0, 0x0, 0x0, 0x36, 0x0, 0x0, 0x0, 0x38, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x36, 0x37, 0x35, 0x38, 0x35, 0x35, 0x35, 0x0, 0x35, 0x0, 0x35, 0x35,
+				0x35, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+				0x35, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x35, 0x35, 0x35, 0x35, 0x35, 0x0,
+				0x36, 0x36, 0x36, 0x37, 0x37, 0x36, 0x36, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x36, 0x36, 0x36, 0x0, 0x36, 0x36, 0x0, 0x0, 0x0, 0x36, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x35, 0x35, 0x0, 0x35, 0x0, 0x0, 0x0, 0x35, 0x0, 0x0, 0x0, 0x0, 0x35, 0x35, 0x35, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x35, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x35, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x35, 0x35, 0x0, 0x35, 0x0, 0x0, 0x0, 0x35, 0x0, 0x0, 0x0, 0x0, 0x35, 0x35, 0x35, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x35, 0x35, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x31, 0x31, 0x31, 0x31, 0x31, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x35, 0x35, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x35, 0x35, 0x35, 0x35, 0x0, 0x0, 0x35, 0x35, 0x0, 0x0, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+				0x0, 0x0, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x0, 0x0, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+				0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x0, 0x0, 0x35, 0x35, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x36, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x2C, 0x31, 0x31, 0x31, 0x31, 0x2C, 0x31, 0x31, 0x31, 0x2D, 0x2C, 0x31, 0x31, 0x31, 0x31,
+				0x31, 0x31, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x31, 0x31, 0x2C, 0x31, 0x31, 0x2D, 0x30, 0x31,
+				0x5, 0x6, 0x7, 0x8, 0x9, 0xA, 0xB, 0xC, 0xD, 0xE, 0xE, 0xF, 0x10, 0x11, 0x0, 0x12,
+				0x0, 0x13, 0x14, 0x0, 0x31, 0x2C, 0x0, 0xD, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x19, 0x1A, 0x1B, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x35, 0x35, 0x35, 0x35, 0x35, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x16, 0x17, 0x18, 0x19, 0x1A,
+				0x1B, 0x1C, 0x1D, 0x43, 0x43, 0x42, 0x2C, 0x31, 0x31, 0x31, 0x31, 0x31, 0x2C, 0x31, 0x31, 0x2C,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x1E, 0x0, 0x0, 0x0, 0x0, 0x36, 0x36, 0x36, 0x36, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x35, 0x0, 0x35, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x35, 0x0, 0x0, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x0, 0x0, 0x31,
+				0x31, 0x31, 0x31, 0x2C, 0x31, 0x0, 0x0, 0x31, 0x31, 0x0, 0x2C, 0x31, 0x31, 0x2C, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x1F, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x31, 0x2C, 0x31, 0x31, 0x2C, 0x31, 0x31, 0x2C, 0x2C, 0x2C, 0x31, 0x2C, 0x2C, 0x31, 0x2C, 0x31,
+				0x31, 0x31, 0x2C, 0x31, 0x2C, 0x31, 0x2C, 0x31, 0x2C, 0x31, 0x31, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x31, 0x31, 0x31, 0x31, 0x31,
+				0x31, 0x31, 0x2C, 0x31, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2C, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x31, 0x31, 0x31, 0x31, 0x0, 0x31, 0x31, 0x31, 0x31, 0x31,
+				0x31, 0x31, 0x31, 0x31, 0x0, 0x31, 0x31, 0x31, 0x0, 0x31, 0x31, 0x31, 0x31, 0x31, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2C, 0x2C, 0x2C, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x31, 0x2C, 0x2C, 0x2C, 0x31, 0x31, 0x31, 0x31,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x31, 0x31, 0x31, 0x31, 0x31, 0x2C,
+				0x2C, 0x2C, 0x2C, 0x2C, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
+				0x31, 0x31, 0x0, 0x2C, 0x31, 0x31, 0x2C, 0x31, 0x31, 0x2C, 0x31, 0x31, 0x31, 0x2C, 0x2C, 0x2C,
+				0x16, 0x17, 0x18, 0x31, 0x31, 0x31, 0x2C, 0x31, 0x31, 0x2C, 0x2C, 0x31, 0x31, 0x31, 0x31, 0x31,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x35, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x35, 0x0, 0x0, 0x35, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3C, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x0, 0x0,
+				0x0, 0x31, 0x2C, 0x31, 0x31, 0x0, 0x0, 0x0, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x3A, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x35, 0x35, 0x4, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3A, 0x0, 0x0, 0x0, 0x0, 0x38, 0x38, 0x0, 0x38,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x31, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x38, 0x0, 0x0, 0x38, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x38, 0x38, 0x38, 0x0, 0x0, 0x38, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x35, 0x0, 0x0, 0x35, 0x35, 0x4, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3A, 0x3A, 0x0, 0x0, 0x0, 0x0, 0x38, 0x38, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x35, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3A, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x35, 0x35, 0x35, 0x4, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3A, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x35, 0x0, 0x0, 0x0, 0x0, 0x4, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x20, 0x3F, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x35, 0x0, 0x3A, 0x0, 0x0, 0x0, 0x0, 0x35, 0x35, 0x0, 0x35, 0x35, 0x0, 0x4, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x3A, 0x3A, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x4, 0x0, 0x3A, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3E, 0x0, 0x0, 0x0, 0x0, 0x3A,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x35, 0x0, 0x35, 0x35, 0x35, 0x3A,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x36, 0x0, 0x0, 0x0, 0x0, 0x21, 0x21, 0x4, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x22, 0x22, 0x22, 0x22, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x36, 0x0, 0x0, 0x0, 0x0, 0x23, 0x23, 0x4, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x24, 0x24, 0x24, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x36, 0x36, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x36, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2C, 0x2C, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x2C, 0x0, 0x2C, 0x0, 0x2A, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x38, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x38, 0x0, 0x0,
+				0x0, 0x0, 0x38, 0x0, 0x0, 0x0, 0x0, 0x38, 0x0, 0x0, 0x0, 0x0, 0x38, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x38, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x25, 0x26, 0x38, 0x27, 0x38, 0x38, 0x36, 0x38, 0x36, 0x26, 0x26, 0x26, 0x26, 0x0, 0x0,
+				0x26, 0x38, 0x31, 0x31, 0x4, 0x0, 0x31, 0x31, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x38, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x38, 0x0, 0x0,
+				0x0, 0x0, 0x38, 0x0, 0x0, 0x0, 0x0, 0x38, 0x0, 0x0, 0x0, 0x0, 0x38, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x38, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2C, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x35, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3A, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x4, 0x4, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2C, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x36, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A,
+				0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A,
+				0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A,
+				0x3A, 0x3A, 0x3A, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x31, 0x31, 0x31,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x4, 0x4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x31, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2D, 0x31, 0x2C, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x31, 0x2C, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x0, 0x0, 0x2C,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x31, 0x31, 0x31, 0x31, 0x31, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x31, 0x31, 0x2C, 0x0, 0x2C,
+				0x2C, 0x31, 0x31, 0x2C, 0x2C, 0x31, 0x31, 0x31, 0x31, 0x31, 0x2C, 0x31, 0x31, 0x31, 0x31, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x35, 0x0, 0x35, 0x0, 0x35, 0x0, 0x35, 0x0, 0x35, 0x0,
+				0x0, 0x0, 0x35, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x3, 0x3A, 0x0, 0x0, 0x0, 0x0, 0x0, 0x35, 0x0, 0x35, 0x0, 0x0,
+				0x35, 0x35, 0x0, 0x35, 0x4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x31, 0x2C, 0x31, 0x31, 0x31,
+				0x31, 0x31, 0x31, 0x31, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x4, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x4, 0x4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x31, 0x31, 0x31, 0x0, 0x1, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x31, 0x31, 0x2C, 0x2C, 0x2C, 0x2C,
+				0x31, 0x0, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x0, 0x0, 0x0, 0x0, 0x2C, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x31, 0x0, 0x0, 0x0, 0x31, 0x31, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x36, 0x36, 0x36, 0x0,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x0, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x0, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x36, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x31, 0x31, 0x2C, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x2C, 0x31, 0x31, 0x34, 0x29, 0x2C,
+				0x28, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
+				0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
+				0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x32, 0x30, 0x30, 0x2C, 0x2B, 0x31, 0x33, 0x2C, 0x31, 0x2C,
+				0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+				0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+				0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+				0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+				0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+				0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x36, 0x37, 0x0, 0x0, 0x0, 0x0,
+				0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+				0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+				0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+				0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+				0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+				0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+				0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x0, 0x0, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x0, 0x0,
+				0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+				0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+				0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x0, 0x0, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x0, 0x0,
+				0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x0, 0x35, 0x0, 0x35, 0x0, 0x35, 0x0, 0x35,
+				0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+				0x35, 0x38, 0x35, 0x38, 0x35, 0x38, 0x35, 0x38, 0x35, 0x38, 0x35, 0x38, 0x35, 0x38, 0x0, 0x0,
+				0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+				0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+				0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+				0x35, 0x35, 0x35, 0x35, 0x35, 0x0, 0x35, 0x35, 0x35, 0x35, 0x35, 0x38, 0x35, 0x36, 0x38, 0x36,
+				0x36, 0x37, 0x35, 0x35, 0x35, 0x0, 0x35, 0x35, 0x35, 0x38, 0x35, 0x38, 0x35, 0x37, 0x37, 0x37,
+				0x35, 0x35, 0x35, 0x38, 0x0, 0x0, 0x35, 0x35, 0x35, 0x35, 0x35, 0x38, 0x0, 0x37, 0x37, 0x37,
+				0x35, 0x35, 0x35, 0x38, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x38, 0x35, 0x37, 0x38, 0x38,
+				0x0, 0x0, 0x35, 0x35, 0x35, 0x0, 0x35, 0x35, 0x35, 0x38, 0x35, 0x38, 0x35, 0x38, 0x36, 0x0,
+				0x38, 0x38, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x36, 0x0, 0x0, 0x0, 0x0, 0x0, 0x36, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x36, 0x36, 0x36, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x36,
+				0x0, 0x0, 0x0, 0x36, 0x36, 0x0, 0x36, 0x36, 0x0, 0x0, 0x0, 0x0, 0x36, 0x0, 0x36, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x36, 0x36, 0x36, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x36, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x36,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x36, 0x36, 0x0, 0x0, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x0,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x36, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x31, 0x31, 0x1, 0x1, 0x31, 0x31, 0x31, 0x31, 0x1, 0x1, 0x1, 0x31, 0x31, 0x0, 0x0, 0x0,
+				0x0, 0x31, 0x0, 0x0, 0x0, 0x1, 0x1, 0x31, 0x2C, 0x31, 0x1, 0x1, 0x2C, 0x2C, 0x2C, 0x2C,
+				0x31, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x36, 0x36, 0x36, 0x36, 0x0, 0x36, 0x36, 0x36, 0x0, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x0, 0x36, 0x36, 0x0, 0x0, 0x36, 0x36, 0x36, 0x36, 0x36, 0x0, 0x0,
+				0x36, 0x36, 0x36, 0x0, 0x36, 0x0, 0x38, 0x0, 0x36, 0x0, 0x38, 0x38, 0x36, 0x36, 0x0, 0x36,
+				0x36, 0x36, 0x0, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x0, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x0, 0x0, 0x0, 0x0, 0x36, 0x36, 0x36, 0x36, 0x36, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x36, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x35, 0x35, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x35, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x35, 0x35, 0x35,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x35, 0x0, 0x0, 0x0, 0x0, 0x35, 0x0, 0x0, 0x35, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x35, 0x0, 0x35, 0x0, 0x0, 0x0, 0x0, 0x0, 0x36, 0x36, 0x0, 0x36,
+				0x36, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x35, 0x0, 0x0, 0x35, 0x0, 0x0, 0x35, 0x0, 0x35, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x35, 0x0, 0x35, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x35, 0x35, 0x35,
+				0x35, 0x35, 0x0, 0x0, 0x35, 0x35, 0x0, 0x0, 0x35, 0x35, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x35, 0x35, 0x0, 0x0, 0x35, 0x35, 0x0, 0x0, 0x35, 0x35, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x35, 0x35, 0x35, 0x35,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x35, 0x35, 0x35, 0x35, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x35, 0x35, 0x35, 0x35, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x38, 0x38, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x36, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x36, 0x36, 0x36, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x38, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x36, 0x36, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x31,
+				0x31, 0x31, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x36,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
+				0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x36,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x36, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x36, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2B, 0x30, 0x32, 0x2D, 0x2E, 0x2E,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x36, 0x0, 0x36, 0x36, 0x36, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x35, 0x0, 0x35, 0x0,
+				0x35, 0x0, 0x35, 0x0, 0x35, 0x0, 0x35, 0x0, 0x35, 0x0, 0x35, 0x0, 0x35, 0x0, 0x35, 0x0,
+				0x35, 0x0, 0x35, 0x0, 0x0, 0x35, 0x0, 0x35, 0x0, 0x35, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x35, 0x35, 0x0, 0x35, 0x35, 0x0, 0x35, 0x35, 0x0, 0x35, 0x35, 0x0, 0x35, 0x35, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x35, 0x0, 0x0, 0x0, 0x0, 0x3D, 0x3D, 0x36, 0x36, 0x0, 0x35, 0x36,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x35, 0x0, 0x35, 0x0,
+				0x35, 0x0, 0x35, 0x0, 0x35, 0x0, 0x35, 0x0, 0x35, 0x0, 0x35, 0x0, 0x35, 0x0, 0x35, 0x0,
+				0x35, 0x0, 0x35, 0x0, 0x0, 0x35, 0x0, 0x35, 0x0, 0x35, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x35, 0x35, 0x0, 0x35, 0x35, 0x0, 0x35, 0x35, 0x0, 0x35, 0x35, 0x0, 0x35, 0x35, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x35, 0x0, 0x0, 0x35, 0x35, 0x35, 0x35, 0x0, 0x0, 0x0, 0x35, 0x36,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x0,
+				0x0, 0x0, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x0,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x31,
+				0x0, 0x0, 0x0, 0x0, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x36, 0x36, 0x31, 0x31,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x31, 0x31, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x36, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x36, 0x36, 0x36, 0x0, 0x0, 0x0, 0x36, 0x36, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
+				0x31, 0x31, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2C, 0x2C, 0x2C, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x31, 0x0, 0x31, 0x31, 0x2C, 0x0, 0x0, 0x31, 0x31, 0x0, 0x0, 0x0, 0x0, 0x0, 0x31, 0x31,
+				0x0, 0x31, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x36, 0x36, 0x36, 0x36,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x36, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+				0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+				0x35, 0x35, 0x35, 0x35, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+				0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+				0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+				0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+				0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x0, 0x0,
+				0x38, 0x0, 0x38, 0x0, 0x0, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x0,
+				0x38, 0x0, 0x38, 0x0, 0x0, 0x38, 0x38, 0x0, 0x0, 0x0, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+				0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+				0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+				0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+				0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x0, 0x0,
+				0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+				0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+				0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x36, 0x36, 0x36, 0x36, 0x36, 0x0, 0x0, 0x0, 0x0, 0x0, 0x38, 0x15, 0x38,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+				0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x0, 0x38, 0x38, 0x38, 0x38, 0x38, 0x0, 0x38, 0x0,
+				0x38, 0x38, 0x0, 0x38, 0x38, 0x0, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x0, 0x0, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x31, 0x31,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x0, 0x0, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x0, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x0, 0x36, 0x36, 0x36, 0x36, 0x0, 0x0, 0x0, 0x0,
+				0x36, 0x36, 0x36, 0x0, 0x36, 0x0, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x0, 0x0, 0x0,
+				0x0, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x0,
+				0x0, 0x0, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x0, 0x0, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x0, 0x0, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x0, 0x0, 0x36, 0x36, 0x36, 0x0, 0x0, 0x0,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x0, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2C, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x2C, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x31, 0x31, 0x31, 0x31, 0x31, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x36, 0x36, 0x36, 0x36, 0x36, 0x0, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x0, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2C, 0x0, 0x31,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x31, 0x1, 0x2C, 0x0, 0x0, 0x0, 0x0, 0x4,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x31, 0x2C, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x31, 0x31, 0x31, 0x31, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x31, 0x31, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2C, 0x2C, 0x31, 0x31, 0x31, 0x2C, 0x31, 0x2C, 0x2C, 0x2C,
+				0x2C, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x31, 0x2C, 0x31, 0x2C, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x35, 0x0, 0x35, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x35, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x3C, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x31, 0x31, 0x31, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3A, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x35, 0x35,
+				0x0, 0x0, 0x0, 0x4, 0x4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x4, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x3A, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x35, 0x35, 0x4, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3A, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x0, 0x0, 0x0,
+				0x31, 0x31, 0x31, 0x31, 0x31, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x4, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x31, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x3A, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3A, 0x35, 0x35, 0x3A, 0x35, 0x0,
+				0x0, 0x0, 0x4, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3A,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x35, 0x35, 0x0, 0x0, 0x0, 0x4,
+				0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x3A, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x35, 0x0, 0x0, 0x0, 0x0, 0x4, 0x4, 0x0,
+				0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x3, 0x0, 0x4, 0x4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x1, 0x1, 0x1, 0x1, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x2, 0x2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x38, 0x38,
+				0x38, 0x38, 0x38, 0x38, 0x38, 0x2A, 0x2A, 0x1, 0x1, 0x1, 0x0, 0x0, 0x0, 0x2F, 0x2A, 0x2A,
+				0x2A, 0x2A, 0x2A, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C,
+				0x2C, 0x2C, 0x2C, 0x0, 0x0, 0x31, 0x31, 0x31, 0x31, 0x31, 0x2C, 0x2C, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x31, 0x31, 0x31, 0x31, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x38, 0x38, 0x38, 0x38, 0x38,
+				0x38, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x31, 0x31, 0x31, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x0, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x0, 0x36, 0x36,
+				0x0, 0x0, 0x36, 0x0, 0x0, 0x36, 0x36, 0x0, 0x0, 0x36, 0x36, 0x36, 0x36, 0x0, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x0, 0x36, 0x0, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x0, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x0, 0x36, 0x36, 0x36, 0x36, 0x0, 0x0, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x0, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x0, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x0, 0x36, 0x36, 0x36, 0x36, 0x0,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x0, 0x36, 0x0, 0x0, 0x0, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x0, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x0, 0x0, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x0, 0x0, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x0, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
+				0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x0, 0x0, 0x31, 0x31, 0x31, 0x31, 0x31,
+				0x31, 0x31, 0x0, 0x31, 0x31, 0x0, 0x31, 0x31, 0x31, 0x31, 0x31, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x31, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x31, 0x31, 0x31, 0x31,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x36, 0x36, 0x36, 0x36, 0x0, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x0, 0x36, 0x36, 0x0, 0x36, 0x0, 0x0, 0x36, 0x0, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x0, 0x36, 0x36, 0x36, 0x36, 0x0, 0x36, 0x0, 0x36, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x36, 0x0, 0x0, 0x0, 0x0, 0x36, 0x0, 0x36, 0x0, 0x36, 0x0, 0x36, 0x36, 0x36,
+				0x0, 0x36, 0x36, 0x0, 0x36, 0x0, 0x0, 0x36, 0x0, 0x36, 0x0, 0x36, 0x0, 0x36, 0x0, 0x36,
+				0x0, 0x36, 0x36, 0x0, 0x36, 0x0, 0x0, 0x36, 0x36, 0x36, 0x36, 0x0, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x0, 0x36, 0x36, 0x36, 0x36, 0x0, 0x36, 0x36, 0x36, 0x36, 0x0, 0x36, 0x0,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x0, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x36, 0x36, 0x36, 0x0, 0x36, 0x36, 0x36, 0x36, 0x36, 0x0, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x0, 0x0, 0x0, 0x0,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x0,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x36, 0x36, 0x36, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x36, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x36, 0x36, 0x36, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x0, 0x0, 0x0, 0x0,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x36, 0x36, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+				0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			};
+
+			template< typename Dummy >
+			const unsigned char NormalizationTables< Dummy >::DecompositionStage1[ 3049 ] =
+			{
+				0x0, 0x0, 0x1, 0x2, 0x3, 0x4, 0x5, 0x6, 0x7, 0x0, 0x8, 0x9, 0x0, 0xA, 0xB, 0xC,
+				0xD, 0xE, 0x0, 0xF, 0x0, 0x0, 0x10, 0x0, 0x11, 0x12, 0x0, 0x13, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x14, 0x15, 0x0, 0x16, 0x17, 0x18, 0x0, 0x0, 0x0, 0x19, 0x1A, 0x1B,
+				0x0, 0x1C, 0x0, 0x1D, 0x0, 0x1E, 0x0, 0x1F, 0x20, 0x0, 0x21, 0x22, 0x23, 0x24, 0x25, 0x0,
+				0x26, 0x0, 0x0, 0x27, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x28, 0x29, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x2A, 0x2B, 0x2C, 0x0, 0x2D, 0x2E, 0x2F, 0x30, 0x31, 0x32, 0x33, 0x34,
+				0x35, 0x36, 0x37, 0x0, 0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0x3E, 0x3F, 0x40, 0x0, 0x0, 0x0,
+				0x0, 0x41, 0x42, 0x43, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x44, 0x45, 0x0, 0x46, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x47, 0x0, 0x0, 0x0, 0x48, 0x0, 0x0, 0x0, 0x0, 0x49, 0x4A, 0x4B, 0x4C, 0x4D, 0x4E,
+				0x4F, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x0, 0x56, 0x57, 0x58, 0x59, 0x5A, 0x5B, 0x5C, 0x5D,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5E, 0x0, 0x0, 0x5F, 0x0, 0x60,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x61, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D,
+				0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x7B, 0x7C, 0x7D,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7E, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x7F, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x81, 0x0, 0x0,
+				0x0, 0x0, 0x82, 0x0, 0x0, 0x0, 0x83, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x84, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x85, 0x86, 0x87, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F, 0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x98, 0x99, 0x9A, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x9B, 0x9C, 0x9D, 0x0, 0x9E, 0x9F, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xA0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0xA1, 0xA2, 0xA3, 0xA4, 0xA5, 0xA6, 0xA7, 0xA8, 0xA9,
+			};
+
+			template< typename Dummy >
+			const unsigned short NormalizationTables< Dummy >::DecompositionStage2[ 10880 ] =
+			{
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x6, 0x0, 0x0, 0x0, 0x0, 0x8,
+				0x0, 0x0, 0xB, 0xD, 0xF, 0x12, 0x0, 0x0, 0x14, 0x17, 0x19, 0x0, 0x1B, 0x1F, 0x23, 0x0,
+				0x27, 0x2A, 0x2D, 0x30, 0x33, 0x36, 0x0, 0x39, 0x3C, 0x3F, 0x42, 0x45, 0x48, 0x4B, 0x4E, 0x51,
+				0x0, 0x54, 0x57, 0x5A, 0x5D, 0x60, 0x63, 0x0, 0x0, 0x66, 0x69, 0x6C, 0x6F, 0x72, 0x0, 0x0,
+				0x75, 0x78, 0x7B, 0x7E, 0x81, 0x84, 0x0, 0x87, 0x8A, 0x8D, 0x90, 0x93, 0x96, 0x99, 0x9C, 0x9F,
+				0x0, 0xA2, 0xA5, 0xA8, 0xAB, 0xAE, 0xB1, 0x0, 0x0, 0xB4, 0xB7, 0xBA, 0xBD, 0xC0, 0x0, 0xC3,
+				0xC6, 0xC9, 0xCC, 0xCF, 0xD2, 0xD5, 0xD8, 0xDB, 0xDE, 0xE1, 0xE4, 0xE7, 0xEA, 0xED, 0xF0, 0xF3,
+				0x0, 0x0, 0xF6, 0xF9, 0xFC, 0xFF, 0x102, 0x105, 0x108, 0x10B, 0x10E, 0x111, 0x114, 0x117, 0x11A, 0x11D,
+				0x120, 0x123, 0x126, 0x129, 0x12C, 0x12F, 0x0, 0x0, 0x132, 0x135, 0x138, 0x13B, 0x13E, 0x141, 0x144, 0x147,
+				0x14A, 0x0, 0x14D, 0x150, 0x153, 0x156, 0x159, 0x15C, 0x0, 0x15F, 0x162, 0x165, 0x168, 0x16B, 0x16E, 0x171,
+				0x174, 0x0, 0x0, 0x177, 0x17A, 0x17D, 0x180, 0x183, 0x186, 0x189, 0x0, 0x0, 0x18C, 0x18F, 0x192, 0x195,
+				0x198, 0x19B, 0x0, 0x0, 0x19E, 0x1A1, 0x1A4, 0x1A7, 0x1AA, 0x1AD, 0x1B0, 0x1B3, 0x1B6, 0x1B9, 0x1BC, 0x1BF,
+				0x1C2, 0x1C5, 0x1C8, 0x1CB, 0x1CE, 0x1D1, 0x0, 0x0, 0x1D4, 0x1D7, 0x1DA, 0x1DD, 0x1E0, 0x1E3, 0x1E6, 0x1E9,
+				0x1EC, 0x1EF, 0x1F2, 0x1F5, 0x1F8, 0x1FB, 0x1FE, 0x201, 0x204, 0x207, 0x20A, 0x20D, 0x210, 0x213, 0x216, 0x219,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x21B, 0x21E, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x221,
+				0x224, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x227, 0x22B, 0x22F, 0x233, 0x236, 0x239, 0x23C, 0x23F, 0x242, 0x245, 0x248, 0x24B,
+				0x24E, 0x251, 0x254, 0x257, 0x25A, 0x25D, 0x261, 0x265, 0x269, 0x26D, 0x271, 0x275, 0x279, 0x0, 0x27D, 0x281,
+				0x285, 0x289, 0x28D, 0x290, 0x0, 0x0, 0x293, 0x296, 0x299, 0x29C, 0x29F, 0x2A2, 0x2A5, 0x2A9, 0x2AD, 0x2B0,
+				0x2B3, 0x2B6, 0x2B9, 0x2BC, 0x2BF, 0x2C2, 0x0, 0x0, 0x2C5, 0x2C8, 0x2CB, 0x2CF, 0x2D3, 0x2D6, 0x2D9, 0x2DC,
+				0x2DF, 0x2E2, 0x2E5, 0x2E8, 0x2EB, 0x2EE, 0x2F1, 0x2F4, 0x2F7, 0x2FA, 0x2FD, 0x300, 0x303, 0x306, 0x309, 0x30C,
+				0x30F, 0x312, 0x315, 0x318, 0x31B, 0x31E, 0x321, 0x324, 0x327, 0x32A, 0x32D, 0x330, 0x0, 0x0, 0x333, 0x336,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x339, 0x33C, 0x33F, 0x342, 0x345, 0x349, 0x34D, 0x351, 0x355, 0x358,
+				0x35B, 0x35F, 0x363, 0x366, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x369, 0x36B, 0x36D, 0x36F, 0x371, 0x373, 0x375, 0x377, 0x379, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x37B, 0x37E, 0x381, 0x384, 0x387, 0x38A, 0x0, 0x0,
+				0x38D, 0x38F, 0x391, 0x393, 0x395, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x397, 0x399, 0x0, 0x39B, 0x39D, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x3A0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3A2, 0x0, 0x0, 0x0, 0x3A5, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x3A7, 0x3AA, 0x3B0, 0x3B3, 0x3B5, 0x3B8, 0x3BB, 0x0, 0x3BE, 0x0, 0x3C1, 0x3C4,
+				0x3C7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3CB, 0x3CE, 0x3D1, 0x3D4, 0x3D7, 0x3DA,
+				0x3DD, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3E1, 0x3E4, 0x3E7, 0x3EA, 0x3ED, 0x0,
+				0x3F0, 0x3F2, 0x3F4, 0x3F6, 0x3FB, 0x400, 0x402, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x404, 0x406, 0x408, 0x0, 0x40A, 0x40C, 0x0, 0x0, 0x0, 0x40E, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x410, 0x413, 0x0, 0x416, 0x0, 0x0, 0x0, 0x419, 0x0, 0x0, 0x0, 0x0, 0x41C, 0x41F, 0x422, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x425, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x428, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x42B, 0x42E, 0x0, 0x431, 0x0, 0x0, 0x0, 0x434, 0x0, 0x0, 0x0, 0x0, 0x437, 0x43A, 0x43D, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x440, 0x443, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x446, 0x449, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x44C, 0x44F, 0x452, 0x455, 0x0, 0x0, 0x458, 0x45B, 0x0, 0x0, 0x45E, 0x461, 0x464, 0x467, 0x46A, 0x46D,
+				0x0, 0x0, 0x470, 0x473, 0x476, 0x479, 0x47C, 0x47F, 0x0, 0x0, 0x482, 0x485, 0x488, 0x48B, 0x48E, 0x491,
+				0x494, 0x497, 0x49A, 0x49D, 0x4A0, 0x4A3, 0x0, 0x0, 0x4A6, 0x4A9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4AC, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x4AF, 0x4B2, 0x4B5, 0x4B8, 0x4BB, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x4BE, 0x4C1, 0x4C4, 0x4C7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x4CA, 0x0, 0x4CD, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x4D0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4D3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x4D6, 0x0, 0x0, 0x4D9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4DC, 0x4DF, 0x4E2, 0x4E5, 0x4E8, 0x4EB, 0x4EE, 0x4F1,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4F4, 0x4F7, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4FA, 0x4FD, 0x0, 0x500,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x503, 0x0, 0x0, 0x506, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x509, 0x50C, 0x50F, 0x0, 0x0, 0x512, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x515, 0x0, 0x0, 0x518, 0x51B, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x51E, 0x521, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x524, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x527, 0x52A, 0x52D, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x530, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x533, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x536, 0x539, 0x0, 0x53C, 0x53F, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x543, 0x546, 0x549, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x54C, 0x0, 0x54F, 0x552, 0x556, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x559, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x55C, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x55F, 0x562, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x565, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x567, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x56A, 0x0, 0x0,
+				0x0, 0x0, 0x56D, 0x0, 0x0, 0x0, 0x0, 0x570, 0x0, 0x0, 0x0, 0x0, 0x573, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x576, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x579, 0x0, 0x57C, 0x57F, 0x582, 0x586, 0x589, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x58D, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x590, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x593, 0x0, 0x0,
+				0x0, 0x0, 0x596, 0x0, 0x0, 0x0, 0x0, 0x599, 0x0, 0x0, 0x0, 0x0, 0x59C, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x59F, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5A2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5A5, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5A7, 0x0, 0x5AA, 0x0, 0x5AD, 0x0, 0x5B0, 0x0, 0x5B3, 0x0,
+				0x0, 0x0, 0x5B6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5B9, 0x0, 0x5BC, 0x0, 0x0,
+				0x5BF, 0x5C2, 0x0, 0x5C5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5C8, 0x5CA, 0x5CC, 0x0,
+				0x5CE, 0x5D0, 0x5D2, 0x5D4, 0x5D6, 0x5D8, 0x5DA, 0x5DC, 0x5DE, 0x5E0, 0x5E2, 0x0, 0x5E4, 0x5E6, 0x5E8, 0x5EA,
+				0x5EC, 0x5EE, 0x5F0, 0x5F2, 0x5F4, 0x5F6, 0x5F8, 0x5FA, 0x5FC, 0x5FE, 0x600, 0x602, 0x604, 0x606, 0x0, 0x608,
+				0x60A, 0x60C, 0x60E, 0x610, 0x612, 0x614, 0x616, 0x618, 0x61A, 0x61C, 0x61E, 0x620, 0x622, 0x624, 0x626, 0x628,
+				0x62A, 0x62C, 0x62E, 0x630, 0x632, 0x634, 0x636, 0x638, 0x63A, 0x63C, 0x63E, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x640, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x642, 0x644, 0x646, 0x648, 0x64A,
+				0x64C, 0x64E, 0x650, 0x652, 0x654, 0x656, 0x658, 0x65A, 0x65C, 0x65E, 0x660, 0x662, 0x664, 0x666, 0x668, 0x66A,
+				0x66C, 0x66E, 0x670, 0x672, 0x674, 0x676, 0x678, 0x67A, 0x67C, 0x67E, 0x680, 0x682, 0x684, 0x686, 0x688, 0x68A,
+				0x68C, 0x68F, 0x692, 0x695, 0x698, 0x69B, 0x69E, 0x6A1, 0x6A4, 0x6A8, 0x6AC, 0x6AF, 0x6B2, 0x6B5, 0x6B8, 0x6BB,
+				0x6BE, 0x6C1, 0x6C4, 0x6C7, 0x6CA, 0x6CE, 0x6D2, 0x6D6, 0x6DA, 0x6DD, 0x6E0, 0x6E3, 0x6E6, 0x6EA, 0x6EE, 0x6F1,
+				0x6F4, 0x6F7, 0x6FA, 0x6FD, 0x700, 0x703, 0x706, 0x709, 0x70C, 0x70F, 0x712, 0x715, 0x718, 0x71B, 0x71E, 0x722,
+				0x726, 0x729, 0x72C, 0x72F, 0x732, 0x735, 0x738, 0x73B, 0x73E, 0x742, 0x746, 0x749, 0x74C, 0x74F, 0x752, 0x755,
+				0x758, 0x75B, 0x75E, 0x761, 0x764, 0x767, 0x76A, 0x76D, 0x770, 0x773, 0x776, 0x779, 0x77C, 0x780, 0x784, 0x788,
+				0x78C, 0x790, 0x794, 0x798, 0x79C, 0x79F, 0x7A2, 0x7A5, 0x7A8, 0x7AB, 0x7AE, 0x7B1, 0x7B4, 0x7B8, 0x7BC, 0x7BF,
+				0x7C2, 0x7C5, 0x7C8, 0x7CB, 0x7CE, 0x7D2, 0x7D6, 0x7DA, 0x7DE, 0x7E2, 0x7E6, 0x7E9, 0x7EC, 0x7EF, 0x7F2, 0x7F5,
+				0x7F8, 0x7FB, 0x7FE, 0x801, 0x804, 0x807, 0x80A, 0x80D, 0x810, 0x814, 0x818, 0x81C, 0x820, 0x823, 0x826, 0x829,
+				0x82C, 0x82F, 0x832, 0x835, 0x838, 0x83B, 0x83E, 0x841, 0x844, 0x847, 0x84A, 0x84D, 0x850, 0x853, 0x856, 0x859,
+				0x85C, 0x85F, 0x862, 0x865, 0x868, 0x86B, 0x86E, 0x871, 0x874, 0x877, 0x87A, 0x87D, 0x0, 0x0, 0x0, 0x0,
+				0x882, 0x885, 0x888, 0x88B, 0x88E, 0x892, 0x896, 0x89A, 0x89E, 0x8A2, 0x8A6, 0x8AA, 0x8AE, 0x8B2, 0x8B6, 0x8BA,
+				0x8BE, 0x8C2, 0x8C6, 0x8CA, 0x8CE, 0x8D2, 0x8D6, 0x8DA, 0x8DE, 0x8E1, 0x8E4, 0x8E7, 0x8EA, 0x8ED, 0x8F0, 0x8F4,
+				0x8F8, 0x8FC, 0x900, 0x904, 0x908, 0x90C, 0x910, 0x914, 0x918, 0x91B, 0x91E, 0x921, 0x924, 0x927, 0x92A, 0x92D,
+				0x930, 0x934, 0x938, 0x93C, 0x940, 0x944, 0x948, 0x94C, 0x950, 0x954, 0x958, 0x95C, 0x960, 0x964, 0x968, 0x96C,
+				0x970, 0x974, 0x978, 0x97C, 0x980, 0x983, 0x986, 0x989, 0x98C, 0x990, 0x994, 0x998, 0x99C, 0x9A0, 0x9A4, 0x9A8,
+				0x9AC, 0x9B0, 0x9B4, 0x9B7, 0x9BA, 0x9BD, 0x9C0, 0x9C3, 0x9C6, 0x9C9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x9CC, 0x9CF, 0x9D2, 0x9D6, 0x9DA, 0x9DE, 0x9E2, 0x9E6, 0x9EA, 0x9ED, 0x9F0, 0x9F4, 0x9F8, 0x9FC, 0xA00, 0xA04,
+				0xA08, 0xA0B, 0xA0E, 0xA12, 0xA16, 0xA1A, 0x0, 0x0, 0xA1E, 0xA21, 0xA24, 0xA28, 0xA2C, 0xA30, 0x0, 0x0,
+				0xA34, 0xA37, 0xA3A, 0xA3E, 0xA42, 0xA46, 0xA4A, 0xA4E, 0xA52, 0xA55, 0xA58, 0xA5C, 0xA60, 0xA64, 0xA68, 0xA6C,
+				0xA70, 0xA73, 0xA76, 0xA7A, 0xA7E, 0xA82, 0xA86, 0xA8A, 0xA8E, 0xA91, 0xA94, 0xA98, 0xA9C, 0xAA0, 0xAA4, 0xAA8,
+				0xAAC, 0xAAF, 0xAB2, 0xAB6, 0xABA, 0xABE, 0x0, 0x0, 0xAC2, 0xAC5, 0xAC8, 0xACC, 0xAD0, 0xAD4, 0x0, 0x0,
+				0xAD8, 0xADB, 0xADE, 0xAE2, 0xAE6, 0xAEA, 0xAEE, 0xAF2, 0x0, 0xAF6, 0x0, 0xAF9, 0x0, 0xAFD, 0x0, 0xB01,
+				0xB05, 0xB08, 0xB0B, 0xB0F, 0xB13, 0xB17, 0xB1B, 0xB1F, 0xB23, 0xB26, 0xB29, 0xB2D, 0xB31, 0xB35, 0xB39, 0xB3D,
+				0xB41, 0xB44, 0xB47, 0xB4A, 0xB4D, 0xB50, 0xB53, 0xB56, 0xB59, 0xB5C, 0xB5F, 0xB62, 0xB65, 0xB68, 0x0, 0x0,
+				0xB6B, 0xB6F, 0xB73, 0xB78, 0xB7D, 0xB82, 0xB87, 0xB8C, 0xB91, 0xB95, 0xB99, 0xB9E, 0xBA3, 0xBA8, 0xBAD, 0xBB2,
+				0xBB7, 0xBBB, 0xBBF, 0xBC4, 0xBC9, 0xBCE, 0xBD3, 0xBD8, 0xBDD, 0xBE1, 0xBE5, 0xBEA, 0xBEF, 0xBF4, 0xBF9, 0xBFE,
+				0xC03, 0xC07, 0xC0B, 0xC10, 0xC15, 0xC1A, 0xC1F, 0xC24, 0xC29, 0xC2D, 0xC31, 0xC36, 0xC3B, 0xC40, 0xC45, 0xC4A,
+				0xC4F, 0xC52, 0xC55, 0xC59, 0xC5C, 0x0, 0xC60, 0xC63, 0xC67, 0xC6A, 0xC6D, 0xC70, 0xC73, 0xC76, 0xC79, 0xC7B,
+				0xC7E, 0xC81, 0xC87, 0xC8B, 0xC8E, 0x0, 0xC92, 0xC95, 0xC99, 0xC9C, 0xC9F, 0xCA2, 0xCA5, 0xCA8, 0xCAE, 0xCB4,
+				0xCBA, 0xCBD, 0xCC0, 0xCC4, 0x0, 0x0, 0xCC8, 0xCCB, 0xCCF, 0xCD2, 0xCD5, 0xCD8, 0x0, 0xCDB, 0xCE1, 0xCE7,
+				0xCED, 0xCF0, 0xCF3, 0xCF7, 0xCFB, 0xCFE, 0xD01, 0xD04, 0xD08, 0xD0B, 0xD0E, 0xD11, 0xD14, 0xD17, 0xD1D, 0xD23,
+				0x0, 0x0, 0xD25, 0xD29, 0xD2C, 0x0, 0xD30, 0xD33, 0xD37, 0xD3A, 0xD3D, 0xD40, 0xD43, 0xD46, 0xD4A, 0x0,
+				0xD4D, 0xD50, 0xD53, 0xD55, 0xD57, 0xD59, 0xD5B, 0xD5D, 0xD5F, 0xD61, 0xD63, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0xD65, 0x0, 0x0, 0x0, 0x0, 0x0, 0xD67, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0xD6A, 0xD6C, 0xD6F, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xD73,
+				0x0, 0x0, 0x0, 0xD75, 0xD78, 0x0, 0xD7C, 0xD7F, 0x0, 0x0, 0x0, 0x0, 0xD83, 0x0, 0xD86, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xD89, 0xD8C, 0xD8F, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xD92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xD97,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0xD99, 0xD9B, 0x0, 0x0, 0xD9D, 0xD9F, 0xDA1, 0xDA3, 0xDA5, 0xDA7, 0xDA9, 0xDAB, 0xDAD, 0xDAF, 0xDB1, 0xDB3,
+				0xDB5, 0xDB7, 0xDB9, 0xDBB, 0xDBD, 0xDBF, 0xDC1, 0xDC3, 0xDC5, 0xDC7, 0xDC9, 0xDCB, 0xDCD, 0xDCF, 0xDD1, 0x0,
+				0xDD3, 0xDD5, 0xDD7, 0xDD9, 0xDDB, 0xDDD, 0xDDF, 0xDE1, 0xDE3, 0xDE5, 0xDE7, 0xDE9, 0xDEB, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xDED, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0xDF0, 0xDF4, 0xDF8, 0xDFA, 0x0, 0xDFD, 0xE01, 0xE05, 0x0, 0xE07, 0xE0A, 0xE0C, 0xE0E, 0xE10, 0xE12, 0xE14,
+				0xE16, 0xE18, 0xE1A, 0xE1C, 0x0, 0xE1E, 0xE20, 0x0, 0x0, 0xE23, 0xE25, 0xE27, 0xE29, 0xE2B, 0x0, 0x0,
+				0xE2D, 0xE30, 0xE34, 0x0, 0xE37, 0x0, 0xE39, 0x0, 0xE3B, 0x0, 0xE3D, 0xE3F, 0xE42, 0xE44, 0x0, 0xE46,
+				0xE48, 0xE4A, 0x0, 0xE4C, 0xE4E, 0xE50, 0xE52, 0xE54, 0xE56, 0xE58, 0x0, 0xE5A, 0xE5E, 0xE60, 0xE62, 0xE64,
+				0xE66, 0x0, 0x0, 0x0, 0x0, 0xE68, 0xE6A, 0xE6C, 0xE6E, 0xE70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0xE72, 0xE76, 0xE7A, 0xE7F, 0xE83, 0xE87, 0xE8B, 0xE8F, 0xE93, 0xE97, 0xE9B, 0xE9F, 0xEA3, 0xEA7, 0xEAB, 0xEAF,
+				0xEB2, 0xEB4, 0xEB7, 0xEBB, 0xEBE, 0xEC0, 0xEC3, 0xEC7, 0xECC, 0xECF, 0xED1, 0xED4, 0xED8, 0xEDA, 0xEDC, 0xEDE,
+				0xEE0, 0xEE2, 0xEE5, 0xEE9, 0xEEC, 0xEEE, 0xEF1, 0xEF5, 0xEFA, 0xEFD, 0xEFF, 0xF02, 0xF06, 0xF08, 0xF0A, 0xF0C,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xF0E, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xF12, 0xF15, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xF18, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xF1B, 0xF1E, 0xF21,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0xF24, 0x0, 0x0, 0x0, 0x0, 0xF27, 0x0, 0x0, 0xF2A, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0xF2D, 0x0, 0xF30, 0x0, 0x0, 0x0, 0x0, 0x0, 0xF33, 0xF36, 0x0, 0xF3A,
+				0xF3D, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0xF41, 0x0, 0x0, 0xF44, 0x0, 0x0, 0xF47, 0x0, 0xF4A, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0xF4D, 0x0, 0xF50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xF53, 0xF56, 0xF59,
+				0xF5C, 0xF5F, 0x0, 0x0, 0xF62, 0xF65, 0x0, 0x0, 0xF68, 0xF6B, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0xF6E, 0xF71, 0x0, 0x0, 0xF74, 0xF77, 0x0, 0x0, 0xF7A, 0xF7D, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xF80, 0xF83, 0xF86, 0xF89,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0xF8C, 0xF8F, 0xF92, 0xF95, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xF98, 0xF9B, 0xF9E, 0xFA1, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xFA4, 0xFA6, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0xFA8, 0xFAA, 0xFAC, 0xFAE, 0xFB0, 0xFB2, 0xFB4, 0xFB6, 0xFB8, 0xFBA, 0xFBD, 0xFC0, 0xFC3, 0xFC6, 0xFC9, 0xFCC,
+				0xFCF, 0xFD2, 0xFD5, 0xFD8, 0xFDB, 0xFDF, 0xFE3, 0xFE7, 0xFEB, 0xFEF, 0xFF3, 0xFF7, 0xFFB, 0xFFF, 0x1004, 0x1009,
+				0x100E, 0x1013, 0x1018, 0x101D, 0x1022, 0x1027, 0x102C, 0x1031, 0x1036, 0x1039, 0x103C, 0x103F, 0x1042, 0x1045, 0x1048, 0x104B,
+				0x104E, 0x1051, 0x1055, 0x1059, 0x105D, 0x1061, 0x1065, 0x1069, 0x106D, 0x1071, 0x1075, 0x1079, 0x107D, 0x1081, 0x1085, 0x1089,
+				0x108D, 0x1091, 0x1095, 0x1099, 0x109D, 0x10A1, 0x10A5, 0x10A9, 0x10AD, 0x10B1, 0x10B5, 0x10B9, 0x10BD, 0x10C1, 0x10C5, 0x10C9,
+				0x10CD, 0x10D1, 0x10D5, 0x10D9, 0x10DD, 0x10E1, 0x10E5, 0x10E7, 0x10E9, 0x10EB, 0x10ED, 0x10EF, 0x10F1, 0x10F3, 0x10F5, 0x10F7,
+				0x10F9, 0x10FB, 0x10FD, 0x10FF, 0x1101, 0x1103, 0x1105, 0x1107, 0x1109, 0x110B, 0x110D, 0x110F, 0x1111, 0x1113, 0x1115, 0x1117,
+				0x1119, 0x111B, 0x111D, 0x111F, 0x1121, 0x1123, 0x1125, 0x1127, 0x1129, 0x112B, 0x112D, 0x112F, 0x1131, 0x1133, 0x1135, 0x1137,
+				0x1139, 0x113B, 0x113D, 0x113F, 0x1141, 0x1143, 0x1145, 0x1147, 0x1149, 0x114B, 0x114D, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x114F, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x1154, 0x1158, 0x115B, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x115F, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1162, 0x1164, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1166,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1168,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x116A, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x116C, 0x116E, 0x1170, 0x1172, 0x1174, 0x1176, 0x1178, 0x117A, 0x117C, 0x117E, 0x1180, 0x1182, 0x1184, 0x1186, 0x1188, 0x118A,
+				0x118C, 0x118E, 0x1190, 0x1192, 0x1194, 0x1196, 0x1198, 0x119A, 0x119C, 0x119E, 0x11A0, 0x11A2, 0x11A4, 0x11A6, 0x11A8, 0x11AA,
+				0x11AC, 0x11AE, 0x11B0, 0x11B2, 0x11B4, 0x11B6, 0x11B8, 0x11BA, 0x11BC, 0x11BE, 0x11C0, 0x11C2, 0x11C4, 0x11C6, 0x11C8, 0x11CA,
+				0x11CC, 0x11CE, 0x11D0, 0x11D2, 0x11D4, 0x11D6, 0x11D8, 0x11DA, 0x11DC, 0x11DE, 0x11E0, 0x11E2, 0x11E4, 0x11E6, 0x11E8, 0x11EA,
+				0x11EC, 0x11EE, 0x11F0, 0x11F2, 0x11F4, 0x11F6, 0x11F8, 0x11FA, 0x11FC, 0x11FE, 0x1200, 0x1202, 0x1204, 0x1206, 0x1208, 0x120A,
+				0x120C, 0x120E, 0x1210, 0x1212, 0x1214, 0x1216, 0x1218, 0x121A, 0x121C, 0x121E, 0x1220, 0x1222, 0x1224, 0x1226, 0x1228, 0x122A,
+				0x122C, 0x122E, 0x1230, 0x1232, 0x1234, 0x1236, 0x1238, 0x123A, 0x123C, 0x123E, 0x1240, 0x1242, 0x1244, 0x1246, 0x1248, 0x124A,
+				0x124C, 0x124E, 0x1250, 0x1252, 0x1254, 0x1256, 0x1258, 0x125A, 0x125C, 0x125E, 0x1260, 0x1262, 0x1264, 0x1266, 0x1268, 0x126A,
+				0x126C, 0x126E, 0x1270, 0x1272, 0x1274, 0x1276, 0x1278, 0x127A, 0x127C, 0x127E, 0x1280, 0x1282, 0x1284, 0x1286, 0x1288, 0x128A,
+				0x128C, 0x128E, 0x1290, 0x1292, 0x1294, 0x1296, 0x1298, 0x129A, 0x129C, 0x129E, 0x12A0, 0x12A2, 0x12A4, 0x12A6, 0x12A8, 0x12AA,
+				0x12AC, 0x12AE, 0x12B0, 0x12B2, 0x12B4, 0x12B6, 0x12B8, 0x12BA, 0x12BC, 0x12BE, 0x12C0, 0x12C2, 0x12C4, 0x12C6, 0x12C8, 0x12CA,
+				0x12CC, 0x12CE, 0x12D0, 0x12D2, 0x12D4, 0x12D6, 0x12D8, 0x12DA, 0x12DC, 0x12DE, 0x12E0, 0x12E2, 0x12E4, 0x12E6, 0x12E8, 0x12EA,
+				0x12EC, 0x12EE, 0x12F0, 0x12F2, 0x12F4, 0x12F6, 0x12F8, 0x12FA, 0x12FC, 0x12FE, 0x1300, 0x1302, 0x1304, 0x1306, 0x1308, 0x130A,
+				0x130C, 0x130E, 0x1310, 0x1312, 0x1314, 0x1316, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x1318, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x131A, 0x0, 0x131C, 0x131E, 0x1320, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1322, 0x0, 0x1325, 0x0,
+				0x1328, 0x0, 0x132B, 0x0, 0x132E, 0x0, 0x1331, 0x0, 0x1334, 0x0, 0x1337, 0x0, 0x133A, 0x0, 0x133D, 0x0,
+				0x1340, 0x0, 0x1343, 0x0, 0x0, 0x1346, 0x0, 0x1349, 0x0, 0x134C, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x134F, 0x1352, 0x0, 0x1355, 0x1358, 0x0, 0x135B, 0x135E, 0x0, 0x1361, 0x1364, 0x0, 0x1367, 0x136A, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x136D, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1370, 0x1373, 0x0, 0x1376, 0x1379,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x137C, 0x0, 0x137F, 0x0,
+				0x1382, 0x0, 0x1385, 0x0, 0x1388, 0x0, 0x138B, 0x0, 0x138E, 0x0, 0x1391, 0x0, 0x1394, 0x0, 0x1397, 0x0,
+				0x139A, 0x0, 0x139D, 0x0, 0x0, 0x13A0, 0x0, 0x13A3, 0x0, 0x13A6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x13A9, 0x13AC, 0x0, 0x13AF, 0x13B2, 0x0, 0x13B5, 0x13B8, 0x0, 0x13BB, 0x13BE, 0x0, 0x13C1, 0x13C4, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x13C7, 0x0, 0x0, 0x13CA, 0x13CD, 0x13D0, 0x13D3, 0x0, 0x0, 0x0, 0x13D6, 0x13D9,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x13DC, 0x13DE, 0x13E0, 0x13E2, 0x13E4, 0x13E6, 0x13E8, 0x13EA, 0x13EC, 0x13EE, 0x13F0, 0x13F2, 0x13F4, 0x13F6, 0x13F8,
+				0x13FA, 0x13FC, 0x13FE, 0x1400, 0x1402, 0x1404, 0x1406, 0x1408, 0x140A, 0x140C, 0x140E, 0x1410, 0x1412, 0x1414, 0x1416, 0x1418,
+				0x141A, 0x141C, 0x141E, 0x1420, 0x1422, 0x1424, 0x1426, 0x1428, 0x142A, 0x142C, 0x142E, 0x1430, 0x1432, 0x1434, 0x1436, 0x1438,
+				0x143A, 0x143C, 0x143E, 0x1440, 0x1442, 0x1444, 0x1446, 0x1448, 0x144A, 0x144C, 0x144E, 0x1450, 0x1452, 0x1454, 0x1456, 0x1458,
+				0x145A, 0x145C, 0x145E, 0x1460, 0x1462, 0x1464, 0x1466, 0x1468, 0x146A, 0x146C, 0x146E, 0x1470, 0x1472, 0x1474, 0x1476, 0x1478,
+				0x147A, 0x147C, 0x147E, 0x1480, 0x1482, 0x1484, 0x1486, 0x1488, 0x148A, 0x148C, 0x148E, 0x1490, 0x1492, 0x1494, 0x1496, 0x0,
+				0x0, 0x0, 0x1498, 0x149A, 0x149C, 0x149E, 0x14A0, 0x14A2, 0x14A4, 0x14A6, 0x14A8, 0x14AA, 0x14AC, 0x14AE, 0x14B0, 0x14B2,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x14B4, 0x14B8, 0x14BC, 0x14C0, 0x14C4, 0x14C8, 0x14CC, 0x14D0, 0x14D4, 0x14D8, 0x14DC, 0x14E0, 0x14E4, 0x14E8, 0x14EC, 0x14F1,
+				0x14F6, 0x14FB, 0x1500, 0x1505, 0x150A, 0x150F, 0x1514, 0x1519, 0x151E, 0x1523, 0x1528, 0x152D, 0x1532, 0x1537, 0x153F, 0x0,
+				0x1546, 0x154A, 0x154E, 0x1552, 0x1556, 0x155A, 0x155E, 0x1562, 0x1566, 0x156A, 0x156E, 0x1572, 0x1576, 0x157A, 0x157E, 0x1582,
+				0x1586, 0x158A, 0x158E, 0x1592, 0x1596, 0x159A, 0x159E, 0x15A2, 0x15A6, 0x15AA, 0x15AE, 0x15B2, 0x15B6, 0x15BA, 0x15BE, 0x15C2,
+				0x15C6, 0x15CA, 0x15CE, 0x15D2, 0x15D6, 0x15D8, 0x15DA, 0x15DC, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x15DE, 0x15E2, 0x15E5, 0x15E8, 0x15EB, 0x15EE, 0x15F1, 0x15F4, 0x15F7, 0x15FA, 0x15FD, 0x1600, 0x1603, 0x1606, 0x1609, 0x160C,
+				0x160F, 0x1611, 0x1613, 0x1615, 0x1617, 0x1619, 0x161B, 0x161D, 0x161F, 0x1621, 0x1623, 0x1625, 0x1627, 0x1629, 0x162B, 0x162E,
+				0x1631, 0x1634, 0x1637, 0x163A, 0x163D, 0x1640, 0x1643, 0x1646, 0x1649, 0x164C, 0x164F, 0x1652, 0x1655, 0x165B, 0x1660, 0x0,
+				0x1663, 0x1665, 0x1667, 0x1669, 0x166B, 0x166D, 0x166F, 0x1671, 0x1673, 0x1675, 0x1677, 0x1679, 0x167B, 0x167D, 0x167F, 0x1681,
+				0x1683, 0x1685, 0x1687, 0x1689, 0x168B, 0x168D, 0x168F, 0x1691, 0x1693, 0x1695, 0x1697, 0x1699, 0x169B, 0x169D, 0x169F, 0x16A1,
+				0x16A3, 0x16A5, 0x16A7, 0x16A9, 0x16AB, 0x16AD, 0x16AF, 0x16B1, 0x16B3, 0x16B5, 0x16B7, 0x16B9, 0x16BB, 0x16BD, 0x16BF, 0x16C1,
+				0x16C3, 0x16C5, 0x16C8, 0x16CB, 0x16CE, 0x16D1, 0x16D4, 0x16D7, 0x16DA, 0x16DD, 0x16E0, 0x16E3, 0x16E6, 0x16E9, 0x16EC, 0x16EF,
+				0x16F2, 0x16F5, 0x16F8, 0x16FB, 0x16FE, 0x1701, 0x1704, 0x1707, 0x170A, 0x170D, 0x1711, 0x1715, 0x1719, 0x171C, 0x1720, 0x1723,
+				0x1727, 0x1729, 0x172B, 0x172D, 0x172F, 0x1731, 0x1733, 0x1735, 0x1737, 0x1739, 0x173B, 0x173D, 0x173F, 0x1741, 0x1743, 0x1745,
+				0x1747, 0x1749, 0x174B, 0x174D, 0x174F, 0x1751, 0x1753, 0x1755, 0x1757, 0x1759, 0x175B, 0x175D, 0x175F, 0x1761, 0x1763, 0x1765,
+				0x1767, 0x1769, 0x176B, 0x176D, 0x176F, 0x1771, 0x1773, 0x1775, 0x1777, 0x1779, 0x177B, 0x177D, 0x177F, 0x1781, 0x1783, 0x1785,
+				0x1788, 0x178E, 0x1793, 0x1799, 0x179D, 0x17A3, 0x17A7, 0x17AB, 0x17B2, 0x17B7, 0x17BB, 0x17BF, 0x17C3, 0x17C8, 0x17CD, 0x17D2,
+				0x17D7, 0x17DC, 0x17E1, 0x17E6, 0x17ED, 0x17F0, 0x17F7, 0x17FE, 0x1804, 0x1809, 0x1810, 0x1817, 0x181C, 0x1820, 0x1824, 0x1829,
+				0x182E, 0x1834, 0x183A, 0x183E, 0x1842, 0x1847, 0x184B, 0x184F, 0x1852, 0x1855, 0x1859, 0x185D, 0x1864, 0x1869, 0x186F, 0x1876,
+				0x187B, 0x187F, 0x1883, 0x188A, 0x188F, 0x1896, 0x189A, 0x18A0, 0x18A4, 0x18A9, 0x18AD, 0x18B2, 0x18B8, 0x18BD, 0x18C3, 0x18C8,
+				0x18CB, 0x18D1, 0x18D5, 0x18D9, 0x18DE, 0x18E2, 0x18E6, 0x18EA, 0x18F0, 0x18F5, 0x18F8, 0x18FF, 0x1903, 0x1909, 0x190E, 0x1913,
+				0x1917, 0x191B, 0x1920, 0x1923, 0x1928, 0x192E, 0x1931, 0x1938, 0x193C, 0x193F, 0x1942, 0x1945, 0x1948, 0x194B, 0x194E, 0x1951,
+				0x1954, 0x1957, 0x195A, 0x195E, 0x1962, 0x1966, 0x196A, 0x196E, 0x1972, 0x1976, 0x197A, 0x197E, 0x1982, 0x1986, 0x198A, 0x198E,
+				0x1992, 0x1996, 0x199A, 0x199D, 0x19A0, 0x19A4, 0x19A7, 0x19AA, 0x19AD, 0x19B1, 0x19B5, 0x19B8, 0x19BB, 0x19BE, 0x19C1, 0x19C4,
+				0x19C9, 0x19CC, 0x19CF, 0x19D2, 0x19D5, 0x19D8, 0x19DB, 0x19DE, 0x19E1, 0x19E5, 0x19EA, 0x19ED, 0x19F0, 0x19F3, 0x19F6, 0x19F9,
+				0x19FC, 0x19FF, 0x1A03, 0x1A07, 0x1A0B, 0x1A0F, 0x1A12, 0x1A15, 0x1A18, 0x1A1B, 0x1A1E, 0x1A21, 0x1A24, 0x1A27, 0x1A2A, 0x1A2D,
+				0x1A31, 0x1A35, 0x1A38, 0x1A3C, 0x1A40, 0x1A44, 0x1A47, 0x1A4B, 0x1A4F, 0x1A54, 0x1A57, 0x1A5B, 0x1A5F, 0x1A63, 0x1A67, 0x1A6D,
+				0x1A74, 0x1A77, 0x1A7A, 0x1A7D, 0x1A80, 0x1A83, 0x1A86, 0x1A89, 0x1A8C, 0x1A8F, 0x1A92, 0x1A95, 0x1A98, 0x1A9B, 0x1A9E, 0x1AA1,
+				0x1AA4, 0x1AA7, 0x1AAA, 0x1AAF, 0x1AB2, 0x1AB5, 0x1AB8, 0x1ABD, 0x1AC1, 0x1AC4, 0x1AC7, 0x1ACA, 0x1ACD, 0x1AD0, 0x1AD3, 0x1AD6,
+				0x1AD9, 0x1ADC, 0x1ADF, 0x1AE3, 0x1AE6, 0x1AE9, 0x1AED, 0x1AF1, 0x1AF4, 0x1AF9, 0x1AFD, 0x1B00, 0x1B03, 0x1B06, 0x1B09, 0x1B0D,
+				0x1B11, 0x1B14, 0x1B17, 0x1B1A, 0x1B1D, 0x1B20, 0x1B23, 0x1B26, 0x1B29, 0x1B2C, 0x1B30, 0x1B34, 0x1B38, 0x1B3C, 0x1B40, 0x1B44,
+				0x1B48, 0x1B4C, 0x1B50, 0x1B54, 0x1B58, 0x1B5C, 0x1B60, 0x1B64, 0x1B68, 0x1B6C, 0x1B70, 0x1B74, 0x1B78, 0x1B7C, 0x1B80, 0x1B84,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1B88, 0x1B8A, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x1B8C, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x1B8E, 0x1B90, 0x1B92, 0x0, 0x0, 0x0, 0x1B94, 0x1B96, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1B98, 0x1B9A, 0x1B9C, 0x1B9E,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1BA0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x1BA2, 0x1BA4, 0x1BA6, 0x1BA8, 0x1BAA, 0x1BAC, 0x1BAE, 0x1BB0, 0x1BB2, 0x1BB4, 0x1BB6, 0x1BB8, 0x1BBA, 0x1BBC, 0x1BBE, 0x1BC0,
+				0x1BC2, 0x1BC4, 0x1BC6, 0x1BC8, 0x1BCA, 0x1BCC, 0x1BCE, 0x1BD0, 0x1BD2, 0x1BD4, 0x1BD6, 0x1BD8, 0x1BDA, 0x1BDC, 0x1BDE, 0x1BE0,
+				0x1BE2, 0x1BE4, 0x1BE6, 0x1BE8, 0x1BEA, 0x1BEC, 0x1BEE, 0x1BF0, 0x1BF2, 0x1BF4, 0x1BF6, 0x1BF8, 0x1BFA, 0x1BFC, 0x1BFE, 0x1C00,
+				0x1C02, 0x1C04, 0x1C06, 0x1C08, 0x1C0A, 0x1C0C, 0x1C0E, 0x1C10, 0x1C12, 0x1C14, 0x1C16, 0x1C18, 0x1C1A, 0x1C1C, 0x1C1E, 0x1C20,
+				0x1C22, 0x1C24, 0x1C26, 0x1C28, 0x1C2A, 0x1C2C, 0x1C2E, 0x1C30, 0x1C32, 0x1C34, 0x1C36, 0x1C38, 0x1C3A, 0x1C3C, 0x1C3E, 0x1C40,
+				0x1C42, 0x1C44, 0x1C46, 0x1C48, 0x1C4A, 0x1C4C, 0x1C4E, 0x1C50, 0x1C52, 0x1C54, 0x1C56, 0x1C58, 0x1C5A, 0x1C5C, 0x1C5E, 0x1C60,
+				0x1C62, 0x1C64, 0x1C66, 0x1C68, 0x1C6A, 0x1C6C, 0x1C6E, 0x1C70, 0x1C72, 0x1C74, 0x1C76, 0x1C78, 0x1C7A, 0x1C7C, 0x1C7E, 0x1C80,
+				0x1C82, 0x1C84, 0x1C86, 0x1C88, 0x1C8A, 0x1C8C, 0x1C8E, 0x1C90, 0x1C92, 0x1C94, 0x1C96, 0x1C98, 0x1C9A, 0x1C9C, 0x1C9E, 0x1CA0,
+				0x1CA2, 0x1CA4, 0x1CA6, 0x1CA8, 0x1CAA, 0x1CAC, 0x1CAE, 0x1CB0, 0x1CB2, 0x1CB4, 0x1CB6, 0x1CB8, 0x1CBA, 0x1CBC, 0x1CBE, 0x1CC0,
+				0x1CC2, 0x1CC4, 0x1CC6, 0x1CC8, 0x1CCA, 0x1CCC, 0x1CCE, 0x1CD0, 0x1CD2, 0x1CD4, 0x1CD6, 0x1CD8, 0x1CDA, 0x1CDC, 0x1CDE, 0x1CE0,
+				0x1CE2, 0x1CE4, 0x1CE6, 0x1CE8, 0x1CEA, 0x1CEC, 0x1CEE, 0x1CF0, 0x1CF2, 0x1CF4, 0x1CF6, 0x1CF8, 0x1CFA, 0x1CFC, 0x1CFE, 0x1D00,
+				0x1D02, 0x1D04, 0x1D06, 0x1D08, 0x1D0A, 0x1D0C, 0x1D0E, 0x1D10, 0x1D12, 0x1D14, 0x1D16, 0x1D18, 0x1D1A, 0x1D1C, 0x1D1E, 0x1D20,
+				0x1D22, 0x1D24, 0x1D26, 0x1D28, 0x1D2A, 0x1D2C, 0x1D2E, 0x1D30, 0x1D32, 0x1D34, 0x1D36, 0x1D38, 0x1D3A, 0x1D3C, 0x1D3E, 0x1D40,
+				0x1D42, 0x1D44, 0x1D46, 0x1D48, 0x1D4A, 0x1D4C, 0x1D4E, 0x1D50, 0x1D52, 0x1D54, 0x1D56, 0x1D58, 0x1D5A, 0x1D5C, 0x1D5E, 0x1D60,
+				0x1D62, 0x1D64, 0x1D66, 0x1D68, 0x1D6A, 0x1D6C, 0x1D6E, 0x1D70, 0x1D72, 0x1D74, 0x1D76, 0x1D78, 0x1D7A, 0x1D7C, 0x1D7E, 0x1D80,
+				0x1D82, 0x1D84, 0x1D86, 0x1D88, 0x1D8A, 0x1D8C, 0x1D8E, 0x1D90, 0x1D92, 0x1D94, 0x1D96, 0x1D98, 0x1D9A, 0x1D9C, 0x1D9E, 0x1DA0,
+				0x1DA2, 0x1DA4, 0x1DA6, 0x1DA8, 0x1DAA, 0x1DAC, 0x1DAE, 0x1DB0, 0x1DB2, 0x1DB4, 0x1DB6, 0x1DB8, 0x1DBA, 0x1DBC, 0x0, 0x0,
+				0x1DBE, 0x0, 0x1DC0, 0x0, 0x0, 0x1DC2, 0x1DC4, 0x1DC6, 0x1DC8, 0x1DCA, 0x1DCC, 0x1DCE, 0x1DD0, 0x1DD2, 0x1DD4, 0x0,
+				0x1DD6, 0x0, 0x1DD8, 0x0, 0x0, 0x1DDA, 0x1DDC, 0x0, 0x0, 0x0, 0x1DDE, 0x1DE0, 0x1DE2, 0x1DE4, 0x1DE6, 0x1DE8,
+				0x1DEA, 0x1DEC, 0x1DEE, 0x1DF0, 0x1DF2, 0x1DF4, 0x1DF6, 0x1DF8, 0x1DFA, 0x1DFC, 0x1DFE, 0x1E00, 0x1E02, 0x1E04, 0x1E06, 0x1E08,
+				0x1E0A, 0x1E0C, 0x1E0E, 0x1E10, 0x1E12, 0x1E14, 0x1E16, 0x1E18, 0x1E1A, 0x1E1C, 0x1E1E, 0x1E20, 0x1E22, 0x1E24, 0x1E26, 0x1E28,
+				0x1E2A, 0x1E2C, 0x1E2E, 0x1E30, 0x1E32, 0x1E34, 0x1E36, 0x1E38, 0x1E3A, 0x1E3C, 0x1E3E, 0x1E40, 0x1E42, 0x1E44, 0x1E46, 0x1E48,
+				0x1E4A, 0x1E4C, 0x1E4E, 0x1E50, 0x1E52, 0x1E54, 0x1E56, 0x1E58, 0x1E5A, 0x1E5C, 0x1E5E, 0x1E60, 0x1E62, 0x1E65, 0x0, 0x0,
+				0x1E67, 0x1E69, 0x1E6B, 0x1E6D, 0x1E6F, 0x1E71, 0x1E73, 0x1E75, 0x1E77, 0x1E79, 0x1E7B, 0x1E7D, 0x1E7F, 0x1E81, 0x1E83, 0x1E85,
+				0x1E87, 0x1E89, 0x1E8B, 0x1E8D, 0x1E8F, 0x1E91, 0x1E93, 0x1E95, 0x1E97, 0x1E99, 0x1E9B, 0x1E9D, 0x1E9F, 0x1EA1, 0x1EA3, 0x1EA5,
+				0x1EA7, 0x1EA9, 0x1EAB, 0x1EAD, 0x1EAF, 0x1EB1, 0x1EB3, 0x1EB5, 0x1EB7, 0x1EB9, 0x1EBB, 0x1EBD, 0x1EBF, 0x1EC1, 0x1EC3, 0x1EC5,
+				0x1EC7, 0x1EC9, 0x1ECB, 0x1ECD, 0x1ECF, 0x1ED1, 0x1ED3, 0x1ED5, 0x1ED7, 0x1ED9, 0x1EDB, 0x1EDD, 0x1EDF, 0x1EE1, 0x1EE3, 0x1EE5,
+				0x1EE7, 0x1EE9, 0x1EEB, 0x1EED, 0x1EEF, 0x1EF1, 0x1EF3, 0x1EF5, 0x1EF7, 0x1EF9, 0x1EFB, 0x1EFD, 0x1EFF, 0x1F01, 0x1F03, 0x1F05,
+				0x1F07, 0x1F09, 0x1F0B, 0x1F0D, 0x1F0F, 0x1F11, 0x1F13, 0x1F15, 0x1F17, 0x1F19, 0x1F1B, 0x1F1D, 0x1F1F, 0x1F21, 0x1F23, 0x1F25,
+				0x1F28, 0x1F2B, 0x1F2E, 0x1F30, 0x1F32, 0x1F34, 0x1F37, 0x1F3A, 0x1F3D, 0x1F3F, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x1F41, 0x1F44, 0x1F47, 0x1F4A, 0x1F4E, 0x1F52, 0x1F55, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x1F58, 0x1F5B, 0x1F5E, 0x1F61, 0x1F64, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1F67, 0x0, 0x1F6A,
+				0x1F6D, 0x1F6F, 0x1F71, 0x1F73, 0x1F75, 0x1F77, 0x1F79, 0x1F7B, 0x1F7D, 0x1F7F, 0x1F81, 0x1F84, 0x1F87, 0x1F8B, 0x1F8F, 0x1F92,
+				0x1F95, 0x1F98, 0x1F9B, 0x1F9E, 0x1FA1, 0x1FA4, 0x1FA7, 0x0, 0x1FAA, 0x1FAD, 0x1FB0, 0x1FB3, 0x1FB6, 0x0, 0x1FB9, 0x0,
+				0x1FBC, 0x1FBF, 0x0, 0x1FC2, 0x1FC5, 0x0, 0x1FC8, 0x1FCB, 0x1FCE, 0x1FD1, 0x1FD4, 0x1FD7, 0x1FDA, 0x1FDD, 0x1FE0, 0x1FE3,
+				0x1FE6, 0x1FE8, 0x1FEA, 0x1FEC, 0x1FEE, 0x1FF0, 0x1FF2, 0x1FF4, 0x1FF6, 0x1FF8, 0x1FFA, 0x1FFC, 0x1FFE, 0x2000, 0x2002, 0x2004,
+				0x2006, 0x2008, 0x200A, 0x200C, 0x200E, 0x2010, 0x2012, 0x2014, 0x2016, 0x2018, 0x201A, 0x201C, 0x201E, 0x2020, 0x2022, 0x2024,
+				0x2026, 0x2028, 0x202A, 0x202C, 0x202E, 0x2030, 0x2032, 0x2034, 0x2036, 0x2038, 0x203A, 0x203C, 0x203E, 0x2040, 0x2042, 0x2044,
+				0x2046, 0x2048, 0x204A, 0x204C, 0x204E, 0x2050, 0x2052, 0x2054, 0x2056, 0x2058, 0x205A, 0x205C, 0x205E, 0x2060, 0x2062, 0x2064,
+				0x2066, 0x2068, 0x206A, 0x206C, 0x206E, 0x2070, 0x2072, 0x2074, 0x2076, 0x2078, 0x207A, 0x207C, 0x207E, 0x2080, 0x2082, 0x2084,
+				0x2086, 0x2088, 0x208A, 0x208C, 0x208E, 0x2091, 0x2094, 0x2096, 0x2098, 0x209A, 0x209C, 0x209E, 0x20A0, 0x20A2, 0x20A4, 0x20A6,
+				0x20A8, 0x20AB, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x20AE, 0x20B0, 0x20B2, 0x20B4, 0x20B6, 0x20B8, 0x20BA, 0x20BC, 0x20BE, 0x20C0, 0x20C2, 0x20C5, 0x20C7,
+				0x20C9, 0x20CB, 0x20CD, 0x20CF, 0x20D1, 0x20D3, 0x20D5, 0x20D7, 0x20D9, 0x20DB, 0x20DD, 0x20E1, 0x20E5, 0x20E9, 0x20ED, 0x20F1,
+				0x20F5, 0x20F9, 0x20FD, 0x2101, 0x2105, 0x2109, 0x210D, 0x2111, 0x2115, 0x2119, 0x211D, 0x2121, 0x2125, 0x2127, 0x2129, 0x212B,
+				0x212D, 0x2131, 0x2135, 0x2139, 0x213D, 0x2141, 0x2144, 0x2147, 0x214A, 0x214D, 0x2150, 0x2153, 0x2156, 0x2159, 0x215C, 0x215F,
+				0x2162, 0x2165, 0x2168, 0x216B, 0x216E, 0x2171, 0x2174, 0x2177, 0x217A, 0x217D, 0x2180, 0x2183, 0x2186, 0x2189, 0x218C, 0x218F,
+				0x2192, 0x2195, 0x2198, 0x219B, 0x219E, 0x21A1, 0x21A4, 0x21A7, 0x21AA, 0x21AD, 0x21B0, 0x21B3, 0x21B6, 0x21B9, 0x21BC, 0x21BF,
+				0x21C2, 0x21C5, 0x21C8, 0x21CB, 0x21CE, 0x21D1, 0x21D4, 0x21D7, 0x21DA, 0x21DD, 0x21E0, 0x21E3, 0x21E6, 0x21E9, 0x21EC, 0x21EF,
+				0x21F2, 0x21F5, 0x21F8, 0x21FB, 0x21FE, 0x2201, 0x2204, 0x2207, 0x220A, 0x220D, 0x2210, 0x2213, 0x2216, 0x2219, 0x221C, 0x221F,
+				0x2222, 0x2225, 0x2228, 0x222B, 0x222E, 0x2231, 0x2234, 0x2237, 0x223A, 0x223D, 0x2240, 0x2243, 0x2246, 0x2249, 0x224C, 0x2250,
+				0x2254, 0x2258, 0x225C, 0x2260, 0x2264, 0x2268, 0x226C, 0x2270, 0x2274, 0x2278, 0x227C, 0x227F, 0x2282, 0x2285, 0x2288, 0x228B,
+				0x228E, 0x2291, 0x2294, 0x2297, 0x229A, 0x229D, 0x22A0, 0x22A3, 0x22A6, 0x22A9, 0x22AC, 0x22AF, 0x22B2, 0x22B5, 0x22B8, 0x22BB,
+				0x22BE, 0x22C1, 0x22C4, 0x22C7, 0x22CA, 0x22CD, 0x22D0, 0x22D3, 0x22D6, 0x22D9, 0x22DC, 0x22DF, 0x22E2, 0x22E5, 0x22E8, 0x22EB,
+				0x22EE, 0x22F1, 0x22F4, 0x22F7, 0x22FA, 0x22FD, 0x2300, 0x2303, 0x2307, 0x230B, 0x230F, 0x2313, 0x2317, 0x231A, 0x231D, 0x2320,
+				0x2323, 0x2326, 0x2329, 0x232C, 0x232F, 0x2332, 0x2335, 0x2338, 0x233B, 0x233E, 0x2341, 0x2344, 0x2347, 0x234A, 0x234D, 0x2350,
+				0x2353, 0x2356, 0x2359, 0x235C, 0x235F, 0x2362, 0x2365, 0x2368, 0x236B, 0x236E, 0x2371, 0x2374, 0x2377, 0x237A, 0x237D, 0x2380,
+				0x2383, 0x2386, 0x2389, 0x238C, 0x238F, 0x2392, 0x2395, 0x2398, 0x239B, 0x239E, 0x23A1, 0x23A4, 0x23A7, 0x23AA, 0x23AD, 0x23B0,
+				0x23B3, 0x23B6, 0x23B9, 0x23BC, 0x23BF, 0x23C2, 0x23C5, 0x23C8, 0x23CB, 0x23CE, 0x23D1, 0x23D4, 0x23D7, 0x23DA, 0x23DD, 0x23E0,
+				0x23E4, 0x23E8, 0x23EB, 0x23EE, 0x23F1, 0x23F4, 0x23F7, 0x23FA, 0x23FD, 0x2400, 0x2403, 0x2406, 0x2409, 0x240C, 0x240F, 0x2412,
+				0x2415, 0x2418, 0x241B, 0x241F, 0x2423, 0x2427, 0x242A, 0x242D, 0x2430, 0x2433, 0x2436, 0x2439, 0x243C, 0x243F, 0x2442, 0x2445,
+				0x2448, 0x244B, 0x244E, 0x2451, 0x2454, 0x2457, 0x245A, 0x245D, 0x2460, 0x2463, 0x2466, 0x2469, 0x246C, 0x246F, 0x2472, 0x2475,
+				0x2478, 0x247B, 0x247E, 0x2481, 0x2484, 0x2487, 0x248A, 0x248D, 0x2490, 0x2493, 0x2496, 0x2499, 0x249C, 0x249F, 0x24A2, 0x24A5,
+				0x24A8, 0x24AB, 0x24AE, 0x24B1, 0x24B4, 0x24B7, 0x24BA, 0x24BD, 0x24C0, 0x24C3, 0x24C6, 0x24C9, 0x24CC, 0x24CF, 0x24D2, 0x24D5,
+				0x24D8, 0x24DB, 0x24DE, 0x24E1, 0x24E4, 0x24E7, 0x24EA, 0x24ED, 0x24F0, 0x24F3, 0x24F6, 0x24F9, 0x24FC, 0x24FF, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x2502, 0x2506, 0x250A, 0x250E, 0x2512, 0x2516, 0x251A, 0x251E, 0x2522, 0x2526, 0x252A, 0x252E, 0x2532, 0x2536, 0x253A, 0x253E,
+				0x2542, 0x2546, 0x254A, 0x254E, 0x2552, 0x2556, 0x255A, 0x255E, 0x2562, 0x2566, 0x256A, 0x256E, 0x2572, 0x2576, 0x257A, 0x257E,
+				0x2582, 0x2586, 0x258A, 0x258E, 0x2592, 0x2596, 0x259A, 0x259E, 0x25A2, 0x25A6, 0x25AA, 0x25AE, 0x25B2, 0x25B6, 0x25BA, 0x25BE,
+				0x25C2, 0x25C6, 0x25CA, 0x25CE, 0x25D2, 0x25D6, 0x25DA, 0x25DE, 0x25E2, 0x25E6, 0x25EA, 0x25EE, 0x25F2, 0x25F6, 0x25FA, 0x25FE,
+				0x0, 0x0, 0x2602, 0x2606, 0x260A, 0x260E, 0x2612, 0x2616, 0x261A, 0x261E, 0x2622, 0x2626, 0x262A, 0x262E, 0x2632, 0x2636,
+				0x263A, 0x263E, 0x2642, 0x2646, 0x264A, 0x264E, 0x2652, 0x2656, 0x265A, 0x265E, 0x2662, 0x2666, 0x266A, 0x266E, 0x2672, 0x2676,
+				0x267A, 0x267E, 0x2682, 0x2686, 0x268A, 0x268E, 0x2692, 0x2696, 0x269A, 0x269E, 0x26A2, 0x26A6, 0x26AA, 0x26AE, 0x26B2, 0x26B6,
+				0x26BA, 0x26BE, 0x26C2, 0x26C6, 0x26CA, 0x26CE, 0x26D2, 0x26D6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x26DA, 0x26DE, 0x26E2, 0x26E7, 0x26EC, 0x26F1, 0x26F6, 0x26FB, 0x2700, 0x2705, 0x2709, 0x271C, 0x2725, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x272A, 0x272C, 0x272E, 0x2730, 0x2732, 0x2734, 0x2736, 0x2738, 0x273A, 0x273C, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x2740, 0x2743, 0x2745, 0x2747, 0x2749, 0x274B, 0x274D, 0x274F, 0x2751, 0x2753, 0x2755, 0x2757, 0x2759, 0x275B, 0x275D, 0x275F,
+				0x2761, 0x2763, 0x2765, 0x2767, 0x2769, 0x0, 0x0, 0x276B, 0x276D, 0x276F, 0x2772, 0x2775, 0x2778, 0x277B, 0x277D, 0x277F,
+				0x2781, 0x2783, 0x2785, 0x0, 0x2787, 0x2789, 0x278B, 0x278D, 0x278F, 0x2791, 0x2793, 0x2795, 0x2797, 0x2799, 0x279B, 0x279D,
+				0x279F, 0x27A1, 0x27A3, 0x27A5, 0x27A7, 0x27A9, 0x27AB, 0x0, 0x27AD, 0x27AF, 0x27B1, 0x27B3, 0x0, 0x0, 0x0, 0x0,
+				0x27B5, 0x27B8, 0x27BB, 0x0, 0x27BE, 0x0, 0x27C1, 0x27C4, 0x27C7, 0x27CA, 0x27CD, 0x27D0, 0x27D3, 0x27D6, 0x27D9, 0x27DC,
+				0x27DF, 0x27E1, 0x27E4, 0x27E7, 0x27EA, 0x27ED, 0x27F0, 0x27F3, 0x27F6, 0x27F9, 0x27FC, 0x27FF, 0x2802, 0x2805, 0x2807, 0x2809,
+				0x280B, 0x280D, 0x280F, 0x2811, 0x2813, 0x2815, 0x2817, 0x2819, 0x281B, 0x281D, 0x281F, 0x2821, 0x2823, 0x2825, 0x2827, 0x2829,
+				0x282B, 0x282D, 0x282F, 0x2831, 0x2833, 0x2835, 0x2837, 0x2839, 0x283B, 0x283D, 0x283F, 0x2841, 0x2843, 0x2845, 0x2847, 0x2849,
+				0x284B, 0x284D, 0x284F, 0x2851, 0x2853, 0x2855, 0x2857, 0x2859, 0x285B, 0x285D, 0x285F, 0x2861, 0x2863, 0x2865, 0x2867, 0x2869,
+				0x286B, 0x286D, 0x286F, 0x2871, 0x2873, 0x2875, 0x2877, 0x2879, 0x287B, 0x287D, 0x287F, 0x2881, 0x2883, 0x2885, 0x2887, 0x2889,
+				0x288B, 0x288D, 0x288F, 0x2891, 0x2893, 0x2895, 0x2897, 0x2899, 0x289B, 0x289D, 0x289F, 0x28A1, 0x28A3, 0x28A5, 0x28A7, 0x28A9,
+				0x28AB, 0x28AD, 0x28AF, 0x28B1, 0x28B3, 0x28B5, 0x28B7, 0x28B9, 0x28BB, 0x28BD, 0x28BF, 0x28C1, 0x28C3, 0x28C5, 0x28C7, 0x28C9,
+				0x28CB, 0x28CD, 0x28CF, 0x28D1, 0x28D3, 0x28D5, 0x28D9, 0x28DD, 0x28E1, 0x28E5, 0x28E9, 0x28ED, 0x28F0, 0x0, 0x0, 0x0,
+				0x0, 0x28F3, 0x28F5, 0x28F7, 0x28F9, 0x28FB, 0x28FD, 0x28FF, 0x2901, 0x2903, 0x2905, 0x2907, 0x2909, 0x290B, 0x290D, 0x290F,
+				0x2911, 0x2913, 0x2915, 0x2917, 0x2919, 0x291B, 0x291D, 0x291F, 0x2921, 0x2923, 0x2925, 0x2927, 0x2929, 0x292B, 0x292D, 0x292F,
+				0x2931, 0x2933, 0x2935, 0x2937, 0x2939, 0x293B, 0x293D, 0x293F, 0x2941, 0x2943, 0x2945, 0x2947, 0x2949, 0x294B, 0x294D, 0x294F,
+				0x2951, 0x2953, 0x2955, 0x2957, 0x2959, 0x295B, 0x295D, 0x295F, 0x2961, 0x2963, 0x2965, 0x2967, 0x2969, 0x296B, 0x296D, 0x296F,
+				0x2971, 0x2973, 0x2975, 0x2977, 0x2979, 0x297B, 0x297D, 0x297F, 0x2981, 0x2983, 0x2985, 0x2987, 0x2989, 0x298B, 0x298D, 0x298F,
+				0x2991, 0x2993, 0x2995, 0x2997, 0x2999, 0x299B, 0x299D, 0x299F, 0x29A1, 0x29A3, 0x29A5, 0x29A7, 0x29A9, 0x29AB, 0x29AD, 0x29AF,
+				0x29B1, 0x29B3, 0x29B5, 0x29B7, 0x29B9, 0x29BB, 0x29BD, 0x29BF, 0x29C1, 0x29C3, 0x29C5, 0x29C7, 0x29C9, 0x29CB, 0x29CD, 0x29CF,
+				0x29D1, 0x29D3, 0x29D5, 0x29D7, 0x29D9, 0x29DB, 0x29DD, 0x29DF, 0x29E1, 0x29E3, 0x29E5, 0x29E7, 0x29E9, 0x29EB, 0x29ED, 0x29EF,
+				0x29F1, 0x29F3, 0x29F5, 0x29F7, 0x29F9, 0x29FB, 0x29FD, 0x29FF, 0x2A01, 0x2A03, 0x2A05, 0x2A07, 0x2A09, 0x2A0B, 0x2A0D, 0x2A0F,
+				0x2A11, 0x2A13, 0x2A15, 0x2A17, 0x2A19, 0x2A1B, 0x2A1D, 0x2A1F, 0x2A21, 0x2A23, 0x2A25, 0x2A27, 0x2A29, 0x2A2B, 0x2A2D, 0x2A2F,
+				0x2A31, 0x2A33, 0x2A35, 0x2A37, 0x2A39, 0x2A3B, 0x2A3D, 0x2A3F, 0x2A41, 0x2A43, 0x2A45, 0x2A47, 0x2A49, 0x2A4B, 0x2A4D, 0x2A4F,
+				0x2A51, 0x2A53, 0x2A55, 0x2A57, 0x2A59, 0x2A5B, 0x2A5D, 0x2A5F, 0x2A61, 0x2A63, 0x2A65, 0x2A67, 0x2A69, 0x2A6B, 0x2A6D, 0x0,
+				0x0, 0x0, 0x2A6F, 0x2A71, 0x2A73, 0x2A75, 0x2A77, 0x2A79, 0x0, 0x0, 0x2A7B, 0x2A7D, 0x2A7F, 0x2A81, 0x2A83, 0x2A85,
+				0x0, 0x0, 0x2A87, 0x2A89, 0x2A8B, 0x2A8D, 0x2A8F, 0x2A91, 0x0, 0x0, 0x2A93, 0x2A95, 0x2A97, 0x0, 0x0, 0x0,
+				0x2A99, 0x2A9B, 0x2A9D, 0x2A9F, 0x2AA2, 0x2AA4, 0x2AA6, 0x0, 0x2AA8, 0x2AAA, 0x2AAC, 0x2AAE, 0x2AB0, 0x2AB2, 0x2AB4, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x2AB6, 0x2AB8, 0x2ABA, 0x2ABC, 0x2ABE, 0x0, 0x2AC0, 0x2AC2, 0x2AC4, 0x2AC6, 0x2AC8, 0x2ACA, 0x2ACC, 0x2ACE, 0x2AD0,
+				0x2AD2, 0x2AD4, 0x2AD6, 0x2AD8, 0x2ADA, 0x2ADC, 0x2ADE, 0x2AE0, 0x2AE2, 0x2AE4, 0x2AE6, 0x2AE8, 0x2AEA, 0x2AED, 0x2AEF, 0x2AF1,
+				0x2AF4, 0x2AF6, 0x2AF9, 0x2AFB, 0x2AFD, 0x2AFF, 0x2B01, 0x2B03, 0x2B06, 0x2B08, 0x2B0A, 0x2B0C, 0x2B0E, 0x2B10, 0x2B12, 0x2B14,
+				0x2B16, 0x0, 0x2B18, 0x2B1A, 0x2B1C, 0x2B1E, 0x2B20, 0x2B22, 0x2B24, 0x2B26, 0x2B29, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2B2C, 0x0, 0x2B31, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2B36, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2B3B, 0x2B40,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2B45, 0x2B4A, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2B4F, 0x2B54, 0x0, 0x2B59, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2B5E, 0x2B63, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2B68, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2B6D, 0x2B72,
+				0x2B77, 0x2B7E, 0x2B85, 0x2B8C, 0x2B93, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2B9A, 0x2B9F, 0x2BA4, 0x2BAB, 0x2BB2,
+				0x2BB9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x2BC0, 0x2BC2, 0x2BC4, 0x2BC6, 0x2BC8, 0x2BCA, 0x2BCC, 0x2BCE, 0x2BD0, 0x2BD2, 0x2BD4, 0x2BD6, 0x2BD8, 0x2BDA, 0x2BDC, 0x2BDE,
+				0x2BE0, 0x2BE2, 0x2BE4, 0x2BE6, 0x2BE8, 0x2BEA, 0x2BEC, 0x2BEE, 0x2BF0, 0x2BF2, 0x2BF4, 0x2BF6, 0x2BF8, 0x2BFA, 0x2BFC, 0x2BFE,
+				0x2C00, 0x2C02, 0x2C04, 0x2C06, 0x2C08, 0x2C0A, 0x2C0C, 0x2C0E, 0x2C10, 0x2C12, 0x2C14, 0x2C16, 0x2C18, 0x2C1A, 0x2C1C, 0x2C1E,
+				0x2C20, 0x2C22, 0x2C24, 0x2C26, 0x2C28, 0x2C2A, 0x2C2C, 0x2C2E, 0x2C30, 0x2C32, 0x2C34, 0x2C36, 0x2C38, 0x2C3A, 0x2C3C, 0x2C3E,
+				0x2C40, 0x2C42, 0x2C44, 0x2C46, 0x2C48, 0x2C4A, 0x2C4C, 0x2C4E, 0x2C50, 0x2C52, 0x2C54, 0x2C56, 0x2C58, 0x2C5A, 0x2C5C, 0x2C5E,
+				0x2C60, 0x2C62, 0x2C64, 0x2C66, 0x2C68, 0x0, 0x2C6A, 0x2C6C, 0x2C6E, 0x2C70, 0x2C72, 0x2C74, 0x2C76, 0x2C78, 0x2C7A, 0x2C7C,
+				0x2C7E, 0x2C80, 0x2C82, 0x2C84, 0x2C86, 0x2C88, 0x2C8A, 0x2C8C, 0x2C8E, 0x2C90, 0x2C92, 0x2C94, 0x2C96, 0x2C98, 0x2C9A, 0x2C9C,
+				0x2C9E, 0x2CA0, 0x2CA2, 0x2CA4, 0x2CA6, 0x2CA8, 0x2CAA, 0x2CAC, 0x2CAE, 0x2CB0, 0x2CB2, 0x2CB4, 0x2CB6, 0x2CB8, 0x2CBA, 0x2CBC,
+				0x2CBE, 0x2CC0, 0x2CC2, 0x2CC4, 0x2CC6, 0x2CC8, 0x2CCA, 0x2CCC, 0x2CCE, 0x2CD0, 0x2CD2, 0x2CD4, 0x2CD6, 0x2CD8, 0x2CDA, 0x2CDC,
+				0x2CDE, 0x2CE0, 0x2CE2, 0x2CE4, 0x2CE6, 0x2CE8, 0x2CEA, 0x2CEC, 0x2CEE, 0x2CF0, 0x2CF2, 0x2CF4, 0x2CF6, 0x0, 0x2CF8, 0x2CFA,
+				0x0, 0x0, 0x2CFC, 0x0, 0x0, 0x2CFE, 0x2D00, 0x0, 0x0, 0x2D02, 0x2D04, 0x2D06, 0x2D08, 0x0, 0x2D0A, 0x2D0C,
+				0x2D0E, 0x2D10, 0x2D12, 0x2D14, 0x2D16, 0x2D18, 0x2D1A, 0x2D1C, 0x2D1E, 0x2D20, 0x0, 0x2D22, 0x0, 0x2D24, 0x2D26, 0x2D28,
+				0x2D2A, 0x2D2C, 0x2D2E, 0x2D30, 0x0, 0x2D32, 0x2D34, 0x2D36, 0x2D38, 0x2D3A, 0x2D3C, 0x2D3E, 0x2D40, 0x2D42, 0x2D44, 0x2D46,
+				0x2D48, 0x2D4A, 0x2D4C, 0x2D4E, 0x2D50, 0x2D52, 0x2D54, 0x2D56, 0x2D58, 0x2D5A, 0x2D5C, 0x2D5E, 0x2D60, 0x2D62, 0x2D64, 0x2D66,
+				0x2D68, 0x2D6A, 0x2D6C, 0x2D6E, 0x2D70, 0x2D72, 0x2D74, 0x2D76, 0x2D78, 0x2D7A, 0x2D7C, 0x2D7E, 0x2D80, 0x2D82, 0x2D84, 0x2D86,
+				0x2D88, 0x2D8A, 0x2D8C, 0x2D8E, 0x2D90, 0x2D92, 0x2D94, 0x2D96, 0x2D98, 0x2D9A, 0x2D9C, 0x2D9E, 0x2DA0, 0x2DA2, 0x2DA4, 0x2DA6,
+				0x2DA8, 0x2DAA, 0x2DAC, 0x2DAE, 0x2DB0, 0x2DB2, 0x0, 0x2DB4, 0x2DB6, 0x2DB8, 0x2DBA, 0x0, 0x0, 0x2DBC, 0x2DBE, 0x2DC0,
+				0x2DC2, 0x2DC4, 0x2DC6, 0x2DC8, 0x2DCA, 0x0, 0x2DCC, 0x2DCE, 0x2DD0, 0x2DD2, 0x2DD4, 0x2DD6, 0x2DD8, 0x0, 0x2DDA, 0x2DDC,
+				0x2DDE, 0x2DE0, 0x2DE2, 0x2DE4, 0x2DE6, 0x2DE8, 0x2DEA, 0x2DEC, 0x2DEE, 0x2DF0, 0x2DF2, 0x2DF4, 0x2DF6, 0x2DF8, 0x2DFA, 0x2DFC,
+				0x2DFE, 0x2E00, 0x2E02, 0x2E04, 0x2E06, 0x2E08, 0x2E0A, 0x2E0C, 0x2E0E, 0x2E10, 0x0, 0x2E12, 0x2E14, 0x2E16, 0x2E18, 0x0,
+				0x2E1A, 0x2E1C, 0x2E1E, 0x2E20, 0x2E22, 0x0, 0x2E24, 0x0, 0x0, 0x0, 0x2E26, 0x2E28, 0x2E2A, 0x2E2C, 0x2E2E, 0x2E30,
+				0x2E32, 0x0, 0x2E34, 0x2E36, 0x2E38, 0x2E3A, 0x2E3C, 0x2E3E, 0x2E40, 0x2E42, 0x2E44, 0x2E46, 0x2E48, 0x2E4A, 0x2E4C, 0x2E4E,
+				0x2E50, 0x2E52, 0x2E54, 0x2E56, 0x2E58, 0x2E5A, 0x2E5C, 0x2E5E, 0x2E60, 0x2E62, 0x2E64, 0x2E66, 0x2E68, 0x2E6A, 0x2E6C, 0x2E6E,
+				0x2E70, 0x2E72, 0x2E74, 0x2E76, 0x2E78, 0x2E7A, 0x2E7C, 0x2E7E, 0x2E80, 0x2E82, 0x2E84, 0x2E86, 0x2E88, 0x2E8A, 0x2E8C, 0x2E8E,
+				0x2E90, 0x2E92, 0x2E94, 0x2E96, 0x2E98, 0x2E9A, 0x2E9C, 0x2E9E, 0x2EA0, 0x2EA2, 0x2EA4, 0x2EA6, 0x2EA8, 0x2EAA, 0x2EAC, 0x2EAE,
+				0x2EB0, 0x2EB2, 0x2EB4, 0x2EB6, 0x2EB8, 0x2EBA, 0x2EBC, 0x2EBE, 0x2EC0, 0x2EC2, 0x2EC4, 0x2EC6, 0x2EC8, 0x2ECA, 0x2ECC, 0x2ECE,
+				0x2ED0, 0x2ED2, 0x2ED4, 0x2ED6, 0x2ED8, 0x2EDA, 0x2EDC, 0x2EDE, 0x2EE0, 0x2EE2, 0x2EE4, 0x2EE6, 0x2EE8, 0x2EEA, 0x2EEC, 0x2EEE,
+				0x2EF0, 0x2EF2, 0x2EF4, 0x2EF6, 0x2EF8, 0x2EFA, 0x2EFC, 0x2EFE, 0x2F00, 0x2F02, 0x2F04, 0x2F06, 0x2F08, 0x2F0A, 0x2F0C, 0x2F0E,
+				0x2F10, 0x2F12, 0x2F14, 0x2F16, 0x2F18, 0x2F1A, 0x2F1C, 0x2F1E, 0x2F20, 0x2F22, 0x2F24, 0x2F26, 0x2F28, 0x2F2A, 0x2F2C, 0x2F2E,
+				0x2F30, 0x2F32, 0x2F34, 0x2F36, 0x2F38, 0x2F3A, 0x2F3C, 0x2F3E, 0x2F40, 0x2F42, 0x2F44, 0x2F46, 0x2F48, 0x2F4A, 0x2F4C, 0x2F4E,
+				0x2F50, 0x2F52, 0x2F54, 0x2F56, 0x2F58, 0x2F5A, 0x2F5C, 0x2F5E, 0x2F60, 0x2F62, 0x2F64, 0x2F66, 0x2F68, 0x2F6A, 0x2F6C, 0x2F6E,
+				0x2F70, 0x2F72, 0x2F74, 0x2F76, 0x2F78, 0x2F7A, 0x2F7C, 0x2F7E, 0x2F80, 0x2F82, 0x2F84, 0x2F86, 0x2F88, 0x2F8A, 0x2F8C, 0x2F8E,
+				0x2F90, 0x2F92, 0x2F94, 0x2F96, 0x2F98, 0x2F9A, 0x2F9C, 0x2F9E, 0x2FA0, 0x2FA2, 0x2FA4, 0x2FA6, 0x2FA8, 0x2FAA, 0x2FAC, 0x2FAE,
+				0x2FB0, 0x2FB2, 0x2FB4, 0x2FB6, 0x2FB8, 0x2FBA, 0x2FBC, 0x2FBE, 0x2FC0, 0x2FC2, 0x2FC4, 0x2FC6, 0x2FC8, 0x2FCA, 0x2FCC, 0x2FCE,
+				0x2FD0, 0x2FD2, 0x2FD4, 0x2FD6, 0x2FD8, 0x2FDA, 0x2FDC, 0x2FDE, 0x2FE0, 0x2FE2, 0x2FE4, 0x2FE6, 0x2FE8, 0x2FEA, 0x2FEC, 0x2FEE,
+				0x2FF0, 0x2FF2, 0x2FF4, 0x2FF6, 0x2FF8, 0x2FFA, 0x2FFC, 0x2FFE, 0x3000, 0x3002, 0x3004, 0x3006, 0x3008, 0x300A, 0x300C, 0x300E,
+				0x3010, 0x3012, 0x3014, 0x3016, 0x3018, 0x301A, 0x301C, 0x301E, 0x3020, 0x3022, 0x3024, 0x3026, 0x3028, 0x302A, 0x302C, 0x302E,
+				0x3030, 0x3032, 0x3034, 0x3036, 0x3038, 0x303A, 0x303C, 0x303E, 0x3040, 0x3042, 0x3044, 0x3046, 0x3048, 0x304A, 0x304C, 0x304E,
+				0x3050, 0x3052, 0x3054, 0x3056, 0x3058, 0x305A, 0x305C, 0x305E, 0x3060, 0x3062, 0x3064, 0x3066, 0x3068, 0x306A, 0x306C, 0x306E,
+				0x3070, 0x3072, 0x3074, 0x3076, 0x3078, 0x307A, 0x307C, 0x307E, 0x3080, 0x3082, 0x3084, 0x3086, 0x3088, 0x308A, 0x308C, 0x308E,
+				0x3090, 0x3092, 0x3094, 0x3096, 0x3098, 0x309A, 0x309C, 0x309E, 0x30A0, 0x30A2, 0x30A4, 0x30A6, 0x30A8, 0x30AA, 0x30AC, 0x30AE,
+				0x30B0, 0x30B2, 0x30B4, 0x30B6, 0x30B8, 0x30BA, 0x30BC, 0x30BE, 0x30C0, 0x30C2, 0x30C4, 0x30C6, 0x30C8, 0x30CA, 0x30CC, 0x30CE,
+				0x30D0, 0x30D2, 0x30D4, 0x30D6, 0x30D8, 0x30DA, 0x0, 0x0, 0x30DC, 0x30DE, 0x30E0, 0x30E2, 0x30E4, 0x30E6, 0x30E8, 0x30EA,
+				0x30EC, 0x30EE, 0x30F0, 0x30F2, 0x30F4, 0x30F6, 0x30F8, 0x30FA, 0x30FC, 0x30FE, 0x3100, 0x3102, 0x3104, 0x3106, 0x3108, 0x310A,
+				0x310C, 0x310E, 0x3110, 0x3112, 0x3114, 0x3116, 0x3118, 0x311A, 0x311C, 0x311E, 0x3120, 0x3122, 0x3124, 0x3126, 0x3128, 0x312A,
+				0x312C, 0x312E, 0x3130, 0x3132, 0x3134, 0x3136, 0x3138, 0x313A, 0x313C, 0x313E, 0x3140, 0x3142, 0x3144, 0x3146, 0x3148, 0x314A,
+				0x314C, 0x314E, 0x3150, 0x3152, 0x3154, 0x3156, 0x3158, 0x315A, 0x315C, 0x315E, 0x3160, 0x3162, 0x3164, 0x3166, 0x3168, 0x316A,
+				0x316C, 0x316E, 0x3170, 0x3172, 0x3174, 0x3176, 0x3178, 0x317A, 0x317C, 0x317E, 0x3180, 0x3182, 0x3184, 0x3186, 0x3188, 0x318A,
+				0x318C, 0x318E, 0x3190, 0x3192, 0x3194, 0x3196, 0x3198, 0x319A, 0x319C, 0x319E, 0x31A0, 0x31A2, 0x31A4, 0x31A6, 0x31A8, 0x31AA,
+				0x31AC, 0x31AE, 0x31B0, 0x31B2, 0x31B4, 0x31B6, 0x31B8, 0x31BA, 0x31BC, 0x31BE, 0x31C0, 0x31C2, 0x31C4, 0x31C6, 0x31C8, 0x31CA,
+				0x31CC, 0x31CE, 0x31D0, 0x31D2, 0x31D4, 0x31D6, 0x31D8, 0x31DA, 0x31DC, 0x31DE, 0x31E0, 0x31E2, 0x31E4, 0x31E6, 0x31E8, 0x31EA,
+				0x31EC, 0x31EE, 0x31F0, 0x31F2, 0x31F4, 0x31F6, 0x31F8, 0x31FA, 0x31FC, 0x31FE, 0x3200, 0x3202, 0x3204, 0x3206, 0x3208, 0x320A,
+				0x320C, 0x320E, 0x3210, 0x3212, 0x3214, 0x3216, 0x3218, 0x321A, 0x321C, 0x321E, 0x3220, 0x3222, 0x3224, 0x3226, 0x3228, 0x322A,
+				0x322C, 0x322E, 0x3230, 0x3232, 0x3234, 0x3236, 0x3238, 0x323A, 0x323C, 0x323E, 0x3240, 0x3242, 0x3244, 0x3246, 0x3248, 0x324A,
+				0x324C, 0x324E, 0x3250, 0x3252, 0x3254, 0x3256, 0x3258, 0x325A, 0x325C, 0x325E, 0x3260, 0x3262, 0x3264, 0x3266, 0x3268, 0x326A,
+				0x326C, 0x326E, 0x3270, 0x3272, 0x3274, 0x3276, 0x3278, 0x327A, 0x327C, 0x327E, 0x3280, 0x3282, 0x3284, 0x3286, 0x3288, 0x328A,
+				0x328C, 0x328E, 0x3290, 0x3292, 0x3294, 0x3296, 0x3298, 0x329A, 0x329C, 0x329E, 0x32A0, 0x32A2, 0x32A4, 0x32A6, 0x32A8, 0x32AA,
+				0x32AC, 0x32AE, 0x32B0, 0x32B2, 0x32B4, 0x32B6, 0x32B8, 0x32BA, 0x32BC, 0x32BE, 0x32C0, 0x32C2, 0x32C4, 0x32C6, 0x32C8, 0x32CA,
+				0x32CC, 0x32CE, 0x32D0, 0x32D2, 0x32D4, 0x32D6, 0x32D8, 0x32DA, 0x32DC, 0x32DE, 0x32E0, 0x32E2, 0x32E4, 0x32E6, 0x32E8, 0x32EA,
+				0x32EC, 0x32EE, 0x32F0, 0x32F2, 0x32F4, 0x32F6, 0x32F8, 0x32FA, 0x32FC, 0x32FE, 0x3300, 0x3302, 0x3304, 0x3306, 0x3308, 0x330A,
+				0x330C, 0x330E, 0x3310, 0x3312, 0x3314, 0x3316, 0x3318, 0x331A, 0x331C, 0x331E, 0x3320, 0x3322, 0x0, 0x0, 0x3324, 0x3326,
+				0x3328, 0x332A, 0x332C, 0x332E, 0x3330, 0x3332, 0x3334, 0x3336, 0x3338, 0x333A, 0x333C, 0x333E, 0x3340, 0x3342, 0x3344, 0x3346,
+				0x3348, 0x334A, 0x334C, 0x334E, 0x3350, 0x3352, 0x3354, 0x3356, 0x3358, 0x335A, 0x335C, 0x335E, 0x3360, 0x3362, 0x3364, 0x3366,
+				0x3368, 0x336A, 0x336C, 0x336E, 0x3370, 0x3372, 0x3374, 0x3376, 0x3378, 0x337A, 0x337C, 0x337E, 0x3380, 0x3382, 0x3384, 0x3386,
+				0x3388, 0x338A, 0x338C, 0x338E, 0x0, 0x3390, 0x3392, 0x3394, 0x3396, 0x3398, 0x339A, 0x339C, 0x339E, 0x33A0, 0x33A2, 0x33A4,
+				0x33A6, 0x33A8, 0x33AA, 0x33AC, 0x33AE, 0x33B0, 0x33B2, 0x33B4, 0x33B6, 0x33B8, 0x33BA, 0x33BC, 0x33BE, 0x33C0, 0x33C2, 0x33C4,
+				0x0, 0x33C6, 0x33C8, 0x0, 0x33CA, 0x0, 0x0, 0x33CC, 0x0, 0x33CE, 0x33D0, 0x33D2, 0x33D4, 0x33D6, 0x33D8, 0x33DA,
+				0x33DC, 0x33DE, 0x33E0, 0x0, 0x33E2, 0x33E4, 0x33E6, 0x33E8, 0x0, 0x33EA, 0x0, 0x33EC, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x33EE, 0x0, 0x0, 0x0, 0x0, 0x33F0, 0x0, 0x33F2, 0x0, 0x33F4, 0x0, 0x33F6, 0x33F8, 0x33FA,
+				0x0, 0x33FC, 0x33FE, 0x0, 0x3400, 0x0, 0x0, 0x3402, 0x0, 0x3404, 0x0, 0x3406, 0x0, 0x3408, 0x0, 0x340A,
+				0x0, 0x340C, 0x340E, 0x0, 0x3410, 0x0, 0x0, 0x3412, 0x3414, 0x3416, 0x3418, 0x0, 0x341A, 0x341C, 0x341E, 0x3420,
+				0x3422, 0x3424, 0x3426, 0x0, 0x3428, 0x342A, 0x342C, 0x342E, 0x0, 0x3430, 0x3432, 0x3434, 0x3436, 0x0, 0x3438, 0x0,
+				0x343A, 0x343C, 0x343E, 0x3440, 0x3442, 0x3444, 0x3446, 0x3448, 0x344A, 0x344C, 0x0, 0x344E, 0x3450, 0x3452, 0x3454, 0x3456,
+				0x3458, 0x345A, 0x345C, 0x345E, 0x3460, 0x3462, 0x3464, 0x3466, 0x3468, 0x346A, 0x346C, 0x346E, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x3470, 0x3472, 0x3474, 0x0, 0x3476, 0x3478, 0x347A, 0x347C, 0x347E, 0x0, 0x3480, 0x3482, 0x3484, 0x3486, 0x3488,
+				0x348A, 0x348C, 0x348E, 0x3490, 0x3492, 0x3494, 0x3496, 0x3498, 0x349A, 0x349C, 0x349E, 0x34A0, 0x0, 0x0, 0x0, 0x0,
+				0x34A2, 0x34A5, 0x34A8, 0x34AB, 0x34AE, 0x34B1, 0x34B4, 0x34B7, 0x34BA, 0x34BD, 0x34C0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x34C3, 0x34C7, 0x34CB, 0x34CF, 0x34D3, 0x34D7, 0x34DB, 0x34DF, 0x34E3, 0x34E7, 0x34EB, 0x34EF, 0x34F3, 0x34F7, 0x34FB, 0x34FF,
+				0x3503, 0x3507, 0x350B, 0x350F, 0x3513, 0x3517, 0x351B, 0x351F, 0x3523, 0x3527, 0x352B, 0x352F, 0x3531, 0x3533, 0x3536, 0x0,
+				0x3539, 0x353B, 0x353D, 0x353F, 0x3541, 0x3543, 0x3545, 0x3547, 0x3549, 0x354B, 0x354D, 0x354F, 0x3551, 0x3553, 0x3555, 0x3557,
+				0x3559, 0x355B, 0x355D, 0x355F, 0x3561, 0x3563, 0x3565, 0x3567, 0x3569, 0x356B, 0x356D, 0x3570, 0x3573, 0x3576, 0x3579, 0x357D,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3580, 0x3583, 0x3586, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x3589, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x358C, 0x358F, 0x3592, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x3594, 0x3596, 0x3598, 0x359A, 0x359D, 0x359F, 0x35A1, 0x35A3, 0x35A5, 0x35A7, 0x35A9, 0x35AB, 0x35AD, 0x35AF, 0x35B1, 0x35B3,
+				0x35B5, 0x35B7, 0x35B9, 0x35BB, 0x35BD, 0x35BF, 0x35C1, 0x35C3, 0x35C5, 0x35C7, 0x35C9, 0x35CB, 0x35CD, 0x35CF, 0x35D1, 0x35D3,
+				0x35D5, 0x35D7, 0x35D9, 0x35DB, 0x35DD, 0x35DF, 0x35E1, 0x35E3, 0x35E5, 0x35E7, 0x35E9, 0x35EB, 0x0, 0x0, 0x0, 0x0,
+				0x35ED, 0x35F1, 0x35F5, 0x35F9, 0x35FD, 0x3601, 0x3605, 0x3609, 0x360D, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x3611, 0x3613, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x3615, 0x3617, 0x3619, 0x361B, 0x361D, 0x361F, 0x3621, 0x3623, 0x3625, 0x3627, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x3629, 0x362B, 0x362D, 0x362F, 0x3632, 0x3634, 0x3636, 0x3638, 0x363A, 0x363C, 0x363E, 0x3640, 0x3642, 0x3644, 0x3647, 0x3649,
+				0x364B, 0x364D, 0x364F, 0x3652, 0x3654, 0x3656, 0x3658, 0x365B, 0x365D, 0x365F, 0x3661, 0x3663, 0x3665, 0x3668, 0x366A, 0x366C,
+				0x366E, 0x3670, 0x3672, 0x3674, 0x3676, 0x3678, 0x367A, 0x367C, 0x367E, 0x3680, 0x3682, 0x3684, 0x3686, 0x3688, 0x368A, 0x368C,
+				0x368E, 0x3690, 0x3692, 0x3694, 0x3696, 0x3699, 0x369B, 0x369D, 0x369F, 0x36A2, 0x36A4, 0x36A6, 0x36A8, 0x36AA, 0x36AC, 0x36AE,
+				0x36B0, 0x36B2, 0x36B4, 0x36B6, 0x36B8, 0x36BA, 0x36BC, 0x36BE, 0x36C0, 0x36C2, 0x36C4, 0x36C6, 0x36C8, 0x36CA, 0x36CC, 0x36CE,
+				0x36D0, 0x36D2, 0x36D4, 0x36D6, 0x36D8, 0x36DA, 0x36DC, 0x36DE, 0x36E0, 0x36E2, 0x36E5, 0x36E7, 0x36E9, 0x36EB, 0x36ED, 0x36EF,
+				0x36F1, 0x36F4, 0x36F7, 0x36F9, 0x36FB, 0x36FD, 0x36FF, 0x3701, 0x3703, 0x3705, 0x3707, 0x3709, 0x370B, 0x370E, 0x3710, 0x3712,
+				0x3714, 0x3716, 0x3719, 0x371B, 0x371D, 0x371F, 0x3721, 0x3723, 0x3725, 0x3727, 0x3729, 0x372B, 0x372E, 0x3730, 0x3733, 0x3735,
+				0x3737, 0x3739, 0x373B, 0x373D, 0x373F, 0x3741, 0x3743, 0x3745, 0x3747, 0x3749, 0x374C, 0x374E, 0x3750, 0x3752, 0x3754, 0x3756,
+				0x3759, 0x375B, 0x375E, 0x3761, 0x3763, 0x3765, 0x3767, 0x3769, 0x376C, 0x376F, 0x3771, 0x3773, 0x3775, 0x3777, 0x3779, 0x377B,
+				0x377D, 0x377F, 0x3781, 0x3783, 0x3785, 0x3788, 0x378A, 0x378C, 0x378E, 0x3790, 0x3792, 0x3794, 0x3796, 0x3798, 0x379A, 0x379C,
+				0x379E, 0x37A0, 0x37A2, 0x37A4, 0x37A6, 0x37A8, 0x37AA, 0x37AC, 0x37AE, 0x37B1, 0x37B3, 0x37B5, 0x37B7, 0x37B9, 0x37BB, 0x37BE,
+				0x37C0, 0x37C2, 0x37C4, 0x37C6, 0x37C8, 0x37CA, 0x37CC, 0x37CE, 0x37D0, 0x37D2, 0x37D4, 0x37D7, 0x37D9, 0x37DB, 0x37DD, 0x37DF,
+				0x37E1, 0x37E3, 0x37E5, 0x37E7, 0x37E9, 0x37EB, 0x37ED, 0x37EF, 0x37F1, 0x37F3, 0x37F5, 0x37F7, 0x37F9, 0x37FB, 0x37FE, 0x3800,
+				0x3802, 0x3804, 0x3806, 0x3808, 0x380B, 0x380D, 0x380F, 0x3811, 0x3813, 0x3815, 0x3817, 0x3819, 0x381B, 0x381E, 0x3820, 0x3822,
+				0x3824, 0x3827, 0x3829, 0x382B, 0x382D, 0x382F, 0x3831, 0x3833, 0x3836, 0x3839, 0x383C, 0x383E, 0x3841, 0x3843, 0x3845, 0x3847,
+				0x3849, 0x384B, 0x384D, 0x384F, 0x3851, 0x3853, 0x3855, 0x3858, 0x385A, 0x385C, 0x385E, 0x3860, 0x3862, 0x3864, 0x3867, 0x3869,
+				0x386B, 0x386E, 0x3871, 0x3873, 0x3875, 0x3877, 0x3879, 0x387B, 0x387D, 0x387F, 0x3881, 0x3883, 0x3886, 0x3888, 0x388B, 0x388D,
+				0x3890, 0x3892, 0x3894, 0x3896, 0x3899, 0x389B, 0x389D, 0x38A0, 0x38A3, 0x38A5, 0x38A7, 0x38A9, 0x38AB, 0x38AD, 0x38AF, 0x38B1,
+				0x38B3, 0x38B5, 0x38B7, 0x38B9, 0x38BB, 0x38BD, 0x38C0, 0x38C2, 0x38C5, 0x38C7, 0x38CA, 0x38CC, 0x38CF, 0x38D2, 0x38D5, 0x38D7,
+				0x38D9, 0x38DB, 0x38DE, 0x38E1, 0x38E4, 0x38E7, 0x38E9, 0x38EB, 0x38ED, 0x38EF, 0x38F1, 0x38F3, 0x38F5, 0x38F7, 0x38FA, 0x38FC,
+				0x38FE, 0x3900, 0x3902, 0x3905, 0x3907, 0x390A, 0x390D, 0x390F, 0x3911, 0x3913, 0x3915, 0x3917, 0x3919, 0x391C, 0x391F, 0x3922,
+				0x3924, 0x3926, 0x3929, 0x392B, 0x392D, 0x392F, 0x3932, 0x3934, 0x3936, 0x3938, 0x393A, 0x393C, 0x393F, 0x3941, 0x3943, 0x3945,
+				0x3947, 0x3949, 0x394B, 0x394E, 0x3951, 0x3953, 0x3956, 0x3958, 0x395B, 0x395D, 0x395F, 0x3961, 0x3964, 0x3967, 0x3969, 0x396C,
+				0x396E, 0x3971, 0x3973, 0x3975, 0x3977, 0x3979, 0x397B, 0x397D, 0x3980, 0x3983, 0x3986, 0x3989, 0x398B, 0x398D, 0x398F, 0x3991,
+				0x3993, 0x3995, 0x3997, 0x3999, 0x399B, 0x399D, 0x399F, 0x39A1, 0x39A4, 0x39A6, 0x39A8, 0x39AA, 0x39AC, 0x39AE, 0x39B0, 0x39B2,
+				0x39B4, 0x39B6, 0x39B8, 0x39BA, 0x39BC, 0x39BF, 0x39C2, 0x39C5, 0x39C7, 0x39C9, 0x39CB, 0x39CD, 0x39D0, 0x39D2, 0x39D5, 0x39D7,
+				0x39D9, 0x39DC, 0x39DF, 0x39E1, 0x39E3, 0x39E5, 0x39E7, 0x39E9, 0x39EB, 0x39ED, 0x39EF, 0x39F1, 0x39F3, 0x39F5, 0x39F7, 0x39F9,
+				0x39FB, 0x39FD, 0x39FF, 0x3A01, 0x3A03, 0x3A05, 0x3A08, 0x3A0A, 0x3A0C, 0x3A0E, 0x3A10, 0x3A12, 0x3A15, 0x3A18, 0x3A1A, 0x3A1C,
+				0x3A1E, 0x3A20, 0x3A22, 0x3A24, 0x3A27, 0x3A29, 0x3A2B, 0x3A2D, 0x3A2F, 0x3A32, 0x3A35, 0x3A37, 0x3A39, 0x3A3B, 0x3A3E, 0x3A40,
+				0x3A42, 0x3A45, 0x3A48, 0x3A4A, 0x3A4C, 0x3A4E, 0x3A51, 0x3A53, 0x3A55, 0x3A57, 0x3A59, 0x3A5B, 0x3A5D, 0x3A5F, 0x3A62, 0x3A64,
+				0x3A66, 0x3A68, 0x3A6B, 0x3A6D, 0x3A6F, 0x3A71, 0x3A73, 0x3A76, 0x3A79, 0x3A7B, 0x3A7D, 0x3A7F, 0x3A82, 0x3A84, 0x3A87, 0x3A89,
+				0x3A8B, 0x3A8D, 0x3A90, 0x3A92, 0x3A94, 0x3A96, 0x3A98, 0x3A9A, 0x3A9C, 0x3A9E, 0x3AA1, 0x3AA3, 0x3AA5, 0x3AA7, 0x3AA9, 0x3AAB,
+				0x3AAD, 0x3AB0, 0x3AB2, 0x3AB5, 0x3AB8, 0x3ABB, 0x3ABD, 0x3ABF, 0x3AC1, 0x3AC3, 0x3AC5, 0x3AC7, 0x3AC9, 0x3ACB, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			};
+
+			template< typename Dummy >
+			const unsigned char NormalizationTables< Dummy >::CompositionStage1[ 2250 ] =
+			{
+				0x0, 0x1, 0x2, 0x3, 0x0, 0x4, 0x5, 0x6, 0x7, 0x0, 0x8, 0x9, 0x0, 0xA, 0x0, 0xB,
+				0x0, 0xC, 0x0, 0x0, 0xD, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xE, 0xF, 0x10, 0x0,
+				0x11, 0x12, 0x13, 0x14, 0x0, 0x0, 0x15, 0x16, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x17, 0x18, 0x0, 0x0, 0x0, 0x19, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1A, 0x0, 0x0, 0x0, 0x0, 0x1B, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1C, 0x0, 0x1D, 0x0, 0x1E, 0x0,
+				0x0, 0x0, 0x1F, 0x0, 0x0, 0x20, 0x21, 0x0, 0x0, 0x0, 0x22, 0x0, 0x0, 0x0, 0x23, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x24, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x25, 0x26, 0x27, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x28, 0x29, 0x2A, 0x0, 0x2B, 0x2C, 0x0, 0x2D, 0x2E, 0x2F, 0x30, 0x0, 0x31, 0x32, 0x33,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x34, 0x0, 0x35, 0x0,
+				0x36, 0x37, 0x38, 0x39, 0x3A, 0x3B, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x3C, 0x3D, 0x3E, 0x3F, 0x40, 0x41, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x42, 0x43, 0x0, 0x0, 0x0, 0x44, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x45, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x46, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x47, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x48,
+			};
+
+			template< typename Dummy >
+			const unsigned short NormalizationTables< Dummy >::CompositionStage2[ 2336 ] =
+			{
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x2, 0x3, 0x0,
+				0x0, 0x4, 0x5, 0x6, 0x7, 0x8, 0x9, 0xA, 0xB, 0xC, 0xD, 0xE, 0xF, 0x10, 0x11, 0x12,
+				0x13, 0x0, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2A, 0x2B,
+				0x2C, 0x0, 0x2D, 0x2E, 0x2F, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x36, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x37, 0x0, 0x38, 0x39, 0x3A, 0x3B, 0x0, 0x0, 0x3C, 0x0, 0x0, 0x0, 0x0, 0x3D,
+				0x0, 0x0, 0x0, 0x0, 0x3E, 0x3F, 0x40, 0x0, 0x41, 0x0, 0x0, 0x0, 0x42, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x43, 0x0, 0x44, 0x45, 0x46, 0x47, 0x0, 0x0, 0x48, 0x0, 0x0, 0x0, 0x0, 0x49,
+				0x0, 0x0, 0x0, 0x0, 0x4A, 0x4B, 0x4C, 0x0, 0x4D, 0x0, 0x0, 0x0, 0x4E, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x4F, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x51, 0x52, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x53, 0x54, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x55, 0x56, 0x0, 0x0, 0x0, 0x0,
+				0x57, 0x58, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x59, 0x5A, 0x5B, 0x5C, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5D,
+				0x5E, 0x5F, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x60,
+				0x61, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x62, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x63, 0x64, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x65, 0x66, 0x67, 0x68, 0x0, 0x0, 0x0, 0x0, 0x69, 0x6A,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x6B, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x6C, 0x0, 0x0, 0x0, 0x6D, 0x0, 0x6E, 0x0, 0x6F, 0x0, 0x0, 0x0, 0x0, 0x0, 0x70,
+				0x0, 0x71, 0x0, 0x0, 0x0, 0x72, 0x0, 0x0, 0x0, 0x73, 0x0, 0x0, 0x74, 0x0, 0x75, 0x0,
+				0x0, 0x76, 0x0, 0x0, 0x0, 0x77, 0x0, 0x78, 0x0, 0x79, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7A,
+				0x0, 0x7B, 0x0, 0x0, 0x0, 0x7C, 0x0, 0x0, 0x0, 0x7D, 0x7E, 0x7F, 0x0, 0x0, 0x80, 0x0,
+				0x0, 0x0, 0x81, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x82, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x83, 0x0, 0x0, 0x84, 0x0, 0x85, 0x86, 0x87, 0x88, 0x0, 0x89, 0x0, 0x0, 0x0, 0x8A, 0x0,
+				0x0, 0x0, 0x0, 0x8B, 0x0, 0x0, 0x0, 0x8C, 0x0, 0x0, 0x0, 0x8D, 0x0, 0x8E, 0x0, 0x0,
+				0x8F, 0x0, 0x0, 0x90, 0x0, 0x91, 0x92, 0x93, 0x94, 0x0, 0x95, 0x0, 0x0, 0x0, 0x96, 0x0,
+				0x0, 0x0, 0x0, 0x97, 0x0, 0x0, 0x0, 0x98, 0x0, 0x0, 0x0, 0x99, 0x0, 0x9A, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9B, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x9C, 0x9D, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9E, 0x9F, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xA0, 0xA1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xA2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xA3, 0x0, 0xA4, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0xA5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0xA6, 0x0, 0x0, 0xA7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xA8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0xA9, 0x0, 0x0, 0xAA, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xAB, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xAC, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0xAD, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xAE, 0xAF, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xB0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xB1,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xB2, 0x0, 0x0, 0x0, 0xB3, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xB4, 0xB5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xB6, 0x0, 0x0, 0xB7, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0xB8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0xB9, 0x0, 0xBA, 0x0, 0xBB, 0x0, 0xBC, 0x0, 0xBD, 0x0, 0x0,
+				0x0, 0xBE, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xBF, 0x0, 0xC0, 0x0, 0xC1, 0xC2,
+				0x0, 0x0, 0xC3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xC4, 0xC5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xC6, 0xC7, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0xC8, 0xC9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0xCA, 0xCB, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xCC, 0xCD, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xCE, 0xCF, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0xD0, 0xD1, 0xD2, 0xD3, 0xD4, 0xD5, 0xD6, 0xD7, 0xD8, 0xD9, 0xDA, 0xDB, 0xDC, 0xDD, 0xDE, 0xDF,
+				0xE0, 0xE1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xE2, 0xE3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0xE4, 0xE5, 0xE6, 0xE7, 0xE8, 0xE9, 0xEA, 0xEB, 0xEC, 0xED, 0xEE, 0xEF, 0xF0, 0xF1, 0xF2, 0xF3,
+				0xF4, 0xF5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xF6, 0xF7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0xF8, 0xF9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xFA, 0xFB, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0xFC, 0xFD, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xFE, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0xFF, 0x100, 0x101, 0x102, 0x103, 0x104, 0x105, 0x106, 0x107, 0x108, 0x109, 0x10A, 0x10B, 0x10C, 0x10D, 0x10E,
+				0x10F, 0x0, 0x0, 0x0, 0x110, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x111, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x112, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x113,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x114, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x115, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x116, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x117, 0x0, 0x118, 0x0, 0x119, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x11A, 0x0, 0x11B, 0x0, 0x11C, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x11D, 0x0, 0x0, 0x0, 0x0, 0x11E, 0x0, 0x0, 0x11F, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x120, 0x0, 0x121, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x122, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x123, 0x0, 0x124, 0x0, 0x0, 0x125, 0x0, 0x0, 0x0, 0x0, 0x126, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x127, 0x0, 0x0, 0x128, 0x129, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x12A, 0x12B, 0x0, 0x0, 0x12C, 0x12D, 0x0, 0x0, 0x12E, 0x12F, 0x130, 0x131, 0x0, 0x0,
+				0x0, 0x0, 0x132, 0x133, 0x0, 0x0, 0x134, 0x135, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x136, 0x137, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x138, 0x0, 0x0, 0x0, 0x0, 0x0, 0x139, 0x13A, 0x0, 0x13B, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x13C, 0x13D, 0x13E, 0x13F, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x140, 0x0, 0x0, 0x0, 0x0, 0x141, 0x0, 0x142, 0x0, 0x143,
+				0x0, 0x144, 0x0, 0x145, 0x0, 0x146, 0x0, 0x147, 0x0, 0x148, 0x0, 0x149, 0x0, 0x14A, 0x0, 0x14B,
+				0x0, 0x14C, 0x0, 0x0, 0x14D, 0x0, 0x14E, 0x0, 0x14F, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x150,
+				0x0, 0x0, 0x151, 0x0, 0x0, 0x152, 0x0, 0x0, 0x153, 0x0, 0x0, 0x154, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x155, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x156, 0x0, 0x0, 0x0, 0x0, 0x157, 0x0, 0x158, 0x0, 0x159,
+				0x0, 0x15A, 0x0, 0x15B, 0x0, 0x15C, 0x0, 0x15D, 0x0, 0x15E, 0x0, 0x15F, 0x0, 0x160, 0x0, 0x161,
+				0x0, 0x162, 0x0, 0x0, 0x163, 0x0, 0x164, 0x0, 0x165, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x166,
+				0x0, 0x0, 0x167, 0x0, 0x0, 0x168, 0x0, 0x0, 0x169, 0x0, 0x0, 0x16A, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x16B,
+				0x16C, 0x16D, 0x16E, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x16F, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x170, 0x0, 0x171, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x172, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x173, 0x174, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x175, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x176, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x177, 0x178, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x179, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+			};
+
+			template< typename Dummy >
+			const unsigned short NormalizationTables< Dummy >::Properties[ 69 ] =
+			{
+				0x0, 0x1, 0x6, 0x7, 0x9, 0xA, 0xB, 0xC,
+				0xD, 0xE, 0xF, 0x10, 0x11, 0x12, 0x13, 0x14,
+				0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C,
+				0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24,
+				0x54, 0x67, 0x6B, 0x76, 0x7A, 0x81, 0x82, 0x84,
+				0xCA, 0xD6, 0xD8, 0xDA, 0xDC, 0xDE, 0xE0, 0xE2,
+				0xE4, 0xE6, 0xE8, 0xE9, 0xEA, 0x300, 0x1200, 0x1300,
+				0x1700, 0x17E6, 0x2800, 0x2801, 0x2807, 0x2808, 0x2809, 0x285B,
+				0x28CA, 0x28D8, 0x28DC, 0x28E6, 0x28F0,
+			};
+
+			template< typename Dummy >
+			const unsigned short NormalizationTables< Dummy >::Decompositions[ 15054 ] =
+			{
+				0x0, 0x820, 0x20, 0x840, 0x20, 0x308, 0x820, 0x61,
+				0x840, 0x20, 0x304, 0x820, 0x32, 0x820, 0x33, 0x840,
+				0x20, 0x301, 0x820, 0x3BC, 0x840, 0x20, 0x327, 0x820,
+				0x31, 0x820, 0x6F, 0x860, 0x31, 0x2044, 0x34, 0x860,
+				0x31, 0x2044, 0x32, 0x860, 0x33, 0x2044, 0x34, 0x42,
+				0x41, 0x300, 0x42, 0x41, 0x301, 0x42, 0x41, 0x302,
+				0x42, 0x41, 0x303, 0x42, 0x41, 0x308, 0x42, 0x41,
+				0x30A, 0x42, 0x43, 0x327, 0x42, 0x45, 0x300, 0x42,
+				0x45, 0x301, 0x42, 0x45, 0x302, 0x42, 0x45, 0x308,
+				0x42, 0x49, 0x300, 0x42, 0x49, 0x301, 0x42, 0x49,
+				0x302, 0x42, 0x49, 0x308, 0x42, 0x4E, 0x303, 0x42,
+				0x4F, 0x300, 0x42, 0x4F, 0x301, 0x42, 0x4F, 0x302,
+				0x42, 0x4F, 0x303, 0x42, 0x4F, 0x308, 0x42, 0x55,
+				0x300, 0x42, 0x55, 0x301, 0x42, 0x55, 0x302, 0x42,
+				0x55, 0x308, 0x42, 0x59, 0x301, 0x42, 0x61, 0x300,
+				0x42, 0x61, 0x301, 0x42, 0x61, 0x302, 0x42, 0x61,
+				0x303, 0x42, 0x61, 0x308, 0x42, 0x61, 0x30A, 0x42,
+				0x63, 0x327, 0x42, 0x65, 0x300, 0x42, 0x65, 0x301,
+				0x42, 0x65, 0x302, 0x42, 0x65, 0x308, 0x42, 0x69,
+				0x300, 0x42, 0x69, 0x301, 0x42, 0x69, 0x302, 0x42,
+				0x69, 0x308, 0x42, 0x6E, 0x303, 0x42, 0x6F, 0x300,
+				0x42, 0x6F, 0x301, 0x42, 0x6F, 0x302, 0x42, 0x6F,
+				0x303, 0x42, 0x6F, 0x308, 0x42, 0x75, 0x300, 0x42,
+				0x75, 0x301, 0x42, 0x75, 0x302, 0x42, 0x75, 0x308,
+				0x42, 0x79, 0x301, 0x42, 0x79, 0x308, 0x42, 0x41,
+				0x304, 0x42, 0x61, 0x304, 0x42, 0x41, 0x306, 0x42,
+				0x61, 0x306, 0x42, 0x41, 0x328, 0x42, 0x61, 0x328,
+				0x42, 0x43, 0x301, 0x42, 0x63, 0x301, 0x42, 0x43,
+				0x302, 0x42, 0x63, 0x302, 0x42, 0x43, 0x307, 0x42,
+				0x63, 0x307, 0x42, 0x43, 0x30C, 0x42, 0x63, 0x30C,
+				0x42, 0x44, 0x30C, 0x42, 0x64, 0x30C, 0x42, 0x45,
+				0x304, 0x42, 0x65, 0x304, 0x42, 0x45, 0x306, 0x42,
+				0x65, 0x306, 0x42, 0x45, 0x307, 0x42, 0x65, 0x307,
+				0x42, 0x45, 0x328, 0x42, 0x65, 0x328, 0x42, 0x45,
+				0x30C, 0x42, 0x65, 0x30C, 0x42, 0x47, 0x302, 0x42,
+				0x67, 0x302, 0x42, 0x47, 0x306, 0x42, 0x67, 0x306,
+				0x42, 0x47, 0x307, 0x42, 0x67, 0x307, 0x42, 0x47,
+				0x327, 0x42, 0x67, 0x327, 0x42, 0x48, 0x302, 0x42,
+				0x68, 0x302, 0x42, 0x49, 0x303, 0x42, 0x69, 0x303,
+				0x42, 0x49, 0x304, 0x42, 0x69, 0x304, 0x42, 0x49,
+				0x306, 0x42, 0x69, 0x306, 0x42, 0x49, 0x328, 0x42,
+				0x69, 0x328, 0x42, 0x49, 0x307, 0x840, 0x49, 0x4A,
+				0x840, 0x69, 0x6A, 0x42, 0x4A, 0x302, 0x42, 0x6A,
+				0x302, 0x42, 0x4B, 0x327, 0x42, 0x6B, 0x327, 0x42,
+				0x4C, 0x301, 0x42, 0x6C, 0x301, 0x42, 0x4C, 0x327,
+				0x42, 0x6C, 0x327, 0x42, 0x4C, 0x30C, 0x42, 0x6C,
+				0x30C, 0x840, 0x4C, 0xB7, 0x840, 0x6C, 0xB7, 0x42,
+				0x4E, 0x301, 0x42, 0x6E, 0x301, 0x42, 0x4E, 0x327,
+				0x42, 0x6E, 0x327, 0x42, 0x4E, 0x30C, 0x42, 0x6E,
+				0x30C, 0x840, 0x2BC, 0x6E, 0x42, 0x4F, 0x304, 0x42,
+				0x6F, 0x304, 0x42, 0x4F, 0x306, 0x42, 0x6F, 0x306,
+				0x42, 0x4F, 0x30B, 0x42, 0x6F, 0x30B, 0x42, 0x52,
+				0x301, 0x42, 0x72, 0x301, 0x42, 0x52, 0x327, 0x42,
+				0x72, 0x327, 0x42, 0x52, 0x30C, 0x42, 0x72, 0x30C,
+				0x42, 0x53, 0x301, 0x42, 0x73, 0x301, 0x42, 0x53,
+				0x302, 0x42, 0x73, 0x302, 0x42, 0x53, 0x327, 0x42,
+				0x73, 0x327, 0x42, 0x53, 0x30C, 0x42, 0x73, 0x30C,
+				0x42, 0x54, 0x327, 0x42, 0x74, 0x327, 0x42, 0x54,
+				0x30C, 0x42, 0x74, 0x30C, 0x42, 0x55, 0x303, 0x42,
+				0x75, 0x303, 0x42, 0x55, 0x304, 0x42, 0x75, 0x304,
+				0x42, 0x55, 0x306, 0x42, 0x75, 0x306, 0x42, 0x55,
+				0x30A, 0x42, 0x75, 0x30A, 0x42, 0x55, 0x30B, 0x42,
+				0x75, 0x30B, 0x42, 0x55, 0x328, 0x42, 0x75, 0x328,
+				0x42, 0x57, 0x302, 0x42, 0x77, 0x302, 0x42, 0x59,
+				0x302, 0x42, 0x79, 0x302, 0x42, 0x59, 0x308, 0x42,
+				0x5A, 0x301, 0x42, 0x7A, 0x301, 0x42, 0x5A, 0x307,
+				0x42, 0x7A, 0x307, 0x42, 0x5A, 0x30C, 0x42, 0x7A,
+				0x30C, 0x820, 0x73, 0x42, 0x4F, 0x31B, 0x42, 0x6F,
+				0x31B, 0x42, 0x55, 0x31B, 0x42, 0x75, 0x31B, 0x860,
+				0x44, 0x5A, 0x30C, 0x860, 0x44, 0x7A, 0x30C, 0x860,
+				0x64, 0x7A, 0x30C, 0x840, 0x4C, 0x4A, 0x840, 0x4C,
+				0x6A, 0x840, 0x6C, 0x6A, 0x840, 0x4E, 0x4A, 0x840,
+				0x4E, 0x6A, 0x840, 0x6E, 0x6A, 0x42, 0x41, 0x30C,
+				0x42, 0x61, 0x30C, 0x42, 0x49, 0x30C, 0x42, 0x69,
+				0x30C, 0x42, 0x4F, 0x30C, 0x42, 0x6F, 0x30C, 0x42,
+				0x55, 0x30C, 0x42, 0x75, 0x30C, 0x63, 0x55, 0x308,
+				0x304, 0x63, 0x75, 0x308, 0x304, 0x63, 0x55, 0x308,
+				0x301, 0x63, 0x75, 0x308, 0x301, 0x63, 0x55, 0x308,
+				0x30C, 0x63, 0x75, 0x308, 0x30C, 0x63, 0x55, 0x308,
+				0x300, 0x63, 0x75, 0x308, 0x300, 0x63, 0x41, 0x308,
+				0x304, 0x63, 0x61, 0x308, 0x304, 0x63, 0x41, 0x307,
+				0x304, 0x63, 0x61, 0x307, 0x304, 0x42, 0xC6, 0x304,
+				0x42, 0xE6, 0x304, 0x42, 0x47, 0x30C, 0x42, 0x67,
+				0x30C, 0x42, 0x4B, 0x30C, 0x42, 0x6B, 0x30C, 0x42,
+				0x4F, 0x328, 0x42, 0x6F, 0x328, 0x63, 0x4F, 0x328,
+				0x304, 0x63, 0x6F, 0x328, 0x304, 0x42, 0x1B7, 0x30C,
+				0x42, 0x292, 0x30C, 0x42, 0x6A, 0x30C, 0x840, 0x44,
+				0x5A, 0x840, 0x44, 0x7A, 0x840, 0x64, 0x7A, 0x42,
+				0x47, 0x301, 0x42, 0x67, 0x301, 0x42, 0x4E, 0x300,
+				0x42, 0x6E, 0x300, 0x63, 0x41, 0x30A, 0x301, 0x63,
+				0x61, 0x30A, 0x301, 0x42, 0xC6, 0x301, 0x42, 0xE6,
+				0x301, 0x42, 0xD8, 0x301, 0x42, 0xF8, 0x301, 0x42,
+				0x41, 0x30F, 0x42, 0x61, 0x30F, 0x42, 0x41, 0x311,
+				0x42, 0x61, 0x311, 0x42, 0x45, 0x30F, 0x42, 0x65,
+				0x30F, 0x42, 0x45, 0x311, 0x42, 0x65, 0x311, 0x42,
+				0x49, 0x30F, 0x42, 0x69, 0x30F, 0x42, 0x49, 0x311,
+				0x42, 0x69, 0x311, 0x42, 0x4F, 0x30F, 0x42, 0x6F,
+				0x30F, 0x42, 0x4F, 0x311, 0x42, 0x6F, 0x311, 0x42,
+				0x52, 0x30F, 0x42, 0x72, 0x30F, 0x42, 0x52, 0x311,
+				0x42, 0x72, 0x311, 0x42, 0x55, 0x30F, 0x42, 0x75,
+				0x30F, 0x42, 0x55, 0x311, 0x42, 0x75, 0x311, 0x42,
+				0x53, 0x326, 0x42, 0x73, 0x326, 0x42, 0x54, 0x326,
+				0x42, 0x74, 0x326, 0x42, 0x48, 0x30C, 0x42, 0x68,
+				0x30C, 0x42, 0x41, 0x307, 0x42, 0x61, 0x307, 0x42,
+				0x45, 0x327, 0x42, 0x65, 0x327, 0x63, 0x4F, 0x308,
+				0x304, 0x63, 0x6F, 0x308, 0x304, 0x63, 0x4F, 0x303,
+				0x304, 0x63, 0x6F, 0x303, 0x304, 0x42, 0x4F, 0x307,
+				0x42, 0x6F, 0x307, 0x63, 0x4F, 0x307, 0x304, 0x63,
+				0x6F, 0x307, 0x304, 0x42, 0x59, 0x304, 0x42, 0x79,
+				0x304, 0x820, 0x68, 0x820, 0x266, 0x820, 0x6A, 0x820,
+				0x72, 0x820, 0x279, 0x820, 0x27B, 0x820, 0x281, 0x820,
+				0x77, 0x820, 0x79, 0x840, 0x20, 0x306, 0x840, 0x20,
+				0x307, 0x840, 0x20, 0x30A, 0x840, 0x20, 0x328, 0x840,
+				0x20, 0x303, 0x840, 0x20, 0x30B, 0x820, 0x263, 0x820,
+				0x6C, 0x820, 0x73, 0x820, 0x78, 0x820, 0x295, 0x21,
+				0x300, 0x21, 0x301, 0x21, 0x313, 0x42, 0x308, 0x301,
+				0x21, 0x2B9, 0x840, 0x20, 0x345, 0x21, 0x3B, 0x840,
+				0x20, 0x301, 0x862, 0xA8, 0x301, 0x20, 0x308, 0x301,
+				0x42, 0x391, 0x301, 0x21, 0xB7, 0x42, 0x395, 0x301,
+				0x42, 0x397, 0x301, 0x42, 0x399, 0x301, 0x42, 0x39F,
+				0x301, 0x42, 0x3A5, 0x301, 0x42, 0x3A9, 0x301, 0x63,
+				0x3B9, 0x308, 0x301, 0x42, 0x399, 0x308, 0x42, 0x3A5,
+				0x308, 0x42, 0x3B1, 0x301, 0x42, 0x3B5, 0x301, 0x42,
+				0x3B7, 0x301, 0x42, 0x3B9, 0x301, 0x63, 0x3C5, 0x308,
+				0x301, 0x42, 0x3B9, 0x308, 0x42, 0x3C5, 0x308, 0x42,
+				0x3BF, 0x301, 0x42, 0x3C5, 0x301, 0x42, 0x3C9, 0x301,
+				0x820, 0x3B2, 0x820, 0x3B8, 0x820, 0x3A5, 0x842, 0x3D2,
+				0x301, 0x3A5, 0x301, 0x842, 0x3D2, 0x308, 0x3A5, 0x308,
+				0x820, 0x3C6, 0x820, 0x3C0, 0x820, 0x3BA, 0x820, 0x3C1,
+				0x820, 0x3C2, 0x820, 0x398, 0x820, 0x3B5, 0x820, 0x3A3,
+				0x42, 0x415, 0x300, 0x42, 0x415, 0x308, 0x42, 0x413,
+				0x301, 0x42, 0x406, 0x308, 0x42, 0x41A, 0x301, 0x42,
+				0x418, 0x300, 0x42, 0x423, 0x306, 0x42, 0x418, 0x306,
+				0x42, 0x438, 0x306, 0x42, 0x435, 0x300, 0x42, 0x435,
+				0x308, 0x42, 0x433, 0x301, 0x42, 0x456, 0x308, 0x42,
+				0x43A, 0x301, 0x42, 0x438, 0x300, 0x42, 0x443, 0x306,
+				0x42, 0x474, 0x30F, 0x42, 0x475, 0x30F, 0x42, 0x416,
+				0x306, 0x42, 0x436, 0x306, 0x42, 0x410, 0x306, 0x42,
+				0x430, 0x306, 0x42, 0x410, 0x308, 0x42, 0x430, 0x308,
+				0x42, 0x415, 0x306, 0x42, 0x435, 0x306, 0x42, 0x4D8,
+				0x308, 0x42, 0x4D9, 0x308, 0x42, 0x416, 0x308, 0x42,
+				0x436, 0x308, 0x42, 0x417, 0x308, 0x42, 0x437, 0x308,
+				0x42, 0x418, 0x304, 0x42, 0x438, 0x304, 0x42, 0x418,
+				0x308, 0x42, 0x438, 0x308, 0x42, 0x41E, 0x308, 0x42,
+				0x43E, 0x308, 0x42, 0x4E8, 0x308, 0x42, 0x4E9, 0x308,
+				0x42, 0x42D, 0x308, 0x42, 0x44D, 0x308, 0x42, 0x423,
+				0x304, 0x42, 0x443, 0x304, 0x42, 0x423, 0x308, 0x42,
+				0x443, 0x308, 0x42, 0x423, 0x30B, 0x42, 0x443, 0x30B,
+				0x42, 0x427, 0x308, 0x42, 0x447, 0x308, 0x42, 0x42B,
+				0x308, 0x42, 0x44B, 0x308, 0x840, 0x565, 0x582, 0x42,
+				0x627, 0x653, 0x42, 0x627, 0x654, 0x42, 0x648, 0x654,
+				0x42, 0x627, 0x655, 0x42, 0x64A, 0x654, 0x840, 0x627,
+				0x674, 0x840, 0x648, 0x674, 0x840, 0x6C7, 0x674, 0x840,
+				0x64A, 0x674, 0x42, 0x6D5, 0x654, 0x42, 0x6C1, 0x654,
+				0x42, 0x6D2, 0x654, 0x42, 0x928, 0x93C, 0x42, 0x930,
+				0x93C, 0x42, 0x933, 0x93C, 0x42, 0x915, 0x93C, 0x42,
+				0x916, 0x93C, 0x42, 0x917, 0x93C, 0x42, 0x91C, 0x93C,
+				0x42, 0x921, 0x93C, 0x42, 0x922, 0x93C, 0x42, 0x92B,
+				0x93C, 0x42, 0x92F, 0x93C, 0x42, 0x9C7, 0x9BE, 0x42,
+				0x9C7, 0x9D7, 0x42, 0x9A1, 0x9BC, 0x42, 0x9A2, 0x9BC,
+				0x42, 0x9AF, 0x9BC, 0x42, 0xA32, 0xA3C, 0x42, 0xA38,
+				0xA3C, 0x42, 0xA16, 0xA3C, 0x42, 0xA17, 0xA3C, 0x42,
+				0xA1C, 0xA3C, 0x42, 0xA2B, 0xA3C, 0x42, 0xB47, 0xB56,
+				0x42, 0xB47, 0xB3E, 0x42, 0xB47, 0xB57, 0x42, 0xB21,
+				0xB3C, 0x42, 0xB22, 0xB3C, 0x42, 0xB92, 0xBD7, 0x42,
+				0xBC6, 0xBBE, 0x42, 0xBC7, 0xBBE, 0x42, 0xBC6, 0xBD7,
+				0x42, 0xC46, 0xC56, 0x42, 0xCBF, 0xCD5, 0x42, 0xCC6,
+				0xCD5, 0x42, 0xCC6, 0xCD6, 0x42, 0xCC6, 0xCC2, 0x63,
+				0xCC6, 0xCC2, 0xCD5, 0x42, 0xD46, 0xD3E, 0x42, 0xD47,
+				0xD3E, 0x42, 0xD46, 0xD57, 0x42, 0xDD9, 0xDCA, 0x42,
+				0xDD9, 0xDCF, 0x63, 0xDD9, 0xDCF, 0xDCA, 0x42, 0xDD9,
+				0xDDF, 0x840, 0xE4D, 0xE32, 0x840, 0xECD, 0xEB2, 0x840,
+				0xEAB, 0xE99, 0x840, 0xEAB, 0xEA1, 0x820, 0xF0B, 0x42,
+				0xF42, 0xFB7, 0x42, 0xF4C, 0xFB7, 0x42, 0xF51, 0xFB7,
+				0x42, 0xF56, 0xFB7, 0x42, 0xF5B, 0xFB7, 0x42, 0xF40,
+				0xFB5, 0x42, 0xF71, 0xF72, 0x42, 0xF71, 0xF74, 0x42,
+				0xFB2, 0xF80, 0x860, 0xFB2, 0xF71, 0xF80, 0x42, 0xFB3,
+				0xF80, 0x860, 0xFB3, 0xF71, 0xF80, 0x42, 0xF71, 0xF80,
+				0x42, 0xF92, 0xFB7, 0x42, 0xF9C, 0xFB7, 0x42, 0xFA1,
+				0xFB7, 0x42, 0xFA6, 0xFB7, 0x42, 0xFAB, 0xFB7, 0x42,
+				0xF90, 0xFB5, 0x42, 0x1025, 0x102E, 0x820, 0x10DC, 0x42,
+				0x1B05, 0x1B35, 0x42, 0x1B07, 0x1B35, 0x42, 0x1B09, 0x1B35,
+				0x42, 0x1B0B, 0x1B35, 0x42, 0x1B0D, 0x1B35, 0x42, 0x1B11,
+				0x1B35, 0x42, 0x1B3A, 0x1B35, 0x42, 0x1B3C, 0x1B35, 0x42,
+				0x1B3E, 0x1B35, 0x42, 0x1B3F, 0x1B35, 0x42, 0x1B42, 0x1B35,
+				0x820, 0x41, 0x820, 0xC6, 0x820, 0x42, 0x820, 0x44,
+				0x820, 0x45, 0x820, 0x18E, 0x820, 0x47, 0x820, 0x48,
+				0x820, 0x49, 0x820, 0x4A, 0x820, 0x4B, 0x820, 0x4C,
+				0x820, 0x4D, 0x820, 0x4E, 0x820, 0x4F, 0x820, 0x222,
+				0x820, 0x50, 0x820, 0x52, 0x820, 0x54, 0x820, 0x55,
+				0x820, 0x57, 0x820, 0x61, 0x820, 0x250, 0x820, 0x251,
+				0x820, 0x1D02, 0x820, 0x62, 0x820, 0x64, 0x820, 0x65,
+				0x820, 0x259, 0x820, 0x25B, 0x820, 0x25C, 0x820, 0x67,
+				0x820, 0x6B, 0x820, 0x6D, 0x820, 0x14B, 0x820, 0x6F,
+				0x820, 0x254, 0x820, 0x1D16, 0x820, 0x1D17, 0x820, 0x70,
+				0x820, 0x74, 0x820, 0x75, 0x820, 0x1D1D, 0x820, 0x26F,
+				0x820, 0x76, 0x820, 0x1D25, 0x820, 0x3B2, 0x820, 0x3B3,
+				0x820, 0x3B4, 0x820, 0x3C6, 0x820, 0x3C7, 0x820, 0x69,
+				0x820, 0x72, 0x820, 0x75, 0x820, 0x76, 0x820, 0x3B2,
+				0x820, 0x3B3, 0x820, 0x3C1, 0x820, 0x3C6, 0x820, 0x3C7,
+				0x820, 0x43D, 0x820, 0x252, 0x820, 0x63, 0x820, 0x255,
+				0x820, 0xF0, 0x820, 0x25C, 0x820, 0x66, 0x820, 0x25F,
+				0x820, 0x261, 0x820, 0x265, 0x820, 0x268, 0x820, 0x269,
+				0x820, 0x26A, 0x820, 0x1D7B, 0x820, 0x29D, 0x820, 0x26D,
+				0x820, 0x1D85, 0x820, 0x29F, 0x820, 0x271, 0x820, 0x270,
+				0x820, 0x272, 0x820, 0x273, 0x820, 0x274, 0x820, 0x275,
+				0x820, 0x278, 0x820, 0x282, 0x820, 0x283, 0x820, 0x1AB,
+				0x820, 0x289, 0x820, 0x28A, 0x820, 0x1D1C, 0x820, 0x28B,
+				0x820, 0x28C, 0x820, 0x7A, 0x820, 0x290, 0x820, 0x291,
+				0x820, 0x292, 0x820, 0x3B8, 0x42, 0x41, 0x325, 0x42,
+				0x61, 0x325, 0x42, 0x42, 0x307, 0x42, 0x62, 0x307,
+				0x42, 0x42, 0x323, 0x42, 0x62, 0x323, 0x42, 0x42,
+				0x331, 0x42, 0x62, 0x331, 0x63, 0x43, 0x327, 0x301,
+				0x63, 0x63, 0x327, 0x301, 0x42, 0x44, 0x307, 0x42,
+				0x64, 0x307, 0x42, 0x44, 0x323, 0x42, 0x64, 0x323,
+				0x42, 0x44, 0x331, 0x42, 0x64, 0x331, 0x42, 0x44,
+				0x327, 0x42, 0x64, 0x327, 0x42, 0x44, 0x32D, 0x42,
+				0x64, 0x32D, 0x63, 0x45, 0x304, 0x300, 0x63, 0x65,
+				0x304, 0x300, 0x63, 0x45, 0x304, 0x301, 0x63, 0x65,
+				0x304, 0x301, 0x42, 0x45, 0x32D, 0x42, 0x65, 0x32D,
+				0x42, 0x45, 0x330, 0x42, 0x65, 0x330, 0x63, 0x45,
+				0x327, 0x306, 0x63, 0x65, 0x327, 0x306, 0x42, 0x46,
+				0x307, 0x42, 0x66, 0x307, 0x42, 0x47, 0x304, 0x42,
+				0x67, 0x304, 0x42, 0x48, 0x307, 0x42, 0x68, 0x307,
+				0x42, 0x48, 0x323, 0x42, 0x68, 0x323, 0x42, 0x48,
+				0x308, 0x42, 0x68, 0x308, 0x42, 0x48, 0x327, 0x42,
+				0x68, 0x327, 0x42, 0x48, 0x32E, 0x42, 0x68, 0x32E,
+				0x42, 0x49, 0x330, 0x42, 0x69, 0x330, 0x63, 0x49,
+				0x308, 0x301, 0x63, 0x69, 0x308, 0x301, 0x42, 0x4B,
+				0x301, 0x42, 0x6B, 0x301, 0x42, 0x4B, 0x323, 0x42,
+				0x6B, 0x323, 0x42, 0x4B, 0x331, 0x42, 0x6B, 0x331,
+				0x42, 0x4C, 0x323, 0x42, 0x6C, 0x323, 0x63, 0x4C,
+				0x323, 0x304, 0x63, 0x6C, 0x323, 0x304, 0x42, 0x4C,
+				0x331, 0x42, 0x6C, 0x331, 0x42, 0x4C, 0x32D, 0x42,
+				0x6C, 0x32D, 0x42, 0x4D, 0x301, 0x42, 0x6D, 0x301,
+				0x42, 0x4D, 0x307, 0x42, 0x6D, 0x307, 0x42, 0x4D,
+				0x323, 0x42, 0x6D, 0x323, 0x42, 0x4E, 0x307, 0x42,
+				0x6E, 0x307, 0x42, 0x4E, 0x323, 0x42, 0x6E, 0x323,
+				0x42, 0x4E, 0x331, 0x42, 0x6E, 0x331, 0x42, 0x4E,
+				0x32D, 0x42, 0x6E, 0x32D, 0x63, 0x4F, 0x303, 0x301,
+				0x63, 0x6F, 0x303, 0x301, 0x63, 0x4F, 0x303, 0x308,
+				0x63, 0x6F, 0x303, 0x308, 0x63, 0x4F, 0x304, 0x300,
+				0x63, 0x6F, 0x304, 0x300, 0x63, 0x4F, 0x304, 0x301,
+				0x63, 0x6F, 0x304, 0x301, 0x42, 0x50, 0x301, 0x42,
+				0x70, 0x301, 0x42, 0x50, 0x307, 0x42, 0x70, 0x307,
+				0x42, 0x52, 0x307, 0x42, 0x72, 0x307, 0x42, 0x52,
+				0x323, 0x42, 0x72, 0x323, 0x63, 0x52, 0x323, 0x304,
+				0x63, 0x72, 0x323, 0x304, 0x42, 0x52, 0x331, 0x42,
+				0x72, 0x331, 0x42, 0x53, 0x307, 0x42, 0x73, 0x307,
+				0x42, 0x53, 0x323, 0x42, 0x73, 0x323, 0x63, 0x53,
+				0x301, 0x307, 0x63, 0x73, 0x301, 0x307, 0x63, 0x53,
+				0x30C, 0x307, 0x63, 0x73, 0x30C, 0x307, 0x63, 0x53,
+				0x323, 0x307, 0x63, 0x73, 0x323, 0x307, 0x42, 0x54,
+				0x307, 0x42, 0x74, 0x307, 0x42, 0x54, 0x323, 0x42,
+				0x74, 0x323, 0x42, 0x54, 0x331, 0x42, 0x74, 0x331,
+				0x42, 0x54, 0x32D, 0x42, 0x74, 0x32D, 0x42, 0x55,
+				0x324, 0x42, 0x75, 0x324, 0x42, 0x55, 0x330, 0x42,
+				0x75, 0x330, 0x42, 0x55, 0x32D, 0x42, 0x75, 0x32D,
+				0x63, 0x55, 0x303, 0x301, 0x63, 0x75, 0x303, 0x301,
+				0x63, 0x55, 0x304, 0x308, 0x63, 0x75, 0x304, 0x308,
+				0x42, 0x56, 0x303, 0x42, 0x76, 0x303, 0x42, 0x56,
+				0x323, 0x42, 0x76, 0x323, 0x42, 0x57, 0x300, 0x42,
+				0x77, 0x300, 0x42, 0x57, 0x301, 0x42, 0x77, 0x301,
+				0x42, 0x57, 0x308, 0x42, 0x77, 0x308, 0x42, 0x57,
+				0x307, 0x42, 0x77, 0x307, 0x42, 0x57, 0x323, 0x42,
+				0x77, 0x323, 0x42, 0x58, 0x307, 0x42, 0x78, 0x307,
+				0x42, 0x58, 0x308, 0x42, 0x78, 0x308, 0x42, 0x59,
+				0x307, 0x42, 0x79, 0x307, 0x42, 0x5A, 0x302, 0x42,
+				0x7A, 0x302, 0x42, 0x5A, 0x323, 0x42, 0x7A, 0x323,
+				0x42, 0x5A, 0x331, 0x42, 0x7A, 0x331, 0x42, 0x68,
+				0x331, 0x42, 0x74, 0x308, 0x42, 0x77, 0x30A, 0x42,
+				0x79, 0x30A, 0x840, 0x61, 0x2BE, 0x842, 0x17F, 0x307,
+				0x73, 0x307, 0x42, 0x41, 0x323, 0x42, 0x61, 0x323,
+				0x42, 0x41, 0x309, 0x42, 0x61, 0x309, 0x63, 0x41,
+				0x302, 0x301, 0x63, 0x61, 0x302, 0x301, 0x63, 0x41,
+				0x302, 0x300, 0x63, 0x61, 0x302, 0x300, 0x63, 0x41,
+				0x302, 0x309, 0x63, 0x61, 0x302, 0x309, 0x63, 0x41,
+				0x302, 0x303, 0x63, 0x61, 0x302, 0x303, 0x63, 0x41,
+				0x323, 0x302, 0x63, 0x61, 0x323, 0x302, 0x63, 0x41,
+				0x306, 0x301, 0x63, 0x61, 0x306, 0x301, 0x63, 0x41,
+				0x306, 0x300, 0x63, 0x61, 0x306, 0x300, 0x63, 0x41,
+				0x306, 0x309, 0x63, 0x61, 0x306, 0x309, 0x63, 0x41,
+				0x306, 0x303, 0x63, 0x61, 0x306, 0x303, 0x63, 0x41,
+				0x323, 0x306, 0x63, 0x61, 0x323, 0x306, 0x42, 0x45,
+				0x323, 0x42, 0x65, 0x323, 0x42, 0x45, 0x309, 0x42,
+				0x65, 0x309, 0x42, 0x45, 0x303, 0x42, 0x65, 0x303,
+				0x63, 0x45, 0x302, 0x301, 0x63, 0x65, 0x302, 0x301,
+				0x63, 0x45, 0x302, 0x300, 0x63, 0x65, 0x302, 0x300,
+				0x63, 0x45, 0x302, 0x309, 0x63, 0x65, 0x302, 0x309,
+				0x63, 0x45, 0x302, 0x303, 0x63, 0x65, 0x302, 0x303,
+				0x63, 0x45, 0x323, 0x302, 0x63, 0x65, 0x323, 0x302,
+				0x42, 0x49, 0x309, 0x42, 0x69, 0x309, 0x42, 0x49,
+				0x323, 0x42, 0x69, 0x323, 0x42, 0x4F, 0x323, 0x42,
+				0x6F, 0x323, 0x42, 0x4F, 0x309, 0x42, 0x6F, 0x309,
+				0x63, 0x4F, 0x302, 0x301, 0x63, 0x6F, 0x302, 0x301,
+				0x63, 0x4F, 0x302, 0x300, 0x63, 0x6F, 0x302, 0x300,
+				0x63, 0x4F, 0x302, 0x309, 0x63, 0x6F, 0x302, 0x309,
+				0x63, 0x4F, 0x302, 0x303, 0x63, 0x6F, 0x302, 0x303,
+				0x63, 0x4F, 0x323, 0x302, 0x63, 0x6F, 0x323, 0x302,
+				0x63, 0x4F, 0x31B, 0x301, 0x63, 0x6F, 0x31B, 0x301,
+				0x63, 0x4F, 0x31B, 0x300, 0x63, 0x6F, 0x31B, 0x300,
+				0x63, 0x4F, 0x31B, 0x309, 0x63, 0x6F, 0x31B, 0x309,
+				0x63, 0x4F, 0x31B, 0x303, 0x63, 0x6F, 0x31B, 0x303,
+				0x63, 0x4F, 0x31B, 0x323, 0x63, 0x6F, 0x31B, 0x323,
+				0x42, 0x55, 0x323, 0x42, 0x75, 0x323, 0x42, 0x55,
+				0x309, 0x42, 0x75, 0x309, 0x63, 0x55, 0x31B, 0x301,
+				0x63, 0x75, 0x31B, 0x301, 0x63, 0x55, 0x31B, 0x300,
+				0x63, 0x75, 0x31B, 0x300, 0x63, 0x55, 0x31B, 0x309,
+				0x63, 0x75, 0x31B, 0x309, 0x63, 0x55, 0x31B, 0x303,
+				0x63, 0x75, 0x31B, 0x303, 0x63, 0x55, 0x31B, 0x323,
+				0x63, 0x75, 0x31B, 0x323, 0x42, 0x59, 0x300, 0x42,
+				0x79, 0x300, 0x42, 0x59, 0x323, 0x42, 0x79, 0x323,
+				0x42, 0x59, 0x309, 0x42, 0x79, 0x309, 0x42, 0x59,
+				0x303, 0x42, 0x79, 0x303, 0x42, 0x3B1, 0x313, 0x42,
+				0x3B1, 0x314, 0x63, 0x3B1, 0x313, 0x300, 0x63, 0x3B1,
+				0x314, 0x300, 0x63, 0x3B1, 0x313, 0x301, 0x63, 0x3B1,
+				0x314, 0x301, 0x63, 0x3B1, 0x313, 0x342, 0x63, 0x3B1,
+				0x314, 0x342, 0x42, 0x391, 0x313, 0x42, 0x391, 0x314,
+				0x63, 0x391, 0x313, 0x300, 0x63, 0x391, 0x314, 0x300,
+				0x63, 0x391, 0x313, 0x301, 0x63, 0x391, 0x314, 0x301,
+				0x63, 0x391, 0x313, 0x342, 0x63, 0x391, 0x314, 0x342,
+				0x42, 0x3B5, 0x313, 0x42, 0x3B5, 0x314, 0x63, 0x3B5,
+				0x313, 0x300, 0x63, 0x3B5, 0x314, 0x300, 0x63, 0x3B5,
+				0x313, 0x301, 0x63, 0x3B5, 0x314, 0x301, 0x42, 0x395,
+				0x313, 0x42, 0x395, 0x314, 0x63, 0x395, 0x313, 0x300,
+				0x63, 0x395, 0x314, 0x300, 0x63, 0x395, 0x313, 0x301,
+				0x63, 0x395, 0x314, 0x301, 0x42, 0x3B7, 0x313, 0x42,
+				0x3B7, 0x314, 0x63, 0x3B7, 0x313, 0x300, 0x63, 0x3B7,
+				0x314, 0x300, 0x63, 0x3B7, 0x313, 0x301, 0x63, 0x3B7,
+				0x314, 0x301, 0x63, 0x3B7, 0x313, 0x342, 0x63, 0x3B7,
+				0x314, 0x342, 0x42, 0x397, 0x313, 0x42, 0x397, 0x314,
+				0x63, 0x397, 0x313, 0x300, 0x63, 0x397, 0x314, 0x300,
+				0x63, 0x397, 0x313, 0x301, 0x63, 0x397, 0x314, 0x301,
+				0x63, 0x397, 0x313, 0x342, 0x63, 0x397, 0x314, 0x342,
+				0x42, 0x3B9, 0x313, 0x42, 0x3B9, 0x314, 0x63, 0x3B9,
+				0x313, 0x300, 0x63, 0x3B9, 0x314, 0x300, 0x63, 0x3B9,
+				0x313, 0x301, 0x63, 0x3B9, 0x314, 0x301, 0x63, 0x3B9,
+				0x313, 0x342, 0x63, 0x3B9, 0x314, 0x342, 0x42, 0x399,
+				0x313, 0x42, 0x399, 0x314, 0x63, 0x399, 0x313, 0x300,
+				0x63, 0x399, 0x314, 0x300, 0x63, 0x399, 0x313, 0x301,
+				0x63, 0x399, 0x314, 0x301, 0x63, 0x399, 0x313, 0x342,
+				0x63, 0x399, 0x314, 0x342, 0x42, 0x3BF, 0x313, 0x42,
+				0x3BF, 0x314, 0x63, 0x3BF, 0x313, 0x300, 0x63, 0x3BF,
+				0x314, 0x300, 0x63, 0x3BF, 0x313, 0x301, 0x63, 0x3BF,
+				0x314, 0x301, 0x42, 0x39F, 0x313, 0x42, 0x39F, 0x314,
+				0x63, 0x39F, 0x313, 0x300, 0x63, 0x39F, 0x314, 0x300,
+				0x63, 0x39F, 0x313, 0x301, 0x63, 0x39F, 0x314, 0x301,
+				0x42, 0x3C5, 0x313, 0x42, 0x3C5, 0x314, 0x63, 0x3C5,
+				0x313, 0x300, 0x63, 0x3C5, 0x314, 0x300, 0x63, 0x3C5,
+				0x313, 0x301, 0x63, 0x3C5, 0x314, 0x301, 0x63, 0x3C5,
+				0x313, 0x342, 0x63, 0x3C5, 0x314, 0x342, 0x42, 0x3A5,
+				0x314, 0x63, 0x3A5, 0x314, 0x300, 0x63, 0x3A5, 0x314,
+				0x301, 0x63, 0x3A5, 0x314, 0x342, 0x42, 0x3C9, 0x313,
+				0x42, 0x3C9, 0x314, 0x63, 0x3C9, 0x313, 0x300, 0x63,
+				0x3C9, 0x314, 0x300, 0x63, 0x3C9, 0x313, 0x301, 0x63,
+				0x3C9, 0x314, 0x301, 0x63, 0x3C9, 0x313, 0x342, 0x63,
+				0x3C9, 0x314, 0x342, 0x42, 0x3A9, 0x313, 0x42, 0x3A9,
+				0x314, 0x63, 0x3A9, 0x313, 0x300, 0x63, 0x3A9, 0x314,
+				0x300, 0x63, 0x3A9, 0x313, 0x301, 0x63, 0x3A9, 0x314,
+				0x301, 0x63, 0x3A9, 0x313, 0x342, 0x63, 0x3A9, 0x314,
+				0x342, 0x42, 0x3B1, 0x300, 0x42, 0x3B1, 0x301, 0x42,
+				0x3B5, 0x300, 0x42, 0x3B5, 0x301, 0x42, 0x3B7, 0x300,
+				0x42, 0x3B7, 0x301, 0x42, 0x3B9, 0x300, 0x42, 0x3B9,
+				0x301, 0x42, 0x3BF, 0x300, 0x42, 0x3BF, 0x301, 0x42,
+				0x3C5, 0x300, 0x42, 0x3C5, 0x301, 0x42, 0x3C9, 0x300,
+				0x42, 0x3C9, 0x301, 0x63, 0x3B1, 0x313, 0x345, 0x63,
+				0x3B1, 0x314, 0x345, 0x84, 0x3B1, 0x313, 0x300, 0x345,
+				0x84, 0x3B1, 0x314, 0x300, 0x345, 0x84, 0x3B1, 0x313,
+				0x301, 0x345, 0x84, 0x3B1, 0x314, 0x301, 0x345, 0x84,
+				0x3B1, 0x313, 0x342, 0x345, 0x84, 0x3B1, 0x314, 0x342,
+				0x345, 0x63, 0x391, 0x313, 0x345, 0x63, 0x391, 0x314,
+				0x345, 0x84, 0x391, 0x313, 0x300, 0x345, 0x84, 0x391,
+				0x314, 0x300, 0x345, 0x84, 0x391, 0x313, 0x301, 0x345,
+				0x84, 0x391, 0x314, 0x301, 0x345, 0x84, 0x391, 0x313,
+				0x342, 0x345, 0x84, 0x391, 0x314, 0x342, 0x345, 0x63,
+				0x3B7, 0x313, 0x345, 0x63, 0x3B7, 0x314, 0x345, 0x84,
+				0x3B7, 0x313, 0x300, 0x345, 0x84, 0x3B7, 0x314, 0x300,
+				0x345, 0x84, 0x3B7, 0x313, 0x301, 0x345, 0x84, 0x3B7,
+				0x314, 0x301, 0x345, 0x84, 0x3B7, 0x313, 0x342, 0x345,
+				0x84, 0x3B7, 0x314, 0x342, 0x345, 0x63, 0x397, 0x313,
+				0x345, 0x63, 0x397, 0x314, 0x345, 0x84, 0x397, 0x313,
+				0x300, 0x345, 0x84, 0x397, 0x314, 0x300, 0x345, 0x84,
+				0x397, 0x313, 0x301, 0x345, 0x84, 0x397, 0x314, 0x301,
+				0x345, 0x84, 0x397, 0x313, 0x342, 0x345, 0x84, 0x397,
+				0x314, 0x342, 0x345, 0x63, 0x3C9, 0x313, 0x345, 0x63,
+				0x3C9, 0x314, 0x345, 0x84, 0x3C9, 0x313, 0x300, 0x345,
+				0x84, 0x3C9, 0x314, 0x300, 0x345, 0x84, 0x3C9, 0x313,
+				0x301, 0x345, 0x84, 0x3C9, 0x314, 0x301, 0x345, 0x84,
+				0x3C9, 0x313, 0x342, 0x345, 0x84, 0x3C9, 0x314, 0x342,
+				0x345, 0x63, 0x3A9, 0x313, 0x345, 0x63, 0x3A9, 0x314,
+				0x345, 0x84, 0x3A9, 0x313, 0x300, 0x345, 0x84, 0x3A9,
+				0x314, 0x300, 0x345, 0x84, 0x3A9, 0x313, 0x301, 0x345,
+				0x84, 0x3A9, 0x314, 0x301, 0x345, 0x84, 0x3A9, 0x313,
+				0x342, 0x345, 0x84, 0x3A9, 0x314, 0x342, 0x345, 0x42,
+				0x3B1, 0x306, 0x42, 0x3B1, 0x304, 0x63, 0x3B1, 0x300,
+				0x345, 0x42, 0x3B1, 0x345, 0x63, 0x3B1, 0x301, 0x345,
+				0x42, 0x3B1, 0x342, 0x63, 0x3B1, 0x342, 0x345, 0x42,
+				0x391, 0x306, 0x42, 0x391, 0x304, 0x42, 0x391, 0x300,
+				0x42, 0x391, 0x301, 0x42, 0x391, 0x345, 0x840, 0x20,
+				0x313, 0x21, 0x3B9, 0x840, 0x20, 0x313, 0x840, 0x20,
+				0x342, 0x862, 0xA8, 0x342, 0x20, 0x308, 0x342, 0x63,
+				0x3B7, 0x300, 0x345, 0x42, 0x3B7, 0x345, 0x63, 0x3B7,
+				0x301, 0x345, 0x42, 0x3B7, 0x342, 0x63, 0x3B7, 0x342,
+				0x345, 0x42, 0x395, 0x300, 0x42, 0x395, 0x301, 0x42,
+				0x397, 0x300, 0x42, 0x397, 0x301, 0x42, 0x397, 0x345,
+				0x862, 0x1FBF, 0x300, 0x20, 0x313, 0x300, 0x862, 0x1FBF,
+				0x301, 0x20, 0x313, 0x301, 0x862, 0x1FBF, 0x342, 0x20,
+				0x313, 0x342, 0x42, 0x3B9, 0x306, 0x42, 0x3B9, 0x304,
+				0x63, 0x3B9, 0x308, 0x300, 0x63, 0x3B9, 0x308, 0x301,
+				0x42, 0x3B9, 0x342, 0x63, 0x3B9, 0x308, 0x342, 0x42,
+				0x399, 0x306, 0x42, 0x399, 0x304, 0x42, 0x399, 0x300,
+				0x42, 0x399, 0x301, 0x862, 0x1FFE, 0x300, 0x20, 0x314,
+				0x300, 0x862, 0x1FFE, 0x301, 0x20, 0x314, 0x301, 0x862,
+				0x1FFE, 0x342, 0x20, 0x314, 0x342, 0x42, 0x3C5, 0x306,
+				0x42, 0x3C5, 0x304, 0x63, 0x3C5, 0x308, 0x300, 0x63,
+				0x3C5, 0x308, 0x301, 0x42, 0x3C1, 0x313, 0x42, 0x3C1,
+				0x314, 0x42, 0x3C5, 0x342, 0x63, 0x3C5, 0x308, 0x342,
+				0x42, 0x3A5, 0x306, 0x42, 0x3A5, 0x304, 0x42, 0x3A5,
+				0x300, 0x42, 0x3A5, 0x301, 0x42, 0x3A1, 0x314, 0x862,
+				0xA8, 0x300, 0x20, 0x308, 0x300, 0x862, 0xA8, 0x301,
+				0x20, 0x308, 0x301, 0x21, 0x60, 0x63, 0x3C9, 0x300,
+				0x345, 0x42, 0x3C9, 0x345, 0x63, 0x3C9, 0x301, 0x345,
+				0x42, 0x3C9, 0x342, 0x63, 0x3C9, 0x342, 0x345, 0x42,
+				0x39F, 0x300, 0x42, 0x39F, 0x301, 0x42, 0x3A9, 0x300,
+				0x42, 0x3A9, 0x301, 0x42, 0x3A9, 0x345, 0x841, 0xB4,
+				0x20, 0x301, 0x840, 0x20, 0x314, 0x821, 0x2002, 0x20,
+				0x821, 0x2003, 0x20, 0x820, 0x20, 0x820, 0x20, 0x820,
+				0x20, 0x820, 0x20, 0x820, 0x20, 0x820, 0x20, 0x820,
+				0x20, 0x820, 0x20, 0x820, 0x20, 0x820, 0x2010, 0x840,
+				0x20, 0x333, 0x820, 0x2E, 0x840, 0x2E, 0x2E, 0x860,
+				0x2E, 0x2E, 0x2E, 0x820, 0x20, 0x840, 0x2032, 0x2032,
+				0x860, 0x2032, 0x2032, 0x2032, 0x840, 0x2035, 0x2035, 0x860,
+				0x2035, 0x2035, 0x2035, 0x840, 0x21, 0x21, 0x840, 0x20,
+				0x305, 0x840, 0x3F, 0x3F, 0x840, 0x3F, 0x21, 0x840,
+				0x21, 0x3F, 0x880, 0x2032, 0x2032, 0x2032, 0x2032, 0x820,
+				0x20, 0x820, 0x30, 0x820, 0x69, 0x820, 0x34, 0x820,
+				0x35, 0x820, 0x36, 0x820, 0x37, 0x820, 0x38, 0x820,
+				0x39, 0x820, 0x2B, 0x820, 0x2212, 0x820, 0x3D, 0x820,
+				0x28, 0x820, 0x29, 0x820, 0x6E, 0x820, 0x30, 0x820,
+				0x31, 0x820, 0x32, 0x820, 0x33, 0x820, 0x34, 0x820,
+				0x35, 0x820, 0x36, 0x820, 0x37, 0x820, 0x38, 0x820,
+				0x39, 0x820, 0x2B, 0x820, 0x2212, 0x820, 0x3D, 0x820,
+				0x28, 0x820, 0x29, 0x820, 0x61, 0x820, 0x65, 0x820,
+				0x6F, 0x820, 0x78, 0x820, 0x259, 0x820, 0x68, 0x820,
+				0x6B, 0x820, 0x6C, 0x820, 0x6D, 0x820, 0x6E, 0x820,
+				0x70, 0x820, 0x73, 0x820, 0x74, 0x840, 0x52, 0x73,
+				0x860, 0x61, 0x2F, 0x63, 0x860, 0x61, 0x2F, 0x73,
+				0x820, 0x43, 0x840, 0xB0, 0x43, 0x860, 0x63, 0x2F,
+				0x6F, 0x860, 0x63, 0x2F, 0x75, 0x820, 0x190, 0x840,
+				0xB0, 0x46, 0x820, 0x67, 0x820, 0x48, 0x820, 0x48,
+				0x820, 0x48, 0x820, 0x68, 0x820, 0x127, 0x820, 0x49,
+				0x820, 0x49, 0x820, 0x4C, 0x820, 0x6C, 0x820, 0x4E,
+				0x840, 0x4E, 0x6F, 0x820, 0x50, 0x820, 0x51, 0x820,
+				0x52, 0x820, 0x52, 0x820, 0x52, 0x840, 0x53, 0x4D,
+				0x860, 0x54, 0x45, 0x4C, 0x840, 0x54, 0x4D, 0x820,
+				0x5A, 0x21, 0x3A9, 0x820, 0x5A, 0x21, 0x4B, 0x42,
+				0x41, 0x30A, 0x820, 0x42, 0x820, 0x43, 0x820, 0x65,
+				0x820, 0x45, 0x820, 0x46, 0x820, 0x4D, 0x820, 0x6F,
+				0x820, 0x5D0, 0x820, 0x5D1, 0x820, 0x5D2, 0x820, 0x5D3,
+				0x820, 0x69, 0x860, 0x46, 0x41, 0x58, 0x820, 0x3C0,
+				0x820, 0x3B3, 0x820, 0x393, 0x820, 0x3A0, 0x820, 0x2211,
+				0x820, 0x44, 0x820, 0x64, 0x820, 0x65, 0x820, 0x69,
+				0x820, 0x6A, 0x860, 0x31, 0x2044, 0x37, 0x860, 0x31,
+				0x2044, 0x39, 0x880, 0x31, 0x2044, 0x31, 0x30, 0x860,
+				0x31, 0x2044, 0x33, 0x860, 0x32, 0x2044, 0x33, 0x860,
+				0x31, 0x2044, 0x35, 0x860, 0x32, 0x2044, 0x35, 0x860,
+				0x33, 0x2044, 0x35, 0x860, 0x34, 0x2044, 0x35, 0x860,
+				0x31, 0x2044, 0x36, 0x860, 0x35, 0x2044, 0x36, 0x860,
+				0x31, 0x2044, 0x38, 0x860, 0x33, 0x2044, 0x38, 0x860,
+				0x35, 0x2044, 0x38, 0x860, 0x37, 0x2044, 0x38, 0x840,
+				0x31, 0x2044, 0x820, 0x49, 0x840, 0x49, 0x49, 0x860,
+				0x49, 0x49, 0x49, 0x840, 0x49, 0x56, 0x820, 0x56,
+				0x840, 0x56, 0x49, 0x860, 0x56, 0x49, 0x49, 0x880,
+				0x56, 0x49, 0x49, 0x49, 0x840, 0x49, 0x58, 0x820,
+				0x58, 0x840, 0x58, 0x49, 0x860, 0x58, 0x49, 0x49,
+				0x820, 0x4C, 0x820, 0x43, 0x820, 0x44, 0x820, 0x4D,
+				0x820, 0x69, 0x840, 0x69, 0x69, 0x860, 0x69, 0x69,
+				0x69, 0x840, 0x69, 0x76, 0x820, 0x76, 0x840, 0x76,
+				0x69, 0x860, 0x76, 0x69, 0x69, 0x880, 0x76, 0x69,
+				0x69, 0x69, 0x840, 0x69, 0x78, 0x820, 0x78, 0x840,
+				0x78, 0x69, 0x860, 0x78, 0x69, 0x69, 0x820, 0x6C,
+				0x820, 0x63, 0x820, 0x64, 0x820, 0x6D, 0x860, 0x30,
+				0x2044, 0x33, 0x42, 0x2190, 0x338, 0x42, 0x2192, 0x338,
+				0x42, 0x2194, 0x338, 0x42, 0x21D0, 0x338, 0x42, 0x21D4,
+				0x338, 0x42, 0x21D2, 0x338, 0x42, 0x2203, 0x338, 0x42,
+				0x2208, 0x338, 0x42, 0x220B, 0x338, 0x42, 0x2223, 0x338,
+				0x42, 0x2225, 0x338, 0x840, 0x222B, 0x222B, 0x860, 0x222B,
+				0x222B, 0x222B, 0x840, 0x222E, 0x222E, 0x860, 0x222E, 0x222E,
+				0x222E, 0x42, 0x223C, 0x338, 0x42, 0x2243, 0x338, 0x42,
+				0x2245, 0x338, 0x42, 0x2248, 0x338, 0x42, 0x3D, 0x338,
+				0x42, 0x2261, 0x338, 0x42, 0x224D, 0x338, 0x42, 0x3C,
+				0x338, 0x42, 0x3E, 0x338, 0x42, 0x2264, 0x338, 0x42,
+				0x2265, 0x338, 0x42, 0x2272, 0x338, 0x42, 0x2273, 0x338,
+				0x42, 0x2276, 0x338, 0x42, 0x2277, 0x338, 0x42, 0x227A,
+				0x338, 0x42, 0x227B, 0x338, 0x42, 0x2282, 0x338, 0x42,
+				0x2283, 0x338, 0x42, 0x2286, 0x338, 0x42, 0x2287, 0x338,
+				0x42, 0x22A2, 0x338, 0x42, 0x22A8, 0x338, 0x42, 0x22A9,
+				0x338, 0x42, 0x22AB, 0x338, 0x42, 0x227C, 0x338, 0x42,
+				0x227D, 0x338, 0x42, 0x2291, 0x338, 0x42, 0x2292, 0x338,
+				0x42, 0x22B2, 0x338, 0x42, 0x22B3, 0x338, 0x42, 0x22B4,
+				0x338, 0x42, 0x22B5, 0x338, 0x21, 0x3008, 0x21, 0x3009,
+				0x820, 0x31, 0x820, 0x32, 0x820, 0x33, 0x820, 0x34,
+				0x820, 0x35, 0x820, 0x36, 0x820, 0x37, 0x820, 0x38,
+				0x820, 0x39, 0x840, 0x31, 0x30, 0x840, 0x31, 0x31,
+				0x840, 0x31, 0x32, 0x840, 0x31, 0x33, 0x840, 0x31,
+				0x34, 0x840, 0x31, 0x35, 0x840, 0x31, 0x36, 0x840,
+				0x31, 0x37, 0x840, 0x31, 0x38, 0x840, 0x31, 0x39,
+				0x840, 0x32, 0x30, 0x860, 0x28, 0x31, 0x29, 0x860,
+				0x28, 0x32, 0x29, 0x860, 0x28, 0x33, 0x29, 0x860,
+				0x28, 0x34, 0x29, 0x860, 0x28, 0x35, 0x29, 0x860,
+				0x28, 0x36, 0x29, 0x860, 0x28, 0x37, 0x29, 0x860,
+				0x28, 0x38, 0x29, 0x860, 0x28, 0x39, 0x29, 0x880,
+				0x28, 0x31, 0x30, 0x29, 0x880, 0x28, 0x31, 0x31,
+				0x29, 0x880, 0x28, 0x31, 0x32, 0x29, 0x880, 0x28,
+				0x31, 0x33, 0x29, 0x880, 0x28, 0x31, 0x34, 0x29,
+				0x880, 0x28, 0x31, 0x35, 0x29, 0x880, 0x28, 0x31,
+				0x36, 0x29, 0x880, 0x28, 0x31, 0x37, 0x29, 0x880,
+				0x28, 0x31, 0x38, 0x29, 0x880, 0x28, 0x31, 0x39,
+				0x29, 0x880, 0x28, 0x32, 0x30, 0x29, 0x840, 0x31,
+				0x2E, 0x840, 0x32, 0x2E, 0x840, 0x33, 0x2E, 0x840,
+				0x34, 0x2E, 0x840, 0x35, 0x2E, 0x840, 0x36, 0x2E,
+				0x840, 0x37, 0x2E, 0x840, 0x38, 0x2E, 0x840, 0x39,
+				0x2E, 0x860, 0x31, 0x30, 0x2E, 0x860, 0x31, 0x31,
+				0x2E, 0x860, 0x31, 0x32, 0x2E, 0x860, 0x31, 0x33,
+				0x2E, 0x860, 0x31, 0x34, 0x2E, 0x860, 0x31, 0x35,
+				0x2E, 0x860, 0x31, 0x36, 0x2E, 0x860, 0x31, 0x37,
+				0x2E, 0x860, 0x31, 0x38, 0x2E, 0x860, 0x31, 0x39,
+				0x2E, 0x860, 0x32, 0x30, 0x2E, 0x860, 0x28, 0x61,
+				0x29, 0x860, 0x28, 0x62, 0x29, 0x860, 0x28, 0x63,
+				0x29, 0x860, 0x28, 0x64, 0x29, 0x860, 0x28, 0x65,
+				0x29, 0x860, 0x28, 0x66, 0x29, 0x860, 0x28, 0x67,
+				0x29, 0x860, 0x28, 0x68, 0x29, 0x860, 0x28, 0x69,
+				0x29, 0x860, 0x28, 0x6A, 0x29, 0x860, 0x28, 0x6B,
+				0x29, 0x860, 0x28, 0x6C, 0x29, 0x860, 0x28, 0x6D,
+				0x29, 0x860, 0x28, 0x6E, 0x29, 0x860, 0x28, 0x6F,
+				0x29, 0x860, 0x28, 0x70, 0x29, 0x860, 0x28, 0x71,
+				0x29, 0x860, 0x28, 0x72, 0x29, 0x860, 0x28, 0x73,
+				0x29, 0x860, 0x28, 0x74, 0x29, 0x860, 0x28, 0x75,
+				0x29, 0x860, 0x28, 0x76, 0x29, 0x860, 0x28, 0x77,
+				0x29, 0x860, 0x28, 0x78, 0x29, 0x860, 0x28, 0x79,
+				0x29, 0x860, 0x28, 0x7A, 0x29, 0x820, 0x41, 0x820,
+				0x42, 0x820, 0x43, 0x820, 0x44, 0x820, 0x45, 0x820,
+				0x46, 0x820, 0x47, 0x820, 0x48, 0x820, 0x49, 0x820,
+				0x4A, 0x820, 0x4B, 0x820, 0x4C, 0x820, 0x4D, 0x820,
+				0x4E, 0x820, 0x4F, 0x820, 0x50, 0x820, 0x51, 0x820,
+				0x52, 0x820, 0x53, 0x820, 0x54, 0x820, 0x55, 0x820,
+				0x56, 0x820, 0x57, 0x820, 0x58, 0x820, 0x59, 0x820,
+				0x5A, 0x820, 0x61, 0x820, 0x62, 0x820, 0x63, 0x820,
+				0x64, 0x820, 0x65, 0x820, 0x66, 0x820, 0x67, 0x820,
+				0x68, 0x820, 0x69, 0x820, 0x6A, 0x820, 0x6B, 0x820,
+				0x6C, 0x820, 0x6D, 0x820, 0x6E, 0x820, 0x6F, 0x820,
+				0x70, 0x820, 0x71, 0x820, 0x72, 0x820, 0x73, 0x820,
+				0x74, 0x820, 0x75, 0x820, 0x76, 0x820, 0x77, 0x820,
+				0x78, 0x820, 0x79, 0x820, 0x7A, 0x820, 0x30, 0x880,
+				0x222B, 0x222B, 0x222B, 0x222B, 0x860, 0x3A, 0x3A, 0x3D,
+				0x840, 0x3D, 0x3D, 0x860, 0x3D, 0x3D, 0x3D, 0x42,
+				0x2ADD, 0x338, 0x820, 0x6A, 0x820, 0x56, 0x820, 0x2D61,
+				0x820, 0x6BCD, 0x820, 0x9F9F, 0x820, 0x4E00, 0x820, 0x4E28,
+				0x820, 0x4E36, 0x820, 0x4E3F, 0x820, 0x4E59, 0x820, 0x4E85,
+				0x820, 0x4E8C, 0x820, 0x4EA0, 0x820, 0x4EBA, 0x820, 0x513F,
+				0x820, 0x5165, 0x820, 0x516B, 0x820, 0x5182, 0x820, 0x5196,
+				0x820, 0x51AB, 0x820, 0x51E0, 0x820, 0x51F5, 0x820, 0x5200,
+				0x820, 0x529B, 0x820, 0x52F9, 0x820, 0x5315, 0x820, 0x531A,
+				0x820, 0x5338, 0x820, 0x5341, 0x820, 0x535C, 0x820, 0x5369,
+				0x820, 0x5382, 0x820, 0x53B6, 0x820, 0x53C8, 0x820, 0x53E3,
+				0x820, 0x56D7, 0x820, 0x571F, 0x820, 0x58EB, 0x820, 0x5902,
+				0x820, 0x590A, 0x820, 0x5915, 0x820, 0x5927, 0x820, 0x5973,
+				0x820, 0x5B50, 0x820, 0x5B80, 0x820, 0x5BF8, 0x820, 0x5C0F,
+				0x820, 0x5C22, 0x820, 0x5C38, 0x820, 0x5C6E, 0x820, 0x5C71,
+				0x820, 0x5DDB, 0x820, 0x5DE5, 0x820, 0x5DF1, 0x820, 0x5DFE,
+				0x820, 0x5E72, 0x820, 0x5E7A, 0x820, 0x5E7F, 0x820, 0x5EF4,
+				0x820, 0x5EFE, 0x820, 0x5F0B, 0x820, 0x5F13, 0x820, 0x5F50,
+				0x820, 0x5F61, 0x820, 0x5F73, 0x820, 0x5FC3, 0x820, 0x6208,
+				0x820, 0x6236, 0x820, 0x624B, 0x820, 0x652F, 0x820, 0x6534,
+				0x820, 0x6587, 0x820, 0x6597, 0x820, 0x65A4, 0x820, 0x65B9,
+				0x820, 0x65E0, 0x820, 0x65E5, 0x820, 0x66F0, 0x820, 0x6708,
+				0x820, 0x6728, 0x820, 0x6B20, 0x820, 0x6B62, 0x820, 0x6B79,
+				0x820, 0x6BB3, 0x820, 0x6BCB, 0x820, 0x6BD4, 0x820, 0x6BDB,
+				0x820, 0x6C0F, 0x820, 0x6C14, 0x820, 0x6C34, 0x820, 0x706B,
+				0x820, 0x722A, 0x820, 0x7236, 0x820, 0x723B, 0x820, 0x723F,
+				0x820, 0x7247, 0x820, 0x7259, 0x820, 0x725B, 0x820, 0x72AC,
+				0x820, 0x7384, 0x820, 0x7389, 0x820, 0x74DC, 0x820, 0x74E6,
+				0x820, 0x7518, 0x820, 0x751F, 0x820, 0x7528, 0x820, 0x7530,
+				0x820, 0x758B, 0x820, 0x7592, 0x820, 0x7676, 0x820, 0x767D,
+				0x820, 0x76AE, 0x820, 0x76BF, 0x820, 0x76EE, 0x820, 0x77DB,
+				0x820, 0x77E2, 0x820, 0x77F3, 0x820, 0x793A, 0x820, 0x79B8,
+				0x820, 0x79BE, 0x820, 0x7A74, 0x820, 0x7ACB, 0x820, 0x7AF9,
+				0x820, 0x7C73, 0x820, 0x7CF8, 0x820, 0x7F36, 0x820, 0x7F51,
+				0x820, 0x7F8A, 0x820, 0x7FBD, 0x820, 0x8001, 0x820, 0x800C,
+				0x820, 0x8012, 0x820, 0x8033, 0x820, 0x807F, 0x820, 0x8089,
+				0x820, 0x81E3, 0x820, 0x81EA, 0x820, 0x81F3, 0x820, 0x81FC,
+				0x820, 0x820C, 0x820, 0x821B, 0x820, 0x821F, 0x820, 0x826E,
+				0x820, 0x8272, 0x820, 0x8278, 0x820, 0x864D, 0x820, 0x866B,
+				0x820, 0x8840, 0x820, 0x884C, 0x820, 0x8863, 0x820, 0x897E,
+				0x820, 0x898B, 0x820, 0x89D2, 0x820, 0x8A00, 0x820, 0x8C37,
+				0x820, 0x8C46, 0x820, 0x8C55, 0x820, 0x8C78, 0x820, 0x8C9D,
+				0x820, 0x8D64, 0x820, 0x8D70, 0x820, 0x8DB3, 0x820, 0x8EAB,
+				0x820, 0x8ECA, 0x820, 0x8F9B, 0x820, 0x8FB0, 0x820, 0x8FB5,
+				0x820, 0x9091, 0x820, 0x9149, 0x820, 0x91C6, 0x820, 0x91CC,
+				0x820, 0x91D1, 0x820, 0x9577, 0x820, 0x9580, 0x820, 0x961C,
+				0x820, 0x96B6, 0x820, 0x96B9, 0x820, 0x96E8, 0x820, 0x9751,
+				0x820, 0x975E, 0x820, 0x9762, 0x820, 0x9769, 0x820, 0x97CB,
+				0x820, 0x97ED, 0x820, 0x97F3, 0x820, 0x9801, 0x820, 0x98A8,
+				0x820, 0x98DB, 0x820, 0x98DF, 0x820, 0x9996, 0x820, 0x9999,
+				0x820, 0x99AC, 0x820, 0x9AA8, 0x820, 0x9AD8, 0x820, 0x9ADF,
+				0x820, 0x9B25, 0x820, 0x9B2F, 0x820, 0x9B32, 0x820, 0x9B3C,
+				0x820, 0x9B5A, 0x820, 0x9CE5, 0x820, 0x9E75, 0x820, 0x9E7F,
+				0x820, 0x9EA5, 0x820, 0x9EBB, 0x820, 0x9EC3, 0x820, 0x9ECD,
+				0x820, 0x9ED1, 0x820, 0x9EF9, 0x820, 0x9EFD, 0x820, 0x9F0E,
+				0x820, 0x9F13, 0x820, 0x9F20, 0x820, 0x9F3B, 0x820, 0x9F4A,
+				0x820, 0x9F52, 0x820, 0x9F8D, 0x820, 0x9F9C, 0x820, 0x9FA0,
+				0x820, 0x20, 0x820, 0x3012, 0x820, 0x5341, 0x820, 0x5344,
+				0x820, 0x5345, 0x42, 0x304B, 0x3099, 0x42, 0x304D, 0x3099,
+				0x42, 0x304F, 0x3099, 0x42, 0x3051, 0x3099, 0x42, 0x3053,
+				0x3099, 0x42, 0x3055, 0x3099, 0x42, 0x3057, 0x3099, 0x42,
+				0x3059, 0x3099, 0x42, 0x305B, 0x3099, 0x42, 0x305D, 0x3099,
+				0x42, 0x305F, 0x3099, 0x42, 0x3061, 0x3099, 0x42, 0x3064,
+				0x3099, 0x42, 0x3066, 0x3099, 0x42, 0x3068, 0x3099, 0x42,
+				0x306F, 0x3099, 0x42, 0x306F, 0x309A, 0x42, 0x3072, 0x3099,
+				0x42, 0x3072, 0x309A, 0x42, 0x3075, 0x3099, 0x42, 0x3075,
+				0x309A, 0x42, 0x3078, 0x3099, 0x42, 0x3078, 0x309A, 0x42,
+				0x307B, 0x3099, 0x42, 0x307B, 0x309A, 0x42, 0x3046, 0x3099,
+				0x840, 0x20, 0x3099, 0x840, 0x20, 0x309A, 0x42, 0x309D,
+				0x3099, 0x840, 0x3088, 0x308A, 0x42, 0x30AB, 0x3099, 0x42,
+				0x30AD, 0x3099, 0x42, 0x30AF, 0x3099, 0x42, 0x30B1, 0x3099,
+				0x42, 0x30B3, 0x3099, 0x42, 0x30B5, 0x3099, 0x42, 0x30B7,
+				0x3099, 0x42, 0x30B9, 0x3099, 0x42, 0x30BB, 0x3099, 0x42,
+				0x30BD, 0x3099, 0x42, 0x30BF, 0x3099, 0x42, 0x30C1, 0x3099,
+				0x42, 0x30C4, 0x3099, 0x42, 0x30C6, 0x3099, 0x42, 0x30C8,
+				0x3099, 0x42, 0x30CF, 0x3099, 0x42, 0x30CF, 0x309A, 0x42,
+				0x30D2, 0x3099, 0x42, 0x30D2, 0x309A, 0x42, 0x30D5, 0x3099,
+				0x42, 0x30D5, 0x309A, 0x42, 0x30D8, 0x3099, 0x42, 0x30D8,
+				0x309A, 0x42, 0x30DB, 0x3099, 0x42, 0x30DB, 0x309A, 0x42,
+				0x30A6, 0x3099, 0x42, 0x30EF, 0x3099, 0x42, 0x30F0, 0x3099,
+				0x42, 0x30F1, 0x3099, 0x42, 0x30F2, 0x3099, 0x42, 0x30FD,
+				0x3099, 0x840, 0x30B3, 0x30C8, 0x820, 0x1100, 0x820, 0x1101,
+				0x820, 0x11AA, 0x820, 0x1102, 0x820, 0x11AC, 0x820, 0x11AD,
+				0x820, 0x1103, 0x820, 0x1104, 0x820, 0x1105, 0x820, 0x11B0,
+				0x820, 0x11B1, 0x820, 0x11B2, 0x820, 0x11B3, 0x820, 0x11B4,
+				0x820, 0x11B5, 0x820, 0x111A, 0x820, 0x1106, 0x820, 0x1107,
+				0x820, 0x1108, 0x820, 0x1121, 0x820, 0x1109, 0x820, 0x110A,
+				0x820, 0x110B, 0x820, 0x110C, 0x820, 0x110D, 0x820, 0x110E,
+				0x820, 0x110F, 0x820, 0x1110, 0x820, 0x1111, 0x820, 0x1112,
+				0x820, 0x1161, 0x820, 0x1162, 0x820, 0x1163, 0x820, 0x1164,
+				0x820, 0x1165, 0x820, 0x1166, 0x820, 0x1167, 0x820, 0x1168,
+				0x820, 0x1169, 0x820, 0x116A, 0x820, 0x116B, 0x820, 0x116C,
+				0x820, 0x116D, 0x820, 0x116E, 0x820, 0x116F, 0x820, 0x1170,
+				0x820, 0x1171, 0x820, 0x1172, 0x820, 0x1173, 0x820, 0x1174,
+				0x820, 0x1175, 0x820, 0x1160, 0x820, 0x1114, 0x820, 0x1115,
+				0x820, 0x11C7, 0x820, 0x11C8, 0x820, 0x11CC, 0x820, 0x11CE,
+				0x820, 0x11D3, 0x820, 0x11D7, 0x820, 0x11D9, 0x820, 0x111C,
+				0x820, 0x11DD, 0x820, 0x11DF, 0x820, 0x111D, 0x820, 0x111E,
+				0x820, 0x1120, 0x820, 0x1122, 0x820, 0x1123, 0x820, 0x1127,
+				0x820, 0x1129, 0x820, 0x112B, 0x820, 0x112C, 0x820, 0x112D,
+				0x820, 0x112E, 0x820, 0x112F, 0x820, 0x1132, 0x820, 0x1136,
+				0x820, 0x1140, 0x820, 0x1147, 0x820, 0x114C, 0x820, 0x11F1,
+				0x820, 0x11F2, 0x820, 0x1157, 0x820, 0x1158, 0x820, 0x1159,
+				0x820, 0x1184, 0x820, 0x1185, 0x820, 0x1188, 0x820, 0x1191,
+				0x820, 0x1192, 0x820, 0x1194, 0x820, 0x119E, 0x820, 0x11A1,
+				0x820, 0x4E00, 0x820, 0x4E8C, 0x820, 0x4E09, 0x820, 0x56DB,
+				0x820, 0x4E0A, 0x820, 0x4E2D, 0x820, 0x4E0B, 0x820, 0x7532,
+				0x820, 0x4E59, 0x820, 0x4E19, 0x820, 0x4E01, 0x820, 0x5929,
+				0x820, 0x5730, 0x820, 0x4EBA, 0x860, 0x28, 0x1100, 0x29,
+				0x860, 0x28, 0x1102, 0x29, 0x860, 0x28, 0x1103, 0x29,
+				0x860, 0x28, 0x1105, 0x29, 0x860, 0x28, 0x1106, 0x29,
+				0x860, 0x28, 0x1107, 0x29, 0x860, 0x28, 0x1109, 0x29,
+				0x860, 0x28, 0x110B, 0x29, 0x860, 0x28, 0x110C, 0x29,
+				0x860, 0x28, 0x110E, 0x29, 0x860, 0x28, 0x110F, 0x29,
+				0x860, 0x28, 0x1110, 0x29, 0x860, 0x28, 0x1111, 0x29,
+				0x860, 0x28, 0x1112, 0x29, 0x880, 0x28, 0x1100, 0x1161,
+				0x29, 0x880, 0x28, 0x1102, 0x1161, 0x29, 0x880, 0x28,
+				0x1103, 0x1161, 0x29, 0x880, 0x28, 0x1105, 0x1161, 0x29,
+				0x880, 0x28, 0x1106, 0x1161, 0x29, 0x880, 0x28, 0x1107,
+				0x1161, 0x29, 0x880, 0x28, 0x1109, 0x1161, 0x29, 0x880,
+				0x28, 0x110B, 0x1161, 0x29, 0x880, 0x28, 0x110C, 0x1161,
+				0x29, 0x880, 0x28, 0x110E, 0x1161, 0x29, 0x880, 0x28,
+				0x110F, 0x1161, 0x29, 0x880, 0x28, 0x1110, 0x1161, 0x29,
+				0x880, 0x28, 0x1111, 0x1161, 0x29, 0x880, 0x28, 0x1112,
+				0x1161, 0x29, 0x880, 0x28, 0x110C, 0x116E, 0x29, 0x8E0,
+				0x28, 0x110B, 0x1169, 0x110C, 0x1165, 0x11AB, 0x29, 0x8C0,
+				0x28, 0x110B, 0x1169, 0x1112, 0x116E, 0x29, 0x860, 0x28,
+				0x4E00, 0x29, 0x860, 0x28, 0x4E8C, 0x29, 0x860, 0x28,
+				0x4E09, 0x29, 0x860, 0x28, 0x56DB, 0x29, 0x860, 0x28,
+				0x4E94, 0x29, 0x860, 0x28, 0x516D, 0x29, 0x860, 0x28,
+				0x4E03, 0x29, 0x860, 0x28, 0x516B, 0x29, 0x860, 0x28,
+				0x4E5D, 0x29, 0x860, 0x28, 0x5341, 0x29, 0x860, 0x28,
+				0x6708, 0x29, 0x860, 0x28, 0x706B, 0x29, 0x860, 0x28,
+				0x6C34, 0x29, 0x860, 0x28, 0x6728, 0x29, 0x860, 0x28,
+				0x91D1, 0x29, 0x860, 0x28, 0x571F, 0x29, 0x860, 0x28,
+				0x65E5, 0x29, 0x860, 0x28, 0x682A, 0x29, 0x860, 0x28,
+				0x6709, 0x29, 0x860, 0x28, 0x793E, 0x29, 0x860, 0x28,
+				0x540D, 0x29, 0x860, 0x28, 0x7279, 0x29, 0x860, 0x28,
+				0x8CA1, 0x29, 0x860, 0x28, 0x795D, 0x29, 0x860, 0x28,
+				0x52B4, 0x29, 0x860, 0x28, 0x4EE3, 0x29, 0x860, 0x28,
+				0x547C, 0x29, 0x860, 0x28, 0x5B66, 0x29, 0x860, 0x28,
+				0x76E3, 0x29, 0x860, 0x28, 0x4F01, 0x29, 0x860, 0x28,
+				0x8CC7, 0x29, 0x860, 0x28, 0x5354, 0x29, 0x860, 0x28,
+				0x796D, 0x29, 0x860, 0x28, 0x4F11, 0x29, 0x860, 0x28,
+				0x81EA, 0x29, 0x860, 0x28, 0x81F3, 0x29, 0x820, 0x554F,
+				0x820, 0x5E7C, 0x820, 0x6587, 0x820, 0x7B8F, 0x860, 0x50,
+				0x54, 0x45, 0x840, 0x32, 0x31, 0x840, 0x32, 0x32,
+				0x840, 0x32, 0x33, 0x840, 0x32, 0x34, 0x840, 0x32,
+				0x35, 0x840, 0x32, 0x36, 0x840, 0x32, 0x37, 0x840,
+				0x32, 0x38, 0x840, 0x32, 0x39, 0x840, 0x33, 0x30,
+				0x840, 0x33, 0x31, 0x840, 0x33, 0x32, 0x840, 0x33,
+				0x33, 0x840, 0x33, 0x34, 0x840, 0x33, 0x35, 0x820,
+				0x1100, 0x820, 0x1102, 0x820, 0x1103, 0x820, 0x1105, 0x820,
+				0x1106, 0x820, 0x1107, 0x820, 0x1109, 0x820, 0x110B, 0x820,
+				0x110C, 0x820, 0x110E, 0x820, 0x110F, 0x820, 0x1110, 0x820,
+				0x1111, 0x820, 0x1112, 0x840, 0x1100, 0x1161, 0x840, 0x1102,
+				0x1161, 0x840, 0x1103, 0x1161, 0x840, 0x1105, 0x1161, 0x840,
+				0x1106, 0x1161, 0x840, 0x1107, 0x1161, 0x840, 0x1109, 0x1161,
+				0x840, 0x110B, 0x1161, 0x840, 0x110C, 0x1161, 0x840, 0x110E,
+				0x1161, 0x840, 0x110F, 0x1161, 0x840, 0x1110, 0x1161, 0x840,
+				0x1111, 0x1161, 0x840, 0x1112, 0x1161, 0x8A0, 0x110E, 0x1161,
+				0x11B7, 0x1100, 0x1169, 0x880, 0x110C, 0x116E, 0x110B, 0x1174,
+				0x840, 0x110B, 0x116E, 0x820, 0x4E00, 0x820, 0x4E8C, 0x820,
+				0x4E09, 0x820, 0x56DB, 0x820, 0x4E94, 0x820, 0x516D, 0x820,
+				0x4E03, 0x820, 0x516B, 0x820, 0x4E5D, 0x820, 0x5341, 0x820,
+				0x6708, 0x820, 0x706B, 0x820, 0x6C34, 0x820, 0x6728, 0x820,
+				0x91D1, 0x820, 0x571F, 0x820, 0x65E5, 0x820, 0x682A, 0x820,
+				0x6709, 0x820, 0x793E, 0x820, 0x540D, 0x820, 0x7279, 0x820,
+				0x8CA1, 0x820, 0x795D, 0x820, 0x52B4, 0x820, 0x79D8, 0x820,
+				0x7537, 0x820, 0x5973, 0x820, 0x9069, 0x820, 0x512A, 0x820,
+				0x5370, 0x820, 0x6CE8, 0x820, 0x9805, 0x820, 0x4F11, 0x820,
+				0x5199, 0x820, 0x6B63, 0x820, 0x4E0A, 0x820, 0x4E2D, 0x820,
+				0x4E0B, 0x820, 0x5DE6, 0x820, 0x53F3, 0x820, 0x533B, 0x820,
+				0x5B97, 0x820, 0x5B66, 0x820, 0x76E3, 0x820, 0x4F01, 0x820,
+				0x8CC7, 0x820, 0x5354, 0x820, 0x591C, 0x840, 0x33, 0x36,
+				0x840, 0x33, 0x37, 0x840, 0x33, 0x38, 0x840, 0x33,
+				0x39, 0x840, 0x34, 0x30, 0x840, 0x34, 0x31, 0x840,
+				0x34, 0x32, 0x840, 0x34, 0x33, 0x840, 0x34, 0x34,
+				0x840, 0x34, 0x35, 0x840, 0x34, 0x36, 0x840, 0x34,
+				0x37, 0x840, 0x34, 0x38, 0x840, 0x34, 0x39, 0x840,
+				0x35, 0x30, 0x840, 0x31, 0x6708, 0x840, 0x32, 0x6708,
+				0x840, 0x33, 0x6708, 0x840, 0x34, 0x6708, 0x840, 0x35,
+				0x6708, 0x840, 0x36, 0x6708, 0x840, 0x37, 0x6708, 0x840,
+				0x38, 0x6708, 0x840, 0x39, 0x6708, 0x860, 0x31, 0x30,
+				0x6708, 0x860, 0x31, 0x31, 0x6708, 0x860, 0x31, 0x32,
+				0x6708, 0x840, 0x48, 0x67, 0x860, 0x65, 0x72, 0x67,
+				0x840, 0x65, 0x56, 0x860, 0x4C, 0x54, 0x44, 0x820,
+				0x30A2, 0x820, 0x30A4, 0x820, 0x30A6, 0x820, 0x30A8, 0x820,
+				0x30AA, 0x820, 0x30AB, 0x820, 0x30AD, 0x820, 0x30AF, 0x820,
+				0x30B1, 0x820, 0x30B3, 0x820, 0x30B5, 0x820, 0x30B7, 0x820,
+				0x30B9, 0x820, 0x30BB, 0x820, 0x30BD, 0x820, 0x30BF, 0x820,
+				0x30C1, 0x820, 0x30C4, 0x820, 0x30C6, 0x820, 0x30C8, 0x820,
+				0x30CA, 0x820, 0x30CB, 0x820, 0x30CC, 0x820, 0x30CD, 0x820,
+				0x30CE, 0x820, 0x30CF, 0x820, 0x30D2, 0x820, 0x30D5, 0x820,
+				0x30D8, 0x820, 0x30DB, 0x820, 0x30DE, 0x820, 0x30DF, 0x820,
+				0x30E0, 0x820, 0x30E1, 0x820, 0x30E2, 0x820, 0x30E4, 0x820,
+				0x30E6, 0x820, 0x30E8, 0x820, 0x30E9, 0x820, 0x30EA, 0x820,
+				0x30EB, 0x820, 0x30EC, 0x820, 0x30ED, 0x820, 0x30EF, 0x820,
+				0x30F0, 0x820, 0x30F1, 0x820, 0x30F2, 0x840, 0x4EE4, 0x548C,
+				0x8A0, 0x30A2, 0x30CF, 0x309A, 0x30FC, 0x30C8, 0x880, 0x30A2,
+				0x30EB, 0x30D5, 0x30A1, 0x8A0, 0x30A2, 0x30F3, 0x30D8, 0x309A,
+				0x30A2, 0x860, 0x30A2, 0x30FC, 0x30EB, 0x8A0, 0x30A4, 0x30CB,
+				0x30F3, 0x30AF, 0x3099, 0x860, 0x30A4, 0x30F3, 0x30C1, 0x860,
+				0x30A6, 0x30A9, 0x30F3, 0x8C0, 0x30A8, 0x30B9, 0x30AF, 0x30FC,
+				0x30C8, 0x3099, 0x880, 0x30A8, 0x30FC, 0x30AB, 0x30FC, 0x860,
+				0x30AA, 0x30F3, 0x30B9, 0x860, 0x30AA, 0x30FC, 0x30E0, 0x860,
+				0x30AB, 0x30A4, 0x30EA, 0x880, 0x30AB, 0x30E9, 0x30C3, 0x30C8,
+				0x880, 0x30AB, 0x30ED, 0x30EA, 0x30FC, 0x880, 0x30AB, 0x3099,
+				0x30ED, 0x30F3, 0x880, 0x30AB, 0x3099, 0x30F3, 0x30DE, 0x880,
+				0x30AD, 0x3099, 0x30AB, 0x3099, 0x880, 0x30AD, 0x3099, 0x30CB,
+				0x30FC, 0x880, 0x30AD, 0x30E5, 0x30EA, 0x30FC, 0x8C0, 0x30AD,
+				0x3099, 0x30EB, 0x30BF, 0x3099, 0x30FC, 0x840, 0x30AD, 0x30ED,
+				0x8C0, 0x30AD, 0x30ED, 0x30AF, 0x3099, 0x30E9, 0x30E0, 0x8C0,
+				0x30AD, 0x30ED, 0x30E1, 0x30FC, 0x30C8, 0x30EB, 0x8A0, 0x30AD,
+				0x30ED, 0x30EF, 0x30C3, 0x30C8, 0x880, 0x30AF, 0x3099, 0x30E9,
+				0x30E0, 0x8C0, 0x30AF, 0x3099, 0x30E9, 0x30E0, 0x30C8, 0x30F3,
+				0x8C0, 0x30AF, 0x30EB, 0x30BB, 0x3099, 0x30A4, 0x30ED, 0x880,
+				0x30AF, 0x30ED, 0x30FC, 0x30CD, 0x860, 0x30B1, 0x30FC, 0x30B9,
+				0x860, 0x30B3, 0x30EB, 0x30CA, 0x880, 0x30B3, 0x30FC, 0x30DB,
+				0x309A, 0x880, 0x30B5, 0x30A4, 0x30AF, 0x30EB, 0x8A0, 0x30B5,
+				0x30F3, 0x30C1, 0x30FC, 0x30E0, 0x8A0, 0x30B7, 0x30EA, 0x30F3,
+				0x30AF, 0x3099, 0x860, 0x30BB, 0x30F3, 0x30C1, 0x860, 0x30BB,
+				0x30F3, 0x30C8, 0x880, 0x30BF, 0x3099, 0x30FC, 0x30B9, 0x860,
+				0x30C6, 0x3099, 0x30B7, 0x860, 0x30C8, 0x3099, 0x30EB, 0x840,
+				0x30C8, 0x30F3, 0x840, 0x30CA, 0x30CE, 0x860, 0x30CE, 0x30C3,
+				0x30C8, 0x860, 0x30CF, 0x30A4, 0x30C4, 0x8C0, 0x30CF, 0x309A,
+				0x30FC, 0x30BB, 0x30F3, 0x30C8, 0x880, 0x30CF, 0x309A, 0x30FC,
+				0x30C4, 0x8A0, 0x30CF, 0x3099, 0x30FC, 0x30EC, 0x30EB, 0x8C0,
+				0x30D2, 0x309A, 0x30A2, 0x30B9, 0x30C8, 0x30EB, 0x880, 0x30D2,
+				0x309A, 0x30AF, 0x30EB, 0x860, 0x30D2, 0x309A, 0x30B3, 0x860,
+				0x30D2, 0x3099, 0x30EB, 0x8C0, 0x30D5, 0x30A1, 0x30E9, 0x30C3,
+				0x30C8, 0x3099, 0x880, 0x30D5, 0x30A3, 0x30FC, 0x30C8, 0x8C0,
+				0x30D5, 0x3099, 0x30C3, 0x30B7, 0x30A7, 0x30EB, 0x860, 0x30D5,
+				0x30E9, 0x30F3, 0x8A0, 0x30D8, 0x30AF, 0x30BF, 0x30FC, 0x30EB,
+				0x860, 0x30D8, 0x309A, 0x30BD, 0x880, 0x30D8, 0x309A, 0x30CB,
+				0x30D2, 0x860, 0x30D8, 0x30EB, 0x30C4, 0x880, 0x30D8, 0x309A,
+				0x30F3, 0x30B9, 0x8A0, 0x30D8, 0x309A, 0x30FC, 0x30B7, 0x3099,
+				0x880, 0x30D8, 0x3099, 0x30FC, 0x30BF, 0x8A0, 0x30DB, 0x309A,
+				0x30A4, 0x30F3, 0x30C8, 0x880, 0x30DB, 0x3099, 0x30EB, 0x30C8,
+				0x840, 0x30DB, 0x30F3, 0x8A0, 0x30DB, 0x309A, 0x30F3, 0x30C8,
+				0x3099, 0x860, 0x30DB, 0x30FC, 0x30EB, 0x860, 0x30DB, 0x30FC,
+				0x30F3, 0x880, 0x30DE, 0x30A4, 0x30AF, 0x30ED, 0x860, 0x30DE,
+				0x30A4, 0x30EB, 0x860, 0x30DE, 0x30C3, 0x30CF, 0x860, 0x30DE,
+				0x30EB, 0x30AF, 0x8A0, 0x30DE, 0x30F3, 0x30B7, 0x30E7, 0x30F3,
+				0x880, 0x30DF, 0x30AF, 0x30ED, 0x30F3, 0x840, 0x30DF, 0x30EA,
+				0x8C0, 0x30DF, 0x30EA, 0x30CF, 0x3099, 0x30FC, 0x30EB, 0x860,
+				0x30E1, 0x30AB, 0x3099, 0x8A0, 0x30E1, 0x30AB, 0x3099, 0x30C8,
+				0x30F3, 0x880, 0x30E1, 0x30FC, 0x30C8, 0x30EB, 0x880, 0x30E4,
+				0x30FC, 0x30C8, 0x3099, 0x860, 0x30E4, 0x30FC, 0x30EB, 0x860,
+				0x30E6, 0x30A2, 0x30F3, 0x880, 0x30EA, 0x30C3, 0x30C8, 0x30EB,
+				0x840, 0x30EA, 0x30E9, 0x880, 0x30EB, 0x30D2, 0x309A, 0x30FC,
+				0x8A0, 0x30EB, 0x30FC, 0x30D5, 0x3099, 0x30EB, 0x840, 0x30EC,
+				0x30E0, 0x8C0, 0x30EC, 0x30F3, 0x30C8, 0x30B1, 0x3099, 0x30F3,
+				0x860, 0x30EF, 0x30C3, 0x30C8, 0x840, 0x30, 0x70B9, 0x840,
+				0x31, 0x70B9, 0x840, 0x32, 0x70B9, 0x840, 0x33, 0x70B9,
+				0x840, 0x34, 0x70B9, 0x840, 0x35, 0x70B9, 0x840, 0x36,
+				0x70B9, 0x840, 0x37, 0x70B9, 0x840, 0x38, 0x70B9, 0x840,
+				0x39, 0x70B9, 0x860, 0x31, 0x30, 0x70B9, 0x860, 0x31,
+				0x31, 0x70B9, 0x860, 0x31, 0x32, 0x70B9, 0x860, 0x31,
+				0x33, 0x70B9, 0x860, 0x31, 0x34, 0x70B9, 0x860, 0x31,
+				0x35, 0x70B9, 0x860, 0x31, 0x36, 0x70B9, 0x860, 0x31,
+				0x37, 0x70B9, 0x860, 0x31, 0x38, 0x70B9, 0x860, 0x31,
+				0x39, 0x70B9, 0x860, 0x32, 0x30, 0x70B9, 0x860, 0x32,
+				0x31, 0x70B9, 0x860, 0x32, 0x32, 0x70B9, 0x860, 0x32,
+				0x33, 0x70B9, 0x860, 0x32, 0x34, 0x70B9, 0x860, 0x68,
+				0x50, 0x61, 0x840, 0x64, 0x61, 0x840, 0x41, 0x55,
+				0x860, 0x62, 0x61, 0x72, 0x840, 0x6F, 0x56, 0x840,
+				0x70, 0x63, 0x840, 0x64, 0x6D, 0x860, 0x64, 0x6D,
+				0x32, 0x860, 0x64, 0x6D, 0x33, 0x840, 0x49, 0x55,
+				0x840, 0x5E73, 0x6210, 0x840, 0x662D, 0x548C, 0x840, 0x5927,
+				0x6B63, 0x840, 0x660E, 0x6CBB, 0x880, 0x682A, 0x5F0F, 0x4F1A,
+				0x793E, 0x840, 0x70, 0x41, 0x840, 0x6E, 0x41, 0x840,
+				0x3BC, 0x41, 0x840, 0x6D, 0x41, 0x840, 0x6B, 0x41,
+				0x840, 0x4B, 0x42, 0x840, 0x4D, 0x42, 0x840, 0x47,
+				0x42, 0x860, 0x63, 0x61, 0x6C, 0x880, 0x6B, 0x63,
+				0x61, 0x6C, 0x840, 0x70, 0x46, 0x840, 0x6E, 0x46,
+				0x840, 0x3BC, 0x46, 0x840, 0x3BC, 0x67, 0x840, 0x6D,
+				0x67, 0x840, 0x6B, 0x67, 0x840, 0x48, 0x7A, 0x860,
+				0x6B, 0x48, 0x7A, 0x860, 0x4D, 0x48, 0x7A, 0x860,
+				0x47, 0x48, 0x7A, 0x860, 0x54, 0x48, 0x7A, 0x840,
+				0x3BC, 0x6C, 0x840, 0x6D, 0x6C, 0x840, 0x64, 0x6C,
+				0x840, 0x6B, 0x6C, 0x840, 0x66, 0x6D, 0x840, 0x6E,
+				0x6D, 0x840, 0x3BC, 0x6D, 0x840, 0x6D, 0x6D, 0x840,
+				0x63, 0x6D, 0x840, 0x6B, 0x6D, 0x860, 0x6D, 0x6D,
+				0x32, 0x860, 0x63, 0x6D, 0x32, 0x840, 0x6D, 0x32,
+				0x860, 0x6B, 0x6D, 0x32, 0x860, 0x6D, 0x6D, 0x33,
+				0x860, 0x63, 0x6D, 0x33, 0x840, 0x6D, 0x33, 0x860,
+				0x6B, 0x6D, 0x33, 0x860, 0x6D, 0x2215, 0x73, 0x880,
+				0x6D, 0x2215, 0x73, 0x32, 0x840, 0x50, 0x61, 0x860,
+				0x6B, 0x50, 0x61, 0x860, 0x4D, 0x50, 0x61, 0x860,
+				0x47, 0x50, 0x61, 0x860, 0x72, 0x61, 0x64, 0x8A0,
+				0x72, 0x61, 0x64, 0x2215, 0x73, 0x8C0, 0x72, 0x61,
+				0x64, 0x2215, 0x73, 0x32, 0x840, 0x70, 0x73, 0x840,
+				0x6E, 0x73, 0x840, 0x3BC, 0x73, 0x840, 0x6D, 0x73,
+				0x840, 0x70, 0x56, 0x840, 0x6E, 0x56, 0x840, 0x3BC,
+				0x56, 0x840, 0x6D, 0x56, 0x840, 0x6B, 0x56, 0x840,
+				0x4D, 0x56, 0x840, 0x70, 0x57, 0x840, 0x6E, 0x57,
+				0x840, 0x3BC, 0x57, 0x840, 0x6D, 0x57, 0x840, 0x6B,
+				0x57, 0x840, 0x4D, 0x57, 0x840, 0x6B, 0x3A9, 0x840,
+				0x4D, 0x3A9, 0x880, 0x61, 0x2E, 0x6D, 0x2E, 0x840,
+				0x42, 0x71, 0x840, 0x63, 0x63, 0x840, 0x63, 0x64,
+				0x880, 0x43, 0x2215, 0x6B, 0x67, 0x860, 0x43, 0x6F,
+				0x2E, 0x840, 0x64, 0x42, 0x840, 0x47, 0x79, 0x840,
+				0x68, 0x61, 0x840, 0x48, 0x50, 0x840, 0x69, 0x6E,
+				0x840, 0x4B, 0x4B, 0x840, 0x4B, 0x4D, 0x840, 0x6B,
+				0x74, 0x840, 0x6C, 0x6D, 0x840, 0x6C, 0x6E, 0x860,
+				0x6C, 0x6F, 0x67, 0x840, 0x6C, 0x78, 0x840, 0x6D,
+				0x62, 0x860, 0x6D, 0x69, 0x6C, 0x860, 0x6D, 0x6F,
+				0x6C, 0x840, 0x50, 0x48, 0x880, 0x70, 0x2E, 0x6D,
+				0x2E, 0x860, 0x50, 0x50, 0x4D, 0x840, 0x50, 0x52,
+				0x840, 0x73, 0x72, 0x840, 0x53, 0x76, 0x840, 0x57,
+				0x62, 0x860, 0x56, 0x2215, 0x6D, 0x860, 0x41, 0x2215,
+				0x6D, 0x840, 0x31, 0x65E5, 0x840, 0x32, 0x65E5, 0x840,
+				0x33, 0x65E5, 0x840, 0x34, 0x65E5, 0x840, 0x35, 0x65E5,
+				0x840, 0x36, 0x65E5, 0x840, 0x37, 0x65E5, 0x840, 0x38,
+				0x65E5, 0x840, 0x39, 0x65E5, 0x860, 0x31, 0x30, 0x65E5,
+				0x860, 0x31, 0x31, 0x65E5, 0x860, 0x31, 0x32, 0x65E5,
+				0x860, 0x31, 0x33, 0x65E5, 0x860, 0x31, 0x34, 0x65E5,
+				0x860, 0x31, 0x35, 0x65E5, 0x860, 0x31, 0x36, 0x65E5,
+				0x860, 0x31, 0x37, 0x65E5, 0x860, 0x31, 0x38, 0x65E5,
+				0x860, 0x31, 0x39, 0x65E5, 0x860, 0x32, 0x30, 0x65E5,
+				0x860, 0x32, 0x31, 0x65E5, 0x860, 0x32, 0x32, 0x65E5,
+				0x860, 0x32, 0x33, 0x65E5, 0x860, 0x32, 0x34, 0x65E5,
+				0x860, 0x32, 0x35, 0x65E5, 0x860, 0x32, 0x36, 0x65E5,
+				0x860, 0x32, 0x37, 0x65E5, 0x860, 0x32, 0x38, 0x65E5,
+				0x860, 0x32, 0x39, 0x65E5, 0x860, 0x33, 0x30, 0x65E5,
+				0x860, 0x33, 0x31, 0x65E5, 0x860, 0x67, 0x61, 0x6C,
+				0x820, 0x44A, 0x820, 0x44C, 0x820, 0xA76F, 0x820, 0x43,
+				0x820, 0x46, 0x820, 0x51, 0x820, 0x126, 0x820, 0x153,
+				0x820, 0xA727, 0x820, 0xAB37, 0x820, 0x26B, 0x820, 0xAB52,
+				0x820, 0x28D, 0x21, 0x8C48, 0x21, 0x66F4, 0x21, 0x8ECA,
+				0x21, 0x8CC8, 0x21, 0x6ED1, 0x21, 0x4E32, 0x21, 0x53E5,
+				0x21, 0x9F9C, 0x21, 0x9F9C, 0x21, 0x5951, 0x21, 0x91D1,
+				0x21, 0x5587, 0x21, 0x5948, 0x21, 0x61F6, 0x21, 0x7669,
+				0x21, 0x7F85, 0x21, 0x863F, 0x21, 0x87BA, 0x21, 0x88F8,
+				0x21, 0x908F, 0x21, 0x6A02, 0x21, 0x6D1B, 0x21, 0x70D9,
+				0x21, 0x73DE, 0x21, 0x843D, 0x21, 0x916A, 0x21, 0x99F1,
+				0x21, 0x4E82, 0x21, 0x5375, 0x21, 0x6B04, 0x21, 0x721B,
+				0x21, 0x862D, 0x21, 0x9E1E, 0x21, 0x5D50, 0x21, 0x6FEB,
+				0x21, 0x85CD, 0x21, 0x8964, 0x21, 0x62C9, 0x21, 0x81D8,
+				0x21, 0x881F, 0x21, 0x5ECA, 0x21, 0x6717, 0x21, 0x6D6A,
+				0x21, 0x72FC, 0x21, 0x90CE, 0x21, 0x4F86, 0x21, 0x51B7,
+				0x21, 0x52DE, 0x21, 0x64C4, 0x21, 0x6AD3, 0x21, 0x7210,
+				0x21, 0x76E7, 0x21, 0x8001, 0x21, 0x8606, 0x21, 0x865C,
+				0x21, 0x8DEF, 0x21, 0x9732, 0x21, 0x9B6F, 0x21, 0x9DFA,
+				0x21, 0x788C, 0x21, 0x797F, 0x21, 0x7DA0, 0x21, 0x83C9,
+				0x21, 0x9304, 0x21, 0x9E7F, 0x21, 0x8AD6, 0x21, 0x58DF,
+				0x21, 0x5F04, 0x21, 0x7C60, 0x21, 0x807E, 0x21, 0x7262,
+				0x21, 0x78CA, 0x21, 0x8CC2, 0x21, 0x96F7, 0x21, 0x58D8,
+				0x21, 0x5C62, 0x21, 0x6A13, 0x21, 0x6DDA, 0x21, 0x6F0F,
+				0x21, 0x7D2F, 0x21, 0x7E37, 0x21, 0x964B, 0x21, 0x52D2,
+				0x21, 0x808B, 0x21, 0x51DC, 0x21, 0x51CC, 0x21, 0x7A1C,
+				0x21, 0x7DBE, 0x21, 0x83F1, 0x21, 0x9675, 0x21, 0x8B80,
+				0x21, 0x62CF, 0x21, 0x6A02, 0x21, 0x8AFE, 0x21, 0x4E39,
+				0x21, 0x5BE7, 0x21, 0x6012, 0x21, 0x7387, 0x21, 0x7570,
+				0x21, 0x5317, 0x21, 0x78FB, 0x21, 0x4FBF, 0x21, 0x5FA9,
+				0x21, 0x4E0D, 0x21, 0x6CCC, 0x21, 0x6578, 0x21, 0x7D22,
+				0x21, 0x53C3, 0x21, 0x585E, 0x21, 0x7701, 0x21, 0x8449,
+				0x21, 0x8AAA, 0x21, 0x6BBA, 0x21, 0x8FB0, 0x21, 0x6C88,
+				0x21, 0x62FE, 0x21, 0x82E5, 0x21, 0x63A0, 0x21, 0x7565,
+				0x21, 0x4EAE, 0x21, 0x5169, 0x21, 0x51C9, 0x21, 0x6881,
+				0x21, 0x7CE7, 0x21, 0x826F, 0x21, 0x8AD2, 0x21, 0x91CF,
+				0x21, 0x52F5, 0x21, 0x5442, 0x21, 0x5973, 0x21, 0x5EEC,
+				0x21, 0x65C5, 0x21, 0x6FFE, 0x21, 0x792A, 0x21, 0x95AD,
+				0x21, 0x9A6A, 0x21, 0x9E97, 0x21, 0x9ECE, 0x21, 0x529B,
+				0x21, 0x66C6, 0x21, 0x6B77, 0x21, 0x8F62, 0x21, 0x5E74,
+				0x21, 0x6190, 0x21, 0x6200, 0x21, 0x649A, 0x21, 0x6F23,
+				0x21, 0x7149, 0x21, 0x7489, 0x21, 0x79CA, 0x21, 0x7DF4,
+				0x21, 0x806F, 0x21, 0x8F26, 0x21, 0x84EE, 0x21, 0x9023,
+				0x21, 0x934A, 0x21, 0x5217, 0x21, 0x52A3, 0x21, 0x54BD,
+				0x21, 0x70C8, 0x21, 0x88C2, 0x21, 0x8AAA, 0x21, 0x5EC9,
+				0x21, 0x5FF5, 0x21, 0x637B, 0x21, 0x6BAE, 0x21, 0x7C3E,
+				0x21, 0x7375, 0x21, 0x4EE4, 0x21, 0x56F9, 0x21, 0x5BE7,
+				0x21, 0x5DBA, 0x21, 0x601C, 0x21, 0x73B2, 0x21, 0x7469,
+				0x21, 0x7F9A, 0x21, 0x8046, 0x21, 0x9234, 0x21, 0x96F6,
+				0x21, 0x9748, 0x21, 0x9818, 0x21, 0x4F8B, 0x21, 0x79AE,
+				0x21, 0x91B4, 0x21, 0x96B8, 0x21, 0x60E1, 0x21, 0x4E86,
+				0x21, 0x50DA, 0x21, 0x5BEE, 0x21, 0x5C3F, 0x21, 0x6599,
+				0x21, 0x6A02, 0x21, 0x71CE, 0x21, 0x7642, 0x21, 0x84FC,
+				0x21, 0x907C, 0x21, 0x9F8D, 0x21, 0x6688, 0x21, 0x962E,
+				0x21, 0x5289, 0x21, 0x677B, 0x21, 0x67F3, 0x21, 0x6D41,
+				0x21, 0x6E9C, 0x21, 0x7409, 0x21, 0x7559, 0x21, 0x786B,
+				0x21, 0x7D10, 0x21, 0x985E, 0x21, 0x516D, 0x21, 0x622E,
+				0x21, 0x9678, 0x21, 0x502B, 0x21, 0x5D19, 0x21, 0x6DEA,
+				0x21, 0x8F2A, 0x21, 0x5F8B, 0x21, 0x6144, 0x21, 0x6817,
+				0x21, 0x7387, 0x21, 0x9686, 0x21, 0x5229, 0x21, 0x540F,
+				0x21, 0x5C65, 0x21, 0x6613, 0x21, 0x674E, 0x21, 0x68A8,
+				0x21, 0x6CE5, 0x21, 0x7406, 0x21, 0x75E2, 0x21, 0x7F79,
+				0x21, 0x88CF, 0x21, 0x88E1, 0x21, 0x91CC, 0x21, 0x96E2,
+				0x21, 0x533F, 0x21, 0x6EBA, 0x21, 0x541D, 0x21, 0x71D0,
+				0x21, 0x7498, 0x21, 0x85FA, 0x21, 0x96A3, 0x21, 0x9C57,
+				0x21, 0x9E9F, 0x21, 0x6797, 0x21, 0x6DCB, 0x21, 0x81E8,
+				0x21, 0x7ACB, 0x21, 0x7B20, 0x21, 0x7C92, 0x21, 0x72C0,
+				0x21, 0x7099, 0x21, 0x8B58, 0x21, 0x4EC0, 0x21, 0x8336,
+				0x21, 0x523A, 0x21, 0x5207, 0x21, 0x5EA6, 0x21, 0x62D3,
+				0x21, 0x7CD6, 0x21, 0x5B85, 0x21, 0x6D1E, 0x21, 0x66B4,
+				0x21, 0x8F3B, 0x21, 0x884C, 0x21, 0x964D, 0x21, 0x898B,
+				0x21, 0x5ED3, 0x21, 0x5140, 0x21, 0x55C0, 0x21, 0x585A,
+				0x21, 0x6674, 0x21, 0x51DE, 0x21, 0x732A, 0x21, 0x76CA,
+				0x21, 0x793C, 0x21, 0x795E, 0x21, 0x7965, 0x21, 0x798F,
+				0x21, 0x9756, 0x21, 0x7CBE, 0x21, 0x7FBD, 0x21, 0x8612,
+				0x21, 0x8AF8, 0x21, 0x9038, 0x21, 0x90FD, 0x21, 0x98EF,
+				0x21, 0x98FC, 0x21, 0x9928, 0x21, 0x9DB4, 0x21, 0x90DE,
+				0x21, 0x96B7, 0x21, 0x4FAE, 0x21, 0x50E7, 0x21, 0x514D,
+				0x21, 0x52C9, 0x21, 0x52E4, 0x21, 0x5351, 0x21, 0x559D,
+				0x21, 0x5606, 0x21, 0x5668, 0x21, 0x5840, 0x21, 0x58A8,
+				0x21, 0x5C64, 0x21, 0x5C6E, 0x21, 0x6094, 0x21, 0x6168,
+				0x21, 0x618E, 0x21, 0x61F2, 0x21, 0x654F, 0x21, 0x65E2,
+				0x21, 0x6691, 0x21, 0x6885, 0x21, 0x6D77, 0x21, 0x6E1A,
+				0x21, 0x6F22, 0x21, 0x716E, 0x21, 0x722B, 0x21, 0x7422,
+				0x21, 0x7891, 0x21, 0x793E, 0x21, 0x7949, 0x21, 0x7948,
+				0x21, 0x7950, 0x21, 0x7956, 0x21, 0x795D, 0x21, 0x798D,
+				0x21, 0x798E, 0x21, 0x7A40, 0x21, 0x7A81, 0x21, 0x7BC0,
+				0x21, 0x7DF4, 0x21, 0x7E09, 0x21, 0x7E41, 0x21, 0x7F72,
+				0x21, 0x8005, 0x21, 0x81ED, 0x21, 0x8279, 0x21, 0x8279,
+				0x21, 0x8457, 0x21, 0x8910, 0x21, 0x8996, 0x21, 0x8B01,
+				0x21, 0x8B39, 0x21, 0x8CD3, 0x21, 0x8D08, 0x21, 0x8FB6,
+				0x21, 0x9038, 0x21, 0x96E3, 0x21, 0x97FF, 0x21, 0x983B,
+				0x21, 0x6075, 0x42, 0xD850, 0xDEEE, 0x21, 0x8218, 0x21,
+				0x4E26, 0x21, 0x51B5, 0x21, 0x5168, 0x21, 0x4F80, 0x21,
+				0x5145, 0x21, 0x5180, 0x21, 0x52C7, 0x21, 0x52FA, 0x21,
+				0x559D, 0x21, 0x5555, 0x21, 0x5599, 0x21, 0x55E2, 0x21,
+				0x585A, 0x21, 0x58B3, 0x21, 0x5944, 0x21, 0x5954, 0x21,
+				0x5A62, 0x21, 0x5B28, 0x21, 0x5ED2, 0x21, 0x5ED9, 0x21,
+				0x5F69, 0x21, 0x5FAD, 0x21, 0x60D8, 0x21, 0x614E, 0x21,
+				0x6108, 0x21, 0x618E, 0x21, 0x6160, 0x21, 0x61F2, 0x21,
+				0x6234, 0x21, 0x63C4, 0x21, 0x641C, 0x21, 0x6452, 0x21,
+				0x6556, 0x21, 0x6674, 0x21, 0x6717, 0x21, 0x671B, 0x21,
+				0x6756, 0x21, 0x6B79, 0x21, 0x6BBA, 0x21, 0x6D41, 0x21,
+				0x6EDB, 0x21, 0x6ECB, 0x21, 0x6F22, 0x21, 0x701E, 0x21,
+				0x716E, 0x21, 0x77A7, 0x21, 0x7235, 0x21, 0x72AF, 0x21,
+				0x732A, 0x21, 0x7471, 0x21, 0x7506, 0x21, 0x753B, 0x21,
+				0x761D, 0x21, 0x761F, 0x21, 0x76CA, 0x21, 0x76DB, 0x21,
+				0x76F4, 0x21, 0x774A, 0x21, 0x7740, 0x21, 0x78CC, 0x21,
+				0x7AB1, 0x21, 0x7BC0, 0x21, 0x7C7B, 0x21, 0x7D5B, 0x21,
+				0x7DF4, 0x21, 0x7F3E, 0x21, 0x8005, 0x21, 0x8352, 0x21,
+				0x83EF, 0x21, 0x8779, 0x21, 0x8941, 0x21, 0x8986, 0x21,
+				0x8996, 0x21, 0x8ABF, 0x21, 0x8AF8, 0x21, 0x8ACB, 0x21,
+				0x8B01, 0x21, 0x8AFE, 0x21, 0x8AED, 0x21, 0x8B39, 0x21,
+				0x8B8A, 0x21, 0x8D08, 0x21, 0x8F38, 0x21, 0x9072, 0x21,
+				0x9199, 0x21, 0x9276, 0x21, 0x967C, 0x21, 0x96E3, 0x21,
+				0x9756, 0x21, 0x97DB, 0x21, 0x97FF, 0x21, 0x980B, 0x21,
+				0x983B, 0x21, 0x9B12, 0x21, 0x9F9C, 0x42, 0xD84A, 0xDC4A,
+				0x42, 0xD84A, 0xDC44, 0x42, 0xD84C, 0xDFD5, 0x21, 0x3B9D,
+				0x21, 0x4018, 0x21, 0x4039, 0x42, 0xD854, 0xDE49, 0x42,
+				0xD857, 0xDCD0, 0x42, 0xD85F, 0xDED3, 0x21, 0x9F43, 0x21,
+				0x9F8E, 0x840, 0x66, 0x66, 0x840, 0x66, 0x69, 0x840,
+				0x66, 0x6C, 0x860, 0x66, 0x66, 0x69, 0x860, 0x66,
+				0x66, 0x6C, 0x840, 0x73, 0x74, 0x840, 0x73, 0x74,
+				0x840, 0x574, 0x576, 0x840, 0x574, 0x565, 0x840, 0x574,
+				0x56B, 0x840, 0x57E, 0x576, 0x840, 0x574, 0x56D, 0x42,
+				0x5D9, 0x5B4, 0x42, 0x5F2, 0x5B7, 0x820, 0x5E2, 0x820,
+				0x5D0, 0x820, 0x5D3, 0x820, 0x5D4, 0x820, 0x5DB, 0x820,
+				0x5DC, 0x820, 0x5DD, 0x820, 0x5E8, 0x820, 0x5EA, 0x820,
+				0x2B, 0x42, 0x5E9, 0x5C1, 0x42, 0x5E9, 0x5C2, 0x63,
+				0x5E9, 0x5BC, 0x5C1, 0x63, 0x5E9, 0x5BC, 0x5C2, 0x42,
+				0x5D0, 0x5B7, 0x42, 0x5D0, 0x5B8, 0x42, 0x5D0, 0x5BC,
+				0x42, 0x5D1, 0x5BC, 0x42, 0x5D2, 0x5BC, 0x42, 0x5D3,
+				0x5BC, 0x42, 0x5D4, 0x5BC, 0x42, 0x5D5, 0x5BC, 0x42,
+				0x5D6, 0x5BC, 0x42, 0x5D8, 0x5BC, 0x42, 0x5D9, 0x5BC,
+				0x42, 0x5DA, 0x5BC, 0x42, 0x5DB, 0x5BC, 0x42, 0x5DC,
+				0x5BC, 0x42, 0x5DE, 0x5BC, 0x42, 0x5E0, 0x5BC, 0x42,
+				0x5E1, 0x5BC, 0x42, 0x5E3, 0x5BC, 0x42, 0x5E4, 0x5BC,
+				0x42, 0x5E6, 0x5BC, 0x42, 0x5E7, 0x5BC, 0x42, 0x5E8,
+				0x5BC, 0x42, 0x5E9, 0x5BC, 0x42, 0x5EA, 0x5BC, 0x42,
+				0x5D5, 0x5B9, 0x42, 0x5D1, 0x5BF, 0x42, 0x5DB, 0x5BF,
+				0x42, 0x5E4, 0x5BF, 0x840, 0x5D0, 0x5DC, 0x820, 0x671,
+				0x820, 0x671, 0x820, 0x67B, 0x820, 0x67B, 0x820, 0x67B,
+				0x820, 0x67B, 0x820, 0x67E, 0x820, 0x67E, 0x820, 0x67E,
+				0x820, 0x67E, 0x820, 0x680, 0x820, 0x680, 0x820, 0x680,
+				0x820, 0x680, 0x820, 0x67A, 0x820, 0x67A, 0x820, 0x67A,
+				0x820, 0x67A, 0x820, 0x67F, 0x820, 0x67F, 0x820, 0x67F,
+				0x820, 0x67F, 0x820, 0x679, 0x820, 0x679, 0x820, 0x679,
+				0x820, 0x679, 0x820, 0x6A4, 0x820, 0x6A4, 0x820, 0x6A4,
+				0x820, 0x6A4, 0x820, 0x6A6, 0x820, 0x6A6, 0x820, 0x6A6,
+				0x820, 0x6A6, 0x820, 0x684, 0x820, 0x684, 0x820, 0x684,
+				0x820, 0x684, 0x820, 0x683, 0x820, 0x683, 0x820, 0x683,
+				0x820, 0x683, 0x820, 0x686, 0x820, 0x686, 0x820, 0x686,
+				0x820, 0x686, 0x820, 0x687, 0x820, 0x687, 0x820, 0x687,
+				0x820, 0x687, 0x820, 0x68D, 0x820, 0x68D, 0x820, 0x68C,
+				0x820, 0x68C, 0x820, 0x68E, 0x820, 0x68E, 0x820, 0x688,
+				0x820, 0x688, 0x820, 0x698, 0x820, 0x698, 0x820, 0x691,
+				0x820, 0x691, 0x820, 0x6A9, 0x820, 0x6A9, 0x820, 0x6A9,
+				0x820, 0x6A9, 0x820, 0x6AF, 0x820, 0x6AF, 0x820, 0x6AF,
+				0x820, 0x6AF, 0x820, 0x6B3, 0x820, 0x6B3, 0x820, 0x6B3,
+				0x820, 0x6B3, 0x820, 0x6B1, 0x820, 0x6B1, 0x820, 0x6B1,
+				0x820, 0x6B1, 0x820, 0x6BA, 0x820, 0x6BA, 0x820, 0x6BB,
+				0x820, 0x6BB, 0x820, 0x6BB, 0x820, 0x6BB, 0x840, 0x6D5,
+				0x654, 0x840, 0x6D5, 0x654, 0x820, 0x6C1, 0x820, 0x6C1,
+				0x820, 0x6C1, 0x820, 0x6C1, 0x820, 0x6BE, 0x820, 0x6BE,
+				0x820, 0x6BE, 0x820, 0x6BE, 0x820, 0x6D2, 0x820, 0x6D2,
+				0x840, 0x6D2, 0x654, 0x840, 0x6D2, 0x654, 0x820, 0x6AD,
+				0x820, 0x6AD, 0x820, 0x6AD, 0x820, 0x6AD, 0x820, 0x6C7,
+				0x820, 0x6C7, 0x820, 0x6C6, 0x820, 0x6C6, 0x820, 0x6C8,
+				0x820, 0x6C8, 0x840, 0x6C7, 0x674, 0x820, 0x6CB, 0x820,
+				0x6CB, 0x820, 0x6C5, 0x820, 0x6C5, 0x820, 0x6C9, 0x820,
+				0x6C9, 0x820, 0x6D0, 0x820, 0x6D0, 0x820, 0x6D0, 0x820,
+				0x6D0, 0x820, 0x649, 0x820, 0x649, 0x860, 0x64A, 0x654,
+				0x627, 0x860, 0x64A, 0x654, 0x627, 0x860, 0x64A, 0x654,
+				0x6D5, 0x860, 0x64A, 0x654, 0x6D5, 0x860, 0x64A, 0x654,
+				0x648, 0x860, 0x64A, 0x654, 0x648, 0x860, 0x64A, 0x654,
+				0x6C7, 0x860, 0x64A, 0x654, 0x6C7, 0x860, 0x64A, 0x654,
+				0x6C6, 0x860, 0x64A, 0x654, 0x6C6, 0x860, 0x64A, 0x654,
+				0x6C8, 0x860, 0x64A, 0x654, 0x6C8, 0x860, 0x64A, 0x654,
+				0x6D0, 0x860, 0x64A, 0x654, 0x6D0, 0x860, 0x64A, 0x654,
+				0x6D0, 0x860, 0x64A, 0x654, 0x649, 0x860, 0x64A, 0x654,
+				0x649, 0x860, 0x64A, 0x654, 0x649, 0x820, 0x6CC, 0x820,
+				0x6CC, 0x820, 0x6CC, 0x820, 0x6CC, 0x860, 0x64A, 0x654,
+				0x62C, 0x860, 0x64A, 0x654, 0x62D, 0x860, 0x64A, 0x654,
+				0x645, 0x860, 0x64A, 0x654, 0x649, 0x860, 0x64A, 0x654,
+				0x64A, 0x840, 0x628, 0x62C, 0x840, 0x628, 0x62D, 0x840,
+				0x628, 0x62E, 0x840, 0x628, 0x645, 0x840, 0x628, 0x649,
+				0x840, 0x628, 0x64A, 0x840, 0x62A, 0x62C, 0x840, 0x62A,
+				0x62D, 0x840, 0x62A, 0x62E, 0x840, 0x62A, 0x645, 0x840,
+				0x62A, 0x649, 0x840, 0x62A, 0x64A, 0x840, 0x62B, 0x62C,
+				0x840, 0x62B, 0x645, 0x840, 0x62B, 0x649, 0x840, 0x62B,
+				0x64A, 0x840, 0x62C, 0x62D, 0x840, 0x62C, 0x645, 0x840,
+				0x62D, 0x62C, 0x840, 0x62D, 0x645, 0x840, 0x62E, 0x62C,
+				0x840, 0x62E, 0x62D, 0x840, 0x62E, 0x645, 0x840, 0x633,
+				0x62C, 0x840, 0x633, 0x62D, 0x840, 0x633, 0x62E, 0x840,
+				0x633, 0x645, 0x840, 0x635, 0x62D, 0x840, 0x635, 0x645,
+				0x840, 0x636, 0x62C, 0x840, 0x636, 0x62D, 0x840, 0x636,
+				0x62E, 0x840, 0x636, 0x645, 0x840, 0x637, 0x62D, 0x840,
+				0x637, 0x645, 0x840, 0x638, 0x645, 0x840, 0x639, 0x62C,
+				0x840, 0x639, 0x645, 0x840, 0x63A, 0x62C, 0x840, 0x63A,
+				0x645, 0x840, 0x641, 0x62C, 0x840, 0x641, 0x62D, 0x840,
+				0x641, 0x62E, 0x840, 0x641, 0x645, 0x840, 0x641, 0x649,
+				0x840, 0x641, 0x64A, 0x840, 0x642, 0x62D, 0x840, 0x642,
+				0x645, 0x840, 0x642, 0x649, 0x840, 0x642, 0x64A, 0x840,
+				0x643, 0x627, 0x840, 0x643, 0x62C, 0x840, 0x643, 0x62D,
+				0x840, 0x643, 0x62E, 0x840, 0x643, 0x644, 0x840, 0x643,
+				0x645, 0x840, 0x643, 0x649, 0x840, 0x643, 0x64A, 0x840,
+				0x644, 0x62C, 0x840, 0x644, 0x62D, 0x840, 0x644, 0x62E,
+				0x840, 0x644, 0x645, 0x840, 0x644, 0x649, 0x840, 0x644,
+				0x64A, 0x840, 0x645, 0x62C, 0x840, 0x645, 0x62D, 0x840,
+				0x645, 0x62E, 0x840, 0x645, 0x645, 0x840, 0x645, 0x649,
+				0x840, 0x645, 0x64A, 0x840, 0x646, 0x62C, 0x840, 0x646,
+				0x62D, 0x840, 0x646, 0x62E, 0x840, 0x646, 0x645, 0x840,
+				0x646, 0x649, 0x840, 0x646, 0x64A, 0x840, 0x647, 0x62C,
+				0x840, 0x647, 0x645, 0x840, 0x647, 0x649, 0x840, 0x647,
+				0x64A, 0x840, 0x64A, 0x62C, 0x840, 0x64A, 0x62D, 0x840,
+				0x64A, 0x62E, 0x840, 0x64A, 0x645, 0x840, 0x64A, 0x649,
+				0x840, 0x64A, 0x64A, 0x840, 0x630, 0x670, 0x840, 0x631,
+				0x670, 0x840, 0x649, 0x670, 0x860, 0x20, 0x64C, 0x651,
+				0x860, 0x20, 0x64D, 0x651, 0x860, 0x20, 0x64E, 0x651,
+				0x860, 0x20, 0x64F, 0x651, 0x860, 0x20, 0x650, 0x651,
+				0x860, 0x20, 0x651, 0x670, 0x860, 0x64A, 0x654, 0x631,
+				0x860, 0x64A, 0x654, 0x632, 0x860, 0x64A, 0x654, 0x645,
+				0x860, 0x64A, 0x654, 0x646, 0x860, 0x64A, 0x654, 0x649,
+				0x860, 0x64A, 0x654, 0x64A, 0x840, 0x628, 0x631, 0x840,
+				0x628, 0x632, 0x840, 0x628, 0x645, 0x840, 0x628, 0x646,
+				0x840, 0x628, 0x649, 0x840, 0x628, 0x64A, 0x840, 0x62A,
+				0x631, 0x840, 0x62A, 0x632, 0x840, 0x62A, 0x645, 0x840,
+				0x62A, 0x646, 0x840, 0x62A, 0x649, 0x840, 0x62A, 0x64A,
+				0x840, 0x62B, 0x631, 0x840, 0x62B, 0x632, 0x840, 0x62B,
+				0x645, 0x840, 0x62B, 0x646, 0x840, 0x62B, 0x649, 0x840,
+				0x62B, 0x64A, 0x840, 0x641, 0x649, 0x840, 0x641, 0x64A,
+				0x840, 0x642, 0x649, 0x840, 0x642, 0x64A, 0x840, 0x643,
+				0x627, 0x840, 0x643, 0x644, 0x840, 0x643, 0x645, 0x840,
+				0x643, 0x649, 0x840, 0x643, 0x64A, 0x840, 0x644, 0x645,
+				0x840, 0x644, 0x649, 0x840, 0x644, 0x64A, 0x840, 0x645,
+				0x627, 0x840, 0x645, 0x645, 0x840, 0x646, 0x631, 0x840,
+				0x646, 0x632, 0x840, 0x646, 0x645, 0x840, 0x646, 0x646,
+				0x840, 0x646, 0x649, 0x840, 0x646, 0x64A, 0x840, 0x649,
+				0x670, 0x840, 0x64A, 0x631, 0x840, 0x64A, 0x632, 0x840,
+				0x64A, 0x645, 0x840, 0x64A, 0x646, 0x840, 0x64A, 0x649,
+				0x840, 0x64A, 0x64A, 0x860, 0x64A, 0x654, 0x62C, 0x860,
+				0x64A, 0x654, 0x62D, 0x860, 0x64A, 0x654, 0x62E, 0x860,
+				0x64A, 0x654, 0x645, 0x860, 0x64A, 0x654, 0x647, 0x840,
+				0x628, 0x62C, 0x840, 0x628, 0x62D, 0x840, 0x628, 0x62E,
+				0x840, 0x628, 0x645, 0x840, 0x628, 0x647, 0x840, 0x62A,
+				0x62C, 0x840, 0x62A, 0x62D, 0x840, 0x62A, 0x62E, 0x840,
+				0x62A, 0x645, 0x840, 0x62A, 0x647, 0x840, 0x62B, 0x645,
+				0x840, 0x62C, 0x62D, 0x840, 0x62C, 0x645, 0x840, 0x62D,
+				0x62C, 0x840, 0x62D, 0x645, 0x840, 0x62E, 0x62C, 0x840,
+				0x62E, 0x645, 0x840, 0x633, 0x62C, 0x840, 0x633, 0x62D,
+				0x840, 0x633, 0x62E, 0x840, 0x633, 0x645, 0x840, 0x635,
+				0x62D, 0x840, 0x635, 0x62E, 0x840, 0x635, 0x645, 0x840,
+				0x636, 0x62C, 0x840, 0x636, 0x62D, 0x840, 0x636, 0x62E,
+				0x840, 0x636, 0x645, 0x840, 0x637, 0x62D, 0x840, 0x638,
+				0x645, 0x840, 0x639, 0x62C, 0x840, 0x639, 0x645, 0x840,
+				0x63A, 0x62C, 0x840, 0x63A, 0x645, 0x840, 0x641, 0x62C,
+				0x840, 0x641, 0x62D, 0x840, 0x641, 0x62E, 0x840, 0x641,
+				0x645, 0x840, 0x642, 0x62D, 0x840, 0x642, 0x645, 0x840,
+				0x643, 0x62C, 0x840, 0x643, 0x62D, 0x840, 0x643, 0x62E,
+				0x840, 0x643, 0x644, 0x840, 0x643, 0x645, 0x840, 0x644,
+				0x62C, 0x840, 0x644, 0x62D, 0x840, 0x644, 0x62E, 0x840,
+				0x644, 0x645, 0x840, 0x644, 0x647, 0x840, 0x645, 0x62C,
+				0x840, 0x645, 0x62D, 0x840, 0x645, 0x62E, 0x840, 0x645,
+				0x645, 0x840, 0x646, 0x62C, 0x840, 0x646, 0x62D, 0x840,
+				0x646, 0x62E, 0x840, 0x646, 0x645, 0x840, 0x646, 0x647,
+				0x840, 0x647, 0x62C, 0x840, 0x647, 0x645, 0x840, 0x647,
+				0x670, 0x840, 0x64A, 0x62C, 0x840, 0x64A, 0x62D, 0x840,
+				0x64A, 0x62E, 0x840, 0x64A, 0x645, 0x840, 0x64A, 0x647,
+				0x860, 0x64A, 0x654, 0x645, 0x860, 0x64A, 0x654, 0x647,
+				0x840, 0x628, 0x645, 0x840, 0x628, 0x647, 0x840, 0x62A,
+				0x645, 0x840, 0x62A, 0x647, 0x840, 0x62B, 0x645, 0x840,
+				0x62B, 0x647, 0x840, 0x633, 0x645, 0x840, 0x633, 0x647,
+				0x840, 0x634, 0x645, 0x840, 0x634, 0x647, 0x840, 0x643,
+				0x644, 0x840, 0x643, 0x645, 0x840, 0x644, 0x645, 0x840,
+				0x646, 0x645, 0x840, 0x646, 0x647, 0x840, 0x64A, 0x645,
+				0x840, 0x64A, 0x647, 0x860, 0x640, 0x64E, 0x651, 0x860,
+				0x640, 0x64F, 0x651, 0x860, 0x640, 0x650, 0x651, 0x840,
+				0x637, 0x649, 0x840, 0x637, 0x64A, 0x840, 0x639, 0x649,
+				0x840, 0x639, 0x64A, 0x840, 0x63A, 0x649, 0x840, 0x63A,
+				0x64A, 0x840, 0x633, 0x649, 0x840, 0x633, 0x64A, 0x840,
+				0x634, 0x649, 0x840, 0x634, 0x64A, 0x840, 0x62D, 0x649,
+				0x840, 0x62D, 0x64A, 0x840, 0x62C, 0x649, 0x840, 0x62C,
+				0x64A, 0x840, 0x62E, 0x649, 0x840, 0x62E, 0x64A, 0x840,
+				0x635, 0x649, 0x840, 0x635, 0x64A, 0x840, 0x636, 0x649,
+				0x840, 0x636, 0x64A, 0x840, 0x634, 0x62C, 0x840, 0x634,
+				0x62D, 0x840, 0x634, 0x62E, 0x840, 0x634, 0x645, 0x840,
+				0x634, 0x631, 0x840, 0x633, 0x631, 0x840, 0x635, 0x631,
+				0x840, 0x636, 0x631, 0x840, 0x637, 0x649, 0x840, 0x637,
+				0x64A, 0x840, 0x639, 0x649, 0x840, 0x639, 0x64A, 0x840,
+				0x63A, 0x649, 0x840, 0x63A, 0x64A, 0x840, 0x633, 0x649,
+				0x840, 0x633, 0x64A, 0x840, 0x634, 0x649, 0x840, 0x634,
+				0x64A, 0x840, 0x62D, 0x649, 0x840, 0x62D, 0x64A, 0x840,
+				0x62C, 0x649, 0x840, 0x62C, 0x64A, 0x840, 0x62E, 0x649,
+				0x840, 0x62E, 0x64A, 0x840, 0x635, 0x649, 0x840, 0x635,
+				0x64A, 0x840, 0x636, 0x649, 0x840, 0x636, 0x64A, 0x840,
+				0x634, 0x62C, 0x840, 0x634, 0x62D, 0x840, 0x634, 0x62E,
+				0x840, 0x634, 0x645, 0x840, 0x634, 0x631, 0x840, 0x633,
+				0x631, 0x840, 0x635, 0x631, 0x840, 0x636, 0x631, 0x840,
+				0x634, 0x62C, 0x840, 0x634, 0x62D, 0x840, 0x634, 0x62E,
+				0x840, 0x634, 0x645, 0x840, 0x633, 0x647, 0x840, 0x634,
+				0x647, 0x840, 0x637, 0x645, 0x840, 0x633, 0x62C, 0x840,
+				0x633, 0x62D, 0x840, 0x633, 0x62E, 0x840, 0x634, 0x62C,
+				0x840, 0x634, 0x62D, 0x840, 0x634, 0x62E, 0x840, 0x637,
+				0x645, 0x840, 0x638, 0x645, 0x840, 0x627, 0x64B, 0x840,
+				0x627, 0x64B, 0x860, 0x62A, 0x62C, 0x645, 0x860, 0x62A,
+				0x62D, 0x62C, 0x860, 0x62A, 0x62D, 0x62C, 0x860, 0x62A,
+				0x62D, 0x645, 0x860, 0x62A, 0x62E, 0x645, 0x860, 0x62A,
+				0x645, 0x62C, 0x860, 0x62A, 0x645, 0x62D, 0x860, 0x62A,
+				0x645, 0x62E, 0x860, 0x62C, 0x645, 0x62D, 0x860, 0x62C,
+				0x645, 0x62D, 0x860, 0x62D, 0x645, 0x64A, 0x860, 0x62D,
+				0x645, 0x649, 0x860, 0x633, 0x62D, 0x62C, 0x860, 0x633,
+				0x62C, 0x62D, 0x860, 0x633, 0x62C, 0x649, 0x860, 0x633,
+				0x645, 0x62D, 0x860, 0x633, 0x645, 0x62D, 0x860, 0x633,
+				0x645, 0x62C, 0x860, 0x633, 0x645, 0x645, 0x860, 0x633,
+				0x645, 0x645, 0x860, 0x635, 0x62D, 0x62D, 0x860, 0x635,
+				0x62D, 0x62D, 0x860, 0x635, 0x645, 0x645, 0x860, 0x634,
+				0x62D, 0x645, 0x860, 0x634, 0x62D, 0x645, 0x860, 0x634,
+				0x62C, 0x64A, 0x860, 0x634, 0x645, 0x62E, 0x860, 0x634,
+				0x645, 0x62E, 0x860, 0x634, 0x645, 0x645, 0x860, 0x634,
+				0x645, 0x645, 0x860, 0x636, 0x62D, 0x649, 0x860, 0x636,
+				0x62E, 0x645, 0x860, 0x636, 0x62E, 0x645, 0x860, 0x637,
+				0x645, 0x62D, 0x860, 0x637, 0x645, 0x62D, 0x860, 0x637,
+				0x645, 0x645, 0x860, 0x637, 0x645, 0x64A, 0x860, 0x639,
+				0x62C, 0x645, 0x860, 0x639, 0x645, 0x645, 0x860, 0x639,
+				0x645, 0x645, 0x860, 0x639, 0x645, 0x649, 0x860, 0x63A,
+				0x645, 0x645, 0x860, 0x63A, 0x645, 0x64A, 0x860, 0x63A,
+				0x645, 0x649, 0x860, 0x641, 0x62E, 0x645, 0x860, 0x641,
+				0x62E, 0x645, 0x860, 0x642, 0x645, 0x62D, 0x860, 0x642,
+				0x645, 0x645, 0x860, 0x644, 0x62D, 0x645, 0x860, 0x644,
+				0x62D, 0x64A, 0x860, 0x644, 0x62D, 0x649, 0x860, 0x644,
+				0x62C, 0x62C, 0x860, 0x644, 0x62C, 0x62C, 0x860, 0x644,
+				0x62E, 0x645, 0x860, 0x644, 0x62E, 0x645, 0x860, 0x644,
+				0x645, 0x62D, 0x860, 0x644, 0x645, 0x62D, 0x860, 0x645,
+				0x62D, 0x62C, 0x860, 0x645, 0x62D, 0x645, 0x860, 0x645,
+				0x62D, 0x64A, 0x860, 0x645, 0x62C, 0x62D, 0x860, 0x645,
+				0x62C, 0x645, 0x860, 0x645, 0x62E, 0x62C, 0x860, 0x645,
+				0x62E, 0x645, 0x860, 0x645, 0x62C, 0x62E, 0x860, 0x647,
+				0x645, 0x62C, 0x860, 0x647, 0x645, 0x645, 0x860, 0x646,
+				0x62D, 0x645, 0x860, 0x646, 0x62D, 0x649, 0x860, 0x646,
+				0x62C, 0x645, 0x860, 0x646, 0x62C, 0x645, 0x860, 0x646,
+				0x62C, 0x649, 0x860, 0x646, 0x645, 0x64A, 0x860, 0x646,
+				0x645, 0x649, 0x860, 0x64A, 0x645, 0x645, 0x860, 0x64A,
+				0x645, 0x645, 0x860, 0x628, 0x62E, 0x64A, 0x860, 0x62A,
+				0x62C, 0x64A, 0x860, 0x62A, 0x62C, 0x649, 0x860, 0x62A,
+				0x62E, 0x64A, 0x860, 0x62A, 0x62E, 0x649, 0x860, 0x62A,
+				0x645, 0x64A, 0x860, 0x62A, 0x645, 0x649, 0x860, 0x62C,
+				0x645, 0x64A, 0x860, 0x62C, 0x62D, 0x649, 0x860, 0x62C,
+				0x645, 0x649, 0x860, 0x633, 0x62E, 0x649, 0x860, 0x635,
+				0x62D, 0x64A, 0x860, 0x634, 0x62D, 0x64A, 0x860, 0x636,
+				0x62D, 0x64A, 0x860, 0x644, 0x62C, 0x64A, 0x860, 0x644,
+				0x645, 0x64A, 0x860, 0x64A, 0x62D, 0x64A, 0x860, 0x64A,
+				0x62C, 0x64A, 0x860, 0x64A, 0x645, 0x64A, 0x860, 0x645,
+				0x645, 0x64A, 0x860, 0x642, 0x645, 0x64A, 0x860, 0x646,
+				0x62D, 0x64A, 0x860, 0x642, 0x645, 0x62D, 0x860, 0x644,
+				0x62D, 0x645, 0x860, 0x639, 0x645, 0x64A, 0x860, 0x643,
+				0x645, 0x64A, 0x860, 0x646, 0x62C, 0x62D, 0x860, 0x645,
+				0x62E, 0x64A, 0x860, 0x644, 0x62C, 0x645, 0x860, 0x643,
+				0x645, 0x645, 0x860, 0x644, 0x62C, 0x645, 0x860, 0x646,
+				0x62C, 0x62D, 0x860, 0x62C, 0x62D, 0x64A, 0x860, 0x62D,
+				0x62C, 0x64A, 0x860, 0x645, 0x62C, 0x64A, 0x860, 0x641,
+				0x645, 0x64A, 0x860, 0x628, 0x62D, 0x64A, 0x860, 0x643,
+				0x645, 0x645, 0x860, 0x639, 0x62C, 0x645, 0x860, 0x635,
+				0x645, 0x645, 0x860, 0x633, 0x62E, 0x64A, 0x860, 0x646,
+				0x62C, 0x64A, 0x860, 0x635, 0x644, 0x6D2, 0x860, 0x642,
+				0x644, 0x6D2, 0x880, 0x627, 0x644, 0x644, 0x647, 0x880,
+				0x627, 0x643, 0x628, 0x631, 0x880, 0x645, 0x62D, 0x645,
+				0x62F, 0x880, 0x635, 0x644, 0x639, 0x645, 0x880, 0x631,
+				0x633, 0x648, 0x644, 0x880, 0x639, 0x644, 0x64A, 0x647,
+				0x880, 0x648, 0x633, 0x644, 0x645, 0x860, 0x635, 0x644,
+				0x649, 0xA40, 0x635, 0x644, 0x649, 0x20, 0x627, 0x644,
+				0x644, 0x647, 0x20, 0x639, 0x644, 0x64A, 0x647, 0x20,
+				0x648, 0x633, 0x644, 0x645, 0x900, 0x62C, 0x644, 0x20,
+				0x62C, 0x644, 0x627, 0x644, 0x647, 0x880, 0x631, 0x6CC,
+				0x627, 0x644, 0x820, 0x2C, 0x820, 0x3001, 0x820, 0x3002,
+				0x820, 0x3A, 0x820, 0x3B, 0x820, 0x21, 0x820, 0x3F,
+				0x820, 0x3016, 0x820, 0x3017, 0x860, 0x2E, 0x2E, 0x2E,
+				0x840, 0x2E, 0x2E, 0x820, 0x2014, 0x820, 0x2013, 0x820,
+				0x5F, 0x820, 0x5F, 0x820, 0x28, 0x820, 0x29, 0x820,
+				0x7B, 0x820, 0x7D, 0x820, 0x3014, 0x820, 0x3015, 0x820,
+				0x3010, 0x820, 0x3011, 0x820, 0x300A, 0x820, 0x300B, 0x820,
+				0x3008, 0x820, 0x3009, 0x820, 0x300C, 0x820, 0x300D, 0x820,
+				0x300E, 0x820, 0x300F, 0x820, 0x5B, 0x820, 0x5D, 0x840,
+				0x20, 0x305, 0x840, 0x20, 0x305, 0x840, 0x20, 0x305,
+				0x840, 0x20, 0x305, 0x820, 0x5F, 0x820, 0x5F, 0x820,
+				0x5F, 0x820, 0x2C, 0x820, 0x3001, 0x820, 0x2E, 0x820,
+				0x3B, 0x820, 0x3A, 0x820, 0x3F, 0x820, 0x21, 0x820,
+				0x2014, 0x820, 0x28, 0x820, 0x29, 0x820, 0x7B, 0x820,
+				0x7D, 0x820, 0x3014, 0x820, 0x3015, 0x820, 0x23, 0x820,
+				0x26, 0x820, 0x2A, 0x820, 0x2B, 0x820, 0x2D, 0x820,
+				0x3C, 0x820, 0x3E, 0x820, 0x3D, 0x820, 0x5C, 0x820,
+				0x24, 0x820, 0x25, 0x820, 0x40, 0x840, 0x20, 0x64B,
+				0x840, 0x640, 0x64B, 0x840, 0x20, 0x64C, 0x840, 0x20,
+				0x64D, 0x840, 0x20, 0x64E, 0x840, 0x640, 0x64E, 0x840,
+				0x20, 0x64F, 0x840, 0x640, 0x64F, 0x840, 0x20, 0x650,
+				0x840, 0x640, 0x650, 0x840, 0x20, 0x651, 0x840, 0x640,
+				0x651, 0x840, 0x20, 0x652, 0x840, 0x640, 0x652, 0x820,
+				0x621, 0x840, 0x627, 0x653, 0x840, 0x627, 0x653, 0x840,
+				0x627, 0x654, 0x840, 0x627, 0x654, 0x840, 0x648, 0x654,
+				0x840, 0x648, 0x654, 0x840, 0x627, 0x655, 0x840, 0x627,
+				0x655, 0x840, 0x64A, 0x654, 0x840, 0x64A, 0x654, 0x840,
+				0x64A, 0x654, 0x840, 0x64A, 0x654, 0x820, 0x627, 0x820,
+				0x627, 0x820, 0x628, 0x820, 0x628, 0x820, 0x628, 0x820,
+				0x628, 0x820, 0x629, 0x820, 0x629, 0x820, 0x62A, 0x820,
+				0x62A, 0x820, 0x62A, 0x820, 0x62A, 0x820, 0x62B, 0x820,
+				0x62B, 0x820, 0x62B, 0x820, 0x62B, 0x820, 0x62C, 0x820,
+				0x62C, 0x820, 0x62C, 0x820, 0x62C, 0x820, 0x62D, 0x820,
+				0x62D, 0x820, 0x62D, 0x820, 0x62D, 0x820, 0x62E, 0x820,
+				0x62E, 0x820, 0x62E, 0x820, 0x62E, 0x820, 0x62F, 0x820,
+				0x62F, 0x820, 0x630, 0x820, 0x630, 0x820, 0x631, 0x820,
+				0x631, 0x820, 0x632, 0x820, 0x632, 0x820, 0x633, 0x820,
+				0x633, 0x820, 0x633, 0x820, 0x633, 0x820, 0x634, 0x820,
+				0x634, 0x820, 0x634, 0x820, 0x634, 0x820, 0x635, 0x820,
+				0x635, 0x820, 0x635, 0x820, 0x635, 0x820, 0x636, 0x820,
+				0x636, 0x820, 0x636, 0x820, 0x636, 0x820, 0x637, 0x820,
+				0x637, 0x820, 0x637, 0x820, 0x637, 0x820, 0x638, 0x820,
+				0x638, 0x820, 0x638, 0x820, 0x638, 0x820, 0x639, 0x820,
+				0x639, 0x820, 0x639, 0x820, 0x639, 0x820, 0x63A, 0x820,
+				0x63A, 0x820, 0x63A, 0x820, 0x63A, 0x820, 0x641, 0x820,
+				0x641, 0x820, 0x641, 0x820, 0x641, 0x820, 0x642, 0x820,
+				0x642, 0x820, 0x642, 0x820, 0x642, 0x820, 0x643, 0x820,
+				0x643, 0x820, 0x643, 0x820, 0x643, 0x820, 0x644, 0x820,
+				0x644, 0x820, 0x644, 0x820, 0x644, 0x820, 0x645, 0x820,
+				0x645, 0x820, 0x645, 0x820, 0x645, 0x820, 0x646, 0x820,
+				0x646, 0x820, 0x646, 0x820, 0x646, 0x820, 0x647, 0x820,
+				0x647, 0x820, 0x647, 0x820, 0x647, 0x820, 0x648, 0x820,
+				0x648, 0x820, 0x649, 0x820, 0x649, 0x820, 0x64A, 0x820,
+				0x64A, 0x820, 0x64A, 0x820, 0x64A, 0x860, 0x644, 0x627,
+				0x653, 0x860, 0x644, 0x627, 0x653, 0x860, 0x644, 0x627,
+				0x654, 0x860, 0x644, 0x627, 0x654, 0x860, 0x644, 0x627,
+				0x655, 0x860, 0x644, 0x627, 0x655, 0x840, 0x644, 0x627,
+				0x840, 0x644, 0x627, 0x820, 0x21, 0x820, 0x22, 0x820,
+				0x23, 0x820, 0x24, 0x820, 0x25, 0x820, 0x26, 0x820,
+				0x27, 0x820, 0x28, 0x820, 0x29, 0x820, 0x2A, 0x820,
+				0x2B, 0x820, 0x2C, 0x820, 0x2D, 0x820, 0x2E, 0x820,
+				0x2F, 0x820, 0x30, 0x820, 0x31, 0x820, 0x32, 0x820,
+				0x33, 0x820, 0x34, 0x820, 0x35, 0x820, 0x36, 0x820,
+				0x37, 0x820, 0x38, 0x820, 0x39, 0x820, 0x3A, 0x820,
+				0x3B, 0x820, 0x3C, 0x820, 0x3D, 0x820, 0x3E, 0x820,
+				0x3F, 0x820, 0x40, 0x820, 0x41, 0x820, 0x42, 0x820,
+				0x43, 0x820, 0x44, 0x820, 0x45, 0x820, 0x46, 0x820,
+				0x47, 0x820, 0x48, 0x820, 0x49, 0x820, 0x4A, 0x820,
+				0x4B, 0x820, 0x4C, 0x820, 0x4D, 0x820, 0x4E, 0x820,
+				0x4F, 0x820, 0x50, 0x820, 0x51, 0x820, 0x52, 0x820,
+				0x53, 0x820, 0x54, 0x820, 0x55, 0x820, 0x56, 0x820,
+				0x57, 0x820, 0x58, 0x820, 0x59, 0x820, 0x5A, 0x820,
+				0x5B, 0x820, 0x5C, 0x820, 0x5D, 0x820, 0x5E, 0x820,
+				0x5F, 0x820, 0x60, 0x820, 0x61, 0x820, 0x62, 0x820,
+				0x63, 0x820, 0x64, 0x820, 0x65, 0x820, 0x66, 0x820,
+				0x67, 0x820, 0x68, 0x820, 0x69, 0x820, 0x6A, 0x820,
+				0x6B, 0x820, 0x6C, 0x820, 0x6D, 0x820, 0x6E, 0x820,
+				0x6F, 0x820, 0x70, 0x820, 0x71, 0x820, 0x72, 0x820,
+				0x73, 0x820, 0x74, 0x820, 0x75, 0x820, 0x76, 0x820,
+				0x77, 0x820, 0x78, 0x820, 0x79, 0x820, 0x7A, 0x820,
+				0x7B, 0x820, 0x7C, 0x820, 0x7D, 0x820, 0x7E, 0x820,
+				0x2985, 0x820, 0x2986, 0x820, 0x3002, 0x820, 0x300C, 0x820,
+				0x300D, 0x820, 0x3001, 0x820, 0x30FB, 0x820, 0x30F2, 0x820,
+				0x30A1, 0x820, 0x30A3, 0x820, 0x30A5, 0x820, 0x30A7, 0x820,
+				0x30A9, 0x820, 0x30E3, 0x820, 0x30E5, 0x820, 0x30E7, 0x820,
+				0x30C3, 0x820, 0x30FC, 0x820, 0x30A2, 0x820, 0x30A4, 0x820,
+				0x30A6, 0x820, 0x30A8, 0x820, 0x30AA, 0x820, 0x30AB, 0x820,
+				0x30AD, 0x820, 0x30AF, 0x820, 0x30B1, 0x820, 0x30B3, 0x820,
+				0x30B5, 0x820, 0x30B7, 0x820, 0x30B9, 0x820, 0x30BB, 0x820,
+				0x30BD, 0x820, 0x30BF, 0x820, 0x30C1, 0x820, 0x30C4, 0x820,
+				0x30C6, 0x820, 0x30C8, 0x820, 0x30CA, 0x820, 0x30CB, 0x820,
+				0x30CC, 0x820, 0x30CD, 0x820, 0x30CE, 0x820, 0x30CF, 0x820,
+				0x30D2, 0x820, 0x30D5, 0x820, 0x30D8, 0x820, 0x30DB, 0x820,
+				0x30DE, 0x820, 0x30DF, 0x820, 0x30E0, 0x820, 0x30E1, 0x820,
+				0x30E2, 0x820, 0x30E4, 0x820, 0x30E6, 0x820, 0x30E8, 0x820,
+				0x30E9, 0x820, 0x30EA, 0x820, 0x30EB, 0x820, 0x30EC, 0x820,
+				0x30ED, 0x820, 0x30EF, 0x820, 0x30F3, 0x820, 0x3099, 0x820,
+				0x309A, 0x820, 0x1160, 0x820, 0x1100, 0x820, 0x1101, 0x820,
+				0x11AA, 0x820, 0x1102, 0x820, 0x11AC, 0x820, 0x11AD, 0x820,
+				0x1103, 0x820, 0x1104, 0x820, 0x1105, 0x820, 0x11B0, 0x820,
+				0x11B1, 0x820, 0x11B2, 0x820, 0x11B3, 0x820, 0x11B4, 0x820,
+				0x11B5, 0x820, 0x111A, 0x820, 0x1106, 0x820, 0x1107, 0x820,
+				0x1108, 0x820, 0x1121, 0x820, 0x1109, 0x820, 0x110A, 0x820,
+				0x110B, 0x820, 0x110C, 0x820, 0x110D, 0x820, 0x110E, 0x820,
+				0x110F, 0x820, 0x1110, 0x820, 0x1111, 0x820, 0x1112, 0x820,
+				0x1161, 0x820, 0x1162, 0x820, 0x1163, 0x820, 0x1164, 0x820,
+				0x1165, 0x820, 0x1166, 0x820, 0x1167, 0x820, 0x1168, 0x820,
+				0x1169, 0x820, 0x116A, 0x820, 0x116B, 0x820, 0x116C, 0x820,
+				0x116D, 0x820, 0x116E, 0x820, 0x116F, 0x820, 0x1170, 0x820,
+				0x1171, 0x820, 0x1172, 0x820, 0x1173, 0x820, 0x1174, 0x820,
+				0x1175, 0x820, 0xA2, 0x820, 0xA3, 0x820, 0xAC, 0x840,
+				0x20, 0x304, 0x820, 0xA6, 0x820, 0xA5, 0x820, 0x20A9,
+				0x820, 0x2502, 0x820, 0x2190, 0x820, 0x2191, 0x820, 0x2192,
+				0x820, 0x2193, 0x820, 0x25A0, 0x820, 0x25CB, 0x820, 0x2D0,
+				0x820, 0x2D1, 0x820, 0xE6, 0x820, 0x299, 0x820, 0x253,
+				0x820, 0x2A3, 0x820, 0xAB66, 0x820, 0x2A5, 0x820, 0x2A4,
+				0x820, 0x256, 0x820, 0x257, 0x820, 0x1D91, 0x820, 0x258,
+				0x820, 0x25E, 0x820, 0x2A9, 0x820, 0x264, 0x820, 0x262,
+				0x820, 0x260, 0x820, 0x29B, 0x820, 0x127, 0x820, 0x29C,
+				0x820, 0x267, 0x820, 0x284, 0x820, 0x2AA, 0x820, 0x2AB,
+				0x820, 0x26C, 0x840, 0xD837, 0xDF04, 0x820, 0xA78E, 0x820,
+				0x26E, 0x840, 0xD837, 0xDF05, 0x820, 0x28E, 0x840, 0xD837,
+				0xDF06, 0x820, 0xF8, 0x820, 0x276, 0x820, 0x277, 0x820,
+				0x71, 0x820, 0x27A, 0x840, 0xD837, 0xDF08, 0x820, 0x27D,
+				0x820, 0x27E, 0x820, 0x280, 0x820, 0x2A8, 0x820, 0x2A6,
+				0x820, 0xAB67, 0x820, 0x2A7, 0x820, 0x288, 0x820, 0x2C71,
+				0x820, 0x28F, 0x820, 0x2A1, 0x820, 0x2A2, 0x820, 0x298,
+				0x820, 0x1C0, 0x820, 0x1C1, 0x820, 0x1C2, 0x840, 0xD837,
+				0xDF0A, 0x840, 0xD837, 0xDF1E, 0x84, 0xD804, 0xDC99, 0xD804,
+				0xDCBA, 0x84, 0xD804, 0xDC9B, 0xD804, 0xDCBA, 0x84, 0xD804,
+				0xDCA5, 0xD804, 0xDCBA, 0x84, 0xD804, 0xDD31, 0xD804, 0xDD27,
+				0x84, 0xD804, 0xDD32, 0xD804, 0xDD27, 0x84, 0xD804, 0xDF47,
+				0xD804, 0xDF3E, 0x84, 0xD804, 0xDF47, 0xD804, 0xDF57, 0x84,
+				0xD805, 0xDCB9, 0xD805, 0xDCBA, 0x84, 0xD805, 0xDCB9, 0xD805,
+				0xDCB0, 0x84, 0xD805, 0xDCB9, 0xD805, 0xDCBD, 0x84, 0xD805,
+				0xDDB8, 0xD805, 0xDDAF, 0x84, 0xD805, 0xDDB9, 0xD805, 0xDDAF,
+				0x84, 0xD806, 0xDD35, 0xD806, 0xDD30, 0x84, 0xD834, 0xDD57,
+				0xD834, 0xDD65, 0x84, 0xD834, 0xDD58, 0xD834, 0xDD65, 0xC6,
+				0xD834, 0xDD58, 0xD834, 0xDD65, 0xD834, 0xDD6E, 0xC6, 0xD834,
+				0xDD58, 0xD834, 0xDD65, 0xD834, 0xDD6F, 0xC6, 0xD834, 0xDD58,
+				0xD834, 0xDD65, 0xD834, 0xDD70, 0xC6, 0xD834, 0xDD58, 0xD834,
+				0xDD65, 0xD834, 0xDD71, 0xC6, 0xD834, 0xDD58, 0xD834, 0xDD65,
+				0xD834, 0xDD72, 0x84, 0xD834, 0xDDB9, 0xD834, 0xDD65, 0x84,
+				0xD834, 0xDDBA, 0xD834, 0xDD65, 0xC6, 0xD834, 0xDDB9, 0xD834,
+				0xDD65, 0xD834, 0xDD6E, 0xC6, 0xD834, 0xDDBA, 0xD834, 0xDD65,
+				0xD834, 0xDD6E, 0xC6, 0xD834, 0xDDB9, 0xD834, 0xDD65, 0xD834,
+				0xDD6F, 0xC6, 0xD834, 0xDDBA, 0xD834, 0xDD65, 0xD834, 0xDD6F,
+				0x820, 0x41, 0x820, 0x42, 0x820, 0x43, 0x820, 0x44,
+				0x820, 0x45, 0x820, 0x46, 0x820, 0x47, 0x820, 0x48,
+				0x820, 0x49, 0x820, 0x4A, 0x820, 0x4B, 0x820, 0x4C,
+				0x820, 0x4D, 0x820, 0x4E, 0x820, 0x4F, 0x820, 0x50,
+				0x820, 0x51, 0x820, 0x52, 0x820, 0x53, 0x820, 0x54,
+				0x820, 0x55, 0x820, 0x56, 0x820, 0x57, 0x820, 0x58,
+				0x820, 0x59, 0x820, 0x5A, 0x820, 0x61, 0x820, 0x62,
+				0x820, 0x63, 0x820, 0x64, 0x820, 0x65, 0x820, 0x66,
+				0x820, 0x67, 0x820, 0x68, 0x820, 0x69, 0x820, 0x6A,
+				0x820, 0x6B, 0x820, 0x6C, 0x820, 0x6D, 0x820, 0x6E,
+				0x820, 0x6F, 0x820, 0x70, 0x820, 0x71, 0x820, 0x72,
+				0x820, 0x73, 0x820, 0x74, 0x820, 0x75, 0x820, 0x76,
+				0x820, 0x77, 0x820, 0x78, 0x820, 0x79, 0x820, 0x7A,
+				0x820, 0x41, 0x820, 0x42, 0x820, 0x43, 0x820, 0x44,
+				0x820, 0x45, 0x820, 0x46, 0x820, 0x47, 0x820, 0x48,
+				0x820, 0x49, 0x820, 0x4A, 0x820, 0x4B, 0x820, 0x4C,
+				0x820, 0x4D, 0x820, 0x4E, 0x820, 0x4F, 0x820, 0x50,
+				0x820, 0x51, 0x820, 0x52, 0x820, 0x53, 0x820, 0x54,
+				0x820, 0x55, 0x820, 0x56, 0x820, 0x57, 0x820, 0x58,
+				0x820, 0x59, 0x820, 0x5A, 0x820, 0x61, 0x820, 0x62,
+				0x820, 0x63, 0x820, 0x64, 0x820, 0x65, 0x820, 0x66,
+				0x820, 0x67, 0x820, 0x69, 0x820, 0x6A, 0x820, 0x6B,
+				0x820, 0x6C, 0x820, 0x6D, 0x820, 0x6E, 0x820, 0x6F,
+				0x820, 0x70, 0x820, 0x71, 0x820, 0x72, 0x820, 0x73,
+				0x820, 0x74, 0x820, 0x75, 0x820, 0x76, 0x820, 0x77,
+				0x820, 0x78, 0x820, 0x79, 0x820, 0x7A, 0x820, 0x41,
+				0x820, 0x42, 0x820, 0x43, 0x820, 0x44, 0x820, 0x45,
+				0x820, 0x46, 0x820, 0x47, 0x820, 0x48, 0x820, 0x49,
+				0x820, 0x4A, 0x820, 0x4B, 0x820, 0x4C, 0x820, 0x4D,
+				0x820, 0x4E, 0x820, 0x4F, 0x820, 0x50, 0x820, 0x51,
+				0x820, 0x52, 0x820, 0x53, 0x820, 0x54, 0x820, 0x55,
+				0x820, 0x56, 0x820, 0x57, 0x820, 0x58, 0x820, 0x59,
+				0x820, 0x5A, 0x820, 0x61, 0x820, 0x62, 0x820, 0x63,
+				0x820, 0x64, 0x820, 0x65, 0x820, 0x66, 0x820, 0x67,
+				0x820, 0x68, 0x820, 0x69, 0x820, 0x6A, 0x820, 0x6B,
+				0x820, 0x6C, 0x820, 0x6D, 0x820, 0x6E, 0x820, 0x6F,
+				0x820, 0x70, 0x820, 0x71, 0x820, 0x72, 0x820, 0x73,
+				0x820, 0x74, 0x820, 0x75, 0x820, 0x76, 0x820, 0x77,
+				0x820, 0x78, 0x820, 0x79, 0x820, 0x7A, 0x820, 0x41,
+				0x820, 0x43, 0x820, 0x44, 0x820, 0x47, 0x820, 0x4A,
+				0x820, 0x4B, 0x820, 0x4E, 0x820, 0x4F, 0x820, 0x50,
+				0x820, 0x51, 0x820, 0x53, 0x820, 0x54, 0x820, 0x55,
+				0x820, 0x56, 0x820, 0x57, 0x820, 0x58, 0x820, 0x59,
+				0x820, 0x5A, 0x820, 0x61, 0x820, 0x62, 0x820, 0x63,
+				0x820, 0x64, 0x820, 0x66, 0x820, 0x68, 0x820, 0x69,
+				0x820, 0x6A, 0x820, 0x6B, 0x820, 0x6C, 0x820, 0x6D,
+				0x820, 0x6E, 0x820, 0x70, 0x820, 0x71, 0x820, 0x72,
+				0x820, 0x73, 0x820, 0x74, 0x820, 0x75, 0x820, 0x76,
+				0x820, 0x77, 0x820, 0x78, 0x820, 0x79, 0x820, 0x7A,
+				0x820, 0x41, 0x820, 0x42, 0x820, 0x43, 0x820, 0x44,
+				0x820, 0x45, 0x820, 0x46, 0x820, 0x47, 0x820, 0x48,
+				0x820, 0x49, 0x820, 0x4A, 0x820, 0x4B, 0x820, 0x4C,
+				0x820, 0x4D, 0x820, 0x4E, 0x820, 0x4F, 0x820, 0x50,
+				0x820, 0x51, 0x820, 0x52, 0x820, 0x53, 0x820, 0x54,
+				0x820, 0x55, 0x820, 0x56, 0x820, 0x57, 0x820, 0x58,
+				0x820, 0x59, 0x820, 0x5A, 0x820, 0x61, 0x820, 0x62,
+				0x820, 0x63, 0x820, 0x64, 0x820, 0x65, 0x820, 0x66,
+				0x820, 0x67, 0x820, 0x68, 0x820, 0x69, 0x820, 0x6A,
+				0x820, 0x6B, 0x820, 0x6C, 0x820, 0x6D, 0x820, 0x6E,
+				0x820, 0x6F, 0x820, 0x70, 0x820, 0x71, 0x820, 0x72,
+				0x820, 0x73, 0x820, 0x74, 0x820, 0x75, 0x820, 0x76,
+				0x820, 0x77, 0x820, 0x78, 0x820, 0x79, 0x820, 0x7A,
+				0x820, 0x41, 0x820, 0x42, 0x820, 0x44, 0x820, 0x45,
+				0x820, 0x46, 0x820, 0x47, 0x820, 0x4A, 0x820, 0x4B,
+				0x820, 0x4C, 0x820, 0x4D, 0x820, 0x4E, 0x820, 0x4F,
+				0x820, 0x50, 0x820, 0x51, 0x820, 0x53, 0x820, 0x54,
+				0x820, 0x55, 0x820, 0x56, 0x820, 0x57, 0x820, 0x58,
+				0x820, 0x59, 0x820, 0x61, 0x820, 0x62, 0x820, 0x63,
+				0x820, 0x64, 0x820, 0x65, 0x820, 0x66, 0x820, 0x67,
+				0x820, 0x68, 0x820, 0x69, 0x820, 0x6A, 0x820, 0x6B,
+				0x820, 0x6C, 0x820, 0x6D, 0x820, 0x6E, 0x820, 0x6F,
+				0x820, 0x70, 0x820, 0x71, 0x820, 0x72, 0x820, 0x73,
+				0x820, 0x74, 0x820, 0x75, 0x820, 0x76, 0x820, 0x77,
+				0x820, 0x78, 0x820, 0x79, 0x820, 0x7A, 0x820, 0x41,
+				0x820, 0x42, 0x820, 0x44, 0x820, 0x45, 0x820, 0x46,
+				0x820, 0x47, 0x820, 0x49, 0x820, 0x4A, 0x820, 0x4B,
+				0x820, 0x4C, 0x820, 0x4D, 0x820, 0x4F, 0x820, 0x53,
+				0x820, 0x54, 0x820, 0x55, 0x820, 0x56, 0x820, 0x57,
+				0x820, 0x58, 0x820, 0x59, 0x820, 0x61, 0x820, 0x62,
+				0x820, 0x63, 0x820, 0x64, 0x820, 0x65, 0x820, 0x66,
+				0x820, 0x67, 0x820, 0x68, 0x820, 0x69, 0x820, 0x6A,
+				0x820, 0x6B, 0x820, 0x6C, 0x820, 0x6D, 0x820, 0x6E,
+				0x820, 0x6F, 0x820, 0x70, 0x820, 0x71, 0x820, 0x72,
+				0x820, 0x73, 0x820, 0x74, 0x820, 0x75, 0x820, 0x76,
+				0x820, 0x77, 0x820, 0x78, 0x820, 0x79, 0x820, 0x7A,
+				0x820, 0x41, 0x820, 0x42, 0x820, 0x43, 0x820, 0x44,
+				0x820, 0x45, 0x820, 0x46, 0x820, 0x47, 0x820, 0x48,
+				0x820, 0x49, 0x820, 0x4A, 0x820, 0x4B, 0x820, 0x4C,
+				0x820, 0x4D, 0x820, 0x4E, 0x820, 0x4F, 0x820, 0x50,
+				0x820, 0x51, 0x820, 0x52, 0x820, 0x53, 0x820, 0x54,
+				0x820, 0x55, 0x820, 0x56, 0x820, 0x57, 0x820, 0x58,
+				0x820, 0x59, 0x820, 0x5A, 0x820, 0x61, 0x820, 0x62,
+				0x820, 0x63, 0x820, 0x64, 0x820, 0x65, 0x820, 0x66,
+				0x820, 0x67, 0x820, 0x68, 0x820, 0x69, 0x820, 0x6A,
+				0x820, 0x6B, 0x820, 0x6C, 0x820, 0x6D, 0x820, 0x6E,
+				0x820, 0x6F, 0x820, 0x70, 0x820, 0x71, 0x820, 0x72,
+				0x820, 0x73, 0x820, 0x74, 0x820, 0x75, 0x820, 0x76,
+				0x820, 0x77, 0x820, 0x78, 0x820, 0x79, 0x820, 0x7A,
+				0x820, 0x41, 0x820, 0x42, 0x820, 0x43, 0x820, 0x44,
+				0x820, 0x45, 0x820, 0x46, 0x820, 0x47, 0x820, 0x48,
+				0x820, 0x49, 0x820, 0x4A, 0x820, 0x4B, 0x820, 0x4C,
+				0x820, 0x4D, 0x820, 0x4E, 0x820, 0x4F, 0x820, 0x50,
+				0x820, 0x51, 0x820, 0x52, 0x820, 0x53, 0x820, 0x54,
+				0x820, 0x55, 0x820, 0x56, 0x820, 0x57, 0x820, 0x58,
+				0x820, 0x59, 0x820, 0x5A, 0x820, 0x61, 0x820, 0x62,
+				0x820, 0x63, 0x820, 0x64, 0x820, 0x65, 0x820, 0x66,
+				0x820, 0x67, 0x820, 0x68, 0x820, 0x69, 0x820, 0x6A,
+				0x820, 0x6B, 0x820, 0x6C, 0x820, 0x6D, 0x820, 0x6E,
+				0x820, 0x6F, 0x820, 0x70, 0x820, 0x71, 0x820, 0x72,
+				0x820, 0x73, 0x820, 0x74, 0x820, 0x75, 0x820, 0x76,
+				0x820, 0x77, 0x820, 0x78, 0x820, 0x79, 0x820, 0x7A,
+				0x820, 0x41, 0x820, 0x42, 0x820, 0x43, 0x820, 0x44,
+				0x820, 0x45, 0x820, 0x46, 0x820, 0x47, 0x820, 0x48,
+				0x820, 0x49, 0x820, 0x4A, 0x820, 0x4B, 0x820, 0x4C,
+				0x820, 0x4D, 0x820, 0x4E, 0x820, 0x4F, 0x820, 0x50,
+				0x820, 0x51, 0x820, 0x52, 0x820, 0x53, 0x820, 0x54,
+				0x820, 0x55, 0x820, 0x56, 0x820, 0x57, 0x820, 0x58,
+				0x820, 0x59, 0x820, 0x5A, 0x820, 0x61, 0x820, 0x62,
+				0x820, 0x63, 0x820, 0x64, 0x820, 0x65, 0x820, 0x66,
+				0x820, 0x67, 0x820, 0x68, 0x820, 0x69, 0x820, 0x6A,
+				0x820, 0x6B, 0x820, 0x6C, 0x820, 0x6D, 0x820, 0x6E,
+				0x820, 0x6F, 0x820, 0x70, 0x820, 0x71, 0x820, 0x72,
+				0x820, 0x73, 0x820, 0x74, 0x820, 0x75, 0x820, 0x76,
+				0x820, 0x77, 0x820, 0x78, 0x820, 0x79, 0x820, 0x7A,
+				0x820, 0x41, 0x820, 0x42, 0x820, 0x43, 0x820, 0x44,
+				0x820, 0x45, 0x820, 0x46, 0x820, 0x47, 0x820, 0x48,
+				0x820, 0x49, 0x820, 0x4A, 0x820, 0x4B, 0x820, 0x4C,
+				0x820, 0x4D, 0x820, 0x4E, 0x820, 0x4F, 0x820, 0x50,
+				0x820, 0x51, 0x820, 0x52, 0x820, 0x53, 0x820, 0x54,
+				0x820, 0x55, 0x820, 0x56, 0x820, 0x57, 0x820, 0x58,
+				0x820, 0x59, 0x820, 0x5A, 0x820, 0x61, 0x820, 0x62,
+				0x820, 0x63, 0x820, 0x64, 0x820, 0x65, 0x820, 0x66,
+				0x820, 0x67, 0x820, 0x68, 0x820, 0x69, 0x820, 0x6A,
+				0x820, 0x6B, 0x820, 0x6C, 0x820, 0x6D, 0x820, 0x6E,
+				0x820, 0x6F, 0x820, 0x70, 0x820, 0x71, 0x820, 0x72,
+				0x820, 0x73, 0x820, 0x74, 0x820, 0x75, 0x820, 0x76,
+				0x820, 0x77, 0x820, 0x78, 0x820, 0x79, 0x820, 0x7A,
+				0x820, 0x41, 0x820, 0x42, 0x820, 0x43, 0x820, 0x44,
+				0x820, 0x45, 0x820, 0x46, 0x820, 0x47, 0x820, 0x48,
+				0x820, 0x49, 0x820, 0x4A, 0x820, 0x4B, 0x820, 0x4C,
+				0x820, 0x4D, 0x820, 0x4E, 0x820, 0x4F, 0x820, 0x50,
+				0x820, 0x51, 0x820, 0x52, 0x820, 0x53, 0x820, 0x54,
+				0x820, 0x55, 0x820, 0x56, 0x820, 0x57, 0x820, 0x58,
+				0x820, 0x59, 0x820, 0x5A, 0x820, 0x61, 0x820, 0x62,
+				0x820, 0x63, 0x820, 0x64, 0x820, 0x65, 0x820, 0x66,
+				0x820, 0x67, 0x820, 0x68, 0x820, 0x69, 0x820, 0x6A,
+				0x820, 0x6B, 0x820, 0x6C, 0x820, 0x6D, 0x820, 0x6E,
+				0x820, 0x6F, 0x820, 0x70, 0x820, 0x71, 0x820, 0x72,
+				0x820, 0x73, 0x820, 0x74, 0x820, 0x75, 0x820, 0x76,
+				0x820, 0x77, 0x820, 0x78, 0x820, 0x79, 0x820, 0x7A,
+				0x820, 0x41, 0x820, 0x42, 0x820, 0x43, 0x820, 0x44,
+				0x820, 0x45, 0x820, 0x46, 0x820, 0x47, 0x820, 0x48,
+				0x820, 0x49, 0x820, 0x4A, 0x820, 0x4B, 0x820, 0x4C,
+				0x820, 0x4D, 0x820, 0x4E, 0x820, 0x4F, 0x820, 0x50,
+				0x820, 0x51, 0x820, 0x52, 0x820, 0x53, 0x820, 0x54,
+				0x820, 0x55, 0x820, 0x56, 0x820, 0x57, 0x820, 0x58,
+				0x820, 0x59, 0x820, 0x5A, 0x820, 0x61, 0x820, 0x62,
+				0x820, 0x63, 0x820, 0x64, 0x820, 0x65, 0x820, 0x66,
+				0x820, 0x67, 0x820, 0x68, 0x820, 0x69, 0x820, 0x6A,
+				0x820, 0x6B, 0x820, 0x6C, 0x820, 0x6D, 0x820, 0x6E,
+				0x820, 0x6F, 0x820, 0x70, 0x820, 0x71, 0x820, 0x72,
+				0x820, 0x73, 0x820, 0x74, 0x820, 0x75, 0x820, 0x76,
+				0x820, 0x77, 0x820, 0x78, 0x820, 0x79, 0x820, 0x7A,
+				0x820, 0x131, 0x820, 0x237, 0x820, 0x391, 0x820, 0x392,
+				0x820, 0x393, 0x820, 0x394, 0x820, 0x395, 0x820, 0x396,
+				0x820, 0x397, 0x820, 0x398, 0x820, 0x399, 0x820, 0x39A,
+				0x820, 0x39B, 0x820, 0x39C, 0x820, 0x39D, 0x820, 0x39E,
+				0x820, 0x39F, 0x820, 0x3A0, 0x820, 0x3A1, 0x820, 0x398,
+				0x820, 0x3A3, 0x820, 0x3A4, 0x820, 0x3A5, 0x820, 0x3A6,
+				0x820, 0x3A7, 0x820, 0x3A8, 0x820, 0x3A9, 0x820, 0x2207,
+				0x820, 0x3B1, 0x820, 0x3B2, 0x820, 0x3B3, 0x820, 0x3B4,
+				0x820, 0x3B5, 0x820, 0x3B6, 0x820, 0x3B7, 0x820, 0x3B8,
+				0x820, 0x3B9, 0x820, 0x3BA, 0x820, 0x3BB, 0x820, 0x3BC,
+				0x820, 0x3BD, 0x820, 0x3BE, 0x820, 0x3BF, 0x820, 0x3C0,
+				0x820, 0x3C1, 0x820, 0x3C2, 0x820, 0x3C3, 0x820, 0x3C4,
+				0x820, 0x3C5, 0x820, 0x3C6, 0x820, 0x3C7, 0x820, 0x3C8,
+				0x820, 0x3C9, 0x820, 0x2202, 0x820, 0x3B5, 0x820, 0x3B8,
+				0x820, 0x3BA, 0x820, 0x3C6, 0x820, 0x3C1, 0x820, 0x3C0,
+				0x820, 0x391, 0x820, 0x392, 0x820, 0x393, 0x820, 0x394,
+				0x820, 0x395, 0x820, 0x396, 0x820, 0x397, 0x820, 0x398,
+				0x820, 0x399, 0x820, 0x39A, 0x820, 0x39B, 0x820, 0x39C,
+				0x820, 0x39D, 0x820, 0x39E, 0x820, 0x39F, 0x820, 0x3A0,
+				0x820, 0x3A1, 0x820, 0x398, 0x820, 0x3A3, 0x820, 0x3A4,
+				0x820, 0x3A5, 0x820, 0x3A6, 0x820, 0x3A7, 0x820, 0x3A8,
+				0x820, 0x3A9, 0x820, 0x2207, 0x820, 0x3B1, 0x820, 0x3B2,
+				0x820, 0x3B3, 0x820, 0x3B4, 0x820, 0x3B5, 0x820, 0x3B6,
+				0x820, 0x3B7, 0x820, 0x3B8, 0x820, 0x3B9, 0x820, 0x3BA,
+				0x820, 0x3BB, 0x820, 0x3BC, 0x820, 0x3BD, 0x820, 0x3BE,
+				0x820, 0x3BF, 0x820, 0x3C0, 0x820, 0x3C1, 0x820, 0x3C2,
+				0x820, 0x3C3, 0x820, 0x3C4, 0x820, 0x3C5, 0x820, 0x3C6,
+				0x820, 0x3C7, 0x820, 0x3C8, 0x820, 0x3C9, 0x820, 0x2202,
+				0x820, 0x3B5, 0x820, 0x3B8, 0x820, 0x3BA, 0x820, 0x3C6,
+				0x820, 0x3C1, 0x820, 0x3C0, 0x820, 0x391, 0x820, 0x392,
+				0x820, 0x393, 0x820, 0x394, 0x820, 0x395, 0x820, 0x396,
+				0x820, 0x397, 0x820, 0x398, 0x820, 0x399, 0x820, 0x39A,
+				0x820, 0x39B, 0x820, 0x39C, 0x820, 0x39D, 0x820, 0x39E,
+				0x820, 0x39F, 0x820, 0x3A0, 0x820, 0x3A1, 0x820, 0x398,
+				0x820, 0x3A3, 0x820, 0x3A4, 0x820, 0x3A5, 0x820, 0x3A6,
+				0x820, 0x3A7, 0x820, 0x3A8, 0x820, 0x3A9, 0x820, 0x2207,
+				0x820, 0x3B1, 0x820, 0x3B2, 0x820, 0x3B3, 0x820, 0x3B4,
+				0x820, 0x3B5, 0x820, 0x3B6, 0x820, 0x3B7, 0x820, 0x3B8,
+				0x820, 0x3B9, 0x820, 0x3BA, 0x820, 0x3BB, 0x820, 0x3BC,
+				0x820, 0x3BD, 0x820, 0x3BE, 0x820, 0x3BF, 0x820, 0x3C0,
+				0x820, 0x3C1, 0x820, 0x3C2, 0x820, 0x3C3, 0x820, 0x3C4,
+				0x820, 0x3C5, 0x820, 0x3C6, 0x820, 0x3C7, 0x820, 0x3C8,
+				0x820, 0x3C9, 0x820, 0x2202, 0x820, 0x3B5, 0x820, 0x3B8,
+				0x820, 0x3BA, 0x820, 0x3C6, 0x820, 0x3C1, 0x820, 0x3C0,
+				0x820, 0x391, 0x820, 0x392, 0x820, 0x393, 0x820, 0x394,
+				0x820, 0x395, 0x820, 0x396, 0x820, 0x397, 0x820, 0x398,
+				0x820, 0x399, 0x820, 0x39A, 0x820, 0x39B, 0x820, 0x39C,
+				0x820, 0x39D, 0x820, 0x39E, 0x820, 0x39F, 0x820, 0x3A0,
+				0x820, 0x3A1, 0x820, 0x398, 0x820, 0x3A3, 0x820, 0x3A4,
+				0x820, 0x3A5, 0x820, 0x3A6, 0x820, 0x3A7, 0x820, 0x3A8,
+				0x820, 0x3A9, 0x820, 0x2207, 0x820, 0x3B1, 0x820, 0x3B2,
+				0x820, 0x3B3, 0x820, 0x3B4, 0x820, 0x3B5, 0x820, 0x3B6,
+				0x820, 0x3B7, 0x820, 0x3B8, 0x820, 0x3B9, 0x820, 0x3BA,
+				0x820, 0x3BB, 0x820, 0x3BC, 0x820, 0x3BD, 0x820, 0x3BE,
+				0x820, 0x3BF, 0x820, 0x3C0, 0x820, 0x3C1, 0x820, 0x3C2,
+				0x820, 0x3C3, 0x820, 0x3C4, 0x820, 0x3C5, 0x820, 0x3C6,
+				0x820, 0x3C7, 0x820, 0x3C8, 0x820, 0x3C9, 0x820, 0x2202,
+				0x820, 0x3B5, 0x820, 0x3B8, 0x820, 0x3BA, 0x820, 0x3C6,
+				0x820, 0x3C1, 0x820, 0x3C0, 0x820, 0x391, 0x820, 0x392,
+				0x820, 0x393, 0x820, 0x394, 0x820, 0x395, 0x820, 0x396,
+				0x820, 0x397, 0x820, 0x398, 0x820, 0x399, 0x820, 0x39A,
+				0x820, 0x39B, 0x820, 0x39C, 0x820, 0x39D, 0x820, 0x39E,
+				0x820, 0x39F, 0x820, 0x3A0, 0x820, 0x3A1, 0x820, 0x398,
+				0x820, 0x3A3, 0x820, 0x3A4, 0x820, 0x3A5, 0x820, 0x3A6,
+				0x820, 0x3A7, 0x820, 0x3A8, 0x820, 0x3A9, 0x820, 0x2207,
+				0x820, 0x3B1, 0x820, 0x3B2, 0x820, 0x3B3, 0x820, 0x3B4,
+				0x820, 0x3B5, 0x820, 0x3B6, 0x820, 0x3B7, 0x820, 0x3B8,
+				0x820, 0x3B9, 0x820, 0x3BA, 0x820, 0x3BB, 0x820, 0x3BC,
+				0x820, 0x3BD, 0x820, 0x3BE, 0x820, 0x3BF, 0x820, 0x3C0,
+				0x820, 0x3C1, 0x820, 0x3C2, 0x820, 0x3C3, 0x820, 0x3C4,
+				0x820, 0x3C5, 0x820, 0x3C6, 0x820, 0x3C7, 0x820, 0x3C8,
+				0x820, 0x3C9, 0x820, 0x2202, 0x820, 0x3B5, 0x820, 0x3B8,
+				0x820, 0x3BA, 0x820, 0x3C6, 0x820, 0x3C1, 0x820, 0x3C0,
+				0x820, 0x3DC, 0x820, 0x3DD, 0x820, 0x30, 0x820, 0x31,
+				0x820, 0x32, 0x820, 0x33, 0x820, 0x34, 0x820, 0x35,
+				0x820, 0x36, 0x820, 0x37, 0x820, 0x38, 0x820, 0x39,
+				0x820, 0x30, 0x820, 0x31, 0x820, 0x32, 0x820, 0x33,
+				0x820, 0x34, 0x820, 0x35, 0x820, 0x36, 0x820, 0x37,
+				0x820, 0x38, 0x820, 0x39, 0x820, 0x30, 0x820, 0x31,
+				0x820, 0x32, 0x820, 0x33, 0x820, 0x34, 0x820, 0x35,
+				0x820, 0x36, 0x820, 0x37, 0x820, 0x38, 0x820, 0x39,
+				0x820, 0x30, 0x820, 0x31, 0x820, 0x32, 0x820, 0x33,
+				0x820, 0x34, 0x820, 0x35, 0x820, 0x36, 0x820, 0x37,
+				0x820, 0x38, 0x820, 0x39, 0x820, 0x30, 0x820, 0x31,
+				0x820, 0x32, 0x820, 0x33, 0x820, 0x34, 0x820, 0x35,
+				0x820, 0x36, 0x820, 0x37, 0x820, 0x38, 0x820, 0x39,
+				0x820, 0x627, 0x820, 0x628, 0x820, 0x62C, 0x820, 0x62F,
+				0x820, 0x648, 0x820, 0x632, 0x820, 0x62D, 0x820, 0x637,
+				0x820, 0x64A, 0x820, 0x643, 0x820, 0x644, 0x820, 0x645,
+				0x820, 0x646, 0x820, 0x633, 0x820, 0x639, 0x820, 0x641,
+				0x820, 0x635, 0x820, 0x642, 0x820, 0x631, 0x820, 0x634,
+				0x820, 0x62A, 0x820, 0x62B, 0x820, 0x62E, 0x820, 0x630,
+				0x820, 0x636, 0x820, 0x638, 0x820, 0x63A, 0x820, 0x66E,
+				0x820, 0x6BA, 0x820, 0x6A1, 0x820, 0x66F, 0x820, 0x628,
+				0x820, 0x62C, 0x820, 0x647, 0x820, 0x62D, 0x820, 0x64A,
+				0x820, 0x643, 0x820, 0x644, 0x820, 0x645, 0x820, 0x646,
+				0x820, 0x633, 0x820, 0x639, 0x820, 0x641, 0x820, 0x635,
+				0x820, 0x642, 0x820, 0x634, 0x820, 0x62A, 0x820, 0x62B,
+				0x820, 0x62E, 0x820, 0x636, 0x820, 0x63A, 0x820, 0x62C,
+				0x820, 0x62D, 0x820, 0x64A, 0x820, 0x644, 0x820, 0x646,
+				0x820, 0x633, 0x820, 0x639, 0x820, 0x635, 0x820, 0x642,
+				0x820, 0x634, 0x820, 0x62E, 0x820, 0x636, 0x820, 0x63A,
+				0x820, 0x6BA, 0x820, 0x66F, 0x820, 0x628, 0x820, 0x62C,
+				0x820, 0x647, 0x820, 0x62D, 0x820, 0x637, 0x820, 0x64A,
+				0x820, 0x643, 0x820, 0x645, 0x820, 0x646, 0x820, 0x633,
+				0x820, 0x639, 0x820, 0x641, 0x820, 0x635, 0x820, 0x642,
+				0x820, 0x634, 0x820, 0x62A, 0x820, 0x62B, 0x820, 0x62E,
+				0x820, 0x636, 0x820, 0x638, 0x820, 0x63A, 0x820, 0x66E,
+				0x820, 0x6A1, 0x820, 0x627, 0x820, 0x628, 0x820, 0x62C,
+				0x820, 0x62F, 0x820, 0x647, 0x820, 0x648, 0x820, 0x632,
+				0x820, 0x62D, 0x820, 0x637, 0x820, 0x64A, 0x820, 0x644,
+				0x820, 0x645, 0x820, 0x646, 0x820, 0x633, 0x820, 0x639,
+				0x820, 0x641, 0x820, 0x635, 0x820, 0x642, 0x820, 0x631,
+				0x820, 0x634, 0x820, 0x62A, 0x820, 0x62B, 0x820, 0x62E,
+				0x820, 0x630, 0x820, 0x636, 0x820, 0x638, 0x820, 0x63A,
+				0x820, 0x628, 0x820, 0x62C, 0x820, 0x62F, 0x820, 0x648,
+				0x820, 0x632, 0x820, 0x62D, 0x820, 0x637, 0x820, 0x64A,
+				0x820, 0x644, 0x820, 0x645, 0x820, 0x646, 0x820, 0x633,
+				0x820, 0x639, 0x820, 0x641, 0x820, 0x635, 0x820, 0x642,
+				0x820, 0x631, 0x820, 0x634, 0x820, 0x62A, 0x820, 0x62B,
+				0x820, 0x62E, 0x820, 0x630, 0x820, 0x636, 0x820, 0x638,
+				0x820, 0x63A, 0x840, 0x30, 0x2E, 0x840, 0x30, 0x2C,
+				0x840, 0x31, 0x2C, 0x840, 0x32, 0x2C, 0x840, 0x33,
+				0x2C, 0x840, 0x34, 0x2C, 0x840, 0x35, 0x2C, 0x840,
+				0x36, 0x2C, 0x840, 0x37, 0x2C, 0x840, 0x38, 0x2C,
+				0x840, 0x39, 0x2C, 0x860, 0x28, 0x41, 0x29, 0x860,
+				0x28, 0x42, 0x29, 0x860, 0x28, 0x43, 0x29, 0x860,
+				0x28, 0x44, 0x29, 0x860, 0x28, 0x45, 0x29, 0x860,
+				0x28, 0x46, 0x29, 0x860, 0x28, 0x47, 0x29, 0x860,
+				0x28, 0x48, 0x29, 0x860, 0x28, 0x49, 0x29, 0x860,
+				0x28, 0x4A, 0x29, 0x860, 0x28, 0x4B, 0x29, 0x860,
+				0x28, 0x4C, 0x29, 0x860, 0x28, 0x4D, 0x29, 0x860,
+				0x28, 0x4E, 0x29, 0x860, 0x28, 0x4F, 0x29, 0x860,
+				0x28, 0x50, 0x29, 0x860, 0x28, 0x51, 0x29, 0x860,
+				0x28, 0x52, 0x29, 0x860, 0x28, 0x53, 0x29, 0x860,
+				0x28, 0x54, 0x29, 0x860, 0x28, 0x55, 0x29, 0x860,
+				0x28, 0x56, 0x29, 0x860, 0x28, 0x57, 0x29, 0x860,
+				0x28, 0x58, 0x29, 0x860, 0x28, 0x59, 0x29, 0x860,
+				0x28, 0x5A, 0x29, 0x860, 0x3014, 0x53, 0x3015, 0x820,
+				0x43, 0x820, 0x52, 0x840, 0x43, 0x44, 0x840, 0x57,
+				0x5A, 0x820, 0x41, 0x820, 0x42, 0x820, 0x43, 0x820,
+				0x44, 0x820, 0x45, 0x820, 0x46, 0x820, 0x47, 0x820,
+				0x48, 0x820, 0x49, 0x820, 0x4A, 0x820, 0x4B, 0x820,
+				0x4C, 0x820, 0x4D, 0x820, 0x4E, 0x820, 0x4F, 0x820,
+				0x50, 0x820, 0x51, 0x820, 0x52, 0x820, 0x53, 0x820,
+				0x54, 0x820, 0x55, 0x820, 0x56, 0x820, 0x57, 0x820,
+				0x58, 0x820, 0x59, 0x820, 0x5A, 0x840, 0x48, 0x56,
+				0x840, 0x4D, 0x56, 0x840, 0x53, 0x44, 0x840, 0x53,
+				0x53, 0x860, 0x50, 0x50, 0x56, 0x840, 0x57, 0x43,
+				0x840, 0x4D, 0x43, 0x840, 0x4D, 0x44, 0x840, 0x4D,
+				0x52, 0x840, 0x44, 0x4A, 0x840, 0x307B, 0x304B, 0x840,
+				0x30B3, 0x30B3, 0x820, 0x30B5, 0x820, 0x624B, 0x820, 0x5B57,
+				0x820, 0x53CC, 0x840, 0x30C6, 0x3099, 0x820, 0x4E8C, 0x820,
+				0x591A, 0x820, 0x89E3, 0x820, 0x5929, 0x820, 0x4EA4, 0x820,
+				0x6620, 0x820, 0x7121, 0x820, 0x6599, 0x820, 0x524D, 0x820,
+				0x5F8C, 0x820, 0x518D, 0x820, 0x65B0, 0x820, 0x521D, 0x820,
+				0x7D42, 0x820, 0x751F, 0x820, 0x8CA9, 0x820, 0x58F0, 0x820,
+				0x5439, 0x820, 0x6F14, 0x820, 0x6295, 0x820, 0x6355, 0x820,
+				0x4E00, 0x820, 0x4E09, 0x820, 0x904A, 0x820, 0x5DE6, 0x820,
+				0x4E2D, 0x820, 0x53F3, 0x820, 0x6307, 0x820, 0x8D70, 0x820,
+				0x6253, 0x820, 0x7981, 0x820, 0x7A7A, 0x820, 0x5408, 0x820,
+				0x6E80, 0x820, 0x6709, 0x820, 0x6708, 0x820, 0x7533, 0x820,
+				0x5272, 0x820, 0x55B6, 0x820, 0x914D, 0x860, 0x3014, 0x672C,
+				0x3015, 0x860, 0x3014, 0x4E09, 0x3015, 0x860, 0x3014, 0x4E8C,
+				0x3015, 0x860, 0x3014, 0x5B89, 0x3015, 0x860, 0x3014, 0x70B9,
+				0x3015, 0x860, 0x3014, 0x6253, 0x3015, 0x860, 0x3014, 0x76D7,
+				0x3015, 0x860, 0x3014, 0x52DD, 0x3015, 0x860, 0x3014, 0x6557,
+				0x3015, 0x820, 0x5F97, 0x820, 0x53EF, 0x820, 0x30, 0x820,
+				0x31, 0x820, 0x32, 0x820, 0x33, 0x820, 0x34, 0x820,
+				0x35, 0x820, 0x36, 0x820, 0x37, 0x820, 0x38, 0x820,
+				0x39, 0x21, 0x4E3D, 0x21, 0x4E38, 0x21, 0x4E41, 0x42,
+				0xD840, 0xDD22, 0x21, 0x4F60, 0x21, 0x4FAE, 0x21, 0x4FBB,
+				0x21, 0x5002, 0x21, 0x507A, 0x21, 0x5099, 0x21, 0x50E7,
+				0x21, 0x50CF, 0x21, 0x349E, 0x42, 0xD841, 0xDE3A, 0x21,
+				0x514D, 0x21, 0x5154, 0x21, 0x5164, 0x21, 0x5177, 0x42,
+				0xD841, 0xDD1C, 0x21, 0x34B9, 0x21, 0x5167, 0x21, 0x518D,
+				0x42, 0xD841, 0xDD4B, 0x21, 0x5197, 0x21, 0x51A4, 0x21,
+				0x4ECC, 0x21, 0x51AC, 0x21, 0x51B5, 0x42, 0xD864, 0xDDDF,
+				0x21, 0x51F5, 0x21, 0x5203, 0x21, 0x34DF, 0x21, 0x523B,
+				0x21, 0x5246, 0x21, 0x5272, 0x21, 0x5277, 0x21, 0x3515,
+				0x21, 0x52C7, 0x21, 0x52C9, 0x21, 0x52E4, 0x21, 0x52FA,
+				0x21, 0x5305, 0x21, 0x5306, 0x21, 0x5317, 0x21, 0x5349,
+				0x21, 0x5351, 0x21, 0x535A, 0x21, 0x5373, 0x21, 0x537D,
+				0x21, 0x537F, 0x21, 0x537F, 0x21, 0x537F, 0x42, 0xD842,
+				0xDE2C, 0x21, 0x7070, 0x21, 0x53CA, 0x21, 0x53DF, 0x42,
+				0xD842, 0xDF63, 0x21, 0x53EB, 0x21, 0x53F1, 0x21, 0x5406,
+				0x21, 0x549E, 0x21, 0x5438, 0x21, 0x5448, 0x21, 0x5468,
+				0x21, 0x54A2, 0x21, 0x54F6, 0x21, 0x5510, 0x21, 0x5553,
+				0x21, 0x5563, 0x21, 0x5584, 0x21, 0x5584, 0x21, 0x5599,
+				0x21, 0x55AB, 0x21, 0x55B3, 0x21, 0x55C2, 0x21, 0x5716,
+				0x21, 0x5606, 0x21, 0x5717, 0x21, 0x5651, 0x21, 0x5674,
+				0x21, 0x5207, 0x21, 0x58EE, 0x21, 0x57CE, 0x21, 0x57F4,
+				0x21, 0x580D, 0x21, 0x578B, 0x21, 0x5832, 0x21, 0x5831,
+				0x21, 0x58AC, 0x42, 0xD845, 0xDCE4, 0x21, 0x58F2, 0x21,
+				0x58F7, 0x21, 0x5906, 0x21, 0x591A, 0x21, 0x5922, 0x21,
+				0x5962, 0x42, 0xD845, 0xDEA8, 0x42, 0xD845, 0xDEEA, 0x21,
+				0x59EC, 0x21, 0x5A1B, 0x21, 0x5A27, 0x21, 0x59D8, 0x21,
+				0x5A66, 0x21, 0x36EE, 0x21, 0x36FC, 0x21, 0x5B08, 0x21,
+				0x5B3E, 0x21, 0x5B3E, 0x42, 0xD846, 0xDDC8, 0x21, 0x5BC3,
+				0x21, 0x5BD8, 0x21, 0x5BE7, 0x21, 0x5BF3, 0x42, 0xD846,
+				0xDF18, 0x21, 0x5BFF, 0x21, 0x5C06, 0x21, 0x5F53, 0x21,
+				0x5C22, 0x21, 0x3781, 0x21, 0x5C60, 0x21, 0x5C6E, 0x21,
+				0x5CC0, 0x21, 0x5C8D, 0x42, 0xD847, 0xDDE4, 0x21, 0x5D43,
+				0x42, 0xD847, 0xDDE6, 0x21, 0x5D6E, 0x21, 0x5D6B, 0x21,
+				0x5D7C, 0x21, 0x5DE1, 0x21, 0x5DE2, 0x21, 0x382F, 0x21,
+				0x5DFD, 0x21, 0x5E28, 0x21, 0x5E3D, 0x21, 0x5E69, 0x21,
+				0x3862, 0x42, 0xD848, 0xDD83, 0x21, 0x387C, 0x21, 0x5EB0,
+				0x21, 0x5EB3, 0x21, 0x5EB6, 0x21, 0x5ECA, 0x42, 0xD868,
+				0xDF92, 0x21, 0x5EFE, 0x42, 0xD848, 0xDF31, 0x42, 0xD848,
+				0xDF31, 0x21, 0x8201, 0x21, 0x5F22, 0x21, 0x5F22, 0x21,
+				0x38C7, 0x42, 0xD84C, 0xDEB8, 0x42, 0xD858, 0xDDDA, 0x21,
+				0x5F62, 0x21, 0x5F6B, 0x21, 0x38E3, 0x21, 0x5F9A, 0x21,
+				0x5FCD, 0x21, 0x5FD7, 0x21, 0x5FF9, 0x21, 0x6081, 0x21,
+				0x393A, 0x21, 0x391C, 0x21, 0x6094, 0x42, 0xD849, 0xDED4,
+				0x21, 0x60C7, 0x21, 0x6148, 0x21, 0x614C, 0x21, 0x614E,
+				0x21, 0x614C, 0x21, 0x617A, 0x21, 0x618E, 0x21, 0x61B2,
+				0x21, 0x61A4, 0x21, 0x61AF, 0x21, 0x61DE, 0x21, 0x61F2,
+				0x21, 0x61F6, 0x21, 0x6210, 0x21, 0x621B, 0x21, 0x625D,
+				0x21, 0x62B1, 0x21, 0x62D4, 0x21, 0x6350, 0x42, 0xD84A,
+				0xDF0C, 0x21, 0x633D, 0x21, 0x62FC, 0x21, 0x6368, 0x21,
+				0x6383, 0x21, 0x63E4, 0x42, 0xD84A, 0xDFF1, 0x21, 0x6422,
+				0x21, 0x63C5, 0x21, 0x63A9, 0x21, 0x3A2E, 0x21, 0x6469,
+				0x21, 0x647E, 0x21, 0x649D, 0x21, 0x6477, 0x21, 0x3A6C,
+				0x21, 0x654F, 0x21, 0x656C, 0x42, 0xD84C, 0xDC0A, 0x21,
+				0x65E3, 0x21, 0x66F8, 0x21, 0x6649, 0x21, 0x3B19, 0x21,
+				0x6691, 0x21, 0x3B08, 0x21, 0x3AE4, 0x21, 0x5192, 0x21,
+				0x5195, 0x21, 0x6700, 0x21, 0x669C, 0x21, 0x80AD, 0x21,
+				0x43D9, 0x21, 0x6717, 0x21, 0x671B, 0x21, 0x6721, 0x21,
+				0x675E, 0x21, 0x6753, 0x42, 0xD84C, 0xDFC3, 0x21, 0x3B49,
+				0x21, 0x67FA, 0x21, 0x6785, 0x21, 0x6852, 0x21, 0x6885,
+				0x42, 0xD84D, 0xDC6D, 0x21, 0x688E, 0x21, 0x681F, 0x21,
+				0x6914, 0x21, 0x3B9D, 0x21, 0x6942, 0x21, 0x69A3, 0x21,
+				0x69EA, 0x21, 0x6AA8, 0x42, 0xD84D, 0xDEA3, 0x21, 0x6ADB,
+				0x21, 0x3C18, 0x21, 0x6B21, 0x42, 0xD84E, 0xDCA7, 0x21,
+				0x6B54, 0x21, 0x3C4E, 0x21, 0x6B72, 0x21, 0x6B9F, 0x21,
+				0x6BBA, 0x21, 0x6BBB, 0x42, 0xD84E, 0xDE8D, 0x42, 0xD847,
+				0xDD0B, 0x42, 0xD84E, 0xDEFA, 0x21, 0x6C4E, 0x42, 0xD84F,
+				0xDCBC, 0x21, 0x6CBF, 0x21, 0x6CCD, 0x21, 0x6C67, 0x21,
+				0x6D16, 0x21, 0x6D3E, 0x21, 0x6D77, 0x21, 0x6D41, 0x21,
+				0x6D69, 0x21, 0x6D78, 0x21, 0x6D85, 0x42, 0xD84F, 0xDD1E,
+				0x21, 0x6D34, 0x21, 0x6E2F, 0x21, 0x6E6E, 0x21, 0x3D33,
+				0x21, 0x6ECB, 0x21, 0x6EC7, 0x42, 0xD84F, 0xDED1, 0x21,
+				0x6DF9, 0x21, 0x6F6E, 0x42, 0xD84F, 0xDF5E, 0x42, 0xD84F,
+				0xDF8E, 0x21, 0x6FC6, 0x21, 0x7039, 0x21, 0x701E, 0x21,
+				0x701B, 0x21, 0x3D96, 0x21, 0x704A, 0x21, 0x707D, 0x21,
+				0x7077, 0x21, 0x70AD, 0x42, 0xD841, 0xDD25, 0x21, 0x7145,
+				0x42, 0xD850, 0xDE63, 0x21, 0x719C, 0x42, 0xD850, 0xDFAB,
+				0x21, 0x7228, 0x21, 0x7235, 0x21, 0x7250, 0x42, 0xD851,
+				0xDE08, 0x21, 0x7280, 0x21, 0x7295, 0x42, 0xD851, 0xDF35,
+				0x42, 0xD852, 0xDC14, 0x21, 0x737A, 0x21, 0x738B, 0x21,
+				0x3EAC, 0x21, 0x73A5, 0x21, 0x3EB8, 0x21, 0x3EB8, 0x21,
+				0x7447, 0x21, 0x745C, 0x21, 0x7471, 0x21, 0x7485, 0x21,
+				0x74CA, 0x21, 0x3F1B, 0x21, 0x7524, 0x42, 0xD853, 0xDC36,
+				0x21, 0x753E, 0x42, 0xD853, 0xDC92, 0x21, 0x7570, 0x42,
+				0xD848, 0xDD9F, 0x21, 0x7610, 0x42, 0xD853, 0xDFA1, 0x42,
+				0xD853, 0xDFB8, 0x42, 0xD854, 0xDC44, 0x21, 0x3FFC, 0x21,
+				0x4008, 0x21, 0x76F4, 0x42, 0xD854, 0xDCF3, 0x42, 0xD854,
+				0xDCF2, 0x42, 0xD854, 0xDD19, 0x42, 0xD854, 0xDD33, 0x21,
+				0x771E, 0x21, 0x771F, 0x21, 0x771F, 0x21, 0x774A, 0x21,
+				0x4039, 0x21, 0x778B, 0x21, 0x4046, 0x21, 0x4096, 0x42,
+				0xD855, 0xDC1D, 0x21, 0x784E, 0x21, 0x788C, 0x21, 0x78CC,
+				0x21, 0x40E3, 0x42, 0xD855, 0xDE26, 0x21, 0x7956, 0x42,
+				0xD855, 0xDE9A, 0x42, 0xD855, 0xDEC5, 0x21, 0x798F, 0x21,
+				0x79EB, 0x21, 0x412F, 0x21, 0x7A40, 0x21, 0x7A4A, 0x21,
+				0x7A4F, 0x42, 0xD856, 0xDD7C, 0x42, 0xD856, 0xDEA7, 0x42,
+				0xD856, 0xDEA7, 0x21, 0x7AEE, 0x21, 0x4202, 0x42, 0xD856,
+				0xDFAB, 0x21, 0x7BC6, 0x21, 0x7BC9, 0x21, 0x4227, 0x42,
+				0xD857, 0xDC80, 0x21, 0x7CD2, 0x21, 0x42A0, 0x21, 0x7CE8,
+				0x21, 0x7CE3, 0x21, 0x7D00, 0x42, 0xD857, 0xDF86, 0x21,
+				0x7D63, 0x21, 0x4301, 0x21, 0x7DC7, 0x21, 0x7E02, 0x21,
+				0x7E45, 0x21, 0x4334, 0x42, 0xD858, 0xDE28, 0x42, 0xD858,
+				0xDE47, 0x21, 0x4359, 0x42, 0xD858, 0xDED9, 0x21, 0x7F7A,
+				0x42, 0xD858, 0xDF3E, 0x21, 0x7F95, 0x21, 0x7FFA, 0x21,
+				0x8005, 0x42, 0xD859, 0xDCDA, 0x42, 0xD859, 0xDD23, 0x21,
+				0x8060, 0x42, 0xD859, 0xDDA8, 0x21, 0x8070, 0x42, 0xD84C,
+				0xDF5F, 0x21, 0x43D5, 0x21, 0x80B2, 0x21, 0x8103, 0x21,
+				0x440B, 0x21, 0x813E, 0x21, 0x5AB5, 0x42, 0xD859, 0xDFA7,
+				0x42, 0xD859, 0xDFB5, 0x42, 0xD84C, 0xDF93, 0x42, 0xD84C,
+				0xDF9C, 0x21, 0x8201, 0x21, 0x8204, 0x21, 0x8F9E, 0x21,
+				0x446B, 0x21, 0x8291, 0x21, 0x828B, 0x21, 0x829D, 0x21,
+				0x52B3, 0x21, 0x82B1, 0x21, 0x82B3, 0x21, 0x82BD, 0x21,
+				0x82E6, 0x42, 0xD85A, 0xDF3C, 0x21, 0x82E5, 0x21, 0x831D,
+				0x21, 0x8363, 0x21, 0x83AD, 0x21, 0x8323, 0x21, 0x83BD,
+				0x21, 0x83E7, 0x21, 0x8457, 0x21, 0x8353, 0x21, 0x83CA,
+				0x21, 0x83CC, 0x21, 0x83DC, 0x42, 0xD85B, 0xDC36, 0x42,
+				0xD85B, 0xDD6B, 0x42, 0xD85B, 0xDCD5, 0x21, 0x452B, 0x21,
+				0x84F1, 0x21, 0x84F3, 0x21, 0x8516, 0x42, 0xD85C, 0xDFCA,
+				0x21, 0x8564, 0x42, 0xD85B, 0xDF2C, 0x21, 0x455D, 0x21,
+				0x4561, 0x42, 0xD85B, 0xDFB1, 0x42, 0xD85C, 0xDCD2, 0x21,
+				0x456B, 0x21, 0x8650, 0x21, 0x865C, 0x21, 0x8667, 0x21,
+				0x8669, 0x21, 0x86A9, 0x21, 0x8688, 0x21, 0x870E, 0x21,
+				0x86E2, 0x21, 0x8779, 0x21, 0x8728, 0x21, 0x876B, 0x21,
+				0x8786, 0x21, 0x45D7, 0x21, 0x87E1, 0x21, 0x8801, 0x21,
+				0x45F9, 0x21, 0x8860, 0x21, 0x8863, 0x42, 0xD85D, 0xDE67,
+				0x21, 0x88D7, 0x21, 0x88DE, 0x21, 0x4635, 0x21, 0x88FA,
+				0x21, 0x34BB, 0x42, 0xD85E, 0xDCAE, 0x42, 0xD85E, 0xDD66,
+				0x21, 0x46BE, 0x21, 0x46C7, 0x21, 0x8AA0, 0x21, 0x8AED,
+				0x21, 0x8B8A, 0x21, 0x8C55, 0x42, 0xD85F, 0xDCA8, 0x21,
+				0x8CAB, 0x21, 0x8CC1, 0x21, 0x8D1B, 0x21, 0x8D77, 0x42,
+				0xD85F, 0xDF2F, 0x42, 0xD842, 0xDC04, 0x21, 0x8DCB, 0x21,
+				0x8DBC, 0x21, 0x8DF0, 0x42, 0xD842, 0xDCDE, 0x21, 0x8ED4,
+				0x21, 0x8F38, 0x42, 0xD861, 0xDDD2, 0x42, 0xD861, 0xDDED,
+				0x21, 0x9094, 0x21, 0x90F1, 0x21, 0x9111, 0x42, 0xD861,
+				0xDF2E, 0x21, 0x911B, 0x21, 0x9238, 0x21, 0x92D7, 0x21,
+				0x92D8, 0x21, 0x927C, 0x21, 0x93F9, 0x21, 0x9415, 0x42,
+				0xD862, 0xDFFA, 0x21, 0x958B, 0x21, 0x4995, 0x21, 0x95B7,
+				0x42, 0xD863, 0xDD77, 0x21, 0x49E6, 0x21, 0x96C3, 0x21,
+				0x5DB2, 0x21, 0x9723, 0x42, 0xD864, 0xDD45, 0x42, 0xD864,
+				0xDE1A, 0x21, 0x4A6E, 0x21, 0x4A76, 0x21, 0x97E0, 0x42,
+				0xD865, 0xDC0A, 0x21, 0x4AB2, 0x42, 0xD865, 0xDC96, 0x21,
+				0x980B, 0x21, 0x980B, 0x21, 0x9829, 0x42, 0xD865, 0xDDB6,
+				0x21, 0x98E2, 0x21, 0x4B33, 0x21, 0x9929, 0x21, 0x99A7,
+				0x21, 0x99C2, 0x21, 0x99FE, 0x21, 0x4BCE, 0x42, 0xD866,
+				0xDF30, 0x21, 0x9B12, 0x21, 0x9C40, 0x21, 0x9CFD, 0x21,
+				0x4CCE, 0x21, 0x4CED, 0x21, 0x9D67, 0x42, 0xD868, 0xDCCE,
+				0x21, 0x4CF8, 0x42, 0xD868, 0xDD05, 0x42, 0xD868, 0xDE0E,
+				0x42, 0xD868, 0xDE91, 0x21, 0x9EBB, 0x21, 0x4D56, 0x21,
+				0x9EF9, 0x21, 0x9EFE, 0x21, 0x9F05, 0x21, 0x9F0F, 0x21,
+				0x9F16, 0x21, 0x9F3B, 0x42, 0xD869, 0xDE00,
+			};
+
+			template< typename Dummy >
+			const unsigned short NormalizationTables< Dummy >::CompositionStarts[ 378 ] =
+			{
+				0x0, 0x1, 0x2, 0x3, 0x13, 0x16, 0x1B, 0x21,
+				0x32, 0x33, 0x3A, 0x41, 0x50, 0x51, 0x56, 0x5C,
+				0x5F, 0x68, 0x78, 0x7A, 0x82, 0x89, 0x90, 0xA3,
+				0xA5, 0xAB, 0xAD, 0xB6, 0xBC, 0xCC, 0xCF, 0xD4,
+				0xDA, 0xEB, 0xEC, 0xF3, 0xFB, 0x109, 0x10B, 0x110,
+				0x116, 0x119, 0x122, 0x132, 0x134, 0x13C, 0x143, 0x14B,
+				0x15E, 0x160, 0x167, 0x169, 0x173, 0x179, 0x17C, 0x180,
+				0x181, 0x182, 0x184, 0x185, 0x189, 0x18A, 0x18E, 0x191,
+				0x192, 0x193, 0x197, 0x19B, 0x19C, 0x19D, 0x19F, 0x1A0,
+				0x1A4, 0x1A5, 0x1A9, 0x1AC, 0x1AD, 0x1AE, 0x1B2, 0x1B6,
+				0x1BA, 0x1BC, 0x1BE, 0x1C0, 0x1C2, 0x1C3, 0x1C4, 0x1C5,
+				0x1C6, 0x1C7, 0x1C8, 0x1C9, 0x1CA, 0x1CB, 0x1D0, 0x1D5,
+				0x1DA, 0x1DF, 0x1E0, 0x1E1, 0x1E2, 0x1E3, 0x1E4, 0x1E5,
+				0x1E6, 0x1E7, 0x1E8, 0x1E9, 0x1F0, 0x1F4, 0x1F9, 0x200,
+				0x204, 0x205, 0x20B, 0x210, 0x211, 0x212, 0x21A, 0x21E,
+				0x224, 0x22C, 0x230, 0x232, 0x23A, 0x240, 0x243, 0x246,
+				0x247, 0x249, 0x24A, 0x24C, 0x24D, 0x250, 0x252, 0x253,
+				0x257, 0x258, 0x259, 0x25D, 0x25E, 0x25F, 0x260, 0x262,
+				0x263, 0x266, 0x268, 0x269, 0x26D, 0x26E, 0x26F, 0x273,
+				0x274, 0x275, 0x276, 0x277, 0x278, 0x279, 0x27A, 0x27B,
+				0x27C, 0x27D, 0x280, 0x281, 0x282, 0x283, 0x284, 0x285,
+				0x286, 0x287, 0x288, 0x28A, 0x28D, 0x28E, 0x290, 0x291,
+				0x292, 0x293, 0x296, 0x297, 0x299, 0x29A, 0x29D, 0x29E,
+				0x29F, 0x2A0, 0x2A1, 0x2A2, 0x2A3, 0x2A4, 0x2A5, 0x2A6,
+				0x2A7, 0x2A8, 0x2A9, 0x2AA, 0x2AB, 0x2AC, 0x2AD, 0x2AE,
+				0x2AF, 0x2B0, 0x2B2, 0x2B4, 0x2B5, 0x2B6, 0x2B7, 0x2B8,
+				0x2BC, 0x2C0, 0x2C1, 0x2C2, 0x2C3, 0x2C4, 0x2C5, 0x2C6,
+				0x2CA, 0x2CE, 0x2CF, 0x2D0, 0x2D1, 0x2D2, 0x2D3, 0x2D4,
+				0x2D6, 0x2D8, 0x2DA, 0x2DC, 0x2E0, 0x2E4, 0x2E5, 0x2E6,
+				0x2E7, 0x2E8, 0x2E9, 0x2EA, 0x2EE, 0x2F2, 0x2F3, 0x2F4,
+				0x2F5, 0x2F6, 0x2F7, 0x2F8, 0x2FB, 0x2FE, 0x301, 0x304,
+				0x306, 0x308, 0x30A, 0x30C, 0x30F, 0x312, 0x315, 0x319,
+				0x31D, 0x31E, 0x31F, 0x320, 0x321, 0x322, 0x323, 0x327,
+				0x32B, 0x32C, 0x32D, 0x32E, 0x32F, 0x330, 0x331, 0x332,
+				0x333, 0x334, 0x335, 0x338, 0x339, 0x33A, 0x33D, 0x33E,
+				0x33F, 0x340, 0x341, 0x342, 0x343, 0x344, 0x345, 0x346,
+				0x347, 0x348, 0x349, 0x34A, 0x34B, 0x34C, 0x34D, 0x34E,
+				0x34F, 0x350, 0x351, 0x352, 0x353, 0x354, 0x355, 0x356,
+				0x357, 0x358, 0x359, 0x35A, 0x35B, 0x35C, 0x35D, 0x35E,
+				0x35F, 0x360, 0x361, 0x362, 0x363, 0x364, 0x365, 0x366,
+				0x367, 0x368, 0x369, 0x36A, 0x36B, 0x36C, 0x36D, 0x36E,
+				0x36F, 0x370, 0x371, 0x372, 0x373, 0x374, 0x375, 0x376,
+				0x378, 0x37A, 0x37C, 0x37E, 0x380, 0x381, 0x382, 0x383,
+				0x384, 0x385, 0x386, 0x387, 0x388, 0x389, 0x38A, 0x38B,
+				0x38C, 0x38D, 0x38E, 0x38F, 0x390, 0x391, 0x393, 0x395,
+				0x397, 0x399, 0x39B, 0x39C, 0x39D, 0x39E, 0x39F, 0x3A0,
+				0x3A1, 0x3A2, 0x3A3, 0x3A4, 0x3A5, 0x3A7, 0x3AA, 0x3AB,
+				0x3AC, 0x3AD,
+			};
+
+			template< typename Dummy >
+			const u32 NormalizationTables< Dummy >::CompositionPairs[ 1882 ] =
+			{
+				0x338, 0x226E, 0x338, 0x2260, 0x338, 0x226F, 0x300, 0xC0,
+				0x301, 0xC1, 0x302, 0xC2, 0x303, 0xC3, 0x304, 0x100,
+				0x306, 0x102, 0x307, 0x226, 0x308, 0xC4, 0x309, 0x1EA2,
+				0x30A, 0xC5, 0x30C, 0x1CD, 0x30F, 0x200, 0x311, 0x202,
+				0x323, 0x1EA0, 0x325, 0x1E00, 0x328, 0x104, 0x307, 0x1E02,
+				0x323, 0x1E04, 0x331, 0x1E06, 0x301, 0x106, 0x302, 0x108,
+				0x307, 0x10A, 0x30C, 0x10C, 0x327, 0xC7, 0x307, 0x1E0A,
+				0x30C, 0x10E, 0x323, 0x1E0C, 0x327, 0x1E10, 0x32D, 0x1E12,
+				0x331, 0x1E0E, 0x300, 0xC8, 0x301, 0xC9, 0x302, 0xCA,
+				0x303, 0x1EBC, 0x304, 0x112, 0x306, 0x114, 0x307, 0x116,
+				0x308, 0xCB, 0x309, 0x1EBA, 0x30C, 0x11A, 0x30F, 0x204,
+				0x311, 0x206, 0x323, 0x1EB8, 0x327, 0x228, 0x328, 0x118,
+				0x32D, 0x1E18, 0x330, 0x1E1A, 0x307, 0x1E1E, 0x301, 0x1F4,
+				0x302, 0x11C, 0x304, 0x1E20, 0x306, 0x11E, 0x307, 0x120,
+				0x30C, 0x1E6, 0x327, 0x122, 0x302, 0x124, 0x307, 0x1E22,
+				0x308, 0x1E26, 0x30C, 0x21E, 0x323, 0x1E24, 0x327, 0x1E28,
+				0x32E, 0x1E2A, 0x300, 0xCC, 0x301, 0xCD, 0x302, 0xCE,
+				0x303, 0x128, 0x304, 0x12A, 0x306, 0x12C, 0x307, 0x130,
+				0x308, 0xCF, 0x309, 0x1EC8, 0x30C, 0x1CF, 0x30F, 0x208,
+				0x311, 0x20A, 0x323, 0x1ECA, 0x328, 0x12E, 0x330, 0x1E2C,
+				0x302, 0x134, 0x301, 0x1E30, 0x30C, 0x1E8, 0x323, 0x1E32,
+				0x327, 0x136, 0x331, 0x1E34, 0x301, 0x139, 0x30C, 0x13D,
+				0x323, 0x1E36, 0x327, 0x13B, 0x32D, 0x1E3C, 0x331, 0x1E3A,
+				0x301, 0x1E3E, 0x307, 0x1E40, 0x323, 0x1E42, 0x300, 0x1F8,
+				0x301, 0x143, 0x303, 0xD1, 0x307, 0x1E44, 0x30C, 0x147,
+				0x323, 0x1E46, 0x327, 0x145, 0x32D, 0x1E4A, 0x331, 0x1E48,
+				0x300, 0xD2, 0x301, 0xD3, 0x302, 0xD4, 0x303, 0xD5,
+				0x304, 0x14C, 0x306, 0x14E, 0x307, 0x22E, 0x308, 0xD6,
+				0x309, 0x1ECE, 0x30B, 0x150, 0x30C, 0x1D1, 0x30F, 0x20C,
+				0x311, 0x20E, 0x31B, 0x1A0, 0x323, 0x1ECC, 0x328, 0x1EA,
+				0x301, 0x1E54, 0x307, 0x1E56, 0x301, 0x154, 0x307, 0x1E58,
+				0x30C, 0x158, 0x30F, 0x210, 0x311, 0x212, 0x323, 0x1E5A,
+				0x327, 0x156, 0x331, 0x1E5E, 0x301, 0x15A, 0x302, 0x15C,
+				0x307, 0x1E60, 0x30C, 0x160, 0x323, 0x1E62, 0x326, 0x218,
+				0x327, 0x15E, 0x307, 0x1E6A, 0x30C, 0x164, 0x323, 0x1E6C,
+				0x326, 0x21A, 0x327, 0x162, 0x32D, 0x1E70, 0x331, 0x1E6E,
+				0x300, 0xD9, 0x301, 0xDA, 0x302, 0xDB, 0x303, 0x168,
+				0x304, 0x16A, 0x306, 0x16C, 0x308, 0xDC, 0x309, 0x1EE6,
+				0x30A, 0x16E, 0x30B, 0x170, 0x30C, 0x1D3, 0x30F, 0x214,
+				0x311, 0x216, 0x31B, 0x1AF, 0x323, 0x1EE4, 0x324, 0x1E72,
+				0x328, 0x172, 0x32D, 0x1E76, 0x330, 0x1E74, 0x303, 0x1E7C,
+				0x323, 0x1E7E, 0x300, 0x1E80, 0x301, 0x1E82, 0x302, 0x174,
+				0x307, 0x1E86, 0x308, 0x1E84, 0x323, 0x1E88, 0x307, 0x1E8A,
+				0x308, 0x1E8C, 0x300, 0x1EF2, 0x301, 0xDD, 0x302, 0x176,
+				0x303, 0x1EF8, 0x304, 0x232, 0x307, 0x1E8E, 0x308, 0x178,
+				0x309, 0x1EF6, 0x323, 0x1EF4, 0x301, 0x179, 0x302, 0x1E90,
+				0x307, 0x17B, 0x30C, 0x17D, 0x323, 0x1E92, 0x331, 0x1E94,
+				0x300, 0xE0, 0x301, 0xE1, 0x302, 0xE2, 0x303, 0xE3,
+				0x304, 0x101, 0x306, 0x103, 0x307, 0x227, 0x308, 0xE4,
+				0x309, 0x1EA3, 0x30A, 0xE5, 0x30C, 0x1CE, 0x30F, 0x201,
+				0x311, 0x203, 0x323, 0x1EA1, 0x325, 0x1E01, 0x328, 0x105,
+				0x307, 0x1E03, 0x323, 0x1E05, 0x331, 0x1E07, 0x301, 0x107,
+				0x302, 0x109, 0x307, 0x10B, 0x30C, 0x10D, 0x327, 0xE7,
+				0x307, 0x1E0B, 0x30C, 0x10F, 0x323, 0x1E0D, 0x327, 0x1E11,
+				0x32D, 0x1E13, 0x331, 0x1E0F, 0x300, 0xE8, 0x301, 0xE9,
+				0x302, 0xEA, 0x303, 0x1EBD, 0x304, 0x113, 0x306, 0x115,
+				0x307, 0x117, 0x308, 0xEB, 0x309, 0x1EBB, 0x30C, 0x11B,
+				0x30F, 0x205, 0x311, 0x207, 0x323, 0x1EB9, 0x327, 0x229,
+				0x328, 0x119, 0x32D, 0x1E19, 0x330, 0x1E1B, 0x307, 0x1E1F,
+				0x301, 0x1F5, 0x302, 0x11D, 0x304, 0x1E21, 0x306, 0x11F,
+				0x307, 0x121, 0x30C, 0x1E7, 0x327, 0x123, 0x302, 0x125,
+				0x307, 0x1E23, 0x308, 0x1E27, 0x30C, 0x21F, 0x323, 0x1E25,
+				0x327, 0x1E29, 0x32E, 0x1E2B, 0x331, 0x1E96, 0x300, 0xEC,
+				0x301, 0xED, 0x302, 0xEE, 0x303, 0x129, 0x304, 0x12B,
+				0x306, 0x12D, 0x308, 0xEF, 0x309, 0x1EC9, 0x30C, 0x1D0,
+				0x30F, 0x209, 0x311, 0x20B, 0x323, 0x1ECB, 0x328, 0x12F,
+				0x330, 0x1E2D, 0x302, 0x135, 0x30C, 0x1F0, 0x301, 0x1E31,
+				0x30C, 0x1E9, 0x323, 0x1E33, 0x327, 0x137, 0x331, 0x1E35,
+				0x301, 0x13A, 0x30C, 0x13E, 0x323, 0x1E37, 0x327, 0x13C,
+				0x32D, 0x1E3D, 0x331, 0x1E3B, 0x301, 0x1E3F, 0x307, 0x1E41,
+				0x323, 0x1E43, 0x300, 0x1F9, 0x301, 0x144, 0x303, 0xF1,
+				0x307, 0x1E45, 0x30C, 0x148, 0x323, 0x1E47, 0x327, 0x146,
+				0x32D, 0x1E4B, 0x331, 0x1E49, 0x300, 0xF2, 0x301, 0xF3,
+				0x302, 0xF4, 0x303, 0xF5, 0x304, 0x14D, 0x306, 0x14F,
+				0x307, 0x22F, 0x308, 0xF6, 0x309, 0x1ECF, 0x30B, 0x151,
+				0x30C, 0x1D2, 0x30F, 0x20D, 0x311, 0x20F, 0x31B, 0x1A1,
+				0x323, 0x1ECD, 0x328, 0x1EB, 0x301, 0x1E55, 0x307, 0x1E57,
+				0x301, 0x155, 0x307, 0x1E59, 0x30C, 0x159, 0x30F, 0x211,
+				0x311, 0x213, 0x323, 0x1E5B, 0x327, 0x157, 0x331, 0x1E5F,
+				0x301, 0x15B, 0x302, 0x15D, 0x307, 0x1E61, 0x30C, 0x161,
+				0x323, 0x1E63, 0x326, 0x219, 0x327, 0x15F, 0x307, 0x1E6B,
+				0x308, 0x1E97, 0x30C, 0x165, 0x323, 0x1E6D, 0x326, 0x21B,
+				0x327, 0x163, 0x32D, 0x1E71, 0x331, 0x1E6F, 0x300, 0xF9,
+				0x301, 0xFA, 0x302, 0xFB, 0x303, 0x169, 0x304, 0x16B,
+				0x306, 0x16D, 0x308, 0xFC, 0x309, 0x1EE7, 0x30A, 0x16F,
+				0x30B, 0x171, 0x30C, 0x1D4, 0x30F, 0x215, 0x311, 0x217,
+				0x31B, 0x1B0, 0x323, 0x1EE5, 0x324, 0x1E73, 0x328, 0x173,
+				0x32D, 0x1E77, 0x330, 0x1E75, 0x303, 0x1E7D, 0x323, 0x1E7F,
+				0x300, 0x1E81, 0x301, 0x1E83, 0x302, 0x175, 0x307, 0x1E87,
+				0x308, 0x1E85, 0x30A, 0x1E98, 0x323, 0x1E89, 0x307, 0x1E8B,
+				0x308, 0x1E8D, 0x300, 0x1EF3, 0x301, 0xFD, 0x302, 0x177,
+				0x303, 0x1EF9, 0x304, 0x233, 0x307, 0x1E8F, 0x308, 0xFF,
+				0x309, 0x1EF7, 0x30A, 0x1E99, 0x323, 0x1EF5, 0x301, 0x17A,
+				0x302, 0x1E91, 0x307, 0x17C, 0x30C, 0x17E, 0x323, 0x1E93,
+				0x331, 0x1E95, 0x300, 0x1FED, 0x301, 0x385, 0x342, 0x1FC1,
+				0x300, 0x1EA6, 0x301, 0x1EA4, 0x303, 0x1EAA, 0x309, 0x1EA8,
+				0x304, 0x1DE, 0x301, 0x1FA, 0x301, 0x1FC, 0x304, 0x1E2,
+				0x301, 0x1E08, 0x300, 0x1EC0, 0x301, 0x1EBE, 0x303, 0x1EC4,
+				0x309, 0x1EC2, 0x301, 0x1E2E, 0x300, 0x1ED2, 0x301, 0x1ED0,
+				0x303, 0x1ED6, 0x309, 0x1ED4, 0x301, 0x1E4C, 0x304, 0x22C,
+				0x308, 0x1E4E, 0x304, 0x22A, 0x301, 0x1FE, 0x300, 0x1DB,
+				0x301, 0x1D7, 0x304, 0x1D5, 0x30C, 0x1D9, 0x300, 0x1EA7,
+				0x301, 0x1EA5, 0x303, 0x1EAB, 0x309, 0x1EA9, 0x304, 0x1DF,
+				0x301, 0x1FB, 0x301, 0x1FD, 0x304, 0x1E3, 0x301, 0x1E09,
+				0x300, 0x1EC1, 0x301, 0x1EBF, 0x303, 0x1EC5, 0x309, 0x1EC3,
+				0x301, 0x1E2F, 0x300, 0x1ED3, 0x301, 0x1ED1, 0x303, 0x1ED7,
+				0x309, 0x1ED5, 0x301, 0x1E4D, 0x304, 0x22D, 0x308, 0x1E4F,
+				0x304, 0x22B, 0x301, 0x1FF, 0x300, 0x1DC, 0x301, 0x1D8,
+				0x304, 0x1D6, 0x30C, 0x1DA, 0x300, 0x1EB0, 0x301, 0x1EAE,
+				0x303, 0x1EB4, 0x309, 0x1EB2, 0x300, 0x1EB1, 0x301, 0x1EAF,
+				0x303, 0x1EB5, 0x309, 0x1EB3, 0x300, 0x1E14, 0x301, 0x1E16,
+				0x300, 0x1E15, 0x301, 0x1E17, 0x300, 0x1E50, 0x301, 0x1E52,
+				0x300, 0x1E51, 0x301, 0x1E53, 0x307, 0x1E64, 0x307, 0x1E65,
+				0x307, 0x1E66, 0x307, 0x1E67, 0x301, 0x1E78, 0x301, 0x1E79,
+				0x308, 0x1E7A, 0x308, 0x1E7B, 0x307, 0x1E9B, 0x300, 0x1EDC,
+				0x301, 0x1EDA, 0x303, 0x1EE0, 0x309, 0x1EDE, 0x323, 0x1EE2,
+				0x300, 0x1EDD, 0x301, 0x1EDB, 0x303, 0x1EE1, 0x309, 0x1EDF,
+				0x323, 0x1EE3, 0x300, 0x1EEA, 0x301, 0x1EE8, 0x303, 0x1EEE,
+				0x309, 0x1EEC, 0x323, 0x1EF0, 0x300, 0x1EEB, 0x301, 0x1EE9,
+				0x303, 0x1EEF, 0x309, 0x1EED, 0x323, 0x1EF1, 0x30C, 0x1EE,
+				0x304, 0x1EC, 0x304, 0x1ED, 0x304, 0x1E0, 0x304, 0x1E1,
+				0x306, 0x1E1C, 0x306, 0x1E1D, 0x304, 0x230, 0x304, 0x231,
+				0x30C, 0x1EF, 0x300, 0x1FBA, 0x301, 0x386, 0x304, 0x1FB9,
+				0x306, 0x1FB8, 0x313, 0x1F08, 0x314, 0x1F09, 0x345, 0x1FBC,
+				0x300, 0x1FC8, 0x301, 0x388, 0x313, 0x1F18, 0x314, 0x1F19,
+				0x300, 0x1FCA, 0x301, 0x389, 0x313, 0x1F28, 0x314, 0x1F29,
+				0x345, 0x1FCC, 0x300, 0x1FDA, 0x301, 0x38A, 0x304, 0x1FD9,
+				0x306, 0x1FD8, 0x308, 0x3AA, 0x313, 0x1F38, 0x314, 0x1F39,
+				0x300, 0x1FF8, 0x301, 0x38C, 0x313, 0x1F48, 0x314, 0x1F49,
+				0x314, 0x1FEC, 0x300, 0x1FEA, 0x301, 0x38E, 0x304, 0x1FE9,
+				0x306, 0x1FE8, 0x308, 0x3AB, 0x314, 0x1F59, 0x300, 0x1FFA,
+				0x301, 0x38F, 0x313, 0x1F68, 0x314, 0x1F69, 0x345, 0x1FFC,
+				0x345, 0x1FB4, 0x345, 0x1FC4, 0x300, 0x1F70, 0x301, 0x3AC,
+				0x304, 0x1FB1, 0x306, 0x1FB0, 0x313, 0x1F00, 0x314, 0x1F01,
+				0x342, 0x1FB6, 0x345, 0x1FB3, 0x300, 0x1F72, 0x301, 0x3AD,
+				0x313, 0x1F10, 0x314, 0x1F11, 0x300, 0x1F74, 0x301, 0x3AE,
+				0x313, 0x1F20, 0x314, 0x1F21, 0x342, 0x1FC6, 0x345, 0x1FC3,
+				0x300, 0x1F76, 0x301, 0x3AF, 0x304, 0x1FD1, 0x306, 0x1FD0,
+				0x308, 0x3CA, 0x313, 0x1F30, 0x314, 0x1F31, 0x342, 0x1FD6,
+				0x300, 0x1F78, 0x301, 0x3CC, 0x313, 0x1F40, 0x314, 0x1F41,
+				0x313, 0x1FE4, 0x314, 0x1FE5, 0x300, 0x1F7A, 0x301, 0x3CD,
+				0x304, 0x1FE1, 0x306, 0x1FE0, 0x308, 0x3CB, 0x313, 0x1F50,
+				0x314, 0x1F51, 0x342, 0x1FE6, 0x300, 0x1F7C, 0x301, 0x3CE,
+				0x313, 0x1F60, 0x314, 0x1F61, 0x342, 0x1FF6, 0x345, 0x1FF3,
+				0x300, 0x1FD2, 0x301, 0x390, 0x342, 0x1FD7, 0x300, 0x1FE2,
+				0x301, 0x3B0, 0x342, 0x1FE7, 0x345, 0x1FF4, 0x301, 0x3D3,
+				0x308, 0x3D4, 0x308, 0x407, 0x306, 0x4D0, 0x308, 0x4D2,
+				0x301, 0x403, 0x300, 0x400, 0x306, 0x4D6, 0x308, 0x401,
+				0x306, 0x4C1, 0x308, 0x4DC, 0x308, 0x4DE, 0x300, 0x40D,
+				0x304, 0x4E2, 0x306, 0x419, 0x308, 0x4E4, 0x301, 0x40C,
+				0x308, 0x4E6, 0x304, 0x4EE, 0x306, 0x40E, 0x308, 0x4F0,
+				0x30B, 0x4F2, 0x308, 0x4F4, 0x308, 0x4F8, 0x308, 0x4EC,
+				0x306, 0x4D1, 0x308, 0x4D3, 0x301, 0x453, 0x300, 0x450,
+				0x306, 0x4D7, 0x308, 0x451, 0x306, 0x4C2, 0x308, 0x4DD,
+				0x308, 0x4DF, 0x300, 0x45D, 0x304, 0x4E3, 0x306, 0x439,
+				0x308, 0x4E5, 0x301, 0x45C, 0x308, 0x4E7, 0x304, 0x4EF,
+				0x306, 0x45E, 0x308, 0x4F1, 0x30B, 0x4F3, 0x308, 0x4F5,
+				0x308, 0x4F9, 0x308, 0x4ED, 0x308, 0x457, 0x30F, 0x476,
+				0x30F, 0x477, 0x308, 0x4DA, 0x308, 0x4DB, 0x308, 0x4EA,
+				0x308, 0x4EB, 0x653, 0x622, 0x654, 0x623, 0x655, 0x625,
+				0x654, 0x624, 0x654, 0x626, 0x654, 0x6C2, 0x654, 0x6D3,
+				0x654, 0x6C0, 0x93C, 0x929, 0x93C, 0x931, 0x93C, 0x934,
+				0x9BE, 0x9CB, 0x9D7, 0x9CC, 0xB3E, 0xB4B, 0xB56, 0xB48,
+				0xB57, 0xB4C, 0xBD7, 0xB94, 0xBBE, 0xBCA, 0xBD7, 0xBCC,
+				0xBBE, 0xBCB, 0xC56, 0xC48, 0xCD5, 0xCC0, 0xCC2, 0xCCA,
+				0xCD5, 0xCC7, 0xCD6, 0xCC8, 0xCD5, 0xCCB, 0xD3E, 0xD4A,
+				0xD57, 0xD4C, 0xD3E, 0xD4B, 0xDCA, 0xDDA, 0xDCF, 0xDDC,
+				0xDDF, 0xDDE, 0xDCA, 0xDDD, 0x102E, 0x1026, 0x1B35, 0x1B06,
+				0x1B35, 0x1B08, 0x1B35, 0x1B0A, 0x1B35, 0x1B0C, 0x1B35, 0x1B0E,
+				0x1B35, 0x1B12, 0x1B35, 0x1B3B, 0x1B35, 0x1B3D, 0x1B35, 0x1B40,
+				0x1B35, 0x1B41, 0x1B35, 0x1B43, 0x304, 0x1E38, 0x304, 0x1E39,
+				0x304, 0x1E5C, 0x304, 0x1E5D, 0x307, 0x1E68, 0x307, 0x1E69,
+				0x302, 0x1EAC, 0x306, 0x1EB6, 0x302, 0x1EAD, 0x306, 0x1EB7,
+				0x302, 0x1EC6, 0x302, 0x1EC7, 0x302, 0x1ED8, 0x302, 0x1ED9,
+				0x300, 0x1F02, 0x301, 0x1F04, 0x342, 0x1F06, 0x345, 0x1F80,
+				0x300, 0x1F03, 0x301, 0x1F05, 0x342, 0x1F07, 0x345, 0x1F81,
+				0x345, 0x1F82, 0x345, 0x1F83, 0x345, 0x1F84, 0x345, 0x1F85,
+				0x345, 0x1F86, 0x345, 0x1F87, 0x300, 0x1F0A, 0x301, 0x1F0C,
+				0x342, 0x1F0E, 0x345, 0x1F88, 0x300, 0x1F0B, 0x301, 0x1F0D,
+				0x342, 0x1F0F, 0x345, 0x1F89, 0x345, 0x1F8A, 0x345, 0x1F8B,
+				0x345, 0x1F8C, 0x345, 0x1F8D, 0x345, 0x1F8E, 0x345, 0x1F8F,
+				0x300, 0x1F12, 0x301, 0x1F14, 0x300, 0x1F13, 0x301, 0x1F15,
+				0x300, 0x1F1A, 0x301, 0x1F1C, 0x300, 0x1F1B, 0x301, 0x1F1D,
+				0x300, 0x1F22, 0x301, 0x1F24, 0x342, 0x1F26, 0x345, 0x1F90,
+				0x300, 0x1F23, 0x301, 0x1F25, 0x342, 0x1F27, 0x345, 0x1F91,
+				0x345, 0x1F92, 0x345, 0x1F93, 0x345, 0x1F94, 0x345, 0x1F95,
+				0x345, 0x1F96, 0x345, 0x1F97, 0x300, 0x1F2A, 0x301, 0x1F2C,
+				0x342, 0x1F2E, 0x345, 0x1F98, 0x300, 0x1F2B, 0x301, 0x1F2D,
+				0x342, 0x1F2F, 0x345, 0x1F99, 0x345, 0x1F9A, 0x345, 0x1F9B,
+				0x345, 0x1F9C, 0x345, 0x1F9D, 0x345, 0x1F9E, 0x345, 0x1F9F,
+				0x300, 0x1F32, 0x301, 0x1F34, 0x342, 0x1F36, 0x300, 0x1F33,
+				0x301, 0x1F35, 0x342, 0x1F37, 0x300, 0x1F3A, 0x301, 0x1F3C,
+				0x342, 0x1F3E, 0x300, 0x1F3B, 0x301, 0x1F3D, 0x342, 0x1F3F,
+				0x300, 0x1F42, 0x301, 0x1F44, 0x300, 0x1F43, 0x301, 0x1F45,
+				0x300, 0x1F4A, 0x301, 0x1F4C, 0x300, 0x1F4B, 0x301, 0x1F4D,
+				0x300, 0x1F52, 0x301, 0x1F54, 0x342, 0x1F56, 0x300, 0x1F53,
+				0x301, 0x1F55, 0x342, 0x1F57, 0x300, 0x1F5B, 0x301, 0x1F5D,
+				0x342, 0x1F5F, 0x300, 0x1F62, 0x301, 0x1F64, 0x342, 0x1F66,
+				0x345, 0x1FA0, 0x300, 0x1F63, 0x301, 0x1F65, 0x342, 0x1F67,
+				0x345, 0x1FA1, 0x345, 0x1FA2, 0x345, 0x1FA3, 0x345, 0x1FA4,
+				0x345, 0x1FA5, 0x345, 0x1FA6, 0x345, 0x1FA7, 0x300, 0x1F6A,
+				0x301, 0x1F6C, 0x342, 0x1F6E, 0x345, 0x1FA8, 0x300, 0x1F6B,
+				0x301, 0x1F6D, 0x342, 0x1F6F, 0x345, 0x1FA9, 0x345, 0x1FAA,
+				0x345, 0x1FAB, 0x345, 0x1FAC, 0x345, 0x1FAD, 0x345, 0x1FAE,
+				0x345, 0x1FAF, 0x345, 0x1FB2, 0x345, 0x1FC2, 0x345, 0x1FF2,
+				0x345, 0x1FB7, 0x300, 0x1FCD, 0x301, 0x1FCE, 0x342, 0x1FCF,
+				0x345, 0x1FC7, 0x345, 0x1FF7, 0x300, 0x1FDD, 0x301, 0x1FDE,
+				0x342, 0x1FDF, 0x338, 0x219A, 0x338, 0x219B, 0x338, 0x21AE,
+				0x338, 0x21CD, 0x338, 0x21CF, 0x338, 0x21CE, 0x338, 0x2204,
+				0x338, 0x2209, 0x338, 0x220C, 0x338, 0x2224, 0x338, 0x2226,
+				0x338, 0x2241, 0x338, 0x2244, 0x338, 0x2247, 0x338, 0x2249,
+				0x338, 0x226D, 0x338, 0x2262, 0x338, 0x2270, 0x338, 0x2271,
+				0x338, 0x2274, 0x338, 0x2275, 0x338, 0x2278, 0x338, 0x2279,
+				0x338, 0x2280, 0x338, 0x2281, 0x338, 0x22E0, 0x338, 0x22E1,
+				0x338, 0x2284, 0x338, 0x2285, 0x338, 0x2288, 0x338, 0x2289,
+				0x338, 0x22E2, 0x338, 0x22E3, 0x338, 0x22AC, 0x338, 0x22AD,
+				0x338, 0x22AE, 0x338, 0x22AF, 0x338, 0x22EA, 0x338, 0x22EB,
+				0x338, 0x22EC, 0x338, 0x22ED, 0x3099, 0x3094, 0x3099, 0x304C,
+				0x3099, 0x304E, 0x3099, 0x3050, 0x3099, 0x3052, 0x3099, 0x3054,
+				0x3099, 0x3056, 0x3099, 0x3058, 0x3099, 0x305A, 0x3099, 0x305C,
+				0x3099, 0x305E, 0x3099, 0x3060, 0x3099, 0x3062, 0x3099, 0x3065,
+				0x3099, 0x3067, 0x3099, 0x3069, 0x3099, 0x3070, 0x309A, 0x3071,
+				0x3099, 0x3073, 0x309A, 0x3074, 0x3099, 0x3076, 0x309A, 0x3077,
+				0x3099, 0x3079, 0x309A, 0x307A, 0x3099, 0x307C, 0x309A, 0x307D,
+				0x3099, 0x309E, 0x3099, 0x30F4, 0x3099, 0x30AC, 0x3099, 0x30AE,
+				0x3099, 0x30B0, 0x3099, 0x30B2, 0x3099, 0x30B4, 0x3099, 0x30B6,
+				0x3099, 0x30B8, 0x3099, 0x30BA, 0x3099, 0x30BC, 0x3099, 0x30BE,
+				0x3099, 0x30C0, 0x3099, 0x30C2, 0x3099, 0x30C5, 0x3099, 0x30C7,
+				0x3099, 0x30C9, 0x3099, 0x30D0, 0x309A, 0x30D1, 0x3099, 0x30D3,
+				0x309A, 0x30D4, 0x3099, 0x30D6, 0x309A, 0x30D7, 0x3099, 0x30D9,
+				0x309A, 0x30DA, 0x3099, 0x30DC, 0x309A, 0x30DD, 0x3099, 0x30F7,
+				0x3099, 0x30F8, 0x3099, 0x30F9, 0x3099, 0x30FA, 0x3099, 0x30FE,
+				0x110BA, 0x1109A, 0x110BA, 0x1109C, 0x110BA, 0x110AB, 0x11127, 0x1112E,
+				0x11127, 0x1112F, 0x1133E, 0x1134B, 0x11357, 0x1134C, 0x114B0, 0x114BC,
+				0x114BA, 0x114BB, 0x114BD, 0x114BE, 0x115AF, 0x115BA, 0x115AF, 0x115BB,
+				0x11930, 0x11938,
+			};
+
+			/**
+			\brief The first code point which may extend or be extended by its neighbor in a grapheme cluster,
+			and its utf-8 lead byte. Every code point below it except CR is a grapheme cluster of its own.
+			*/
+			static const u32 GraphemeSimpleLimit = 0x300U;
+			static const unsigned char GraphemeSimpleLeadByte = 0xCC;
+
+			/**
+			\brief Segmentation properties of every code point, the stages map a code point to an index into the property arrays.
+			*/
+			template< typename Dummy >
+			struct SegmentationTables
+			{
+				static const u32 SegmentationShift = 7U;
+				static const u32 SegmentationLimit = 0xE1000U;
+				static const unsigned char SegmentationStage1[ 7200 ];
+				static const unsigned char SegmentationStage2[ 31360 ];
+				static const unsigned char GraphemeProperties[ 54 ];
+				static const unsigned char GraphemeRules[ 196 ];
+				static const unsigned char WordProperties[ 54 ];
+				static const unsigned char WordRules[ 361 ];
+				static const unsigned char SentenceProperties[ 54 ];
+				static const unsigned char SentenceTransitions[ 150 ];
+			};
+
+			template< typename Dummy >
+			const unsigned char SegmentationTables< Dummy >::SegmentationStage1[ 7200 ] =
+			{
+				0x0, 0x1, 0x2, 0x3, 0x4, 0x5, 0x6, 0x7, 0x8, 0x9, 0xA, 0xB, 0xC, 0xD, 0xE, 0xF,
+				0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F,
+				0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x29, 0x29, 0x2A, 0x2B, 0x2C, 0x2D,
+				0x2E, 0x2F, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3D,
+				0x3E, 0x3F, 0x40, 0x41, 0x42, 0x42, 0x43, 0x44, 0x42, 0x45, 0x42, 0x46, 0x47, 0x48, 0x49, 0x4A,
+				0x42, 0x42, 0x4B, 0x4C, 0x42, 0x42, 0x4D, 0x42, 0x4E, 0x4F, 0x50, 0x51, 0x52, 0x42, 0x42, 0x42,
+				0x53, 0x54, 0x55, 0x56, 0x42, 0x57, 0x58, 0x42, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+				0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+				0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+				0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x5A, 0x59, 0x59, 0x59, 0x59,
+				0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+				0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+				0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+				0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+				0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+				0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+				0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+				0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+				0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+				0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+				0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x5B, 0x29, 0x29, 0x5C, 0x5D, 0x5E, 0x5F,
+				0x60, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x68,
+				0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x68, 0x69, 0x6A,
+				0x6B, 0x6C, 0x6D, 0x6E, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x68, 0x69, 0x6A, 0x6B, 0x6C,
+				0x6D, 0x6E, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E,
+				0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x68, 0x69,
+				0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x68, 0x69, 0x6A, 0x6F,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x59, 0x59, 0x70, 0x71, 0x72, 0x73, 0x29, 0x29, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79,
+				0x7A, 0x7B, 0x7C, 0x7D, 0x42, 0x7E, 0x7F, 0x80, 0x81, 0x82, 0x83, 0x84, 0x29, 0x29, 0x85, 0x86,
+				0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F, 0x90, 0x91, 0x42, 0x42, 0x92, 0x93, 0x94,
+				0x95, 0x96, 0x97, 0x98, 0x99, 0x9A, 0x9B, 0x42, 0x9C, 0x9D, 0x42, 0x9E, 0x9F, 0xA0, 0xA1, 0x42,
+				0xA2, 0xA3, 0xA4, 0xA5, 0xA6, 0xA7, 0x42, 0x42, 0xA8, 0xA9, 0xAA, 0xAB, 0x42, 0xAC, 0x42, 0xAD,
+				0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0xAE, 0xAF, 0x29, 0xB0, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0xB1,
+				0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0xB2, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x29, 0x29, 0x29, 0x29, 0xB3, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x29, 0x29, 0x29, 0x29, 0xB4, 0xB5, 0xB6, 0xB7, 0x42, 0x42, 0x42, 0x42, 0xB8, 0xB9, 0xBA, 0xBB,
+				0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+				0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+				0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0xBC,
+				0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0xBD, 0xBE, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0xBF,
+				0xC0, 0x59, 0xC1, 0x59, 0x59, 0xC2, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0xC3, 0xC4, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0xC5, 0x42,
+				0x42, 0x42, 0xC6, 0xC7, 0xC8, 0x42, 0x42, 0x42, 0xC9, 0xCA, 0xCB, 0xCC, 0xCD, 0xCE, 0xCF, 0xD0,
+				0x42, 0x42, 0x42, 0x42, 0xD1, 0xD2, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0xD3, 0x42,
+				0xD4, 0x42, 0xD5, 0x42, 0x42, 0xD6, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0xD7,
+				0x29, 0xD8, 0xD9, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0xDA, 0xDB, 0x42, 0x42,
+				0xDC, 0xDC, 0xDD, 0xDE, 0xDF, 0xDC, 0xDC, 0xE0, 0xDC, 0xDC, 0xE1, 0xDC, 0xE2, 0xDC, 0xE3, 0xE4,
+				0xE5, 0xE6, 0xE7, 0xDC, 0xDC, 0xDC, 0x42, 0xE8, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xE9,
+				0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+				0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+				0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+				0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+				0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+				0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+				0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+				0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+				0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+				0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+				0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+				0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+				0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+				0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+				0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+				0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+				0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+				0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+				0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+				0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+				0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0xEA, 0x59, 0x59,
+				0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+				0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0xEB, 0x59,
+				0xEC, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+				0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+				0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0xED, 0x59, 0x59,
+				0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+				0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+				0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+				0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0xEE, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x59, 0x59, 0x59, 0x59, 0xEF, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+				0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+				0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0xF0, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+				0xF1, 0xF2, 0xF3, 0xF4, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2,
+				0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2,
+			};
+
+			template< typename Dummy >
+			const unsigned char SegmentationTables< Dummy >::SegmentationStage2[ 31360 ] =
+			{
+				0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x2, 0x3, 0x4, 0x4, 0x5, 0x1, 0x1,
+				0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+				0x6, 0x7, 0x8, 0x0, 0x0, 0x0, 0x0, 0x9, 0xA, 0xA, 0x0, 0x0, 0xB, 0xC, 0xD, 0x0,
+				0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xF, 0x10, 0x0, 0x0, 0x0, 0x7,
+				0x0, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+				0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xA, 0x0, 0xA, 0x0, 0x12,
+				0x0, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0xA, 0x0, 0xA, 0x0, 0x1,
+				0x1, 0x1, 0x1, 0x1, 0x1, 0x14, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+				0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+				0x15, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x16, 0x13, 0xA, 0x0, 0x17, 0x16, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x13, 0x0, 0x18, 0x0, 0x0, 0x13, 0xA, 0x0, 0x0, 0x0, 0x0,
+				0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+				0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x0, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+				0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13,
+				0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13,
+				0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13,
+				0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11,
+				0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13,
+				0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13,
+				0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13,
+				0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x13,
+				0x13, 0x11, 0x11, 0x13, 0x11, 0x13, 0x11, 0x11, 0x13, 0x11, 0x11, 0x11, 0x13, 0x13, 0x11, 0x11,
+				0x11, 0x11, 0x13, 0x11, 0x11, 0x13, 0x11, 0x11, 0x11, 0x13, 0x13, 0x13, 0x11, 0x11, 0x13, 0x11,
+				0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x11, 0x13, 0x11, 0x13, 0x13, 0x11, 0x13, 0x11, 0x11,
+				0x13, 0x11, 0x11, 0x11, 0x13, 0x11, 0x13, 0x11, 0x11, 0x13, 0x13, 0x19, 0x11, 0x13, 0x13, 0x13,
+				0x19, 0x19, 0x19, 0x19, 0x11, 0x11, 0x13, 0x11, 0x11, 0x13, 0x11, 0x11, 0x13, 0x11, 0x13, 0x11,
+				0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x13, 0x11, 0x13,
+				0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13,
+				0x13, 0x11, 0x11, 0x13, 0x11, 0x13, 0x11, 0x11, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13,
+				0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13,
+				0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13,
+				0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13,
+				0x11, 0x13, 0x11, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x11, 0x11, 0x13, 0x11, 0x11, 0x13,
+				0x13, 0x11, 0x13, 0x11, 0x11, 0x11, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+				0x13, 0x13, 0x13, 0x13, 0x19, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x13, 0x13, 0x1A, 0x1A, 0x1A, 0x1A, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1A, 0x1A,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x19, 0x1A, 0x19, 0x1A,
+				0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A,
+				0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+				0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+				0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+				0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+				0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+				0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+				0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+				0x11, 0x13, 0x11, 0x13, 0x19, 0x0, 0x11, 0x13, 0x0, 0x0, 0x13, 0x13, 0x13, 0x13, 0x10, 0x11,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x11, 0x18, 0x11, 0x11, 0x11, 0x0, 0x11, 0x0, 0x11, 0x11,
+				0x13, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+				0x11, 0x11, 0x0, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x13, 0x13, 0x13,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x11,
+				0x13, 0x13, 0x11, 0x11, 0x11, 0x13, 0x13, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13,
+				0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13,
+				0x13, 0x13, 0x13, 0x13, 0x11, 0x13, 0x0, 0x11, 0x13, 0x11, 0x11, 0x13, 0x13, 0x11, 0x11, 0x11,
+				0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+				0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+				0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+				0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13,
+				0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13,
+				0x11, 0x13, 0x0, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13,
+				0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13,
+				0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13,
+				0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13,
+				0x11, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x13,
+				0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13,
+				0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13,
+				0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13,
+				0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13,
+				0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13,
+				0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13,
+				0x0, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+				0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+				0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0, 0x0, 0x19, 0x1A, 0x1A, 0x1A, 0xC, 0x1A, 0x18,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x1C, 0x1A, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+				0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+				0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x0, 0x1B,
+				0x0, 0x1B, 0x1B, 0x0, 0x1B, 0x1B, 0x0, 0x1B, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
+				0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x0, 0x0, 0x0, 0x0, 0x1D,
+				0x1D, 0x1D, 0x1D, 0x19, 0x18, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xB, 0xB, 0x0, 0x0,
+				0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x0, 0x17, 0x7, 0x7, 0x7,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+				0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+				0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0x0, 0xE, 0x1F, 0x0, 0x19, 0x19,
+				0x1B, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x7, 0x19, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1E, 0x0, 0x1B,
+				0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x19, 0x19, 0x1B, 0x1B, 0x0, 0x1B, 0x1B, 0x1B, 0x1B, 0x19, 0x19,
+				0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0x19, 0x19, 0x19, 0x0, 0x0, 0x19,
+				0x7, 0x7, 0x7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1E,
+				0x19, 0x1B, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+				0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x0, 0x0, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+				0x1B, 0x19, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+				0x1B, 0x1B, 0x1B, 0x1B, 0x19, 0x19, 0x0, 0x0, 0xB, 0x7, 0x19, 0x0, 0x0, 0x1B, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1B, 0x1B, 0x1B, 0x1B, 0x19, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+				0x1B, 0x1B, 0x1B, 0x1B, 0x19, 0x1B, 0x1B, 0x1B, 0x19, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0x0, 0x7, 0x0, 0x0, 0x0, 0x7, 0x7, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1B, 0x1B, 0x1B, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0,
+				0x1E, 0x1E, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+				0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+				0x1B, 0x1B, 0x1E, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+				0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+				0x1B, 0x1B, 0x1B, 0x20, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1B, 0x20, 0x1B, 0x19, 0x20, 0x20,
+				0x20, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x20, 0x20, 0x20, 0x20, 0x1B, 0x20, 0x20,
+				0x19, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x1B, 0x1B, 0x7, 0x7, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE,
+				0x0, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x1B, 0x20, 0x20, 0x0, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x0, 0x19,
+				0x19, 0x0, 0x0, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x0, 0x19, 0x0, 0x0, 0x0, 0x19, 0x19, 0x19, 0x19, 0x0, 0x0, 0x1B, 0x19, 0x1B, 0x20,
+				0x20, 0x1B, 0x1B, 0x1B, 0x1B, 0x0, 0x0, 0x20, 0x20, 0x0, 0x0, 0x20, 0x20, 0x1B, 0x19, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1B, 0x0, 0x0, 0x0, 0x0, 0x19, 0x19, 0x0, 0x19,
+				0x19, 0x19, 0x1B, 0x1B, 0x0, 0x0, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE,
+				0x19, 0x19, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x19, 0x0, 0x1B, 0x0,
+				0x0, 0x1B, 0x1B, 0x20, 0x0, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x0, 0x0, 0x0, 0x19,
+				0x19, 0x0, 0x0, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x0, 0x19, 0x19, 0x0, 0x19, 0x19, 0x0, 0x19, 0x19, 0x0, 0x0, 0x1B, 0x0, 0x20, 0x20,
+				0x20, 0x1B, 0x1B, 0x0, 0x0, 0x0, 0x0, 0x1B, 0x1B, 0x0, 0x0, 0x1B, 0x1B, 0x1B, 0x0, 0x0,
+				0x0, 0x1B, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x19, 0x19, 0x19, 0x19, 0x0, 0x19, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE,
+				0x1B, 0x1B, 0x19, 0x19, 0x19, 0x1B, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x1B, 0x1B, 0x20, 0x0, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x19,
+				0x19, 0x19, 0x0, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x0, 0x19, 0x19, 0x0, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x0, 0x1B, 0x19, 0x20, 0x20,
+				0x20, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x0, 0x1B, 0x1B, 0x20, 0x0, 0x20, 0x20, 0x1B, 0x0, 0x0,
+				0x19, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x1B, 0x1B, 0x0, 0x0, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x19, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+				0x0, 0x1B, 0x20, 0x20, 0x0, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x0, 0x19,
+				0x19, 0x0, 0x0, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x0, 0x19, 0x19, 0x0, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x0, 0x1B, 0x19, 0x1B, 0x1B,
+				0x20, 0x1B, 0x1B, 0x1B, 0x1B, 0x0, 0x0, 0x20, 0x20, 0x0, 0x0, 0x20, 0x20, 0x1B, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x1B, 0x1B, 0x1B, 0x0, 0x0, 0x0, 0x0, 0x19, 0x19, 0x0, 0x19,
+				0x19, 0x19, 0x1B, 0x1B, 0x0, 0x0, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE,
+				0x0, 0x19, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x1B, 0x19, 0x0, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x0, 0x0, 0x19, 0x19,
+				0x19, 0x0, 0x19, 0x19, 0x19, 0x19, 0x0, 0x0, 0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x19, 0x19,
+				0x0, 0x0, 0x0, 0x19, 0x19, 0x0, 0x0, 0x0, 0x19, 0x19, 0x19, 0x0, 0x0, 0x0, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x0, 0x0, 0x0, 0x1B, 0x20,
+				0x1B, 0x20, 0x20, 0x0, 0x0, 0x0, 0x20, 0x20, 0x20, 0x0, 0x20, 0x20, 0x20, 0x1B, 0x0, 0x0,
+				0x19, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1B, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x1B, 0x20, 0x20, 0x20, 0x1B, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x19, 0x19,
+				0x19, 0x0, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x0, 0x1B, 0x19, 0x1B, 0x1B,
+				0x1B, 0x20, 0x20, 0x20, 0x20, 0x0, 0x1B, 0x1B, 0x1B, 0x0, 0x1B, 0x1B, 0x1B, 0x1B, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x1B, 0x1B, 0x0, 0x19, 0x19, 0x19, 0x0, 0x0, 0x19, 0x0, 0x0,
+				0x19, 0x19, 0x1B, 0x1B, 0x0, 0x0, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x1B, 0x20, 0x20, 0x0, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x19, 0x19,
+				0x19, 0x0, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x0, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x0, 0x1B, 0x19, 0x20, 0x1B,
+				0x20, 0x20, 0x1B, 0x20, 0x20, 0x0, 0x1B, 0x20, 0x20, 0x0, 0x20, 0x20, 0x1B, 0x1B, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x1B, 0x1B, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x19, 0x19, 0x0,
+				0x19, 0x19, 0x1B, 0x1B, 0x0, 0x0, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE,
+				0x0, 0x19, 0x19, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x1B, 0x1B, 0x20, 0x20, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x19, 0x19,
+				0x19, 0x0, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1B, 0x1B, 0x19, 0x1B, 0x20,
+				0x20, 0x1B, 0x1B, 0x1B, 0x1B, 0x0, 0x20, 0x20, 0x20, 0x0, 0x20, 0x20, 0x20, 0x1B, 0x21, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x19, 0x19, 0x19, 0x1B, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x19,
+				0x19, 0x19, 0x1B, 0x1B, 0x0, 0x0, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x0, 0x1B, 0x20, 0x20, 0x0, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x0, 0x0, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x0, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x0, 0x0, 0x1B, 0x0, 0x0, 0x0, 0x0, 0x1B,
+				0x20, 0x20, 0x1B, 0x1B, 0x1B, 0x0, 0x1B, 0x0, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x1B,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE,
+				0x0, 0x0, 0x20, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x1B, 0x22, 0x23, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x0,
+				0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x22, 0x22, 0x0, 0x22, 0x0, 0x22, 0x22, 0x22, 0x22, 0x22, 0x0, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x0, 0x22, 0x0, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x1B, 0x22, 0x23, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x22, 0x0, 0x0,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x0, 0x22, 0x0, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x0, 0x0,
+				0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0x0, 0x0, 0x22, 0x22, 0x22, 0x22,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1B, 0x1B, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x1B, 0x0, 0x1B, 0x0, 0x1B, 0xA, 0xA, 0xA, 0xA, 0x20, 0x20,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x0, 0x0,
+				0x0, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x20,
+				0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x0, 0x1B, 0x1B, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1B, 0x1B, 0x1B,
+				0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x0, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+				0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+				0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1B, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x24, 0x24, 0x1B, 0x1B, 0x1B,
+				0x1B, 0x20, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x24, 0x1B, 0x1B, 0x20, 0x20, 0x1B, 0x1B, 0x22,
+				0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0x7, 0x7, 0x0, 0x0, 0x0, 0x0,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x20, 0x1B, 0x1B, 0x22, 0x22, 0x22, 0x22, 0x1B, 0x1B,
+				0x1B, 0x22, 0x24, 0x24, 0x24, 0x22, 0x22, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x22, 0x22,
+				0x22, 0x1B, 0x1B, 0x1B, 0x1B, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x1B, 0x24, 0x20, 0x1B, 0x1B, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x1B, 0x22, 0x24,
+				0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0x24, 0x24, 0x24, 0x1B, 0x0, 0x0,
+				0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+				0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+				0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0, 0x11, 0x0, 0x0, 0x0, 0x0, 0x0, 0x11, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x19, 0x19, 0x19, 0x19,
+				0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+				0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+				0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+				0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+				0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+				0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+				0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+				0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+				0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+				0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+				0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+				0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+				0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+				0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+				0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+				0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x19, 0x19, 0x19, 0x19, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x19, 0x0, 0x19, 0x19, 0x19, 0x19, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x19, 0x19, 0x19, 0x19, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x0, 0x19, 0x19, 0x19, 0x19, 0x0, 0x0, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0,
+				0x19, 0x0, 0x19, 0x19, 0x19, 0x19, 0x0, 0x0, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x0, 0x19, 0x19, 0x19, 0x19, 0x0, 0x0, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x0, 0x1B, 0x1B, 0x1B,
+				0x0, 0x0, 0x7, 0x0, 0x0, 0x0, 0x0, 0x7, 0x7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+				0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+				0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+				0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+				0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+				0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0, 0x0, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x0, 0x0,
+				0x0, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x7, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x6, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0xA, 0xA, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x0, 0x0, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x1B, 0x1B, 0x1B, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x1B, 0x1B, 0x20, 0x7, 0x7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x1B, 0x1B, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x19, 0x19,
+				0x19, 0x0, 0x1B, 0x1B, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x1B, 0x1B, 0x20, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x20, 0x20,
+				0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x1B, 0x20, 0x20, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+				0x1B, 0x1B, 0x1B, 0x1B, 0x0, 0x0, 0x0, 0x22, 0x0, 0x0, 0x0, 0x0, 0x22, 0x1B, 0x0, 0x0,
+				0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0xC, 0x7, 0x0, 0x0, 0x0, 0x0, 0xC, 0x7, 0x0, 0x1B, 0x1B, 0x1B, 0x17, 0x1B,
+				0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x1B, 0x1B, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1B, 0x19, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0,
+				0x1B, 0x1B, 0x1B, 0x20, 0x20, 0x20, 0x20, 0x1B, 0x1B, 0x20, 0x20, 0x20, 0x0, 0x0, 0x0, 0x0,
+				0x20, 0x20, 0x1B, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x1B, 0x1B, 0x1B, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x7, 0x7, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x0, 0x0,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x0, 0x0, 0x0, 0x0,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1B, 0x1B, 0x20, 0x20, 0x1B, 0x0, 0x0, 0x0, 0x0,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x1B, 0x20, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x0,
+				0x1B, 0x24, 0x1B, 0x24, 0x24, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x20, 0x20, 0x20,
+				0x20, 0x20, 0x20, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x0, 0x0, 0x1B,
+				0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x22, 0x7, 0x7, 0x7, 0x7, 0x0, 0x0, 0x0, 0x0,
+				0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+				0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x1B, 0x1B, 0x1B, 0x1B, 0x20, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x20, 0x1B, 0x20, 0x20, 0x20,
+				0x20, 0x20, 0x1B, 0x20, 0x20, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x0, 0x0,
+				0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0x7, 0x7, 0x0, 0x0, 0x7, 0x7,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+				0x1B, 0x1B, 0x1B, 0x1B, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0x7, 0x0,
+				0x1B, 0x1B, 0x20, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x20, 0x1B, 0x1B, 0x1B, 0x1B, 0x20, 0x20, 0x1B, 0x1B, 0x20, 0x1B, 0x1B, 0x1B, 0x19, 0x19,
+				0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1B, 0x20, 0x1B, 0x1B, 0x20, 0x20, 0x20, 0x1B, 0x20, 0x1B,
+				0x1B, 0x1B, 0x20, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x1B, 0x1B, 0x1B, 0x1B,
+				0x1B, 0x1B, 0x1B, 0x1B, 0x20, 0x20, 0x1B, 0x1B, 0x0, 0x0, 0x0, 0x7, 0x7, 0x0, 0x0, 0x0,
+				0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0x0, 0x0, 0x0, 0x19, 0x19, 0x19,
+				0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x7, 0x7,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x0, 0x19, 0x19, 0x19,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x1B, 0x1B, 0x1B, 0x0, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+				0x1B, 0x20, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x19, 0x19, 0x19, 0x19, 0x1B, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x1B, 0x19, 0x19, 0x20, 0x1B, 0x1B, 0x19, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+				0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+				0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+				0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+				0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+				0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13,
+				0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13,
+				0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13,
+				0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13,
+				0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13,
+				0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13,
+				0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13,
+				0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13,
+				0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13,
+				0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x11, 0x13,
+				0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13,
+				0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13,
+				0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13,
+				0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13,
+				0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13,
+				0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x0, 0x0, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0, 0x0,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x0, 0x0, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0, 0x0,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x0, 0x11, 0x0, 0x11, 0x0, 0x11, 0x0, 0x11,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x0, 0x0,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x0, 0x13, 0x13, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0, 0x13, 0x0,
+				0x0, 0x0, 0x13, 0x13, 0x13, 0x0, 0x13, 0x13, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0, 0x0, 0x0,
+				0x13, 0x13, 0x13, 0x13, 0x0, 0x0, 0x13, 0x13, 0x11, 0x11, 0x11, 0x11, 0x0, 0x0, 0x0, 0x0,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x13, 0x13, 0x13, 0x0, 0x13, 0x13, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0, 0x0, 0x0,
+				0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x15, 0x6, 0x6, 0x6, 0x28, 0x1B, 0x29, 0x17, 0x17,
+				0x0, 0x0, 0x0, 0xC, 0xC, 0x0, 0x0, 0x0, 0x2A, 0x2A, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+				0x0, 0x0, 0x0, 0x0, 0xD, 0x0, 0x0, 0x18, 0x14, 0x14, 0x17, 0x17, 0x17, 0x17, 0x17, 0x2B,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xA, 0xA, 0x0, 0x2C, 0x7, 0x0, 0x12,
+				0x12, 0x0, 0x0, 0x0, 0x10, 0xA, 0xA, 0x7, 0x7, 0x2C, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x12, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
+				0x17, 0x17, 0x17, 0x17, 0x17, 0x1, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17,
+				0x0, 0x13, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xA, 0xA, 0x13,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xA, 0xA, 0x0,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+				0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+				0x1B, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x11, 0x0, 0x0, 0x0, 0x0, 0x11, 0x0, 0x0, 0x13, 0x11, 0x11, 0x11, 0x13, 0x13,
+				0x11, 0x11, 0x11, 0x13, 0x0, 0x11, 0x0, 0x0, 0x0, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0, 0x0,
+				0x0, 0x0, 0x16, 0x0, 0x11, 0x0, 0x11, 0x0, 0x11, 0x0, 0x11, 0x11, 0x11, 0x11, 0x0, 0x13,
+				0x11, 0x11, 0x11, 0x11, 0x13, 0x19, 0x19, 0x19, 0x19, 0x2D, 0x0, 0x0, 0x13, 0x13, 0x11, 0x11,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x11, 0x13, 0x13, 0x13, 0x13, 0x0, 0x0, 0x0, 0x0, 0x13, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+				0x19, 0x19, 0x19, 0x11, 0x13, 0x19, 0x19, 0x19, 0x19, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x16, 0x16, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xA, 0xA, 0xA, 0xA, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x16, 0x16, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x16, 0xA, 0xA, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x16, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x16,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+				0x16, 0x16, 0x16, 0x16, 0x0, 0x0, 0x0, 0x0, 0x16, 0x16, 0x16, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+				0x11, 0x11, 0x2E, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x16, 0x16, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x16, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x16, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x16, 0x16, 0x16, 0x16, 0x0,
+				0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x0, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+				0x16, 0x16, 0x16, 0x0, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+				0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+				0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+				0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+				0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+				0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+				0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+				0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+				0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+				0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+				0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+				0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+				0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+				0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+				0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x0, 0x0, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+				0x16, 0x16, 0x16, 0x0, 0x16, 0x0, 0x16, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x16, 0x0, 0x0,
+				0x0, 0x16, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x16, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x16, 0x16, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x16, 0x0, 0x0, 0x16, 0x0, 0x0, 0x0, 0x0, 0x16, 0x0, 0x16, 0x0,
+				0x0, 0x0, 0x0, 0x16, 0x16, 0x16, 0x0, 0x16, 0x0, 0x0, 0x0, 0xA, 0xA, 0xA, 0xA, 0xA,
+				0xA, 0x0, 0x0, 0x16, 0x16, 0x16, 0x16, 0x16, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+				0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x16, 0x16, 0x16, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x16, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x16, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x16,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0xA, 0xA, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x16, 0x16, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+				0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xA, 0xA, 0xA, 0xA, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xA, 0xA, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x16, 0x16, 0x16, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x16, 0x16, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x16, 0x0, 0x0, 0x0, 0x0, 0x16, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+				0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+				0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+				0x11, 0x13, 0x11, 0x11, 0x11, 0x13, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x11, 0x11,
+				0x11, 0x13, 0x11, 0x13, 0x13, 0x11, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x11, 0x11,
+				0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13,
+				0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13,
+				0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13,
+				0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13,
+				0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13,
+				0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13,
+				0x11, 0x13, 0x11, 0x13, 0x13, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x11, 0x13, 0x11, 0x13, 0x1B,
+				0x1B, 0x1B, 0x11, 0x13, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x0, 0x13, 0x0, 0x0, 0x0, 0x0, 0x0, 0x13, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x19,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1B,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0,
+				0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+				0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+				0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xA, 0xA, 0x0, 0x0,
+				0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0x0, 0x0, 0x0, 0x0, 0x7, 0x19,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0xA, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x7, 0x7, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x6, 0xC, 0x7, 0x0, 0x0, 0x19, 0x22, 0x22, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+				0xA, 0xA, 0x0, 0x0, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0x0, 0xA, 0xA, 0xA,
+				0x0, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+				0x16, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x0, 0x0, 0x22, 0x22, 0x22, 0x19, 0x19, 0x16, 0x0, 0x0,
+				0x0, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x0, 0x0, 0x1B, 0x1B, 0x30, 0x30, 0x22, 0x22, 0x22,
+				0x30, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F,
+				0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F,
+				0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F,
+				0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F,
+				0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F,
+				0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x0, 0x2F, 0x2F, 0x2F, 0x2F,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x0, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x16, 0x0, 0x16, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+				0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+				0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x0,
+				0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+				0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+				0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+				0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+				0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+				0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x7,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x7, 0x7,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0x19, 0x19, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13,
+				0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13,
+				0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x19, 0x1B,
+				0x1B, 0x1B, 0x1B, 0x0, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x0, 0x19,
+				0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13,
+				0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x13, 0x13, 0x1B, 0x1B,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x1B, 0x1B, 0x0, 0x7, 0x0, 0x0, 0x0, 0x7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A,
+				0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x1A, 0x1A, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13,
+				0x13, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13,
+				0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13,
+				0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13,
+				0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x11, 0x13,
+				0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x19, 0x1A, 0x1A, 0x11, 0x13, 0x11, 0x13, 0x19,
+				0x11, 0x13, 0x11, 0x13, 0x13, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13,
+				0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13,
+				0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13, 0x11, 0x13,
+				0x11, 0x13, 0x11, 0x13, 0x11, 0x11, 0x11, 0x11, 0x13, 0x11, 0x13, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x11, 0x13, 0x0, 0x13, 0x0, 0x13, 0x11, 0x13, 0x11, 0x13, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x19, 0x19, 0x19, 0x11, 0x13, 0x19, 0x13, 0x13, 0x13, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x1B, 0x19, 0x19, 0x19, 0x1B, 0x19, 0x19, 0x19, 0x19, 0x1B, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x20, 0x20, 0x1B, 0x1B, 0x20, 0x0, 0x0, 0x0, 0x0, 0x1B, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x0, 0x0, 0x7, 0x7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x20, 0x20, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+				0x20, 0x20, 0x20, 0x20, 0x1B, 0x1B, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0x7,
+				0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+				0x1B, 0x1B, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x1B,
+				0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x0, 0x7,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+				0x1B, 0x1B, 0x20, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+				0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x0, 0x0, 0x0,
+				0x1B, 0x1B, 0x1B, 0x20, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x1B, 0x20, 0x20, 0x1B, 0x1B, 0x1B, 0x1B, 0x20, 0x20, 0x1B, 0x1B, 0x20, 0x20,
+				0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0x7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x19,
+				0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x1B, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0x22, 0x22, 0x22, 0x22, 0x22, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x20,
+				0x20, 0x1B, 0x1B, 0x20, 0x20, 0x1B, 0x1B, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x1B, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1B, 0x20, 0x0, 0x0,
+				0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0x0, 0x0, 0x0, 0x7, 0x7, 0x7,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x0, 0x0, 0x0, 0x22, 0x24, 0x1B, 0x24, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x1B, 0x22, 0x1B, 0x1B, 0x1B, 0x22, 0x22, 0x1B, 0x1B, 0x22, 0x22, 0x22, 0x22, 0x22, 0x1B, 0x1B,
+				0x22, 0x1B, 0x22, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x22, 0x22, 0x22, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x20, 0x1B, 0x1B, 0x20, 0x20,
+				0x7, 0x7, 0x19, 0x19, 0x19, 0x20, 0x1B, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x0, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0,
+				0x0, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x1A, 0x13, 0x13, 0x13, 0x13,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x19, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x20, 0x20, 0x1B, 0x20, 0x20, 0x1B, 0x20, 0x20, 0x7, 0x20, 0x1B, 0x0, 0x0,
+				0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x31, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+				0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x31, 0x32, 0x32, 0x32,
+				0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+				0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x31, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+				0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+				0x32, 0x32, 0x32, 0x32, 0x31, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+				0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+				0x31, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+				0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x31, 0x32, 0x32, 0x32,
+				0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+				0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x31, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+				0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+				0x32, 0x32, 0x32, 0x32, 0x31, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+				0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+				0x31, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+				0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x31, 0x32, 0x32, 0x32,
+				0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+				0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x31, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+				0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+				0x32, 0x32, 0x32, 0x32, 0x31, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+				0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+				0x31, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+				0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x31, 0x32, 0x32, 0x32,
+				0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+				0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x31, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+				0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+				0x32, 0x32, 0x32, 0x32, 0x31, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+				0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+				0x31, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+				0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x31, 0x32, 0x32, 0x32,
+				0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+				0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x31, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+				0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+				0x32, 0x32, 0x32, 0x32, 0x31, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+				0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+				0x31, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+				0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x31, 0x32, 0x32, 0x32,
+				0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+				0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x31, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+				0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+				0x32, 0x32, 0x32, 0x32, 0x31, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+				0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+				0x31, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+				0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x31, 0x32, 0x32, 0x32,
+				0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+				0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x31, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+				0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+				0x32, 0x32, 0x32, 0x32, 0x31, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+				0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+				0x31, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+				0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x31, 0x32, 0x32, 0x32,
+				0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+				0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x31, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+				0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+				0x32, 0x32, 0x32, 0x32, 0x31, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+				0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+				0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x31, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+				0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+				0x32, 0x32, 0x32, 0x32, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+				0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x0, 0x0, 0x0, 0x0, 0x27, 0x27, 0x27, 0x27, 0x27,
+				0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+				0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+				0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x0, 0x0, 0x0, 0x0,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x0, 0x0,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x13, 0x13, 0x13, 0x13, 0x13, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1D, 0x1B, 0x1D,
+				0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x0, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
+				0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x0, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x0, 0x1D, 0x0,
+				0x1D, 0x1D, 0x0, 0x1D, 0x1D, 0x0, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0xA, 0xA,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x0, 0x0, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x0, 0x0, 0x0,
+				0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+				0xB, 0xC, 0x0, 0xF, 0x10, 0x0, 0x0, 0xA, 0xA, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+				0x0, 0xC, 0xC, 0x12, 0x12, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+				0xA, 0xA, 0xA, 0xA, 0xA, 0x0, 0x0, 0xA, 0xA, 0x0, 0x0, 0x0, 0x0, 0x12, 0x12, 0x12,
+				0xB, 0xC, 0xD, 0x0, 0x10, 0xF, 0x7, 0x7, 0xC, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0x0,
+				0x0, 0x0, 0x0, 0xC, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x0, 0x17,
+				0x0, 0x7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x33, 0xA, 0xA, 0x0, 0x0, 0xB, 0xC, 0xD, 0x0,
+				0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xF, 0x10, 0x0, 0x0, 0x0, 0x7,
+				0x0, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+				0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xA, 0x0, 0xA, 0x0, 0x12,
+				0x0, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0xA, 0x0, 0xA, 0x0, 0xA,
+				0xA, 0x7, 0xA, 0xA, 0xC, 0x0, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F,
+				0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F,
+				0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F,
+				0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x1B, 0x1B,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0,
+				0x0, 0x0, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x0, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x0, 0x0, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x0, 0x19, 0x19, 0x19, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x17, 0x17, 0x17, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x19, 0x19, 0x0, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1B, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x1B, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x0, 0x0, 0x0, 0x0, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x0, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+				0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+				0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x0,
+				0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+				0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+				0x11, 0x11, 0x11, 0x11, 0x0, 0x0, 0x0, 0x0, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0, 0x11, 0x11, 0x11, 0x11,
+				0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0, 0x11, 0x11, 0x11, 0x11,
+				0x11, 0x11, 0x11, 0x0, 0x11, 0x11, 0x0, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+				0x13, 0x13, 0x0, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+				0x13, 0x13, 0x0, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x0, 0x13, 0x13, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x13, 0x19, 0x19, 0x13, 0x13, 0x13, 0x0, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+				0x13, 0x0, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x19, 0x19, 0x0, 0x0, 0x0, 0x19, 0x0, 0x0, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x0, 0x19, 0x19, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x19, 0x19,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x1B, 0x1B, 0x1B, 0x0, 0x1B, 0x1B, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1B, 0x1B, 0x1B, 0x1B,
+				0x19, 0x19, 0x19, 0x19, 0x0, 0x19, 0x19, 0x19, 0x0, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x0, 0x1B, 0x1B, 0x1B, 0x0, 0x0, 0x0, 0x0, 0x1B,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0x7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x1B, 0x1B, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+				0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+				0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+				0x11, 0x11, 0x11, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+				0x13, 0x13, 0x13, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x1B, 0x1B, 0x1B, 0x1B, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x1B, 0x1B, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x19, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+				0x1B, 0x0, 0x0, 0x0, 0x0, 0x7, 0x7, 0x7, 0x7, 0x7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x1B, 0x1B, 0x1B, 0x1B, 0x7, 0x7, 0x7, 0x7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x20, 0x1B, 0x20, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+				0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x7, 0x7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE,
+				0x1B, 0x19, 0x19, 0x1B, 0x1B, 0x19, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1B,
+				0x1B, 0x1B, 0x20, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x20, 0x20, 0x20, 0x1B, 0x1B, 0x1B, 0x1B, 0x20, 0x20, 0x1B, 0x1B, 0x0, 0x0, 0x1E, 0x7, 0x7,
+				0x7, 0x7, 0x1B, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1E, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x1B, 0x1B, 0x1B, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x20, 0x1B, 0x1B, 0x1B,
+				0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x0, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE,
+				0x0, 0x7, 0x7, 0x7, 0x19, 0x20, 0x20, 0x19, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x1B, 0x0, 0x0, 0x19, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x1B, 0x1B, 0x20, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x20, 0x20, 0x20, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x20,
+				0x20, 0x19, 0x21, 0x21, 0x19, 0x7, 0x7, 0x0, 0x0, 0x1B, 0x1B, 0x1B, 0x1B, 0x7, 0x20, 0x1B,
+				0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0x19, 0x0, 0x19, 0x0, 0x7, 0x7,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x0, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x20, 0x20, 0x20, 0x1B,
+				0x1B, 0x1B, 0x20, 0x20, 0x1B, 0x20, 0x1B, 0x1B, 0x7, 0x7, 0x0, 0x7, 0x7, 0x0, 0x1B, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x19, 0x0, 0x19, 0x19, 0x19, 0x19, 0x0, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1B,
+				0x20, 0x20, 0x20, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x1B, 0x1B, 0x20, 0x20, 0x0, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x0, 0x19,
+				0x19, 0x0, 0x0, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x0, 0x19, 0x19, 0x0, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x1B, 0x1B, 0x19, 0x1B, 0x20,
+				0x1B, 0x20, 0x20, 0x20, 0x20, 0x0, 0x0, 0x20, 0x20, 0x0, 0x0, 0x20, 0x20, 0x20, 0x0, 0x0,
+				0x19, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1B, 0x0, 0x0, 0x0, 0x0, 0x0, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x20, 0x20, 0x0, 0x0, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x0, 0x0, 0x0,
+				0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x20, 0x20, 0x20, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+				0x20, 0x20, 0x1B, 0x1B, 0x1B, 0x20, 0x1B, 0x19, 0x19, 0x19, 0x19, 0x7, 0x7, 0x0, 0x0, 0x0,
+				0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0x0, 0x0, 0x0, 0x0, 0x1B, 0x19,
+				0x19, 0x19, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x1B, 0x20, 0x20, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x20, 0x1B, 0x20, 0x20, 0x1B, 0x20, 0x1B,
+				0x1B, 0x20, 0x1B, 0x1B, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1B,
+				0x20, 0x20, 0x1B, 0x1B, 0x1B, 0x1B, 0x0, 0x0, 0x20, 0x20, 0x20, 0x20, 0x1B, 0x1B, 0x20, 0x1B,
+				0x1B, 0x0, 0x7, 0x7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7,
+				0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x19, 0x19, 0x19, 0x19, 0x1B, 0x1B, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x20, 0x20, 0x20, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x20, 0x20, 0x1B, 0x20, 0x1B,
+				0x1B, 0x7, 0x7, 0x0, 0x19, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1B, 0x20, 0x1B, 0x20, 0x20,
+				0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x20, 0x1B, 0x19, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x0, 0x0, 0x1B, 0x1B, 0x1B,
+				0x24, 0x24, 0x1B, 0x1B, 0x1B, 0x1B, 0x20, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x0, 0x0, 0x0, 0x0,
+				0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0x0, 0x0, 0x7, 0x7, 0x7, 0x0,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x20, 0x20, 0x20, 0x1B,
+				0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x20, 0x1B, 0x1B, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+				0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+				0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x0, 0x19, 0x0, 0x0, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x0, 0x19, 0x19, 0x0, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x1B, 0x20, 0x20, 0x20, 0x20, 0x20, 0x0, 0x20, 0x20, 0x0, 0x0, 0x1B, 0x1B, 0x20, 0x1B, 0x21,
+				0x20, 0x21, 0x20, 0x1B, 0x7, 0x0, 0x7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x0, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x20, 0x20, 0x20, 0x1B, 0x1B, 0x1B, 0x1B, 0x0, 0x0, 0x1B, 0x1B, 0x20, 0x20, 0x20, 0x20,
+				0x1B, 0x19, 0x0, 0x19, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x20, 0x21, 0x1B, 0x1B, 0x1B, 0x1B, 0x0,
+				0x0, 0x0, 0x7, 0x7, 0x0, 0x0, 0x0, 0x1B, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x20, 0x20, 0x1B, 0x1B, 0x1B, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+				0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x20, 0x1B, 0x1B, 0x0, 0x7, 0x7, 0x19, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x20,
+				0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x0, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x20, 0x1B,
+				0x19, 0x7, 0x7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x0, 0x0, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+				0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x0, 0x20, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+				0x1B, 0x20, 0x1B, 0x1B, 0x20, 0x1B, 0x1B, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x19, 0x19, 0x0, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x0, 0x0, 0x0, 0x1B, 0x0, 0x1B, 0x1B, 0x0, 0x1B,
+				0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x21, 0x1B, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x19, 0x19, 0x0, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x20, 0x20, 0x20, 0x20, 0x20, 0x0,
+				0x1B, 0x1B, 0x0, 0x20, 0x20, 0x1B, 0x20, 0x1B, 0x19, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x1B, 0x1B, 0x20, 0x20, 0x7, 0x7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0,
+				0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0,
+				0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0x0, 0x0, 0x0, 0x0, 0x7, 0x7,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0,
+				0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x0,
+				0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x7, 0x7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x0, 0x0, 0x0, 0x0, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+				0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x0, 0x0, 0x0, 0x1B,
+				0x19, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+				0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+				0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+				0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1B,
+				0x1B, 0x1B, 0x1B, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x0, 0x19, 0x1B, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x20, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x2F, 0x2F, 0x2F, 0x2F, 0x0, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x0, 0x2F, 0x2F, 0x0,
+				0x2F, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x2F, 0x2F, 0x2F, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x22, 0x22, 0x22, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x2F, 0x2F, 0x2F, 0x2F, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x0, 0x0, 0x1B, 0x1B, 0x7,
+				0x17, 0x17, 0x17, 0x17, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+				0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+				0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x0, 0x0,
+				0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+				0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x1B, 0x20, 0x1B, 0x1B, 0x1B, 0x0, 0x0, 0x0, 0x20, 0x1B, 0x1B,
+				0x1B, 0x1B, 0x1B, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+				0x1B, 0x1B, 0x1B, 0x0, 0x0, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1B, 0x1B, 0x1B, 0x1B, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x1B, 0x1B, 0x1B, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+				0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+				0x13, 0x13, 0x13, 0x13, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+				0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x13,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x0, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+				0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+				0x11, 0x11, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x11, 0x0, 0x11, 0x11,
+				0x0, 0x0, 0x11, 0x0, 0x0, 0x11, 0x11, 0x0, 0x0, 0x11, 0x11, 0x11, 0x11, 0x0, 0x11, 0x11,
+				0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x13, 0x13, 0x13, 0x0, 0x13, 0x0, 0x13, 0x13, 0x13,
+				0x13, 0x13, 0x13, 0x13, 0x0, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+				0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+				0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+				0x13, 0x13, 0x13, 0x13, 0x11, 0x11, 0x0, 0x11, 0x11, 0x11, 0x11, 0x0, 0x0, 0x11, 0x11, 0x11,
+				0x11, 0x11, 0x11, 0x11, 0x11, 0x0, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0, 0x13, 0x13,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x11, 0x11, 0x0, 0x11, 0x11, 0x11, 0x11, 0x0,
+				0x11, 0x11, 0x11, 0x11, 0x11, 0x0, 0x11, 0x0, 0x0, 0x0, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+				0x11, 0x0, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x11, 0x11, 0x11, 0x11,
+				0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+				0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+				0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+				0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+				0x13, 0x13, 0x13, 0x13, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+				0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x13,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+				0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+				0x11, 0x11, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x11, 0x11, 0x11, 0x11,
+				0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+				0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+				0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+				0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x0, 0x0, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+				0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+				0x11, 0x0, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x0, 0x13, 0x13, 0x13, 0x13,
+				0x13, 0x13, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+				0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0, 0x13, 0x13, 0x13, 0x13,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x0, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x11, 0x11, 0x11, 0x11,
+				0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+				0x11, 0x11, 0x11, 0x11, 0x11, 0x0, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x0,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+				0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x0, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+				0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+				0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+				0x13, 0x13, 0x13, 0x0, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x11, 0x13, 0x0, 0x0, 0xE, 0xE,
+				0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE,
+				0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE,
+				0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE,
+				0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+				0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+				0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+				0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x0, 0x0, 0x0, 0x0, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+				0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+				0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+				0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x1B, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x1B, 0x0, 0x0, 0x0, 0x7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+				0x0, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x19, 0x13, 0x13, 0x13, 0x13, 0x13,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x0, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+				0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x0, 0x0, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+				0x1B, 0x1B, 0x0, 0x1B, 0x1B, 0x0, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x0, 0x0,
+				0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x0,
+				0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0x0, 0x0, 0x0, 0x0, 0x19, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1B, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1B, 0x1B, 0x1B, 0x1B,
+				0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x19, 0x19, 0x19, 0x19, 0x0, 0x19, 0x19, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+				0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+				0x11, 0x11, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+				0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+				0x13, 0x13, 0x13, 0x13, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x19, 0x0, 0x0, 0x0, 0x0,
+				0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x0, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x0, 0x19, 0x19, 0x19, 0x19, 0x0, 0x19, 0x0, 0x19, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x19, 0x0, 0x0, 0x0, 0x0, 0x19, 0x0, 0x19, 0x0, 0x19, 0x0, 0x19, 0x19, 0x19,
+				0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19, 0x0, 0x19, 0x0, 0x19, 0x0, 0x19, 0x0, 0x19,
+				0x0, 0x19, 0x19, 0x0, 0x19, 0x0, 0x0, 0x19, 0x19, 0x19, 0x19, 0x0, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x0, 0x19, 0x19, 0x19, 0x19, 0x0, 0x19, 0x19, 0x19, 0x19, 0x0, 0x19, 0x0,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x19, 0x19, 0x19, 0x0, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x19, 0x19, 0x19, 0x19, 0x19,
+				0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+				0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+				0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+				0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+				0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+				0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+				0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+				0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x16, 0x16, 0x16,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x16,
+				0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+				0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+				0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0, 0x0, 0x16, 0x16, 0x16, 0x16,
+				0x2E, 0x2E, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x2E, 0x2E,
+				0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0, 0x0, 0x0, 0x0, 0x16, 0x0,
+				0x0, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x16, 0x16, 0x16,
+				0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+				0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+				0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+				0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34,
+				0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34,
+				0x0, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x16, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x16,
+				0x0, 0x0, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x0, 0x16, 0x16, 0x16, 0x16,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+				0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+				0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+				0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+				0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+				0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+				0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+				0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+				0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+				0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+				0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+				0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x35, 0x35, 0x35, 0x35, 0x35,
+				0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+				0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+				0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+				0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+				0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+				0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+				0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+				0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+				0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+				0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+				0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+				0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xA, 0xA, 0xA, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+				0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+				0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x16, 0x16, 0x16, 0x16,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x16, 0x16,
+				0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+				0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+				0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+				0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+				0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x16, 0x16, 0x16, 0x16,
+				0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+				0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+				0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x0, 0x16, 0x16, 0x16, 0x16,
+				0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x0, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+				0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+				0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+				0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+				0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+				0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+				0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+				0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+				0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+				0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+				0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x0, 0x0,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x0, 0x0,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+				0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x1, 0x17, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+				0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+				0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+				0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+				0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+				0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+				0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+				0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+				0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+				0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+				0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+				0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+				0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+				0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+				0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+				0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+				0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+				0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+				0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+				0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+				0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+				0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+				0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+				0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+				0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+				0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+				0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+				0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+				0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+				0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+				0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+				0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+			};
+
+			template< typename Dummy >
+			const unsigned char SegmentationTables< Dummy >::GraphemeProperties[ 54 ] =
+			{
+				0x0, 0x3, 0x3, 0x2, 0x3, 0x1, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x80, 0x3,
+				0x0, 0x0, 0x0, 0x4, 0x0, 0x0, 0x7, 0x0,
+				0x8, 0x7, 0x0, 0x8, 0x0, 0x9, 0xA, 0xB,
+				0x3, 0x5, 0x0, 0x0, 0x80, 0x80, 0x80, 0x0,
+				0x0, 0xC, 0xD, 0x0, 0x6, 0x4,
+			};
+
+			template< typename Dummy >
+			const unsigned char SegmentationTables< Dummy >::GraphemeRules[ 196 ] =
+			{
+				0x0, 0x0, 0x0, 0x0, 0x1, 0x1, 0x0, 0x0,
+				0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x1, 0x1, 0x0, 0x0,
+				0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0,
+				0x0, 0x0, 0x1, 0x1, 0x0, 0x0, 0x1, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x1, 0x1, 0x3, 0x0, 0x1, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x1, 0x1,
+				0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+				0x0, 0x0, 0x0, 0x0, 0x1, 0x1, 0x0, 0x0,
+				0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x1, 0x1, 0x0, 0x0, 0x1, 0x1,
+				0x1, 0x0, 0x1, 0x1, 0x0, 0x0, 0x0, 0x0,
+				0x1, 0x1, 0x0, 0x0, 0x1, 0x0, 0x1, 0x1,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1,
+				0x0, 0x0, 0x1, 0x0, 0x0, 0x1, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x1, 0x1, 0x0, 0x0,
+				0x1, 0x0, 0x1, 0x1, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x1, 0x1, 0x0, 0x0, 0x1, 0x0,
+				0x0, 0x1, 0x0, 0x0,
+			};
+
+			template< typename Dummy >
+			const unsigned char SegmentationTables< Dummy >::WordProperties[ 54 ] =
+			{
+				0x0, 0x0, 0x0, 0x2, 0x3, 0x1, 0x12, 0x0,
+				0xC, 0xB, 0x0, 0xF, 0x0, 0xD, 0x10, 0xE,
+				0xF, 0xA, 0x11, 0xA, 0x3, 0x0, 0x0, 0x7,
+				0xE, 0xA, 0xA, 0x4, 0xF, 0x9, 0x7, 0xF,
+				0x4, 0xA, 0x0, 0x0, 0x4, 0xA, 0xA, 0xA,
+				0x0, 0x5, 0xD, 0x11, 0x0, 0xA, 0xA, 0x8,
+				0x8, 0xA, 0xA, 0xD, 0x6, 0x4,
+			};
+
+			template< typename Dummy >
+			const unsigned char SegmentationTables< Dummy >::WordRules[ 361 ] =
+			{
+				0x0, 0x0, 0x0, 0x0, 0x2, 0x2, 0x0, 0x2,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x2, 0x2, 0x0, 0x2, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x2, 0x2, 0x0, 0x2, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x2,
+				0x9, 0x2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x2, 0x2, 0x0, 0x2, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x2, 0x2, 0x0, 0x2,
+				0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+				0x2, 0x0, 0x2, 0x0, 0x1, 0x1, 0x1, 0x4,
+				0x3, 0x3, 0x0, 0x1, 0x1, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x2, 0x2, 0x0, 0x2, 0x0, 0x1,
+				0x1, 0x3, 0x0, 0x3, 0x3, 0x0, 0x1, 0x1,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x2, 0x0,
+				0x2, 0x0, 0x6, 0x6, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x2, 0x2, 0x0, 0x2, 0x0, 0x7, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x2, 0x2, 0x0, 0x2, 0x0,
+				0x6, 0x6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x2,
+				0x0, 0x2, 0x0, 0x6, 0x6, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0, 0x2, 0x2, 0x0, 0x2, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x2, 0x2, 0x0, 0x2,
+				0x0, 0x1, 0x1, 0x5, 0x0, 0x5, 0x0, 0x5,
+				0x1, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+				0x2, 0x0, 0x2, 0x1, 0x1, 0x1, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x1, 0x1, 0x0, 0x0, 0x0,
+				0x0, 0x0, 0x2, 0x2, 0x0, 0x2, 0x0, 0x0,
+				0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+				0x0,
+			};
+
+			template< typename Dummy >
+			const unsigned char SegmentationTables< Dummy >::SentenceProperties[ 54 ] =
+			{
+				0x0, 0x0, 0x6, 0x2, 0x6, 0x1, 0x6, 0xD,
+				0xE, 0xE, 0xE, 0xC, 0xC, 0xB, 0xA, 0xC,
+				0x0, 0x8, 0x0, 0x7, 0x4, 0x6, 0x0, 0x5,
+				0x0, 0x9, 0x0, 0x3, 0xD, 0x9, 0x5, 0xA,
+				0x3, 0x9, 0x9, 0x9, 0x3, 0x9, 0x9, 0x9,
+				0x5, 0x3, 0xE, 0x6, 0xD, 0x7, 0x8, 0x9,
+				0x0, 0x9, 0x9, 0x0, 0x0, 0x0,
+			};
+
+			template< typename Dummy >
+			const unsigned char SegmentationTables< Dummy >::SentenceTransitions[ 150 ] =
+			{
+				0x10, 0x19, 0x18, 0x20, 0x18, 0x20, 0x10, 0x11,
+				0x11, 0x10, 0x10, 0x12, 0x10, 0x16, 0x10, 0x10,
+				0x19, 0x18, 0x21, 0x18, 0x21, 0x10, 0x11, 0x11,
+				0x10, 0x10, 0x13, 0x10, 0x16, 0x10, 0x30, 0x19,
+				0x18, 0x22, 0x18, 0x22, 0x45, 0x11, 0x1, 0x0,
+				0x10, 0x12, 0x40, 0x16, 0x44, 0x30, 0x19, 0x18,
+				0x23, 0x18, 0x23, 0x45, 0x11, 0x11, 0x0, 0x10,
+				0x12, 0x40, 0x16, 0x44, 0x30, 0x19, 0x18, 0x24,
+				0x18, 0x24, 0x45, 0x11, 0x1, 0x0, 0x30, 0x12,
+				0x40, 0x16, 0x44, 0x30, 0x19, 0x18, 0x25, 0x18,
+				0x25, 0x45, 0x11, 0x1, 0x0, 0x30, 0x12, 0x40,
+				0x16, 0x30, 0x0, 0x19, 0x18, 0x26, 0x18, 0x26,
+				0x17, 0x1, 0x1, 0x0, 0x0, 0x12, 0x10, 0x16,
+				0x16, 0x0, 0x19, 0x18, 0x27, 0x18, 0x27, 0x17,
+				0x1, 0x1, 0x0, 0x0, 0x12, 0x10, 0x16, 0x0,
+				0x0, 0x9, 0x8, 0x0, 0x8, 0x0, 0x0, 0x1,
+				0x1, 0x0, 0x0, 0x2, 0x0, 0x6, 0x0, 0x0,
+				0x9, 0x18, 0x0, 0x8, 0x0, 0x0, 0x1, 0x1,
+				0x0, 0x0, 0x2, 0x0, 0x6, 0x0,
+			};
+
+		}
+	}
+}
+
+#endif // utiUnicodeTables_inl__
@@ -0,0 +1,153 @@
+#include "stdafx.h"
+#include "CppUnitTest.h"
+#include "../uti.hpp"
+#include <atomic>
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace utiTest
+{
+	typedef uti::UTF8String< > BatchString;
+	typedef uti::Batch< BatchString > StringBatch;
+	typedef uti::UTF16String< short > Batch16;
+
+	/**
+	\brief Returns \c count strings of varying sizes and chars, with a few large ones in between to unbalance the tasks.
+	*/
+	static std::vector< std::string > BatchInputs( uti::u32 count )
+	{
+		const char* parts[] = { "field", " K\xC3\xB6ln", " \xE2\x82\xAC", " \xF0\x9F\x98\x80", " STRASSE", " Stra\xC3\x9F" "e", " \xCE\xA3\xCE\xB9\xCF\x83" };
+		std::vector< std::string > inputs;
+		for( uti::u32 i = 0U; i < count; ++i )
+		{
+			std::string input;
+			uti::u32 length = i % 97U == 0U ? 4000U : i % 13U;
+			for( uti::u32 k = 0U; k <= length; ++k )
+			{
+				input += parts[ ( i + k ) % 7U ];
+			}
+			inputs.push_back( input );
+		}
+		inputs.push_back( std::string() );
+		return inputs;
+	}
+
+	static std::vector< StringBatch::Slice > BatchSlices( const std::vector< std::string >& inputs )
+	{
+		std::vector< StringBatch::Slice > slices;
+		for( const std::string& input : inputs )
+		{
+			slices.push_back( StringBatch::Slice( input.c_str(), input.c_str() + input.size() ) );
+		}
+		return slices;
+	}
+
+	TEST_CLASS( BatchTest )
+	{
+	public:
+
+		TEST_METHOD( RunTest )
+		{
+			const std::vector< std::string > inputs = BatchInputs( 5000U );
+			const std::vector< StringBatch::Slice > slices = BatchSlices( inputs );
+			const uti::u32 count = static_cast< uti::u32 >( slices.size() );
+			for( uti::u32 threads = 1U; threads <= 4U; ++threads )
+			{
+				StringBatch batch( threads );
+				Assert::AreEqual( threads, batch.ThreadCount() );
+
+				// Every slice is visited exactly once, also over repeated runs on the same pool
+				for( uti::u32 round = 0U; round < 3U; ++round )
+				{
+					std::vector< std::atomic< uti::u32 > > visits( count );
+					for( std::atomic< uti::u32 >& visit : visits )
+					{
+						visit.store( 0U );
+					}
+					batch.Run( slices.data(), count, [ & ]( uti::u32 begin, uti::u32 end )
+					{
+						Assert::IsTrue( begin < end && end <= count );
+						for( uti::u32 i = begin; i < end; ++i )
+						{
+							++visits[ i ];
+						}
+					} );
+					for( uti::u32 i = 0U; i < count; ++i )
+					{
+						Assert::AreEqual( 1U, visits[ i ].load() );
+					}
+				}
+
+				std::vector< uti::u32 > sizes( 1U );
+				batch.Run( slices.data(), 1U, [ & ]( uti::u32 begin, uti::u32 end )
+				{
+					sizes[ begin ] = end - begin;
+				} );
+				Assert::AreEqual( 1U, sizes[ 0 ] );
+				batch.Run( slices.data(), 0U, [ & ]( uti::u32, uti::u32 )
+				{
+					Assert::Fail();
+				} );
+			}
+		}
+
+		TEST_METHOD( KernelTest )
+		{
+			std::vector< std::string > inputs = BatchInputs( 3000U );
+			inputs[ 17 ] += "\xC3\x28 invalid";
+			const std::vector< StringBatch::Slice > slices = BatchSlices( inputs );
+			const uti::u32 count = static_cast< uti::u32 >( slices.size() );
+			StringBatch batch( 4U );
+
+			std::vector< uti::u32 > validSizes( count );
+			std::vector< uti::u32 > charCounts( count );
+			Assert::IsFalse( batch.Validate( slices.data(), count, validSizes.data(), charCounts.data() ) );
+			for( uti::u32 i = 0U; i < count; ++i )
+			{
+				uti::u32 valid = BatchString::ValidPrefix( inputs[ i ].c_str(), static_cast< uti::u32 >( inputs[ i ].size() ) );
+				Assert::AreEqual( valid, validSizes[ i ] );
+				Assert::AreEqual( BatchString::CountChars( inputs[ i ].c_str(), valid ), charCounts[ i ] );
+			}
+			inputs[ 17 ].resize( validSizes[ 17 ] );
+			const std::vector< StringBatch::Slice > validSlices = BatchSlices( inputs );
+			Assert::IsTrue( batch.Validate( validSlices.data(), count, validSizes.data() ) );
+
+			std::vector< uti::u64 > hashes( count );
+			batch.Hash( validSlices.data(), count, hashes.data() );
+			std::vector< StringBatch::Slice > folded( count );
+			batch.CaseFold( validSlices.data(), count, folded.data() );
+			std::vector< StringBatch::Slice > upper( count );
+			batch.MapCase( validSlices.data(), count, uti::unicode::CaseMapping::Upper, upper.data() );
+			std::vector< uti::ByteSpan< Batch16 > > utf16( count );
+			batch.Transcode( validSlices.data(), count, utf16.data() );
+
+			// Every output matches the one of the string methods
+			for( uti::u32 i = 0U; i < count; ++i )
+			{
+				BatchString string( inputs[ i ].c_str() );
+				Assert::AreEqual( string.Hash(), hashes[ i ] );
+
+				BatchString expected = string.CaseFold();
+				Assert::AreEqual( expected.Size(), folded[ i ].Size() );
+				Assert::IsTrue( std::memcmp( expected.c_str(), folded[ i ].begin(), expected.Size() ) == 0 );
+				Assert::AreEqual( expected.IsAscii(), folded[ i ].IsAscii() );
+
+				expected = string.ToUpper();
+				Assert::AreEqual( expected.Size(), upper[ i ].Size() );
+				Assert::IsTrue( std::memcmp( expected.c_str(), upper[ i ].begin(), expected.Size() ) == 0 );
+
+				Batch16 expected16 = uti::ToUTF16< Batch16 >( string );
+				Assert::AreEqual( expected16.Size(), static_cast< uti::u32 >( utf16[ i ].Size() * sizeof( short ) ) );
+				Assert::IsTrue( std::memcmp( expected16.c_str(), utf16[ i ].begin(), expected16.Size() ) == 0 );
+			}
+
+			// The outputs share the arena blocks
+			Assert::IsTrue( batch.ArenaSize() > 0U );
+			batch.Clear();
+			Assert::AreEqual( static_cast< uti::u64 >( 0U ), batch.ArenaSize() );
+		}
+	};
+}
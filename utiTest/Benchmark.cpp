@@ -0,0 +1,985 @@
+#include "stdafx.h"
+#include "CppUnitTest.h"
+#include "../uti.hpp"
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace utiTest
+{
+	typedef uti::UTF8String< > BenchString;
+	typedef uti::UTF8String< char, uti::DefaultAllocator, uti::AtomicRefCountPolicy > SharedBenchString;
+
+	/**
+	\brief Divides the input sizes of the benchmarks, so they stay quick in the default test run.
+
+	Define UTI_FULL_BENCHMARKS to measure with the full sizes.
+	*/
+#if defined( UTI_FULL_BENCHMARKS )
+	static const uti::u32 BenchmarkScale = 1U;
+#else
+	static const uti::u32 BenchmarkScale = 64U;
+#endif // UTI_FULL_BENCHMARKS
+
+	/**
+	\brief Runs the function and returns the elapsed time in milliseconds.
+	*/
+	template< typename Function >
+	static double MeasureMilliseconds( Function function )
+	{
+		auto start = std::chrono::high_resolution_clock::now();
+		function();
+		auto end = std::chrono::high_resolution_clock::now();
+		return std::chrono::duration< double, std::milli >( end - start ).count();
+	}
+
+	static void LogTiming( const wchar_t* name, double milliseconds )
+	{
+		Logger::WriteMessage( ( std::wstring( name ) + L": " + std::to_wstring( milliseconds ) + L" ms" ).c_str() );
+	}
+
+	/**
+	\brief Creates a string of at least \\c minSize bytes by repeating \\c text.
+	*/
+	static BenchString RepeatText( const char* text, uti::u32 minSize )
+	{
+		BenchString result( text );
+		while( result.Size() < minSize )
+		{
+			result += result;
+		}
+		return result;
+	}
+
+	/**
+	\brief Runs \c function( threadIndex ) on \c threadCount threads and returns the elapsed time in milliseconds.
+	*/
+	template< typename Function >
+	static double MeasureThreads( int threadCount, Function function )
+	{
+		return MeasureMilliseconds( [ & ]()
+		{
+			std::vector< std::thread > threads;
+			for( int t = 0; t < threadCount; ++t )
+			{
+				threads.push_back( std::thread( function, t ) );
+			}
+			for( auto& thread : threads )
+			{
+				thread.join();
+			}
+		} );
+	}
+
+	TEST_CLASS( Benchmark )
+	{
+	public:
+
+		// Excluded from a run with /TestCaseFilter:"TestCategory!=Benchmark"
+		BEGIN_TEST_CLASS_ATTRIBUTE()
+			TEST_CLASS_ATTRIBUTE( L"TestCategory", L"Benchmark" )
+		END_TEST_CLASS_ATTRIBUTE()
+
+		TEST_METHOD( IteratorVersusCursor )
+		{
+			BenchString text = RepeatText( "Some text with \xC3\xA4, \xE2\x82\xAC and \xF0\x9F\x98\x80 chars. ", ( 1U << 24U ) / BenchmarkScale );
+
+			uti::u32 iteratorSum = 0U;
+			uti::u32 spanSum = 0U;
+			uti::u32 charIteratorSum = 0U;
+			uti::u32 cursorSum = 0U;
+
+			LogTiming( L"Byte Iterator loop", MeasureMilliseconds( [ & ]()
+			{
+				for( auto it = text.Begin(); it != text.End(); ++it )
+				{
+					iteratorSum += static_cast< unsigned char >( *it );
+				}
+			} ) );
+
+			LogTiming( L"ByteSpan loop", MeasureMilliseconds( [ & ]()
+			{
+				for( char byte : text.Bytes() )
+				{
+					spanSum += static_cast< unsigned char >( byte );
+				}
+			} ) );
+
+			LogTiming( L"Char Iterator loop", MeasureMilliseconds( [ & ]()
+			{
+				for( auto it = text.CharBegin(); it != text.CharEnd(); ++it )
+				{
+					charIteratorSum += BenchString::ExtractCodePoint( *it );
+				}
+			} ) );
+
+			LogTiming( L"ConstCharCursor loop", MeasureMilliseconds( [ & ]()
+			{
+				for( uti::u32 codePoint : text.Chars() )
+				{
+					cursorSum += codePoint;
+				}
+			} ) );
+
+			Assert::AreEqual( iteratorSum, spanSum );
+			Assert::AreEqual( charIteratorSum, cursorSum );
+		}
+
+		TEST_METHOD( EqualityCompare )
+		{
+			const uti::u32 count = 1U << 16U;
+			std::vector< BenchString > strings;
+			std::vector< BenchString > copies;
+			strings.reserve( count );
+			copies.reserve( count );
+			for( uti::u32 i = 0U; i < count; ++i )
+			{
+				// Equal prefixes, so every compare has to look at the whole string
+				std::string text = "some/common/path/prefix/for/the/dedup/stage/" + std::to_string( i );
+				strings.push_back( BenchString( text.c_str() ) );
+				copies.push_back( BenchString( text.c_str() ) );
+			}
+
+			uti::u32 byteLoopEqual = 0U;
+			uti::u32 operatorEqual = 0U;
+			uti::u32 sharedEqual = 0U;
+
+			LogTiming( L"Byte Iterator compare", MeasureMilliseconds( [ & ]()
+			{
+				for( uti::u32 i = 0U; i < count; ++i )
+				{
+					const BenchString& lhs = strings[ i ];
+					const BenchString& rhs = copies[ ( i * 7U ) % count ];
+					bool equal = lhs.Size() == rhs.Size();
+					for( auto l = lhs.Begin(), r = rhs.Begin(); equal && l != lhs.End(); ++l, ++r )
+					{
+						equal = *l == *r;
+					}
+					byteLoopEqual += equal ? 1U : 0U;
+				}
+			} ) );
+
+			LogTiming( L"operator== compare", MeasureMilliseconds( [ & ]()
+			{
+				for( uti::u32 i = 0U; i < count; ++i )
+				{
+					operatorEqual += strings[ i ] == copies[ ( i * 7U ) % count ] ? 1U : 0U;
+				}
+			} ) );
+
+			LogTiming( L"operator== shared buffer", MeasureMilliseconds( [ & ]()
+			{
+				for( uti::u32 i = 0U; i < count; ++i )
+				{
+					BenchString shared( strings[ i ] );
+					sharedEqual += strings[ i ] == shared ? 1U : 0U;
+				}
+			} ) );
+
+			Assert::AreEqual( byteLoopEqual, operatorEqual );
+			Assert::AreEqual( count, sharedEqual );
+		}
+
+		TEST_METHOD( HashThroughput )
+		{
+			BenchString text = RepeatText( "Some text with \xC3\xA4, \xE2\x82\xAC and \xF0\x9F\x98\x80 chars. ", ( 1U << 24U ) / BenchmarkScale );
+			uti::u64 seededHash = 0U;
+			size_t stdHash = 0U;
+
+			LogTiming( L"std::hash of c_str", MeasureMilliseconds( [ & ]()
+			{
+				stdHash = std::hash< std::string >()( std::string( text.c_str(), text.Size() ) );
+			} ) );
+
+			LogTiming( L"HashBytes", MeasureMilliseconds( [ & ]()
+			{
+				seededHash = text.Hash( 42U );
+			} ) );
+
+			uti::u64 firstHash = 0U;
+			uti::u64 cachedHash = 0U;
+			LogTiming( L"Hash first call", MeasureMilliseconds( [ & ]()
+			{
+				firstHash = text.Hash();
+			} ) );
+
+			LogTiming( L"Hash cached call", MeasureMilliseconds( [ & ]()
+			{
+				BenchString copy( text );
+				cachedHash = copy.Hash();
+			} ) );
+
+			Assert::IsTrue( firstHash == cachedHash );
+			Assert::IsTrue( seededHash != firstHash );
+			Assert::IsTrue( stdHash != 0U );
+		}
+
+		TEST_METHOD( ConcurrentInternScaling )
+		{
+			const int nameCount = 512;
+			const int internsPerThread = 200000 / static_cast< int >( BenchmarkScale );
+			std::vector< std::string > names;
+			for( int i = 0; i < nameCount; ++i )
+			{
+				names.push_back( "request.header.field_" + std::to_string( i ) );
+			}
+
+			for( int threadCount = 1; threadCount <= 8; threadCount *= 2 )
+			{
+				uti::ConcurrentInternPool< SharedBenchString > concurrentPool( 1024U );
+				double concurrentTime = MeasureThreads( threadCount, [ & ]( int t )
+				{
+					for( int i = 0; i < internsPerThread; ++i )
+					{
+						concurrentPool.Intern( names[ ( i + t * 31 ) % nameCount ].c_str() );
+					}
+				} );
+
+				uti::InternPool< SharedBenchString > lockedPool;
+				std::mutex lock;
+				double lockedTime = MeasureThreads( threadCount, [ & ]( int t )
+				{
+					for( int i = 0; i < internsPerThread; ++i )
+					{
+						std::lock_guard< std::mutex > guard( lock );
+						lockedPool.Intern( names[ ( i + t * 31 ) % nameCount ].c_str() );
+					}
+				} );
+
+				std::wstring threads = std::to_wstring( threadCount ) + L" threads";
+				LogTiming( ( L"ConcurrentInternPool " + threads ).c_str(), concurrentTime );
+				LogTiming( ( L"Locked InternPool " + threads ).c_str(), lockedTime );
+
+				Assert::AreEqual( static_cast< uti::u32 >( nameCount ), concurrentPool.Size() );
+				Assert::AreEqual( static_cast< uti::u32 >( nameCount ), lockedPool.Size() );
+			}
+		}
+
+		TEST_METHOD( StringMapLookup )
+		{
+			const int keyCount = 100000;
+			const int lookupRounds = 10;
+			std::vector< BenchString > keys;
+			for( int i = 0; i < keyCount; ++i )
+			{
+				keys.push_back( BenchString( ( ( i % 4 == 0 ? "a/longer/request/path/segment/" : "id_" ) + std::to_string( i ) ).c_str() ) );
+			}
+
+			uti::StringMap< int, BenchString > map;
+			std::unordered_map< std::string, int > stdMap;
+			LogTiming( L"StringMap insert", MeasureMilliseconds( [ & ]()
+			{
+				for( int i = 0; i < keyCount; ++i )
+				{
+					map.Set( keys[ i ], i );
+				}
+			} ) );
+			LogTiming( L"std::unordered_map insert", MeasureMilliseconds( [ & ]()
+			{
+				for( int i = 0; i < keyCount; ++i )
+				{
+					stdMap[ std::string( keys[ i ].c_str(), keys[ i ].Size() ) ] = i;
+				}
+			} ) );
+
+			long long mapSum = 0;
+			long long stdSum = 0;
+			LogTiming( L"StringMap lookup by span", MeasureMilliseconds( [ & ]()
+			{
+				for( int round = 0; round < lookupRounds; ++round )
+				{
+					for( int i = 0; i < keyCount; ++i )
+					{
+						mapSum += *map.Find( keys[ i ].Bytes() );
+					}
+				}
+			} ) );
+			LogTiming( L"std::unordered_map lookup", MeasureMilliseconds( [ & ]()
+			{
+				std::string key;
+				for( int round = 0; round < lookupRounds; ++round )
+				{
+					for( int i = 0; i < keyCount; ++i )
+					{
+						key.assign( keys[ i ].c_str(), keys[ i ].Size() );
+						stdSum += stdMap.find( key )->second;
+					}
+				}
+			} ) );
+
+			Assert::IsTrue( mapSum == stdSum );
+		}
+
+		TEST_METHOD( CompareSort )
+		{
+			std::vector< BenchString > strings;
+			for( int i = 0; i < 200000; ++i )
+			{
+				strings.push_back( BenchString( ( "/usr/share/locale/\xC3\xA4/common/prefix/" + std::to_string( ( i * 7919 ) % 200000 ) ).c_str() ) );
+			}
+			std::vector< BenchString > byStrcmp( strings );
+
+			LogTiming( L"std::sort with operator<", MeasureMilliseconds( [ & ]()
+			{
+				std::sort( strings.begin(), strings.end() );
+			} ) );
+			LogTiming( L"std::sort with strcmp", MeasureMilliseconds( [ & ]()
+			{
+				std::sort( byStrcmp.begin(), byStrcmp.end(), []( const BenchString& lhs, const BenchString& rhs )
+				{
+					return std::strcmp( lhs.c_str(), rhs.c_str() ) < 0;
+				} );
+			} ) );
+
+			for( size_t i = 0; i < strings.size(); ++i )
+			{
+				Assert::IsTrue( strings[ i ] == byStrcmp[ i ] );
+			}
+		}
+
+		TEST_METHOD( RadixSortStrings )
+		{
+			std::vector< BenchString > strings;
+			for( int i = 0; i < 300000; ++i )
+			{
+				strings.push_back( BenchString( ( "/usr/share/locale/\xC3\xA4/common/prefix/" + std::to_string( ( i * 4099 ) % 300000 ) ).c_str() ) );
+			}
+			std::vector< BenchString > comparisonSorted( strings );
+			std::vector< BenchString > parallelSorted( strings );
+
+			LogTiming( L"std::sort with operator<", MeasureMilliseconds( [ & ]()
+			{
+				std::sort( comparisonSorted.begin(), comparisonSorted.end() );
+			} ) );
+			LogTiming( L"SortStrings single thread", MeasureMilliseconds( [ & ]()
+			{
+				uti::SortStrings( strings.data(), strings.data() + strings.size(), 1U );
+			} ) );
+			LogTiming( L"SortStrings all threads", MeasureMilliseconds( [ & ]()
+			{
+				uti::SortStrings( parallelSorted.data(), parallelSorted.data() + parallelSorted.size() );
+			} ) );
+
+			for( size_t i = 0; i < strings.size(); ++i )
+			{
+				Assert::IsTrue( strings[ i ] == comparisonSorted[ i ] );
+				Assert::IsTrue( parallelSorted[ i ] == comparisonSorted[ i ] );
+			}
+		}
+
+		TEST_METHOD( CrossEncodingEquals )
+		{
+			std::wstring wideText;
+			while( wideText.size() < 4096U )
+			{
+				wideText += L"Content-Type: text/html; charset=utf-8 \x00E4\x20AC ";
+			}
+			BenchString utf8 = BenchString::FromUTF16LE( wideText.c_str() );
+			uti::UTF16String< wchar_t > utf16( wideText.c_str() );
+			const int rounds = 20000;
+			int transcodedEqual = 0;
+			int directEqual = 0;
+
+			LogTiming( L"FromUTF16LE and operator==", MeasureMilliseconds( [ & ]()
+			{
+				for( int i = 0; i < rounds; ++i )
+				{
+					transcodedEqual += BenchString::FromUTF16LE( utf16.c_str() ) == utf8 ? 1 : 0;
+				}
+			} ) );
+			LogTiming( L"uti::Equals", MeasureMilliseconds( [ & ]()
+			{
+				for( int i = 0; i < rounds; ++i )
+				{
+					directEqual += uti::Equals( utf8, utf16 ) ? 1 : 0;
+				}
+			} ) );
+
+			Assert::AreEqual( transcodedEqual, directEqual );
+		}
+
+		TEST_METHOD( IgnoreAsciiCaseHeaders )
+		{
+			const char* names[] = { "Content-Type", "content-length", "ACCEPT-ENCODING", "X-Forwarded-For", "Cache-Control", "If-None-Match", "Access-Control-Allow-Origin", "User-Agent" };
+			const char* known[] = { "content-type", "Content-Length", "accept-encoding", "x-forwarded-for", "cache-control", "if-none-match", "access-control-allow-origin", "user-agent" };
+			std::vector< BenchString > headers;
+			std::vector< BenchString > keys;
+			for( int i = 0; i < 8; ++i )
+			{
+				headers.push_back( BenchString( names[ i ] ) );
+				keys.push_back( BenchString( known[ i ] ) );
+			}
+			const int rounds = 1000000;
+			int scalarMatches = 0;
+			int simdMatches = 0;
+
+			LogTiming( L"tolower loop", MeasureMilliseconds( [ & ]()
+			{
+				for( int round = 0; round < rounds; ++round )
+				{
+					const BenchString& lhs = headers[ round & 7 ];
+					const BenchString& rhs = keys[ ( round >> 3 ) & 7 ];
+					bool equal = lhs.Size() == rhs.Size();
+					for( uti::u32 i = 0U; equal && i < lhs.Size(); ++i )
+					{
+						equal = ::tolower( static_cast< unsigned char >( lhs.c_str()[ i ] ) ) == ::tolower( static_cast< unsigned char >( rhs.c_str()[ i ] ) );
+					}
+					scalarMatches += equal ? 1 : 0;
+				}
+			} ) );
+			LogTiming( L"EqualsIgnoreAsciiCase", MeasureMilliseconds( [ & ]()
+			{
+				for( int round = 0; round < rounds; ++round )
+				{
+					simdMatches += headers[ round & 7 ].EqualsIgnoreAsciiCase( keys[ ( round >> 3 ) & 7 ] ) ? 1 : 0;
+				}
+			} ) );
+
+			Assert::AreEqual( scalarMatches, simdMatches );
+		}
+
+		TEST_METHOD( CaseMappingThroughput )
+		{
+			BenchString source = RepeatText( "The quick brown fox jumps over the lazy dog. M\xC3\xBCnchen Stra\xC3\x9F" "e \xCE\x91\xCE\xB8\xCE\xAE\xCE\xBD\xCE\xB1 ", 1U << 16U );
+			const int rounds = 200;
+			uti::u32 codePointSize = 0U;
+			uti::u32 mappedSize = 0U;
+
+			LogTiming( L"MapCase per code point", MeasureMilliseconds( [ & ]()
+			{
+				for( int round = 0; round < rounds; ++round )
+				{
+					uti::u32 mapped[ uti::unicode::MaxCaseMappingLength ];
+					for( uti::u32 codePoint : source.Chars() )
+					{
+						uti::u32 count = uti::unicode::MapCase( codePoint, uti::unicode::CaseMapping::Upper, mapped );
+						for( uti::u32 i = 0U; i < count; ++i )
+						{
+							codePointSize += BenchString::GetCodePointSize( mapped[ i ] );
+						}
+					}
+				}
+			} ) );
+			LogTiming( L"ToUpper", MeasureMilliseconds( [ & ]()
+			{
+				for( int round = 0; round < rounds; ++round )
+				{
+					mappedSize += source.ToUpper().Size();
+				}
+			} ) );
+
+			Assert::AreEqual( codePointSize, mappedSize );
+		}
+
+
+		TEST_METHOD( NormalizationQuickCheck )
+		{
+			BenchString normalized = RepeatText( "Gr\xC3\xBC\xC3\x9F" "e aus M\xC3\xBCnchen, \xCE\x9A\xCE\xB1\xCE\xBB\xCE\xB7\xCE\xBC\xCE\xAD\xCF\x81\xCE\xB1, "
+				"\xE3\x81\x93\xE3\x82\x93\xE3\x81\xAB\xE3\x81\xA1\xE3\x81\xAF, \xEC\x95\x88\xEB\x85\x95\xED\x95\x98\xEC\x84\xB8\xEC\x9A\x94. ", ( 1U << 20U ) / BenchmarkScale );
+			BenchString decomposed = normalized.Normalize( uti::unicode::NormalizationForm::NFD );
+			const int rounds = 20;
+			uti::u32 quickCheckSize = 0U;
+			uti::u32 composedSize = 0U;
+
+			LogTiming( L"NFC of NFC text ( quick check )", MeasureMilliseconds( [ & ]()
+			{
+				for( int round = 0; round < rounds; ++round )
+				{
+					quickCheckSize += normalized.Normalize( uti::unicode::NormalizationForm::NFC ).Size();
+				}
+			} ) );
+			LogTiming( L"NFC of NFD text", MeasureMilliseconds( [ & ]()
+			{
+				for( int round = 0; round < rounds; ++round )
+				{
+					composedSize += decomposed.Normalize( uti::unicode::NormalizationForm::NFC ).Size();
+				}
+			} ) );
+
+			Assert::AreEqual( quickCheckSize, composedSize );
+		}
+
+
+		TEST_METHOD( GraphemeCounting )
+		{
+			BenchString text = RepeatText( "Der Stra\xC3\x9F" "enverkehr in M\xC3\xBCnchen ist am Montagmorgen besonders dicht, "
+				"sagt die Polizei. Caf\xC3\xA9 au lait co\xC3\xBB" "te deux euros. ", ( 1U << 24U ) / BenchmarkScale );
+			std::vector< char > copy( text.Size() );
+			uti::u32 stateMachineCount = 0U;
+			uti::u32 blockCount = 0U;
+
+			LogTiming( L"memcpy", MeasureMilliseconds( [ & ]()
+			{
+				memcpy( copy.data(), text.Data(), text.Size() );
+			} ) );
+			LogTiming( L"IsGraphemeBreak per code point", MeasureMilliseconds( [ & ]()
+			{
+				uti::unicode::GraphemeBreakState state;
+				bool first = true;
+				for( uti::u32 codePoint : text.Chars() )
+				{
+					if( first )
+					{
+						uti::unicode::BeginGraphemeCluster( state, codePoint );
+						first = false;
+						++stateMachineCount;
+					}
+					else if( uti::unicode::IsGraphemeBreak( state, codePoint ) )
+					{
+						++stateMachineCount;
+					}
+				}
+			} ) );
+			LogTiming( L"GraphemeCount", MeasureMilliseconds( [ & ]()
+			{
+				blockCount = text.GraphemeCount();
+			} ) );
+
+			Assert::AreEqual( stateMachineCount, blockCount );
+			Assert::IsTrue( memcmp( copy.data(), text.Data(), text.Size() ) == 0 );
+		}
+
+		TEST_METHOD( WordAndSentenceSegmentation )
+		{
+			const wchar_t* names[] = { L"English", L"German", L"Russian", L"Greek", L"Chinese", L"Japanese", L"Arabic" };
+			const char* corpora[] =
+			{
+				"The quick brown fox doesn't jump over 3.5 lazy dogs; it naps instead. Dr. Smith agrees! ",
+				"Die Stra\xC3\x9F" "enbahn f\xC3\xA4hrt um 7.30 Uhr \xC3\xBC" "ber die Br\xC3\xBC" "cke. Gr\xC3\xBC\xC3\x9F" "e aus K\xC3\xB6ln! ",
+				"\xD0\xA1\xD1\x8A\xD0\xB5\xD1\x88\xD1\x8C \xD0\xB6\xD0\xB5 \xD0\xB5\xD1\x89\xD1\x91 \xD1\x8D\xD1\x82\xD0\xB8\xD1\x85 "
+				"\xD0\xBC\xD1\x8F\xD0\xB3\xD0\xBA\xD0\xB8\xD1\x85 \xD1\x84\xD1\x80\xD0\xB0\xD0\xBD\xD1\x86\xD1\x83\xD0\xB7\xD1\x81\xD0\xBA\xD0\xB8\xD1\x85 "
+				"\xD0\xB1\xD1\x83\xD0\xBB\xD0\xBE\xD0\xBA, \xD0\xB4\xD0\xB0 \xD0\xB2\xD1\x8B\xD0\xBF\xD0\xB5\xD0\xB9 \xD1\x87\xD0\xB0\xD1\x8E. "
+				"\xD0\x92\xD1\x81\xD1\x91 \xD0\xB2 \xD0\xBF\xD0\xBE\xD1\x80\xD1\x8F\xD0\xB4\xD0\xBA\xD0\xB5? ",
+				"\xCE\x9F \xCE\xB3\xCF\x81\xCE\xAE\xCE\xB3\xCE\xBF\xCF\x81\xCE\xBF\xCF\x82 \xCE\xBA\xCE\xB1\xCF\x86\xCE\xAD \xCE\xB1\xCE\xBB\xCE\xB5\xCF\x80\xCE\xBF\xCF\x8D "
+				"\xCF\x80\xCE\xB7\xCE\xB4\xCE\xAC \xCF\x80\xCE\xAC\xCE\xBD\xCF\x89 \xCE\xB1\xCF\x80\xCF\x8C \xCF\x84\xCE\xBF\xCE\xBD \xCF\x84\xCE\xB5\xCE\xBC\xCF\x80\xCE\xAD\xCE\xBB\xCE\xB7 "
+				"\xCF\x83\xCE\xBA\xCF\x8D\xCE\xBB\xCE\xBF. \xCE\x9D\xCE\xB1\xCE\xB9! ",
+				"\xE6\x88\x91\xE4\xBB\xAC\xE4\xBB\x8A\xE5\xA4\xA9\xE5\x8E\xBB\xE5\x85\xAC\xE5\x9B\xAD\xE6\x95\xA3\xE6\xAD\xA5\xE3\x80\x82"
+				"\xE5\xA4\xA9\xE6\xB0\x94\xE5\xBE\x88\xE5\xA5\xBD\xEF\xBC\x81\xE4\xBD\xA0\xE6\x83\xB3\xE4\xB8\x80\xE8\xB5\xB7\xE6\x9D\xA5\xE5\x90\x97\xEF\xBC\x9F",
+				"\xE4\xBB\x8A\xE6\x97\xA5\xE3\x81\xAF\xE3\x81\x84\xE3\x81\x84\xE5\xA4\xA9\xE6\xB0\x97\xE3\x81\xA7\xE3\x81\x99\xE3\x81\xAD\xE3\x80\x82"
+				"\xE3\x82\xAB\xE3\x82\xBF\xE3\x82\xAB\xE3\x83\x8A\xE3\x81\xA8\xE3\x81\xB2\xE3\x82\x89\xE3\x81\x8C\xE3\x81\xAA\xE3\x82\x92"
+				"\xE6\xB7\xB7\xE3\x81\x9C\xE3\x81\xA6\xE6\x9B\xB8\xE3\x81\x8D\xE3\x81\xBE\xE3\x81\x99\xE3\x80\x82",
+				"\xD9\x85\xD8\xB1\xD8\xAD\xD8\xA8\xD8\xA7 \xD8\xA8\xD8\xA7\xD9\x84\xD8\xB9\xD8\xA7\xD9\x84\xD9\x85. \xD9\x83\xD9\x8A\xD9\x81 "
+				"\xD8\xAD\xD8\xA7\xD9\x84\xD9\x83 \xD8\xA7\xD9\x84\xD9\x8A\xD9\x88\xD9\x85\xD8\x9F "
+			};
+
+			for( uti::u32 corpus = 0U; corpus < 7U; ++corpus )
+			{
+				BenchString text = RepeatText( corpora[ corpus ], ( 1U << 22U ) / BenchmarkScale );
+				std::wstring name( names[ corpus ] );
+				uti::u32 propertySum = 0U;
+				uti::u32 wordCount = 0U;
+				uti::u32 wordBytes = 0U;
+				uti::u32 sentenceCount = 0U;
+				uti::u32 sentenceBytes = 0U;
+
+				// Looking up the property of every code point is the least a per code point state machine has to do
+				LogTiming( ( name + L" GetWordBreak per code point" ).c_str(), MeasureMilliseconds( [ & ]()
+				{
+					for( uti::u32 codePoint : text.Chars() )
+					{
+						propertySum += static_cast< uti::u32 >( uti::unicode::GetWordBreak( codePoint ) );
+					}
+				} ) );
+				LogTiming( ( name + L" Words" ).c_str(), MeasureMilliseconds( [ & ]()
+				{
+					for( auto it = text.Words(); it.Valid(); ++it )
+					{
+						wordCount += it.IsWord() ? 1U : 0U;
+						wordBytes += it.SegmentSize();
+					}
+				} ) );
+				LogTiming( ( name + L" Sentences" ).c_str(), MeasureMilliseconds( [ & ]()
+				{
+					for( auto sentence : text.Sentences() )
+					{
+						++sentenceCount;
+						sentenceBytes += sentence.Size();
+					}
+				} ) );
+
+				Assert::IsTrue( propertySum < text.CharCount() * static_cast< uti::u32 >( uti::unicode::WordBreak::Count ) );
+				Assert::IsTrue( wordCount != 0U && sentenceCount != 0U );
+				Assert::AreEqual( text.Size(), wordBytes );
+				Assert::AreEqual( text.Size(), sentenceBytes );
+			}
+		}
+		TEST_METHOD( SplitFields )
+		{
+			BenchString text = RepeatText( "1024,Jane Doe,K\xC3\xB6ln,3.50,2014-07-21,a somewhat longer free text field,OK;", ( 1U << 22U ) / BenchmarkScale );
+			std::string copy( text.c_str(), text.Size() );
+			uti::u32 substrFields = 0U;
+			uti::u32 substrBytes = 0U;
+			uti::u32 splitFields = 0U;
+			uti::u32 splitBytes = 0U;
+			uti::u32 anyFields = 0U;
+
+			// Every field is copied into a string of its own, like a loop over find and substr does
+			LogTiming( L"find + substr", MeasureMilliseconds( [ & ]()
+			{
+				std::string::size_type pos = 0U;
+				for( ;; )
+				{
+					std::string::size_type next = copy.find( ',', pos );
+					std::string field = copy.substr( pos, next == std::string::npos ? std::string::npos : next - pos );
+					++substrFields;
+					substrBytes += static_cast< uti::u32 >( field.size() );
+					if( next == std::string::npos )
+					{
+						break;
+					}
+					pos = next + 1U;
+				}
+			} ) );
+			LogTiming( L"Split", MeasureMilliseconds( [ & ]()
+			{
+				for( auto field : text.Split( "," ) )
+				{
+					++splitFields;
+					splitBytes += field.Size();
+				}
+			} ) );
+			LogTiming( L"SplitAny", MeasureMilliseconds( [ & ]()
+			{
+				for( auto field : text.SplitAny( ",;", uti::SplitOptions::SkipEmpty ) )
+				{
+					anyFields += field.Empty() ? 0U : 1U;
+				}
+			} ) );
+
+			Assert::AreEqual( substrFields, splitFields );
+			Assert::AreEqual( substrBytes, splitBytes );
+			Assert::IsTrue( anyFields > splitFields );
+		}
+
+		TEST_METHOD( CsvParsing )
+		{
+			BenchString text = RepeatText( "1024,\"Doe, Jane\",K\xC3\xB6ln,3.50,\"say \"\"hi\"\"\",a somewhat longer free text field\r\n", ( 1U << 22U ) / BenchmarkScale );
+			std::string copy( text.c_str(), text.Size() );
+			uti::u32 naiveFields = 0U;
+			uti::u32 naiveBytes = 0U;
+			uti::u32 readerFields = 0U;
+			uti::u32 readerBytes = 0U;
+
+			// A char by char state machine, which builds every field in a string of its own
+			LogTiming( L"state machine", MeasureMilliseconds( [ & ]()
+			{
+				std::string field;
+				bool quoted = false;
+				for( std::string::size_type i = 0U; i < copy.size(); ++i )
+				{
+					char c = copy[ i ];
+					if( quoted )
+					{
+						if( c != '"' )
+						{
+							field += c;
+						}
+						else if( i + 1U < copy.size() && copy[ i + 1U ] == '"' )
+						{
+							field += c;
+							++i;
+						}
+						else
+						{
+							quoted = false;
+						}
+					}
+					else if( c == '"' )
+					{
+						quoted = true;
+					}
+					else if( c == ',' || c == '\n' )
+					{
+						++naiveFields;
+						naiveBytes += static_cast< uti::u32 >( field.size() );
+						field.clear();
+					}
+					else if( c != '\r' )
+					{
+						field += c;
+					}
+				}
+			} ) );
+			LogTiming( L"CsvReader", MeasureMilliseconds( [ & ]()
+			{
+				uti::CsvReader< BenchString > reader( text );
+				while( reader.NextRecord() )
+				{
+					readerFields += reader.FieldCount();
+					for( uti::u32 i = 0U; i < reader.FieldCount(); ++i )
+					{
+						readerBytes += reader.Field( i ).Size();
+					}
+				}
+				Assert::IsTrue( reader.Error() == uti::CsvError::None );
+			} ) );
+
+			Assert::AreEqual( naiveFields, readerFields );
+			Assert::AreEqual( naiveBytes, readerBytes );
+		}
+
+		TEST_METHOD( StreamDecoding )
+		{
+			BenchString text = RepeatText( "Some text with \xC3\xA4, \xE2\x82\xAC and \xF0\x9F\x98\x80 chars. ", ( 1U << 24U ) / BenchmarkScale );
+			std::string copy( text.c_str(), text.Size() );
+			BenchString whole;
+			BenchString streamed;
+
+			// The whole text is needed up front for the constructor
+			LogTiming( L"UTF8String( const char* )", MeasureMilliseconds( [ & ]()
+			{
+				whole = BenchString( copy.c_str() );
+			} ) );
+			// Chunks of the size of a tcp segment, which cut the chars at arbitrary bytes
+			LogTiming( L"UTF8StreamDecoder", MeasureMilliseconds( [ & ]()
+			{
+				uti::UTF8StreamDecoder< BenchString > decoder;
+				for( std::string::size_type pos = 0U; pos < copy.size(); pos += 1460U )
+				{
+					decoder.Append( copy.c_str() + pos, static_cast< uti::u32 >( std::min< std::string::size_type >( 1460U, copy.size() - pos ) ) );
+				}
+				Assert::IsTrue( decoder.Finish( streamed ) );
+			} ) );
+
+			Assert::IsTrue( whole == streamed );
+			Assert::AreEqual( whole.CharCount(), streamed.CharCount() );
+		}
+
+		TEST_METHOD( FileLoading )
+		{
+			const char* path = "uti_benchmark_file.txt";
+			BenchString text = RepeatText( "Some text with \xC3\xA4, \xE2\x82\xAC and \xF0\x9F\x98\x80 chars. ", ( 1U << 25U ) / BenchmarkScale );
+			{
+				std::ofstream file( path, std::ios::binary | std::ios::trunc );
+				file.write( text.c_str(), text.Size() );
+			}
+			BenchString streamed;
+			BenchString read;
+			uti::MappedUTF8String mapped;
+
+			// Read into a buffer of our own, then copied and validated again by the constructor
+			LogTiming( L"ifstream + UTF8String( const char* )", MeasureMilliseconds( [ & ]()
+			{
+				std::ifstream file( path, std::ios::binary );
+				std::string content( ( std::istreambuf_iterator< char >( file ) ), std::istreambuf_iterator< char >() );
+				streamed = BenchString( content.c_str() );
+			} ) );
+			LogTiming( L"UTF8String::FromFile", MeasureMilliseconds( [ & ]()
+			{
+				Assert::IsTrue( BenchString::FromFile( path, read ) );
+			} ) );
+			LogTiming( L"MappedUTF8String::FromFile", MeasureMilliseconds( [ & ]()
+			{
+				Assert::IsTrue( uti::MappedUTF8String::FromFile( path, mapped ) );
+			} ) );
+			std::remove( path );
+
+			Assert::IsTrue( streamed == read );
+			Assert::AreEqual( read.Size(), mapped.Size() );
+			Assert::AreEqual( read.CharCount(), mapped.CharCount() );
+		}
+
+		TEST_METHOD( ParallelValidationScaling )
+		{
+			BenchString text = RepeatText( "Some text with \xC3\xA4, \xE2\x82\xAC and \xF0\x9F\x98\x80 chars. ", ( 1U << 26U ) / BenchmarkScale );
+			const uti::u32 threshold = BenchString::ParallelThreshold;
+			const uti::u32 threadCount = BenchString::ParallelThreadCount;
+
+			for( uti::u32 threads = 1U; threads <= 8U; threads *= 2U )
+			{
+				uti::u32 charCount = 0U;
+				uti::u32 valid = 0U;
+				double validateTime = MeasureMilliseconds( [ & ]()
+				{
+					valid = BenchString::ValidPrefixParallel( text.c_str(), text.Size(), charCount, threads );
+				} );
+
+				// Construction validates, counts and copies in the same chunks
+				BenchString::ParallelThreshold = threads > 1U ? BenchString::ParallelChunkSize : 0xFFFFFFFFU;
+				BenchString::ParallelThreadCount = threads;
+				BenchString copy;
+				double constructTime = MeasureMilliseconds( [ & ]()
+				{
+					copy = BenchString( text.c_str() );
+				} );
+
+				std::wstring name = std::to_wstring( threads ) + L" threads";
+				LogTiming( ( L"ValidPrefixParallel " + name ).c_str(), validateTime );
+				LogTiming( ( L"UTF8String( const char* ) " + name ).c_str(), constructTime );
+
+				Assert::AreEqual( text.Size(), valid );
+				Assert::AreEqual( text.CharCount(), charCount );
+				Assert::AreEqual( text.CharCount(), copy.CharCount() );
+			}
+			BenchString::ParallelThreshold = threshold;
+			BenchString::ParallelThreadCount = threadCount;
+		}
+
+		TEST_METHOD( TranscodeScaling )
+		{
+			BenchString text = RepeatText( "Some text with \xC3\xA4, \xE2\x82\xAC and \xF0\x9F\x98\x80 chars. ", ( 1U << 25U ) / BenchmarkScale );
+			typedef uti::UTF16String< short > Bench16;
+			Bench16 utf16 = uti::ToUTF16< Bench16 >( text );
+
+			// The per code point conversion FromWideString used before, growing its buffer
+			BenchString perCodePoint;
+			LogTiming( L"Chars + FromCodePoint", MeasureMilliseconds( [ & ]()
+			{
+				uti::u32 capacity = utf16.CharCount() + 1U;
+				uti::u32 size = 0U;
+				char* buffer = static_cast< char* >( std::malloc( capacity ) );
+				for( uti::u32 codePoint : utf16.Chars() )
+				{
+					uti::u32 charSize = BenchString::GetCodePointSize( codePoint );
+					if( size + charSize >= capacity )
+					{
+						capacity *= 2U;
+						buffer = static_cast< char* >( std::realloc( buffer, capacity ) );
+					}
+					BenchString::FromCodePoint( codePoint, buffer + size );
+					size += charSize;
+				}
+				buffer[ size ] = 0;
+				perCodePoint = BenchString( buffer );
+				std::free( buffer );
+			} ) );
+			Assert::IsTrue( perCodePoint == text );
+
+			for( uti::u32 threads = 1U; threads <= 8U; threads *= 2U )
+			{
+				BenchString utf8;
+				Bench16 back;
+				std::wstring name = std::to_wstring( threads ) + L" threads";
+				LogTiming( ( L"ToUTF8 " + name ).c_str(), MeasureMilliseconds( [ & ]()
+				{
+					utf8 = uti::ToUTF8< BenchString >( utf16, threads );
+				} ) );
+				LogTiming( ( L"ToUTF16 " + name ).c_str(), MeasureMilliseconds( [ & ]()
+				{
+					back = uti::ToUTF16< Bench16 >( text, threads );
+				} ) );
+				Assert::IsTrue( utf8 == text );
+				Assert::IsTrue( back == utf16 );
+			}
+		}
+
+		TEST_METHOD( BatchKernels )
+		{
+			std::vector< std::string > fields;
+			for( uti::u32 i = 0U; i < 1000000U / BenchmarkScale; ++i )
+			{
+				fields.push_back( "Field " + std::to_string( i ) + ( i % 3U == 0U ? " K\xC3\xB6ln" : " value" ) );
+			}
+			typedef uti::Batch< BenchString > BenchBatch;
+			std::vector< BenchBatch::Slice > slices;
+			for( const std::string& field : fields )
+			{
+				slices.push_back( BenchBatch::Slice( field.c_str(), field.c_str() + field.size() ) );
+			}
+			const uti::u32 count = static_cast< uti::u32 >( slices.size() );
+			std::vector< uti::u64 > hashes( count );
+			std::vector< BenchBatch::Slice > folded( count );
+
+			uti::u64 folds = 0U;
+			LogTiming( L"UTF8String per field, Hash + CaseFold", MeasureMilliseconds( [ & ]()
+			{
+				for( uti::u32 i = 0U; i < count; ++i )
+				{
+					BenchString field( fields[ i ].c_str() );
+					hashes[ i ] = field.Hash();
+					folds += field.CaseFold().Size();
+				}
+			} ) );
+
+			for( uti::u32 threads = 1U; threads <= 8U; threads *= 2U )
+			{
+				BenchBatch batch( threads );
+				std::vector< uti::u64 > batchHashes( count );
+				std::wstring name = std::to_wstring( threads ) + L" threads";
+				LogTiming( ( L"Batch Validate + Hash + CaseFold " + name ).c_str(), MeasureMilliseconds( [ & ]()
+				{
+					std::vector< uti::u32 > validSizes( count );
+					batch.Validate( slices.data(), count, validSizes.data() );
+					batch.Hash( slices.data(), count, batchHashes.data() );
+					batch.CaseFold( slices.data(), count, folded.data() );
+				} ) );
+				Assert::IsTrue( batchHashes == hashes );
+			}
+			Assert::IsTrue( folds > 0U );
+		}
+
+		TEST_METHOD( MakeManyRecords )
+		{
+			// Records of 50 fields, each record built field by field and with MakeMany
+			const uti::u32 fieldCount = 50U;
+			std::vector< std::string > records;
+			for( uti::u32 i = 0U; i < 20000U / BenchmarkScale; ++i )
+			{
+				std::string record;
+				for( uti::u32 field = 0U; field < fieldCount; ++field )
+				{
+					record += ( field == 0U ? "" : "," ) + std::to_string( i * field ) + ( field % 7U == 0U ? " K\xC3\xB6ln" : " v" );
+				}
+				records.push_back( record );
+			}
+			std::vector< std::vector< BenchString::Span > > slices( records.size() );
+			for( size_t i = 0U; i < records.size(); ++i )
+			{
+				const char* begin = records[ i ].c_str();
+				const char* end = begin + records[ i ].size();
+				for( const char* pos = begin; pos <= end; ++pos )
+				{
+					if( pos == end || *pos == ',' )
+					{
+						slices[ i ].push_back( BenchString::Span( begin, pos ) );
+						begin = pos + 1;
+					}
+				}
+			}
+
+			std::vector< BenchString > strings( fieldCount );
+			uti::u64 chars = 0U;
+			LogTiming( L"UTF8String( const char* ) per field", MeasureMilliseconds( [ & ]()
+			{
+				for( const std::vector< BenchString::Span >& record : slices )
+				{
+					for( uti::u32 i = 0U; i < fieldCount; ++i )
+					{
+						// Copied into a terminated buffer first, as a parser handing out fields of its input has to
+						char buffer[ 64 ];
+						memcpy( buffer, record[ i ].begin(), record[ i ].Size() );
+						buffer[ record[ i ].Size() ] = '\0';
+						strings[ i ] = BenchString( buffer );
+						chars += strings[ i ].CharCount();
+					}
+				}
+			} ) );
+
+			uti::u64 manyChars = 0U;
+			LogTiming( L"UTF8String::MakeMany per record", MeasureMilliseconds( [ & ]()
+			{
+				for( const std::vector< BenchString::Span >& record : slices )
+				{
+					BenchString::MakeMany( record.data(), fieldCount, strings.data() );
+					for( uti::u32 i = 0U; i < fieldCount; ++i )
+					{
+						manyChars += strings[ i ].CharCount();
+					}
+				}
+			} ) );
+			Assert::AreEqual( chars, manyChars );
+		}
+
+	};
+}
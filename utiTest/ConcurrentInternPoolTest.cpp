@@ -0,0 +1,119 @@
+#include "stdafx.h"
+#include "CppUnitTest.h"
+#include "../uti.hpp"
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace utiTest
+{
+	typedef uti::UTF8String< char, uti::DefaultAllocator, uti::AtomicRefCountPolicy > SharedString;
+	typedef uti::ConcurrentInternPool< SharedString > SharedPool;
+
+	TEST_CLASS( ConcurrentInternPoolTest )
+	{
+	public:
+
+		TEST_METHOD( InternTest )
+		{
+			SharedPool pool( 16U );
+			SharedString first( "GET" );
+			Assert::IsTrue( pool.Intern( first ).SharesData( first ) );
+			Assert::IsTrue( pool.Intern( SharedString( "GET" ) ).SharesData( first ) );
+			Assert::IsTrue( pool.Intern( "GET" ).SharesData( first ) );
+			Assert::IsFalse( pool.Intern( "POST" ).SharesData( first ) );
+			Assert::AreEqual( 2U, pool.Size() );
+
+			SharedString found;
+			Assert::IsTrue( pool.Find( "GET", 3U, found ) );
+			Assert::IsTrue( found.SharesData( first ) );
+			Assert::IsFalse( pool.Find( "PUT", 3U, found ) );
+
+			Assert::AreEqual( 1U, pool.Purge() );
+			Assert::AreEqual( 1U, pool.Size() );
+			Assert::IsFalse( pool.Find( "POST", 4U, found ) );
+		}
+
+		TEST_METHOD( ThreadedInternTest )
+		{
+			const int threadCount = 8;
+			const int nameCount = 1000;
+			SharedPool pool( 256U );
+			std::vector< std::vector< SharedString > > results( threadCount );
+			std::vector< std::thread > threads;
+			for( int t = 0; t < threadCount; ++t )
+			{
+				threads.push_back( std::thread( [ &, t ]()
+				{
+					for( int i = 0; i < nameCount; ++i )
+					{
+						// Every thread starts at a different name, so the inserts of a name race
+						int name = ( i + t * 97 ) % nameCount;
+						results[ t ].push_back( pool.Intern( ( "field_" + std::to_string( name ) ).c_str() ) );
+					}
+				} ) );
+			}
+			for( auto& thread : threads )
+			{
+				thread.join();
+			}
+
+			Assert::AreEqual( static_cast< uti::u32 >( nameCount ), pool.Size() );
+			for( int t = 1; t < threadCount; ++t )
+			{
+				for( int i = 0; i < nameCount; ++i )
+				{
+					int name = ( i + t * 97 ) % nameCount;
+					Assert::IsTrue( results[ t ][ i ].SharesData( results[ 0 ][ name ] ), L"A name was interned twice" );
+				}
+			}
+		}
+
+		TEST_METHOD( ConcurrentPurgeTest )
+		{
+			const int threadCount = 4;
+			const int nameCount = 64;
+			SharedPool pool( 16U );
+			std::atomic< bool > running( true );
+
+			std::thread purger( [ & ]()
+			{
+				while( running.load() )
+				{
+					pool.Purge();
+				}
+			} );
+
+			std::vector< std::thread > threads;
+			std::atomic< int > duplicates( 0 );
+			for( int t = 0; t < threadCount; ++t )
+			{
+				threads.push_back( std::thread( [ &, t ]()
+				{
+					for( int i = 0; i < 20000; ++i )
+					{
+						std::string name = "name_" + std::to_string( ( i * 7 + t ) % nameCount );
+						// While a string is held, interning its content again has to return the same data
+						SharedString held = pool.Intern( name.c_str() );
+						if( !pool.Intern( name.c_str() ).SharesData( held ) )
+						{
+							++duplicates;
+						}
+					}
+				} ) );
+			}
+			for( auto& thread : threads )
+			{
+				thread.join();
+			}
+			running.store( false );
+			purger.join();
+
+			Assert::AreEqual( 0, duplicates.load() );
+			pool.Purge();
+			Assert::AreEqual( 0U, pool.Size() );
+		}
+	};
+}
@@ -0,0 +1,92 @@
+#include "stdafx.h"
+#include "CppUnitTest.h"
+#include "../uti.hpp"
+#include <string>
+#include <vector>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace utiTest
+{
+	typedef uti::UTF8String< > Cross8;
+	typedef uti::UTF16String< short > Cross16LE;
+	typedef uti::UTF16String< short, ::uti::BinaryOrder::BigEndian > Cross16BE;
+
+	/**
+	\brief Creates a utf-16 string from the code units in \c text, swapping them for big endian strings.
+	*/
+	template< typename String16 >
+	static String16 MakeUtf16( const wchar_t* text, bool bigEndian )
+	{
+		std::vector< short > units;
+		for( ; *text != 0; ++text )
+		{
+			unsigned int unit = static_cast< unsigned int >( *text ) & 0xFFFFU;
+			if( bigEndian )
+			{
+				unit = ( ( unit & 0xFFU ) << 8U ) | ( unit >> 8U );
+			}
+			units.push_back( static_cast< short >( unit ) );
+		}
+		units.push_back( 0 );
+		return String16( units.data() );
+	}
+
+	template< typename String16 >
+	static void CheckCrossEncoding( bool bigEndian )
+	{
+		Cross8 text( "Header-Name: value with \xC3\xA4, \xE2\x82\xAC and \xF0\x9F\x98\x80 after a long ASCII run" );
+		String16 same = MakeUtf16< String16 >( L"Header-Name: value with \x00E4, \x20AC and \xD83D\xDE00 after a long ASCII run", bigEndian );
+		String16 prefix = MakeUtf16< String16 >( L"Header-Name: value with \x00E4", bigEndian );
+		String16 changed = MakeUtf16< String16 >( L"Header-Name: value with \x00E4, \x20AC and \xD83D\xDE01 after a long ASCII run", bigEndian );
+
+		Assert::IsTrue( uti::Equals( text, same ) );
+		Assert::IsTrue( uti::Equals( same, text ) );
+		Assert::IsFalse( uti::Equals( text, changed ) );
+		Assert::IsFalse( uti::Equals( text, prefix ) );
+		Assert::AreEqual( 0, uti::Compare( text, same ) );
+		Assert::IsTrue( uti::Compare( text, changed ) < 0 );
+		Assert::IsTrue( uti::Compare( changed, text ) > 0 );
+		Assert::IsTrue( uti::Compare( prefix, text ) < 0 );
+		Assert::IsTrue( uti::StartsWith( text, prefix ) );
+		Assert::IsTrue( uti::StartsWith( same, Cross8( "Header-Name: value with \xC3\xA4" ) ) );
+		Assert::IsFalse( uti::StartsWith( prefix, text ) );
+		Assert::IsTrue( uti::StartsWith( text, String16() ) );
+
+		// U+FF5E is ordered before U+1F600, although its unit is above the surrogates
+		Assert::IsTrue( uti::Compare( Cross8( "\xEF\xBD\x9E" ), MakeUtf16< String16 >( L"\xD83D\xDE00", bigEndian ) ) < 0 );
+		Assert::IsTrue( uti::Compare( MakeUtf16< String16 >( L"\xFF5E", bigEndian ), Cross8( "\xF0\x9F\x98\x80" ) ) < 0 );
+
+		// A difference has to be found at every position of the ASCII blocks
+		std::string ascii8( 70, 'a' );
+		std::wstring ascii16( 70, L'a' );
+		for( size_t i = 0; i < ascii8.size(); ++i )
+		{
+			ascii8[ i ] = 'b';
+			Assert::IsTrue( uti::Compare( Cross8( ascii8.c_str() ), MakeUtf16< String16 >( ascii16.c_str(), bigEndian ) ) > 0 );
+			Assert::IsFalse( uti::Equals( Cross8( ascii8.c_str() ), MakeUtf16< String16 >( ascii16.c_str(), bigEndian ) ) );
+			ascii16[ i ] = L'b';
+			Assert::IsTrue( uti::Equals( Cross8( ascii8.c_str() ), MakeUtf16< String16 >( ascii16.c_str(), bigEndian ) ) );
+
+			// A non ASCII unit whose low byte is the ASCII char must not match
+			ascii16[ i ] = L'\x0162';
+			Assert::IsTrue( uti::Compare( Cross8( ascii8.c_str() ), MakeUtf16< String16 >( ascii16.c_str(), bigEndian ) ) < 0 );
+			ascii16[ i ] = L'b';
+		}
+	}
+
+	TEST_CLASS( CrossEncodingTest )
+	{
+	public:
+
+		TEST_METHOD( LittleEndianTest )
+		{
+			CheckCrossEncoding< Cross16LE >( false );
+		}
+
+		TEST_METHOD( BigEndianTest )
+		{
+			CheckCrossEncoding< Cross16BE >( true );
+		}
+	};
+}
@@ -0,0 +1,153 @@
+#include "stdafx.h"
+#include "CppUnitTest.h"
+#include "../uti.hpp"
+#include <string>
+#include <vector>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace utiTest
+{
+	typedef uti::UTF8String< > CsvString;
+	typedef uti::CsvReader< CsvString > Reader;
+
+	/**
+	\brief Creates a string holding exactly \c bytes, the string constructors would replace invalid utf-8.
+	*/
+	static CsvString RawString( const std::string& bytes )
+	{
+		uti::DefaultAllocator alloc;
+		char* data = static_cast< char* >( alloc.AllocateBytes( static_cast< uti::u32 >( bytes.size() ) + 1U ) );
+		memcpy( data, bytes.c_str(), bytes.size() + 1U );
+		return CsvString( CsvString::DataType( data ), static_cast< uti::u32 >( bytes.size() ), static_cast< uti::u32 >( bytes.size() ) );
+	}
+
+	/**
+	\brief Reads every record and joins the fields with '|' and the records with '/'.
+	*/
+	static std::string ReadAll( Reader& reader )
+	{
+		std::string result;
+		while( reader.NextRecord() )
+		{
+			result += result.empty() ? "" : "/";
+			for( uti::u32 i = 0U; i < reader.FieldCount(); ++i )
+			{
+				result += i == 0U ? "" : "|";
+				result.append( reader.Field( i ).begin(), reader.Field( i ).end() );
+			}
+		}
+		return result;
+	}
+
+	TEST_CLASS( CsvReaderTest )
+	{
+	public:
+
+		TEST_METHOD( RecordTest )
+		{
+			CsvString text( "id,name,city\r\n1,\"Doe, Jane\",K\xC3\xB6ln\n2,\"say \"\"hi\"\"\",\n3,\"two\nlines\",\"\"\n" );
+			Reader reader( text );
+			Assert::IsTrue( reader.NextRecord() );
+			Assert::AreEqual( 3U, reader.FieldCount() );
+			Assert::AreEqual( 0U, reader.RecordOffset() );
+			Assert::IsTrue( reader.Field( 2 ).Size() == 4U && memcmp( reader.Field( 2 ).begin(), "city", 4U ) == 0 );
+
+			// Unquoted and quoted fields without escapes are views into the text
+			Assert::IsTrue( reader.NextRecord() );
+			Assert::AreEqual( 14U, reader.RecordOffset() );
+			Assert::IsTrue( reader.Field( 1 ).begin() == text.Bytes().begin() + 17 );
+			Assert::AreEqual( 9U, reader.Field( 1 ).Size() );
+
+			Assert::IsTrue( reader.NextRecord() );
+			Assert::AreEqual( 3U, reader.FieldCount() );
+			Assert::AreEqual( std::string( "say \"hi\"" ), std::string( reader.Field( 1 ).begin(), reader.Field( 1 ).end() ) );
+			Assert::IsTrue( reader.Field( 2 ).Empty() );
+
+			Assert::IsTrue( reader.NextRecord() );
+			Assert::AreEqual( std::string( "two\nlines" ), std::string( reader.Field( 1 ).begin(), reader.Field( 1 ).end() ) );
+			Assert::IsTrue( reader.Field( 2 ).Empty() );
+			Assert::IsFalse( reader.NextRecord() );
+			Assert::IsTrue( reader.Error() == uti::CsvError::None );
+
+			// Without a line break at the end, empty lines and other delimiters
+			Reader last( CsvString( "a,,b\n\n,c" ) );
+			Assert::AreEqual( std::string( "a||b//|c" ), ReadAll( last ) );
+			Reader tabs( CsvString( "a\tb,c\t\"d\te\"\r\n" ), '\t' );
+			Assert::AreEqual( std::string( "a|b,c|d\te" ), ReadAll( tabs ) );
+			Reader empty( CsvString( "" ) );
+			Assert::IsFalse( empty.NextRecord() );
+			Assert::IsTrue( empty.Error() == uti::CsvError::None );
+		}
+
+		TEST_METHOD( ErrorTest )
+		{
+			// The records in front of an error are read, the record containing it fails
+			Reader invalid( RawString( "a,b\nc,\xC3\x28,d\ne" ) );
+			Assert::AreEqual( std::string( "a|b" ), ReadAll( invalid ) );
+			Assert::IsTrue( invalid.Error() == uti::CsvError::InvalidUtf8 );
+			Assert::AreEqual( 6U, invalid.ErrorOffset() );
+
+			Reader overlong( RawString( "ok\n\xE0\x80\xAF" ) );
+			Assert::AreEqual( std::string( "ok" ), ReadAll( overlong ) );
+			Assert::IsTrue( overlong.Error() == uti::CsvError::InvalidUtf8 );
+			Assert::AreEqual( 3U, overlong.ErrorOffset() );
+
+			Reader inner( CsvString( "a,b\"c,d\n" ) );
+			Assert::IsFalse( inner.NextRecord() );
+			Assert::IsTrue( inner.Error() == uti::CsvError::UnexpectedQuote );
+			Assert::AreEqual( 3U, inner.ErrorOffset() );
+
+			Reader behind( CsvString( "x\n\"ab\"c,d\n" ) );
+			Assert::AreEqual( std::string( "x" ), ReadAll( behind ) );
+			Assert::IsTrue( behind.Error() == uti::CsvError::UnexpectedQuote );
+			Assert::AreEqual( 6U, behind.ErrorOffset() );
+
+			Reader open( CsvString( "a,b\nc,\"d,e\nf\n" ) );
+			Assert::AreEqual( std::string( "a|b" ), ReadAll( open ) );
+			Assert::IsTrue( open.Error() == uti::CsvError::UnterminatedQuote );
+			Assert::AreEqual( 6U, open.ErrorOffset() );
+
+			// Escaped quotes inside of the unterminated field do not move the error offset
+			Reader escaped( CsvString( "\"a\"\"b" ) );
+			Assert::IsFalse( escaped.NextRecord() );
+			Assert::IsTrue( escaped.Error() == uti::CsvError::UnterminatedQuote );
+			Assert::AreEqual( 0U, escaped.ErrorOffset() );
+
+			Reader escapedTwice( CsvString( "x,\"ab\"\"cd\"\"e\n" ) );
+			Assert::IsFalse( escapedTwice.NextRecord() );
+			Assert::IsTrue( escapedTwice.Error() == uti::CsvError::UnterminatedQuote );
+			Assert::AreEqual( 2U, escapedTwice.ErrorOffset() );
+
+			// The escaped quote is split across the 64 byte block boundary
+			for( uti::u32 offset = 56U; offset < 72U; ++offset )
+			{
+				std::string text = std::string( offset, 'x' ) + ",\"ab\"\"c";
+				Reader split( CsvString( text.c_str() ) );
+				Assert::IsFalse( split.NextRecord() );
+				Assert::IsTrue( split.Error() == uti::CsvError::UnterminatedQuote );
+				Assert::AreEqual( offset + 1U, split.ErrorOffset() );
+			}
+		}
+
+		TEST_METHOD( BlockBoundaryTest )
+		{
+			// Quoted regions, escaped quotes, line breaks and multi byte chars are moved across the 64 byte block boundaries
+			for( uti::u32 offset = 0U; offset < 140U; ++offset )
+			{
+				std::string text = std::string( offset, 'x' ) + ",\"q,\"\"\n\xE2\x82\xAC\"," + std::string( 60U, 'y' ) + "\xF0\x9F\x98\x80\r\n\"\",z";
+				Reader reader( CsvString( text.c_str() ) );
+				std::string expected = std::string( offset, 'x' ) + "|q,\"\n\xE2\x82\xAC|" + std::string( 60U, 'y' ) + "\xF0\x9F\x98\x80/|z";
+				Assert::AreEqual( expected, ReadAll( reader ) );
+				Assert::IsTrue( reader.Error() == uti::CsvError::None );
+
+				// A truncated char right in front of a line feed
+				text = std::string( offset, 'x' ) + "\xE2\x82\n" + std::string( 70U, 'y' );
+				Reader truncated( RawString( text ) );
+				Assert::IsFalse( truncated.NextRecord() );
+				Assert::IsTrue( truncated.Error() == uti::CsvError::InvalidUtf8 );
+				Assert::AreEqual( offset, truncated.ErrorOffset() );
+			}
+		}
+	};
+}
@@ -0,0 +1,143 @@
+#include "stdafx.h"
+#include "CppUnitTest.h"
+#include "../uti.hpp"
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace utiTest
+{
+	typedef uti::UTF8String< > InternString;
+	typedef uti::InternPool< InternString > StringPool;
+
+	TEST_CLASS( InternPoolTest )
+	{
+	public:
+
+		TEST_METHOD( InternTest )
+		{
+			StringPool pool;
+			InternString first( "GET" );
+			InternString second( "GET" );
+			Assert::IsFalse( first.SharesData( second ) );
+
+			InternString canonical = pool.Intern( first );
+			Assert::IsTrue( canonical.SharesData( first ), L"The first interned string has to become the canonical one" );
+			Assert::IsTrue( pool.Intern( second ).SharesData( first ) );
+			Assert::IsTrue( pool.Intern( "GET" ).SharesData( first ) );
+			Assert::IsFalse( pool.Intern( "POST" ).SharesData( first ) );
+			Assert::AreEqual( 2U, pool.Size() );
+
+			Assert::IsTrue( pool.Find( "GET", 3U ) != nullptr );
+			Assert::IsTrue( pool.Find( "GE", 2U ) == nullptr );
+			Assert::IsTrue( pool.Find( "PUT", 3U ) == nullptr );
+		}
+
+		TEST_METHOD( GrowTest )
+		{
+			StringPool pool;
+			std::vector< InternString > canonical;
+			for( int i = 0; i < 1000; ++i )
+			{
+				canonical.push_back( pool.Intern( InternString( std::to_string( i ).c_str() ) ) );
+			}
+			Assert::AreEqual( 1000U, pool.Size() );
+
+			// The canonical strings survive growing the table
+			for( int i = 0; i < 1000; ++i )
+			{
+				Assert::IsTrue( pool.Intern( std::to_string( i ).c_str() ).SharesData( canonical[ i ] ) );
+			}
+			Assert::AreEqual( 1000U, pool.Size() );
+		}
+
+		TEST_METHOD( PurgeTest )
+		{
+			StringPool pool;
+			InternString kept = pool.Intern( "kept" );
+			pool.Intern( "dropped" );
+			pool.Intern( "also dropped" );
+			Assert::AreEqual( 3U, pool.Size() );
+			Assert::AreEqual( 2U, kept.ReferenceCount() );
+
+			Assert::AreEqual( 2U, pool.Purge() );
+			Assert::AreEqual( 1U, pool.Size() );
+			Assert::IsTrue( pool.Intern( "kept" ).SharesData( kept ) );
+			Assert::IsTrue( pool.Find( "dropped", 7U ) == nullptr );
+
+			pool.Clear();
+			Assert::AreEqual( 0U, pool.Size() );
+			Assert::AreEqual( 1U, kept.ReferenceCount() );
+		}
+
+		TEST_METHOD( ScopedPoolTest )
+		{
+			InternString global = uti::Intern( InternString( "field" ) );
+			Assert::IsTrue( &StringPool::Current() == &StringPool::Global() );
+			{
+				uti::ScopedInternPool< StringPool > scope;
+				Assert::IsTrue( &StringPool::Current() == &scope.Pool() );
+
+				InternString scoped = uti::Intern( InternString( "field" ) );
+				Assert::IsFalse( scoped.SharesData( global ) );
+				Assert::IsTrue( uti::Intern( InternString( "field" ) ).SharesData( scoped ) );
+				{
+					uti::ScopedInternPool< StringPool > inner;
+					Assert::IsTrue( &StringPool::Current() == &inner.Pool() );
+				}
+				Assert::IsTrue( &StringPool::Current() == &scope.Pool() );
+			}
+			Assert::IsTrue( &StringPool::Current() == &StringPool::Global() );
+			Assert::IsTrue( uti::Intern( InternString( "field" ) ).SharesData( global ) );
+			StringPool::Global().Clear();
+		}
+
+		TEST_METHOD( ThreadedGlobalPoolTest )
+		{
+			// Threads interning through the global pool get the same canonical strings
+			typedef uti::UTF8String< char, uti::DefaultAllocator, uti::AtomicRefCountPolicy > SharedString;
+			std::vector< SharedString > results[ 4 ];
+			std::thread threads[ 4 ];
+			for( int t = 0; t < 4; ++t )
+			{
+				threads[ t ] = std::thread( [ &, t ]()
+				{
+					for( int i = 0; i < 1000; ++i )
+					{
+						results[ t ].push_back( uti::Intern( SharedString( std::to_string( i % 100 ).c_str() ) ) );
+					}
+				} );
+			}
+			for( int t = 0; t < 4; ++t )
+			{
+				threads[ t ].join();
+			}
+			Assert::AreEqual( 100U, uti::InternPool< SharedString >::Global().Size() );
+			for( int t = 1; t < 4; ++t )
+			{
+				for( int i = 0; i < 1000; ++i )
+				{
+					Assert::IsTrue( results[ t ][ i ].SharesData( results[ 0 ][ i ] ) );
+				}
+			}
+			for( int t = 0; t < 4; ++t )
+			{
+				results[ t ].clear();
+			}
+			uti::InternPool< SharedString >::Global().Clear();
+		}
+
+		TEST_METHOD( UTF16Test )
+		{
+			typedef uti::UTF16String< wchar_t > String16;
+			uti::InternPool< String16 > pool;
+			String16 first( L"Text \x20AC" );
+			Assert::IsTrue( pool.Intern( first ).SharesData( first ) );
+			Assert::IsTrue( pool.Intern( L"Text \x20AC" ).SharesData( first ) );
+			Assert::IsTrue( pool.Find( L"Text \x20AC", 6U ) != nullptr );
+			Assert::AreEqual( 1U, pool.Size() );
+		}
+	};
+}
@@ -0,0 +1,112 @@
+#include "stdafx.h"
+#include "CppUnitTest.h"
+#include "../uti.hpp"
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace utiTest
+{
+	/**
+	\brief Writes \c content to the file at \c path, replacing it.
+	*/
+	static void WriteTestFile( const char* path, const std::string& content )
+	{
+		std::ofstream file( path, std::ios::binary | std::ios::trunc );
+		file.write( content.c_str(), static_cast< std::streamsize >( content.size() ) );
+	}
+
+	TEST_CLASS( MappedFileTest )
+	{
+	public:
+
+		TEST_METHOD( FromFileTest )
+		{
+			const char* path = "uti_mapped_file_test.txt";
+			const std::string content = "Mapped K\xC3\xB6ln \xE2\x82\xAC \xF0\x9F\x98\x80 text\n";
+			WriteTestFile( path, content );
+
+			uti::MappedUTF8String mapped;
+			Assert::IsTrue( uti::MappedUTF8String::FromFile( path, mapped ) );
+			Assert::AreEqual( static_cast< uti::u32 >( content.size() ), mapped.Size() );
+			Assert::AreEqual( 21U, mapped.CharCount() );
+			Assert::IsFalse( mapped.IsAscii() );
+			Assert::AreEqual( content, std::string( mapped.c_str() ) );
+
+			// Copies share the mapping, buffers derived from it are allocated and freed as usual
+			{
+				uti::MappedUTF8String copy( mapped );
+				uti::MappedUTF8String part = mapped.Substr( 0U, 6U );
+				Assert::IsTrue( part == uti::MappedUTF8String( "Mapped" ) );
+				Assert::IsTrue( copy.c_str() == mapped.c_str() );
+			}
+
+			// Written in place into the private copy of the page, the file stays untouched
+			mapped.MakeUpper();
+			Assert::IsTrue( mapped == uti::MappedUTF8String( "MAPPED K\xC3\x96LN \xE2\x82\xAC \xF0\x9F\x98\x80 TEXT\n" ) );
+			uti::UTF8String< > read;
+			Assert::IsTrue( uti::UTF8String< >::FromFile( path, read ) );
+			Assert::AreEqual( content, std::string( read.c_str() ) );
+			Assert::AreEqual( 21U, read.CharCount() );
+
+			// A file filling its last page completely is still terminated
+			WriteTestFile( path, std::string( 4096U, 'a' ) );
+			Assert::IsTrue( uti::MappedUTF8String::FromFile( path, mapped ) );
+			Assert::AreEqual( 4096U, mapped.Size() );
+			Assert::IsTrue( mapped.IsAscii() );
+			Assert::AreEqual( static_cast< size_t >( 4096U ), std::strlen( mapped.c_str() ) );
+
+			WriteTestFile( path, "" );
+			Assert::IsTrue( uti::MappedUTF8String::FromFile( path, mapped ) );
+			Assert::AreEqual( 0U, mapped.Size() );
+
+			WriteTestFile( path, "valid\n\xE0\x80\xAF" );
+			Assert::IsFalse( uti::MappedUTF8String::FromFile( path, mapped ) );
+			Assert::AreEqual( 0U, mapped.Size() );
+			Assert::IsFalse( uti::UTF8String< >::FromFile( path, read ) );
+			Assert::AreEqual( 0U, read.Size() );
+
+			std::remove( path );
+			Assert::IsFalse( uti::MappedUTF8String::FromFile( path, mapped ) );
+		}
+
+		TEST_METHOD( ValidPrefixParallelTest )
+		{
+			typedef uti::UTF8String< > String;
+			std::string text;
+			while( text.size() < 5U * String::ParallelChunkSize )
+			{
+				text += "Chunks \xC3\xA4\xE2\x82\xAC\xF0\x9F\x98\x80 ";
+			}
+			const uti::u32 size = static_cast< uti::u32 >( text.size() );
+			uti::u32 charCount = 0U;
+			Assert::AreEqual( size, String::ValidPrefixParallel( text.c_str(), size, charCount, 4U ) );
+			Assert::AreEqual( String::CountChars( text.c_str(), size ), charCount );
+
+			// Errors around the chunk boundaries, the first one is found whichever chunk holds it
+			for( uti::u32 boundary = 1U; boundary < 4U; ++boundary )
+			{
+				uti::u32 nominal = static_cast< uti::u32 >( static_cast< uti::u64 >( size ) * boundary / 4U );
+				for( uti::u32 offset = nominal - 4U; offset < nominal + 4U; ++offset )
+				{
+					std::string broken = text;
+					broken[ offset ] = '\xFF';
+					broken[ size - 10U ] = '\xFF';
+					uti::u32 expected = String::ValidPrefix( broken.c_str(), size );
+					Assert::AreEqual( expected, String::ValidPrefixParallel( broken.c_str(), size, charCount, 4U ) );
+					Assert::AreEqual( String::CountChars( broken.c_str(), expected ), charCount );
+				}
+			}
+
+			// A run of continuation bytes across a boundary
+			std::string stray = text;
+			uti::u32 nominal = size / 2U;
+			std::memset( &stray[ nominal - 3U ], 0x80, 8U );
+			uti::u32 expected = String::ValidPrefix( stray.c_str(), size );
+			Assert::AreEqual( expected, String::ValidPrefixParallel( stray.c_str(), size, charCount, 2U ) );
+			Assert::AreEqual( String::CountChars( stray.c_str(), expected ), charCount );
+		}
+	};
+}
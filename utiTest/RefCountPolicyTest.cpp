@@ -1,6 +1,8 @@
 #include "stdafx.h"
 #include "CppUnitTest.h"
 #include "../uti.hpp"
+#include <thread>
+#include <vector>
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 
@@ -81,5 +83,29 @@ namespace utiTest
 			Assert::AreEqual(2U, TestRefCountPolicy::s_numIncRefCalls);
 			Assert::AreEqual(2U, TestRefCountPolicy::s_numDecRefCalls);
 		}
+
+		TEST_METHOD(AtomicPolicy)
+		{
+			typedef uti::UTF8String< char, uti::DefaultAllocator, uti::AtomicRefCountPolicy > SharedString;
+			SharedString shared("Shared between threads");
+
+			std::vector< std::thread > threads;
+			for( int t = 0; t < 8; ++t )
+			{
+				threads.push_back( std::thread( [ &shared ]()
+				{
+					for( int i = 0; i < 100000; ++i )
+					{
+						SharedString copy( shared );
+					}
+				} ) );
+			}
+			for( auto& thread : threads )
+			{
+				thread.join();
+			}
+
+			Assert::AreEqual(1U, shared.ReferenceCount(), L"Concurrent copies lost a reference count update");
+		}
 	};
 }
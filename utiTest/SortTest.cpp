@@ -0,0 +1,203 @@
+#include "stdafx.h"
+#include "CppUnitTest.h"
+#include "../uti.hpp"
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace utiTest
+{
+	typedef uti::UTF8String< > SortString;
+
+	/**
+	\brief Counts the reference counter updates, to check which operations touch them.
+	*/
+	struct CountingRefCountPolicy
+	{
+		static uti::u32 s_uiIncRefCalls;
+		static uti::u32 s_uiDecRefCalls;
+
+		inline static uti::u32 DecRef( uti::u32& count )
+		{
+			++s_uiDecRefCalls;
+			return --count;
+		}
+
+		inline static void IncRef( uti::u32& count )
+		{
+			++s_uiIncRefCalls;
+			++count;
+		}
+
+		inline static void Destroy( uti::IAllocator* pAllocator, void* pCounted, uti::u32* pCount )
+		{
+			uti::DefaultRefCountPolicy::Destroy( pAllocator, pCounted, pCount );
+		}
+	};
+
+	uti::u32 CountingRefCountPolicy::s_uiIncRefCalls = 0U;
+	uti::u32 CountingRefCountPolicy::s_uiDecRefCalls = 0U;
+
+	/**
+	\brief Sorts a copy of \c strings with SortStrings and checks it against std::sort with Compare().
+	*/
+	static void CheckSorted( const std::vector< SortString >& strings, uti::u32 threadCount )
+	{
+		std::vector< SortString > sorted( strings );
+		std::vector< SortString > expected( strings );
+		uti::SortStrings( sorted.data(), sorted.data() + sorted.size(), threadCount );
+		std::stable_sort( expected.begin(), expected.end() );
+		for( size_t i = 0; i < sorted.size(); ++i )
+		{
+			Assert::IsTrue( sorted[ i ] == expected[ i ] );
+		}
+	}
+
+	TEST_CLASS( SortTest )
+	{
+	public:
+
+		TEST_METHOD( SmallSortTest )
+		{
+			std::vector< SortString > strings;
+			strings.push_back( SortString( "pear" ) );
+			strings.push_back( SortString( "" ) );
+			strings.push_back( SortString( "apple" ) );
+			strings.push_back( SortString( "\xF0\x9F\x98\x80" ) );
+			strings.push_back( SortString( "\xEF\xBF\xBF" ) );
+			strings.push_back( SortString( "\xC3\xA4pfel" ) );
+			strings.push_back( SortString( "applesauce" ) );
+			strings.push_back( SortString( "apple" ) );
+
+			uti::SortStrings( strings.data(), strings.data() + strings.size() );
+			const char* expected[] = { "", "apple", "apple", "applesauce", "pear", "\xC3\xA4pfel", "\xEF\xBF\xBF", "\xF0\x9F\x98\x80" };
+			for( size_t i = 0; i < strings.size(); ++i )
+			{
+				Assert::IsTrue( strings[ i ] == SortString( expected[ i ] ) );
+			}
+
+			// Empty and single element ranges are left alone
+			uti::SortStrings( strings.data(), strings.data() );
+			uti::SortStrings( strings.data(), strings.data() + 1 );
+			Assert::IsTrue( strings[ 0 ].Empty() );
+		}
+
+		TEST_METHOD( MoveTest )
+		{
+			// The permutation moves the strings, so sorting never touches a reference counter
+			typedef uti::UTF8String< char, uti::DefaultAllocator, CountingRefCountPolicy > CountedString;
+			std::vector< CountedString > strings;
+			for( int i = 0; i < 100; ++i )
+			{
+				strings.push_back( CountedString( std::to_string( ( i * 37 ) % 100 ).c_str() ) );
+			}
+			CountingRefCountPolicy::s_uiIncRefCalls = 0U;
+			CountingRefCountPolicy::s_uiDecRefCalls = 0U;
+			uti::SortStrings( strings.data(), strings.data() + strings.size(), 1U );
+			Assert::AreEqual( 0U, CountingRefCountPolicy::s_uiIncRefCalls );
+			Assert::AreEqual( 0U, CountingRefCountPolicy::s_uiDecRefCalls );
+			for( size_t i = 1; i < strings.size(); ++i )
+			{
+				Assert::IsTrue( strings[ i - 1 ] <= strings[ i ] );
+				Assert::AreEqual( 1U, strings[ i ].ReferenceCount() );
+			}
+
+			// A moved string swaps its contents on assignment and hands its buffer over on construction
+			CountedString first( "first" );
+			CountedString second( "second" );
+			first = std::move( second );
+			Assert::IsTrue( first == CountedString( "second" ) );
+			Assert::IsTrue( second == CountedString( "first" ) );
+			CountedString moved( std::move( first ) );
+			Assert::IsTrue( moved == CountedString( "second" ) );
+			Assert::AreEqual( 0U, first.Size() );
+			Assert::IsTrue( first.c_str() != nullptr && first.c_str()[ 0 ] == '\0' );
+			first += CountedString( "reused" );
+			Assert::IsTrue( first == CountedString( "reused" ) );
+			first = moved;
+			Assert::AreEqual( 2U, moved.ReferenceCount() );
+		}
+
+		TEST_METHOD( RandomSortTest )
+		{
+			std::mt19937 random( 42U );
+			const char* alphabet[] = { "a", "b", "z", "\xC3\xA4", "\xE2\x82\xAC", "\xF0\x9F\x98\x80", "/" };
+
+			std::vector< SortString > strings;
+			for( int i = 0; i < 5000; ++i )
+			{
+				std::string text;
+				int length = static_cast< int >( random() % 24U );
+				for( int j = 0; j < length; ++j )
+				{
+					text += alphabet[ random() % 7U ];
+				}
+				strings.push_back( SortString( text.c_str() ) );
+			}
+			CheckSorted( strings, 1U );
+
+			// Long shared prefixes and many duplicates take the paths over several key depths
+			std::vector< SortString > prefixed;
+			for( int i = 0; i < 5000; ++i )
+			{
+				std::string text = "/usr/share/locale/common/" + std::to_string( random() % 500U );
+				if( i % 3 == 0 )
+				{
+					text += "/\xC3\xA4";
+				}
+				prefixed.push_back( SortString( text.c_str() ) );
+			}
+			CheckSorted( prefixed, 1U );
+		}
+
+		TEST_METHOD( OrderedInputTest )
+		{
+			// Presorted, reversed and organ pipe inputs and runs of prefixes, which unbalance the partitions
+			std::vector< SortString > sorted;
+			for( int i = 0; i < 20000; ++i )
+			{
+				// Offset, so every number has the same number of digits and the text order is the numeric order
+				sorted.push_back( SortString( std::to_string( 100000 + i ).c_str() ) );
+			}
+			CheckSorted( sorted, 2U );
+			std::vector< SortString > reversed( sorted.rbegin(), sorted.rend() );
+			CheckSorted( reversed, 2U );
+			std::vector< SortString > organPipe( sorted.begin(), sorted.begin() + 10000 );
+			organPipe.insert( organPipe.end(), reversed.begin() + 10000, reversed.end() );
+			CheckSorted( organPipe, 2U );
+
+			std::vector< SortString > prefixes;
+			std::string text;
+			for( int i = 0; i < 2000; ++i )
+			{
+				text += static_cast< char >( 'a' + i % 3 );
+				prefixes.push_back( SortString( text.c_str() ) );
+			}
+			std::vector< SortString > reversedPrefixes( prefixes.rbegin(), prefixes.rend() );
+			CheckSorted( reversedPrefixes, 1U );
+		}
+
+		TEST_METHOD( ParallelSortTest )
+		{
+			std::mt19937 random( 7U );
+			std::vector< SortString > strings;
+			for( int i = 0; i < 100000; ++i )
+			{
+				strings.push_back( SortString( ( "key_" + std::to_string( random() ) ).c_str() ) );
+			}
+			CheckSorted( strings, 4U );
+
+			// The strings are only reordered, every buffer is still referenced once
+			std::vector< SortString > sorted( strings );
+			strings.clear();
+			uti::SortStrings( sorted.data(), sorted.data() + sorted.size(), 4U );
+			for( size_t i = 0; i < sorted.size(); ++i )
+			{
+				Assert::AreEqual( 1U, sorted[ i ].ReferenceCount() );
+			}
+		}
+	};
+}
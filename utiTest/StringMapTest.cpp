@@ -0,0 +1,168 @@
+#include "stdafx.h"
+#include "CppUnitTest.h"
+#include "../uti.hpp"
+#include <string>
+#include <vector>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace utiTest
+{
+	typedef uti::UTF8String< > MapString;
+	typedef uti::StringMap< int > IntMap;
+
+	TEST_CLASS( StringMapTest )
+	{
+	public:
+
+		TEST_METHOD( InsertFindTest )
+		{
+			IntMap map;
+			Assert::IsTrue( map.Empty() );
+			Assert::IsTrue( map.Find( "missing" ) == nullptr );
+
+			MapString shortKey( "GET" );
+			MapString longKey( "Content-Security-Policy-Report-Only" );
+			Assert::IsTrue( longKey.Size() > IntMap::InlineKeyUnits );
+
+			Assert::IsTrue( map.Set( shortKey, 1 ) );
+			Assert::IsTrue( map.Set( longKey, 2 ) );
+			Assert::IsTrue( map.Set( "\xC3\xA4\xE2\x82\xAC", 3 ) );
+			Assert::IsFalse( map.Set( "GET", 4 ), L"Setting an existing key must overwrite its value" );
+			Assert::AreEqual( 3U, map.Size() );
+
+			Assert::AreEqual( 4, *map.Find( shortKey ) );
+			Assert::AreEqual( 2, *map.Find( "Content-Security-Policy-Report-Only" ) );
+			Assert::AreEqual( 3, *map.Find( MapString( "\xC3\xA4\xE2\x82\xAC" ) ) );
+			Assert::IsTrue( map.Find( "Content-Security-Policy-Report-Onl" ) == nullptr );
+			Assert::IsTrue( map.Find( "Content-Security-Policy-Report-OnlY" ) == nullptr );
+			Assert::IsTrue( map.Find( "" ) == nullptr );
+
+			map[ MapString( "" ) ] = 5;
+			++map[ shortKey ];
+			Assert::AreEqual( 5, *map.Find( "" ) );
+			Assert::AreEqual( 5, *map.Find( "GET" ) );
+			Assert::AreEqual( 4U, map.Size() );
+		}
+
+		TEST_METHOD( SpanLookupTest )
+		{
+			IntMap map;
+			map.Set( "Host", 1 );
+			map.Set( "Accept-Encoding-With-A-Long-Name", 2 );
+
+			// Look up views into a larger string without creating a string for them
+			MapString line( "Host: Accept-Encoding-With-A-Long-Name" );
+			const char* data = line.Bytes().begin();
+			Assert::AreEqual( 1, *map.Find( MapString::Span( data, data + 4 ) ) );
+			Assert::AreEqual( 2, *map.Find( MapString::Span( data + 6, line.Bytes().end() ) ) );
+			Assert::IsTrue( map.Find( MapString::Span( data, data + 3 ) ) == nullptr );
+
+			Assert::IsTrue( map.Remove( MapString::Span( data, data + 4 ) ) );
+			Assert::IsTrue( map.Find( "Host" ) == nullptr );
+			Assert::AreEqual( 1U, map.Size() );
+		}
+
+		TEST_METHOD( RemoveGrowTest )
+		{
+			IntMap map;
+			const int count = 10000;
+			for( int i = 0; i < count; ++i )
+			{
+				std::string key = ( i % 2 == 0 ? "k" : "a long key which is not stored inline " ) + std::to_string( i );
+				Assert::IsTrue( map.Set( key.c_str(), i ) );
+			}
+			Assert::AreEqual( static_cast< uti::u32 >( count ), map.Size() );
+
+			for( int i = 0; i < count; i += 3 )
+			{
+				std::string key = ( i % 2 == 0 ? "k" : "a long key which is not stored inline " ) + std::to_string( i );
+				Assert::IsTrue( map.Remove( MapString( key.c_str() ) ) );
+				Assert::IsFalse( map.Remove( MapString( key.c_str() ) ) );
+			}
+
+			// Deleted slots must not end the probing for the remaining keys
+			for( int i = 0; i < count; ++i )
+			{
+				std::string key = ( i % 2 == 0 ? "k" : "a long key which is not stored inline " ) + std::to_string( i );
+				const int* value = map.Find( key.c_str() );
+				if( i % 3 == 0 )
+				{
+					Assert::IsTrue( value == nullptr );
+				}
+				else
+				{
+					Assert::IsNotNull( value );
+					Assert::AreEqual( i, *value );
+				}
+			}
+
+			// Churn on a small set reuses the deleted slots instead of growing without bounds
+			IntMap churn;
+			for( int i = 0; i < 100000; ++i )
+			{
+				std::string key = std::to_string( i );
+				churn.Set( key.c_str(), i );
+				churn.Remove( MapString( key.c_str() ) );
+			}
+			Assert::IsTrue( churn.Empty() );
+
+			map.Clear();
+			Assert::IsTrue( map.Empty() );
+			Assert::IsTrue( map.Find( "k2" ) == nullptr );
+			map.Set( "k2", 2 );
+			Assert::AreEqual( 2, *map.Find( "k2" ) );
+		}
+
+		TEST_METHOD( ValueLifetimeTest )
+		{
+			MapString value( "value string" );
+			{
+				uti::StringMap< MapString > map;
+				for( int i = 0; i < 100; ++i )
+				{
+					map.Set( std::to_string( i ).c_str(), value );
+				}
+				Assert::AreEqual( 101U, value.ReferenceCount() );
+				map.Remove( MapString( "7" ) );
+				Assert::AreEqual( 100U, value.ReferenceCount() );
+
+				int visited = 0;
+				map.ForEach( [ & ]( const MapString::Span& key, const MapString& mapped )
+				{
+					Assert::IsTrue( key.Size() <= 2U );
+					Assert::IsTrue( mapped.SharesData( value ) );
+					++visited;
+				} );
+				Assert::AreEqual( 99, visited );
+			}
+			Assert::AreEqual( 1U, value.ReferenceCount(), L"The map has to destroy its values" );
+
+			// Long keys share the data of the inserted string
+			MapString key( "a key which is too long to be stored inline" );
+			{
+				IntMap map;
+				map.Set( key, 1 );
+				Assert::AreEqual( 2U, key.ReferenceCount() );
+			}
+			Assert::AreEqual( 1U, key.ReferenceCount() );
+		}
+
+		TEST_METHOD( UTF16KeyTest )
+		{
+			typedef uti::UTF16String< > Key16;
+			uti::StringMap< int, Key16 > map;
+			const short shortKey[] = { 'k', 'e', 'y', 0 };
+			const short longKey[] = { 'a', ' ', 'k', 'e', 'y', ' ', 'w', 'i', 't', 'h', ' ', 0x20AC, ' ', 's', 'i', 'g', 'n', 0 };
+			Assert::IsTrue( sizeof( longKey ) / sizeof( short ) - 1U > uti::StringMap< int, Key16 >::InlineKeyUnits );
+
+			map.Set( Key16( shortKey ), 1 );
+			map.Set( longKey, 2 );
+			Assert::AreEqual( 1, *map.Find( shortKey ) );
+			Assert::AreEqual( 2, *map.Find( Key16( longKey ) ) );
+			Key16 shortString( shortKey );
+			Assert::IsTrue( map.Find( shortString.Bytes() ) != nullptr );
+			Assert::IsTrue( map.Find( shortKey + 1 ) == nullptr );
+		}
+	};
+}
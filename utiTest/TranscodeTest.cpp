@@ -0,0 +1,118 @@
+#include "stdafx.h"
+#include "CppUnitTest.h"
+#include "../uti.hpp"
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace utiTest
+{
+	typedef uti::UTF8String< > Transcode8;
+	typedef uti::UTF16String< short > Transcode16LE;
+	typedef uti::UTF16String< short, ::uti::BinaryOrder::BigEndian > Transcode16BE;
+
+	/**
+	\brief Returns the code units in \c text as shorts, swapping them for big endian.
+	*/
+	static std::vector< short > TranscodeUnits( const wchar_t* text, bool bigEndian )
+	{
+		std::vector< short > units;
+		for( ; *text != 0; ++text )
+		{
+			unsigned int unit = static_cast< unsigned int >( *text ) & 0xFFFFU;
+			if( bigEndian )
+			{
+				unit = ( ( unit & 0xFFU ) << 8U ) | ( unit >> 8U );
+			}
+			units.push_back( static_cast< short >( unit ) );
+		}
+		units.push_back( 0 );
+		return units;
+	}
+
+	template< typename String16 >
+	static void CheckTranscode( bool bigEndian )
+	{
+		// Every char size, with ASCII runs long enough for the block conversion
+		const Transcode8 text( "Transcoded K\xC3\xB6ln \xE2\x82\xAC\xEF\xBF\xBD and \xF0\x9F\x98\x80\xF4\x8F\xBF\xBF with a long ASCII tail" );
+		const std::vector< short > units = TranscodeUnits( L"Transcoded K\x00F6ln \x20AC\xFFFD and \xD83D\xDE00\xDBFF\xDFFF with a long ASCII tail", bigEndian );
+
+		String16 utf16 = uti::ToUTF16< String16 >( text );
+		Assert::AreEqual( static_cast< uti::u32 >( ( units.size() - 1U ) * sizeof( short ) ), utf16.Size() );
+		Assert::IsTrue( std::memcmp( units.data(), utf16.c_str(), units.size() * sizeof( short ) ) == 0 );
+		Assert::AreEqual( text.CharCount(), utf16.CharCount() );
+		Assert::IsFalse( utf16.IsAscii() );
+		Assert::IsTrue( uti::Equals( text, utf16 ) );
+
+		Transcode8 utf8 = uti::ToUTF8< Transcode8 >( String16( units.data() ) );
+		Assert::IsTrue( utf8 == text );
+		Assert::AreEqual( text.CharCount(), utf8.CharCount() );
+		Assert::IsFalse( utf8.IsAscii() );
+
+		Transcode8 ascii( "Only ASCII, which is converted block by block" );
+		String16 ascii16 = uti::ToUTF16< String16 >( ascii );
+		Assert::IsTrue( ascii16.IsAscii() );
+		Assert::IsTrue( uti::ToUTF8< Transcode8 >( ascii16 ) == ascii );
+
+		Assert::AreEqual( 0U, uti::ToUTF16< String16 >( Transcode8() ).Size() );
+		Assert::AreEqual( 0U, uti::ToUTF8< Transcode8 >( String16() ).Size() );
+	}
+
+	template< typename String16 >
+	static void CheckParallelTranscode( const std::string& source )
+	{
+		const Transcode8 text( source.c_str() );
+		String16 serial = uti::ToUTF16< String16 >( text, 1U );
+		String16 parallel = uti::ToUTF16< String16 >( text, 4U );
+		Assert::AreEqual( serial.Size(), parallel.Size() );
+		Assert::IsTrue( std::memcmp( serial.c_str(), parallel.c_str(), serial.Size() + sizeof( short ) ) == 0 );
+		Assert::AreEqual( text.CharCount(), parallel.CharCount() );
+		Assert::IsTrue( uti::Equals( text, parallel ) );
+
+		Transcode8 back = uti::ToUTF8< Transcode8 >( parallel, 4U );
+		Assert::AreEqual( text.Size(), back.Size() );
+		Assert::IsTrue( back == text );
+		Assert::AreEqual( text.CharCount(), back.CharCount() );
+	}
+
+	TEST_CLASS( TranscodeTest )
+	{
+	public:
+
+		TEST_METHOD( RoundTripTest )
+		{
+			CheckTranscode< Transcode16LE >( false );
+			CheckTranscode< Transcode16BE >( true );
+
+			// FromWideString converts in one pass into a buffer of the exact size
+			const wchar_t* wide = L"Wide K\x00F6ln \x20AC \xD83D\xDE00 text";
+			Transcode8 utf8 = Transcode8::FromUTF16LE( wide );
+			Assert::IsTrue( utf8 == Transcode8( "Wide K\xC3\xB6ln \xE2\x82\xAC \xF0\x9F\x98\x80 text" ) );
+			Assert::AreEqual( 18U, utf8.CharCount() );
+			Assert::IsTrue( uti::ToUTF16< uti::UTF16String< wchar_t > >( utf8 ) == uti::UTF16String< wchar_t >( wide ) );
+		}
+
+		TEST_METHOD( ParallelTest )
+		{
+			// Dense surrogate pairs and multi byte chars, shifted so chars and pairs straddle every chunk boundary
+			std::string pattern = "ab \xC3\xA4\xE2\x82\xAC\xF0\x9F\x98\x80\xF0\x9F\x98\x81";
+			std::string source;
+			while( source.size() < 5U * uti::transcode::ParallelChunkSize )
+			{
+				source += pattern;
+			}
+			for( uti::u32 shift = 0U; shift < 4U; ++shift )
+			{
+				CheckParallelTranscode< Transcode16LE >( source );
+				CheckParallelTranscode< Transcode16BE >( source );
+				source.insert( 0U, 1U, 'x' );
+			}
+
+			// Pure ASCII skips the size pass, every chunk converts to its own size
+			CheckParallelTranscode< Transcode16LE >( std::string( 3U * uti::transcode::ParallelChunkSize + 5U, 'a' ) );
+			CheckParallelTranscode< Transcode16BE >( std::string( 3U * uti::transcode::ParallelChunkSize + 5U, 'a' ) );
+		}
+	};
+}
@@ -2,6 +2,9 @@
 #include "CppUnitTest.h"
 #include "..\uti.hpp"
 #include <fstream>
+#include <algorithm>
+#include <iterator>
+#include <string>
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 
@@ -225,5 +228,290 @@ namespace utiTest
 
 		}
 
+		TEST_METHOD( AsciiFlagTest )
+		{
+			String ascii( L"Hello World" );
+			String umlaut( L"Hello W\x00F6rld" );
+			String16BE asciiBE( L"\x4800\x6900" );
+
+			Assert::IsTrue( ascii.IsAscii(), L"Pure ASCII string is not flagged as ASCII" );
+			Assert::IsFalse( umlaut.IsAscii(), L"String with non ASCII char is flagged as ASCII" );
+			Assert::IsTrue( asciiBE.IsAscii(), L"Big endian ASCII string is not flagged as ASCII" );
+			Assert::IsFalse( String16BE( L"\x0048" ).IsAscii(), L"Big endian U+4800 is flagged as ASCII" );
+
+			Assert::IsTrue( ( ascii + ascii ).IsAscii(), L"Concat of ASCII strings lost the flag" );
+			Assert::IsFalse( ( ascii + umlaut ).IsAscii(), L"Concat with non ASCII string kept the flag" );
+
+			Assert::AreEqual( 0x57U, ascii.CodePointAt( 6U ) );
+			Assert::AreEqual( 0x69U, asciiBE.CodePointAt( 1U ) );
+			Assert::AreEqual( 0xF6U, umlaut.CodePointAt( 7U ) );
+		}
+
+		TEST_METHOD( CharIteratorOffsetTest )
+		{
+			// Mix of BMP chars and surrogate pairs, long enough to span several blocks
+			String part( L"a\x00E4\xD83D\xDE00\x20AC" );
+			String text = part + part + part + part + part + part + part + part + part + part;
+
+			Assert::AreEqual( 40U, text.CharCount() );
+
+			for( uti::u32 offset = 0U; offset <= text.CharCount(); ++offset )
+			{
+				auto expected = text.CharBegin();
+				for( uti::u32 i = 0U; i < offset; ++i )
+				{
+					++expected;
+				}
+
+				auto it = text.CharBegin();
+				it += offset;
+				Assert::IsTrue( expected == it, L"Moving forward by offset did not match single steps" );
+
+				auto back = text.CharEnd();
+				back -= text.CharCount() - offset;
+				Assert::IsTrue( expected == back, L"Moving backward by offset did not match single steps" );
+			}
+
+			Assert::AreEqual( 0x1F600U, text.CodePointAt( 38U ) );
+		}
+
+		TEST_METHOD( CursorTest )
+		{
+			String text( L"a\x00E4\xD83D\xDE00\x20AC" );
+			const uti::u32 expected [] = { 0x61U, 0xE4U, 0x1F600U, 0x20ACU };
+
+			uti::u32 chars = 0U;
+			for( uti::u32 codePoint : text.Chars() )
+			{
+				Assert::AreEqual( expected[ chars++ ], codePoint );
+			}
+			Assert::AreEqual( text.CharCount(), chars );
+			Assert::AreEqual( 5U, text.Bytes().Size() );
+		}
+
+		TEST_METHOD( StlAlgorithmTest )
+		{
+			String haystack( L"Some Test with a needle in it" );
+			String needle( L"needle" );
+
+			auto found = std::search( haystack.begin(), haystack.end(), needle.begin(), needle.end() );
+			Assert::AreEqual( 17, static_cast< int >( found - haystack.begin() ) );
+
+			String text( L"a\x00E4\xD83D\xDE00\x20AC" );
+			Assert::AreEqual( 4, static_cast< int >( std::distance( text.CharBegin(), text.CharEnd() ) ) );
+			Assert::AreEqual( 4, static_cast< int >( text.CharEnd() - text.CharBegin() ) );
+		}
+
+		TEST_METHOD( EqualityTest )
+		{
+			String original( L"Some longer Text, which spans more than one block \x00E4\x20AC" );
+			String copy( L"Some longer Text, which spans more than one block \x00E4\x20AC" );
+			String changed( L"Some longer Text, which spans more than one block \x00E4\x20AD" );
+			String shared( original );
+
+			Assert::IsTrue( original == copy );
+			Assert::IsTrue( original == shared );
+			Assert::IsFalse( original == changed );
+			Assert::IsTrue( original != changed );
+			Assert::IsFalse( String( L"abc" ) == String( L"abcd" ) );
+		}
+
+		TEST_METHOD( HashTest )
+		{
+			String text( L"Text with \x00E4, \x20AC and \xD83D\xDE00" );
+			String copy( L"Text with \x00E4, \x20AC and \xD83D\xDE00" );
+			String shared( text );
+			uti::UTF8String< > utf8Text( "Text with \xC3\xA4, \xE2\x82\xAC and \xF0\x9F\x98\x80" );
+
+			Assert::IsTrue( text.Hash() == copy.Hash() );
+			Assert::IsTrue( text.Hash() == shared.Hash() );
+			Assert::IsTrue( text.Hash() != utf8Text.Hash() );
+			Assert::IsTrue( text.CodePointHash() == utf8Text.CodePointHash() );
+			Assert::IsTrue( shared.CodePointHash() == utf8Text.CodePointHash() );
+			Assert::IsTrue( std::hash< String >()( text ) == static_cast< size_t >( text.Hash() ) );
+
+			String16BE bigEndian( L"\x5400\x6500\x7800\x7400" );
+			Assert::IsTrue( bigEndian.CodePointHash() == uti::UTF8String< >( "Text" ).CodePointHash() );
+
+			// Long strings are transcoded into a temporary buffer
+			std::wstring longText( 300, L'\x20AC' );
+			std::string longUtf8;
+			for( int i = 0; i < 300; ++i )
+			{
+				longUtf8 += "\xE2\x82\xAC";
+			}
+			Assert::IsTrue( String( longText.c_str() ).CodePointHash() == uti::UTF8String< >( longUtf8.c_str() ).CodePointHash() );
+		}
+
+
+		TEST_METHOD( CompareTest )
+		{
+			Assert::AreEqual( 0, String( L"abc" ).Compare( String( L"abc" ) ) );
+			Assert::IsTrue( String( L"abc" ) < String( L"abd" ) );
+			Assert::IsTrue( String( L"ab" ) < String( L"abc" ) );
+			Assert::IsTrue( String( L"abd" ) >= String( L"abc" ) );
+
+			// U+1F600 is encoded with surrogates below U+FF5E, but its code point is ordered after it
+			String fullwidthTilde( L"x\xFF5E" );
+			String emoji( L"x\xD83D\xDE00" );
+			Assert::IsTrue( fullwidthTilde < emoji );
+			Assert::IsTrue( emoji > fullwidthTilde );
+			Assert::IsTrue( String( L"x\x00E4" ) < emoji );
+			Assert::IsTrue( String( L"x\xD83D\xDE00" ) < String( L"x\xD83D\xDE01" ) );
+
+			// Big endian units are swapped before they are compared
+			String16BE bigEndianTilde( L"\x5EFF" );
+			String16BE bigEndianEmoji( L"\x3DD8\x00DE" );
+			String16BE bigEndianLatin( L"\x0001" );
+			Assert::IsTrue( bigEndianTilde < bigEndianEmoji );
+			Assert::IsTrue( bigEndianLatin < bigEndianTilde, L"U+0100 has to be ordered before U+FF5E" );
+		}
+
+
+		TEST_METHOD( CaseMappingTest )
+		{
+			String street( L"Stra\x00DF" L"e" );
+			String upperStreet = street.ToUpper();
+			Assert::IsTrue( upperStreet == String( L"STRASSE" ) );
+			Assert::AreEqual( 7U, upperStreet.CharCount() );
+			Assert::IsTrue( String( L"\x0130" ).ToLower() == String( L"i\x0307" ) );
+			Assert::IsTrue( String( L"\xD801\xDC00" ).ToLower() == String( L"\xD801\xDC28" ) );
+			Assert::IsTrue( String( L"\x1E9E" ).CaseFold() == String( L"ss" ) );
+
+			String lower( L"lower \x00E4" );
+			Assert::IsTrue( lower.ToLower().SharesData( lower ) );
+
+			// Big endian units are mapped in their byte order
+			String16BE bigEndian( L"\x6100\xE400" );
+			Assert::IsTrue( bigEndian.ToUpper() == String16BE( L"\x4100\xC400" ) );
+		}
+
+
+		TEST_METHOD( GraphemeTest )
+		{
+			String text( L"e\x0301" L"a\xD83D\xDC69\x200D\xD83D\xDCBB\r\n\xD83C\xDDE9\xD83C\xDDEA" );
+			uti::u32 sizes[] = { 2U, 1U, 5U, 2U, 4U };
+			uti::u32 count = 0U;
+			for( auto cluster : text.Graphemes() )
+			{
+				Assert::IsTrue( count < 5U );
+				Assert::AreEqual( sizes[ count ], cluster.Size() );
+				++count;
+			}
+			Assert::AreEqual( 5U, count );
+			Assert::AreEqual( 5U, text.GraphemeCount() );
+
+			String latin( L"Gr\x00FC\x00DF" L"e aus K\x00F6ln und M\x00FCnchen A" L"e\x0301" );
+			Assert::AreEqual( latin.CharCount() - 1U, latin.GraphemeCount() );
+
+			String16BE bigEndian( L"\x6500\x0103\x6100\x0D00\x0A00" );
+			Assert::AreEqual( 3U, bigEndian.GraphemeCount() );
+		}
+
+		TEST_METHOD( SegmentationTest )
+		{
+			String text( L"Can't stop 3.5 \x05E6\x05D4\"\x05DC \x65E5\x672C. Next one! \xD83C\xDDE9\xD83C\xDDEA" L"end" );
+			uti::u32 sizes[] = { 5U, 1U, 4U, 1U, 3U, 1U, 4U, 1U, 1U, 1U, 1U, 1U, 4U, 1U, 3U, 1U, 1U, 4U, 3U };
+			uti::u32 count = 0U;
+			uti::u32 words = 0U;
+			for( auto it = text.Words(); it.Valid(); ++it )
+			{
+				Assert::IsTrue( count < 19U );
+				Assert::AreEqual( sizes[ count ], it.SegmentSize() );
+				words += it.IsWord() ? 1U : 0U;
+				++count;
+			}
+			Assert::AreEqual( 19U, count );
+			Assert::AreEqual( 9U, words );
+
+			uti::u32 sentences[] = { 24U, 10U, 7U };
+			count = 0U;
+			for( auto sentence : text.Sentences() )
+			{
+				Assert::IsTrue( count < 3U );
+				Assert::AreEqual( sentences[ count ], sentence.Size() );
+				++count;
+			}
+			Assert::AreEqual( 3U, count );
+
+			// Long ASCII runs are skipped in blocks of units
+			String latin( L"Abbreviations like e.g. and i.e. are words_with_123 underscores. Fine." );
+			count = 0U;
+			for( auto it = latin.Words(); it.Valid(); ++it )
+			{
+				count += it.IsWord() ? 1U : 0U;
+			}
+			Assert::AreEqual( 9U, count );
+			count = 0U;
+			for( auto it = latin.Sentences(); it.Valid(); ++it )
+			{
+				++count;
+			}
+			Assert::AreEqual( 2U, count );
+
+			String16BE bigEndian( L"\x4100\x2700\x6200\x2000\x3100\x2E00\x3200" );
+			count = 0U;
+			for( auto it = bigEndian.Words(); it.Valid(); ++it )
+			{
+				++count;
+			}
+			Assert::AreEqual( 3U, count );
+		}
+		TEST_METHOD( SplitTest )
+		{
+			// Joins the fields with '|', so the expected fields fit into one literal
+			auto join = []( String::SplitCursor fields ) -> std::wstring
+			{
+				std::wstring result;
+				for( auto it = fields; it.Valid(); ++it )
+				{
+					result += it == fields ? L"" : L"|";
+					result.append( ( *it ).begin(), ( *it ).end() );
+				}
+				return result;
+			};
+
+			String line( L"alpha,beta,,gamma," );
+			Assert::AreEqual( std::wstring( L"alpha|beta||gamma|" ), join( line.Split( L"," ) ) );
+			Assert::AreEqual( std::wstring( L"alpha|beta|gamma" ), join( line.Split( L",", uti::SplitOptions::SkipEmpty ) ) );
+			Assert::AreEqual( std::wstring( L"|gamma|alpha,beta," ), join( line.Split( L",", uti::SplitOptions::Reverse, 2U ) ) );
+			Assert::AreEqual( std::wstring( L"alpha|beta|gamma" ), join( line.SplitAny( L";,", uti::SplitOptions::SkipEmpty ) ) );
+
+			// Surrogate pairs as delimiter and as chars of a char set
+			String emoji( L"a\xD83D\xDE00" L"b\xD83D\xDE01" L"c" );
+			Assert::AreEqual( std::wstring( L"a|b\xD83D\xDE01" L"c" ), join( emoji.Split( L"\xD83D\xDE00" ) ) );
+			Assert::AreEqual( std::wstring( L"c|b|a" ), join( emoji.SplitAny( L"\xD83D\xDE00\xD83D\xDE01", uti::SplitOptions::Reverse ) ) );
+
+			// The bytes of a delimiter spread over two units are no match
+			String shifted( L"\x2C41\x4100" );
+			Assert::AreEqual( std::wstring( L"\x2C41\x4100" ), join( shifted.Split( L"," ) ) );
+
+			// Delimiters are compared as they are stored
+			String16BE bigEndian( L"\x6100\x2C00\x6200\x2C00\x2C00\x6300" );
+			uti::u32 count = 0U;
+			for( auto field : bigEndian.Split( L"\x2C00", uti::SplitOptions::SkipEmpty ) )
+			{
+				Assert::AreEqual( 1U, field.Size() );
+				++count;
+			}
+			Assert::AreEqual( 3U, count );
+			count = 0U;
+			for( auto it = bigEndian.SplitAny( L"\x2C00", uti::SplitOptions::Reverse ); it.Valid(); ++it )
+			{
+				++count;
+			}
+			Assert::AreEqual( 4U, count );
+
+			// Delimiters are found in blocks of units, the fields around the block boundaries have to be exact
+			for( uti::u32 offset = 1U; offset < 24U; ++offset )
+			{
+				String text( ( std::wstring( offset, L'a' ) + L"::" + std::wstring( 10U, L'b' ) + L":" + std::wstring( 9U, L'c' ) + L"::d" ).c_str() );
+				std::wstring expected = std::wstring( offset, L'a' ) + L"|" + std::wstring( 10U, L'b' ) + L":" + std::wstring( 9U, L'c' ) + L"|d";
+				Assert::AreEqual( expected, join( text.Split( L"::" ) ) );
+				expected = L"d|" + std::wstring( 9U, L'c' ) + L"|" + std::wstring( 10U, L'b' ) + L"|" + std::wstring( offset, L'a' );
+				Assert::AreEqual( expected, join( text.SplitAny( L":", uti::SplitOptions::SkipEmpty | uti::SplitOptions::Reverse ) ) );
+			}
+		}
+
 	};
 }
@@ -0,0 +1,149 @@
+#include "stdafx.h"
+#include "CppUnitTest.h"
+#include "../uti.hpp"
+#include <string>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace utiTest
+{
+	typedef uti::UTF8String< > StreamString;
+	typedef uti::UTF8StreamValidator< StreamString > Validator;
+	typedef uti::UTF8StreamDecoder< StreamString > Decoder;
+
+	TEST_CLASS( UTF8StreamTest )
+	{
+	public:
+
+		TEST_METHOD( ChunkTest )
+		{
+			// Every char size, with ASCII runs long enough to be skipped a block at a time
+			const std::string text = "Stream \xC3\xA4\xC3\xB6 \xE2\x82\xAC\xED\x9F\xBF and \xF0\x9F\x98\x80\xF4\x8F\xBF\xBF with some more ASCII text";
+			const uti::u32 size = static_cast< uti::u32 >( text.size() );
+			const uti::u64 charCount = StreamString::CountChars( text.c_str(), size );
+
+			// Three chunks split at every pair of offsets, so every char is cut at every byte
+			for( uti::u32 first = 0U; first <= size; ++first )
+			{
+				for( uti::u32 second = first; second <= size; ++second )
+				{
+					Validator validator;
+					Assert::IsTrue( validator.Feed( text.c_str(), first ) );
+					Assert::IsTrue( validator.Feed( text.c_str() + first, second - first ) );
+					Assert::IsTrue( validator.Feed( text.c_str() + second, size - second ) );
+					Assert::IsTrue( validator.Finish() );
+					Assert::AreEqual( charCount, validator.CharCount() );
+					Assert::AreEqual( static_cast< uti::u64 >( size ), validator.CompleteSize() );
+				}
+			}
+
+			// A char which is still incomplete is not counted yet
+			Validator validator;
+			Assert::IsTrue( validator.Feed( "ab\xF0\x9F", 4U ) );
+			Assert::AreEqual( static_cast< uti::u64 >( 2U ), validator.CharCount() );
+			Assert::AreEqual( static_cast< uti::u64 >( 2U ), validator.CompleteSize() );
+			Assert::IsTrue( validator.Feed( "\x98", 1U ) );
+			Assert::IsTrue( validator.Feed( "\x80", 1U ) );
+			Assert::AreEqual( static_cast< uti::u64 >( 3U ), validator.CharCount() );
+			Assert::IsTrue( validator.Finish() );
+		}
+
+		TEST_METHOD( ErrorTest )
+		{
+			Validator invalid;
+			Assert::IsFalse( invalid.Feed( "ab\xC3\x28", 4U ) );
+			Assert::AreEqual( static_cast< uti::u64 >( 2U ), invalid.ErrorOffset() );
+			Assert::AreEqual( static_cast< uti::u64 >( 2U ), invalid.CharCount() );
+			// The error stays, even if the next chunk is fine
+			Assert::IsFalse( invalid.Feed( "cd", 2U ) );
+			Assert::IsFalse( invalid.Finish() );
+			Assert::AreEqual( static_cast< uti::u64 >( 2U ), invalid.ErrorOffset() );
+
+			// The error offset is the start of the char in an earlier chunk, it is found as soon as the bytes can not be completed
+			Validator overlong;
+			Assert::IsTrue( overlong.Feed( "abc\xE0", 4U ) );
+			Assert::IsFalse( overlong.Feed( "\x80", 1U ) );
+			Assert::AreEqual( static_cast< uti::u64 >( 3U ), overlong.ErrorOffset() );
+
+			Validator surrogate;
+			Assert::IsTrue( surrogate.Feed( "a", 1U ) );
+			Assert::IsTrue( surrogate.Feed( "\xED", 1U ) );
+			Assert::IsFalse( surrogate.Feed( "\xA0\x80", 2U ) );
+			Assert::AreEqual( static_cast< uti::u64 >( 1U ), surrogate.ErrorOffset() );
+
+			Validator interrupted;
+			Assert::IsTrue( interrupted.Feed( "abc\xF0\x90", 5U ) );
+			Assert::IsFalse( interrupted.Feed( "\x41", 1U ) );
+			Assert::AreEqual( static_cast< uti::u64 >( 3U ), interrupted.ErrorOffset() );
+
+			// Offsets are counted over every chunk
+			Validator late;
+			std::string ascii( 1000U, 'x' );
+			for( uti::u32 i = 0U; i < 10U; ++i )
+			{
+				Assert::IsTrue( late.Feed( ascii.c_str(), 100U ) );
+			}
+			Assert::IsFalse( late.Feed( "ab\xFF", 3U ) );
+			Assert::AreEqual( static_cast< uti::u64 >( 1002U ), late.ErrorOffset() );
+
+			// The stream ends inside of a char
+			Validator truncated;
+			Assert::IsTrue( truncated.Feed( "ab\xE2\x82", 4U ) );
+			Assert::IsFalse( truncated.Finish() );
+			Assert::AreEqual( static_cast< uti::u64 >( 2U ), truncated.ErrorOffset() );
+			truncated.Reset();
+			Assert::IsTrue( truncated.Feed( "ok", 2U ) );
+			Assert::IsTrue( truncated.Finish() );
+		}
+
+		TEST_METHOD( DecoderTest )
+		{
+			const std::string text = "Decoded K\xC3\xB6ln \xE2\x82\xAC \xF0\x9F\x98\x80 in small chunks, which cut the chars";
+			const StreamString expected( text.c_str() );
+			Decoder decoder;
+			for( uti::u32 chunk = 1U; chunk < 8U; ++chunk )
+			{
+				for( uti::u32 pos = 0U; pos < text.size(); pos += chunk )
+				{
+					uti::u32 size = static_cast< uti::u32 >( text.size() ) - pos < chunk ? static_cast< uti::u32 >( text.size() ) - pos : chunk;
+					Assert::IsTrue( decoder.Append( text.c_str() + pos, size ) );
+				}
+				StreamString result;
+				Assert::IsTrue( decoder.Finish( result ) );
+				Assert::IsTrue( result == expected );
+				Assert::AreEqual( expected.CharCount(), result.CharCount() );
+				Assert::AreEqual( 0U, decoder.Size() );
+			}
+
+			// The bytes from the invalid char on are dropped, also if they were appended with an earlier chunk
+			Decoder invalid( 16U );
+			Assert::IsTrue( invalid.Append( "abc\xE2\x82", 5U ) );
+			Assert::AreEqual( 5U, invalid.Size() );
+			Assert::IsFalse( invalid.Append( "def", 3U ) );
+			Assert::AreEqual( 3U, invalid.Size() );
+			Assert::IsFalse( invalid.Append( "ghi", 3U ) );
+			StreamString result;
+			Assert::IsFalse( invalid.Finish( result ) );
+			Assert::IsTrue( result == StreamString( "abc" ) );
+			Assert::AreEqual( static_cast< uti::u64 >( 3U ), invalid.Validator().ErrorOffset() );
+
+			// An incomplete char at the end is dropped as well, and an empty stream gives an empty string
+			Assert::IsTrue( invalid.Append( "\xC3\xA4\xC3", 3U ) );
+			Assert::IsFalse( invalid.Finish( result ) );
+			Assert::IsTrue( result == StreamString( "\xC3\xA4" ) );
+			Assert::IsFalse( invalid.Validator().Valid() );
+			Assert::AreEqual( static_cast< uti::u64 >( 2U ), invalid.Validator().ErrorOffset() );
+			Assert::IsTrue( invalid.Finish( result ) );
+			Assert::IsTrue( result.Size() == 0U );
+			Assert::IsTrue( invalid.Validator().Valid() );
+
+			// Reset drops a truncated stream, the next one starts from offset 0
+			Assert::IsTrue( invalid.Append( "xy\xE2\x82", 4U ) );
+			invalid.Reset();
+			Assert::AreEqual( 0U, invalid.Size() );
+			Assert::IsTrue( invalid.Append( "z", 1U ) );
+			Assert::IsTrue( invalid.Finish( result ) );
+			Assert::IsTrue( result == StreamString( "z" ) );
+		}
+	};
+}
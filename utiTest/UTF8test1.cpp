@@ -10,6 +10,15 @@
 #define FAIL_ON_NO_ASSERT Assert::IsTrue(AssertTriggered)
 
 #include <fstream>
+#include <algorithm>
+#include <iterator>
+#include <unordered_set>
+#include <thread>
+#if ( defined( _MSVC_LANG ) && _MSVC_LANG >= 201703L ) || __cplusplus >= 201703L
+#include <functional>
+#include <execution>
+#define UTI_TEST_CPP17 1
+#endif // C++17
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 
@@ -350,5 +359,815 @@ namespace utiTest
 
 		}
 
+		TEST_METHOD( AsciiFlagTest )
+		{
+			String ascii( "Hello World" );
+			String umlaut( "Hello W\xC3\xB6rld" );
+
+			Assert::IsTrue( ascii.IsAscii(), L"Pure ASCII string is not flagged as ASCII" );
+			Assert::IsFalse( umlaut.IsAscii(), L"String with multi byte char is flagged as ASCII" );
+			Assert::IsTrue( String().IsAscii(), L"Empty string is not flagged as ASCII" );
+
+			Assert::IsTrue( ( ascii + ascii ).IsAscii(), L"Concat of ASCII strings lost the flag" );
+			Assert::IsFalse( ( ascii + umlaut ).IsAscii(), L"Concat with non ASCII string kept the flag" );
+			Assert::IsTrue( String::FromUTF16LE( L"Hello" ).IsAscii(), L"Converted ASCII string is not flagged as ASCII" );
+
+			String sub = ascii.Substr( 6U, 11U );
+			Assert::IsTrue( sub.IsAscii(), L"Substring of ASCII string lost the flag" );
+			Assert::AreEqual( String( "World" ), sub );
+
+			// Non ASCII strings still seek by char and not by byte
+			String umlautSub = umlaut.Substr( 7U, 9U );
+			Assert::AreEqual( 2U, umlautSub.CharCount() );
+			Assert::AreEqual( 3U, umlautSub.Size() );
+			Assert::IsFalse( umlautSub.IsAscii() );
+			Assert::IsTrue( umlaut.Substr( 0U, 5U ).IsAscii(), L"ASCII only substring of non ASCII string is not flagged" );
+
+			Assert::AreEqual( 0x57U, ascii.CodePointAt( 6U ) );
+			Assert::AreEqual( 0xF6U, umlaut.CodePointAt( 7U ) );
+			Assert::AreEqual( 0x72U, umlaut.CodePointAt( 8U ) );
+
+			unsigned int iterations = 0;
+			for( auto it = ascii.rCharBegin(); it != ascii.rCharEnd(); ++it, ++iterations )
+			{
+			}
+			Assert::AreEqual( ascii.CharCount(), iterations );
+		}
+
+		TEST_METHOD( CharIteratorOffsetTest )
+		{
+			// Mix of 1, 2, 3 and 4 byte chars, long enough to span several blocks
+			String part( "a\xC3\xA4\xE2\x82\xAC\xF0\x9F\x98\x80" );
+			String text = part + part + part + part + part + part + part + part + part + part;
+
+			Assert::IsFalse( text.IsAscii() );
+			Assert::AreEqual( 40U, text.CharCount() );
+
+			for( uti::u32 offset = 0U; offset <= text.CharCount(); ++offset )
+			{
+				auto expected = text.CharBegin();
+				for( uti::u32 i = 0U; i < offset; ++i )
+				{
+					++expected;
+				}
+
+				auto it = text.CharBegin();
+				it += offset;
+				Assert::IsTrue( expected == it, L"Moving forward by offset did not match single steps" );
+
+				auto back = text.CharEnd();
+				back -= text.CharCount() - offset;
+				Assert::IsTrue( expected == back, L"Moving backward by offset did not match single steps" );
+			}
+
+			auto it = text.CharEnd();
+			it += 5;
+			Assert::IsTrue( it == text.CharEnd(), L"Moving beyond the end did not clamp to the end" );
+
+			Assert::AreEqual( 0x1F600U, text.CodePointAt( 39U ) );
+			Assert::AreEqual( 0x20ACU, text.CodePointAt( 22U ) );
+
+			uti::u32 iterations = 0U;
+			for( auto rit = text.rCharBegin(); rit != text.rCharEnd(); ++rit, ++iterations )
+			{
+			}
+			Assert::AreEqual( text.CharCount(), iterations );
+		}
+
+		TEST_METHOD( CursorTest )
+		{
+			String text( "a\xC3\xA4\xE2\x82\xAC\xF0\x9F\x98\x80" );
+			const uti::u32 expected [] = { 0x61U, 0xE4U, 0x20ACU, 0x1F600U };
+
+			uti::u32 chars = 0U;
+			for( uti::u32 codePoint : text.Chars() )
+			{
+				Assert::AreEqual( expected[ chars++ ], codePoint );
+			}
+			Assert::AreEqual( text.CharCount(), chars );
+
+			uti::u32 bytes = 0U;
+			auto it = text.Begin();
+			for( char byte : text.Bytes() )
+			{
+				Assert::AreEqual( *it, byte );
+				++it;
+				++bytes;
+			}
+			Assert::AreEqual( text.Size(), bytes );
+
+			String ascii( "Some Test" );
+			String::Span span = ascii.Bytes().SubSpan( 5U, 4U );
+			Assert::IsTrue( span.IsAscii(), L"Sub span lost the ASCII flag" );
+			Assert::AreEqual( 4U, span.Size() );
+			Assert::AreEqual( 'T', *span.begin() );
+
+			String empty;
+			Assert::IsTrue( empty.Bytes().Empty() );
+			Assert::IsFalse( String().Chars().Valid() );
+		}
+
+		TEST_METHOD( StlAlgorithmTest )
+		{
+			String haystack( "Some Test with a needle in it" );
+			String needle( "needle" );
+
+			auto found = std::search( haystack.begin(), haystack.end(), needle.begin(), needle.end() );
+			Assert::AreEqual( 17, static_cast< int >( found - haystack.begin() ) );
+			Assert::AreEqual( 29, static_cast< int >( std::distance( haystack.begin(), haystack.end() ) ) );
+			Assert::AreEqual( 'n', haystack.begin()[ 17 ] );
+
+			String other( "Some Text with a needle in it" );
+			auto mismatch = std::mismatch( haystack.begin(), haystack.end(), other.begin() );
+			Assert::AreEqual( 7, static_cast< int >( mismatch.first - haystack.begin() ) );
+
+			auto last = std::find( haystack.rBegin(), haystack.rEnd(), 'e' );
+			Assert::AreEqual( 6, static_cast< int >( last - haystack.rBegin() ) );
+
+			String text( "a\xC3\xA4\xE2\x82\xAC\xF0\x9F\x98\x80" );
+			Assert::AreEqual( 4, static_cast< int >( std::distance( text.CharBegin(), text.CharEnd() ) ) );
+			Assert::AreEqual( 4, static_cast< int >( text.CharEnd() - text.CharBegin() ) );
+			Assert::AreEqual( -2, static_cast< int >( text.CharBegin() - ( text.CharBegin() + 2 ) ) );
+			auto euro = std::find_if( text.CharBegin(), text.CharEnd(), []( const char* c ) { return String::ExtractCodePoint( c ) == 0x20ACU; } );
+			Assert::AreEqual( 2, static_cast< int >( std::distance( text.CharBegin(), euro ) ) );
+
+#ifdef UTI_TEST_CPP17
+			auto searched = std::search( haystack.begin(), haystack.end(), std::boyer_moore_horspool_searcher< String::Iterator >( needle.begin(), needle.end() ) );
+			Assert::IsTrue( searched == found );
+
+			auto parallelFound = std::search( std::execution::par_unseq, haystack.begin(), haystack.end(), needle.begin(), needle.end() );
+			Assert::IsTrue( parallelFound == found );
+			Assert::AreEqual( 5, static_cast< int >( std::count( std::execution::par_unseq, haystack.begin(), haystack.end(), 'e' ) ) );
+#endif // UTI_TEST_CPP17
+		}
+
+		TEST_METHOD( EqualityTest )
+		{
+			char buffer[ 81 ];
+			for( int length = 0; length <= 80; ++length )
+			{
+				for( int i = 0; i < length; ++i )
+				{
+					buffer[ i ] = static_cast< char >( 'a' + i % 26 );
+				}
+				buffer[ length ] = 0;
+
+				String original( buffer );
+				String copy( buffer );
+				String shared( original );
+				Assert::IsTrue( original == copy );
+				Assert::IsFalse( original != copy );
+				Assert::IsTrue( original == shared );
+
+				// A difference at every position has to be found, regardless of the block it falls into
+				for( int i = 0; i < length; ++i )
+				{
+					buffer[ i ] = 'A';
+					String changed( buffer );
+					Assert::IsFalse( original == changed );
+					Assert::IsTrue( original != changed );
+					buffer[ i ] = static_cast< char >( 'a' + i % 26 );
+				}
+			}
+
+			// Same byte size, but a different number of chars
+			Assert::IsFalse( String( "\xC3\xA4\xC3\xA4" ) == String( "ab\xE2\x82\xAC" ) );
+			Assert::IsFalse( String( "abc" ) == String( "abcd" ) );
+		}
+
+		TEST_METHOD( HashTest )
+		{
+			String text( "Some Text with \xC3\xA4 and \xE2\x82\xAC" );
+			String copy( "Some Text with \xC3\xA4 and \xE2\x82\xAC" );
+			String shared( text );
+
+			Assert::IsTrue( text.Hash() == copy.Hash() );
+			Assert::IsTrue( text.Hash() == shared.Hash() );
+			Assert::IsTrue( text.Hash() == uti::HashBytes( text.Data(), text.Size() ) );
+			Assert::IsTrue( text.Hash( 1U ) != text.Hash( 2U ) );
+			Assert::IsTrue( text.CodePointHash() == text.Hash() );
+			Assert::IsTrue( std::hash< String >()( text ) == static_cast< size_t >( text.Hash() ) );
+
+			// Every length takes a different path through the hash, all prefixes have to be told apart
+			std::unordered_set< String > prefixes;
+			char buffer[ 201 ];
+			for( int length = 0; length <= 200; ++length )
+			{
+				buffer[ length ] = 0;
+				prefixes.insert( String( buffer ) );
+				buffer[ length ] = static_cast< char >( 'a' + length % 26 );
+			}
+			Assert::AreEqual( 201U, static_cast< uti::u32 >( prefixes.size() ) );
+			Assert::IsTrue( prefixes.count( String( "abcdefghij" ) ) == 1U );
+			Assert::IsTrue( prefixes.count( String( "abcdefghik" ) ) == 0U );
+
+			// Equality uses the cached hashes to reject strings
+			String other( "Some Text with \xC3\xA4 and \xE2\x82\xAD" );
+			other.Hash();
+			Assert::IsFalse( text == other );
+
+			// Threads sharing a buffer cache its hash concurrently and all read the same value
+			typedef uti::UTF8String< char, uti::DefaultAllocator, uti::AtomicRefCountPolicy > SharedString;
+			SharedString sharedText( "Some Text with \xC3\xA4 and \xE2\x82\xAC" );
+			uti::u64 hashes[ 4 ];
+			std::thread threads[ 4 ];
+			for( int t = 0; t < 4; ++t )
+			{
+				threads[ t ] = std::thread( [ &, t ]()
+				{
+					SharedString local( sharedText );
+					hashes[ t ] = local.Hash();
+					Assert::IsTrue( local == sharedText );
+				} );
+			}
+			for( int t = 0; t < 4; ++t )
+			{
+				threads[ t ].join();
+				Assert::IsTrue( hashes[ t ] == text.Hash() );
+			}
+		}
+
+
+		TEST_METHOD( CompareTest )
+		{
+			Assert::AreEqual( 0, String( "abc" ).Compare( String( "abc" ) ) );
+			Assert::IsTrue( String( "abc" ).Compare( String( "abd" ) ) < 0 );
+			Assert::IsTrue( String( "abd" ).Compare( String( "abc" ) ) > 0 );
+			Assert::IsTrue( String( "ab" ) < String( "abc" ), L"A prefix is ordered first" );
+			Assert::IsTrue( String( "" ) < String( "a" ) );
+			Assert::IsTrue( String( "abc" ) <= String( "abc" ) );
+			Assert::IsTrue( String( "abc" ) >= String( "abc" ) );
+			Assert::IsFalse( String( "abc" ) > String( "abc" ) );
+
+			// Code point order: U+007F < U+00E4 < U+FFFF < U+1F600, regardless of signed chars
+			Assert::IsTrue( String( "\x7F" ) < String( "\xC3\xA4" ) );
+			Assert::IsTrue( String( "\xC3\xA4" ) < String( "\xEF\xBF\xBF" ) );
+			Assert::IsTrue( String( "\xEF\xBF\xBF" ) < String( "\xF0\x9F\x98\x80" ) );
+
+			// The difference has to be found in every block position
+			char buffer[ 81 ];
+			for( int length = 1; length <= 80; ++length )
+			{
+				for( int i = 0; i < length; ++i )
+				{
+					buffer[ i ] = static_cast< char >( 'a' + i % 26 );
+				}
+				buffer[ length ] = 0;
+				String original( buffer );
+				for( int i = 0; i < length; ++i )
+				{
+					buffer[ i ] = 'A';
+					String smaller( buffer );
+					buffer[ i ] = '~';
+					String larger( buffer );
+					buffer[ i ] = static_cast< char >( 'a' + i % 26 );
+					Assert::IsTrue( smaller < original );
+					Assert::IsTrue( larger > original );
+					Assert::IsTrue( smaller.Compare( larger ) < 0 );
+				}
+			}
+		}
+
+
+		TEST_METHOD( IgnoreAsciiCaseTest )
+		{
+			String lower( "content-type: text/html; charset=\xC3\xA4" );
+			String mixed( "Content-Type: TEXT/html; Charset=\xC3\xA4" );
+			String other( "Content-Type: TEXT/html; Charset=\xC3\x84" );
+
+			Assert::IsTrue( lower.EqualsIgnoreAsciiCase( mixed ) );
+			Assert::IsFalse( lower == mixed );
+			Assert::AreEqual( 0, lower.CompareIgnoreAsciiCase( mixed ) );
+			Assert::IsTrue( lower.HashIgnoreAsciiCase() == mixed.HashIgnoreAsciiCase() );
+			Assert::IsTrue( lower.HashIgnoreAsciiCase() == lower.Hash(), L"The hash has to be the hash of the lower case bytes" );
+
+			// Only ASCII letters are folded: \xC3\xA4 and \xC3\x84 stay different, as do '@' / '`' and '[' / '{'
+			Assert::IsFalse( lower.EqualsIgnoreAsciiCase( other ) );
+			Assert::IsTrue( lower.CompareIgnoreAsciiCase( other ) > 0 );
+			Assert::IsTrue( lower.HashIgnoreAsciiCase() != other.HashIgnoreAsciiCase() );
+			Assert::IsFalse( String( "@[" ).EqualsIgnoreAsciiCase( String( "`{" ) ) );
+			Assert::IsTrue( String( "abc" ).CompareIgnoreAsciiCase( String( "ABD" ) ) < 0 );
+			Assert::IsTrue( String( "ab" ).CompareIgnoreAsciiCase( String( "ABC" ) ) < 0 );
+			Assert::IsTrue( String( "_" ).CompareIgnoreAsciiCase( String( "A" ) ) < 0, L"'A' has to be compared as 'a'" );
+
+			// Every block position and every hash size path
+			char upper[ 81 ];
+			char folded[ 81 ];
+			for( int length = 0; length <= 80; ++length )
+			{
+				for( int i = 0; i < length; ++i )
+				{
+					folded[ i ] = static_cast< char >( 'a' + i % 26 );
+					upper[ i ] = static_cast< char >( i % 3 == 0 ? 'A' + i % 26 : 'a' + i % 26 );
+				}
+				folded[ length ] = 0;
+				upper[ length ] = 0;
+				String foldedString( folded );
+				String upperString( upper );
+				Assert::IsTrue( foldedString.EqualsIgnoreAsciiCase( upperString ) );
+				Assert::IsTrue( foldedString.HashIgnoreAsciiCase() == upperString.HashIgnoreAsciiCase() );
+				Assert::IsTrue( uti::HashBytesIgnoreAsciiCase( upper, length ) == uti::HashBytes( folded, length ) );
+				for( int i = 0; i < length; ++i )
+				{
+					upper[ i ] = '#';
+					Assert::IsFalse( foldedString.EqualsIgnoreAsciiCase( String( upper ) ) );
+					upper[ i ] = static_cast< char >( 'a' + i % 26 );
+				}
+			}
+
+			// Views into larger strings
+			String request( "GET / HTTP/1.1 HOST: example.org" );
+			String::Span host = request.Bytes().SubSpan( 15U, 4U );
+			String upperHost( "Host" );
+			String lowerHost( "host" );
+			Assert::IsTrue( host.EqualsIgnoreAsciiCase( upperHost.Bytes() ) );
+			Assert::AreEqual( 0, host.CompareIgnoreAsciiCase( lowerHost.Bytes() ) );
+			Assert::IsTrue( host.HashIgnoreAsciiCase() == String( "host" ).Hash() );
+		}
+
+
+		TEST_METHOD( CaseMappingTest )
+		{
+			// Full mappings change the size and the char count
+			String street( "Stra\xC3\x9F" "e" );
+			String upperStreet = street.ToUpper();
+			Assert::IsTrue( upperStreet == String( "STRASSE" ) );
+			Assert::AreEqual( 7U, upperStreet.CharCount() );
+			Assert::IsTrue( upperStreet.IsAscii() );
+			Assert::IsTrue( street == String( "Stra\xC3\x9F" "e" ), L"ToUpper must not change the string" );
+			Assert::IsTrue( String( "\xC4\xB0" ).ToLower() == String( "i\xCC\x87" ) );
+			Assert::IsTrue( String( "\xEF\xAC\x83" ).ToUpper() == String( "FFI" ) );
+			Assert::IsTrue( String( "\xE1\xBA\x9E" ).CaseFold() == String( "ss" ) );
+			Assert::IsTrue( street.CaseFold() == String( "STRASSE" ).CaseFold() );
+
+			// Other scripts and code points above U+FFFF
+			Assert::IsTrue( String( "\xCE\xA3\xCE\x91\xCE\xA3" ).ToLower() == String( "\xCF\x83\xCE\xB1\xCF\x83" ) );
+			Assert::IsTrue( String( "\xD0\x9C\xD0\xBE\xD1\x81\xD0\xBA\xD0\xB2\xD0\xB0" ).ToUpper() == String( "\xD0\x9C\xD0\x9E\xD0\xA1\xD0\x9A\xD0\x92\xD0\x90" ) );
+			Assert::IsTrue( String( "\xF0\x90\x90\x80" ).ToLower() == String( "\xF0\x90\x90\xA8" ) );
+			Assert::IsTrue( String( "\xE2\x84\xAA" ).ToLower() == String( "k" ), L"The Kelvin sign lowers to ASCII" );
+			Assert::IsTrue( String( "\xE2\x84\xAA" ).ToLower().IsAscii() );
+
+			// ASCII blocks and the tail
+			String ascii( "The Quick Brown Fox Jumps Over The Lazy Dog, 0123456789 [@`{]" );
+			Assert::IsTrue( ascii.ToUpper() == String( "THE QUICK BROWN FOX JUMPS OVER THE LAZY DOG, 0123456789 [@`{]" ) );
+			Assert::IsTrue( ascii.ToLower() == String( "the quick brown fox jumps over the lazy dog, 0123456789 [@`{]" ) );
+
+			// Unchanged strings keep their data
+			String lower( "already lower case \xC3\xA4 text" );
+			Assert::IsTrue( lower.ToLower().SharesData( lower ) );
+			Assert::IsTrue( lower.CaseFold().SharesData( lower ) );
+
+			// Unshared data of the same size is converted in place, the cached hash is dropped
+			String unique( "M\xC3\xBCnchen Stra\xC3\x9F" "e" );
+			const char* data = unique.Data();
+			unique.Hash();
+			unique.MakeUpper();
+			Assert::IsTrue( unique.Data() == data );
+			Assert::IsTrue( unique == String( "M\xC3\x9CNCHEN STRASSE" ) );
+			Assert::IsTrue( unique.Hash() == uti::HashBytes( unique.Data(), unique.Size() ) );
+			Assert::AreEqual( 15U, unique.CharCount() );
+
+			// Shared data is never changed
+			String shared( "shared" );
+			String copy( shared );
+			copy.MakeUpper();
+			Assert::IsTrue( shared == String( "shared" ) );
+			Assert::IsTrue( copy == String( "SHARED" ) );
+		}
+
+
+		TEST_METHOD( NormalizationTest )
+		{
+			typedef uti::unicode::NormalizationForm Form;
+
+			// Composition and decomposition, "é" and "e" + U+0301
+			String composed( "caf\xC3\xA9" );
+			String decomposed( "cafe\xCC\x81" );
+			Assert::IsTrue( decomposed.Normalize( Form::NFC ) == composed );
+			Assert::AreEqual( 4U, decomposed.Normalize( Form::NFC ).CharCount() );
+			Assert::IsTrue( composed.Normalize( Form::NFD ) == decomposed );
+			Assert::AreEqual( 5U, composed.Normalize( Form::NFD ).CharCount() );
+			Assert::IsTrue( composed.IsNormalized( Form::NFC ) );
+			Assert::IsFalse( composed.IsNormalized( Form::NFD ) );
+			Assert::IsFalse( decomposed.IsNormalized( Form::NFC ) );
+
+			// Normalized strings share their data
+			Assert::IsTrue( composed.Normalize( Form::NFC ).SharesData( composed ) );
+			Assert::IsTrue( decomposed.Normalize( Form::NFD ).SharesData( decomposed ) );
+			String ascii( "Only ASCII text is normalized in every form, no matter how long it is." );
+			Assert::IsTrue( ascii.Normalize( Form::NFKD ).SharesData( ascii ) );
+
+			// Combining marks are put into canonical order: dot below ( 220 ) before dot above ( 230 )
+			Assert::IsTrue( String( "a\xCC\x87\xCC\xA3" ).Normalize( Form::NFD ) == String( "a\xCC\xA3\xCC\x87" ) );
+			Assert::IsTrue( String( "a\xCC\x87\xCC\xA3" ).Normalize( Form::NFC ) == String( "\xE1\xBA\xA1\xCC\x87" ) );
+
+			// A combining mark at the start has nothing to compose with
+			Assert::IsTrue( String( "\xCC\x81" "e" ).Normalize( Form::NFC ) == String( "\xCC\x81" "e" ) );
+
+			// Singletons and composition exclusions, the Ohm sign and U+0958
+			Assert::IsTrue( String( "\xE2\x84\xA6" ).Normalize( Form::NFC ) == String( "\xCE\xA9" ) );
+			Assert::IsTrue( String( "\xE0\xA5\x98" ).Normalize( Form::NFC ) == String( "\xE0\xA4\x95\xE0\xA4\xBC" ) );
+
+			// Hangul syllables are decomposed and composed algorithmically
+			String syllable( "\xEA\xB0\x81" );
+			String jamo( "\xE1\x84\x80\xE1\x85\xA1\xE1\x86\xA8" );
+			Assert::IsTrue( syllable.Normalize( Form::NFD ) == jamo );
+			Assert::IsTrue( jamo.Normalize( Form::NFC ) == syllable );
+
+			// Compatibility forms, the "fi" ligature and fullwidth letters, which may leave only ASCII behind
+			String ligature( "\xEF\xAC\x81" "ne \xEF\xBC\xA1" );
+			Assert::IsTrue( ligature.Normalize( Form::NFC ).SharesData( ligature ) );
+			String folded = ligature.Normalize( Form::NFKC );
+			Assert::IsTrue( folded == String( "fine A" ) );
+			Assert::AreEqual( 6U, folded.CharCount() );
+			Assert::IsTrue( folded.IsAscii() );
+
+			// Only the spans around unnormalized chars change, long text around them is copied
+			String text( "A long line of Latin-1 text with \xC3\xBC, \xC3\xB6 and \xC3\xA4 around an e\xCC\x81 and more text behind it, \xC3\x9F" );
+			String expected( "A long line of Latin-1 text with \xC3\xBC, \xC3\xB6 and \xC3\xA4 around an \xC3\xA9 and more text behind it, \xC3\x9F" );
+			String normalized = text.Normalize( Form::NFC );
+			Assert::IsTrue( normalized == expected );
+			Assert::AreEqual( expected.CharCount(), normalized.CharCount() );
+			Assert::IsTrue( expected.Normalize( Form::NFC ).SharesData( expected ) );
+
+			text.MakeNormalized( Form::NFC );
+			Assert::IsTrue( text == expected );
+			Assert::IsTrue( text.Hash() == expected.Hash() );
+		}
+
+
+		TEST_METHOD( GraphemeTest )
+		{
+			// Combining marks, Hangul jamo, CR LF, an emoji ZWJ sequence, flags and a skin tone modifier
+			String text( "e\xCC\x81" "a\xE1\x84\x80\xE1\x85\xA1\xE1\x86\xA8\r\n"
+				"\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x92\xBB"
+				"\xF0\x9F\x87\xA9\xF0\x9F\x87\xAA\xF0\x9F\x87\xAB"
+				"\xF0\x9F\x91\x8D\xF0\x9F\x8F\xBD" );
+			const char* expected[] = { "e\xCC\x81", "a", "\xE1\x84\x80\xE1\x85\xA1\xE1\x86\xA8", "\r\n",
+				"\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x92\xBB", "\xF0\x9F\x87\xA9\xF0\x9F\x87\xAA", "\xF0\x9F\x87\xAB",
+				"\xF0\x9F\x91\x8D\xF0\x9F\x8F\xBD" };
+
+			uti::u32 count = 0U;
+			for( auto cluster : text.Graphemes() )
+			{
+				Assert::IsTrue( count < 8U );
+				Assert::AreEqual( static_cast< uti::u32 >( strlen( expected[ count ] ) ), cluster.Size() );
+				Assert::IsTrue( memcmp( cluster.begin(), expected[ count ], cluster.Size() ) == 0 );
+				++count;
+			}
+			Assert::AreEqual( 8U, count );
+			Assert::AreEqual( 8U, text.GraphemeCount() );
+			Assert::AreEqual( 0U, String().GraphemeCount() );
+
+			// A ZWJ without a pictograph in front does not join
+			Assert::AreEqual( 2U, String( "a\xE2\x80\x8D\xF0\x9F\x92\xBB" ).GraphemeCount() );
+			// Prepend and SpacingMark
+			Assert::AreEqual( 1U, String( "\xD8\x80" "1" ).GraphemeCount() );
+			Assert::AreEqual( 1U, String( "\xE0\xA4\x95\xE0\xA4\xBE" ).GraphemeCount() );
+
+			// Long Latin runs are skipped in blocks, a combining mark right behind a block still joins its base
+			String latin( "Gr\xC3\xBC\xC3\x9F" "e aus K\xC3\xB6ln und M\xC3\xBCnchen\r\nA" "e\xCC\x81" );
+			Assert::AreEqual( latin.CharCount() - 2U, latin.GraphemeCount() );
+			uti::u32 iterated = 0U;
+			for( auto it = latin.Graphemes(); it.Valid(); ++it )
+			{
+				++iterated;
+			}
+			Assert::AreEqual( latin.GraphemeCount(), iterated );
+			for( uti::u32 offset = 0U; offset < 40U; ++offset )
+			{
+				std::string padded = std::string( offset, 'x' ) + "a\xCC\x81\xC3\xA9\xCC\x81\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x92\xBB\r\n" + std::string( 20U, 'y' );
+				Assert::AreEqual( offset + 4U + 20U, String( padded.c_str() ).GraphemeCount() );
+			}
+		}
+
+		TEST_METHOD( WordTest )
+		{
+			// The example of UAX #29
+			String text( "The quick (\"brown\") fox can't jump 32.3 feet, right?" );
+			const char* expected[] = { "The", " ", "quick", " ", "(", "\"", "brown", "\"", ")", " ", "fox", " ", "can't", " ",
+				"jump", " ", "32.3", " ", "feet", ",", " ", "right", "?" };
+			uti::u32 count = 0U;
+			uti::u32 words = 0U;
+			for( auto it = text.Words(); it.Valid(); ++it )
+			{
+				Assert::IsTrue( count < 23U );
+				Assert::AreEqual( static_cast< uti::u32 >( strlen( expected[ count ] ) ), it.SegmentSize() );
+				Assert::IsTrue( memcmp( it.Pointer(), expected[ count ], it.SegmentSize() ) == 0 );
+				Assert::AreEqual( isalnum( static_cast< unsigned char >( expected[ count ][ 0 ] ) ) != 0, it.IsWord() );
+				words += it.IsWord() ? 1U : 0U;
+				++count;
+			}
+			Assert::AreEqual( 23U, count );
+			Assert::AreEqual( 9U, words );
+			Assert::IsFalse( String().Words().Valid() );
+
+			// Hebrew abbreviations, Katakana, ideographs, combining marks, an emoji ZWJ sequence and flags
+			String mixed( "\xD7\xA6\xD7\x94\"\xD7\x9C \xE3\x82\xAB\xE3\x82\xBF\xE3\x82\xAB\xE3\x83\x8A\xE6\x97\xA5\xE6\x9C\xAC "
+				"e\xCC\x81t\xC3\xA9 \xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x92\xBB\xF0\x9F\x87\xA9\xF0\x9F\x87\xAA\xF0\x9F\x87\xAB" );
+			uti::u32 sizes[] = { 7U, 1U, 12U, 3U, 3U, 1U, 6U, 1U, 11U, 8U, 4U };
+			bool isWord[] = { true, false, true, true, true, false, true, false, false, false, false };
+			count = 0U;
+			for( auto it = mixed.Words(); it.Valid(); ++it )
+			{
+				Assert::IsTrue( count < 11U );
+				Assert::AreEqual( sizes[ count ], ( *it ).Size() );
+				Assert::AreEqual( isWord[ count ], it.IsWord() );
+				++count;
+			}
+			Assert::AreEqual( 11U, count );
+
+			// Runs of ASCII letters are skipped in blocks, the rules around them still see their last two chars
+			for( uti::u32 offset = 0U; offset < 40U; ++offset )
+			{
+				std::string padded = std::string( offset, 'x' ) + "can't 3.5 a.b. e\xCC\x81" + std::string( 20U, 'y' ) + "_1";
+				String string( padded.c_str() );
+				uti::u32 sizes[] = { offset + 5U, 1U, 3U, 1U, 3U, 1U, 1U, 25U };
+				count = 0U;
+				const char* pos = string.Bytes().begin();
+				for( auto segment : string.Words() )
+				{
+					Assert::IsTrue( count < 8U );
+					Assert::IsTrue( segment.begin() == pos );
+					Assert::AreEqual( sizes[ count ], segment.Size() );
+					pos = segment.end();
+					++count;
+				}
+				Assert::AreEqual( 8U, count );
+			}
+		}
+
+		TEST_METHOD( SentenceTest )
+		{
+			String text( "Mr. Smith went to Washington. He said \"Hi!\" and left.\r\nNew line? yes. etc. ok 3.14 is pi." );
+			const char* expected[] = { "Mr. ", "Smith went to Washington. ", "He said \"Hi!\" ", "and left.\r\n", "New line? ",
+				"yes. etc. ok 3.14 is pi." };
+			uti::u32 count = 0U;
+			for( auto sentence : text.Sentences() )
+			{
+				Assert::IsTrue( count < 6U );
+				Assert::AreEqual( static_cast< uti::u32 >( strlen( expected[ count ] ) ), sentence.Size() );
+				Assert::IsTrue( memcmp( sentence.begin(), expected[ count ], sentence.Size() ) == 0 );
+				++count;
+			}
+			Assert::AreEqual( 6U, count );
+			Assert::IsFalse( String().Sentences().Valid() );
+
+			// Ideographic full stops, a paragraph separator and a lower case letter behind a terminator and a quote
+			String mixed( "\xE4\xBD\xA0\xE5\xA5\xBD\xE3\x80\x82\xE5\x86\x8D\xE8\xA7\x81\xE3\x80\x82" "Ende\xE2\x80\xA9" "Start. \"no\" end." );
+			uti::u32 sizes[] = { 9U, 9U, 7U, 16U };
+			count = 0U;
+			for( auto it = mixed.Sentences(); it.Valid(); ++it )
+			{
+				Assert::IsTrue( count < 4U );
+				Assert::AreEqual( sizes[ count ], it.SentenceSize() );
+				++count;
+			}
+			Assert::AreEqual( 4U, count );
+
+			// Runs of ASCII text are skipped in blocks, the letter in front of a full stop is still seen ( SB7 )
+			for( uti::u32 offset = 0U; offset < 40U; ++offset )
+			{
+				std::string padded = std::string( offset, 'x' ) + " U.S.A was. Next" + std::string( 20U, ' ' ) + "one!\nEnd";
+				String string( padded.c_str() );
+				uti::u32 sizes[] = { offset + 12U, 29U, 3U };
+				count = 0U;
+				for( auto sentence : string.Sentences() )
+				{
+					Assert::IsTrue( count < 3U );
+					Assert::AreEqual( sizes[ count ], sentence.Size() );
+					++count;
+				}
+				Assert::AreEqual( 3U, count );
+			}
+		}
+
+		TEST_METHOD( SplitTest )
+		{
+			// Joins the fields with '|', so the expected fields fit into one literal
+			auto join = []( String::SplitCursor fields ) -> std::string
+			{
+				std::string result;
+				for( auto it = fields; it.Valid(); ++it )
+				{
+					result += it == fields ? "" : "|";
+					result.append( ( *it ).begin(), ( *it ).end() );
+				}
+				return result;
+			};
+
+			String line( "alpha,beta,,gamma," );
+			Assert::AreEqual( std::string( "alpha|beta||gamma|" ), join( line.Split( "," ) ) );
+			Assert::AreEqual( std::string( "alpha|beta|gamma" ), join( line.Split( ",", uti::SplitOptions::SkipEmpty ) ) );
+			Assert::AreEqual( std::string( "alpha|beta,,gamma," ), join( line.Split( ",", uti::SplitOptions::None, 1U ) ) );
+			Assert::AreEqual( std::string( "|gamma|alpha,beta," ), join( line.Split( ",", uti::SplitOptions::Reverse, 2U ) ) );
+			Assert::AreEqual( std::string( "gamma|alpha,beta" ), join( line.Split( ",", uti::SplitOptions::Reverse | uti::SplitOptions::SkipEmpty, 1U ) ) );
+			Assert::AreEqual( std::string( "alpha,beta,,gamma," ), join( line.Split( ",", uti::SplitOptions::None, 0U ) ) );
+			Assert::AreEqual( std::string( "alpha,beta|gamma," ), join( line.Split( ",," ) ) );
+			Assert::AreEqual( std::string( "alpha,beta,,gamma," ), join( line.Split( String() ) ) );
+
+			// The fields are views on the string, not copies
+			uti::u32 count = 0U;
+			for( auto field : line.Split( "," ) )
+			{
+				Assert::IsTrue( field.begin() >= line.Bytes().begin() && field.end() <= line.Bytes().end() );
+				Assert::IsTrue( field.IsAscii() );
+				++count;
+			}
+			Assert::AreEqual( 5U, count );
+
+			// An empty string is one empty field, unless empty fields are skipped
+			count = 0U;
+			for( auto it = String().Split( "," ); it.Valid(); ++it )
+			{
+				Assert::AreEqual( 0U, it.FieldSize() );
+				++count;
+			}
+			Assert::AreEqual( 1U, count );
+			Assert::IsFalse( String().Split( ",", uti::SplitOptions::SkipEmpty ).Valid() );
+			Assert::IsFalse( String( ",,," ).Split( ",", uti::SplitOptions::SkipEmpty | uti::SplitOptions::Reverse ).Valid() );
+
+			// The iterators hold a reference to the data, so a temporary string can be visited in a range based for loop
+			auto makeLine = []() { return String( ( std::string( 40U, 'x' ) + ",y\xC3\xA4,z. Next sentence." ).c_str() ); };
+			std::string fields;
+			for( auto field : makeLine().Split( "," ) )
+			{
+				fields.append( field.begin(), field.end() ).append( "|" );
+			}
+			Assert::AreEqual( std::string( 40U, 'x' ) + "|y\xC3\xA4|z. Next sentence.|", fields );
+			const String line2 = makeLine();
+			count = 0U;
+			for( auto field : makeLine().SplitAny( ",." ) )
+			{
+				count += field.Size();
+			}
+			Assert::AreEqual( line2.Size() - 4U, count );
+			count = 0U;
+			for( uti::u32 codePoint : makeLine().Chars() )
+			{
+				count += codePoint != 0U ? 1U : 0U;
+			}
+			Assert::AreEqual( line2.CharCount(), count );
+			count = 0U;
+			for( auto cluster : makeLine().Graphemes() )
+			{
+				count += cluster.Size();
+			}
+			Assert::AreEqual( line2.Size(), count );
+			count = 0U;
+			for( auto word : makeLine().Words() )
+			{
+				count += word.Size();
+			}
+			Assert::AreEqual( line2.Size(), count );
+			count = 0U;
+			for( auto sentence : makeLine().Sentences() )
+			{
+				count += sentence.Size();
+			}
+			Assert::AreEqual( line2.Size(), count );
+
+			// Multi byte delimiters and chars sharing their first byte with a delimiter
+			String dashes( "x\xE2\x80\x94y\xE2\x80\x93z\xE2\x80\x94" );
+			Assert::AreEqual( std::string( "x|y\xE2\x80\x93z|" ), join( dashes.Split( "\xE2\x80\x94" ) ) );
+			Assert::AreEqual( std::string( "x|y|z|" ), join( dashes.SplitAny( "\xE2\x80\x94\xE2\x80\x93" ) ) );
+
+			// Char sets
+			String words( " one\ttwo  three\n" );
+			Assert::AreEqual( std::string( "|one|two||three|" ), join( words.SplitAny( " \t\n" ) ) );
+			Assert::AreEqual( std::string( "one|two|three" ), join( words.SplitAny( " \t\n", uti::SplitOptions::SkipEmpty ) ) );
+			Assert::AreEqual( std::string( "one|two  three\n" ), join( words.SplitAny( " \t\n", uti::SplitOptions::SkipEmpty, 1U ) ) );
+			Assert::AreEqual( std::string( "three| one\ttwo" ), join( words.SplitAny( " \t\n", uti::SplitOptions::SkipEmpty | uti::SplitOptions::Reverse, 1U ) ) );
+			Assert::AreEqual( std::string( "a|b\xC3\xA4|c" ), join( String( "a\xC3\x97" "b\xC3\xA4\xC3\x97" "c" ).SplitAny( "\xC3\x97;" ) ) );
+			Assert::AreEqual( std::string( "a|b|c|d|e|f|g|h|i|j|k|l|m|n|o|p|q|r" ),
+				join( String( "a0b1c2d3e4f5g6h7i8j9kAlBmCnDoEpFqGr" ).SplitAny( "0123456789ABCDEFG" ) ) );
+
+			// Delimiters are found in blocks, the fields around the block boundaries have to be exact
+			for( uti::u32 offset = 1U; offset < 40U; ++offset )
+			{
+				std::string text = std::string( offset, 'a' ) + "::" + std::string( 20U, 'b' ) + ":" + std::string( 17U, 'c' ) + "::d";
+				String string( text.c_str() );
+				std::string expected = std::string( offset, 'a' ) + "|" + std::string( 20U, 'b' ) + ":" + std::string( 17U, 'c' ) + "|d";
+				Assert::AreEqual( expected, join( string.Split( "::" ) ) );
+				expected = "d|" + std::string( 20U, 'b' ) + ":" + std::string( 17U, 'c' ) + "|" + std::string( offset, 'a' );
+				Assert::AreEqual( expected, join( string.Split( "::", uti::SplitOptions::Reverse ) ) );
+				expected = std::string( offset, 'a' ) + "|" + std::string( 20U, 'b' ) + "|" + std::string( 17U, 'c' ) + "|d";
+				Assert::AreEqual( expected, join( string.SplitAny( ":", uti::SplitOptions::SkipEmpty ) ) );
+				expected = "d|" + std::string( 17U, 'c' ) + "|" + std::string( 20U, 'b' ) + "|" + std::string( offset, 'a' );
+				Assert::AreEqual( expected, join( string.SplitAny( ":", uti::SplitOptions::SkipEmpty | uti::SplitOptions::Reverse ) ) );
+			}
+		}
+		TEST_METHOD( ValidPrefixTest )
+		{
+			const char valid[] = "a\xC3\xA4\xE2\x82\xAC\xED\x9F\xBF\xEE\x80\x80\xF0\x90\x80\x80\xF4\x8F\xBF\xBF";
+			Assert::AreEqual( static_cast< uti::u32 >( sizeof( valid ) - 1U ), String::ValidPrefix( valid, sizeof( valid ) - 1U ) );
+
+			// Overlong forms, surrogates, code points above U+10FFFF, stray continuation bytes and truncated chars
+			const char* invalid[] = { "\xC0\xAF", "\xC1\xBF", "\xE0\x9F\xBF", "\xED\xA0\x80", "\xF0\x8F\xBF\xBF", "\xF4\x90\x80\x80",
+				"\xF5\x80\x80\x80", "\xFF", "\x80", "\xC3\x28", "\xE2\x82", "\xF0\x9F\x98" };
+			for( const char* bytes : invalid )
+			{
+				std::string text = std::string( 37U, 'x' ) + bytes + "yz";
+				Assert::AreEqual( 37U, String::ValidPrefix( text.c_str(), static_cast< uti::u32 >( text.size() ) ) );
+				Assert::AreEqual( 37U, String::ValidPrefix( text.c_str(), 37U + static_cast< uti::u32 >( strlen( bytes ) ) ) );
+			}
+		}
+
+		TEST_METHOD( ParallelConstructionTest )
+		{
+			std::string text;
+			while( text.size() < 3U * String::ParallelChunkSize )
+			{
+				text += "Parallel \xC3\xA4\xE2\x82\xAC\xF0\x9F\x98\x80 construction ";
+			}
+			const uti::u32 threshold = String::ParallelThreshold;
+			const uti::u32 threadCount = String::ParallelThreadCount;
+			String::ParallelThreadCount = 3U;
+
+			// The parallel path has to build exactly what the single threaded one builds, also for invalid input
+			std::string broken = text;
+			broken[ text.size() / 2U ] = '\xFF';
+			const std::string ascii( text.size(), 'a' );
+			const std::string* inputs[] = { &text, &broken, &ascii };
+			for( const std::string* input : inputs )
+			{
+				String::ParallelThreshold = 0xFFFFFFFFU;
+				String single( input->c_str() );
+				String::ParallelThreshold = String::ParallelChunkSize;
+				String parallel( input->c_str() );
+				Assert::IsTrue( single == parallel );
+				Assert::AreEqual( single.CharCount(), parallel.CharCount() );
+				Assert::AreEqual( single.IsAscii(), parallel.IsAscii() );
+			}
+			String::ParallelThreshold = threshold;
+			String::ParallelThreadCount = threadCount;
+		}
+
+		TEST_METHOD( MakeManyTest )
+		{
+			const char record[] = "Name,K\xC3\xB6ln,,\xE2\x82\xAC 12,\xF0\x9F\x98\x80";
+			const String::Span fields[] =
+			{
+				String::Span( record, record + 4 ),
+				String::Span( record + 5, record + 10 ),
+				String::Span( record + 11, record + 11 ),
+				String::Span( record + 12, record + 18 ),
+				String::Span( record + 19, record + 23 )
+			};
+			const char* expected[] = { "Name", "K\xC3\xB6ln", "", "\xE2\x82\xAC 12", "\xF0\x9F\x98\x80" };
+			const uti::u32 charCounts[] = { 4U, 4U, 0U, 4U, 1U };
+
+			String strings[ 5 ];
+			Assert::IsTrue( String::MakeMany( fields, 5U, strings ) );
+			for( uti::u32 i = 0U; i < 5U; ++i )
+			{
+				Assert::IsTrue( strings[ i ] == String( expected[ i ] ) );
+				Assert::AreEqual( charCounts[ i ], strings[ i ].CharCount() );
+				Assert::AreEqual( i == 0U || i == 2U, strings[ i ].IsAscii() );
+				Assert::AreEqual( '\0', strings[ i ].c_str()[ strings[ i ].Size() ] );
+				Assert::AreEqual( 1U, strings[ i ].ReferenceCount() );
+				Assert::AreEqual( String( expected[ i ] ).Hash(), strings[ i ].Hash() );
+			}
+			// The payloads lie behind each other in one slab
+			Assert::IsTrue( strings[ 1 ].c_str() == strings[ 0 ].c_str() + 5 );
+			Assert::IsTrue( strings[ 4 ].c_str() == strings[ 3 ].c_str() + 7 );
+
+			// Each string is counted on its own, the slab outlives any of them
+			String copy( strings[ 1 ] );
+			Assert::AreEqual( 2U, strings[ 1 ].ReferenceCount() );
+			for( String& string : strings )
+			{
+				string = String();
+			}
+			Assert::IsTrue( copy == String( "K\xC3\xB6ln" ) );
+			copy = copy.ToUpper();
+			Assert::IsTrue( copy == String( "K\xC3\x96LN" ) );
+
+			// A char cut off by the end of its slice or an invalid byte fails the whole batch
+			const String::Span cut[] = { String::Span( record, record + 4 ), String::Span( record + 5, record + 7 ) };
+			String untouched[ 2 ] = { String( "a" ), String( "b" ) };
+			Assert::IsFalse( String::MakeMany( cut, 2U, untouched ) );
+			Assert::IsTrue( untouched[ 0 ] == String( "a" ) && untouched[ 1 ] == String( "b" ) );
+			const char invalid[] = "ok\xFF";
+			const String::Span broken[] = { String::Span( invalid, invalid + 2 ), String::Span( invalid + 2, invalid + 3 ) };
+			Assert::IsFalse( String::MakeMany( broken, 2U, untouched ) );
+			Assert::IsTrue( String::MakeMany( broken, 1U, untouched ) );
+			Assert::IsTrue( untouched[ 0 ] == String( "ok" ) );
+			Assert::IsTrue( String::MakeMany( broken, 0U, untouched ) );
+
+			// The slab counter is always atomic, so strings of one batch can be released on different threads, even if they count non atomically
+			for( uti::u32 round = 0U; round < 64U; ++round )
+			{
+				String released[ 2 ];
+				Assert::IsTrue( String::MakeMany( fields, 2U, released ) );
+				std::thread release( [ &released ]()
+				{
+					released[ 0 ] = String();
+				} );
+				released[ 1 ] = String();
+				release.join();
+			}
+		}
+
 	};
 }